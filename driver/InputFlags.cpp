@@ -50,6 +50,12 @@ void InputFlags::AddInputFlag(const std::string& _long_name,
 }
 
 [[gnu::noreturn]] void InputFlags::Print() const
+{
+    PrintFlags();
+    exit(0);
+}
+
+void InputFlags::PrintFlags() const
 {
     printf("MIOpen Driver Input Flags: \n\n");
 
@@ -79,7 +85,6 @@ void InputFlags::AddInputFlag(const std::string& _long_name,
             std::cout << std::setw(37) << " " << *help_next_line << std::endl;
         }
     }
-    exit(0);
 }
 
 char InputFlags::FindShortName(const std::string& long_name) const
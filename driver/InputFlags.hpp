@@ -51,7 +51,10 @@ class InputFlags
                       const std::string& type);
     void Parse(int argc, char* argv[]);
     char FindShortName(const std::string& _long_name) const;
+    /// Prints the flags and exits.
     void Print() const;
+    /// Prints the flags.
+    void PrintFlags() const;
 
     std::string GetValueStr(const std::string& _long_name) const;
     int GetValueInt(const std::string& _long_name) const;
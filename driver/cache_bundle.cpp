@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "InputFlags.hpp"
+
+#include <miopen/errors.hpp>
+#include <miopen/kern_db_bundle.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Moves kernel binaries between the kernel cache databases (user *.ukdb and system *.kdb) by
+// means of portable bundle files, so that the caches built once can be rolled out to the nodes.
+
+static void PrintUsage()
+{
+    printf("Usage: ./MIOpenCacheBundle *command* *other_args*\n");
+    printf("Commands:\n"
+           "  export  Writes the entries of the kernel cache db --from into the bundle --to\n"
+           "  import  Merges the bundle --from into the kernel cache db --to\n"
+           "  list    Prints the keys of the kernel cache db --from, in the --keys format\n");
+}
+
+static std::vector<miopen::KernDbKey> ReadKeys(const std::string& filename)
+{
+    std::vector<miopen::KernDbKey> keys;
+    if(filename.empty())
+        return keys;
+
+    std::ifstream file(filename);
+    if(!file)
+        MIOPEN_THROW(miopenStatusBadParm, "Could not open file " + filename + " for reading");
+
+    std::string line;
+    while(std::getline(file, line))
+    {
+        const auto tab = line.find('\t');
+        if(tab == std::string::npos)
+            continue;
+        keys.emplace_back(line.substr(0, tab), line.substr(tab + 1));
+    }
+    return keys;
+}
+
+static void PrintStats(const miopen::KernDbBundleStats& stats)
+{
+    std::cout << "kernels: " << stats.kernels << ", binaries: " << stats.blobs
+              << ", skipped: " << stats.skipped << ", corrupted: " << stats.corrupted
+              << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    const std::string command = argv[1];
+    if(command != "export" && command != "import" && command != "list")
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    InputFlags inflags;
+    inflags.AddInputFlag("from", 'f', "", "Source kernel cache db or bundle (Required)", "string");
+    inflags.AddInputFlag("to", 't', "", "Destination bundle or kernel cache db", "string");
+    inflags.AddInputFlag(
+        "arch", 'a', "", "Device name, e.g. gfx906 (Required for export)", "string");
+    inflags.AddInputFlag("num_cu", 'n', "0", "Number of compute units of the device", "int");
+    inflags.AddInputFlag("keys",
+                         'k',
+                         "",
+                         "File with the keys of the entries to export, one per line:\n"
+                         "kernel_name<TAB>kernel_args (Default: all entries)",
+                         "string");
+    inflags.AddInputFlag(
+        "overwrite", 'o', "0", "Replace the entries present in the destination (Default=0)", "int");
+    inflags.Parse(argc, argv);
+
+    const auto from   = inflags.GetValueStr("from");
+    const auto to     = inflags.GetValueStr("to");
+    const auto arch   = inflags.GetValueStr("arch");
+    const auto num_cu = static_cast<std::size_t>(inflags.GetValueInt("num_cu"));
+
+    if(from.empty() || (command != "list" && to.empty()) || (command == "export" && arch.empty()))
+    {
+        std::cout << "Required arguments are missing" << std::endl;
+        PrintUsage();
+        inflags.PrintFlags();
+        return 1;
+    }
+
+    try
+    {
+        if(command == "list")
+        {
+            for(const auto& key : miopen::ListKernDbKeys(from))
+                std::cout << key.first << '\t' << key.second << std::endl;
+        }
+        else if(command == "export")
+        {
+            const auto keys = ReadKeys(inflags.GetValueStr("keys"));
+            PrintStats(miopen::ExportKernDbBundle(from, to, arch, num_cu, keys));
+        }
+        else
+        {
+            const auto overwrite = inflags.GetValueInt("overwrite") != 0;
+            PrintStats(miopen::ImportKernDbBundle(from, to, arch, num_cu, overwrite));
+        }
+    }
+    catch(const miopen::Exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
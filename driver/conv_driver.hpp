@@ -155,6 +155,16 @@ bool readBufferFromFile(T* data, size_t dataNumItems, const char* fileName)
     }
 }
 
+// Convolution problem in the format of miopenConvolutionPrecompile().
+struct ConvPrecompileProblem
+{
+    miopenTensorDescriptor_t x;
+    miopenTensorDescriptor_t w;
+    miopenConvolutionDescriptor_t conv;
+    miopenTensorDescriptor_t y;
+    miopenConvDirection_t direction;
+};
+
 // Tgpu and Tref are the data-type in GPU memory and CPU memory respectively.
 // They are not necessarily the same as the computation type on GPU or CPU
 template <typename Tgpu, typename Tref>
@@ -227,6 +237,26 @@ class ConvDriver : public Driver
 
     int VerifyBackward();
     int VerifyForward();
+
+    // Problems enabled by the command line, valid after GetandSetData().
+    std::vector<ConvPrecompileProblem> GetPrecompileProblems() const
+    {
+        const auto is_transform = IsInputTensorTransform();
+        const auto x            = is_transform ? inputTensor_vect4 : inputTensor;
+        const auto w            = is_transform ? weightTensor_vect4 : weightTensor;
+
+        std::vector<ConvPrecompileProblem> problems;
+        if(is_fwd)
+            problems.push_back({x, w, convDesc, outputTensor, miopenConvDirectionForward});
+        if(data_type == miopenInt8 || data_type == miopenInt8x4)
+            return problems; // Only forward is supported for int8.
+        if(is_bwd)
+            problems.push_back({x, w, convDesc, outputTensor, miopenConvDirectionBackwardData});
+        if(is_wrw)
+            problems.push_back({x, w, convDesc, outputTensor, miopenConvDirectionBackwardWeights});
+        return problems;
+    }
+
     ~ConvDriver()
     {
         miopenDestroyTensorDescriptor(biasTensor);
@@ -34,6 +34,7 @@
 #include "gemm_driver.hpp"
 #include "lrn_driver.hpp"
 #include "pool_driver.hpp"
+#include "precompile_driver.hpp"
 #include "softmax_driver.hpp"
 #include "rnn_driver.hpp"
 #include "ctc_driver.hpp"
@@ -174,6 +175,10 @@ int main(int argc, char* argv[])
     {
         drv = new ReduceDriver<float16, float>();
     }
+    else if(base_arg == "precompile")
+    {
+        drv = new PrecompileDriver();
+    }
     else
     {
         printf("Incorrect BaseArg\n");
@@ -195,11 +200,13 @@ int main(int argc, char* argv[])
         return rc;
     }
 
-    int fargval = ((base_arg != "CBAInfer") && (base_arg != "CBAInferfp16"))
+    int fargval = ((base_arg != "CBAInfer") && (base_arg != "CBAInferfp16") &&
+                   (base_arg != "precompile"))
                       ? drv->GetInputFlags().GetValueInt("forw")
                       : 1;
-    bool bnFwdInVer   = (fargval == 2 && (base_arg == "bnorm"));
-    bool verifyarg    = (drv->GetInputFlags().GetValueInt("verify") == 1);
+    bool bnFwdInVer = (fargval == 2 && (base_arg == "bnorm"));
+    bool verifyarg =
+        (base_arg != "precompile") && (drv->GetInputFlags().GetValueInt("verify") == 1);
     int cumulative_rc = 0; // Do not stop running tests in case of errors.
 
     if(fargval & 1 || fargval == 0 || bnFwdInVer)
@@ -27,9 +27,14 @@
 #ifndef MLO_CONVHOST_H_
 #define MLO_CONVHOST_H_
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <thread>
+#include <vector>
+
+#include <miopen/par_for.hpp>
 
 #include "calcerr.hpp"
 
@@ -39,6 +44,14 @@
 //
 ///////////////////////////////////////////////////////////
 #define ADNN_MM_TRANSPOSE 1
+
+/// Number of threads used by ADNN_mm_cpu, all hardware threads by default.
+inline size_t& ADNN_mm_cpu_threads()
+{
+    static size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    return threads;
+}
+
 template <typename Dtype>
 void ADNN_mm_cpu(const Dtype* a_ptr,
                  size_t a_cols,
@@ -85,91 +98,61 @@ void ADNN_mm_cpu(const Dtype* a_ptr,
     }
 
     size_t inner_loop = (!(a_flags & ADNN_MM_TRANSPOSE)) ? a_cols : a_rows;
+    const bool a_trans = (a_flags & ADNN_MM_TRANSPOSE) != 0;
+    const bool b_trans = (b_flags & ADNN_MM_TRANSPOSE) != 0;
 
-    if(!(a_flags & ADNN_MM_TRANSPOSE) && !(b_flags & ADNN_MM_TRANSPOSE))
-    {
-        for(size_t n = 0; n < c_rows; ++n)
+    // Rows of C are independent and every element is accumulated over m in ascending order,
+    // so the result does not depend on the number of threads. When B is not transposed, a row
+    // is accumulated as a sum of scaled rows of B, which reads B contiguously.
+    auto mm_row = [&](size_t n) {
+        Dtype* c_row = &c_ptr[n * c_stride];
+
+        if(!b_trans)
         {
-            for(size_t k = 0; k < c_cols; ++k)
+            static thread_local std::vector<Dtype> mm_e;
+            mm_e.assign(c_cols, static_cast<Dtype>(0));
+            for(size_t m = 0; m < inner_loop; ++m)
             {
-                Dtype mm_e = static_cast<Dtype>(0);
-                for(size_t m = 0; m < inner_loop; ++m)
-                {
-                    mm_e += a_ptr[n * a_stride + m] * b_ptr[m * b_stride + k];
-                }
-                c_ptr[n * c_stride + k] = beta * c_ptr[n * c_stride + k] + alpha * mm_e;
+                const Dtype a_e    = a_trans ? a_ptr[m * a_stride + n] : a_ptr[n * a_stride + m];
+                const Dtype* b_row = &b_ptr[m * b_stride];
+                for(size_t k = 0; k < c_cols; ++k)
+                    mm_e[k] += a_e * b_row[k];
             }
-        }
-    }
-    else if((a_flags & ADNN_MM_TRANSPOSE) && !(b_flags & ADNN_MM_TRANSPOSE))
-    {
-        for(size_t n = 0; n < c_rows; ++n)
-        {
             for(size_t k = 0; k < c_cols; ++k)
-            {
-
-                Dtype mm_e = static_cast<Dtype>(0);
-                for(size_t m = 0; m < inner_loop; ++m)
-                {
-                    mm_e += a_ptr[m * a_stride + n] * b_ptr[m * b_stride + k];
-#if 0
-					if (
-						(n == 0 && k == 33
-						|| n == 1 && k == 32
-						|| n == 3 && k == 1
-						|| n == 4 && k == 0
-
-						)
-						&& a_ptr[m*a_stride + n] * b_ptr[m*b_stride + k] != 0
-						)
-					{
-						printf("C:mm:%d %d %d   %11.9f %11.9f %11.9f %11.9f\n",
-							n, k, m,
-							mm_e, a_ptr[m*a_stride + n], b_ptr[m*b_stride + k], a_ptr[m*a_stride + n] * b_ptr[m*b_stride + k]);
-					}
-#endif
-                }
-                c_ptr[n * c_stride + k] = beta * c_ptr[n * c_stride + k] + alpha * mm_e;
-            }
+                c_row[k] = beta * c_row[k] + alpha * mm_e[k];
         }
-    }
-    else if(!(a_flags & ADNN_MM_TRANSPOSE) && (b_flags & ADNN_MM_TRANSPOSE))
-    {
-        for(size_t n = 0; n < c_rows; ++n)
+        else if(!a_trans)
         {
+            const Dtype* a_row = &a_ptr[n * a_stride];
             for(size_t k = 0; k < c_cols; ++k)
             {
-                Dtype mm_e = static_cast<Dtype>(0);
-
+                const Dtype* b_row = &b_ptr[k * b_stride];
+                Dtype mm_e         = static_cast<Dtype>(0);
                 for(size_t m = 0; m < inner_loop; ++m)
-                {
-                    mm_e += a_ptr[n * a_stride + m] * b_ptr[k * b_stride + m];
-#if 0
-					if (n == 0 && k == 6 && a_ptr[n*a_stride + m] * b_ptr[k*b_stride + m] != 0)
-					{
-						printf("%4d  %11.9f %11.9f %11.9f\n", m, mm_e, a_ptr[n*a_stride + m], b_ptr[k*b_stride + m]);
-					}
-#endif
-                }
-                c_ptr[n * c_stride + k] = beta * c_ptr[n * c_stride + k] + alpha * mm_e;
+                    mm_e += a_row[m] * b_row[m];
+                c_row[k] = beta * c_row[k] + alpha * mm_e;
             }
         }
-    }
-    else
-    {
-        for(size_t n = 0; n < c_rows; ++n)
+        else
         {
             for(size_t k = 0; k < c_cols; ++k)
             {
                 Dtype mm_e = static_cast<Dtype>(0);
                 for(size_t m = 0; m < inner_loop; ++m)
                 {
-                    c_ptr[n * c_stride + k] += a_ptr[m * a_stride + n] * b_ptr[k * b_stride + m];
+                    c_row[k] += a_ptr[m * a_stride + n] * b_ptr[k * b_stride + m];
                 }
-                c_ptr[n * c_stride + k] = beta * c_ptr[n * c_stride + k] + alpha * mm_e;
+                c_row[k] = beta * c_row[k] + alpha * mm_e;
             }
         }
-    }
+    };
+
+    // Small products are not worth a thread.
+    const size_t min_work = size_t{1} << 16;
+    const size_t work     = c_rows * c_cols * std::max<size_t>(inner_loop, 1);
+    const size_t threads =
+        std::min({ADNN_mm_cpu_threads(), c_rows, std::max<size_t>(work / min_work, 1)});
+    miopen::par_for_impl(c_rows, threads, mm_row);
 }
 
 template <typename Dtype>
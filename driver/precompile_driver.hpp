@@ -0,0 +1,189 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_PRECOMPILE_DRIVER_HPP
+#define GUARD_MIOPEN_PRECOMPILE_DRIVER_HPP
+
+#include "InputFlags.hpp"
+#include "conv_driver.hpp"
+#include "driver.hpp"
+#include "timer.hpp"
+
+#include <miopen/miopen.h>
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// Builds ahead of time the kernels for a list of MIOpenDriver command lines, e.g. captured with
+/// MIOPEN_ENABLE_LOGGING_CMD=1, so that the user kernel cache can be shipped warm.
+/// Each problem is resolved to its find-db solutions by the library, so the find-db shall
+/// be populated beforehand. Only convolutions are supported, other lines are skipped.
+class PrecompileDriver : public Driver
+{
+    public:
+    PrecompileDriver() : Driver() {}
+
+    int AddCmdLineArgs()
+    {
+        inflags.AddInputFlag("input",
+                             'i',
+                             "",
+                             "File with MIOpenDriver command lines, one per line, e.g. the output "
+                             "of MIOPEN_ENABLE_LOGGING_CMD=1 (Required)",
+                             "string");
+        return 0;
+    }
+
+    int ParseCmdLineArgs(int argc, char* argv[])
+    {
+        inflags.Parse(argc, argv);
+
+        const auto filename = inflags.GetValueStr("input");
+        if(filename.empty())
+        {
+            std::cout << "Fatal: --input is not specified" << std::endl;
+            return 1;
+        }
+
+        std::ifstream file(filename);
+        if(!file)
+        {
+            std::cout << "Could not open file " << filename << " for reading" << std::endl;
+            return 1;
+        }
+
+        std::string line;
+        while(std::getline(file, line))
+            AddCommandLine(line);
+
+        std::cout << "Read " << problems.size() << " convolution problems, skipped "
+                  << skipped_lines << " lines" << std::endl;
+        return 0;
+    }
+
+    InputFlags& GetInputFlags() { return inflags; }
+    int GetandSetData() { return 0; }
+    int AllocateBuffersAndCopy() { return 0; }
+
+    int RunForwardGPU()
+    {
+        std::vector<miopenTensorDescriptor_t> x_descs, w_descs, y_descs;
+        std::vector<miopenConvolutionDescriptor_t> conv_descs;
+        std::vector<miopenConvDirection_t> directions;
+
+        for(const auto& problem : problems)
+        {
+            x_descs.push_back(problem.x);
+            w_descs.push_back(problem.w);
+            conv_descs.push_back(problem.conv);
+            y_descs.push_back(problem.y);
+            directions.push_back(problem.direction);
+        }
+
+        Timer t;
+        t.start();
+        const auto rc = miopenConvolutionPrecompile(GetHandle(),
+                                                    problems.size(),
+                                                    x_descs.data(),
+                                                    w_descs.data(),
+                                                    conv_descs.data(),
+                                                    y_descs.data(),
+                                                    directions.data());
+        t.stop();
+
+        if(rc != miopenStatusSuccess)
+            return rc;
+        std::cout << "Precompiled " << problems.size() << " problems in " << t.gettime_ms()
+                  << " ms" << std::endl;
+        return 0;
+    }
+
+    int VerifyForward() { return 0; }
+    int RunBackwardGPU() { return 0; }
+    int VerifyBackward() { return 0; }
+
+    private:
+    InputFlags inflags;
+    // Owners of the descriptors referenced by the problems.
+    std::vector<std::unique_ptr<Driver>> conv_drivers;
+    std::vector<ConvPrecompileProblem> problems;
+    std::size_t skipped_lines = 0;
+
+    template <class Tgpu>
+    void AddConvProblems(std::vector<std::string>& args)
+    {
+        auto driver = std::make_unique<ConvDriver<Tgpu, float>>();
+        std::vector<char*> argv;
+        for(auto& arg : args)
+            argv.push_back(&arg[0]);
+
+        driver->AddCmdLineArgs();
+        if(driver->ParseCmdLineArgs(static_cast<int>(argv.size()), argv.data()) != 0 ||
+           driver->GetandSetData() != 0)
+        {
+            ++skipped_lines;
+            return;
+        }
+
+        const auto driver_problems = driver->GetPrecompileProblems();
+        problems.insert(problems.end(), driver_problems.begin(), driver_problems.end());
+        conv_drivers.push_back(std::move(driver));
+    }
+
+    void AddCommandLine(const std::string& line)
+    {
+        const auto driver_pos = line.find("MIOpenDriver ");
+        std::istringstream ss(driver_pos == std::string::npos
+                                  ? line
+                                  : line.substr(driver_pos + std::string("MIOpenDriver").size()));
+
+        // argv[0] is not parsed by the drivers.
+        std::vector<std::string> args = {"MIOpenDriver"};
+        std::string arg;
+        while(ss >> arg)
+            args.push_back(arg);
+
+        if(args.size() < 2 || args[1][0] == '#')
+            return;
+
+        const auto& base_arg = args[1];
+        if(base_arg == "conv")
+            AddConvProblems<float>(args);
+        else if(base_arg == "convfp16")
+            AddConvProblems<float16>(args);
+        else if(base_arg == "convbfp16")
+            AddConvProblems<bfloat16>(args);
+        else if(base_arg == "convint8")
+            AddConvProblems<int8_t>(args);
+        else
+            ++skipped_lines;
+    }
+};
+
+#endif // GUARD_MIOPEN_PRECOMPILE_DRIVER_HPP
@@ -52,6 +52,8 @@
 #define XORWOW_PRECALC_MATRICES_NUM_DEV 64
 #define XORWOW_JUMP_LOG2_DEV 1
 #define XORWOW_SEQUENCE_JUMP_LOG2 67
+#define XORWOW_JUMP_TABLE_RADIX_LOG2 4
+#define XORWOW_JUMP_TABLE_DIGITS 4
 
 unsigned int xorwow_next(prngStates* cur_state)
 {
@@ -189,6 +191,37 @@ void generate_skipahead_matrices(unsigned int* matrix, bool is_skip_seq, bool is
     }
 }
 
+// Generate the sequence jump table: for the digit d of radix 2^XORWOW_JUMP_TABLE_RADIX_LOG2 and
+// its value v = 1 .. radix - 1, the matrix advancing by v * radix^d subsequences
+void generate_skipahead_jump_table(unsigned int* matrix)
+{
+    const unsigned int radix = 1U << XORWOW_JUMP_TABLE_RADIX_LOG2;
+    unsigned int matrixA[XORWOW_PRECALC_MATRICES_SZ];
+    unsigned int matrixB[XORWOW_PRECALC_MATRICES_SZ];
+    unsigned int digit_step[XORWOW_PRECALC_MATRICES_SZ];
+
+    // A^(2^67), the step of one subsequence
+    skipahead_one_step(matrixA);
+    mat_pow(matrixB, matrixA, 1ULL << (XORWOW_SEQUENCE_JUMP_LOG2 / 2));
+    mat_pow(digit_step,
+            matrixB,
+            1ULL << (XORWOW_SEQUENCE_JUMP_LOG2 - XORWOW_SEQUENCE_JUMP_LOG2 / 2));
+
+    for(unsigned int d = 0; d < XORWOW_JUMP_TABLE_DIGITS; d++)
+    {
+        std::copy(std::begin(digit_step), std::end(digit_step), std::begin(matrixA));
+        for(unsigned int v = 1; v < radix; v++)
+        {
+            std::copy(std::begin(matrixA),
+                      std::end(matrixA),
+                      &matrix[(d * (radix - 1) + v - 1) * XORWOW_PRECALC_MATRICES_SZ]);
+            mat_mat(matrixA, digit_step);
+        }
+        // matrixA is digit_step^radix now, the step of the next digit
+        std::copy(std::begin(matrixA), std::end(matrixA), std::begin(digit_step));
+    }
+}
+
 // write macros in file
 void write_macro(std::ofstream& os, bool is_device)
 {
@@ -223,6 +256,57 @@ void write_mat(std::ofstream& os, const std::string name, unsigned int* matrix,
     os << std::endl;
 }
 
+// write macros and jump table in file
+void write_jump_table(std::ofstream& os, unsigned int* matrix, bool is_device)
+{
+    const unsigned int num = ((1U << XORWOW_JUMP_TABLE_RADIX_LOG2) - 1) * XORWOW_JUMP_TABLE_DIGITS;
+
+    os << "#define XORWOW_DIM " << XORWOW_DIM << std::endl;
+    os << "#define XORWOW_BITS " << XORWOW_BITS << std::endl;
+    os << "#define XORWOW_PRECALC_MATRICES_SZ (XORWOW_BITS * XORWOW_DIM * XORWOW_DIM)" << std::endl;
+    os << "#define XORWOW_JUMP_TABLE_RADIX_LOG2 " << XORWOW_JUMP_TABLE_RADIX_LOG2 << std::endl;
+    os << "#define XORWOW_JUMP_TABLE_RADIX_MASK ((1 << XORWOW_JUMP_TABLE_RADIX_LOG2) - 1)"
+       << std::endl;
+    os << "#define XORWOW_JUMP_TABLE_DIGITS " << XORWOW_JUMP_TABLE_DIGITS << std::endl;
+    os << "#define XORWOW_JUMP_TABLE_BITS (XORWOW_JUMP_TABLE_RADIX_LOG2 * XORWOW_JUMP_TABLE_DIGITS)"
+       << std::endl;
+    os << "#define XORWOW_JUMP_TABLE_NUM (XORWOW_JUMP_TABLE_RADIX_MASK * XORWOW_JUMP_TABLE_DIGITS)"
+       << std::endl;
+    os << std::endl;
+
+    os << "static " << (is_device ? "__constant " : "const ") << "unsigned int "
+       << "precalc_xorwow_skipahead_jump_table"
+       << "[XORWOW_JUMP_TABLE_NUM][XORWOW_PRECALC_MATRICES_SZ] = {" << std::endl;
+    for(unsigned int k = 0; k < num; k++)
+    {
+        os << "    {";
+        for(int j = 0; j < XORWOW_PRECALC_MATRICES_SZ; j++)
+        {
+            os << matrix[k * XORWOW_PRECALC_MATRICES_SZ + j] << ", ";
+        }
+        os << "}," << std::endl;
+    }
+    os << "};" << std::endl;
+}
+
+// generate header files with the sequence jump table
+void generate_skipahead_jump_table_file()
+{
+    static unsigned int jump_table[((1U << XORWOW_JUMP_TABLE_RADIX_LOG2) - 1) *
+                                   XORWOW_JUMP_TABLE_DIGITS][XORWOW_PRECALC_MATRICES_SZ];
+    generate_skipahead_jump_table(&jump_table[0][0]);
+
+    std::ofstream os;
+    os.open("../src/include/miopen/precalc_xorwow_skipahead_jump_table.hpp");
+    write_jump_table(os, &jump_table[0][0], false);
+    os.close();
+    os.clear();
+
+    os.open("../src/kernels/precalc_xorwow_skipahead_jump_table_kernel.h");
+    write_jump_table(os, &jump_table[0][0], true);
+    os.close();
+}
+
 // generate header files with precalculated skip-ahead matrices
 void generate_skipahead_file()
 {
@@ -276,6 +360,8 @@ void generate_skipahead_file()
               static_cast<unsigned int*>(&skipahead_matrices_sequence_dev[0][0]),
               true);
     os.close();
+
+    generate_skipahead_jump_table_file();
 }
 
 #endif // GUARD_MIOPEN_XORWOW_SKIPAHEAD_GENERATOR_HPP
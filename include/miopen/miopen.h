@@ -367,6 +367,16 @@ typedef enum {
     miopenDepthwise   = 3, /*!< Deprecated Depthwise convolution legacy, ToBe Removed */
 } miopenConvolutionMode_t;
 
+/*! @ingroup convolutions
+ *  @enum miopenConvDirection_t
+ * Direction of a convolution problem passed to miopenConvolutionPrecompile().
+*/
+typedef enum {
+    miopenConvDirectionForward         = 0, /*!< Forward convolution */
+    miopenConvDirectionBackwardData    = 1, /*!< Backward data convolution */
+    miopenConvDirectionBackwardWeights = 2, /*!< Backward weights convolution */
+} miopenConvDirection_t;
+
 /*! @ingroup padding
  *  @enum miopenPaddingMode_t
  * Padding mode selection for convolution/Pooling layer preference
@@ -1416,6 +1426,66 @@ miopenConvolutionBackwardWeightsImmediate(miopenHandle_t handle,
                                           size_t workSpaceSize,
                                           const uint64_t solution_id);
 
+/*! @brief Compiles ahead of time the kernels for a batch of convolution problems
+ *
+ * Each problem is resolved to the solutions recorded for it in the find-db, configured
+ * from the perf-db. Identical programs are built only once for the whole batch and the builds
+ * run in parallel. The binaries are stored into the user kernel cache, so that subsequent
+ * processes (e.g. started from a container image shipping the cache) do not compile them.
+ * Invokers are registered in the handle, so the first miopenConvolution*Immediate call on
+ * this handle does not compile either.
+ *
+ * Problems without a find-db record are skipped. miopenFindConvolution*Algorithm or
+ * MIOpenDriver may be used to populate the find-db beforehand.
+ *
+ * Problems are described as for the forward convolution: x is the input, w are the weights
+ * and y is the output, regardless of the direction.
+ *
+ * @param handle         MIOpen handle (input)
+ * @param problemCount   Number of problems in the arrays below (input)
+ * @param xDescs         Tensor descriptors for input data tensors x (input)
+ * @param wDescs         Tensor descriptors for weight tensors w (input)
+ * @param convDescs      Convolution layer descriptors (input)
+ * @param yDescs         Tensor descriptors for output data tensors y (input)
+ * @param directions     Directions of the problems (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenConvolutionPrecompile(miopenHandle_t handle,
+                            size_t problemCount,
+                            const miopenTensorDescriptor_t* xDescs,
+                            const miopenTensorDescriptor_t* wDescs,
+                            const miopenConvolutionDescriptor_t* convDescs,
+                            const miopenTensorDescriptor_t* yDescs,
+                            const miopenConvDirection_t* directions);
+
+/*! @brief Reads the find-db and perf-db records of a batch of convolution problems
+ *
+ * The records of all the problems are read in one pass over each database (one transaction for
+ * SQLite) and kept in memory. The following immediate mode calls for these problems, e.g.
+ * miopenConvolutionForwardGetSolution, then do not access the databases again. Nothing is
+ * compiled, see miopenConvolutionPrecompile, which prefetches the records as well.
+ *
+ * The problems are described as for miopenConvolutionPrecompile.
+ *
+ * @param handle         MIOpen handle (input)
+ * @param problemCount   Number of problems in the arrays below (input)
+ * @param xDescs         Tensor descriptors for input data tensors x (input)
+ * @param wDescs         Tensor descriptors for weight tensors w (input)
+ * @param convDescs      Convolution layer descriptors (input)
+ * @param yDescs         Tensor descriptors for output data tensors y (input)
+ * @param directions     Directions of the problems (input)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenConvolutionPrefetchDbRecords(miopenHandle_t handle,
+                                   size_t problemCount,
+                                   const miopenTensorDescriptor_t* xDescs,
+                                   const miopenTensorDescriptor_t* wDescs,
+                                   const miopenConvolutionDescriptor_t* convDescs,
+                                   const miopenTensorDescriptor_t* yDescs,
+                                   const miopenConvDirection_t* directions);
+
 /*! @brief Query the workspace size required for a forward convolution layer
  *
  * This call is required and must be executed once before running
@@ -0,0 +1,480 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+// Host-side costs of the library which do not need a GPU. Every benchmark prints one JSON object
+// per line, so the results of two library versions can be compared by a script.
+// Only compare results of the same build type: Debug builds also log at the Info level.
+#include <miopen/config.h>
+#include <miopen/convolution.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/db.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/invoker_cache.hpp>
+#include <miopen/kernel_cache.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/md_graph.hpp>
+#include <miopen/mdg_expr.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/problem_description.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tmp_dir.hpp>
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+namespace host_overhead {
+
+struct Options
+{
+    std::string filter;
+    std::size_t samples     = 15;
+    std::size_t min_time_us = 20000;
+    std::size_t records     = 4096;
+};
+
+volatile std::size_t sink = 0;
+
+template <class T>
+void Consume(const T& value)
+{
+    sink = sink + static_cast<std::size_t>(static_cast<bool>(value));
+}
+
+void Consume(const std::string& value) { sink = sink + value.size(); }
+
+bool Selected(const Options& options, const std::string& name)
+{
+    return name.find(options.filter) != std::string::npos;
+}
+
+// Calibrates the iteration count to the minimal sample time once, then reports the median and the
+// spread of the per-iteration time over all samples. The median is what is meant to be compared.
+template <class F>
+void Run(const Options& options, const std::string& name, F f)
+{
+    if(!Selected(options, name))
+        return;
+
+    using Clock   = std::chrono::steady_clock;
+    const auto ns = [](Clock::duration d) {
+        return std::chrono::duration<double, std::nano>(d).count();
+    };
+    const auto sample = [&](std::size_t iterations) {
+        const auto start = Clock::now();
+        for(std::size_t i = 0; i < iterations; ++i)
+            f(i);
+        return Clock::now() - start;
+    };
+
+    std::size_t iterations = 1;
+    while(ns(sample(iterations)) < options.min_time_us * 1000.0 && iterations < (1u << 30))
+        iterations *= 2;
+
+    auto times = std::vector<double>{};
+    for(std::size_t i = 0; i < options.samples; ++i)
+        times.push_back(ns(sample(iterations)) / iterations);
+    std::sort(times.begin(), times.end());
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "{\"benchmark\":\"" << name << "\",\"iterations\":" << iterations
+              << ",\"samples\":" << times.size() << ",\"median_ns\":" << times[times.size() / 2]
+              << ",\"min_ns\":" << times.front() << ",\"max_ns\":" << times.back() << "}"
+              << std::endl;
+}
+
+// Shaped like the performance configs of the direct and the 1x1 assembly solvers.
+struct PerfValues
+{
+    int tile_h    = 0;
+    int tile_w    = 0;
+    int waves     = 0;
+    int unroll    = 0;
+    int lds_split = 0;
+    int k_mult    = 0;
+    int c_mult    = 0;
+    int read_size = 0;
+
+    void Serialize(std::ostream& s) const
+    {
+        s << tile_h << ',' << tile_w << ',' << waves << ',' << unroll << ',' << lds_split << ','
+          << k_mult << ',' << c_mult << ',' << read_size;
+    }
+
+    bool Deserialize(const std::string& s)
+    {
+        auto ss  = std::istringstream{s};
+        auto sep = ',';
+        return static_cast<bool>(ss >> tile_h >> sep >> tile_w >> sep >> waves >> sep >> unroll >>
+                                 sep >> lds_split >> sep >> k_mult >> sep >> c_mult >> sep >>
+                                 read_size);
+    }
+};
+
+PerfValues MakeValues(std::size_t i, std::size_t solver)
+{
+    const auto n = static_cast<int>(i);
+    const auto s = static_cast<int>(solver);
+    return {16 << (n % 3), 16 << (s % 3), 1 + n % 4, 1 << (n % 4), s % 2, 8 + n % 16, 2, 4};
+}
+
+// Distinct, plausibly shaped db keys.
+ProblemDescription MakeProblem(std::size_t i)
+{
+    auto problem              = ProblemDescription{conv::Direction::Forward};
+    problem.n_inputs          = 16 * static_cast<int>(1 + i % 64);
+    problem.in_height         = 7 * static_cast<int>(1 + (i / 64) % 32);
+    problem.in_width          = problem.in_height;
+    problem.kernel_size_h     = (i / 2048) % 2 == 0 ? 3 : 1;
+    problem.kernel_size_w     = problem.kernel_size_h;
+    problem.n_outputs         = 32 * static_cast<int>(1 + (i / 4096) % 16);
+    problem.out_height        = problem.in_height;
+    problem.out_width         = problem.in_width;
+    problem.batch_sz          = 1 + static_cast<int>(i / 65536);
+    problem.pad_h             = problem.kernel_size_h / 2;
+    problem.pad_w             = problem.kernel_size_w / 2;
+    problem.kernel_stride_h   = 1;
+    problem.kernel_stride_w   = 1;
+    problem.kernel_dilation_h = 1;
+    problem.kernel_dilation_w = 1;
+    problem.in_layout         = "NCHW";
+    problem.group_counts      = 1;
+    return problem;
+}
+
+std::string Key(const ProblemDescription& problem)
+{
+    auto ss = std::ostringstream{};
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+const std::vector<std::string>& SolverIds()
+{
+    static const std::vector<std::string> ids = {
+        "ConvOclDirectFwd", "ConvBinWinogradRxSf2x3", "ConvAsmImplicitGemmV4R1DynamicFwd"};
+    return ids;
+}
+
+// Contents of the perf db record of the I-th problem, without the key.
+std::string RecordContents(std::size_t i)
+{
+    auto ss = std::ostringstream{};
+    for(std::size_t s = 0; s < SolverIds().size(); ++s)
+    {
+        ss << (s == 0 ? "" : ";") << SolverIds()[s] << ':';
+        MakeValues(i, s).Serialize(ss);
+    }
+    return ss.str();
+}
+
+void WriteTextDb(const std::string& path, const std::vector<ProblemDescription>& problems)
+{
+    auto file = std::ofstream{path};
+    for(std::size_t i = 0; i < problems.size(); ++i)
+        file << Key(problems[i]) << '=' << RecordContents(i) << '\n';
+}
+
+void RunDbBenchmarks(const Options& options)
+{
+    const TmpDir dir{"host_overhead"};
+    const auto text_db  = (dir.path / "host_overhead.updb.txt").string();
+    const auto size_tag = "/" + std::to_string(options.records);
+
+    auto problems = std::vector<ProblemDescription>{};
+    auto contents = std::vector<std::string>{};
+    for(std::size_t i = 0; i < options.records; ++i)
+    {
+        problems.push_back(MakeProblem(i));
+        contents.push_back(RecordContents(i));
+    }
+    WriteTextDb(text_db, problems);
+
+    // Lookups stride through the db so that consecutive ones do not hit the same record.
+    const auto index = [&](std::size_t i) { return (i * 7919) % problems.size(); };
+    const auto nth   = [&](std::size_t i) -> ProblemDescription& { return problems[index(i)]; };
+
+    Run(options, "db_key_serialize", [&](std::size_t i) { Consume(Key(nth(i))); });
+
+    // Update of a perf db record after tuning: the record is read and parsed from its db line,
+    // the values of one solver are replaced and the line is written back. The db is small, so
+    // that the parsing and writing of the record outweigh the scan of the file.
+    const auto update_db   = (dir.path / "host_overhead.update.txt").string();
+    const auto update_size = std::min<std::size_t>(problems.size(), 16);
+    WriteTextDb(update_db, {problems.begin(), problems.begin() + update_size});
+    auto update_plain_db = PlainTextDb{update_db};
+    Run(options, "db_record_parse_update_write", [&](std::size_t i) {
+        auto record = update_plain_db.FindRecord(problems[i % update_size]);
+        const auto& id = SolverIds()[i % SolverIds().size()];
+        auto values    = PerfValues{};
+        record->GetValues(id, values);
+        ++values.waves;
+        record->SetValues(id, values);
+        Consume(update_plain_db.StoreRecord(*record));
+    });
+
+    const auto& ram_db = ReadonlyRamDb::GetCached(text_db, true);
+    Run(options, "readonly_ram_db_find" + size_tag, [&](std::size_t i) {
+        Consume(ram_db.FindRecord(nth(i)));
+    });
+
+    auto plain_db = PlainTextDb{text_db};
+    Run(options, "plain_text_db_find" + size_tag, [&](std::size_t i) {
+        Consume(plain_db.FindRecord(nth(i)));
+    });
+
+#if MIOPEN_ENABLE_SQLITE
+    if(!Selected(options, "sqlite_perf_db_find" + size_tag))
+        return;
+
+    auto sql_db = SQLitePerfDb{(dir.path / "host_overhead.udb").string(), false, "gfx906", 64};
+    {
+        auto batch = sql_db.StartWriteBatch();
+        for(std::size_t i = 0; i < problems.size(); ++i)
+            for(std::size_t s = 0; s < SolverIds().size(); ++s)
+                sql_db.Update(problems[i], SolverIds()[s], MakeValues(i, s));
+        batch.Commit();
+    }
+    Run(options, "sqlite_perf_db_find" + size_tag, [&](std::size_t i) {
+        Consume(sql_db.FindRecord(nth(i)));
+    });
+#endif
+}
+
+void RunConfigBenchmarks(const Options& options)
+{
+    const auto in      = TensorDescriptor{miopenFloat, {64, 256, 56, 56}};
+    const auto weights = TensorDescriptor{miopenFloat, {64, 256, 3, 3}};
+    const auto conv    = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+    const auto out     = conv.GetForwardOutputTensor(in, weights);
+    const auto problem = conv::ProblemDescription{in, weights, out, conv, conv::Direction::Forward};
+
+    Run(options, "network_config_conv_fwd", [&](std::size_t) {
+        Consume(problem.BuildConfKey().ToString());
+    });
+
+    const auto kernel_key = "MIOpenConvFwd_LxG_P53.cl -DMLO_HW_WAVE_SZ=64 -DMLO_DIR_FORWARD=1 "
+                            "-DMLO_FILTER_SIZE0=3 -DMLO_FILTER_SIZE1=3 -DMLO_FILTER_PAD0=1 "
+                            "-DMLO_FILTER_PAD1=1 -DMLO_N_OUTPUTS=64 -DMLO_N_INPUTS=256 "
+                            "-DMLO_BATCH_SZ=64 -DMLO_OUT_WIDTH=56 -DMLO_OUT_HEIGHT=56 "
+                            "-DMLO_IN_WIDTH=56 -DMLO_IN_HEIGHT=56 -DMLO_GRP_TILE0=16 "
+                            "-DMLO_GRP_TILE1=16 -DMLO_OUT_TILE0=2 -DMLO_OUT_TILE1=2 "
+                            "-mcpu=gfx906 -std=cl2.0" +
+                            std::string{};
+    Run(options, "md5_kernel_key", [&](std::size_t) { Consume(md5(kernel_key)); });
+}
+
+void RunCacheBenchmarks(const Options& options)
+{
+    auto configs = std::vector<std::string>{};
+    for(std::size_t i = 0; i < options.records; ++i)
+        configs.push_back(Key(MakeProblem(i)));
+    const auto size_tag = "/" + std::to_string(options.records);
+
+    if(Selected(options, "invoker_cache_lookup" + size_tag))
+    {
+        InvokerCache invokers;
+        for(const auto& config : configs)
+            for(const auto& solver : SolverIds())
+                invokers.Register({config, solver}, [](const Handle&, const AnyInvokeParams&) {});
+        Run(options, "invoker_cache_lookup" + size_tag, [&](std::size_t i) {
+            const auto& solver = SolverIds()[i % SolverIds().size()];
+            const auto key     = InvokerCache::Key{configs[(i * 7919) % configs.size()], solver};
+            Consume(invokers[key]);
+        });
+    }
+
+    if(Selected(options, "kernel_cache_lookup" + size_tag))
+    {
+        KernelCache kernels;
+        for(const auto& config : configs)
+            kernels.AddKernel({"miopenConvolutionFwdAlgoDirect", config}, Kernel{}, 0);
+        Run(options, "kernel_cache_lookup" + size_tag, [&](std::size_t i) {
+            const auto& config = configs[(i * 7919) % configs.size()];
+            if(kernels.HasKernels("miopenConvolutionFwdAlgoDirect", config))
+                Consume(kernels.GetKernels("miopenConvolutionFwdAlgoDirect", config).size());
+        });
+    }
+}
+
+// Attributes which a fusion plan of the given convolution provides to the graph constraints.
+std::unordered_map<std::string, int> FusionAttributes(const ProblemDescription& problem)
+{
+    return {{"c", problem.n_inputs},
+            {"k", problem.n_outputs},
+            {"x", problem.kernel_size_w},
+            {"y", problem.kernel_size_h},
+            {"iN", problem.batch_sz},
+            {"iH", problem.in_height},
+            {"iW", problem.in_width},
+            {"oH", problem.out_height},
+            {"oW", problem.out_width},
+            {"pad_h", problem.pad_h},
+            {"pad_w", problem.pad_w},
+            {"stride_h", problem.kernel_stride_h},
+            {"stride_w", problem.kernel_stride_w},
+            {"dilation_h", problem.kernel_dilation_h},
+            {"dilation_w", problem.kernel_dilation_w},
+            {"group_count", problem.group_counts},
+            {"precision", miopenFloat},
+            {"activ_mode", miopenActivationRELU},
+            {"bn_mode", miopenBNSpatial},
+            {"miopenFloat", miopenFloat},
+            {"miopenActivationRELU", miopenActivationRELU},
+            {"miopenActivationLEAKYRELU", miopenActivationLEAKYRELU},
+            {"miopenBNPerActivation", miopenBNPerActivation},
+            {"miopenBNSpatial", miopenBNSpatial},
+            {"miopenConvolutionFwdAlgoDirect", miopenConvolutionFwdAlgoDirect},
+            {"miopenConvolutionFwdAlgoWinograd", miopenConvolutionFwdAlgoWinograd}};
+}
+
+// How the constraints of an edge were evaluated before they were compiled, as the baseline.
+bool InterpretConstraints(const FusionMDGraph_Edge_Map& edge,
+                          const std::function<bool(const std::string&, int&)>& attr_fun)
+{
+    for(const auto& kv : edge)
+    {
+        tree_visit v(attr_fun);
+        for(const auto& expr : kv.second)
+        {
+            auto first = expr.begin();
+            MDGExprParser parser;
+            boost::spirit::utree tree;
+            if(!boost::spirit::qi::phrase_parse(
+                   first, expr.end(), parser, boost::spirit::ascii::space, tree))
+                return false;
+            const auto r = boost::spirit::utree::visit(tree, v);
+            v.tabl.insert(r.tabl.begin(), r.tabl.end());
+            if(!r.b_res)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Matches every edge of the convolution fusion graph against a corpus of convolutions, which is
+// the work of the graph when plans are validated.
+void RunFusionBenchmarks(const Options& options)
+{
+    FusionMDGraph graph;
+    FusionMDGraph::Init(graph, miopenFusionOpConvForward);
+    auto edges = std::vector<const FusionMDGraph_Edge_Map*>{};
+    for(const auto& src : graph.edge_list)
+        for(const auto& dst : src.second)
+            for(const auto& edge : dst.second)
+                edges.push_back(&edge);
+
+    auto attrs = std::vector<std::function<bool(const std::string&, int&)>>{};
+    for(std::size_t i = 0; i < options.records; i += 61)
+    {
+        attrs.push_back([values = FusionAttributes(MakeProblem(i))](const std::string& sym,
+                                                                     int& val) {
+            const auto it = values.find(sym);
+            if(it == values.end())
+                return false;
+            val = it->second;
+            return true;
+        });
+    }
+    const auto tag = "/" + std::to_string(edges.size()) + "edges";
+
+    Run(options, "fusion_graph_constraints_interpreted" + tag, [&](std::size_t i) {
+        const auto& attr_fun = attrs[i % attrs.size()];
+        for(const auto* edge : edges)
+            Consume(InterpretConstraints(*edge, attr_fun));
+    });
+
+    Run(options, "fusion_graph_constraints_compiled" + tag, [&](std::size_t i) {
+        const auto& attr_fun = attrs[i % attrs.size()];
+        for(const auto* edge : edges)
+        {
+            auto syms = std::unordered_map<std::string, int>{};
+            Consume(graph.CmpOpKey(*edge, attr_fun, syms));
+        }
+    });
+}
+
+void RunParForBenchmarks(const Options& options)
+{
+    const auto threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto tag     = "/" + std::to_string(threads) + "threads";
+    auto work          = std::vector<std::size_t>(threads * 8);
+
+    Run(options, "par_for_dispatch" + tag, [&](std::size_t) {
+        par_for(work.size(), [&](std::size_t j) { work[j] += j; });
+        Consume(work.front());
+    });
+}
+
+} // namespace host_overhead
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    using namespace miopen::host_overhead;
+    auto options = Options{};
+
+    for(auto i = 1; i < argc; ++i)
+    {
+        const auto arg       = std::string{argv[i]};
+        const auto has_value = i + 1 < argc;
+        if(arg == "--filter" && has_value)
+            options.filter = argv[++i];
+        else if(arg == "--samples" && has_value)
+            options.samples = std::max(std::strtoul(argv[++i], nullptr, 10), 1ul);
+        else if(arg == "--min-time-us" && has_value)
+            options.min_time_us = std::strtoul(argv[++i], nullptr, 10);
+        else if(arg == "--records" && has_value)
+            options.records = std::max(std::strtoul(argv[++i], nullptr, 10), 1ul);
+        else
+        {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--filter <substring>] [--samples <n>] [--min-time-us <n>]"
+                         " [--records <db size>]"
+                      << std::endl;
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    RunConfigBenchmarks(options);
+    RunDbBenchmarks(options);
+    RunCacheBenchmarks(options);
+    RunParForBenchmarks(options);
+    RunFusionBenchmarks(options);
+    return 0;
+}
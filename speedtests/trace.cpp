@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/trace.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+volatile int sink = 0;
+
+template <class F>
+double NsPerIteration(int iterations, F f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for(auto i = 0; i < iterations; i++)
+        f(i);
+    const auto time = std::chrono::duration<double, std::nano>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    return time / iterations;
+}
+
+void Bare(int i) { sink = i; }
+
+void Traced(int i)
+{
+    MIOPEN_TRACE_SPAN("speedtest");
+    sink = i;
+}
+
+} // namespace
+
+// Run as is to measure the disabled cost of a span, with MIOPEN_TRACE=1 to measure the enabled one.
+int main(int argc, const char* argv[])
+{
+    const auto iterations = argc > 1 ? std::atoi(argv[1]) : 16 * 1024 * 1024;
+
+    const auto bare   = NsPerIteration(iterations, Bare);
+    const auto traced = NsPerIteration(iterations, Traced);
+
+    std::cout << "Tracing " << (miopen::trace::IsEnabled() ? "enabled" : "disabled") << ", "
+              << iterations << " iterations" << std::endl;
+    std::cout << "Bare call: " << bare << " ns" << std::endl;
+    std::cout << "Traced call: " << traced << " ns (+" << traced - bare << " ns per span)"
+              << std::endl;
+    return 0;
+}
@@ -35,6 +35,8 @@
 #include <miopen/version.h>
 #include <miopen/sqlite_db.hpp>
 #include <miopen/kern_db.hpp>
+#include <miopen/kernel_build_params.hpp>
+#include <miopen/shared_kernel_cache.hpp>
 #include <miopen/db.hpp>
 #include <miopen/db_path.hpp>
 #include <boost/filesystem.hpp>
@@ -134,10 +136,17 @@ boost::filesystem::path GetCacheFile(const std::string& device,
                                      bool is_kernel_str)
 {
     std::string filename = (is_kernel_str ? miopen::md5(name) : name) + ".o";
-    return GetCachePath(false) / miopen::md5(device + ":" + args) / filename;
+    const auto key       = device + ":" + CanonicalizeBuildOptions(args);
+    return GetCachePath(false) / miopen::md5(key) / filename;
 }
 
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+static std::string
+GetSharedCacheKey(const std::string& device, std::size_t num_cu, const KernelConfig& cfg)
+{
+    return device + "_" + std::to_string(num_cu) + ":" + cfg.kernel_name + ":" + cfg.kernel_args;
+}
+
 std::string LoadBinary(const std::string& device,
                        const size_t num_cu,
                        const std::string& name,
@@ -147,21 +156,30 @@ std::string LoadBinary(const std::string& device,
     if(miopen::IsCacheDisabled())
         return {};
 
-    auto db              = GetDb(device, num_cu);
     std::string filename = (is_kernel_str ? miopen::md5(name) : name) + ".o";
-    KernelConfig cfg{filename, args, ""};
-    MIOPEN_LOG_I2("Loading binary for: " << name << " ;args: " << args);
-    auto record = db.FindRecord(cfg);
-    if(record)
-    {
-        MIOPEN_LOG_I2("Sucessfully loaded binary for: " << name << " ;args: " << args);
-        return record.get();
-    }
-    else
-    {
-        MIOPEN_LOG_I2("Unable to load binary for: " << name << " ;args: " << args);
-        return {};
-    }
+    KernelConfig cfg{filename, CanonicalizeBuildOptions(args), ""};
+    const auto load = [&]() -> std::string {
+        auto db = GetDb(device, num_cu);
+        MIOPEN_LOG_I2("Loading binary for: " << name << " ;args: " << args);
+        auto record = db.FindRecord(cfg);
+        if(record)
+        {
+            MIOPEN_LOG_I2("Sucessfully loaded binary for: " << name << " ;args: " << args);
+            return record.get();
+        }
+        else
+        {
+            MIOPEN_LOG_I2("Unable to load binary for: " << name << " ;args: " << args);
+            return {};
+        }
+    };
+
+    // Binaries which another process has already read from the db are copied from the shared
+    // cache, without decompressing and verifying them again.
+    const auto* const shared = SharedKernelCache::Get();
+    if(shared == nullptr)
+        return load();
+    return shared->LoadOrPopulate(GetSharedCacheKey(device, num_cu, cfg), load);
 }
 
 void SaveBinary(const std::string& hsaco,
@@ -177,9 +195,13 @@ void SaveBinary(const std::string& hsaco,
     auto db = GetDb(device, num_cu);
 
     std::string filename = (is_kernel_str ? miopen::md5(name) : name) + ".o";
-    KernelConfig cfg{filename, args, hsaco};
+    KernelConfig cfg{filename, CanonicalizeBuildOptions(args), hsaco};
     MIOPEN_LOG_I2("Saving binary for: " << name << " ;args: " << args);
     db.StoreRecord(cfg);
+
+    const auto* const shared = SharedKernelCache::Get();
+    if(shared != nullptr)
+        shared->Store(GetSharedCacheKey(device, num_cu, cfg), hsaco);
 }
 #else
 boost::filesystem::path LoadBinary(const std::string& device,
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/compile_queue.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <exception>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_COMPILE_PARALLEL_LEVEL)
+
+std::size_t GetCompileParallelLevel() { return Value(MIOPEN_COMPILE_PARALLEL_LEVEL{}, 20); }
+
+CompileQueue::CompileQueue() : CompileQueue(GetCompileParallelLevel()) {}
+
+CompileQueue::CompileQueue(std::size_t max_threads_)
+    : max_threads(std::max<std::size_t>(1, max_threads_))
+{
+}
+
+CompileQueue::~CompileQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    job_added.notify_all();
+    for(auto& worker : workers)
+        worker.join();
+}
+
+bool CompileQueue::Enqueue(const Key& key, Job job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!pending.insert(key).second)
+            return false;
+        failed.erase(key);
+        jobs.emplace_back(key, std::move(job));
+        // Threads are started lazily, so handles which never compile
+        // anything asynchronously do not pay for them.
+        if(workers.size() < max_threads && workers.size() < pending.size())
+            workers.emplace_back([this]() { Work(); });
+    }
+    MIOPEN_LOG_I2("Queued compilation for " << key.first << ", " << key.second);
+    job_added.notify_one();
+    return true;
+}
+
+bool CompileQueue::IsPending(const Key& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return pending.count(key) > 0;
+}
+
+bool CompileQueue::HasFailed(const Key& key) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return failed.count(key) > 0;
+}
+
+void CompileQueue::Wait(const Key& key)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [&]() { return pending.count(key) == 0; });
+}
+
+void CompileQueue::WaitAll()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [&]() { return pending.empty(); });
+}
+
+void CompileQueue::Work()
+{
+    while(true)
+    {
+        std::pair<Key, Job> item;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            job_added.wait(lock, [&]() { return stopping || !jobs.empty(); });
+            // Pending jobs are completed even on destruction: they may be waited for.
+            if(jobs.empty())
+                return;
+            item = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        auto ok = true;
+        try
+        {
+            item.second();
+            MIOPEN_LOG_I2("Finished compilation for " << item.first.first << ", "
+                                                      << item.first.second);
+        }
+        catch(const std::exception& ex)
+        {
+            ok = false;
+            MIOPEN_LOG_W("Background compilation for " << item.first.first << ", "
+                                                        << item.first.second
+                                                        << " failed: " << ex.what());
+        }
+        catch(...)
+        {
+            ok = false;
+            MIOPEN_LOG_W("Background compilation for " << item.first.first << ", "
+                                                        << item.first.second << " failed.");
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.erase(item.first);
+            if(!ok)
+                failed.insert(item.first);
+        }
+        job_done.notify_all();
+    }
+}
+
+} // namespace miopen
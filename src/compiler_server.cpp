@@ -0,0 +1,297 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/compiler_server.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/make_unique.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <sstream>
+#include <utility>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ; // NOLINT
+#endif // __linux__
+
+/// Set to 0 to run every build job in its own shell spawned from this process.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_COMPILER_SERVER)
+
+namespace miopen {
+
+#ifdef __linux__
+struct CompilerServer::Process
+{
+    pid_t pid = -1;
+    int fd    = -1;
+
+    Process() = default;
+    Process(const Process&) = delete;
+    Process& operator=(const Process&) = delete;
+
+    ~Process()
+    {
+        // The shell exits when its input is closed.
+        if(fd >= 0)
+            close(fd);
+        if(pid > 0)
+        {
+            int status = 0;
+            while(waitpid(pid, &status, 0) < 0 && errno == EINTR)
+            {
+            }
+        }
+    }
+
+    static std::unique_ptr<Process> Start(const std::string& shell)
+    {
+        std::array<int, 2> fds{};
+        if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds.data()) != 0)
+            return nullptr;
+
+        // dup2() onto itself would keep the close-on-exec flag, so the server end shall not
+        // occupy any of the descriptors it is duplicated to.
+        if(fds[1] <= 3)
+        {
+            const auto moved = fcntl(fds[1], F_DUPFD_CLOEXEC, 4);
+            close(fds[1]);
+            if(moved < 0)
+            {
+                close(fds[0]);
+                return nullptr;
+            }
+            fds[1] = moved;
+        }
+
+        // The shell reads jobs from its stdin and reports exit codes of the jobs to fd 3.
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, fds[1], 0);
+        posix_spawn_file_actions_adddup2(&actions, fds[1], 3);
+
+        auto process = make_unique<Process>();
+        char arg0[]  = "sh";
+        char* argv[] = {arg0, nullptr};
+        const auto rc =
+            posix_spawn(&process->pid, shell.c_str(), &actions, nullptr, argv, environ);
+
+        posix_spawn_file_actions_destroy(&actions);
+        close(fds[1]);
+
+        if(rc != 0)
+        {
+            close(fds[0]);
+            process->pid = -1;
+            return nullptr;
+        }
+
+        process->fd = fds[0];
+        return process;
+    }
+
+    bool Run(const std::string& cmd, int& exit_code) const
+    {
+        // The command is quoted for eval, so the shell never waits for a continuation of an
+        // ill-formed command. It runs in a subshell, so neither syntax errors nor 'exit' of the
+        // job can terminate the server. Jobs shall not read the jobs stream, nor hold fd 3.
+        std::ostringstream job;
+        job << "( eval '";
+        for(const auto c : cmd)
+        {
+            if(c == '\'')
+                job << "'\\''";
+            else
+                job << c;
+        }
+        job << "' ) </dev/null 3>&-; echo $? >&3\n";
+
+        std::string reply;
+        if(!Send(job.str()) || !ReceiveLine(reply))
+            return false;
+
+        char* end      = nullptr;
+        const auto ret = std::strtol(reply.c_str(), &end, 10);
+        if(end == reply.c_str())
+            return false;
+
+        exit_code = static_cast<int>(ret);
+        return true;
+    }
+
+    private:
+    bool Send(const std::string& data) const
+    {
+        auto left = data.size();
+        auto ptr  = data.data();
+
+        while(left > 0)
+        {
+            const auto sent = send(fd, ptr, left, MSG_NOSIGNAL);
+            if(sent < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+                return false;
+            }
+            left -= sent;
+            ptr += sent;
+        }
+
+        return true;
+    }
+
+    bool ReceiveLine(std::string& line) const
+    {
+        while(true)
+        {
+            char c           = 0;
+            const auto count = recv(fd, &c, 1, 0);
+
+            if(count < 0 && errno == EINTR)
+                continue;
+            if(count <= 0)
+                return false;
+            if(c == '\n')
+                return true;
+
+            line += c;
+        }
+    }
+};
+#else
+struct CompilerServer::Process
+{
+    static std::unique_ptr<Process> Start(const std::string&) { return nullptr; }
+    bool Run(const std::string&, int&) const { return false; }
+};
+#endif // __linux__
+
+CompilerServer& CompilerServer::Instance()
+{
+    static CompilerServer instance{miopen::IsDisabled(MIOPEN_DEBUG_COMPILER_SERVER{}) ? ""
+                                                                                     : "/bin/sh"};
+    return instance;
+}
+
+CompilerServer::CompilerServer(std::string shell_)
+    : shell(std::move(shell_)), broken(shell.empty())
+{
+#ifdef __linux__
+    owner = getpid();
+#endif
+}
+
+CompilerServer::~CompilerServer() = default;
+
+bool CompilerServer::Run(const std::string& cmd, int& exit_code)
+{
+    auto process = Acquire();
+    if(!process)
+        return false;
+
+    if(!process->Run(cmd, exit_code))
+    {
+        MIOPEN_LOG_W("Compiler server has failed, running the job without it: " << cmd);
+        return false;
+    }
+
+    Release(std::move(process));
+    return true;
+}
+
+bool CompilerServer::IsAvailable() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return !broken;
+}
+
+std::size_t CompilerServer::JobsDone() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs_done;
+}
+
+std::unique_ptr<CompilerServer::Process> CompilerServer::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if(broken)
+            return nullptr;
+
+#ifdef __linux__
+        // Servers of the parent process can not be shared with a forked child.
+        if(owner != getpid())
+        {
+            for(auto& process : idle)
+            {
+                close(process->fd);
+                process->fd  = -1;
+                process->pid = -1;
+            }
+            idle.clear();
+            owner = getpid();
+        }
+#endif
+
+        if(!idle.empty())
+        {
+            auto process = std::move(idle.back());
+            idle.pop_back();
+            return process;
+        }
+    }
+
+    auto process = Process::Start(shell);
+
+    if(!process)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!broken)
+            MIOPEN_LOG_W("Unable to start compiler server " << shell
+                                                            << ", a shell is spawned for each job.");
+        broken = true;
+    }
+
+    return process;
+}
+
+void CompilerServer::Release(std::unique_ptr<Process> process)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    ++jobs_done;
+    idle.push_back(std::move(process));
+}
+
+} // namespace miopen
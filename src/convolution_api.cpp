@@ -27,6 +27,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/problem_description.hpp>
 #include <miopen/tensor_ops.hpp>
 #include <algorithm>
 
@@ -960,6 +961,91 @@ miopenConvolutionBackwardWeightsImmediate(miopenHandle_t handle,
     });
 }
 
+// Problems in the format of miopenConvolutionPrecompile().
+static std::vector<miopen::ProblemDescription>
+MakeConvProblems(size_t problemCount,
+                 const miopenTensorDescriptor_t* xDescs,
+                 const miopenTensorDescriptor_t* wDescs,
+                 const miopenConvolutionDescriptor_t* convDescs,
+                 const miopenTensorDescriptor_t* yDescs,
+                 const miopenConvDirection_t* directions)
+{
+    std::vector<miopen::ProblemDescription> problems;
+    problems.reserve(problemCount);
+
+    for(std::size_t i = 0; i < problemCount; ++i)
+    {
+        const auto& conv = miopen::deref(convDescs[i]);
+        auto dir         = miopen::conv::Direction::Forward;
+        switch(directions[i])
+        {
+        case miopenConvDirectionForward: dir = miopen::conv::Direction::Forward; break;
+        case miopenConvDirectionBackwardData: dir = miopen::conv::Direction::BackwardData; break;
+        case miopenConvDirectionBackwardWeights:
+            dir = miopen::conv::Direction::BackwardWeights;
+            break;
+        default: MIOPEN_THROW(miopenStatusBadParm, "Unknown convolution direction");
+        }
+
+        if(conv.mode == miopenTranspose)
+        {
+            // Transposed convolution swaps the roles of x and y, and of Fwd and BwdData.
+            if(dir == miopen::conv::Direction::Forward)
+                dir = miopen::conv::Direction::BackwardData;
+            else if(dir == miopen::conv::Direction::BackwardData)
+                dir = miopen::conv::Direction::Forward;
+            problems.emplace_back(miopen::deref(yDescs[i]),
+                                  miopen::deref(wDescs[i]),
+                                  miopen::deref(xDescs[i]),
+                                  conv,
+                                  dir);
+        }
+        else
+        {
+            problems.emplace_back(miopen::deref(xDescs[i]),
+                                  miopen::deref(wDescs[i]),
+                                  miopen::deref(yDescs[i]),
+                                  conv,
+                                  dir);
+        }
+    }
+    return problems;
+}
+
+extern "C" miopenStatus_t
+miopenConvolutionPrecompile(miopenHandle_t handle,
+                            size_t problemCount,
+                            const miopenTensorDescriptor_t* xDescs,
+                            const miopenTensorDescriptor_t* wDescs,
+                            const miopenConvolutionDescriptor_t* convDescs,
+                            const miopenTensorDescriptor_t* yDescs,
+                            const miopenConvDirection_t* directions)
+{
+    MIOPEN_LOG_FUNCTION(handle, problemCount, xDescs, wDescs, convDescs, yDescs, directions);
+    return miopen::try_([&] {
+        miopen::PrecompileConvolutions(
+            miopen::deref(handle),
+            MakeConvProblems(problemCount, xDescs, wDescs, convDescs, yDescs, directions));
+    });
+}
+
+extern "C" miopenStatus_t
+miopenConvolutionPrefetchDbRecords(miopenHandle_t handle,
+                                   size_t problemCount,
+                                   const miopenTensorDescriptor_t* xDescs,
+                                   const miopenTensorDescriptor_t* wDescs,
+                                   const miopenConvolutionDescriptor_t* convDescs,
+                                   const miopenTensorDescriptor_t* yDescs,
+                                   const miopenConvDirection_t* directions)
+{
+    MIOPEN_LOG_FUNCTION(handle, problemCount, xDescs, wDescs, convDescs, yDescs, directions);
+    return miopen::try_([&] {
+        miopen::PrefetchConvDbRecords(
+            miopen::deref(handle),
+            MakeConvProblems(problemCount, xDescs, wDescs, convDescs, yDescs, directions));
+    });
+}
+
 extern "C" miopenStatus_t
 miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
                                            const miopenTensorDescriptor_t dyDesc,
@@ -28,8 +28,87 @@
 #include <miopen/errors.hpp>
 #include <miopen/env.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace miopen {
 
+CTCLossMetadata GetCTCLossMetadata(const int class_sz,
+                                   const int batch_size,
+                                   const int max_time_step,
+                                   const int* labels,
+                                   const int* labelLengths,
+                                   const int* inputLengths)
+{
+    CTCLossMetadata meta;
+    int offset = 0;
+    for(int i = 0; i < batch_size; i++)
+    {
+        if(inputLengths[i] > max_time_step)
+        {
+            MIOPEN_THROW(miopenStatusBadParm, "Wrong input time step");
+        }
+        if(labelLengths[i] < 0)
+        {
+            MIOPEN_THROW(miopenStatusBadParm, "Wrong label length");
+        }
+        meta.max_label_len = std::max(meta.max_label_len, labelLengths[i]);
+        offset += labelLengths[i];
+    }
+    meta.total_label_len = offset;
+
+    auto& staging = meta.staging;
+    staging.resize(4 * static_cast<std::size_t>(batch_size) + meta.total_label_len);
+    int* const input_lens = staging.data();
+    int* const label_lens = input_lens + batch_size;
+    int* const offsets    = label_lens + batch_size;
+    int* const repeats    = offsets + batch_size;
+    int* const lbs        = repeats + batch_size;
+
+    if(batch_size > 0)
+    {
+        std::memcpy(input_lens, inputLengths, batch_size * sizeof(int));
+        std::memcpy(label_lens, labelLengths, batch_size * sizeof(int));
+    }
+    if(meta.total_label_len > 0)
+        std::memcpy(lbs, labels, meta.total_label_len * sizeof(int));
+
+    // One pass over the labels. The inner loop has no early exit so that it vectorizes, the
+    // errors of a sequence are reported after it. Negative ids wrap around and fail the range
+    // check too.
+    const auto classes = static_cast<unsigned>(class_sz);
+    offset             = 0;
+    for(int i = 0; i < batch_size; i++)
+    {
+        const int* const lb = lbs + offset;
+        const int len       = labelLengths[i];
+        int bad_ids         = 0;
+        int repeat          = 0;
+
+        bad_ids += len > 0 && static_cast<unsigned>(lb[0]) >= classes ? 1 : 0;
+        for(int j = 1; j < len; j++)
+        {
+            bad_ids += static_cast<unsigned>(lb[j]) >= classes ? 1 : 0;
+            repeat += lb[j] == lb[j - 1] ? 1 : 0;
+        }
+
+        if(bad_ids != 0)
+        {
+            MIOPEN_THROW(miopenStatusBadParm, "Wrong label id at batch " + std::to_string(i));
+        }
+        if(len + repeat > inputLengths[i])
+        {
+            MIOPEN_THROW(miopenStatusBadParm, "Error: label length exceeds input time step");
+        }
+
+        offsets[i] = offset;
+        repeats[i] = repeat;
+        offset += len;
+    }
+
+    return meta;
+}
+
 CTCLossDescriptor::CTCLossDescriptor()
 {
     dataType            = miopenFloat;
@@ -56,42 +135,16 @@ size_t CTCLossDescriptor::GetCTCLossWorkspaceSize(Handle& handle,
             "The probability tensor's dimensions do not match the gradient tensor's dimensions");
     }
 
-    int class_sz        = probsDesc.GetLengths()[2];
-    int batch_size      = probsDesc.GetLengths()[1];
-    int max_time_step   = probsDesc.GetLengths()[0];
-    int max_label_len   = 0;
-    int total_label_len = 0;
-    std::vector<int> repeat(batch_size, 0);
-    std::vector<int> labels_offset(batch_size, 0);
+    int class_sz       = probsDesc.GetLengths()[2];
+    int batch_size     = probsDesc.GetLengths()[1];
+    int max_time_step  = probsDesc.GetLengths()[0];
     size_t wksp_sz_lb  = 0;
     size_t wksp_sz_dat = 0;
 
-    for(int i = 0; i < batch_size; i++)
-    {
-        if(inputLengths[i] > max_time_step)
-        {
-            MIOPEN_THROW(miopenStatusBadParm, "Wrong input time step");
-        }
-        max_label_len = std::max(max_label_len, labelLengths[i]);
-        total_label_len += labelLengths[i];
-        labels_offset[i] = i == 0 ? 0 : (labels_offset[i - 1] + labelLengths[i - 1]);
-
-        for(int j = 0; j < labelLengths[i]; j++)
-        {
-            if(labels[labels_offset[i] + j] >= class_sz)
-            {
-                MIOPEN_THROW(miopenStatusBadParm, "Wrong label id at batch");
-            }
-            if(j > 0)
-                if(labels[labels_offset[i] + j] == labels[labels_offset[i] + j - 1])
-                    repeat[i]++;
-        }
-
-        if(labelLengths[i] + repeat[i] > inputLengths[i])
-        {
-            MIOPEN_THROW(miopenStatusBadParm, "Error: label length exceeds input time step");
-        }
-    }
+    const auto meta = GetCTCLossMetadata(
+        class_sz, batch_size, max_time_step, labels, labelLengths, inputLengths);
+    const int max_label_len   = meta.max_label_len;
+    const int total_label_len = meta.total_label_len;
 
     // input length
     wksp_sz_lb += batch_size;
@@ -45,6 +45,7 @@
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace miopen {
@@ -221,6 +222,88 @@ boost::optional<DbRecord> PlainTextDb::FindRecordUnsafe(const std::string& key,
     return boost::none;
 }
 
+std::vector<boost::optional<DbRecord>>
+PlainTextDb::FindRecords(const std::vector<std::string>& keys)
+{
+    auto records = std::vector<boost::optional<DbRecord>>(keys.size());
+
+    if(keys.empty())
+        return records;
+
+    // Several problems may map onto the same key, so every key keeps the list of its indices.
+    auto pending = std::unordered_map<std::string, std::vector<std::size_t>>{};
+    for(auto i = std::size_t{0}; i < keys.size(); ++i)
+        pending[keys[i]].push_back(i);
+
+    const auto lock = shared_lock(lock_file, GetLockTimeout());
+    MIOPEN_VALIDATE_LOCK(lock);
+
+    MIOPEN_LOG_I2("Looking for " << pending.size() << " keys in file " << filename);
+
+    std::ifstream file(filename);
+
+    if(!file)
+    {
+        if(warn_if_unreadable && !MIOPEN_DISABLE_SYSDB)
+            MIOPEN_LOG_W("File is unreadable: " << filename);
+        else
+            MIOPEN_LOG_I2("File is unreadable: " << filename);
+
+        return records;
+    }
+
+    int n_line = 0;
+    std::string line;
+    while(!pending.empty() && std::getline(file, line))
+    {
+        ++n_line;
+
+        const auto key_size = line.find('=');
+        const bool is_key   = (key_size != std::string::npos && key_size != 0);
+        if(!is_key)
+        {
+            if(!line.empty()) // Do not blame empty lines.
+            {
+                MIOPEN_LOG_E("Ill-formed record: key not found: " << filename << "#" << n_line);
+            }
+            continue;
+        }
+        const auto current_key = line.substr(0, key_size);
+        const auto match       = pending.find(current_key);
+
+        if(match == pending.end())
+            continue;
+
+        MIOPEN_LOG_I2("Key match: " << current_key);
+        const auto contents = line.substr(key_size + 1);
+
+        if(contents.empty())
+        {
+            MIOPEN_LOG_E("None contents under the key: " << current_key << " form file " << filename
+                                                         << "#"
+                                                         << n_line);
+            continue;
+        }
+
+        DbRecord record(current_key);
+        if(!record.ParseContents(contents))
+        {
+            MIOPEN_LOG_E("Error parsing payload under the key: " << current_key << " form file "
+                                                                 << filename
+                                                                 << "#"
+                                                                 << n_line);
+            MIOPEN_LOG_E("Contents: " << contents);
+        }
+
+        // Same as FindRecordUnsafe(), the first record with matching key wins.
+        for(const auto idx : match->second)
+            records[idx] = record;
+        pending.erase(match);
+    }
+
+    return records;
+}
+
 static void Copy(std::istream& from, std::ostream& to, std::streamoff count)
 {
     constexpr auto buffer_size_limit = 4 * 1024 * 1024;
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_cache.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#include <iterator>
+#include <sstream>
+
+#include <sys/stat.h>
+
+/// Maximum number of db records kept in memory, 0 disables the cache.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_DB_CACHE_SIZE)
+/// Set to 0 to stop checking whether the db files were modified by other processes.
+/// Records are still invalidated on the writes by this process.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_DB_CACHE_MTIME_CHECK)
+
+namespace miopen {
+
+DbRecordCache& DbRecordCache::Instance()
+{
+    static DbRecordCache instance{miopen::Value(MIOPEN_DEBUG_DB_CACHE_SIZE{}, 4096)};
+    return instance;
+}
+
+DbRecordCache::DbRecordCache(std::size_t capacity_) : capacity(capacity_) {}
+
+bool DbRecordCache::Find(const std::string& db_id,
+                         const std::string& key,
+                         const std::string& stamp,
+                         boost::optional<DbRecord>& record)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(capacity == 0)
+        return false;
+
+    ++stats.lookups;
+    // Not logged at exit: the logger may be destroyed before the process-wide instance.
+    if(stats.lookups % 1024 == 0)
+        LogStatsUnsafe();
+
+    const auto per_key = entries.find(key);
+    if(per_key == entries.end())
+        return false;
+
+    const auto per_db = per_key->second.find(db_id);
+    if(per_db == per_key->second.end())
+        return false;
+
+    const auto entry = per_db->second;
+    if(entry->stamp != stamp)
+    {
+        MIOPEN_LOG_I2("Db has been modified, dropping cached record: " << key);
+        ++stats.stale;
+        EraseUnsafe(entry);
+        return false;
+    }
+
+    ++stats.hits;
+    if(!entry->record)
+        ++stats.negative_hits;
+
+    lru.splice(lru.begin(), lru, entry);
+    record = entry->record;
+    return true;
+}
+
+bool DbRecordCache::Contains(const std::string& db_id,
+                             const std::string& key,
+                             const std::string& stamp) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto per_key = entries.find(key);
+    if(per_key == entries.end())
+        return false;
+
+    const auto per_db = per_key->second.find(db_id);
+    return per_db != per_key->second.end() && per_db->second->stamp == stamp;
+}
+
+void DbRecordCache::Insert(const std::string& db_id,
+                           const std::string& key,
+                           const std::string& stamp,
+                           const boost::optional<DbRecord>& record,
+                           std::size_t generation_)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(capacity == 0)
+        return;
+
+    if(generation_ != generation)
+    {
+        MIOPEN_LOG_I2("Db has been modified during lookup, not caching record: " << key);
+        return;
+    }
+
+    auto& per_db   = entries[key];
+    const auto old = per_db.find(db_id);
+
+    if(old != per_db.end())
+    {
+        old->second->stamp  = stamp;
+        old->second->record = record;
+        lru.splice(lru.begin(), lru, old->second);
+        return;
+    }
+
+    lru.push_front({key, db_id, stamp, record});
+    per_db.emplace(db_id, lru.begin());
+
+    if(lru.size() > capacity)
+    {
+        ++stats.evictions;
+        EraseUnsafe(std::prev(lru.end()));
+    }
+}
+
+void DbRecordCache::Invalidate(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    ++generation;
+
+    const auto per_key = entries.find(key);
+    if(per_key == entries.end())
+        return;
+
+    for(const auto& per_db : per_key->second)
+        lru.erase(per_db.second);
+    entries.erase(per_key);
+}
+
+void DbRecordCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    ++generation;
+    lru.clear();
+    entries.clear();
+    stats = {};
+}
+
+std::size_t DbRecordCache::Generation() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return generation;
+}
+
+std::size_t DbRecordCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return lru.size();
+}
+
+DbRecordCacheStats DbRecordCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void DbRecordCache::EraseUnsafe(Lru::iterator entry)
+{
+    const auto per_key = entries.find(entry->key);
+    per_key->second.erase(entry->db_id);
+    if(per_key->second.empty())
+        entries.erase(per_key);
+    lru.erase(entry);
+}
+
+void DbRecordCache::LogStatsUnsafe() const
+{
+    const auto hit_rate = 100.0 * stats.hits / stats.lookups;
+    MIOPEN_LOG_I2("Db cache: " << stats.lookups << " lookups, " << stats.hits << " hits ("
+                               << hit_rate
+                               << "%), "
+                               << stats.negative_hits
+                               << " negative, "
+                               << stats.stale
+                               << " stale, "
+                               << stats.evictions
+                               << " evicted, "
+                               << lru.size()
+                               << " records cached");
+}
+
+static void AppendFileStamp(std::ostream& stamp, const std::string& path)
+{
+    struct stat st;
+    if(path.empty() || stat(path.c_str(), &st) != 0)
+    {
+        stamp << "-;";
+        return;
+    }
+
+    // Whole seconds miss writes within the same second. The change time also covers a file
+    // replaced by another one with the same modification time and size.
+    stamp << st.st_ino << ':' << st.st_size << ':' << st.st_mtim.tv_sec << '.'
+          << st.st_mtim.tv_nsec << ':' << st.st_ctim.tv_sec << '.' << st.st_ctim.tv_nsec << ';';
+}
+
+std::string GetDbFilesStamp(const std::string& installed_path, const std::string& user_path)
+{
+    if(miopen::IsDisabled(MIOPEN_DEBUG_DB_CACHE_MTIME_CHECK{}))
+        return {};
+
+    std::ostringstream stamp;
+    AppendFileStamp(stamp, installed_path);
+    AppendFileStamp(stamp, user_path);
+    // With the WAL journal, commits of other processes only touch the log until a checkpoint.
+    if(!user_path.empty())
+        AppendFileStamp(stamp, user_path + "-wal");
+    return stamp.str();
+}
+
+} // namespace miopen
@@ -24,9 +24,12 @@
  *
  *******************************************************************************/
 #include <miopen/exec_utils.hpp>
+#include <miopen/compiler_server.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/manage_ptr.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <fstream>
 #include <istream>
 #include <ostream>
 #include <string>
@@ -43,6 +46,41 @@
 namespace miopen {
 namespace exec {
 
+#ifdef __linux__
+/// The compiler server has no access to the pipes of this process,
+/// so redirected streams are passed through a temporary file.
+static bool RunWithServer(const std::string& p, std::istream* in, std::ostream* out, int& rc)
+{
+    auto& server = CompilerServer::Instance();
+
+    if(in == nullptr && out == nullptr)
+        return server.Run(p, rc);
+
+    if(!server.IsAvailable())
+        return false;
+
+    const TmpDir dir{"exec"};
+    const auto io_file = (dir.path / "io").string();
+
+    if(in != nullptr)
+    {
+        std::ofstream file(io_file, std::ios::binary);
+        if(in->peek() != std::char_traits<char>::eof())
+            file << in->rdbuf();
+    }
+
+    // The input has been consumed already, so the fallback uses the file as well.
+    const auto cmd = "( " + p + " ) " + (in != nullptr ? "<" : ">") + " '" + io_file + "'";
+    if(!server.Run(cmd, rc))
+        rc = WEXITSTATUS(std::system(cmd.c_str()));
+
+    if(out != nullptr)
+        *out << std::ifstream(io_file, std::ios::binary).rdbuf();
+
+    return true;
+}
+#endif // __linux__
+
 int Run(const std::string& p, std::istream* in, std::ostream* out)
 {
 #ifdef __linux__
@@ -51,6 +89,10 @@ int Run(const std::string& p, std::istream* in, std::ostream* out)
 
     assert(!(redirect_stdin && redirect_stdout));
 
+    auto rc = 0;
+    if(RunWithServer(p, in, out, rc))
+        return rc;
+
     const auto file_mode = redirect_stdout ? "r" : "w";
     MIOPEN_MANAGE_PTR(FILE*, pclose) pipe{popen(p.c_str(), file_mode)};
 
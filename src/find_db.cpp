@@ -26,6 +26,7 @@
 
 #include <miopen/find_db.hpp>
 
+#include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/finddb_kernel_cache_key.hpp>
 #include <miopen/logger.hpp>
@@ -37,6 +38,7 @@
 namespace miopen {
 
 bool testing_find_db_enabled = true;
+std::size_t testing_find_db_regenerations = 0;
 
 boost::optional<std::string>& testing_find_db_path_override()
 {
@@ -81,7 +83,9 @@ bool CheckInvokerSupport(const std::string& algo)
 }
 
 template <class TDb>
-bool FindDbRecord_t<TDb>::Validate(Handle& handle, const NetworkConfig& config) const
+bool FindDbRecord_t<TDb>::Validate(Handle& handle,
+                                   const NetworkConfig& config,
+                                   const FindDbInvokerRebuilder& rebuilder) const
 {
     auto unbuilt = false;
     auto any     = false;
@@ -92,7 +96,8 @@ bool FindDbRecord_t<TDb>::Validate(Handle& handle, const NetworkConfig& config)
         {
             if(CheckInvokerSupport(pair.first))
             {
-                if(!handle.GetInvoker(config, {{pair.second.solver_id}}))
+                if(!handle.GetInvoker(config, {{pair.second.solver_id}}) &&
+                   !TryRebuildInvoker(pair, rebuilder))
                 {
                     unbuilt = true;
                     // This is not an logged as error because no error was detected.
@@ -110,7 +115,8 @@ bool FindDbRecord_t<TDb>::Validate(Handle& handle, const NetworkConfig& config)
             {
                 const auto is_valid = pair.second.kcache_key.IsValid();
 
-                if(!is_valid || !HasKernel(handle, pair.second.kcache_key))
+                if(!is_valid || (!HasKernel(handle, pair.second.kcache_key) &&
+                                 !TryRebuildInvoker(pair, rebuilder)))
                 {
                     unbuilt = true;
                     LogFindDbItem(pair, !is_valid);
@@ -125,6 +131,34 @@ bool FindDbRecord_t<TDb>::Validate(Handle& handle, const NetworkConfig& config)
     return !any || unbuilt;
 }
 
+template <class TDb>
+bool FindDbRecord_t<TDb>::TryRebuildInvoker(const std::pair<std::string, FindDbData>& pair,
+                                            const FindDbInvokerRebuilder& rebuilder) const
+{
+    if(!rebuilder)
+        return false;
+
+    try
+    {
+        if(rebuilder(pair.second.solver_id))
+        {
+            MIOPEN_LOG_I2("Rebuilt find-db solution <"
+                          << pair.first << "::" << pair.second.solver_id << "> at network config: "
+                          << content->GetKey());
+            return true;
+        }
+        MIOPEN_LOG_I("Find-db solution <" << pair.first << "::" << pair.second.solver_id
+                                          << "> is not applicable anymore at network config: "
+                                          << content->GetKey());
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_W("Unable to rebuild invoker for find-db solution <"
+                     << pair.first << "::" << pair.second.solver_id << ">: " << ex.what());
+    }
+    return false;
+}
+
 template <class TDb>
 void FindDbRecord_t<TDb>::CopyTo(std::vector<PerfField>& to) const
 {
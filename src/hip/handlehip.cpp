@@ -341,8 +341,8 @@ void Handle::ClearKernels(const std::string& algorithm, const std::string& netwo
     this->impl->cache.ClearKernels(algorithm, network_config);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config) const
+std::vector<Kernel> Handle::GetKernelsImpl(const std::string& algorithm,
+                                           const std::string& network_config) const
 {
     return this->impl->cache.GetKernels(algorithm, network_config);
 }
@@ -416,6 +416,8 @@ void Handle::AddProgram(Program prog,
     this->impl->cache.AddProgram(prog, program_name, params);
 }
 
+std::size_t Handle::GetProgramCount() const { return this->impl->cache.GetProgramCount(); }
+
 void Handle::Finish() const
 {
     this->impl->set_ctx();
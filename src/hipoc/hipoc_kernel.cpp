@@ -29,6 +29,7 @@
 #include <miopen/hipoc_kernel.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/device_name.hpp>
+#include <miopen/trace.hpp>
 #include <thread>
 #include <hip/hip_ext.h>
 #include <hip/hip_runtime.h>
@@ -37,6 +38,7 @@ namespace miopen {
 
 void HIPOCKernelInvoke::run(void* args, std::size_t size) const
 {
+    MIOPEN_TRACE_SPAN("KernelLaunch", "kernel");
     HipEventPtr start = nullptr;
     HipEventPtr stop  = nullptr;
     void* config[]    = {
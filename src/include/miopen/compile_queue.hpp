@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GUARD_MIOPEN_COMPILE_QUEUE_HPP_
+#define GUARD_MIOPEN_COMPILE_QUEUE_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+/// Maximum number of kernels built at once, set by MIOPEN_COMPILE_PARALLEL_LEVEL.
+std::size_t GetCompileParallelLevel();
+
+/// Executes compilation jobs in background threads.
+/// Jobs are identified by a key (network_config, solver_id), so the same
+/// job is never queued twice while it is still pending.
+class CompileQueue
+{
+    public:
+    using Key = std::pair<std::string, std::string>;
+    using Job = std::function<void()>;
+
+    /// The number of threads is controlled by MIOPEN_COMPILE_PARALLEL_LEVEL.
+    CompileQueue();
+    CompileQueue(std::size_t max_threads_);
+    CompileQueue(const CompileQueue&) = delete;
+    CompileQueue& operator=(const CompileQueue&) = delete;
+    ~CompileQueue();
+
+    /// Returns false if a job with the same key is already pending.
+    bool Enqueue(const Key& key, Job job);
+    bool IsPending(const Key& key) const;
+    /// Returns true if the last job with this key has thrown.
+    bool HasFailed(const Key& key) const;
+    /// Blocks until the job with the key is finished. Returns immediately if it is not pending.
+    void Wait(const Key& key);
+    /// Blocks until all queued jobs are finished.
+    void WaitAll();
+
+    private:
+    void Work();
+
+    std::size_t max_threads;
+    mutable std::mutex mutex;
+    std::condition_variable job_added;
+    std::condition_variable job_done;
+    std::deque<std::pair<Key, Job>> jobs;
+    std::set<Key> pending;
+    std::set<Key> failed;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_COMPILE_QUEUE_HPP_
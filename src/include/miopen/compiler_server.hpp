@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_COMPILER_SERVER_HPP_
+#define GUARD_MIOPEN_COMPILER_SERVER_HPP_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Runs shell commands (build jobs of the assembler and offline compilers) in long-living shell
+/// processes instead of spawning a new shell from this, usually huge, process for each job.
+/// Jobs are sent over a socket, a process serves one job at a time. Concurrent callers get
+/// their own processes from a pool, which grows on demand.
+///
+/// Servers are started with the environment of this process at the moment of start, so
+/// commands which depend on environment changes made later shall set them explicitly.
+class CompilerServer
+{
+    public:
+    /// The process-wide instance. Disabled by MIOPEN_DEBUG_COMPILER_SERVER=0.
+    static CompilerServer& Instance();
+
+    /// Empty SHELL_ disables the server.
+    explicit CompilerServer(std::string shell_ = "/bin/sh");
+    ~CompilerServer();
+
+    CompilerServer(const CompilerServer&) = delete;
+    CompilerServer& operator=(const CompilerServer&) = delete;
+
+    /// Runs CMD and sets EXIT_CODE to its exit code. Returns false if the command has not been
+    /// run by a server, e.g. no server could be started or it has died; the caller shall fall
+    /// back to running the command by itself then.
+    bool Run(const std::string& cmd, int& exit_code);
+
+    /// Returns false if the server is disabled or could not be started.
+    bool IsAvailable() const;
+
+    /// Number of jobs completed by the servers.
+    std::size_t JobsDone() const;
+
+    private:
+    struct Process;
+
+    const std::string shell;
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Process>> idle;
+    std::size_t jobs_done = 0;
+    bool broken           = false;
+    int owner             = 0;
+
+    std::unique_ptr<Process> Acquire();
+    void Release(std::unique_ptr<Process> process);
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_COMPILER_SERVER_HPP_
@@ -549,6 +549,15 @@ void ConvolutionBackwardBias(const Handle& handle,
                              const TensorDescriptor& dbDesc,
                              Data_t db);
 
+/// Reads find-db and perf-db records of all the problems in one pass per db, so following
+/// single-problem lookups for these problems are served from memory.
+void PrefetchConvDbRecords(Handle& handle, const std::vector<ProblemDescription>& problems);
+
+/// Builds the kernels of the find-db solutions of all the problems in one parallel pass
+/// (identical programs are built once) and registers the invokers in the handle.
+/// Problems without a find-db record are skipped. Returns the number of registered invokers.
+std::size_t PrecompileConvolutions(Handle& handle, const std::vector<ProblemDescription>& problems);
+
 std::ostream& operator<<(std::ostream& stream, const ConvolutionDescriptor& c);
 
 } // namespace miopen
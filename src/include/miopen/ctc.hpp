@@ -37,9 +37,27 @@
 #include <functional>
 #include <numeric>
 #include <map>
+#include <vector>
 
 namespace miopen {
 
+/// Per-call metadata of the CTC loss, packed the way it is laid out at the head of the
+/// workspace: input lengths, label lengths, label offsets and label repeats (batch_size ints
+/// each), followed by the labels. Built and validated in a single pass over the labels.
+struct CTCLossMetadata
+{
+    std::vector<int> staging;
+    int max_label_len   = 0;
+    int total_label_len = 0;
+};
+
+CTCLossMetadata GetCTCLossMetadata(int class_sz,
+                                   int batch_size,
+                                   int max_time_step,
+                                   const int* labels,
+                                   const int* labelLengths,
+                                   const int* inputLengths);
+
 struct CTCLossDescriptor : miopenCTCLossDescriptor
 {
 
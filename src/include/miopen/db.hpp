@@ -28,6 +28,7 @@
 
 #include <miopen/db_record.hpp>
 #include <miopen/rank.hpp>
+#include <miopen/trace.hpp>
 
 #include <boost/core/explicit_operator_bool.hpp>
 #include <boost/none.hpp>
@@ -35,6 +36,7 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 namespace boost {
 namespace filesystem {
@@ -47,6 +49,12 @@ namespace miopen {
 struct RecordPositions;
 class LockFile;
 
+/// Write batch of the dbs which have no transactions, their writes are flushed one by one.
+struct NoWriteBatch
+{
+    bool Commit() { return true; }
+};
+
 /// No instance of this class should be used from several threads at the same time.
 class PlainTextDb
 {
@@ -68,6 +76,20 @@ class PlainTextDb
         return FindRecord(key);
     }
 
+    /// Searches db for all provided keys in a single pass over the file. Result at each index is
+    /// the record found for the key at the same index or none if key not found in database.
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<std::string>& keys);
+
+    template <class T>
+    inline std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<T>& problem_configs)
+    {
+        auto keys = std::vector<std::string>{};
+        keys.reserve(problem_configs.size());
+        for(const auto& problem_config : problem_configs)
+            keys.push_back(DbRecord::Serialize(problem_config));
+        return FindRecords(keys);
+    }
+
     /// Stores provided record in database. If record with same key is already in database it is
     /// replaced by provided record.
     ///
@@ -141,6 +163,9 @@ class PlainTextDb
         return record->GetValues(id, values);
     }
 
+    /// Each write is flushed to the file on its own, see SQLitePerfDb::WriteBatch.
+    NoWriteBatch StartWriteBatch() { return {}; }
+
     private:
     std::string filename;
     LockFile& lock_file;
@@ -222,6 +247,30 @@ class MultiFileDb
 #endif
     }
 
+    /// Batched counterpart of FindRecord(): each of the underlying databases is queried once for
+    /// all of the problems, and results are combined per problem the same way FindRecord does it.
+    template <class TProblem>
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<TProblem>& problems)
+    {
+#if !MIOPEN_DISABLE_USERDB
+        auto users = _user.FindRecords(problems);
+#endif
+        auto installed = _installed.FindRecords(problems);
+
+#if !MIOPEN_DISABLE_USERDB
+        for(auto i = std::size_t{0}; i < installed.size(); ++i)
+        {
+            if(!users[i])
+                continue;
+            if(merge_records && installed[i])
+                users[i]->Merge(installed[i].value());
+            installed[i] = std::move(users[i]);
+        }
+#endif
+
+        return installed;
+    }
+
     template <typename... U>
     auto StoreRecord(const U&... args)
     {
@@ -287,6 +336,16 @@ class MultiFileDb
 #endif
     }
 
+    /// Only the user db is written.
+    auto StartWriteBatch()
+    {
+#if MIOPEN_DISABLE_USERDB
+        return NoWriteBatch{};
+#else
+        return _user.StartWriteBatch();
+#endif
+    }
+
     private:
     template <class TDb, class TRet = decltype(TDb::GetCached("", true, "", 0))>
     static TRet GetDbInstance(rank<1>,
@@ -338,6 +397,21 @@ class DbTimer
         return Measure("FindRecord", [&]() { return inner.FindRecord(args...); });
     }
 
+    template <class TProblem>
+    auto FindRecords(const std::vector<TProblem>& problems)
+    {
+        return Measure("FindRecords", [&]() { return inner.FindRecords(problems); });
+    }
+
+    template <class TProblem>
+    void Prefetch(const std::vector<TProblem>& problems)
+    {
+        Measure("Prefetch", [&]() {
+            inner.Prefetch(problems);
+            return true;
+        });
+    }
+
     template <typename... U>
     auto StoreRecord(U&... record)
     {
@@ -374,12 +448,15 @@ class DbTimer
         return Measure("Remove", [&]() { return inner.Remove(args...); });
     }
 
+    auto StartWriteBatch() { return inner.StartWriteBatch(); }
+
     private:
     TInnerDb inner;
 
     template <class TFunc>
-    static auto Measure(const std::string& funcName, TFunc&& func)
+    static auto Measure(const char* funcName, TFunc&& func)
     {
+        MIOPEN_TRACE_SPAN(funcName, "db");
         if(!miopen::IsLogging(LoggingLevel::Info2))
             return func();
 
@@ -0,0 +1,333 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_CACHE_HPP_
+#define GUARD_MIOPEN_DB_CACHE_HPP_
+
+#include <miopen/db_record.hpp>
+
+#include <boost/none.hpp>
+#include <boost/optional/optional.hpp>
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct DbRecordCacheStats
+{
+    std::size_t lookups       = 0;
+    std::size_t hits          = 0;
+    std::size_t negative_hits = 0;
+    std::size_t stale         = 0;
+    std::size_t evictions     = 0;
+};
+
+/// Process-wide LRU storage of db records, both found ones and misses (as none). Records are
+/// stored per db instance (identified by its paths and device). Each record carries a stamp of
+/// the db files taken before it has been read, the record is dropped when the stamp changes.
+/// Thread-safe.
+class DbRecordCache
+{
+    public:
+    /// Capacity of the process-wide instance is controlled by MIOPEN_DEBUG_DB_CACHE_SIZE,
+    /// 0 disables caching.
+    static DbRecordCache& Instance();
+
+    explicit DbRecordCache(std::size_t capacity_);
+
+    DbRecordCache(const DbRecordCache&) = delete;
+    DbRecordCache& operator=(const DbRecordCache&) = delete;
+
+    /// Returns true if KEY has been cached for DB_ID with the same STAMP, RECORD is set to the
+    /// cached value then.
+    bool Find(const std::string& db_id,
+              const std::string& key,
+              const std::string& stamp,
+              boost::optional<DbRecord>& record);
+
+    /// Same as Find() but neither updates the statistics nor the recency of the record.
+    bool Contains(const std::string& db_id, const std::string& key, const std::string& stamp) const;
+
+    /// Stores RECORD under KEY for DB_ID unless any invalidation has happened after GENERATION
+    /// has been obtained, so data read before a write never overrides the result of that write.
+    void Insert(const std::string& db_id,
+                const std::string& key,
+                const std::string& stamp,
+                const boost::optional<DbRecord>& record,
+                std::size_t generation);
+
+    /// Drops KEY for all of the dbs.
+    void Invalidate(const std::string& key);
+    void Clear();
+
+    bool IsEnabled() const { return capacity != 0; }
+    std::size_t Generation() const;
+    std::size_t Size() const;
+    DbRecordCacheStats GetStats() const;
+
+    private:
+    struct Entry
+    {
+        std::string key;
+        std::string db_id;
+        std::string stamp;
+        boost::optional<DbRecord> record;
+    };
+
+    using Lru          = std::list<Entry>;
+    using EntriesPerDb = std::unordered_map<std::string, Lru::iterator>;
+
+    const std::size_t capacity;
+    mutable std::mutex mutex;
+    std::size_t generation = 0;
+    Lru lru;
+    std::unordered_map<std::string, EntriesPerDb> entries;
+    DbRecordCacheStats stats;
+
+    void EraseUnsafe(Lru::iterator entry);
+    void LogStatsUnsafe() const;
+};
+
+/// Returns a stamp of the db files, which changes when any of them is modified. Empty if
+/// checking of the files is disabled by MIOPEN_DEBUG_DB_CACHE_MTIME_CHECK.
+std::string GetDbFilesStamp(const std::string& installed_path, const std::string& user_path);
+
+/// Serves FindRecord() and Load() from DbRecordCache. Misses of the cache are read from the
+/// inner db and cached. Writes are forwarded to the inner db and invalidate the cached key.
+template <class TInnerDb>
+class DbCache
+{
+    public:
+    DbCache(const std::string& installed_path_,
+            const std::string& user_path_,
+            const std::string& arch  = "",
+            const std::size_t num_cu = 0)
+        : inner(installed_path_, user_path_, arch, num_cu),
+          installed_path(installed_path_),
+          user_path(user_path_),
+          db_id(installed_path + ";" + user_path + ";" + arch + ";" + std::to_string(num_cu))
+    {
+    }
+
+    template <class TProblem>
+    boost::optional<DbRecord> FindRecord(const TProblem& problem)
+    {
+        auto& cache = DbRecordCache::Instance();
+        // Saves stat() calls of the stamp.
+        if(!cache.IsEnabled())
+            return inner.FindRecord(problem);
+
+        const auto key   = KeyOf(problem);
+        const auto stamp = GetDbFilesStamp(installed_path, user_path);
+
+        auto record = boost::optional<DbRecord>{};
+        if(cache.Find(db_id, key, stamp, record))
+            return record;
+
+        const auto generation = cache.Generation();
+        record                = inner.FindRecord(problem);
+        cache.Insert(db_id, key, stamp, record, generation);
+        return record;
+    }
+
+    template <class TProblem>
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<TProblem>& problems)
+    {
+        return inner.FindRecords(problems);
+    }
+
+    /// Same as FindRecord() followed by DbRecord::GetValues(), this matches the behavior of
+    /// MultiFileDb::Load() for the merged dbs.
+    template <class TProblem, class TValue>
+    bool Load(const TProblem& problem, const std::string& id, TValue& values)
+    {
+        const auto record = FindRecord(problem);
+        return record && record->GetValues(id, values);
+    }
+
+    /// Reads records of all PROBLEMS which are not cached yet with a single FindRecords() call
+    /// and puts them to the cache, so following single-problem lookups do not touch the db.
+    template <class TProblem>
+    void Prefetch(const std::vector<TProblem>& problems)
+    {
+        auto& cache = DbRecordCache::Instance();
+        if(!cache.IsEnabled())
+            return;
+
+        const auto stamp      = GetDbFilesStamp(installed_path, user_path);
+        const auto generation = cache.Generation();
+
+        auto keys    = std::vector<std::string>{};
+        auto missing = std::vector<TProblem>{};
+        auto seen    = std::unordered_set<std::string>{};
+
+        for(const auto& problem : problems)
+        {
+            auto key = KeyOf(problem);
+
+            if(cache.Contains(db_id, key, stamp) || !seen.insert(key).second)
+                continue;
+
+            keys.push_back(std::move(key));
+            missing.push_back(problem);
+        }
+
+        if(missing.empty())
+            return;
+
+        const auto records = inner.FindRecords(missing);
+        for(auto i = std::size_t{0}; i < records.size(); ++i)
+            cache.Insert(db_id, keys[i], stamp, records[i], generation);
+    }
+
+    template <typename... U>
+    auto StoreRecord(const U&... args)
+    {
+        const auto ret = inner.StoreRecord(args...);
+        Invalidate(args...);
+        return ret;
+    }
+
+    template <typename... U>
+    auto UpdateRecord(U&... args)
+    {
+        const auto ret = inner.UpdateRecord(args...);
+        Invalidate(args...);
+        return ret;
+    }
+
+    template <typename... U>
+    auto RemoveRecord(const U&... args)
+    {
+        const auto ret = inner.RemoveRecord(args...);
+        Invalidate(args...);
+        return ret;
+    }
+
+    template <typename... U>
+    auto Update(const U&... args)
+    {
+        auto ret = inner.Update(args...);
+        Invalidate(args...);
+        return ret;
+    }
+
+    template <typename... U>
+    auto Remove(const U&... args)
+    {
+        const auto ret = inner.Remove(args...);
+        Invalidate(args...);
+        return ret;
+    }
+
+    /// Batch of the inner db. Records read while it is alive may hold its uncommitted writes, so
+    /// the keys written through this instance are dropped from the cache once more when the
+    /// batch has been committed or rolled back.
+    class WriteBatch
+    {
+        public:
+        explicit WriteBatch(DbCache& db_) : db(&db_)
+        {
+            inner.emplace(db->inner.StartWriteBatch());
+            ++db->batch_depth;
+        }
+        WriteBatch(const WriteBatch&) = delete;
+        WriteBatch& operator=(const WriteBatch&) = delete;
+        WriteBatch(WriteBatch&& other) noexcept : db(other.db), inner(std::move(other.inner))
+        {
+            other.db = nullptr;
+        }
+        WriteBatch& operator=(WriteBatch&&) = delete;
+        ~WriteBatch() { End(); }
+
+        /// Returns false if the batch has been rolled back.
+        bool Commit()
+        {
+            if(db == nullptr)
+                return false;
+            const auto committed = inner->Commit();
+            End();
+            return committed;
+        }
+
+        private:
+        DbCache* db;
+        boost::optional<decltype(std::declval<TInnerDb&>().StartWriteBatch())> inner;
+
+        void End()
+        {
+            if(db == nullptr)
+                return;
+            // Rolls back an uncommitted batch before the keys are dropped.
+            inner = boost::none;
+            if(--db->batch_depth == 0)
+            {
+                for(const auto& key : db->batch_keys)
+                    DbRecordCache::Instance().Invalidate(key);
+                db->batch_keys.clear();
+            }
+            db = nullptr;
+        }
+    };
+
+    WriteBatch StartWriteBatch() { return WriteBatch{*this}; }
+
+    private:
+    TInnerDb inner;
+    std::string installed_path;
+    std::string user_path;
+    std::string db_id;
+    int batch_depth = 0;
+    std::vector<std::string> batch_keys;
+
+    static std::string KeyOf(const DbRecord& record) { return record.GetKey(); }
+    static std::string KeyOf(const std::string& key) { return key; }
+
+    template <class TProblem>
+    static std::string KeyOf(const TProblem& problem)
+    {
+        return DbRecord::Serialize(problem);
+    }
+
+    template <class TFirst, typename... U>
+    void Invalidate(const TFirst& first, const U&...)
+    {
+        auto key = KeyOf(first);
+        DbRecordCache::Instance().Invalidate(key);
+        if(batch_depth > 0)
+            batch_keys.push_back(std::move(key));
+    }
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_CACHE_HPP_
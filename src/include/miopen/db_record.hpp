@@ -242,6 +242,8 @@ class DbRecord
     friend class PlainTextDb;
     friend class SQLitePerfDb;
     friend class ReadonlyRamDb;
+    template <class TInnerDb>
+    friend class DbCache;
 };
 
 } // namespace miopen
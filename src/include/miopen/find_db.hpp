@@ -28,6 +28,7 @@
 #define GUARD_MIOPEN_FIND_DB_HPP_
 
 #include <miopen/db.hpp>
+#include <miopen/db_cache.hpp>
 #include <miopen/db_path.hpp>
 #include <miopen/db_record.hpp>
 #include <miopen/env.hpp>
@@ -36,6 +37,7 @@
 
 #include <boost/optional.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <vector>
 
@@ -57,16 +59,22 @@ using SystemFindDb = PlainTextDb;
 using UserFindDb   = PlainTextDb;
 #endif
 
-using FindDb           = MultiFileDb<SystemFindDb, UserFindDb, false>;
+using FindDb           = DbCache<MultiFileDb<SystemFindDb, UserFindDb, false>>;
 using FindDbRecord     = FindDbRecord_t<FindDb>;
 using UserFindDbRecord = FindDbRecord_t<UserFindDb>;
 
-extern bool testing_find_db_enabled; // For unit tests.
+extern bool testing_find_db_enabled;              // For unit tests.
+extern std::size_t testing_find_db_regenerations; // For unit tests.
 extern boost::optional<std::string>&
 testing_find_db_path_override(); /// \todo Remove when #1723 is resolved.
 
 bool CheckInvokerSupport(const std::string& algo);
 
+/// Builds and registers the invoker of a solution stored in a find-db record, without running it.
+/// Solutions without invokers (FFT, GEMM) get their kernels built instead.
+/// \return false if the solution cannot be used for the problem anymore, i.e. the record is stale.
+using FindDbInvokerRebuilder = std::function<bool(const std::string& solver_id)>;
+
 template <class TDb>
 class FindDbRecord_t
 {
@@ -123,6 +131,25 @@ class FindDbRecord_t
             return;
         if(!db->StoreRecord(content.get()))
             MIOPEN_LOG_E("Failed to store record to find-db at <" << path << ">");
+        // Records written to UserFindDb do not pass through DbCache.
+        DbRecordCache::Instance().Invalidate(content->GetKey());
+    }
+
+    /// Reads find-db records of all the PROBLEMS at once, so following FindDbRecord
+    /// constructions for these problems are served from memory.
+    template <class TProblemDescription, class TTestDb = TDb>
+    static void Prefetch(Handle& handle,
+                         const std::vector<TProblemDescription>& problems,
+                         is_immediate_t<TTestDb> = 0)
+    {
+        if(!testing_find_db_enabled || IsEnabled(MIOPEN_DEBUG_DISABLE_FIND_DB{}))
+            return;
+
+        const auto& path_override = testing_find_db_path_override();
+        const auto user_path      = path_override ? *path_override : GetUserPath(handle);
+        const auto installed_path = path_override ? *path_override : GetInstalledPath(handle);
+
+        DbTimer<TDb>{installed_path, user_path, "", 0}.Prefetch(problems);
     }
 
     auto begin() const { return content->As<FindDbData>().begin(); }
@@ -135,19 +162,33 @@ class FindDbRecord_t
     static std::vector<PerfField> TryLoad(Handle& handle,
                                           const TProblemDescription& problem,
                                           const std::function<void(DbRecord&)>& regenerator)
+    {
+        return TryLoad(handle, problem, {}, regenerator);
+    }
+
+    /// Returns the content of the find-db record of the problem. The solutions of the record which
+    /// are not in the cache of the handle are rebuilt by the rebuilder (from the kernel cache).
+    /// Only when that is not possible, i.e. the record is missing or stale, the regenerator is
+    /// called to run the full Find and to fill the record anew.
+    template <class TProblemDescription>
+    static std::vector<PerfField> TryLoad(Handle& handle,
+                                          const TProblemDescription& problem,
+                                          const FindDbInvokerRebuilder& rebuilder,
+                                          const std::function<void(DbRecord&)>& regenerator)
     {
         auto ret = std::vector<PerfField>{};
         FindDbRecord_t<TDb> record{handle, problem};
 
         const auto network_config = problem.BuildConfKey();
 
-        if(record.in_sync && !record.Validate(handle, network_config))
+        if(record.in_sync && !record.Validate(handle, network_config, rebuilder))
         {
             record.CopyTo(ret);
             return ret;
         }
 
         MIOPEN_LOG_I("Find-db regenerating.");
+        ++testing_find_db_regenerations;
         ret.clear();
         record.in_sync = false;
         record.content.emplace(problem);
@@ -170,7 +211,11 @@ class FindDbRecord_t
     static std::string GetUserPath(Handle& handle);
 
     // Returns true if rebuild is required
-    bool Validate(Handle& handle, const NetworkConfig& config) const;
+    bool Validate(Handle& handle,
+                  const NetworkConfig& config,
+                  const FindDbInvokerRebuilder& rebuilder) const;
+    bool TryRebuildInvoker(const std::pair<std::string, FindDbData>& pair,
+                           const FindDbInvokerRebuilder& rebuilder) const;
     void CopyTo(std::vector<PerfField>& to) const;
 
     void LogFindDbItem(const std::pair<std::string, FindDbData>& pair,
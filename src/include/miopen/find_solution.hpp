@@ -30,14 +30,22 @@
 #include <miopen/env.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/find_controls.hpp>
+#include <miopen/logger.hpp>
 #include <miopen/solver_id.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace miopen {
 
 struct AnyInvokeParams;
+struct ConvolutionContext;
 
 namespace solver {
 
@@ -130,9 +138,95 @@ FindSolution(Solver s, const Context& context, Db& db, const AnyInvokeParams& in
     return solution;
 }
 
+using ApplicabilityCheck = std::function<bool(const ConvolutionContext&)>;
+
+/// IsApplicable() of each check for the problem in ctx, evaluated serially on the first
+/// query of each index. Results are memoized per process by set_id, the problem, the device
+/// and the execution context switches. ctx and checks must outlive the object.
+class Applicability
+{
+    public:
+    Applicability(const std::string& set_id,
+                  const ConvolutionContext& ctx_,
+                  const std::vector<ApplicabilityCheck>& checks_);
+
+    bool operator[](std::size_t i) const;
+
+    private:
+    const ConvolutionContext& ctx;
+    const std::vector<ApplicabilityCheck>& checks;
+    std::shared_ptr<std::vector<signed char>> flags;
+};
+
+/// Forwards the reads to the db and keeps the configs found by the searches, which are stored
+/// together by Flush() with one commit. The write lock of the db is thus taken once per tuning
+/// session instead of once per solver, and is not held while searching.
+template <class Db>
+class DeferredDbUpdates
+{
+    public:
+    explicit DeferredDbUpdates(Db& db_) : db(db_) {}
+
+    template <typename... U>
+    bool Load(U&&... args)
+    {
+        return db.Load(std::forward<U>(args)...);
+    }
+
+    template <typename... U>
+    bool Remove(const U&... args)
+    {
+        return db.Remove(args...);
+    }
+
+    /// The problem shall outlive Flush().
+    template <class TProblem, class TValues>
+    void Update(const TProblem& problem, const std::string& id, const TValues& values)
+    {
+        updates.emplace_back([&problem, id, values](Db& to) { to.Update(problem, id, values); });
+    }
+
+    void Flush()
+    {
+        if(updates.empty())
+            return;
+        auto batch = db.StartWriteBatch();
+        for(const auto& update : updates)
+            update(db);
+        updates.clear();
+        if(!batch.Commit())
+            MIOPEN_LOG_E("Unable to store the tuning results into the perf db");
+    }
+
+    private:
+    Db& db;
+    std::vector<std::function<void(Db&)>> updates;
+};
+
 template <class... Solvers>
 struct SolverContainer
 {
+    template <class Context>
+    static Applicability GetApplicability(const Context& search_params)
+    {
+        static const auto set_id = [] {
+            std::string ids;
+            miopen::each_args([&](auto solver) { ids += SolverDbId(solver) + ';'; },
+                              Solvers{}...);
+            return ids;
+        }();
+        static const auto checks = [] {
+            std::vector<ApplicabilityCheck> ret;
+            miopen::each_args(
+                [&](auto solver) {
+                    ret.emplace_back([=](const Context& ctx) { return solver.IsApplicable(ctx); });
+                },
+                Solvers{}...);
+            return ret;
+        }();
+        return {set_id, search_params, checks};
+    }
+
     // Search for all applicable solutions among many solvers
     template <class Context, class Db, class Solution = miopen::solver::ConvSolution>
     std::vector<Solution>
@@ -142,54 +236,72 @@ struct SolverContainer
                           std::size_t limit = std::numeric_limits<std::size_t>::max()) const
     {
         std::vector<Solution> ss;
-        std::size_t count    = 0;
-        const auto find_only = GetEnvFindOnlySolver();
-        miopen::each_args(
-            [&](auto solver) {
-                if(count >= limit)
-                    return;
-                if(find_only.IsValid() && find_only != Id{SolverDbId(solver)})
-                { // Do nothing (and keep silence for the sake of Tuna), just skip.
-                }
-                else if(!solver.IsApplicable(search_params))
-                    MIOPEN_LOG_I2(SolverDbId(solver) << ": Not applicable");
-                else if(search_params.use_dynamic_solutions_only && !solver.IsDynamic())
-                    MIOPEN_LOG_I2(SolverDbId(solver) << ": Skipped (non-dynamic)");
-                else
-                {
-                    const Solution s = FindSolution(solver, search_params, db, invoke_ctx);
-                    if(s.Succeeded())
-                    {
-                        ++count;
-                        ss.push_back(s);
-                        MIOPEN_LOG_I2(SolverDbId(solver) << ": Success.");
+        std::size_t count     = 0;
+        std::size_t index     = 0;
+        const auto find_only  = GetEnvFindOnlySolver();
+        const auto applicable = GetApplicability(search_params);
+        auto deferred         = DeferredDbUpdates<std::remove_reference_t<Db>>{db};
+        try
+        {
+            miopen::each_args(
+                [&](auto solver) {
+                    const auto i = index++;
+                    if(count >= limit)
+                        return;
+                    if(find_only.IsValid() && find_only != Id{SolverDbId(solver)})
+                    { // Do nothing (and keep silence for the sake of Tuna), just skip.
                     }
+                    else if(!applicable[i])
+                        MIOPEN_LOG_I2(SolverDbId(solver) << ": Not applicable");
+                    else if(search_params.use_dynamic_solutions_only && !solver.IsDynamic())
+                        MIOPEN_LOG_I2(SolverDbId(solver) << ": Skipped (non-dynamic)");
                     else
                     {
-                        /// \todo If Solver is applicable it must provide an appropriate Solution.
-                        /// This is not the case for some 20x5 convolutions (and possibly others).
-                        /// Normally we should not get here and message level should be Error.
-                        /// For now, let's use Info (not Warning) level to avoid
-                        /// flooding the console.
-                        MIOPEN_LOG_I(SolverDbId(solver)
-                                     << ": [Warning] Applicable Solver not succeeded.");
+                        const Solution s =
+                            FindSolution(solver, search_params, deferred, invoke_ctx);
+                        if(s.Succeeded())
+                        {
+                            ++count;
+                            ss.push_back(s);
+                            MIOPEN_LOG_I2(SolverDbId(solver) << ": Success.");
+                        }
+                        else
+                        {
+                            /// \todo If Solver is applicable it must provide an appropriate
+                            /// Solution. This is not the case for some 20x5 convolutions (and
+                            /// possibly others). Normally we should not get here and message level
+                            /// should be Error. For now, let's use Info (not Warning) level to
+                            /// avoid flooding the console.
+                            MIOPEN_LOG_I(SolverDbId(solver)
+                                         << ": [Warning] Applicable Solver not succeeded.");
+                        }
                     }
-                }
-            },
-            Solvers{}...);
+                },
+                Solvers{}...);
+        }
+        catch(...)
+        {
+            // Keeps the results of the searches which have completed.
+            deferred.Flush();
+            throw;
+        }
+        deferred.Flush();
         return ss;
     }
     template <class Context>
     std::vector<std::pair<std::string, size_t>> GetWorkspaceSize(const Context& search_params) const
     {
         std::vector<std::pair<std::string, size_t>> res;
-        const auto find_only = GetEnvFindOnlySolver();
+        std::size_t index     = 0;
+        const auto find_only  = GetEnvFindOnlySolver();
+        const auto applicable = GetApplicability(search_params);
         miopen::each_args(
             [&](auto solver) {
+                const auto i = index++;
                 if(find_only.IsValid() && find_only != Id{SolverDbId(solver)})
                 { // Do nothing (and keep silence for the sake of Tuna), just skip.
                 }
-                else if(!solver.IsApplicable(search_params))
+                else if(!applicable[i])
                     MIOPEN_LOG_I2(SolverDbId(solver) << ": Not applicable");
                 else if(search_params.use_dynamic_solutions_only && !solver.IsDynamic())
                     MIOPEN_LOG_I2(SolverDbId(solver) << ": Skipped (non-dynamic)");
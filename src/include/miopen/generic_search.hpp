@@ -39,17 +39,22 @@
 #include <iterator>
 #include <chrono>
 #include <cassert>
+#include <sstream>
+#include <thread>
 
 #include <miopen/conv/context.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/timer.hpp>
+#include <miopen/tuning_checkpoint.hpp>
 
 namespace miopen {
 namespace solver {
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_COMPILE_AND_RUN)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_TUNING_SHARD_SIZE)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_TUNING_SHARD_TIMEOUT)
 
 /// This STL-like container together with corresponding iterator provide access
 /// to a set of all available performance configs for the given problem config.
@@ -221,6 +226,177 @@ class HeartBeat
     }
 };
 
+/// The part of GenericSearch which decides on the outcomes of the evaluated PerformanceConfigs.
+/// Outcomes saved in the checkpoint by an interrupted search are used instead of running the
+/// configs again, so the result is the same as of a search which has not been interrupted.
+template <typename PerformanceConfig>
+class SearchProgress
+{
+    TuningCheckpoint& checkpoint;
+    size_t n_runs_total;
+    size_t n_current = 0;
+    size_t n_failed  = 0;
+    size_t n_best    = 0;
+    bool is_passed   = false; // left false only if all iterations failed.
+    float best_time  = std::numeric_limits<float>::max();
+    PerformanceConfig best_config;
+    HeartBeat<PerformanceConfig> heartbeat;
+
+    template <class Run>
+    SearchOutcome Measure(Run run) const
+    {
+        auto outcome = SearchOutcome{};
+        try
+        {
+            outcome.time = run(true);
+
+            // Smooth the jitter of measurements:
+            // If the 1st probe is NOT too bad (measured time <= 1.05 * best known time),
+            // then re-run it 4 times more and compute average time,
+            // and decide using average of all 5 attempts vs. the best.
+            if(outcome.time / best_time < 1.05f)
+            {
+                MIOPEN_LOG_I2("Finding average for: " << outcome.time << " / " << best_time
+                                                      << " = "
+                                                      << (outcome.time / best_time));
+                for(int i = 0; i < 4; ++i)
+                    outcome.time += run(false);
+                outcome.time /= 5;
+                outcome.candidate = true;
+            }
+        }
+        catch(...)
+        {
+            outcome.failed    = true;
+            outcome.candidate = false;
+        }
+        return outcome;
+    }
+
+    void Apply(const PerformanceConfig& config, const SearchOutcome& outcome)
+    {
+        MIOPEN_LOG_T("##"
+                     << "(n_current, n_failed, n_runs_total):  "
+                     << n_current
+                     << '/'
+                     << n_failed
+                     << '/'
+                     << n_runs_total
+                     << " elapsed_time: "
+                     << outcome.time
+                     << ", best_time: "
+                     << best_time
+                     << ", "
+                     << config);
+
+        if(outcome.candidate)
+        {
+            is_passed = true;
+            if(outcome.time < best_time)
+            {
+                MIOPEN_LOG_I('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
+                                 << outcome.time
+                                 << " < "
+                                 << best_time
+                                 << ' '
+                                 << config);
+                best_config = config;
+                best_time   = outcome.time;
+                n_best      = n_current;
+            }
+            else
+            {
+                MIOPEN_LOG_I2("Average is not better: " << outcome.time << " >= " << best_time);
+            }
+        }
+
+        if(outcome.failed)
+        {
+            MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
+                             << " Failed");
+            ++n_failed;
+        }
+        heartbeat.Monitor(
+            outcome.failed, outcome.time, n_current, best_time, n_failed, n_runs_total, config);
+        ++n_current;
+    }
+
+    public:
+    SearchProgress(TuningCheckpoint& checkpoint_, size_t n_runs_total_)
+        : checkpoint(checkpoint_), n_runs_total(n_runs_total_)
+    {
+        heartbeat.Start();
+    }
+
+    /// \p run(first) shall run the config once and return its time, the call with first=true
+    /// may prepare the config before running it. Exceptions mean that the config has failed.
+    template <class Run>
+    void Evaluate(const PerformanceConfig& config, Run run)
+    {
+        MIOPEN_LOG_I2('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
+                          << config);
+
+        std::ostringstream ss;
+        ss << config;
+        auto outcome = SearchOutcome{};
+        if(!checkpoint.Load(n_current, ss.str(), outcome))
+        {
+            outcome = Measure(run);
+            checkpoint.Save(n_current, ss.str(), outcome);
+        }
+        Apply(config, outcome);
+    }
+
+    bool IsPassed() const { return is_passed; }
+    float GetBestTime() const { return best_time; }
+    size_t GetBestIndex() const { return n_best; }
+    size_t GetFailedCount() const { return n_failed; }
+    const PerformanceConfig& GetBestConfig() const { return best_config; }
+};
+
+/// Evaluates all the configs by \p evaluate(progress, config) in order of the \p progress.
+/// If the \p shards are enabled, the configs are measured together with other processes running
+/// the same search first, and the outcomes of all of them are merged into the \p checkpoint of the
+/// \p progress, so that it only replays them. The shards of the processes which make no progress
+/// for MIOPEN_DEBUG_TUNING_SHARD_TIMEOUT seconds are taken over.
+template <class PerformanceConfig, class Context, class Evaluate>
+void SearchAll(const ComputedContainer<PerformanceConfig, Context>& all_configs,
+               TuningShards& shards,
+               TuningCheckpoint& checkpoint,
+               SearchProgress<PerformanceConfig>& progress,
+               Evaluate evaluate)
+{
+    while(shards.IsEnabled() && !shards.IsDone())
+    {
+        if(!shards.Claim())
+        {
+            // The rest is being measured by other processes.
+            const auto timeout = miopen::Value(MIOPEN_DEBUG_TUNING_SHARD_TIMEOUT{}, 600);
+            if(!shards.IsStalled(std::chrono::seconds{timeout}) || !shards.TakeOver())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+        }
+
+        SearchProgress<PerformanceConfig> shard{shards.GetCheckpoint(),
+                                                shards.GetEnd() - shards.GetBegin()};
+        size_t n = 0;
+        for(auto it = all_configs.begin(); it != all_configs.end() && n < shards.GetEnd(); ++it)
+        {
+            if(n++ >= shards.GetBegin())
+                evaluate(shard, *it);
+        }
+        shards.Complete();
+    }
+
+    if(shards.IsEnabled())
+        shards.Merge(checkpoint);
+
+    for(const auto& config : all_configs)
+        evaluate(progress, config);
+}
+
 inline void InitRandomly(std::vector<float>& vec, const double offset, const double factor)
 {
     float* p = vec.data();
@@ -315,7 +491,6 @@ auto GenericSearch(const Solver s, const Context& context, const AnyInvokeParams
         "RunAndMeasure is obsolete. Solvers should implement auto-tune evaluation in invoker");
 
     using PerformanceConfig = decltype(s.GetPerformanceConfig(context));
-    PerformanceConfig best_config;
     const auto default_solution = s.GetSolution(context, s.GetPerformanceConfig(context));
     const auto invoke_ctx       = [invoke_ctx_]() {
         auto copy = invoke_ctx_;
@@ -338,13 +513,19 @@ auto GenericSearch(const Solver s, const Context& context, const AnyInvokeParams
                                << (useSpare ? " (spare)" : "")
                                << "...");
 
-    bool is_passed   = false; // left false only if all iterations failed.
-    float best_time  = std::numeric_limits<float>::max();
-    size_t n_failed  = 0;
-    size_t n_current = 0;
-    size_t n_best    = 0;
-    HeartBeat<PerformanceConfig> heartbeat;
-    heartbeat.Start();
+    std::ostringstream key;
+    key << SolverDbId(s) << ' ' << profile_h.GetDbBasename() << ' ' << context
+        << (useSpare ? " spare" : "");
+    TuningShards shards{key.str(),
+                        static_cast<size_t>(n_runs_total),
+                        miopen::Value(MIOPEN_DEBUG_TUNING_SHARD_SIZE{})};
+    const auto checkpoint_path =
+        shards.IsEnabled() ? std::string{} : TuningCheckpoint::GetDefaultPath(key.str());
+    TuningCheckpoint checkpoint{key.str(), checkpoint_path};
+    if(checkpoint.GetLoadedCount() != 0)
+        MIOPEN_LOG_W(SolverDbId(s) << ": Resuming the search from " << checkpoint.GetLoadedCount()
+                                   << " saved results...");
+    SearchProgress<PerformanceConfig> progress{checkpoint, static_cast<size_t>(n_runs_total)};
 
     const char* const c_and_r = miopen::GetStringEnv(MIOPEN_COMPILE_AND_RUN{});
     std::string compile_and_run;
@@ -353,22 +534,13 @@ auto GenericSearch(const Solver s, const Context& context, const AnyInvokeParams
         compile_and_run = c_and_r;
     }
 
-    for(const auto& current_config : all_configs)
-    {
-        float elapsed_time = 0.0f;
-        int ret            = 0;
-        MIOPEN_LOG_I2('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
-                          << current_config);
-
-        ConvSolution current_solution;
-        Invoker invoker;
-
-        try
+    const auto evaluate = [&](SearchProgress<PerformanceConfig>& current_progress,
+                              const PerformanceConfig& current_config) {
+        if(compile_and_run == "0")
         {
-            current_solution = s.GetSolution(context, current_config, true);
-
-            if(compile_and_run == "0")
+            try
             {
+                const auto current_solution = s.GetSolution(context, current_config, true);
                 std::vector<KernelInfo> kernels;
                 for(auto&& kernel : current_solution.construction_params)
                 {
@@ -378,112 +550,48 @@ auto GenericSearch(const Solver s, const Context& context, const AnyInvokeParams
                 }
 
                 std::vector<Program> programs = PrecompileKernels(profile_h, kernels);
-                continue;
             }
-
-            if(default_solution.workspce_sz != current_solution.workspce_sz)
+            catch(...)
             {
-                ret = -2;
-                MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
-                                 << "Workspace size should not depend on PerformanceConfig: "
-                                 << default_solution.workspce_sz
-                                 << " != "
-                                 << current_solution.workspce_sz);
+                MIOPEN_LOG_E("Failed to precompile " << current_config);
             }
-
-            invoker = profile_h.PrepareInvoker(*current_solution.invoker_factory,
-                                               current_solution.construction_params);
-            invoker(profile_h, invoke_ctx);
-            elapsed_time = profile_h.GetKernelTime();
+            return;
         }
-        catch(...)
-        {
-            ret = 1;
-        }
-
-        MIOPEN_LOG_T("##"
-                     << "(n_current, n_failed, n_runs_total):  "
-                     << n_current
-                     << '/'
-                     << n_failed
-                     << '/'
-                     << n_runs_total
-                     << " elapsed_time: "
-                     << elapsed_time
-                     << ", best_time: "
-                     << best_time
-                     << ", "
-                     << current_config);
 
-        if(ret == 0)
-        {
-            // Smooth the jitter of measurements:
-            // If the 1st probe is NOT too bad (measured time <= 1.05 * best known time),
-            // then re-run it 4 times more and compute average time,
-            // and decide using average of all 5 attempts vs. the best.
-            if(elapsed_time / best_time < 1.05f)
+        Invoker invoker;
+        current_progress.Evaluate(current_config, [&](bool first) {
+            if(first)
             {
-                MIOPEN_LOG_I2("Finding average for: " << elapsed_time << " / " << best_time << " = "
-                                                      << (elapsed_time / best_time));
-
-                try
-                {
-                    for(int i = 0; i < 4; ++i)
-                    {
-                        invoker(profile_h, invoke_ctx);
-                        elapsed_time += profile_h.GetKernelTime();
-                    }
-                }
-                catch(...)
+                const auto current_solution = s.GetSolution(context, current_config, true);
+                if(default_solution.workspce_sz != current_solution.workspce_sz)
                 {
-                    ret = 1;
-                }
-
-                if(ret == 0)
-                {
-                    is_passed = true;
-                    elapsed_time /= 5;
-                    if(elapsed_time < best_time)
-                    {
-                        MIOPEN_LOG_I('#' << n_current << '/' << n_failed << '/' << n_runs_total
-                                         << ' '
-                                         << elapsed_time
-                                         << " < "
-                                         << best_time
-                                         << ' '
-                                         << current_config);
-                        best_config = current_config;
-                        best_time   = elapsed_time;
-                        n_best      = n_current;
-                    }
-                    else
-                    {
-                        MIOPEN_LOG_I2(
-                            "Average is not better: " << elapsed_time << " >= " << best_time);
-                    }
+                    MIOPEN_LOG_E("Workspace size should not depend on PerformanceConfig: "
+                                 << default_solution.workspce_sz
+                                 << " != "
+                                 << current_solution.workspce_sz);
+                    MIOPEN_THROW("Workspace size depends on PerformanceConfig");
                 }
+                invoker = profile_h.PrepareInvoker(*current_solution.invoker_factory,
+                                                   current_solution.construction_params);
             }
-        }
-
-        if(ret != 0)
-        {
-            MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
-                             << " Failed rc="
-                             << ret);
-            ++n_failed;
-        }
-        heartbeat.Monitor(
-            ret != 0, elapsed_time, n_current, best_time, n_failed, n_runs_total, current_config);
-        ++n_current;
-    }
-
-    MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total << ", best #"
-                          << n_best
+            invoker(profile_h, invoke_ctx);
+            return profile_h.GetKernelTime();
+        });
+    };
+
+    SearchAll(all_configs, shards, checkpoint, progress, evaluate);
+    checkpoint.Remove();
+
+    const auto best_time = progress.GetBestTime();
+    MIOPEN_LOG_W("Done: " << n_runs_total << '/' << progress.GetFailedCount() << '/'
+                          << n_runs_total
+                          << ", best #"
+                          << progress.GetBestIndex()
                           << ' '
                           << best_time
                           << ' '
-                          << best_config);
-    if(!is_passed)
+                          << progress.GetBestConfig());
+    if(!progress.IsPassed())
         MIOPEN_THROW("Search failed");
     // Run once with the default config and show score.
 
@@ -494,7 +602,7 @@ auto GenericSearch(const Solver s, const Context& context, const AnyInvokeParams
     const auto score        = (best_time > 0.0f) ? default_time / best_time : 0.0f;
     MIOPEN_LOG_W("...Score: " << score << " (default time " << default_time << ')');
 
-    return best_config;
+    return progress.GetBestConfig();
 }
 
 } // namespace solver
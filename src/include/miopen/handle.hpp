@@ -29,6 +29,7 @@
 #include <miopen/config.h>
 #include <miopen/kernel_info.hpp>
 #include <miopen/common.hpp>
+#include <miopen/compile_queue.hpp>
 #include <miopen/invoker_cache.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/miopen.h>
@@ -37,6 +38,7 @@
 #include <miopen/allocator.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/solver_id.hpp>
+#include <miopen/trace.hpp>
 
 #include <boost/range/adaptor/transformed.hpp>
 
@@ -103,10 +105,13 @@ struct Handle : miopenHandle
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config) const;
 
-    auto GetKernels(const std::string& algorithm, const std::string& network_config) const
+    std::vector<KernelInvoke> GetKernels(const std::string& algorithm,
+                                         const std::string& network_config) const
     {
-        return this->GetKernelsImpl(algorithm, network_config) |
-               boost::adaptors::transformed([this](Kernel k) { return this->Run(k); });
+        std::vector<KernelInvoke> kernels;
+        for(auto&& k : this->GetKernelsImpl(algorithm, network_config))
+            kernels.push_back(this->Run(k));
+        return kernels;
     }
     KernelInvoke GetKernel(const std::string& algorithm, const std::string& network_config) const
     {
@@ -120,8 +125,8 @@ struct Handle : miopenHandle
     }
 
     KernelInvoke Run(Kernel k) const;
-    const std::vector<Kernel>& GetKernelsImpl(const std::string& algorithm,
-                                              const std::string& network_config) const;
+    std::vector<Kernel> GetKernelsImpl(const std::string& algorithm,
+                                       const std::string& network_config) const;
 
     Program LoadProgram(const std::string& program_name,
                         std::string params,
@@ -132,6 +137,9 @@ struct Handle : miopenHandle
 
     void AddProgram(Program prog, const std::string& program_name, const std::string& params) const;
 
+    /// Number of programs built or loaded by this handle so far.
+    std::size_t GetProgramCount() const;
+
     void Finish() const;
     void Flush() const;
 
@@ -222,6 +230,7 @@ struct Handle : miopenHandle
                const boost::optional<solver::Id>& solver,
                const boost::optional<AlgorithmName>& algo = boost::none) const
     {
+        MIOPEN_TRACE_SPAN("GetInvoker", "invoker");
         assert(solver || algo);
         assert(!(solver && algo));
         if(solver)
@@ -235,6 +244,8 @@ struct Handle : miopenHandle
         return invokers.GetFound1_0(config, *algo);
     }
 
+    CompileQueue& GetCompileQueue() const { return *compile_queue; }
+
 #if MIOPEN_USE_ROCBLAS
     const rocblas_handle_ptr& rhandle() const { return rhandle_; }
 
@@ -245,6 +256,8 @@ struct Handle : miopenHandle
     private:
 #endif
     InvokerCache invokers;
+    // Declared last to be destroyed first: queued jobs use the kernel and invoker caches.
+    std::unique_ptr<CompileQueue> compile_queue = std::make_unique<CompileQueue>();
 };
 
 inline std::ostream& operator<<(std::ostream& os, const Handle& handle) { return handle.Print(os); }
@@ -33,6 +33,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -44,6 +45,9 @@ class InvokerCache
     // network_config, solver_id
     using Key = std::pair<std::string, std::string>;
 
+    InvokerCache() = default;
+    InvokerCache(InvokerCache&& other) noexcept;
+
     boost::optional<const Invoker&> operator[](const Key& key) const;
     // For find 1.0
     boost::optional<const Invoker&> GetFound1_0(const std::string& network_config,
@@ -66,6 +70,9 @@ class InvokerCache
 
     // network_config -> Item
     std::map<std::string, Item> invokers;
+    // Invokers may be registered from background compilation threads.
+    // Items are never removed, so returned references stay valid.
+    mutable std::mutex mutex;
 };
 
 } // namespace miopen
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_KERN_DB_BUNDLE_HPP_
+#define GUARD_MIOPEN_KERN_DB_BUNDLE_HPP_
+
+#include <miopen/config.h>
+
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+/// A bundle is a standalone SQLite file used to move kernel binaries between kernel cache
+/// databases (*.ukdb and *.kdb). It records the format version, the MIOpen version and the
+/// target device, and stores each distinct binary once (deduplicated by kernel_hash),
+/// bz2-compressed, regardless of how many (kernel_name, kernel_args) keys refer to it.
+///
+/// All binaries are verified against their md5 hash when read from the source, so corrupted
+/// entries are never propagated.
+
+/// (kernel_name, kernel_args), the key of a kernel cache entry.
+using KernDbKey = std::pair<std::string, std::string>;
+
+struct KernDbBundleStats
+{
+    std::size_t kernels   = 0; ///< Entries written to the destination.
+    std::size_t blobs     = 0; ///< Distinct binaries written to the destination.
+    std::size_t skipped   = 0; ///< Entries filtered out or already present in the destination.
+    std::size_t corrupted = 0; ///< Entries which have failed the integrity check.
+};
+
+/// Returns the keys of all the entries of the kernel cache database.
+std::vector<KernDbKey> ListKernDbKeys(const std::string& kdb_path);
+
+/// Writes the entries of the kernel cache database into a new bundle file.
+/// If keys is not empty, only the listed entries are exported.
+KernDbBundleStats ExportKernDbBundle(const std::string& kdb_path,
+                                     const std::string& bundle_path,
+                                     const std::string& arch,
+                                     std::size_t num_cu,
+                                     const std::vector<KernDbKey>& keys = {});
+
+/// Merges the bundle into the kernel cache database, which is created if it does not exist.
+/// Throws if the bundle format is unknown or the bundle was exported for another device
+/// (unless arch is empty). Existing entries are kept unless overwrite is set.
+KernDbBundleStats ImportKernDbBundle(const std::string& bundle_path,
+                                     const std::string& kdb_path,
+                                     const std::string& arch,
+                                     std::size_t num_cu,
+                                     bool overwrite = false);
+
+} // namespace miopen
+
+#endif // MIOPEN_ENABLE_SQLITE_KERN_CACHE
+#endif // GUARD_MIOPEN_KERN_DB_BUNDLE_HPP_
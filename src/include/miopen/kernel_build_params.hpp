@@ -144,6 +144,12 @@ struct GcnAsm
 };
 } // namespace kbp
 
+// Returns the build options in a form where semantically equal strings compare equal: the
+// whitespace is collapsed, -D and -U of the same name are reduced to the last one and moved
+// to the end in name order. The other options keep their relative order. Used for the keys
+// of the program and binary caches.
+std::string CanonicalizeBuildOptions(const std::string& params);
+
 } // namespace miopen
 
 #endif
@@ -46,6 +46,7 @@
 #include <miopen/kernel.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/miopen.h>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -80,20 +81,25 @@ class KernelCache
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config);
 
-    const std::vector<Kernel>& GetKernels(const std::string& algorithm,
-                                          const std::string& network_config);
+    /// Returns a copy, since the kernels may be added or cleared by other threads.
+    std::vector<Kernel> GetKernels(const std::string& algorithm,
+                                   const std::string& network_config);
 
     bool HasKernels(const std::string& algorithm, const std::string& network_config) const;
 
-    bool HasProgram(const std::string& name, const std::string& params) const;
+    bool HasProgram(const std::string& name, std::string params) const;
 
     void AddProgram(Program prog, const std::string& program_name, std::string params);
 
+    std::size_t GetProgramCount() const;
+
     KernelCache();
 
     private:
     KernelMap kernel_map;
     ProgramMap program_map;
+    // Programs may be built and added from background compilation threads.
+    mutable std::mutex mutex;
 };
 
 } // namespace miopen
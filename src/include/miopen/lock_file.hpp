@@ -94,7 +94,8 @@ class LockFile
     bool try_lock()
     {
         return TryLockOperation("lock", MIOPEN_GET_FN_NAME(), [&]() {
-            return std::try_lock(access_mutex, flock) != 0;
+            // std::try_lock() returns -1 when it has locked all of them.
+            return std::try_lock(access_mutex, flock) == -1;
         });
     }
 
@@ -31,11 +31,13 @@
 #include <vector>
 #include <iostream>
 #include <sstream>
+#include <string>
 #include <type_traits>
 
 #include <miopen/each_args.hpp>
 #include <miopen/object.hpp>
 #include <miopen/config.h>
+#include <miopen/trace.hpp>
 
 // See https://github.com/pfultz2/Cloak/wiki/C-Preprocessor-tricks,-tips,-and-idioms
 #define MIOPEN_PP_CAT(x, y) MIOPEN_PP_PRIMITIVE_CAT(x, y)
@@ -204,12 +206,74 @@ extern bool LoggingQuiet;
 
 const char* LoggingLevelToCString(LoggingLevel level);
 std::string LoggingPrefix();
+std::ostream& LoggingPrefix(std::ostream& os);
+
+namespace logger {
+
+/// Logging controls of the environment, which are read once.
+struct Switches
+{
+    LoggingLevel max_level; // No message above it is ever shown.
+    bool function_calls;
+    bool cmd;
+};
+
+Switches ReadSwitches();
+
+inline const Switches& GetSwitches()
+{
+    static const Switches switches = ReadSwitches();
+    return switches;
+}
+
+/// Formats one log message in a buffer of the calling thread, which is reused by the following
+/// messages, and writes it out in one piece by Write(). Messages may nest, e.g. when something
+/// is logged while an argument of another message is being evaluated.
+///
+/// With MIOPEN_ENABLE_LOGGING_ASYNC, Write() only queues the message for a background thread.
+class Message
+{
+    public:
+    Message();
+    ~Message();
+    Message(const Message&) = delete;
+    Message& operator=(const Message&) = delete;
+
+    std::ostream& Stream() { return *stream; }
+    void Write();
+
+    private:
+    std::ostream* stream;
+};
+
+/// Starts the writer of MIOPEN_ENABLE_LOGGING_ASYNC, if enabled. Exit handlers registered
+/// afterwards run while it still takes messages.
+void StartSink();
+
+/// Writes out a complete message, prefix included, as Message::Write() does. Unlike Message, it
+/// does not use the buffers of the calling thread, so exit handlers may call it.
+void WriteMessage(std::string message);
+
+} // namespace logger
+
+bool IsLoggingDebugQuiet();
 
 /// \return true if level is enabled.
 /// \param level - one of the values defined in LoggingLevel.
 bool IsLogging(LoggingLevel level, bool disableQuieting = false);
-bool IsLoggingCmd();
-bool IsLoggingFunctionCalls();
+
+/// Cheap checks for the disabled logging, which are inlined into every logging site.
+inline bool IsLoggingFast(LoggingLevel level)
+{
+    return static_cast<int>(level) <= static_cast<int>(logger::GetSwitches().max_level);
+}
+
+inline bool IsLoggingCmd() { return logger::GetSwitches().cmd && !IsLoggingDebugQuiet(); }
+
+inline bool IsLoggingFunctionCalls()
+{
+    return logger::GetSwitches().function_calls && !IsLoggingDebugQuiet();
+}
 
 namespace logger {
 
@@ -265,34 +329,25 @@ std::ostream& LogParam(std::ostream& os, std::string name, const std::vector<T>&
     return os;
 }
 
-#define MIOPEN_LOG_FUNCTION_EACH(param)                                         \
-    do                                                                          \
-    {                                                                           \
-        /* Clear temp stringstream & reset its state: */                        \
-        std::ostringstream().swap(miopen_log_func_ss);                          \
-        /* Use stringstram as ostream to engage existing template functions: */ \
-        std::ostream& miopen_log_func_ostream = miopen_log_func_ss;             \
-        miopen_log_func_ostream << miopen::LoggingPrefix();                     \
-        miopen::LogParam(miopen_log_func_ostream, #param, param) << std::endl;  \
-        std::cerr << miopen_log_func_ss.str();                                  \
-    } while(false);
-
-#define MIOPEN_LOG_FUNCTION(...)                                                        \
-    do                                                                                  \
-        if(miopen::IsLoggingFunctionCalls())                                            \
-        {                                                                               \
-            std::ostringstream miopen_log_func_ss;                                      \
-            miopen_log_func_ss << miopen::LoggingPrefix() << __PRETTY_FUNCTION__ << "{" \
-                               << std::endl;                                            \
-            std::cerr << miopen_log_func_ss.str();                                      \
-            MIOPEN_PP_EACH_ARGS(MIOPEN_LOG_FUNCTION_EACH, __VA_ARGS__)                  \
-            std::ostringstream().swap(miopen_log_func_ss);                              \
-            miopen_log_func_ss << miopen::LoggingPrefix() << "}" << std::endl;          \
-            std::cerr << miopen_log_func_ss.str();                                      \
-        }                                                                               \
+#define MIOPEN_LOG_FUNCTION_EACH(param) \
+    miopen::LogParam(miopen::LoggingPrefix(miopen_log_func_os), #param, param) << '\n';
+
+// Also opens a trace span for the rest of the calling scope, see miopen/trace.hpp.
+#define MIOPEN_LOG_FUNCTION(...)                                                         \
+    MIOPEN_TRACE_SPAN(__func__);                                                         \
+    do                                                                                   \
+        if(miopen::IsLoggingFunctionCalls())                                             \
+        {                                                                                \
+            miopen::logger::Message miopen_log_func_msg;                                 \
+            std::ostream& miopen_log_func_os = miopen_log_func_msg.Stream();             \
+            miopen::LoggingPrefix(miopen_log_func_os) << __PRETTY_FUNCTION__ << "{\n";   \
+            MIOPEN_PP_EACH_ARGS(MIOPEN_LOG_FUNCTION_EACH, __VA_ARGS__)                   \
+            miopen::LoggingPrefix(miopen_log_func_os) << "}\n";                          \
+            miopen_log_func_msg.Write();                                                 \
+        }                                                                                \
     while(false)
 #else
-#define MIOPEN_LOG_FUNCTION(...)
+#define MIOPEN_LOG_FUNCTION(...) MIOPEN_TRACE_SPAN(__func__)
 #endif
 
 std::string LoggingParseFunction(const char* func, const char* pretty_func);
@@ -300,16 +355,17 @@ std::string LoggingParseFunction(const char* func, const char* pretty_func);
 #define MIOPEN_GET_FN_NAME() \
     (miopen::LoggingParseFunction(__func__, __PRETTY_FUNCTION__)) /* NOLINT */
 
-#define MIOPEN_LOG_XQ_(level, disableQuieting, fn_name, ...)                                 \
-    do                                                                                       \
-    {                                                                                        \
-        if(miopen::IsLogging(level, disableQuieting))                                        \
-        {                                                                                    \
-            std::ostringstream miopen_log_ss;                                                \
-            miopen_log_ss << miopen::LoggingPrefix() << LoggingLevelToCString(level) << " [" \
-                          << fn_name << "] " << __VA_ARGS__ << std::endl;                    \
-            std::cerr << miopen_log_ss.str();                                                \
-        }                                                                                    \
+#define MIOPEN_LOG_XQ_(level, disableQuieting, fn_name, ...)                                \
+    do                                                                                      \
+    {                                                                                       \
+        if(miopen::IsLoggingFast(level) && miopen::IsLogging(level, disableQuieting))       \
+        {                                                                                   \
+            miopen::logger::Message miopen_log_msg;                                         \
+            miopen::LoggingPrefix(miopen_log_msg.Stream())                                  \
+                << LoggingLevelToCString(level) << " [" << fn_name << "] " << __VA_ARGS__   \
+                << '\n';                                                                    \
+            miopen_log_msg.Write();                                                         \
+        }                                                                                   \
     } while(false)
 
 #define MIOPEN_LOG(level, ...) MIOPEN_LOG_XQ_(level, false, MIOPEN_GET_FN_NAME(), __VA_ARGS__)
@@ -331,15 +387,14 @@ std::string LoggingParseFunction(const char* func, const char* pretty_func);
 // Warnings in installable builds, errors otherwise.
 #define MIOPEN_LOG_WE(...) MIOPEN_LOG(LogWELevel, __VA_ARGS__)
 
-#define MIOPEN_LOG_DRIVER_CMD(...)                                                      \
-    do                                                                                  \
-    {                                                                                   \
-        std::ostringstream miopen_driver_cmd_ss;                                        \
-        miopen_driver_cmd_ss << miopen::LoggingPrefix() << "Command"                    \
-                             << " [" << miopen::LoggingParseFunction(                   \
-                                            __func__, __PRETTY_FUNCTION__) /* NOLINT */ \
-                             << "] ./bin/MIOpenDriver " << __VA_ARGS__ << std::endl;    \
-        std::cerr << miopen_driver_cmd_ss.str();                                        \
+#define MIOPEN_LOG_DRIVER_CMD(...)                                                           \
+    do                                                                                       \
+    {                                                                                        \
+        miopen::logger::Message miopen_driver_cmd_msg;                                       \
+        miopen::LoggingPrefix(miopen_driver_cmd_msg.Stream())                                \
+            << "Command [" << MIOPEN_GET_FN_NAME() << "] ./bin/MIOpenDriver " << __VA_ARGS__ \
+            << '\n';                                                                         \
+        miopen_driver_cmd_msg.Write();                                                       \
     } while(false)
 
 } // namespace miopen
@@ -8,9 +8,12 @@
 #include <miopen/logger.hpp>
 
 #include <cassert>
+#include <functional>
 #include <memory>
 #include <iostream>
+#include <string>
 #include <unordered_map>
+#include <vector>
 // Workaround tidy issues when using BOOST_FOREACH
 #ifdef MIOPEN_USE_CLANG_TIDY
 #define BOOST_FOREACH(x, y) for(x : y) // NOLINT
@@ -264,6 +267,55 @@ struct tree_visit
 
     visit_res operator()(spirit::function_base const&) const { return visit_res(); }
 };
+
+// A constraint expression lowered once from its parse tree into a flat program: nodes are
+// stored children first, so the program is evaluated by a single pass over them. Sub-expressions
+// without variables are folded at compile time. Evaluation gives the same results, errors and
+// variable lookups in the same order as visiting the parse tree with tree_visit.
+class CompiledMDGExpr
+{
+    public:
+    explicit CompiledMDGExpr(const std::string& expr);
+
+    // Compiles each distinct expression once per process.
+    static const CompiledMDGExpr& Get(const std::string& expr);
+
+    visit_res Eval(const std::function<bool(const std::string&, int&)>& var_lookup,
+                   const std::unordered_map<std::string, int>& tabl) const;
+
+    std::size_t Size() const { return nodes.size(); }
+
+    private:
+    enum class NodeKind
+    {
+        Constant,
+        Variable,
+        Binary,
+    };
+
+    struct Node
+    {
+        NodeKind kind   = NodeKind::Constant;
+        MDGraph_op_t op = OpAny;
+        int res         = 0;
+        bool b_res      = false;
+        std::string sym;
+        std::size_t lhs = 0;
+        std::size_t rhs = 0;
+    };
+
+    struct Value
+    {
+        int res                = 0;
+        bool b_res             = false;
+        const std::string* sym = nullptr; // unresolved variable
+    };
+
+    std::vector<Node> nodes;
+
+    friend struct tree_compile;
+    static Value Apply(MDGraph_op_t op, const Value& lhs, const Value& rhs);
+};
 } // namespace miopen
 
 #endif
@@ -68,6 +68,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #else
 #include <miopen/db.hpp>
 #endif
+#include <miopen/db_cache.hpp>
 #include <miopen/conv/context.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/problem_description.hpp>
@@ -141,6 +142,9 @@ class PlainTextDb;
 template <class TInnerDb>
 class DbTimer;
 
+template <class TInnerDb>
+class DbCache;
+
 struct AnyInvokeParams;
 
 template <class TInstance>
@@ -155,9 +159,9 @@ class StaticContainer
 };
 
 #if MIOPEN_ENABLE_SQLITE
-using PerformanceDb = DbTimer<MultiFileDb<SQLitePerfDb, SQLitePerfDb, true>>;
+using PerformanceDb = DbTimer<DbCache<MultiFileDb<SQLitePerfDb, SQLitePerfDb, true>>>;
 #else
-using PerformanceDb = DbTimer<MultiFileDb<PlainTextDb, PlainTextDb, true>>;
+using PerformanceDb = DbTimer<DbCache<MultiFileDb<PlainTextDb, PlainTextDb, true>>>;
 #endif
 miopen::PerformanceDb GetDb(const ConvolutionContext& ctx);
 
@@ -33,6 +33,7 @@
 #include <unordered_map>
 #include <string>
 #include <sstream>
+#include <vector>
 
 namespace miopen {
 
@@ -79,6 +80,16 @@ class ReadonlyRamDb
         return FindRecord(key);
     }
 
+    template <class TProblem>
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<TProblem>& problems) const
+    {
+        auto records = std::vector<boost::optional<DbRecord>>{};
+        records.reserve(problems.size());
+        for(const auto& problem : problems)
+            records.push_back(FindRecord(problem));
+        return records;
+    }
+
     template <class TProblem, class TValue>
     bool Load(const TProblem& problem, const std::string& id, TValue& value) const
     {
@@ -31,6 +31,7 @@
 #include <miopen/dropout.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/float_equal.hpp>
+#include <miopen/gemm_v2.hpp>
 #include <miopen/miopen.h>
 #include <miopen/object.hpp>
 #include <miopen/tensor.hpp>
@@ -38,6 +39,7 @@
 
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <type_traits>
 #include <vector>
 
@@ -64,6 +66,46 @@ struct c_array_view
 
 void profileRNNkernels(const Handle& handle, unsigned char select, float& ctime);
 
+/// Number of GPU launches (GEMMs and other kernels) issued by the last RNN call made from the
+/// calling thread. Counted on the host, so profiling does not need to be enabled.
+std::size_t GetRNNLaunchCount();
+
+/// One direction of one time step of the hidden state recurrence. The rows are counted from the
+/// start of the layer in the workspace (or reserve space), the GEMMs add the hidden state
+/// contribution to the gates of the step.
+struct RNNForwardStep
+{
+    int cur_time  = 0; // time step of this direction
+    int use_time  = 0; // time step whose hidden state is used, 0 at the first step
+    int cur_batch = 0; // first row of cur_time
+    int pre_batch = 0; // first row of the previous step of this direction
+    GemmDescriptor hx_gemm;   // from hx, first step
+    GemmDescriptor tail_gemm; // from hx, rows of the reverse direction without previous step
+    GemmDescriptor h_gemm;    // from the previous step
+};
+
+/// Shapes of a forward call, validated and derived from the descriptors, and the GEMMs and
+/// offsets of the call. They only depend on the RNN descriptor, sequence length, batch sizes of
+/// the sequence and the vector sizes, so the plan is built once and reused by the following
+/// calls with the same shapes.
+struct RNNForwardPlan
+{
+    std::vector<std::size_t> shapes; // sequence length, type and lengths it is built for
+    std::vector<int> in_n; // batch size of each time step
+    int batch_n = 0;       // total batch size of the sequence
+    int in_h    = 0;       // input vector size
+    int hy_d    = 0;       // biNumLayers
+    int hy_n    = 0;       // max batch size
+    int hy_h    = 0;       // hidden size
+    int out_h   = 0;       // output vector size
+    int bi      = 1;
+    std::size_t workspace_size = 0;
+
+    GemmDescriptor input_gemm;         // input to hidden of the first layer
+    GemmDescriptor layer_gemm;         // input to hidden of the following layers
+    std::vector<RNNForwardStep> steps; // [time step * bi + direction]
+};
+
 struct RNNDescriptor : miopenRNNDescriptor
 {
 
@@ -270,6 +312,18 @@ struct RNNDescriptor : miopenRNNDescriptor
 
     inline bool isNotRNNskip() const { return inputMode != miopenRNNskip; }
     inline bool isRNNskip() const { return inputMode == miopenRNNskip; }
+
+    /// Validates the shapes of a forward call and returns the plan of the call.
+    std::shared_ptr<const RNNForwardPlan>
+    GetForwardPlan(Handle& handle,
+                   int seqLen,
+                   c_array_view<const miopenTensorDescriptor_t> xDesc,
+                   c_array_view<const miopenTensorDescriptor_t> yDesc,
+                   const TensorDescriptor& hyDesc) const;
+
+    private:
+    struct ForwardPlanCache;
+    std::shared_ptr<ForwardPlanCache> forwardPlans;
 };
 
 std::ostream& operator<<(std::ostream& stream, const RNNDescriptor& r);
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SHARED_FILE_STORE_HPP_
+#define GUARD_MIOPEN_SHARED_FILE_STORE_HPP_
+
+#include <boost/filesystem/path.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+
+namespace miopen {
+
+/// Directory of files shared by concurrent processes, bounded in size. Files are published by
+/// an atomic rename and the least recently used ones are removed once the directory exceeds
+/// max_size bytes. Used by the SharedKernelCache and the verification cache of the tests.
+class SharedFileStore
+{
+    public:
+    SharedFileStore(boost::filesystem::path root_, std::size_t max_size_);
+
+    /// Writes the file through a temporary one renamed over it, so that readers see either the
+    /// previous file or the complete new one. Returns the size written, 0 on failure.
+    std::size_t Publish(const boost::filesystem::path& file,
+                        const std::function<void(std::ostream&)>& write) const;
+
+    /// Marks the file as recently used for the eviction.
+    static void Touch(const boost::filesystem::path& file);
+
+    /// Adds the bytes written by this process to unchecked_bytes, and checks the size of the
+    /// directory once they exceed a part of the bound. Returns the number of evicted files.
+    std::size_t Account(std::atomic<std::size_t>& unchecked_bytes,
+                        std::size_t written,
+                        const boost::filesystem::path& keep) const;
+
+    /// Removes the least recently used files until a quarter of the space is free again, except
+    /// for keep. Returns the number of removed files.
+    std::size_t Evict(const boost::filesystem::path& keep) const;
+
+    const boost::filesystem::path& Path() const { return root; }
+    std::size_t MaxSize() const { return max_size; }
+
+    private:
+    boost::filesystem::path root;
+    std::size_t max_size;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SHARED_FILE_STORE_HPP_
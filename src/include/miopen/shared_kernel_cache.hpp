@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SHARED_KERNEL_CACHE_HPP_
+#define GUARD_MIOPEN_SHARED_KERNEL_CACHE_HPP_
+
+#include <miopen/shared_file_store.hpp>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/optional/optional.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace miopen {
+
+/// Code objects shared by the processes of a node, so that only the first of several workers
+/// reads a binary from the kernel cache database, decompresses it and verifies its md5. The
+/// others copy the decompressed binary from a directory on a memory backed file system such as
+/// /dev/shm, which MIOPEN_SHARED_KERNEL_CACHE_DIR enables. The programs are built from strings,
+/// so each process still holds its own copy of the binaries it loads.
+///
+/// Entries are files named by the md5 of their key. They are published by an atomic rename,
+/// so readers see either no entry or a complete one, and record the full key against hash
+/// collisions. Once the entries exceed max_size bytes, the least recently used ones are removed.
+class SharedKernelCache
+{
+    public:
+    SharedKernelCache(boost::filesystem::path root_, std::size_t max_size_);
+
+    /// The cache of this process, nullptr when it is disabled. Entries of other MIOpen versions
+    /// are kept apart.
+    static const SharedKernelCache* Get();
+
+    /// The entry is mapped to check its header and key, and the binary is copied out of it.
+    boost::optional<std::string> Load(const std::string& key) const;
+    void Store(const std::string& key, const std::string& binary) const;
+
+    /// Returns the entry of key, otherwise the result of load(), which is stored unless empty.
+    /// Processes which miss the same key at the same time wait for the one calling load().
+    std::string LoadOrPopulate(const std::string& key,
+                               const std::function<std::string()>& load) const;
+
+    const boost::filesystem::path& Path() const;
+
+    private:
+    SharedFileStore files;
+    // Bytes written by this process since the last size check.
+    mutable std::atomic<std::size_t> unchecked_bytes;
+
+    boost::filesystem::path EntryPath(const std::string& key) const;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SHARED_KERNEL_CACHE_HPP_
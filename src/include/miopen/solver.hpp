@@ -1408,6 +1408,22 @@ struct ConvOclDirectFwd1x1 : ConvOclDirectFwdLegacyExhaustiveSearch
     }
 };
 
+/// Problem sizes are kernel arguments, so the kernels are built once per data type
+/// and tile and then serve every shape.
+struct ConvOclDirectFwd1x1Dynamic : SolverBase<ConvolutionContext>
+{
+    bool IsApplicable(const ConvolutionContext& params) const;
+    bool IsDynamic() const { return true; }
+    ConvSolution GetSolution(const ConvolutionContext& params) const;
+};
+
+struct ConvOclDirectFwdDynamic : SolverBase<ConvolutionContext>
+{
+    bool IsApplicable(const ConvolutionContext& params) const;
+    bool IsDynamic() const { return true; }
+    ConvSolution GetSolution(const ConvolutionContext& params) const;
+};
+
 struct ConvBinWinograd3x3U : SolverBase<ConvolutionContext>
 {
     bool IsApplicable(const ConvolutionContext& params) const;
@@ -47,6 +47,7 @@
 #include <string>
 #include <chrono>
 #include <unordered_map>
+#include <vector>
 
 namespace boost {
 namespace filesystem {
@@ -430,6 +431,67 @@ class SQLitePerfDb : public SQLiteBase<SQLitePerfDb>
             return boost::optional<DbRecord>(rec);
     }
 
+    /// Looks up records for all PROBLEM_CONFIGS inside a single read transaction, so the
+    /// database is locked and its schema is validated once instead of once per problem.
+    template <typename T>
+    inline std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<T>& problem_configs)
+    {
+        auto records = std::vector<boost::optional<DbRecord>>(problem_configs.size());
+        if(dbInvalid || problem_configs.empty())
+            return records;
+
+        // Inside a write batch the reads already belong to its transaction.
+        if(batch_depth > 0)
+        {
+            for(auto i = std::size_t{0}; i < problem_configs.size(); ++i)
+                records[i] = FindRecordUnsafe(problem_configs[i]);
+            return records;
+        }
+
+        sql.Exec("BEGIN TRANSACTION;");
+        try
+        {
+            for(auto i = std::size_t{0}; i < problem_configs.size(); ++i)
+                records[i] = FindRecordUnsafe(problem_configs[i]);
+        }
+        catch(...)
+        {
+            sql.Exec("ROLLBACK;");
+            throw;
+        }
+        sql.Exec("COMMIT;");
+        return records;
+    }
+
+    /// Groups the Update, Remove and Store calls made while it is alive into a single
+    /// transaction, so they are written with one commit and one acquisition of the database
+    /// write lock instead of one per call. The lock is taken when the batch starts and other
+    /// writers wait for it up to MIOPEN_SQL_BUSY_TIMEOUT_MS, so keep batches short.
+    ///
+    /// Changes become visible to other connections and durable on Commit(). A batch that is
+    /// destroyed without Commit(), e.g. by an exception, is rolled back, and SQLite rolls back
+    /// the batch of a process that crashes, so a batch is stored completely or not at all.
+    /// Batches nest, only the outermost one commits. A batch and the database instance it
+    /// belongs to should be used from one thread.
+    class WriteBatch
+    {
+        public:
+        explicit WriteBatch(SQLitePerfDb& db_) : db(&db_) { db->BeginBatch(); }
+        WriteBatch(const WriteBatch&) = delete;
+        WriteBatch& operator=(const WriteBatch&) = delete;
+        WriteBatch(WriteBatch&& other) noexcept : db(other.db) { other.db = nullptr; }
+        WriteBatch& operator=(WriteBatch&&) = delete;
+        ~WriteBatch();
+
+        /// Returns false if the batch or an enclosing one has been rolled back.
+        bool Commit();
+
+        private:
+        SQLitePerfDb* db;
+    };
+
+    WriteBatch StartWriteBatch() { return WriteBatch{*this}; }
+
     /// Removes ID with associated VALUES from record with key PROBLEM_CONFIG from db.
     ///
     /// Returns true if remove was successful. Returns false if this PROBLEM_CONFIG or ID was not
@@ -572,6 +634,13 @@ class SQLitePerfDb : public SQLiteBase<SQLitePerfDb>
             return false;
         return record->GetValues(id, values);
     }
+
+    private:
+    void BeginBatch();
+    bool EndBatch(bool commit);
+
+    int batch_depth     = 0;
+    bool batch_rollback = false;
 };
 } // namespace miopen
 #endif
@@ -27,6 +27,7 @@
 #define GUARD_MIOPEN_TIMER_HPP_
 
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 #include <chrono>
 
 namespace miopen {
@@ -54,6 +55,8 @@ class CompileTimer
 #if MIOPEN_BUILD_DEV
     Timer timer;
 #endif
+    trace::Span span{"Compile", "compile"};
+
     public:
     CompileTimer()
     {
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_TRACE_HPP_
+#define GUARD_MIOPEN_TRACE_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace trace {
+
+using Clock = std::chrono::steady_clock;
+
+bool IsEnabledImpl();
+
+/// True if spans are collected, i.e. MIOPEN_TRACE is enabled or MIOPEN_TRACE_FILE is set.
+/// Read once per process.
+inline bool IsEnabled()
+{
+    static const bool enabled = IsEnabledImpl();
+    return enabled;
+}
+
+/// Adds a finished span. NAME and CATEGORY shall outlive the process, e.g. string literals or
+/// __func__, spans are aggregated by their addresses.
+void Record(const char* name, const char* category, Clock::time_point start, Clock::time_point end);
+
+struct SpanStats
+{
+    /// Bucket i counts durations from 2^i to 2^(i+1) ns.
+    static constexpr std::size_t buckets_count = 40;
+
+    std::string name;
+    std::string category;
+    std::size_t count = 0;
+    double total_us   = 0;
+    double min_us     = 0;
+    double max_us     = 0;
+    std::array<std::size_t, buckets_count> buckets{};
+
+    /// Upper bound of the bucket which holds the Q-th (0..1) quantile of durations.
+    double QuantileUs(double q) const;
+};
+
+/// Latency histograms of the spans recorded so far, by name.
+std::vector<SpanStats> GetStats();
+
+/// Writes the recorded spans as Chrome trace events (chrome://tracing, Perfetto).
+/// Returns false if the file can't be written.
+bool WriteChromeTrace(const std::string& path);
+
+/// Drops the recorded spans and statistics.
+void Reset();
+
+/// Measures the time from construction to destruction. Does nothing but a check of a static
+/// flag when tracing is disabled.
+class Span
+{
+    public:
+    explicit Span(const char* name_, const char* category_ = "api")
+        : name(IsEnabled() ? name_ : nullptr), category(category_)
+    {
+        if(name != nullptr)
+            start = Clock::now();
+    }
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+    ~Span()
+    {
+        if(name != nullptr)
+            Record(name, category, start, Clock::now());
+    }
+
+    private:
+    const char* name;
+    const char* category;
+    Clock::time_point start{};
+};
+
+} // namespace trace
+} // namespace miopen
+
+#define MIOPEN_TRACE_CAT_(x, y) x##y
+#define MIOPEN_TRACE_CAT(x, y) MIOPEN_TRACE_CAT_(x, y)
+
+/// Opens a span which lasts until the end of the enclosing scope.
+#define MIOPEN_TRACE_SPAN(...) \
+    const miopen::trace::Span MIOPEN_TRACE_CAT(miopen_trace_span_, __LINE__) { __VA_ARGS__ }
+
+#endif // GUARD_MIOPEN_TRACE_HPP_
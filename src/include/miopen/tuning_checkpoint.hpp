@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_TUNING_CHECKPOINT_HPP_
+#define GUARD_MIOPEN_TUNING_CHECKPOINT_HPP_
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+class LockFile;
+
+namespace solver {
+
+/// Result of the evaluation of one PerformanceConfig by GenericSearch.
+struct SearchOutcome
+{
+    bool failed    = false;
+    bool candidate = false; // Averaged over several runs and compared against the best time.
+    float time     = 0.0f;
+};
+
+/// Keeps the outcomes of the PerformanceConfigs evaluated by an auto-tune search in a file,
+/// so that a search which has been interrupted resumes instead of starting over.
+///
+/// The file is identified by the key of the search (solver, problem, device). The outcomes are
+/// looked up by their position in the search and verified against the serialized config,
+/// everything from the first mismatch on is considered stale and is re-evaluated.
+class TuningCheckpoint
+{
+    public:
+    /// Empty path disables the checkpoint.
+    TuningCheckpoint(const std::string& key_, const std::string& path_);
+
+    /// A file under the user db path, or nothing if the user db or the checkpoints are
+    /// disabled (MIOPEN_DEBUG_TUNING_CHECKPOINT=0).
+    static std::string GetDefaultPath(const std::string& key);
+
+    TuningCheckpoint(const TuningCheckpoint&) = delete;
+    TuningCheckpoint& operator=(const TuningCheckpoint&) = delete;
+
+    bool Load(std::size_t n, const std::string& config, SearchOutcome& outcome);
+    void Save(std::size_t n, const std::string& config, const SearchOutcome& outcome);
+    /// Shall be called when the search has completed.
+    void Remove();
+    /// Appends the outcomes loaded by another checkpoint, in memory only.
+    void Append(const TuningCheckpoint& other);
+
+    const std::string& GetPath() const { return path; }
+    std::size_t GetLoadedCount() const { return loaded; }
+
+    private:
+    struct Entry
+    {
+        std::string config;
+        SearchOutcome outcome;
+    };
+
+    std::string key;
+    std::string path;
+    std::vector<Entry> entries;
+    std::size_t loaded = 0;
+    bool synced        = false; // File holds all the entries, new ones can be appended.
+    std::ofstream file;
+
+    void Read();
+    void Rewrite();
+    void Write(const Entry& entry);
+};
+
+/// Lets several processes tune the same problem together. The search space is split into
+/// shards of consecutive PerformanceConfigs, and each process measures the shards it claims.
+///
+/// A shard is claimed by locking its lock file, which is held until the shard is done. The
+/// outcomes of a shard are kept in its TuningCheckpoint, and a marker file is created when all
+/// of them have been saved. A shard which is neither done nor locked has been abandoned by a
+/// process that died, and is claimed again, resuming from its checkpoint. A shard which is locked
+/// by a process making no progress is taken over by another one, see IsStalled().
+///
+/// Each process merges the outcomes of all the shards once they are done, so all of them come
+/// to the same result. The files are removed by the last process to finish.
+class TuningShards
+{
+    public:
+    /// Keeps the files under the user db path, or disables the sharding if the user db is
+    /// disabled.
+    TuningShards(const std::string& key_, std::size_t n_total_, std::size_t shard_size_);
+    TuningShards(const std::string& key_,
+                 const std::string& directory_,
+                 std::size_t n_total_,
+                 std::size_t shard_size_);
+    ~TuningShards();
+
+    TuningShards(const TuningShards&) = delete;
+    TuningShards& operator=(const TuningShards&) = delete;
+
+    bool IsEnabled() const { return !directory.empty(); }
+    bool IsDone() const;
+    /// Claims a shard which is neither done nor being measured by another process.
+    /// Returns false if there is none at the moment.
+    bool Claim();
+    /// Range of the configs of the claimed shard.
+    std::size_t GetBegin() const { return claimed * shard_size; }
+    std::size_t GetEnd() const;
+    /// Outcomes of the claimed shard, indices are relative to GetBegin().
+    TuningCheckpoint& GetCheckpoint() { return *checkpoint; }
+    /// Marks the claimed shard as done.
+    void Complete();
+    /// True if no shard has been completed or saved any outcomes for longer than \p timeout,
+    /// i.e. the processes holding the remaining shards hang. Shall be called while waiting.
+    bool IsStalled(std::chrono::seconds timeout);
+    /// Claims a shard which is not done although it is locked by another process, when that one
+    /// is stalled. Returns false if all of them have been taken over by other processes. The
+    /// outcomes are kept apart from the ones of the owner, which may be slow rather than dead.
+    bool TakeOver();
+    /// Outcomes of the shards in order, up to and including the first one which is incomplete.
+    void Merge(TuningCheckpoint& merged) const;
+
+    private:
+    std::string key;
+    std::string directory;
+    std::size_t n_total;
+    std::size_t shard_size;
+    std::size_t n_shards = 0;
+    std::size_t claimed  = 0;
+    std::unique_ptr<TuningCheckpoint> checkpoint;
+    LockFile* participants = nullptr;
+    LockFile* lock         = nullptr; // Of the claimed shard.
+    std::vector<bool> completed; // By this process, even if the marker could not be written.
+    std::string progress_stamp;
+    std::chrono::steady_clock::time_point progress_time;
+
+    std::string GetKey(std::size_t shard) const;
+    std::string GetPath(std::size_t shard) const;
+    std::string GetTakeOverPath(std::size_t shard) const;
+    std::string GetDonePath(std::size_t shard) const;
+    LockFile& GetLock(std::size_t shard) const;
+    LockFile& GetTakeOverLock(std::size_t shard) const;
+    bool IsDone(std::size_t shard) const;
+    bool Claim(std::size_t shard, LockFile& shard_lock, const std::string& path);
+};
+
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_TUNING_CHECKPOINT_HPP_
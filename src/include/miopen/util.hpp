@@ -35,6 +35,8 @@ namespace miopen {
 
 struct Handle;
 
+/// Im2ColGPU() and Col2ImGPU() process batch_count images at once (2D only). The images and
+/// their columns follow each other without gaps.
 float Im2ColGPU(
     const Handle& handle,
     std::size_t spatial_dim,
@@ -48,7 +50,8 @@ float Im2ColGPU(
     const std::vector<int>& stride_spatial,
     const std::vector<int>& dilation_spatial,
     Data_t col,
-    miopenDataType_t type);
+    miopenDataType_t type,
+    std::size_t batch_count = 1);
 
 float Col2ImGPU(
     const Handle& handle,
@@ -63,7 +66,8 @@ float Col2ImGPU(
     const decltype(boost::adaptors::slice(std::vector<std::size_t>(), 0, 1))& in_spatial,
     Data_t im,
     std::size_t im_offset,
-    miopenDataType_t type);
+    miopenDataType_t type,
+    std::size_t batch_count = 1);
 
 float transpose_NCHW2CNHW(const Handle& handle,
                           int n,
@@ -112,7 +116,22 @@ float transpose_packed_MN2NM(const Handle& handle,
                              int out_offset,
                              ConstData_t in,
                              Data_t out,
-                             miopenDataType_t type);
+                             miopenDataType_t type,
+                             int batch_count = 1);
+
+/// Copies the first min(c_in, c_out) channels of every image of a packed int8 tensor,
+/// out = alpha * in + beta * out, and zeroes the rest of the c_out channels, in one launch.
+float transform_int8_channels(const Handle& handle,
+                              std::size_t n,
+                              std::size_t c_in,
+                              std::size_t c_out,
+                              std::size_t hw,
+                              ConstData_t in,
+                              Data_t out,
+                              std::size_t in_offset,
+                              std::size_t out_offset,
+                              const void* alpha,
+                              const void* beta);
 } // namespace miopen
 
 #endif // _MIOPEN_UTIL_HPP_
@@ -29,8 +29,15 @@
 
 namespace miopen {
 
+InvokerCache::InvokerCache(InvokerCache&& other) noexcept
+{
+    std::lock_guard<std::mutex> lock(other.mutex);
+    invokers = std::move(other.invokers);
+}
+
 boost::optional<const Invoker&> InvokerCache::operator[](const Key& key) const
 {
+    std::lock_guard<std::mutex> lock(mutex);
     const auto item = invokers.find(key.first);
     if(item == invokers.end())
         return boost::none;
@@ -44,6 +51,7 @@ boost::optional<const Invoker&> InvokerCache::operator[](const Key& key) const
 boost::optional<const Invoker&> InvokerCache::GetFound1_0(const std::string& network_config,
                                                           const std::string& algorithm) const
 {
+    std::lock_guard<std::mutex> lock(mutex);
     const auto item = invokers.find(network_config);
     if(item == invokers.end())
     {
@@ -75,6 +83,7 @@ boost::optional<const Invoker&> InvokerCache::GetFound1_0(const std::string& net
 
 void InvokerCache::Register(const Key& key, const Invoker& invoker)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     auto it = invokers.find(key.first);
     if(it != invokers.end())
         it->second.invokers.insert({key.second, invoker});
@@ -87,6 +96,7 @@ void InvokerCache::SetAsFound1_0(const std::string& network_config,
                                  const std::string& algorithm,
                                  const std::string& solver_id)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     const auto item = invokers.find(network_config);
     if(item == invokers.end())
         MIOPEN_THROW("No invoker was registered for " + network_config);
@@ -0,0 +1,319 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/kern_db_bundle.hpp>
+#include <miopen/kern_db.hpp>
+#include <miopen/bz2.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/version.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+
+#include <map>
+#include <set>
+#include <unordered_set>
+
+namespace miopen {
+
+static const std::string BundleFormatVersion = "1";
+
+static std::string GetMIOpenVersion()
+{
+    return std::to_string(MIOPEN_VERSION_MAJOR) + "." + std::to_string(MIOPEN_VERSION_MINOR) +
+           "." + std::to_string(MIOPEN_VERSION_PATCH) + "." +
+           MIOPEN_STRINGIZE(MIOPEN_VERSION_TWEAK);
+}
+
+static std::string CreateBundleQuery()
+{
+    std::ostringstream ss;
+    ss << "CREATE TABLE IF NOT EXISTS `bundle_info` ("
+       << "`key` TEXT PRIMARY KEY"
+       << ",`value` TEXT NOT NULL"
+       << ");"
+       << "CREATE TABLE IF NOT EXISTS `bundle_blob` ("
+       << "`kernel_hash` TEXT PRIMARY KEY"
+       << ",`kernel_blob` BLOB NOT NULL"
+       << ",`uncompressed_size` INT NOT NULL"
+       << ");"
+       << "CREATE TABLE IF NOT EXISTS `bundle_kernel` ("
+       << "`kernel_name` TEXT NOT NULL"
+       << ",`kernel_args` TEXT NOT NULL"
+       << ",`kernel_hash` TEXT NOT NULL"
+       << ",PRIMARY KEY (kernel_name, kernel_args)"
+       << ");";
+    return ss.str();
+}
+
+static void Execute(const SQLite& sql, SQLite::Statement& stmt)
+{
+    if(stmt.Step(sql) != SQLITE_DONE)
+        MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+}
+
+/// Returns the binary if it matches the hash, none otherwise.
+static boost::optional<std::string>
+ReadVerifiedBlob(const std::string& blob, const std::string& hash, int64_t uncompressed_size)
+{
+    try
+    {
+        auto result = uncompressed_size != 0 ? decompress(blob, uncompressed_size) : blob;
+        if(md5(result) != hash)
+            return boost::none;
+        return result;
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_I2(ex.what());
+        return boost::none;
+    }
+}
+
+static KernDb OpenKernDb(const std::string& kdb_path,
+                         bool read_only,
+                         const std::string& arch,
+                         std::size_t num_cu)
+{
+    // KernDb does not accept paths without a directory.
+    const auto path = boost::filesystem::absolute(kdb_path).string();
+    auto db         = KernDb{path, read_only, arch, num_cu};
+    if(db.dbInvalid)
+        MIOPEN_THROW(miopenStatusInternalError, "Invalid kernel cache database: " + kdb_path);
+    return db;
+}
+
+std::vector<KernDbKey> ListKernDbKeys(const std::string& kdb_path)
+{
+    auto db = OpenKernDb(kdb_path, true, "", 0);
+    auto stmt =
+        SQLite::Statement{db.sql, "SELECT kernel_name, kernel_args FROM kern_db ORDER BY id;"};
+
+    std::vector<KernDbKey> keys;
+    for(auto rc = stmt.Step(db.sql); rc != SQLITE_DONE; rc = stmt.Step(db.sql))
+    {
+        if(rc != SQLITE_ROW)
+            MIOPEN_THROW(miopenStatusInternalError, db.sql.ErrorMessage());
+        keys.emplace_back(stmt.ColumnText(0), stmt.ColumnText(1));
+    }
+    return keys;
+}
+
+KernDbBundleStats ExportKernDbBundle(const std::string& kdb_path,
+                                     const std::string& bundle_path,
+                                     const std::string& arch,
+                                     std::size_t num_cu,
+                                     const std::vector<KernDbKey>& keys)
+{
+    auto src = OpenKernDb(kdb_path, true, arch, num_cu);
+
+    boost::filesystem::remove(bundle_path);
+    auto bundle = SQLite{bundle_path, false};
+    if(!bundle.Valid())
+        MIOPEN_THROW(miopenStatusInternalError, "Cannot create bundle file: " + bundle_path);
+    bundle.Exec(CreateBundleQuery());
+    bundle.Exec("BEGIN TRANSACTION;");
+
+    const std::map<std::string, std::string> info = {
+        {"format_version", BundleFormatVersion},
+        {"miopen_version", GetMIOpenVersion()},
+        {"arch", arch},
+        {"num_cu", std::to_string(num_cu)},
+    };
+    for(const auto& item : info)
+    {
+        auto insert = SQLite::Statement{
+            bundle, "INSERT INTO bundle_info(key, value) VALUES(?, ?);", {item.first, item.second}};
+        Execute(bundle, insert);
+    }
+
+    const auto filter = std::set<KernDbKey>(keys.begin(), keys.end());
+    auto hashes       = std::unordered_set<std::string>{};
+    auto stats        = KernDbBundleStats{};
+    auto select       = SQLite::Statement{src.sql,
+                                    "SELECT kernel_name, kernel_args, kernel_blob, kernel_hash, "
+                                    "uncompressed_size FROM kern_db;"};
+
+    for(auto rc = select.Step(src.sql); rc != SQLITE_DONE; rc = select.Step(src.sql))
+    {
+        if(rc != SQLITE_ROW)
+            MIOPEN_THROW(miopenStatusInternalError, src.sql.ErrorMessage());
+
+        const auto key = KernDbKey{select.ColumnText(0), select.ColumnText(1)};
+        if(!filter.empty() && filter.count(key) == 0)
+        {
+            ++stats.skipped;
+            continue;
+        }
+
+        const auto hash = select.ColumnText(3);
+        if(hashes.count(hash) == 0)
+        {
+            const auto blob = ReadVerifiedBlob(select.ColumnBlob(2), hash, select.ColumnInt64(4));
+            if(!blob)
+            {
+                MIOPEN_LOG_W("Corrupted kernel cache entry: " << key.first << " " << key.second);
+                ++stats.corrupted;
+                continue;
+            }
+
+            auto compressed   = false;
+            const auto packed = compress(*blob, &compressed);
+            auto insert       = SQLite::Statement{bundle,
+                                            "INSERT INTO bundle_blob(kernel_hash, kernel_blob, "
+                                            "uncompressed_size) VALUES(?, ?, ?);"};
+            insert.BindText(1, hash);
+            insert.BindBlob(2, compressed ? packed : *blob);
+            insert.BindInt64(3, compressed ? blob->size() : 0);
+            Execute(bundle, insert);
+            hashes.insert(hash);
+            ++stats.blobs;
+        }
+
+        auto insert = SQLite::Statement{bundle,
+                                        "INSERT OR REPLACE INTO bundle_kernel(kernel_name, "
+                                        "kernel_args, kernel_hash) VALUES(?, ?, ?);",
+                                        {key.first, key.second, hash}};
+        Execute(bundle, insert);
+        ++stats.kernels;
+    }
+
+    bundle.Exec("COMMIT;");
+    MIOPEN_LOG_I("Exported " << stats.kernels << " kernels (" << stats.blobs << " binaries) to "
+                             << bundle_path);
+    return stats;
+}
+
+KernDbBundleStats ImportKernDbBundle(const std::string& bundle_path,
+                                     const std::string& kdb_path,
+                                     const std::string& arch,
+                                     std::size_t num_cu,
+                                     bool overwrite)
+{
+    if(!boost::filesystem::exists(bundle_path))
+        MIOPEN_THROW(miopenStatusBadParm, "Bundle file does not exist: " + bundle_path);
+    auto bundle = SQLite{bundle_path, true};
+    if(!bundle.Valid())
+        MIOPEN_THROW(miopenStatusInternalError, "Cannot open bundle file: " + bundle_path);
+
+    std::map<std::string, std::string> info;
+    for(auto& row : bundle.Exec("SELECT key, value FROM bundle_info;"))
+        info[row["key"]] = row["value"];
+
+    if(info["format_version"] != BundleFormatVersion)
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Unsupported bundle format version: " + info["format_version"]);
+    // Kernel sources and compile options change between releases, while the keys may not.
+    if(info["miopen_version"] != GetMIOpenVersion())
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Bundle was exported by MIOpen " + info["miopen_version"] + ", expected " +
+                         GetMIOpenVersion());
+    if(!arch.empty() && (info["arch"] != arch || info["num_cu"] != std::to_string(num_cu)))
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Bundle was exported for " + info["arch"] + "_" + info["num_cu"] +
+                         ", expected " + arch + "_" + std::to_string(num_cu));
+
+    auto dst = OpenKernDb(kdb_path, false, arch, num_cu);
+    dst.sql.Exec("BEGIN TRANSACTION;");
+
+    auto stats  = KernDbBundleStats{};
+    auto select = SQLite::Statement{bundle,
+                                    "SELECT k.kernel_name, k.kernel_args, b.kernel_hash, "
+                                    "b.kernel_blob, b.uncompressed_size FROM bundle_kernel AS k "
+                                    "INNER JOIN bundle_blob AS b ON k.kernel_hash = b.kernel_hash "
+                                    "ORDER BY b.kernel_hash;"};
+    // Rows are sorted by hash, so each binary is verified once.
+    auto last_hash = std::string{};
+    auto verified  = false;
+
+    for(auto rc = select.Step(bundle); rc != SQLITE_DONE; rc = select.Step(bundle))
+    {
+        if(rc != SQLITE_ROW)
+            MIOPEN_THROW(miopenStatusInternalError, bundle.ErrorMessage());
+
+        const auto key  = KernDbKey{select.ColumnText(0), select.ColumnText(1)};
+        const auto hash = select.ColumnText(2);
+
+        auto exists = SQLite::Statement{
+            dst.sql,
+            "SELECT id FROM kern_db WHERE kernel_name = ? AND kernel_args = ?;",
+            {key.first, key.second}};
+        const auto is_present = exists.Step(dst.sql) == SQLITE_ROW;
+        if(is_present && !overwrite)
+        {
+            ++stats.skipped;
+            continue;
+        }
+
+        const auto blob              = select.ColumnBlob(3);
+        const auto uncompressed_size = select.ColumnInt64(4);
+        if(hash != last_hash)
+        {
+            last_hash = hash;
+            verified  = ReadVerifiedBlob(blob, hash, uncompressed_size).is_initialized();
+            if(verified)
+                ++stats.blobs;
+        }
+        if(!verified)
+        {
+            MIOPEN_LOG_W("Corrupted bundle entry: " << key.first << " " << key.second);
+            ++stats.corrupted;
+            continue;
+        }
+
+        if(is_present)
+        {
+            // The unique index includes the hash, so the old binary is not replaced by INSERT.
+            auto remove = SQLite::Statement{
+                dst.sql,
+                "DELETE FROM kern_db WHERE kernel_name = ? AND kernel_args = ?;",
+                {key.first, key.second}};
+            Execute(dst.sql, remove);
+        }
+
+        // The binary is stored as is, there is no need to recompress it.
+        auto insert = SQLite::Statement{dst.sql,
+                                        "INSERT OR REPLACE INTO kern_db(kernel_name, kernel_args, "
+                                        "kernel_blob, kernel_hash, uncompressed_size) "
+                                        "VALUES(?, ?, ?, ?, ?);"};
+        insert.BindText(1, key.first);
+        insert.BindText(2, key.second);
+        insert.BindBlob(3, blob);
+        insert.BindText(4, hash);
+        insert.BindInt64(5, uncompressed_size);
+        Execute(dst.sql, insert);
+        ++stats.kernels;
+    }
+
+    dst.sql.Exec("COMMIT;");
+    MIOPEN_LOG_I("Imported " << stats.kernels << " kernels from " << bundle_path << " into "
+                             << kdb_path);
+    return stats;
+}
+
+} // namespace miopen
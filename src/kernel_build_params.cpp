@@ -24,6 +24,8 @@
  *
  *******************************************************************************/
 
+#include <iterator>
+#include <map>
 #include <sstream>
 
 #include <boost/range/adaptor/transformed.hpp>
@@ -76,4 +78,55 @@ std::string kbp::GcnAsm::Generate(const std::vector<KernelBuildParameter>& optio
     return GenerateDefines(options, "Wa,-defsym,");
 }
 
+std::string CanonicalizeBuildOptions(const std::string& params)
+{
+    // Quoted or escaped values may contain spaces, leave them as they are.
+    if(params.find_first_of("\"'\\") != std::string::npos)
+        return params;
+
+    // Options whose argument is a separate token which must not be taken for a define.
+    static const char* const with_argument[] = {
+        "-mllvm", "-Xclang", "-Xlinker", "-Xassembler", "-include", "-I", "-x", "-o"};
+    const auto takes_argument = [&](const std::string& token) {
+        return std::any_of(std::begin(with_argument),
+                           std::end(with_argument),
+                           [&](const char* option) { return token == option; });
+    };
+
+    std::istringstream ss(params);
+    std::vector<std::string> others;
+    // Name to the whole last -D or -U of it. The compiler applies them in order, so only the
+    // last one of a name matters and the names do not depend on each other.
+    std::map<std::string, std::string> defines;
+    std::string token;
+    while(ss >> token)
+    {
+        if(takes_argument(token))
+        {
+            others.push_back(token);
+            if(ss >> token)
+                others.push_back(token);
+            continue;
+        }
+        if(!StartsWith(token, "-D") && !StartsWith(token, "-U"))
+        {
+            others.push_back(token);
+            continue;
+        }
+
+        auto define = token.substr(2);
+        if(define.empty() && !(ss >> define))
+        {
+            others.push_back(token);
+            break;
+        }
+        const auto name = define.substr(0, define.find('='));
+        defines[name]   = token.substr(0, 2) + define;
+    }
+
+    for(const auto& define : defines)
+        others.push_back(define.second);
+    return JoinStrings(others, " ");
+}
+
 } // namespace miopen
@@ -41,6 +41,7 @@
 
 #include <miopen/device_name.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/kernel_build_params.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/stringutils.hpp>
@@ -115,6 +116,8 @@ static void AddKernelDumpKernelParams(const std::string& program_name,
 
 static void ProcessParams(std::string& params)
 {
+    // Equivalent options from different solvers share one program.
+    params = CanonicalizeBuildOptions(params);
     if(params.length() > 0)
     {
         // Ensure only one space after the -cl-std.
@@ -126,12 +129,13 @@ static void ProcessParams(std::string& params)
     }
 }
 
-const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
-                                                   const std::string& network_config)
+std::vector<Kernel> KernelCache::GetKernels(const std::string& algorithm,
+                                            const std::string& network_config)
 {
 
     std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
 
+    std::lock_guard<std::mutex> lock(mutex);
     const auto it = kernel_map.find(key);
     if(it != kernel_map.end())
     {
@@ -140,9 +144,8 @@ const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
         return it->second;
     }
 
-    static const std::vector<Kernel> empty{};
     MIOPEN_LOG_I2("0 kernels for key: " << key.first << " \"" << key.second << '\"');
-    return empty;
+    return {};
 }
 
 bool KernelCache::HasKernels(const std::string& algorithm, const std::string& network_config) const
@@ -151,6 +154,7 @@ bool KernelCache::HasKernels(const std::string& algorithm, const std::string& ne
 #ifndef NDEBUG
     MIOPEN_LOG_I("Key: " << key.first << " \"" << key.second << '\"');
 #endif
+    std::lock_guard<std::mutex> lock(mutex);
     const auto it = kernel_map.find(key);
     if(it == kernel_map.end())
         return false;
@@ -163,18 +167,27 @@ bool KernelCache::HasKernels(const std::string& algorithm, const std::string& ne
     return true;
 }
 
-bool KernelCache::HasProgram(const std::string& name, const std::string& params) const
+bool KernelCache::HasProgram(const std::string& name, std::string params) const
 {
+    ProcessParams(params);
     const auto key = std::make_pair(name, params);
+    std::lock_guard<std::mutex> lock(mutex);
     return program_map.count(key) > 0;
 }
 
 void KernelCache::AddProgram(Program prog, const std::string& program_name, std::string params)
 {
     ProcessParams(params);
+    std::lock_guard<std::mutex> lock(mutex);
     program_map[std::make_pair(program_name, params)] = prog;
 }
 
+std::size_t KernelCache::GetProgramCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return program_map.size();
+}
+
 Kernel KernelCache::AddKernel(const Handle& h,
                               const std::string& algorithm,
                               const std::string& network_config,
@@ -194,13 +207,19 @@ Kernel KernelCache::AddKernel(const Handle& h,
         MIOPEN_LOG_I2("Key: " << key.first << " \"" << key.second << '\"');
 
     Program program;
+    auto found = false;
 
-    auto program_it = program_map.find(std::make_pair(program_name, params));
-    if(program_it != program_map.end())
     {
-        program = program_it->second;
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto program_it = program_map.find(std::make_pair(program_name, params));
+        if(program_it != program_map.end())
+        {
+            program = program_it->second;
+            found   = true;
+        }
     }
-    else
+
+    if(!found)
     {
         if(!is_kernel_miopengemm_str) // default value
             is_kernel_miopengemm_str = algorithm.find("ImplicitGEMM") == std::string::npos &&
@@ -216,7 +235,9 @@ Kernel KernelCache::AddKernel(const Handle& h,
                                       vgd,
                                       params);
         }
+        // The lock is not held during the build, so several programs can be built in parallel.
         program = h.LoadProgram(program_name, params, is_kernel_miopengemm_str, kernel_src);
+        std::lock_guard<std::mutex> lock(mutex);
         program_map[std::make_pair(program_name, params)] = program;
     }
 
@@ -240,6 +261,7 @@ Kernel KernelCache::AddKernel(const Handle& h,
 
 void KernelCache::AddKernel(Key key, Kernel k, std::size_t cache_index)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     auto&& v = kernel_map[key];
     if(cache_index >= v.size())
     {
@@ -255,6 +277,7 @@ void KernelCache::ClearKernels(const std::string& algorithm, const std::string&
         MIOPEN_THROW("Network config or algorithm empty.");
     }
     const std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
+    std::lock_guard<std::mutex> lock(mutex);
     auto&& v = this->kernel_map[key];
     if(!v.empty())
     {
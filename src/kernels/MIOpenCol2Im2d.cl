@@ -47,10 +47,15 @@ __kernel void Col2Im2d(global _FLOAT* col,
                        const int height,
                        const int width,
                        global _FLOAT* im,
-                       const int im_offset)
+                       const int im_offset,
+                       const int col_batch_stride,
+                       const int im_batch_stride)
 {
-    global _FLOAT* im_off = im + im_offset;
+    // The second dimension of the grid enumerates the images of the batch.
+    const int batch       = (int)get_global_id(1);
+    global _FLOAT* im_off = im + im_offset + batch * im_batch_stride;
     int gid               = (int)get_global_id(0);
+    col += batch * col_batch_stride;
 
     int im_ch  = gid / (width * height);
     int im_pix = gid % (width * height);
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "float_types.h"
+
+// Direct convolutions which take all the problem sizes as kernel arguments, so one build
+// per data type and tile serves every shape. Compile-time parameters:
+//  MLO_GRP_SZ0        - work-group size.
+//  MLO_N_LCL_OUT_MAPS - output channels per work-item.
+//  MLO_READ_UNIT      - output pixels per work-item.
+//
+// Work-items of dimension 0 walk the batch and the output pixels, MLO_READ_UNIT pixels each;
+// work-items of dimension 1 walk the output channels, MLO_N_LCL_OUT_MAPS channels each.
+// Weights are addressed as wei[o * wei_out_stride + i * wei_in_stride + filter_pos], which
+// serves KCHW weights in both directions: forward passes (C * R * S, R * S) and backward
+// data passes (R * S, C * R * S) together with flip = 1.
+
+#define UNUSED __attribute__((__unused__))
+
+__attribute__((reqd_work_group_size(MLO_GRP_SZ0, 1, 1))) __kernel void
+MIOpenConv1x1Dyn(const __global _FLOAT* __restrict in_ptr,
+                 const __global _FLOAT* __restrict wei_ptr,
+                 __global _FLOAT* __restrict out_ptr,
+                 UNUSED _FLOAT dummy_val,
+                 const int batch,
+                 const int n_inputs,
+                 const int n_outputs,
+                 const int in_stride,
+                 const int in_channel_stride,
+                 const int in_batch_stride,
+                 const int out_width,
+                 const int out_height,
+                 const int out_stride,
+                 const int out_channel_stride,
+                 const int out_batch_stride,
+                 const int stride_w,
+                 const int stride_h,
+                 const int wei_out_stride,
+                 const int wei_in_stride)
+{
+    const int map_sz     = out_width * out_height;
+    const int pix_groups = (map_sz + MLO_READ_UNIT - 1) / MLO_READ_UNIT;
+    const int gid0       = get_global_id(0);
+    const int b          = gid0 / pix_groups;
+    if(b >= batch)
+        return;
+    const int pix0 = (gid0 - b * pix_groups) * MLO_READ_UNIT;
+    const int o0   = get_global_id(1) * MLO_N_LCL_OUT_MAPS;
+
+    int in_off[MLO_READ_UNIT];
+    int out_off[MLO_READ_UNIT];
+    for(int u = 0; u < MLO_READ_UNIT; ++u)
+    {
+        // Tail pixels read the last valid one and are not written.
+        const int p = min(pix0 + u, map_sz - 1);
+        const int y = p / out_width;
+        const int x = p - y * out_width;
+        in_off[u]   = b * in_batch_stride + y * stride_h * in_stride + x * stride_w;
+        out_off[u]  = b * out_batch_stride + y * out_stride + x;
+    }
+
+    _FLOAT_ACCUM acc[MLO_N_LCL_OUT_MAPS][MLO_READ_UNIT];
+    for(int o = 0; o < MLO_N_LCL_OUT_MAPS; ++o)
+        for(int u = 0; u < MLO_READ_UNIT; ++u)
+            acc[o][u] = (_FLOAT_ACCUM)0;
+
+    for(int c = 0; c < n_inputs; ++c)
+    {
+        _FLOAT_ACCUM data[MLO_READ_UNIT];
+        for(int u = 0; u < MLO_READ_UNIT; ++u)
+            data[u] = CVT_FLOAT2ACCUM(in_ptr[in_off[u] + c * in_channel_stride]);
+
+        for(int o = 0; o < MLO_N_LCL_OUT_MAPS; ++o)
+        {
+            const int oc = min(o0 + o, n_outputs - 1);
+            const _FLOAT_ACCUM w =
+                CVT_FLOAT2ACCUM(wei_ptr[oc * wei_out_stride + c * wei_in_stride]);
+            for(int u = 0; u < MLO_READ_UNIT; ++u)
+                acc[o][u] += w * data[u];
+        }
+    }
+
+    for(int o = 0; o < MLO_N_LCL_OUT_MAPS; ++o)
+    {
+        if(o0 + o >= n_outputs)
+            break;
+        for(int u = 0; u < MLO_READ_UNIT; ++u)
+            if(pix0 + u < map_sz)
+                out_ptr[out_off[u] + (o0 + o) * out_channel_stride] = CVT_ACCUM2FLOAT(acc[o][u]);
+    }
+}
+
+__attribute__((reqd_work_group_size(MLO_GRP_SZ0, 1, 1))) __kernel void
+MIOpenConvDirDyn(const __global _FLOAT* __restrict in_ptr,
+                 const __global _FLOAT* __restrict wei_ptr,
+                 __global _FLOAT* __restrict out_ptr,
+                 UNUSED _FLOAT dummy_val,
+                 const int batch,
+                 const int n_inputs,
+                 const int n_outputs,
+                 const int in_width,
+                 const int in_height,
+                 const int in_stride,
+                 const int in_channel_stride,
+                 const int in_batch_stride,
+                 const int out_width,
+                 const int out_height,
+                 const int out_stride,
+                 const int out_channel_stride,
+                 const int out_batch_stride,
+                 const int filter_w,
+                 const int filter_h,
+                 const int stride_w,
+                 const int stride_h,
+                 const int pad_w,
+                 const int pad_h,
+                 const int dilation_w,
+                 const int dilation_h,
+                 const int wei_out_stride,
+                 const int wei_in_stride,
+                 const int flip)
+{
+    const int map_sz     = out_width * out_height;
+    const int pix_groups = (map_sz + MLO_READ_UNIT - 1) / MLO_READ_UNIT;
+    const int gid0       = get_global_id(0);
+    const int b          = gid0 / pix_groups;
+    if(b >= batch)
+        return;
+    const int pix0      = (gid0 - b * pix_groups) * MLO_READ_UNIT;
+    const int o0        = get_global_id(1) * MLO_N_LCL_OUT_MAPS;
+    const int filter_sz = filter_w * filter_h;
+
+    int in_y[MLO_READ_UNIT];
+    int in_x[MLO_READ_UNIT];
+    int out_off[MLO_READ_UNIT];
+    for(int u = 0; u < MLO_READ_UNIT; ++u)
+    {
+        const int p = min(pix0 + u, map_sz - 1);
+        const int y = p / out_width;
+        const int x = p - y * out_width;
+        in_y[u]     = y * stride_h - pad_h;
+        in_x[u]     = x * stride_w - pad_w;
+        out_off[u]  = b * out_batch_stride + y * out_stride + x;
+    }
+
+    _FLOAT_ACCUM acc[MLO_N_LCL_OUT_MAPS][MLO_READ_UNIT];
+    for(int o = 0; o < MLO_N_LCL_OUT_MAPS; ++o)
+        for(int u = 0; u < MLO_READ_UNIT; ++u)
+            acc[o][u] = (_FLOAT_ACCUM)0;
+
+    for(int c = 0; c < n_inputs; ++c)
+    {
+        const __global _FLOAT* in_map = in_ptr + b * in_batch_stride + c * in_channel_stride;
+        for(int r = 0; r < filter_h; ++r)
+        {
+            for(int s = 0; s < filter_w; ++s)
+            {
+                _FLOAT_ACCUM data[MLO_READ_UNIT];
+                for(int u = 0; u < MLO_READ_UNIT; ++u)
+                {
+                    const int y = in_y[u] + r * dilation_h;
+                    const int x = in_x[u] + s * dilation_w;
+                    const bool inside = y >= 0 && y < in_height && x >= 0 && x < in_width;
+                    data[u] = inside ? CVT_FLOAT2ACCUM(in_map[y * in_stride + x])
+                                     : (_FLOAT_ACCUM)0;
+                }
+
+                const int filter_pos = flip ? filter_sz - 1 - (r * filter_w + s)
+                                            : r * filter_w + s;
+                for(int o = 0; o < MLO_N_LCL_OUT_MAPS; ++o)
+                {
+                    const int oc = min(o0 + o, n_outputs - 1);
+                    const _FLOAT_ACCUM w = CVT_FLOAT2ACCUM(
+                        wei_ptr[oc * wei_out_stride + c * wei_in_stride + filter_pos]);
+                    for(int u = 0; u < MLO_READ_UNIT; ++u)
+                        acc[o][u] += w * data[u];
+                }
+            }
+        }
+    }
+
+    for(int o = 0; o < MLO_N_LCL_OUT_MAPS; ++o)
+    {
+        if(o0 + o >= n_outputs)
+            break;
+        for(int u = 0; u < MLO_READ_UNIT; ++u)
+            if(pix0 + u < map_sz)
+                out_ptr[out_off[u] + (o0 + o) * out_channel_stride] = CVT_ACCUM2FLOAT(acc[o][u]);
+    }
+}
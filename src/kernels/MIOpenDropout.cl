@@ -72,6 +72,7 @@
 #if RUN_INIT_PRNG
 #include "precalc_xorwow_skipahead_matrices_kernel.h"
 #include "precalc_xorwow_skipahead_sequence_matrices_kernel.h"
+#include "precalc_xorwow_skipahead_jump_table_kernel.h"
 #endif
 
 typedef struct xorwowStates
@@ -143,6 +144,26 @@ void mat_vec(const uint* matrix, uint* vector)
     copy_arr(vector, result, XORWOW_DIM);
 }
 
+// Same as mat_vec, reads the matrix directly from the precalculated tables.
+void mat_vec_const(constant uint* matrix, uint* vector)
+{
+    uint result[XORWOW_DIM] = {0};
+    for(int i = 0; i < XORWOW_DIM; i++)
+    {
+        for(int j = 0; j < XORWOW_BITS; j++)
+        {
+            if(vector[i] & (1 << j))
+            {
+                for(int k = 0; k < XORWOW_DIM; k++)
+                {
+                    result[k] ^= matrix[XORWOW_DIM * (i * XORWOW_BITS + j) + k];
+                }
+            }
+        }
+    }
+    copy_arr(vector, result, XORWOW_DIM);
+}
+
 void mat_mat(uint* matrixA, const uint* matrixB)
 {
     for(int i = 0; i < XORWOW_DIM * XORWOW_BITS; i++)
@@ -205,12 +226,9 @@ void xorwow_skipahead(unsigned long long skp,
 #endif
           )
     {
-        uint mat[XORWOW_PRECALC_MATRICES_SZ];
-        copy_const_arr(mat, skipahead_mat[mat_idx], XORWOW_PRECALC_MATRICES_SZ);
-
         if(skp & XORWOW_JUMP_LOG2_MASK)
         {
-            mat_vec(mat, xor_vec);
+            mat_vec_const(skipahead_mat[mat_idx], xor_vec);
         }
         skp >>= XORWOW_JUMP_LOG2;
         mat_idx++;
@@ -243,6 +261,45 @@ void xorwow_skipahead(unsigned long long skp,
     }
 }
 
+// Skips ahead by skp subsequences. The low digits of skp take one matrix-vector product each
+// from the jump table, the higher bits continue with the power-of-two sequence matrices.
+void xorwow_skipahead_sequence(unsigned long long skp, prngStates* state)
+{
+    uint xor_vec[XORWOW_DIM];
+    uint* p = &(state->x);
+    for(int i = 0; i < XORWOW_DIM; i++)
+    {
+        xor_vec[i] = *(p + i);
+    }
+
+    for(uint digit_idx = 0; skp && digit_idx < XORWOW_JUMP_TABLE_DIGITS; digit_idx++)
+    {
+        const uint digit = (uint)(skp & XORWOW_JUMP_TABLE_RADIX_MASK);
+        if(digit)
+        {
+            mat_vec_const(
+                precalc_xorwow_skipahead_jump_table[digit_idx * XORWOW_JUMP_TABLE_RADIX_MASK +
+                                                    digit - 1],
+                xor_vec);
+        }
+        skp >>= XORWOW_JUMP_TABLE_RADIX_LOG2;
+    }
+
+    for(uint mat_idx = XORWOW_JUMP_TABLE_BITS / XORWOW_JUMP_LOG2; skp; mat_idx++)
+    {
+        if(skp & XORWOW_JUMP_LOG2_MASK)
+        {
+            mat_vec_const(precalc_xorwow_skipahead_sequence_matrices[mat_idx], xor_vec);
+        }
+        skp >>= XORWOW_JUMP_LOG2;
+    }
+
+    for(int i = 0; i < XORWOW_DIM; i++)
+    {
+        *(p + i) = xor_vec[i];
+    }
+}
+
 void xorwow_lite_init(prngStates* cur_state,
                       const unsigned long long seed,
                       const unsigned long long subsequence,
@@ -268,7 +325,7 @@ void xorwow_lite_init(prngStates* cur_state,
     cur_state->v += t0;
     cur_state->d += t1 + t0;
 
-    xorwow_skipahead(subsequence, cur_state, precalc_xorwow_skipahead_sequence_matrices);
+    xorwow_skipahead_sequence(subsequence, cur_state);
 
     xorwow_skipahead(offset, cur_state, precalc_xorwow_skipahead_matrices);
     cur_state->d += (uint)(offset)*362437;
@@ -276,14 +333,19 @@ void xorwow_lite_init(prngStates* cur_state,
 
 __kernel void InitKernelState(__global prngStates* state)
 {
-    for(uint gid = get_global_id(0); gid < STATES_NUM; gid += get_global_size(0))
-    {
-        prngStates state_gid;
-        xorwow_lite_init(&state_gid,
-                         (unsigned long long)PRNG_SEED,
-                         (unsigned long long)gid,
-                         (unsigned long long)0);
+    uint gid = get_global_id(0);
+    if(gid >= STATES_NUM)
+        return;
+
+    prngStates state_gid;
+    xorwow_lite_init(
+        &state_gid, (unsigned long long)PRNG_SEED, (unsigned long long)gid, (unsigned long long)0);
+    *((__global prngStates*)(state + gid)) = state_gid;
 
+    // The next state of this work-item is the current one a global size of subsequences ahead.
+    for(gid += get_global_size(0); gid < STATES_NUM; gid += get_global_size(0))
+    {
+        xorwow_skipahead_sequence(get_global_size(0), &state_gid);
         *((__global prngStates*)(state + gid)) = state_gid;
     }
 }
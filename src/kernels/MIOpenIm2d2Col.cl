@@ -118,7 +118,9 @@ kernel void Im2d2Col(const int data_size_off,
                      const int stride_w,
                      const int dilation_h,
                      const int dilation_w,
-                     global data_t* col)
+                     global data_t* col,
+                     const int im_batch_stride,
+                     const int col_batch_stride)
 {
 #define THREADS_PER_CH (256 / NUM_CH_PER_WG)
 
@@ -128,9 +130,12 @@ kernel void Im2d2Col(const int data_size_off,
 #define IM_OFF_GUARD(idx) im_off[idx]
 #endif
 
-    global data_t* im_off = im + im_offset;
+    // The second dimension of the grid enumerates the images of the batch.
+    const int batch       = get_group_id(1);
+    global data_t* im_off = im + im_offset + batch * im_batch_stride;
     int lid               = get_local_id(0);
     int gid               = get_group_id(0);
+    col += batch * col_batch_stride;
 
 #ifndef EXTREME_LARGE
 #if NUM_IM_BLKS == 1 && STRIDE_GT_1 == 0
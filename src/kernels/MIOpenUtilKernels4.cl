@@ -89,6 +89,18 @@ typedef float data_t;
 #define IS_2D_WG 0
 #endif
 
+#ifndef NC_TRANS_INT8_CHANNELS
+#define NC_TRANS_INT8_CHANNELS 0
+#endif
+
+#ifndef USE_ALPHA
+#define USE_ALPHA 0
+#endif
+
+#ifndef USE_BETA
+#define USE_BETA 0
+#endif
+
 // N - batch size
 // C - # of maps
 // H - map height
@@ -212,14 +224,16 @@ __kernel void transpose_CNHW2NCHW(const global data_t* in, global data_t* out)
 __kernel void transpose_packed_MN2NM(const global data_t* in, global data_t* out)
 {
     uint i = get_global_id(0);
+    // The matrices of the batch follow each other.
+    uint batch_off = get_global_id(1) * M * N;
 
     if(i < M * N)
     {
         uint m_i = iDiv(i, N);
         uint n_i = iMod(i, m_i, N);
 
-        uint in_off  = m_i * N + n_i + IN_OFF;
-        uint out_off = n_i * M + m_i + OUT_OFF;
+        uint in_off  = batch_off + m_i * N + n_i + IN_OFF;
+        uint out_off = batch_off + n_i * M + m_i + OUT_OFF;
 
         const global data_t* cin = (const global data_t*)(in + in_off);
         global data_t* cout      = (global data_t*)(out + out_off);
@@ -228,3 +242,52 @@ __kernel void transpose_packed_MN2NM(const global data_t* in, global data_t* out
     }
 }
 #endif
+
+#if NC_TRANS_INT8_CHANNELS
+// Changes the number of channels of a packed int8 tensor: out = alpha * in + beta * out over the
+// first min(C_IN, C_OUT) channels, the rest of the output channels (padding) are set to zero.
+// global size = (C_OUT * HW rounded up, N, 1)
+__kernel void transform_int8_channels(const global data_t* in,
+                                      global data_t* out,
+                                      const uint in_off,
+                                      const uint out_off,
+                                      const float alpha,
+                                      const float beta)
+{
+    uint i   = get_global_id(0);
+    uint n_i = get_global_id(1);
+
+    if(i < C_OUT * HW)
+    {
+        // Channel c_i of the image starts at c_i * HW in both tensors.
+        const data_t x = i < C_IN * HW ? in[in_off + n_i * C_IN * HW + i] : 0;
+        global data_t* y = out + out_off + n_i * C_OUT * HW + i;
+
+#if USE_ALPHA || USE_BETA
+        if(i < C_IN * HW)
+        {
+#if USE_ALPHA
+            float v = alpha * (float)x;
+#else
+            (void)alpha;
+            float v = (float)x;
+#endif
+#if USE_BETA
+            v += beta * (float)*y;
+#else
+            (void)beta;
+#endif
+            *y = convert_char_sat(round(v));
+        }
+        else
+        {
+            *y = 0;
+        }
+#else
+        (void)alpha;
+        (void)beta;
+        *y = x;
+#endif
+    }
+}
+#endif
@@ -0,0 +1,7032 @@
+#define XORWOW_DIM 5
+#define XORWOW_BITS 32
+#define XORWOW_PRECALC_MATRICES_SZ (XORWOW_BITS * XORWOW_DIM * XORWOW_DIM)
+#define XORWOW_JUMP_TABLE_RADIX_LOG2 4
+#define XORWOW_JUMP_TABLE_RADIX_MASK ((1 << XORWOW_JUMP_TABLE_RADIX_LOG2) - 1)
+#define XORWOW_JUMP_TABLE_DIGITS 4
+#define XORWOW_JUMP_TABLE_BITS (XORWOW_JUMP_TABLE_RADIX_LOG2 * XORWOW_JUMP_TABLE_DIGITS)
+#define XORWOW_JUMP_TABLE_NUM (XORWOW_JUMP_TABLE_RADIX_MASK * XORWOW_JUMP_TABLE_DIGITS)
+
+static __constant unsigned int
+    precalc_xorwow_skipahead_jump_table[XORWOW_JUMP_TABLE_NUM][XORWOW_PRECALC_MATRICES_SZ] = {
+        {
+            850664906,  2293210629, 1517805917, 1215500405, 1612415445, 645388200,  824349799,
+            3517232886, 4075591755, 3089899292, 4249786064, 3811424903, 1100783479, 53649761,
+            2817264826, 3159462529, 1654848550, 950025444,  3095510002, 4080567211, 4111078399,
+            3241719305, 2788212779, 4256963770, 2426893717, 4190211142, 1420776905, 3780537969,
+            1102912875, 1657948873, 3354905256, 2519610308, 515777663,  3396785394, 1832603711,
+            1154211550, 1915690212, 1933919046, 789578337,  337961173,  1359089498, 2249086205,
+            3417955173, 862571348,  528120760,  1265685672, 1970052076, 3585976752, 3645339918,
+            312171257,  1360991400, 1994321680, 2327168468, 2540437053, 1180483641, 2217962701,
+            182726833,  590204372,  1904496495, 2545607041, 3697978033, 1084030545, 3397906968,
+            2192325323, 2704204176, 1069092002, 2364406907, 1578647245, 3561974633, 3437665426,
+            1464127305, 1616628807, 2243114101, 3639967880, 1702613633, 2437350057, 39991274,
+            2024323584, 3795072940, 3604530798, 443099203,  643536212,  1919517328, 3931285769,
+            427935569,  276421624,  2492081750, 262729512,  3088549877, 2922650665, 1816283755,
+            4246096489, 842575914,  1460435650, 3050522190, 2640849794, 3697925816, 3465779075,
+            3856929655, 1365559780, 2897029415, 2747033756, 3611830629, 1891542518, 1897590206,
+            437451803,  677924906,  123809117,  3940574372, 687640291,  3488484529, 470218446,
+            1092571016, 1537938503, 1073323937, 611300083,  3809285994, 3975678726, 925845389,
+            2514775760, 2859302390, 2761919483, 993285307,  164095287,  3736193671, 2078946336,
+            1418537059, 1202525920, 4234029440, 1313593624, 2484428922, 1833969372, 661495122,
+            2217907395, 2795045321, 2950835531, 1402379354, 351314168,  1902476749, 1914974334,
+            2873973176, 1321203603, 3316118265, 3282193947, 1342191737, 793441242,  3281524559,
+            296088733,  487851702,  712098215,  1388727135, 1705533557, 3557800292, 399729516,
+            1355829467, 291276309,  421164833,  1318404599, 2064519128, 1161612642, 2076623594,
+            850664906,  2293210629, 1517805917, 1215500405, 3847487204, 645388200,  824349799,
+            3517232886, 4075591755, 2755872609, 4249786064, 3811424903, 1100783479, 53649761,
+            1417544262, 3159462529, 1654848550, 950025444,  3095510002, 1908900347, 4111078399,
+            3241719305, 2788212779, 4256963770, 3750258343, 4190211142, 1420776905, 3780537969,
+            1102912875, 1690550,    3354905256, 2519610308, 515777663,  3396785394, 2658162202,
+            1154211550, 1915690212, 1933919046, 789578337,  189880016,  1359089498, 2249086205,
+            3417955173, 862571348,  998719835,  1265685672, 1970052076, 3585976752, 3645339918,
+            2973042959, 1360991400, 1994321680, 2327168468, 2540437053, 2283905032, 2217962701,
+            182726833,  590204372,  1904496495, 110719262,  3697978033, 1084030545, 3397906968,
+            2192325323, 4133333579, 1069092002, 2364406907, 1578647245, 3561974633, 3629845331,
+            1464127305, 1616628807, 2243114101, 3639967880, 3256744141, 2437350057, 39991274,
+            2024323584, 3795072940, 1024703328, 443099203,  643536212,  1919517328, 3931285769,
+            2755167056, 276421624,  2492081750, 262729512,  3088549877, 2817867653, 1816283755,
+            4246096489, 842575914,  1460435650, 2276077438, 2640849794, 3697925816, 3465779075,
+            3856929655, 130551477,  2897029415, 2747033756, 3611830629, 1891542518, 804565809,
+            437451803,  677924906,  123809117,  3940574372, 2446610749, 3488484529, 470218446,
+            1092571016, 1537938503, 1502147484, 611300083,  3809285994, 3975678726, 925845389,
+            872826112,  2859302390, 2761919483, 993285307,  164095287,  3901654538, 2078946336,
+            1418537059, 1202525920, 4234029440, 704759480,  2484428922, 1833969372, 661495122,
+            2217907395, 3287413716, 2950835531, 1402379354, 351314168,  1902476749, 2033316109,
+            2873973176, 1321203603, 3316118265, 3282193947, 1316780684, 793441242,  3281524559,
+            296088733,  487851702,  314311643,  1388727135, 1705533557, 3557800292, 399729516,
+            1660074989, 291276309,  421164833,  1318404599, 2064519128, 3156334112, 2076623594,
+            850664906,  2293210629, 1517805917, 335452425,  3847487204, 645388200,  824349799,
+            3517232886, 954487767,  2755872609, 4249786064, 3811424903, 1100783479, 3408594583,
+            1417544262, 3159462529, 1654848550, 950025444,  324339737,  1908900347, 4111078399,
+            3241719305, 2788212779, 1890540205, 3750258343, 4190211142, 1420776905, 3780537969,
+            3716648585, 1690550,    3354905256, 2519610308, 515777663,  3758156132, 2658162202,
+            1154211550, 1915690212, 1933919046, 844149171,  189880016,  1359089498, 2249086205,
+            3417955173, 1031812215, 998719835,  1265685672, 1970052076, 3585976752, 3174204115,
+            2973042959, 1360991400, 1994321680, 2327168468, 714016907,  2283905032, 2217962701,
+            182726833,  590204372,  2151450260, 110719262,  3697978033, 1084030545, 3397906968,
+            767772303,  4133333579, 1069092002, 2364406907, 1578647245, 42955292,   3629845331,
+            1464127305, 1616628807, 2243114101, 3222189776, 3256744141, 2437350057, 39991274,
+            2024323584, 3142424684, 1024703328, 443099203,  643536212,  1919517328, 918511196,
+            2755167056, 276421624,  2492081750, 262729512,  4246877536, 2817867653, 1816283755,
+            4246096489, 842575914,  1425765936, 2276077438, 2640849794, 3697925816, 3465779075,
+            1491702526, 130551477,  2897029415, 2747033756, 3611830629, 1844578694, 804565809,
+            437451803,  677924906,  123809117,  3419189841, 2446610749, 3488484529, 470218446,
+            1092571016, 3272535988, 1502147484, 611300083,  3809285994, 3975678726, 2853681168,
+            872826112,  2859302390, 2761919483, 993285307,  1434560128, 3901654538, 2078946336,
+            1418537059, 1202525920, 2530097881, 704759480,  2484428922, 1833969372, 661495122,
+            503878844,  3287413716, 2950835531, 1402379354, 351314168,  4131886119, 2033316109,
+            2873973176, 1321203603, 3316118265, 237900321,  1316780684, 793441242,  3281524559,
+            296088733,  1730738847, 314311643,  1388727135, 1705533557, 3557800292, 1553835665,
+            1660074989, 291276309,  421164833,  1318404599, 964731488,  3156334112, 2076623594,
+            850664906,  2293210629, 1105350579, 335452425,  3847487204, 645388200,  824349799,
+            2789953706, 954487767,  2755872609, 4249786064, 3811424903, 3937839949, 3408594583,
+            1417544262, 3159462529, 1654848550, 624060530,  324339737,  1908900347, 4111078399,
+            3241719305, 2294919498, 1890540205, 3750258343, 4190211142, 1420776905, 2279133729,
+            3716648585, 1690550,    3354905256, 2519610308, 3563975602, 3758156132, 2658162202,
+            1154211550, 1915690212, 3505586122, 844149171,  189880016,  1359089498, 2249086205,
+            2389487504, 1031812215, 998719835,  1265685672, 1970052076, 2798611919, 3174204115,
+            2973042959, 1360991400, 1994321680, 1684134678, 714016907,  2283905032, 2217962701,
+            182726833,  1734988742, 2151450260, 110719262,  3697978033, 1084030545, 159906818,
+            767772303,  4133333579, 1069092002, 2364406907, 1290801202, 42955292,   3629845331,
+            1464127305, 1616628807, 987794861,  3222189776, 3256744141, 2437350057, 39991274,
+            3644076751, 3142424684, 1024703328, 443099203,  643536212,  1487589384, 918511196,
+            2755167056, 276421624,  2492081750, 137688638,  4246877536, 2817867653, 1816283755,
+            4246096489, 1518475380, 1425765936, 2276077438, 2640849794, 3697925816, 4226506771,
+            1491702526, 130551477,  2897029415, 2747033756, 2033599579, 1844578694, 804565809,
+            437451803,  677924906,  2749065512, 3419189841, 2446610749, 3488484529, 470218446,
+            290444026,  3272535988, 1502147484, 611300083,  3809285994, 2546040767, 2853681168,
+            872826112,  2859302390, 2761919483, 4097961150, 1434560128, 3901654538, 2078946336,
+            1418537059, 2725734455, 2530097881, 704759480,  2484428922, 1833969372, 3999408333,
+            503878844,  3287413716, 2950835531, 1402379354, 3861442503, 4131886119, 2033316109,
+            2873973176, 1321203603, 1267331405, 237900321,  1316780684, 793441242,  3281524559,
+            1273427916, 1730738847, 314311643,  1388727135, 1705533557, 1474310231, 1553835665,
+            1660074989, 291276309,  421164833,  3884815658, 3088049345, 3307042227, 3228948601,
+            1717605083, 1864502063, 3799516572, 2372822470, 2691586476, 1172840854, 1577099080,
+            870101866,  2139291021, 406996656,  255568268,  897760202,  674745664,  885214361,
+            3753233375, 3015215223, 1711461259, 3241363282, 2125360928, 2493601640, 2350228245,
+            3434627328, 2095642963, 3360932494, 3287396242, 4070512427, 3415702664, 1958354224,
+            3280206940, 3929504236, 3390499817, 4144225735, 3621750606, 3205006592, 3495743785,
+            269239326,  2181299371, 2898796651, 2613623219, 3988711298, 2162437858, 949553433,
+            3289670000, 3559525307, 3366925567, 2112148665, 955626393,  1790865381, 699223558,
+            3889584301, 1020750250, 4105283899, 2295851818, 4045668915, 2224770025, 766386910,
+            4265157386, 89139307,   2099710177, 1012450874, 1875492446, 1927399417, 767450812,
+            654474783,  4265293038, 4041215389, 4102336947, 4263617328, 2135826340, 2317231535,
+            3773895729, 403151111,  1400693138, 4255050194, 755369466,  2325764302, 2617301159,
+            4165707294, 1206304709, 2415645397, 4276004841, 1457022279, 662660652,  795140282,
+            828519889,  805830562,  1179976369, 2212548232, 755708248,  1034682071, 899950902,
+            1906046264, 1861009040, 310711525,  920739741,  2322414272, 3179236470, 81822135,
+            4111390320, 1800166783, 112253014,  688771939,  1050990794, 3124647483, 287052171,
+            1363630156, 3447798279, 1405733552, 3075862538, 1682808202, 1595154222, 1173705692,
+            680713285,  2748212230, 568610527,  3434965538, 1114942930, 2835858745, 2575992250,
+            3243355150, 2127580225, 1855934450, 3915941751, 2228679809, 1514780124, 1506688039,
+            1033083295, 793807083,  1120681149, 4105670165, 3999570340, 2083020131, 1213356023,
+            3684882757, 3375797774, 3577986103, 2092046164, 2593847443, 1826450612, 367828409,
+            3198272513, 1941316667, 943707510,  907134807,  2020457947, 1462193665, 2964617539,
+            4216491663, 2625270800, 2395371467, 3691003028, 3659016793, 2381847054, 3513105567,
+            3013019506, 2731245927,
+        },
+        {
+            1422614014, 745568314,  626407464,  4062559468, 2613459489, 4177655052, 1672395630,
+            1474977924, 2823487182, 465346019,  734137916,  4180764607, 2163513338, 606113658,
+            3174619730, 236399864,  1330756991, 501480170,  214631839,  3261385175, 375152635,
+            1167857634, 3209084532, 2627326222, 4116542738, 1141610533, 2611713002, 2879568649,
+            2450999424, 4178635237, 1577510171, 3602219173, 1086036574, 3847230824, 952482243,
+            3425534332, 3538133264, 100081443,  899217966,  4201856265, 3079090238, 534181866,
+            922058770,  2970777295, 369650741,  4119178891, 3687458877, 791773347,  1104312674,
+            1817383449, 2176704433, 2320954546, 5919830,    2667116610, 2528041838, 2507270250,
+            599611442,  1212200694, 1309013107, 3355393929, 2772549355, 2299276186, 992825286,
+            3422240806, 503594449,  51662720,   3222197639, 141783746,  2737882902, 2475601555,
+            908740719,  191019609,  2975375176, 243175543,  3730106217, 4071712904, 1687041846,
+            2634355887, 536261288,  3951913403, 3248345453, 397128304,  3569820105, 2603645138,
+            3337119827, 430438360,  3117458239, 1451121206, 3945746706, 966221054,  299140843,
+            2275672733, 3607591301, 553161648,  3412183424, 122428569,  1700141846, 3645464284,
+            2908320511, 3974328900, 3632774842, 728438630,  1454525397, 792806846,  1613261880,
+            955919338,  3491185541, 3088025223, 880384036,  2188908868, 3132909725, 2587987541,
+            2148544204, 2939041880, 1180486964, 1056296727, 1366626816, 264359013,  4122968290,
+            305060753,  2505315854, 1473453106, 1493379721, 2437980506, 3347660702, 1117268960,
+            737350320,  426755021,  3767690118, 557946404,  776356504,  3940866607, 4094636832,
+            1826751786, 3184358996, 681430125,  3677642982, 368203500,  3905975303, 1490281992,
+            1389642365, 137765097,  205669159,  1246244008, 4212479763, 1300084160, 4231139128,
+            2136901346, 3726585276, 623161609,  1811825608, 180789070,  2925990476, 2825279205,
+            1673043993, 3705651371, 1431745864, 1496694248, 4095386885, 4234561138, 4172917961,
+            1422614014, 745568314,  626407464,  4062559468, 3687237788, 4177655052, 1672395630,
+            1474977924, 2823487182, 1587943520, 734137916,  4180764607, 2163513338, 606113658,
+            26295413,   236399864,  1330756991, 501480170,  214631839,  2143738607, 375152635,
+            1167857634, 3209084532, 2627326222, 4163316777, 1141610533, 2611713002, 2879568649,
+            2450999424, 2896499380, 1577510171, 3602219173, 1086036574, 3847230824, 1747562651,
+            3425534332, 3538133264, 100081443,  899217966,  3175464274, 3079090238, 534181866,
+            922058770,  2970777295, 354960801,  4119178891, 3687458877, 791773347,  1104312674,
+            1324737541, 2176704433, 2320954546, 5919830,    2667116610, 3769675693, 2507270250,
+            599611442,  1212200694, 1309013107, 761362267,  2772549355, 2299276186, 992825286,
+            3422240806, 3454745046, 51662720,   3222197639, 141783746,  2737882902, 3685472695,
+            908740719,  191019609,  2975375176, 243175543,  3421729684, 4071712904, 1687041846,
+            2634355887, 536261288,  2224110105, 3248345453, 397128304,  3569820105, 2603645138,
+            3864052997, 430438360,  3117458239, 1451121206, 3945746706, 1341331776, 299140843,
+            2275672733, 3607591301, 553161648,  1770357812, 122428569,  1700141846, 3645464284,
+            2908320511, 1948506152, 3632774842, 728438630,  1454525397, 792806846,  2355940736,
+            955919338,  3491185541, 3088025223, 880384036,  3344528250, 3132909725, 2587987541,
+            2148544204, 2939041880, 3129382548, 1056296727, 1366626816, 264359013,  4122968290,
+            4277274394, 2505315854, 1473453106, 1493379721, 2437980506, 2679918744, 1117268960,
+            737350320,  426755021,  3767690118, 3288602888, 776356504,  3940866607, 4094636832,
+            1826751786, 3691211537, 681430125,  3677642982, 368203500,  3905975303, 3282179467,
+            1389642365, 137765097,  205669159,  1246244008, 190905788,  1300084160, 4231139128,
+            2136901346, 3726585276, 4195486416, 1811825608, 180789070,  2925990476, 2825279205,
+            4178449435, 3705651371, 1431745864, 1496694248, 4095386885, 2873097573, 4172917961,
+            1422614014, 745568314,  626407464,  1722312711, 3687237788, 4177655052, 1672395630,
+            1474977924, 2024003370, 1587943520, 734137916,  4180764607, 2163513338, 1364967574,
+            26295413,   236399864,  1330756991, 501480170,  1536139245, 2143738607, 375152635,
+            1167857634, 3209084532, 1734174521, 4163316777, 1141610533, 2611713002, 2879568649,
+            2064468840, 2896499380, 1577510171, 3602219173, 1086036574, 3798886620, 1747562651,
+            3425534332, 3538133264, 100081443,  2249267062, 3175464274, 3079090238, 534181866,
+            922058770,  2746781145, 354960801,  4119178891, 3687458877, 791773347,  2706864496,
+            1324737541, 2176704433, 2320954546, 5919830,    2869219459, 3769675693, 2507270250,
+            599611442,  1212200694, 850096640,  761362267,  2772549355, 2299276186, 992825286,
+            485094874,  3454745046, 51662720,   3222197639, 141783746,  2021374139, 3685472695,
+            908740719,  191019609,  2975375176, 1041779163, 3421729684, 4071712904, 1687041846,
+            2634355887, 19987553,   2224110105, 3248345453, 397128304,  3569820105, 1578508239,
+            3864052997, 430438360,  3117458239, 1451121206, 1684023254, 1341331776, 299140843,
+            2275672733, 3607591301, 1286144129, 1770357812, 122428569,  1700141846, 3645464284,
+            219076830,  1948506152, 3632774842, 728438630,  1454525397, 87546731,   2355940736,
+            955919338,  3491185541, 3088025223, 3515473498, 3344528250, 3132909725, 2587987541,
+            2148544204, 42072155,   3129382548, 1056296727, 1366626816, 264359013,  968091393,
+            4277274394, 2505315854, 1473453106, 1493379721, 782895604,  2679918744, 1117268960,
+            737350320,  426755021,  2470129671, 3288602888, 776356504,  3940866607, 4094636832,
+            2997418676, 3691211537, 681430125,  3677642982, 368203500,  2871942212, 3282179467,
+            1389642365, 137765097,  205669159,  4034462685, 190905788,  1300084160, 4231139128,
+            2136901346, 1290436652, 4195486416, 1811825608, 180789070,  2925990476, 297573148,
+            4178449435, 3705651371, 1431745864, 1496694248, 2639025266, 2873097573, 4172917961,
+            1422614014, 745568314,  79109127,   1722312711, 3687237788, 4177655052, 1672395630,
+            2275889686, 2024003370, 1587943520, 734137916,  4180764607, 2972478083, 1364967574,
+            26295413,   236399864,  1330756991, 2993537559, 1536139245, 2143738607, 375152635,
+            1167857634, 1642767614, 1734174521, 4163316777, 1141610533, 2611713002, 2305297588,
+            2064468840, 2896499380, 1577510171, 3602219173, 1186432020, 3798886620, 1747562651,
+            3425534332, 3538133264, 1520224863, 2249267062, 3175464274, 3079090238, 534181866,
+            896278173,  2746781145, 354960801,  4119178891, 3687458877, 498216399,  2706864496,
+            1324737541, 2176704433, 2320954546, 4079805360, 2869219459, 3769675693, 2507270250,
+            599611442,  3565226256, 850096640,  761362267,  2772549355, 2299276186, 2677346627,
+            485094874,  3454745046, 51662720,   3222197639, 3382050713, 2021374139, 3685472695,
+            908740719,  191019609,  3206529094, 1041779163, 3421729684, 4071712904, 1687041846,
+            1975653907, 19987553,   2224110105, 3248345453, 397128304,  3947867411, 1578508239,
+            3864052997, 430438360,  3117458239, 506184138,  1684023254, 1341331776, 299140843,
+            2275672733, 1246007175, 1286144129, 1770357812, 122428569,  1700141846, 1380627604,
+            219076830,  1948506152, 3632774842, 728438630,  741325400,  87546731,   2355940736,
+            955919338,  3491185541, 2009749241, 3515473498, 3344528250, 3132909725, 2587987541,
+            4179239555, 42072155,   3129382548, 1056296727, 1366626816, 662663329,  968091393,
+            4277274394, 2505315854, 1473453106, 2940801673, 782895604,  2679918744, 1117268960,
+            737350320,  3213008622, 2470129671, 3288602888, 776356504,  3940866607, 597265031,
+            2997418676, 3691211537, 681430125,  3677642982, 2831320482, 2871942212, 3282179467,
+            1389642365, 137765097,  4291409976, 4034462685, 190905788,  1300084160, 4231139128,
+            3405363480, 1290436652, 4195486416, 1811825608, 180789070,  961743232,  297573148,
+            4178449435, 3705651371, 1431745864, 867684235,  724340402,  908628085,  3495044652,
+            731336315,  533182385,  242923162,  3289197721, 1267997709, 3459795401, 2087259359,
+            1502664222, 1816646231, 1344831982, 663720651,  2837975898, 4231166412, 3124945345,
+            1993761181, 3485629662, 2245465419, 3057378210, 516102800,  2936944041, 3572161329,
+            352984364,  2900357636, 1415575560, 2091753672, 2825963801, 2724104407, 1299501923,
+            1657359321, 1550130457, 610114359,  3828744213, 388716699,  3439705129, 3070439867,
+            919619595,  2172728574, 4084688607, 3456890326, 1840820579, 3872838873, 3628026838,
+            2682088757, 3503650025, 2430005748, 746499283,  1715623680, 1420874706, 2450080884,
+            641622837,  204950771,  3047873690, 943754350,  305085705,  1308555468, 3635126672,
+            678074494,  3144516735, 519502311,  1021924740, 2425892921, 1921923198, 3970995205,
+            1428930748, 1227748268, 779177576,  792766749,  1743711958, 4207067972, 2880761975,
+            3377822914, 2126951236, 2171298276, 3210832488, 2404662,    4718070,    1199969553,
+            2536509336, 259971896,  154196822,  3860818601, 28032312,   2775753059, 3521972934,
+            1682502212, 2506942884, 2168174674, 3847722281, 2329799300, 1422640346, 4085576599,
+            1085412070, 1196631,    1958127818, 4073858120, 3278424297, 2775846042, 2575182017,
+            2195667575, 783442066,  2364909599, 1335275848, 713667690,  1408580999, 3900959800,
+            3982348261, 2051534001, 199907451,  2447718174, 3063656870, 1551155495, 182771510,
+            940435996,  4024502454, 922153016,  2725850983, 1849725135, 380619368,  3629023949,
+            2059433527, 1883932242, 1227931514, 2085311110, 924458047,  1025771575, 3781073659,
+            107471411,  1267118399, 3760715202, 1347622940, 4034372738, 3421706153, 3580697329,
+            1670475290, 2860126280, 1845615997, 1603283462, 4149391268, 1551692768, 2682185323,
+            3440026646, 2587033461, 1710966605, 2508342416, 2665658668, 3550416108, 4066627042,
+            949646586,  1953559766, 2388852230, 3852254670, 1023903711, 72650335,   367531331,
+            3974496600, 809091571,
+        },
+        {
+            3898543996, 2820326151, 508984056,  1811380232, 2575122829, 3312252805, 2042188925,
+            1179040147, 3178087090, 1036069016, 1570288953, 1782997963, 344033901,  2207875501,
+            3397607511, 3894573496, 895696444,  3476485714, 3797207671, 3650733277, 615288917,
+            529426410,  3084830076, 293134372,  2680198166, 1582553704, 1373464858, 1096483795,
+            137074234,  3169221077, 2501637659, 4245610741, 1601776304, 1826737387, 4022114705,
+            264177565,  1366123729, 3512759221, 2281861834, 3147419387, 627670942,  2049953496,
+            3255760125, 400467793,  1170479900, 2259831273, 2009033772, 3941385336, 1026808486,
+            333983192,  1781172437, 459155096,  914553421,  1893062994, 3413458444, 2097095460,
+            3238618488, 1091108748, 2098326941, 1291055438, 2544661919, 2996380186, 457739153,
+            2186358034, 292230842,  1928339997, 3701816468, 1381193964, 1964619182, 300877834,
+            1705084821, 1857481749, 3898971738, 3740991612, 2478637670, 1487014672, 1654419030,
+            3450825349, 954604696,  1823850320, 3418106572, 891972614,  2233051783, 3379308913,
+            871444187,  3954674166, 2639897869, 2576833983, 827869133,  1344670781, 439516359,
+            2603741940, 2299090612, 3336535111, 1725290487, 542464954,  2579099280, 1604935449,
+            1296324274, 2626415400, 3536774318, 593525328,  1041216242, 483480735,  703570574,
+            2975327326, 188532903,  4101678645, 2845813762, 320187296,  1133696108, 2408436461,
+            1141345699, 4190845541, 1391648557, 398380496,  3302178853, 1157091535, 763245038,
+            3009474393, 3093591241, 3155076516, 1781339018, 951842519,  3984845282, 1687982595,
+            4194229660, 3247982982, 1008216260, 2516718333, 3519578986, 1799012094, 1883984293,
+            468296295,  3976349701, 967196106,  807921759,  2082814973, 1407268567, 1575157591,
+            55510511,   769623278,  63085015,   3776242315, 3933068123, 1746181131, 2925585932,
+            3348750637, 1893416063, 4234370085, 2433057365, 3932882861, 3476692249, 3227750549,
+            3397205226, 2185294417, 1056669477, 1521499394, 150514593,  163711988,  921650857,
+            3898543996, 2820326151, 508984056,  1811380232, 1030973101, 3312252805, 2042188925,
+            1179040147, 3178087090, 3939308152, 1570288953, 1782997963, 344033901,  2207875501,
+            3299483501, 3894573496, 895696444,  3476485714, 3797207671, 2698713048, 615288917,
+            529426410,  3084830076, 293134372,  400214446,  1582553704, 1373464858, 1096483795,
+            137074234,  4199937106, 2501637659, 4245610741, 1601776304, 1826737387, 3202131468,
+            264177565,  1366123729, 3512759221, 2281861834, 500812380,  627670942,  2049953496,
+            3255760125, 400467793,  2300250461, 2259831273, 2009033772, 3941385336, 1026808486,
+            1910253533, 1781172437, 459155096,  914553421,  1893062994, 2152006654, 2097095460,
+            3238618488, 1091108748, 2098326941, 1904618805, 2544661919, 2996380186, 457739153,
+            2186358034, 3662224335, 1928339997, 3701816468, 1381193964, 1964619182, 2116341613,
+            1705084821, 1857481749, 3898971738, 3740991612, 1584564170, 1487014672, 1654419030,
+            3450825349, 954604696,  3808994834, 3418106572, 891972614,  2233051783, 3379308913,
+            621985152,  3954674166, 2639897869, 2576833983, 827869133,  1351187370, 439516359,
+            2603741940, 2299090612, 3336535111, 3478319597, 542464954,  2579099280, 1604935449,
+            1296324274, 1182317491, 3536774318, 593525328,  1041216242, 483480735,  3559272754,
+            2975327326, 188532903,  4101678645, 2845813762, 3684586506, 1133696108, 2408436461,
+            1141345699, 4190845541, 4178614692, 398380496,  3302178853, 1157091535, 763245038,
+            995562748,  3093591241, 3155076516, 1781339018, 951842519,  771040492,  1687982595,
+            4194229660, 3247982982, 1008216260, 896774130,  3519578986, 1799012094, 1883984293,
+            468296295,  358212885,  967196106,  807921759,  2082814973, 1407268567, 186911786,
+            55510511,   769623278,  63085015,   3776242315, 1722672248, 1746181131, 2925585932,
+            3348750637, 1893416063, 3380746875, 2433057365, 3932882861, 3476692249, 3227750549,
+            2920635990, 2185294417, 1056669477, 1521499394, 150514593,  1794977557, 921650857,
+            3898543996, 2820326151, 508984056,  2723485708, 1030973101, 3312252805, 2042188925,
+            1179040147, 2438278975, 3939308152, 1570288953, 1782997963, 344033901,  2442934614,
+            3299483501, 3894573496, 895696444,  3476485714, 1587429877, 2698713048, 615288917,
+            529426410,  3084830076, 989824569,  400214446,  1582553704, 1373464858, 1096483795,
+            1449242379, 4199937106, 2501637659, 4245610741, 1601776304, 924480721,  3202131468,
+            264177565,  1366123729, 3512759221, 1139712784, 500812380,  627670942,  2049953496,
+            3255760125, 3960316151, 2300250461, 2259831273, 2009033772, 3941385336, 494219524,
+            1910253533, 1781172437, 459155096,  914553421,  480544678,  2152006654, 2097095460,
+            3238618488, 1091108748, 476737217,  1904618805, 2544661919, 2996380186, 457739153,
+            29086823,   3662224335, 1928339997, 3701816468, 1381193964, 3215494653, 2116341613,
+            1705084821, 1857481749, 3898971738, 502200265,  1584564170, 1487014672, 1654419030,
+            3450825349, 152930135,  3808994834, 3418106572, 891972614,  2233051783, 3642870887,
+            621985152,  3954674166, 2639897869, 2576833983, 2439446718, 1351187370, 439516359,
+            2603741940, 2299090612, 1250618590, 3478319597, 542464954,  2579099280, 1604935449,
+            1423374691, 1182317491, 3536774318, 593525328,  1041216242, 3351830756, 3559272754,
+            2975327326, 188532903,  4101678645, 1172944616, 3684586506, 1133696108, 2408436461,
+            1141345699, 460343564,  4178614692, 398380496,  3302178853, 1157091535, 2365441500,
+            995562748,  3093591241, 3155076516, 1781339018, 2200979122, 771040492,  1687982595,
+            4194229660, 3247982982, 782518797,  896774130,  3519578986, 1799012094, 1883984293,
+            2247174072, 358212885,  967196106,  807921759,  2082814973, 1561402159, 186911786,
+            55510511,   769623278,  63085015,   1371866215, 1722672248, 1746181131, 2925585932,
+            3348750637, 1158875536, 3380746875, 2433057365, 3932882861, 3476692249, 1184799572,
+            2920635990, 2185294417, 1056669477, 1521499394, 394239825,  1794977557, 921650857,
+            3898543996, 2820326151, 2095178120, 2723485708, 1030973101, 3312252805, 2042188925,
+            1578700605, 2438278975, 3939308152, 1570288953, 1782997963, 3058596023, 2442934614,
+            3299483501, 3894573496, 895696444,  1066285757, 1587429877, 2698713048, 615288917,
+            529426410,  94773625,   989824569,  400214446,  1582553704, 1373464858, 3948897686,
+            1449242379, 4199937106, 2501637659, 4245610741, 1751028367, 924480721,  3202131468,
+            264177565,  1366123729, 3349390460, 1139712784, 500812380,  627670942,  2049953496,
+            1310346074, 3960316151, 2300250461, 2259831273, 2009033772, 2685528425, 494219524,
+            1910253533, 1781172437, 459155096,  1791112847, 480544678,  2152006654, 2097095460,
+            3238618488, 1716805662, 476737217,  1904618805, 2544661919, 2996380186, 813464181,
+            29086823,   3662224335, 1928339997, 3701816468, 793111953,  3215494653, 2116341613,
+            1705084821, 1857481749, 1687125825, 502200265,  1584564170, 1487014672, 1654419030,
+            1295778534, 152930135,  3808994834, 3418106572, 891972614,  2510630119, 3642870887,
+            621985152,  3954674166, 2639897869, 3018088789, 2439446718, 1351187370, 439516359,
+            2603741940, 4140317177, 1250618590, 3478319597, 542464954,  2579099280, 3528099303,
+            1423374691, 1182317491, 3536774318, 593525328,  906473549,  3351830756, 3559272754,
+            2975327326, 188532903,  339591005,  1172944616, 3684586506, 1133696108, 2408436461,
+            1354787655, 460343564,  4178614692, 398380496,  3302178853, 3271105762, 2365441500,
+            995562748,  3093591241, 3155076516, 2113468984, 2200979122, 771040492,  1687982595,
+            4194229660, 2043150219, 782518797,  896774130,  3519578986, 1799012094, 937226663,
+            2247174072, 358212885,  967196106,  807921759,  1092245651, 1561402159, 186911786,
+            55510511,   769623278,  2934498380, 1371866215, 1722672248, 1746181131, 2925585932,
+            1736382896, 1158875536, 3380746875, 2433057365, 3932882861, 2916925403, 1184799572,
+            2920635990, 2185294417, 1056669477, 3814766837, 1213907622, 2974438186, 1461849459,
+            4215647222, 1266318322, 1443674206, 3669830434, 3462352126, 2201331534, 851652495,
+            273285581,  1741744528, 4087243878, 2126403834, 4036988739, 446558552,  2411597877,
+            2690663868, 3145243132, 3158697218, 2481831577, 3498514672, 1144564217, 1888077631,
+            1637294628, 786729840,  697368945,  2282101813, 2685276047, 2089820543, 3872376674,
+            2122555278, 3501754789, 3275210975, 1548486316, 79681595,   3950267108, 4080707064,
+            3609334857, 270950694,  502589340,  879011537,  270401171,  2733617372, 1255508013,
+            1032457272, 3058554090, 1985726930, 3677007389, 1895859083, 3459119079, 1416553081,
+            2257895265, 1789826661, 816663576,  3637634574, 2794604816, 732411436,  4272761160,
+            3396412102, 1786700381, 966824478,  2543530449, 1755629737, 960876367,  1741322277,
+            1225593957, 734211622,  766817174,  524066053,  2268472474, 2737208005, 2249236945,
+            108438899,  2193530009, 1659316408, 225508546,  2851454016, 1850855642, 3327893637,
+            1337204354, 3753742074, 1754500327, 836900371,  1861471519, 796702759,  3095863692,
+            1955053485, 1590935632, 3075429390, 2612581282, 1527911545, 3855057719, 550008297,
+            2228669280, 1920541619, 4210542408, 2667997066, 1639067447, 3302210785, 2568230703,
+            1411818511, 2462953528, 861721818,  3559545311, 1322931660, 3910280097, 3252942347,
+            4021609189, 2668881657, 1372440421, 3999067364, 3745352217, 940781427,  6803754,
+            3255044133, 2862829871, 3739292423, 1824429864, 2408394281, 2581875267, 2157162372,
+            1935638604, 142918555,  2901916766, 1610651273, 4242007192, 2667638960, 3541284367,
+            3672350401, 4202208617, 3942593271, 2763813126, 3351643156, 2460201544, 1943474182,
+            2371017612, 2783005183, 263740677,  3566237832, 2508857371, 3365616436, 3284088606,
+            3236967153, 2970603759, 535245987,  1310863556, 680514748,  1083918519, 1499266083,
+            1042539923, 2066803715, 2998072952, 599225389,  3601355753, 2071260210, 1038776166,
+            2482972976, 297786209,
+        },
+        {
+            1680024716, 2112340059, 3387475367, 2080916186, 1431532386, 3907378472, 2636491350,
+            2176128529, 2236616671, 3736851460, 2604001339, 3893075234, 3495918635, 4116370522,
+            1384310379, 3660102574, 2030233939, 2759207091, 49347923,   97526506,   2566932710,
+            1566181275, 3127827248, 578401670,  1499229308, 2581732444, 279715551,  809690877,
+            1438444015, 878935323,  1495277039, 3417305339, 2858903785, 3074075088, 603749086,
+            2370669734, 391683868,  3933465331, 2884128106, 1478317876, 1864988335, 2925823809,
+            4133578805, 218104493,  368652174,  1998600344, 1109346044, 1716435313, 415435111,
+            91393686,   2536620737, 1440068573, 481874870,  142128108,  988825519,  2077118779,
+            2858045339, 4068162251, 115593872,  1364244587, 3550167006, 3728768059, 1772423685,
+            2504624145, 248732306,  1412607307, 4081166331, 154438218,  1652901877, 3932533490,
+            3142799969, 3154073676, 3112018078, 2757873595, 2364830126, 2855791484, 793851407,
+            507785167,  263713916,  4060700051, 3291978358, 1584226715, 2546417990, 450747961,
+            2951067700, 2706009093, 1788578194, 4030171132, 2610979903, 573420740,  4269115622,
+            2180305819, 2646894726, 716649335,  3875715683, 853428184,  2436760738, 4190071217,
+            2754423535, 540698101,  4082489821, 741976046,  267559495,  1591532642, 2500610323,
+            3203248679, 147312102,  2772368222, 1412987047, 2295185573, 1932341300, 898396308,
+            1837129999, 3113914292, 2613354524, 3141601915, 276087167,  1887389351, 757801450,
+            3752353732, 2745818074, 1442953464, 3802648347, 223728071,  2169947402, 1338125300,
+            3642174036, 2794462634, 2326349851, 862746036,  3577092599, 627103363,  552173564,
+            4142604459, 2310329406, 583522272,  189323282,  1217612313, 73550248,   2434692829,
+            2757269706, 2392210091, 3032922600, 3573904125, 2897178037, 2632631469, 3085332665,
+            3775619904, 2563291734, 1351375865, 4043427793, 1803743084, 3112116579, 522940594,
+            2690374983, 2613871529, 3810037031, 1765642390, 534554747,  1930852049, 2264349344,
+            1680024716, 2112340059, 3387475367, 2080916186, 75966494,   3907378472, 2636491350,
+            2176128529, 2236616671, 2372987046, 2604001339, 3893075234, 3495918635, 4116370522,
+            534929913,  3660102574, 2030233939, 2759207091, 49347923,   987575186,  2566932710,
+            1566181275, 3127827248, 578401670,  3731513754, 2581732444, 279715551,  809690877,
+            1438444015, 2185866850, 1495277039, 3417305339, 2858903785, 3074075088, 4198538376,
+            2370669734, 391683868,  3933465331, 2884128106, 1400216510, 1864988335, 2925823809,
+            4133578805, 218104493,  2798390374, 1998600344, 1109346044, 1716435313, 415435111,
+            1892535124, 2536620737, 1440068573, 481874870,  142128108,  329082740,  2077118779,
+            2858045339, 4068162251, 115593872,  2644000449, 3550167006, 3728768059, 1772423685,
+            2504624145, 2140118619, 1412607307, 4081166331, 154438218,  1652901877, 3804911318,
+            3142799969, 3154073676, 3112018078, 2757873595, 50297646,   2855791484, 793851407,
+            507785167,  263713916,  3324588195, 3291978358, 1584226715, 2546417990, 450747961,
+            3455625012, 2706009093, 1788578194, 4030171132, 2610979903, 3835380965, 4269115622,
+            2180305819, 2646894726, 716649335,  2607142354, 853428184,  2436760738, 4190071217,
+            2754423535, 456808691,  4082489821, 741976046,  267559495,  1591532642, 2722205042,
+            3203248679, 147312102,  2772368222, 1412987047, 1950543946, 1932341300, 898396308,
+            1837129999, 3113914292, 428616392,  3141601915, 276087167,  1887389351, 757801450,
+            963534966,  2745818074, 1442953464, 3802648347, 223728071,  229039300,  1338125300,
+            3642174036, 2794462634, 2326349851, 206115203,  3577092599, 627103363,  552173564,
+            4142604459, 1492461846, 583522272,  189323282,  1217612313, 73550248,   3552211807,
+            2757269706, 2392210091, 3032922600, 3573904125, 810640644,  2632631469, 3085332665,
+            3775619904, 2563291734, 922608790,  4043427793, 1803743084, 3112116579, 522940594,
+            1785093944, 2613871529, 3810037031, 1765642390, 534554747,  3528050076, 2264349344,
+            1680024716, 2112340059, 3387475367, 3295682653, 75966494,   3907378472, 2636491350,
+            2176128529, 3574915532, 2372987046, 2604001339, 3893075234, 3495918635, 1280296085,
+            534929913,  3660102574, 2030233939, 2759207091, 299776535,  987575186,  2566932710,
+            1566181275, 3127827248, 3874691533, 3731513754, 2581732444, 279715551,  809690877,
+            3100791084, 2185866850, 1495277039, 3417305339, 2858903785, 1310351481, 4198538376,
+            2370669734, 391683868,  3933465331, 2749085130, 1400216510, 1864988335, 2925823809,
+            4133578805, 3352814594, 2798390374, 1998600344, 1109346044, 1716435313, 1571752941,
+            1892535124, 2536620737, 1440068573, 481874870,  2485033697, 329082740,  2077118779,
+            2858045339, 4068162251, 3837440666, 2644000449, 3550167006, 3728768059, 1772423685,
+            1176559812, 2140118619, 1412607307, 4081166331, 154438218,  2902622972, 3804911318,
+            3142799969, 3154073676, 3112018078, 2403391233, 50297646,   2855791484, 793851407,
+            507785167,  2351826747, 3324588195, 3291978358, 1584226715, 2546417990, 746876926,
+            3455625012, 2706009093, 1788578194, 4030171132, 3779307353, 3835380965, 4269115622,
+            2180305819, 2646894726, 2602235234, 2607142354, 853428184,  2436760738, 4190071217,
+            2066757692, 456808691,  4082489821, 741976046,  267559495,  3001080633, 2722205042,
+            3203248679, 147312102,  2772368222, 89950260,   1950543946, 1932341300, 898396308,
+            1837129999, 947911286,  428616392,  3141601915, 276087167,  1887389351, 2583987247,
+            963534966,  2745818074, 1442953464, 3802648347, 4229124441, 229039300,  1338125300,
+            3642174036, 2794462634, 2472155633, 206115203,  3577092599, 627103363,  552173564,
+            2586882739, 1492461846, 583522272,  189323282,  1217612313, 3501549884, 3552211807,
+            2757269706, 2392210091, 3032922600, 740675778,  810640644,  2632631469, 3085332665,
+            3775619904, 3643289881, 922608790,  4043427793, 1803743084, 3112116579, 2213337398,
+            1785093944, 2613871529, 3810037031, 1765642390, 762472016,  3528050076, 2264349344,
+            1680024716, 2112340059, 1372272974, 3295682653, 75966494,   3907378472, 2636491350,
+            3117471955, 3574915532, 2372987046, 2604001339, 3893075234, 915576383,  1280296085,
+            534929913,  3660102574, 2030233939, 346368350,  299776535,  987575186,  2566932710,
+            1566181275, 3535223896, 3874691533, 3731513754, 2581732444, 279715551,  2456894951,
+            3100791084, 2185866850, 1495277039, 3417305339, 1618871086, 1310351481, 4198538376,
+            2370669734, 391683868,  2009676005, 2749085130, 1400216510, 1864988335, 2925823809,
+            58955107,   3352814594, 2798390374, 1998600344, 1109346044, 3273979614, 1571752941,
+            1892535124, 2536620737, 1440068573, 1174168447, 2485033697, 329082740,  2077118779,
+            2858045339, 4062921629, 3837440666, 2644000449, 3550167006, 3728768059, 2642133401,
+            1176559812, 2140118619, 1412607307, 4081166331, 3124905304, 2902622972, 3804911318,
+            3142799969, 3154073676, 1449454613, 2403391233, 50297646,   2855791484, 793851407,
+            3514201526, 2351826747, 3324588195, 3291978358, 1584226715, 3636681672, 746876926,
+            3455625012, 2706009093, 1788578194, 3451519459, 3779307353, 3835380965, 4269115622,
+            2180305819, 3987989524, 2602235234, 2607142354, 853428184,  2436760738, 2151617107,
+            2066757692, 456808691,  4082489821, 741976046,  3590081269, 3001080633, 2722205042,
+            3203248679, 147312102,  3432947806, 89950260,   1950543946, 1932341300, 898396308,
+            3828432864, 947911286,  428616392,  3141601915, 276087167,  2517666433, 2583987247,
+            963534966,  2745818074, 1442953464, 2223986807, 4229124441, 229039300,  1338125300,
+            3642174036, 1053796945, 2472155633, 206115203,  3577092599, 627103363,  1113276084,
+            2586882739, 1492461846, 583522272,  189323282,  1490604990, 3501549884, 3552211807,
+            2757269706, 2392210091, 3545407532, 740675778,  810640644,  2632631469, 3085332665,
+            755862267,  3643289881, 922608790,  4043427793, 1803743084, 1954166630, 2213337398,
+            1785093944, 2613871529, 3810037031, 3042935707, 3162182177, 2791346436, 1901925289,
+            863100941,  3367519168, 1972623238, 3664303070, 604922059,  3026817982, 1436412310,
+            4096180631, 1597561857, 4206212303, 4127914332, 3228677359, 3985733659, 3597290113,
+            4251197894, 3451370603, 609679338,  3360835257, 1372239885, 638572328,  3806422284,
+            3974147336, 1804280837, 4209089291, 2021797469, 3557188838, 409727186,  2114649178,
+            687702120,  2542445992, 1235991799, 460479179,  2008348175, 887884478,  3942327811,
+            2999928223, 4171339789, 2286339235, 1293442231, 1575942850, 76122475,   1440527701,
+            2006558403, 1544148172, 895899367,  681826913,  4094701935, 3995413790, 1027509154,
+            2264990896, 1938238113, 213430250,  222469320,  609726517,  3581538106, 492802663,
+            120480843,  1720004062, 1132674507, 911082758,  2909148131, 566658805,  3964114445,
+            3483602509, 1793438750, 165562604,  3641830063, 2394205521, 3404874822, 1672998096,
+            916151953,  1141264477, 3171661340, 3803396219, 3018337382, 1863902683, 2474641928,
+            3250365071, 3897886220, 1219701051, 51332576,   1358614881, 1707407492, 3670647816,
+            923357625,  343687395,  3991339686, 3913575403, 1267727936, 4001357856, 3820224848,
+            2942896724, 3505936742, 1403285299, 1992762049, 567748449,  2202721585, 2781324216,
+            1724850068, 2408314541, 3073975813, 3992810029, 2475242354, 540562053,  2185198943,
+            3759352041, 3373885614, 1132999410, 1097554565, 4089342358, 3239542922, 2451748646,
+            407290679,  3188103200, 1708016248, 26848241,   2796711130, 3090711568, 4068389322,
+            3420916085, 3137567033, 2877819818, 22133454,   4629160,    3703695249, 1920151708,
+            1175452162, 130015299,  3331834713, 1099225384, 689254331,  1851083761, 2654970209,
+            3259297936, 3742819314, 3524284766, 2291819083, 3494031861, 16242889,   3545082774,
+            1997878108, 777447699,  4244916543, 3508640253, 3782278393, 2107258964, 2139074576,
+            1383217899, 2337934322, 3181899620, 1285955765, 2989610020, 3326862146, 1168587380,
+            801203532,  3020809957,
+        },
+        {
+            2859391699, 1506057581, 3779966678, 4017633553, 4136175884, 1906811522, 3552363453,
+            2358480413, 3479843361, 3006486813, 1371258925, 1523200725, 1314976498, 1918909917,
+            184559039,  526944947,  51599604,   2590128290, 3859153567, 1229958997, 1093748198,
+            2292980386, 3417280471, 1641818935, 3486478475, 2046542719, 3540468877, 1789270530,
+            3287519861, 1594350417, 97643727,   3887592863, 1451418044, 973577905,  3949410645,
+            1894545416, 4025745715, 3724281567, 452599509,  3278413963, 3337361666, 2953361601,
+            1801752284, 3360178089, 2036988182, 3724732545, 1835504929, 896229075,  722947532,
+            2055274773, 3083962764, 2154779680, 1759335911, 3755843203, 4134158090, 2652478083,
+            3268533680, 3236495926, 2131291885, 1239018516, 1608663542, 699144136,  2424728003,
+            633351440,  3803567586, 3653328325, 2959334871, 4037113029, 3109266623, 1296426676,
+            1102353852, 1302822256, 3962901645, 2993615371, 4192939549, 2358475264, 3780044083,
+            1370555151, 447596429,  4279664477, 399105749,  3317853163, 2432021252, 1094626868,
+            1553539969, 4274697606, 1426180682, 3712612661, 130535075,  3171116944, 2439635634,
+            3574745608, 1242558159, 3633034130, 668779306,  656225266,  3663623571, 3087568735,
+            3544110384, 43021564,   3929697719, 2638504137, 3640266946, 1456657631, 3690612575,
+            2738965895, 816578529,  1688889274, 4209409915, 1732748232, 1395641641, 3232934579,
+            2485015442, 3305733792, 4260308625, 125168600,  1367299447, 4243794070, 2747632087,
+            4176332707, 220655743,  303063274,  1204598015, 1884425934, 829857774,  2827114738,
+            1774116999, 2198132888, 2763273604, 3581985089, 3536170169, 2255741214, 2712853577,
+            1685991833, 201272692,  491948690,  4239714153, 1473219711, 3081803209, 2132300363,
+            471872598,  423025016,  1802059654, 1739175776, 4096173116, 2642068586, 2931562405,
+            718501977,  2823538048, 2952767662, 3412249698, 4049324316, 3449642097, 549530560,
+            4284223839, 3040323616, 352196668,  2833296345, 4253176000, 2763658853, 1210548425,
+            2859391699, 1506057581, 3779966678, 4017633553, 2903678767, 1906811522, 3552363453,
+            2358480413, 3479843361, 1003771608, 1371258925, 1523200725, 1314976498, 1918909917,
+            2642857965, 526944947,  51599604,   2590128290, 3859153567, 3203642629, 1093748198,
+            2292980386, 3417280471, 1641818935, 2130331685, 2046542719, 3540468877, 1789270530,
+            3287519861, 3932960293, 97643727,   3887592863, 1451418044, 973577905,  618197602,
+            1894545416, 4025745715, 3724281567, 452599509,  383048913,  3337361666, 2953361601,
+            1801752284, 3360178089, 1283584825, 3724732545, 1835504929, 896229075,  722947532,
+            2521314796, 3083962764, 2154779680, 1759335911, 3755843203, 1472481670, 2652478083,
+            3268533680, 3236495926, 2131291885, 2708556327, 1608663542, 699144136,  2424728003,
+            633351440,  3870711947, 3653328325, 2959334871, 4037113029, 3109266623, 3822251906,
+            1102353852, 1302822256, 3962901645, 2993615371, 924560042,  2358475264, 3780044083,
+            1370555151, 447596429,  83511363,   399105749,  3317853163, 2432021252, 1094626868,
+            2605077505, 4274697606, 1426180682, 3712612661, 130535075,  3901055136, 2439635634,
+            3574745608, 1242558159, 3633034130, 1298625274, 656225266,  3663623571, 3087568735,
+            3544110384, 1288662592, 3929697719, 2638504137, 3640266946, 1456657631, 341303636,
+            2738965895, 816578529,  1688889274, 4209409915, 753538265,  1395641641, 3232934579,
+            2485015442, 3305733792, 686486117,  125168600,  1367299447, 4243794070, 2747632087,
+            4241480789, 220655743,  303063274,  1204598015, 1884425934, 3728874665, 2827114738,
+            1774116999, 2198132888, 2763273604, 3541566428, 3536170169, 2255741214, 2712853577,
+            1685991833, 3201692685, 491948690,  4239714153, 1473219711, 3081803209, 2258992186,
+            471872598,  423025016,  1802059654, 1739175776, 1731544034, 2642068586, 2931562405,
+            718501977,  2823538048, 2489451204, 3412249698, 4049324316, 3449642097, 549530560,
+            2859403139, 3040323616, 352196668,  2833296345, 4253176000, 192642587,  1210548425,
+            2859391699, 1506057581, 3779966678, 1640774191, 2903678767, 1906811522, 3552363453,
+            2358480413, 1583491758, 1003771608, 1371258925, 1523200725, 1314976498, 1582776329,
+            2642857965, 526944947,  51599604,   2590128290, 3227610218, 3203642629, 1093748198,
+            2292980386, 3417280471, 21179633,   2130331685, 2046542719, 3540468877, 1789270530,
+            55301686,   3932960293, 97643727,   3887592863, 1451418044, 3325148231, 618197602,
+            1894545416, 4025745715, 3724281567, 3285605564, 383048913,  3337361666, 2953361601,
+            1801752284, 889646715,  1283584825, 3724732545, 1835504929, 896229075,  3728501082,
+            2521314796, 3083962764, 2154779680, 1759335911, 1943602292, 1472481670, 2652478083,
+            3268533680, 3236495926, 1991470209, 2708556327, 1608663542, 699144136,  2424728003,
+            4276483704, 3870711947, 3653328325, 2959334871, 4037113029, 1865725890, 3822251906,
+            1102353852, 1302822256, 3962901645, 4080412018, 924560042,  2358475264, 3780044083,
+            1370555151, 2448633621, 83511363,   399105749,  3317853163, 2432021252, 79736919,
+            2605077505, 4274697606, 1426180682, 3712612661, 3626101276, 3901055136, 2439635634,
+            3574745608, 1242558159, 1267235729, 1298625274, 656225266,  3663623571, 3087568735,
+            11293475,   1288662592, 3929697719, 2638504137, 3640266946, 1524740684, 341303636,
+            2738965895, 816578529,  1688889274, 210590375,  753538265,  1395641641, 3232934579,
+            2485015442, 2791656115, 686486117,  125168600,  1367299447, 4243794070, 4176514918,
+            4241480789, 220655743,  303063274,  1204598015, 250550981,  3728874665, 2827114738,
+            1774116999, 2198132888, 1561938517, 3541566428, 3536170169, 2255741214, 2712853577,
+            2740416087, 3201692685, 491948690,  4239714153, 1473219711, 3091106984, 2258992186,
+            471872598,  423025016,  1802059654, 3509500332, 1731544034, 2642068586, 2931562405,
+            718501977,  369547750,  2489451204, 3412249698, 4049324316, 3449642097, 2454362963,
+            2859403139, 3040323616, 352196668,  2833296345, 452966987,  192642587,  1210548425,
+            2859391699, 1506057581, 701768938,  1640774191, 2903678767, 1906811522, 3552363453,
+            1968420494, 1583491758, 1003771608, 1371258925, 1523200725, 3043302807, 1582776329,
+            2642857965, 526944947,  51599604,   2674388630, 3227610218, 3203642629, 1093748198,
+            2292980386, 2891606075, 21179633,   2130331685, 2046542719, 3540468877, 1386107028,
+            55301686,   3932960293, 97643727,   3887592863, 1358534202, 3325148231, 618197602,
+            1894545416, 4025745715, 1592030409, 3285605564, 383048913,  3337361666, 2953361601,
+            2923664306, 889646715,  1283584825, 3724732545, 1835504929, 1211197284, 3728501082,
+            2521314796, 3083962764, 2154779680, 495189160,  1943602292, 1472481670, 2652478083,
+            3268533680, 411513547,  1991470209, 2708556327, 1608663542, 699144136,  836615399,
+            4276483704, 3870711947, 3653328325, 2959334871, 555356636,  1865725890, 3822251906,
+            1102353852, 1302822256, 2093005829, 4080412018, 924560042,  2358475264, 3780044083,
+            111575697,  2448633621, 83511363,   399105749,  3317853163, 2467272558, 79736919,
+            2605077505, 4274697606, 1426180682, 1368024420, 3626101276, 3901055136, 2439635634,
+            3574745608, 2609676015, 1267235729, 1298625274, 656225266,  3663623571, 1780491102,
+            11293475,   1288662592, 3929697719, 2638504137, 4152895540, 1524740684, 341303636,
+            2738965895, 816578529,  1000017241, 210590375,  753538265,  1395641641, 3232934579,
+            1961631244, 2791656115, 686486117,  125168600,  1367299447, 3922174441, 4176514918,
+            4241480789, 220655743,  303063274,  3931815889, 250550981,  3728874665, 2827114738,
+            1774116999, 863448974,  1561938517, 3541566428, 3536170169, 2255741214, 3866150397,
+            2740416087, 3201692685, 491948690,  4239714153, 2161649288, 3091106984, 2258992186,
+            471872598,  423025016,  785487568,  3509500332, 1731544034, 2642068586, 2931562405,
+            521316835,  369547750,  2489451204, 3412249698, 4049324316, 2380106966, 2454362963,
+            2859403139, 3040323616, 352196668,  3190724694, 1126617194, 3749295179, 3695296395,
+            3894497337, 3890873659, 2724947644, 805408090,  717796999,  4146560348, 878102150,
+            788064417,  4285251451, 2583424922, 3245566967, 928540990,  2178264197, 1651751863,
+            1685242665, 2869455031, 3891786359, 2535725626, 1260358409, 2651731297, 1765727288,
+            1817528173, 4087796169, 3084625138, 2890426713, 3287980770, 1878890665, 2414968180,
+            1564739129, 154354752,  104404172,  65591340,   3186710331, 2609362803, 3490849069,
+            4228335127, 4021552859, 475725145,  1809976173, 3053563071, 2036320796, 866778783,
+            1161714122, 1701414286, 373895364,  1970196855, 2995959113, 3523128699, 3189470300,
+            182172739,  404863706,  4007663917, 3762773007, 1867342908, 1559830322, 716657194,
+            2903150411, 3027151496, 3409410819, 162693025,  1495208118, 3637785831, 357642815,
+            1067533939, 3173321010, 2051932441, 727547734,  2983833725, 579403251,  2771095317,
+            2687422893, 321173898,  4241701959, 1685074568, 3898070939, 374136506,  31659784,
+            166378762,  1676955269, 256847585,  847603971,  4233673279, 3558179380, 1681010634,
+            514479598,  664831525,  3147751159, 4234541644, 1685167460, 1152502532, 768869925,
+            2469870024, 1804938173, 3141291961, 1921544993, 3182802603, 246360211,  4226669722,
+            1749100583, 704878903,  4013460613, 3141709669, 3035045289, 3789434405, 3351275085,
+            1792677322, 376521183,  1077251380, 3359979200, 4161548179, 3084489606, 1663986842,
+            2602639253, 2228440674, 3894474360, 3641313261, 2674054999, 2466293662, 244178768,
+            788625413,  2042728256, 4163738360, 265847232,  843688252,  240860672,  599568005,
+            1843380658, 2231230803, 480447882,  486175036,  2300354603, 2363714819, 3113687876,
+            1142508159, 912202317,  1307652963, 3852849440, 1702754216, 3712187136, 1541801786,
+            1204171628, 498050281,  863908409,  3796929429, 2238040183, 404687901,  3663007599,
+            3309807244, 3544285034, 1193508270, 2353115596, 3540300730, 1591295852, 3432227903,
+            1727833020, 3553299356,
+        },
+        {
+            3504507731, 2482944380, 4177282305, 782754504,  3753538429, 3388840090, 1482871740,
+            2243273882, 1955322741, 2315407806, 3636218795, 2282551307, 2055834774, 3435531045,
+            3648800396, 1386543530, 2844849383, 214348778,  811170106,  218839239,  2030263278,
+            1962753876, 356277705,  1764221370, 3373296481, 2625117822, 4289325494, 3304317530,
+            2495207113, 988455532,  1695189829, 3246052611, 3208973402, 602473723,  930489035,
+            1537170091, 3078031686, 292166356,  3638595021, 541308229,  3579514177, 514112763,
+            3991059303, 2070415779, 1470224062, 2794971291, 1335883333, 3848352394, 872656078,
+            2983541660, 72036949,   1136227595, 876830526,  1976745202, 676643442,  2167374913,
+            1080866636, 1233863560, 750497160,  2751726210, 3163159486, 2119315331, 2051287204,
+            3780174214, 391251431,  280532602,  1036569514, 312930962,  2593864419, 2686260515,
+            3673373946, 1902526738, 2586720547, 2564222403, 2081324974, 903669208,  2244140439,
+            2597151623, 1829980620, 1016474338, 1265839029, 994941968,  2123879398, 782514837,
+            3901295187, 1782381552, 1677307903, 3708096602, 48727618,   3414643555, 4251834053,
+            1567737363, 720780479,  1141217034, 3072940618, 2060709335, 2783828267, 3138833869,
+            2686855442, 880455487,  3649133868, 342760187,  1724993318, 3725325942, 2885717951,
+            1264652465, 3579811937, 3272022052, 1136195608, 3227490940, 1082640534, 3518905301,
+            853949433,  3141297746, 2453645931, 2551764388, 3998366827, 1757184749, 1730223227,
+            3741341144, 3979088779, 440500218,  1888133112, 1986234595, 3849688022, 983075599,
+            1193718045, 2889637558, 2563742967, 1199977147, 1347510839, 2862696097, 1959178279,
+            3293180936, 2557458890, 1572196998, 1145273253, 1619378436, 2969978344, 1291084511,
+            1426173557, 982863977,  1491226496, 3515969758, 584810861,  4155273493, 350784018,
+            1376668821, 920566099,  1004404467, 2863391380, 3961268977, 549053225,  2922623597,
+            2422537051, 2387256855, 3653934045, 2346578665, 118229850,  1917997650, 198473404,
+            3504507731, 2482944380, 4177282305, 782754504,  1905258334, 3388840090, 1482871740,
+            2243273882, 1955322741, 1600983315, 3636218795, 2282551307, 2055834774, 3435531045,
+            325435811,  1386543530, 2844849383, 214348778,  811170106,  3627414494, 2030263278,
+            1962753876, 356277705,  1764221370, 1331863574, 2625117822, 4289325494, 3304317530,
+            2495207113, 509757952,  1695189829, 3246052611, 3208973402, 602473723,  3900211978,
+            1537170091, 3078031686, 292166356,  3638595021, 1835072540, 3579514177, 514112763,
+            3991059303, 2070415779, 1457720205, 2794971291, 1335883333, 3848352394, 872656078,
+            3434535210, 72036949,   1136227595, 876830526,  1976745202, 845528568,  2167374913,
+            1080866636, 1233863560, 750497160,  1302104473, 3163159486, 2119315331, 2051287204,
+            3780174214, 1810445247, 280532602,  1036569514, 312930962,  2593864419, 745647708,
+            3673373946, 1902526738, 2586720547, 2564222403, 2866352413, 903669208,  2244140439,
+            2597151623, 1829980620, 484624066,  1265839029, 994941968,  2123879398, 782514837,
+            2188164915, 1782381552, 1677307903, 3708096602, 48727618,   3197060565, 4251834053,
+            1567737363, 720780479,  1141217034, 1745983286, 2060709335, 2783828267, 3138833869,
+            2686855442, 2811230086, 3649133868, 342760187,  1724993318, 3725325942, 1970918479,
+            1264652465, 3579811937, 3272022052, 1136195608, 2714716780, 1082640534, 3518905301,
+            853949433,  3141297746, 2658357652, 2551764388, 3998366827, 1757184749, 1730223227,
+            1138934780, 3979088779, 440500218,  1888133112, 1986234595, 1054454767, 983075599,
+            1193718045, 2889637558, 2563742967, 182400664,  1347510839, 2862696097, 1959178279,
+            3293180936, 2247211300, 1572196998, 1145273253, 1619378436, 2969978344, 1258885182,
+            1426173557, 982863977,  1491226496, 3515969758, 719345770,  4155273493, 350784018,
+            1376668821, 920566099,  2430803415, 2863391380, 3961268977, 549053225,  2922623597,
+            3478985909, 2387256855, 3653934045, 2346578665, 118229850,  960216518,  198473404,
+            3504507731, 2482944380, 4177282305, 2015989329, 1905258334, 3388840090, 1482871740,
+            2243273882, 3298231444, 1600983315, 3636218795, 2282551307, 2055834774, 2358230250,
+            325435811,  1386543530, 2844849383, 214348778,  499443243,  3627414494, 2030263278,
+            1962753876, 356277705,  3290782017, 1331863574, 2625117822, 4289325494, 3304317530,
+            3762619801, 509757952,  1695189829, 3246052611, 3208973402, 2437672300, 3900211978,
+            1537170091, 3078031686, 292166356,  891970853,  1835072540, 3579514177, 514112763,
+            3991059303, 2833913776, 1457720205, 2794971291, 1335883333, 3848352394, 3478123311,
+            3434535210, 72036949,   1136227595, 876830526,  2301647701, 845528568,  2167374913,
+            1080866636, 1233863560, 292041293,  1302104473, 3163159486, 2119315331, 2051287204,
+            2996076787, 1810445247, 280532602,  1036569514, 312930962,  2146709952, 745647708,
+            3673373946, 1902526738, 2586720547, 4094061345, 2866352413, 903669208,  2244140439,
+            2597151623, 1974353300, 484624066,  1265839029, 994941968,  2123879398, 3367944480,
+            2188164915, 1782381552, 1677307903, 3708096602, 1441995177, 3197060565, 4251834053,
+            1567737363, 720780479,  3036050769, 1745983286, 2060709335, 2783828267, 3138833869,
+            1513606122, 2811230086, 3649133868, 342760187,  1724993318, 1935835578, 1970918479,
+            1264652465, 3579811937, 3272022052, 2971697547, 2714716780, 1082640534, 3518905301,
+            853949433,  1701389911, 2658357652, 2551764388, 3998366827, 1757184749, 3358816756,
+            1138934780, 3979088779, 440500218,  1888133112, 1114736307, 1054454767, 983075599,
+            1193718045, 2889637558, 2312525764, 182400664,  1347510839, 2862696097, 1959178279,
+            2476871557, 2247211300, 1572196998, 1145273253, 1619378436, 39561463,   1258885182,
+            1426173557, 982863977,  1491226496, 4242193090, 719345770,  4155273493, 350784018,
+            1376668821, 2841280783, 2430803415, 2863391380, 3961268977, 549053225,  3646014078,
+            3478985909, 2387256855, 3653934045, 2346578665, 4031400841, 960216518,  198473404,
+            3504507731, 2482944380, 4098345431, 2015989329, 1905258334, 3388840090, 1482871740,
+            667643932,  3298231444, 1600983315, 3636218795, 2282551307, 272192476,  2358230250,
+            325435811,  1386543530, 2844849383, 3516179548, 499443243,  3627414494, 2030263278,
+            1962753876, 2567133690, 3290782017, 1331863574, 2625117822, 4289325494, 745231315,
+            3762619801, 509757952,  1695189829, 3246052611, 1501168167, 2437672300, 3900211978,
+            1537170091, 3078031686, 174304464,  891970853,  1835072540, 3579514177, 514112763,
+            4066825531, 2833913776, 1457720205, 2794971291, 1335883333, 910783657,  3478123311,
+            3434535210, 72036949,   1136227595, 3369100901, 2301647701, 845528568,  2167374913,
+            1080866636, 2161831588, 292041293,  1302104473, 3163159486, 2119315331, 1092118367,
+            2996076787, 1810445247, 280532602,  1036569514, 1166375257, 2146709952, 745647708,
+            3673373946, 1902526738, 847138432,  4094061345, 2866352413, 903669208,  2244140439,
+            2348890045, 1974353300, 484624066,  1265839029, 994941968,  2857260393, 3367944480,
+            2188164915, 1782381552, 1677307903, 2140277648, 1441995177, 3197060565, 4251834053,
+            1567737363, 4293175357, 3036050769, 1745983286, 2060709335, 2783828267, 3666992713,
+            1513606122, 2811230086, 3649133868, 342760187,  840521667,  1935835578, 1970918479,
+            1264652465, 3579811937, 1175589103, 2971697547, 2714716780, 1082640534, 3518905301,
+            3882082280, 1701389911, 2658357652, 2551764388, 3998366827, 1371889127, 3358816756,
+            1138934780, 3979088779, 440500218,  2699698827, 1114736307, 1054454767, 983075599,
+            1193718045, 3921593661, 2312525764, 182400664,  1347510839, 2862696097, 720004646,
+            2476871557, 2247211300, 1572196998, 1145273253, 2662506732, 39561463,   1258885182,
+            1426173557, 982863977,  105392305,  4242193090, 719345770,  4155273493, 350784018,
+            3380457930, 2841280783, 2430803415, 2863391380, 3961268977, 2636312655, 3646014078,
+            3478985909, 2387256855, 3653934045, 3164871365, 3520481125, 1333035706, 4148888739,
+            76936472,   794469305,  690618980,  1641242738, 686913502,  233229116,  2000187397,
+            2896144126, 358136583,  2733844064, 726041254,  1825190258, 787115881,  4147729130,
+            2754941841, 1597536525, 2637698601, 2811852825, 3018584229, 591166184,  1849085024,
+            4063717386, 818998343,  950925554,  3974767736, 3952770437, 4234979047, 2102401389,
+            3905326196, 1359605613, 2206099047, 1377373639, 1432125801, 1080656088, 2846462774,
+            3256787781, 3946170988, 162950807,  1222801811, 873065830,  1493945777, 1541725623,
+            3428339188, 2602925212, 2601011075, 365029374,  2908220505, 1976799360, 2813143321,
+            3078423119, 3003392657, 1581223561, 2222910685, 28872932,   807955160,  1564274380,
+            3906996267, 1954443809, 294349033,  3092852118, 4229017330, 1708803448, 4288095960,
+            1456353426, 677265638,  3299325643, 4006414448, 489769654,  3697734268, 3281547,
+            4194133450, 311493681,  217458540,  66406340,   3963289685, 1232268529, 474256558,
+            1956456581, 3830369510, 4173428954, 3357597376, 3679782143, 466458297,  360268747,
+            4232142935, 4064729968, 3061398431, 3198388490, 4028976811, 591154107,  2436023046,
+            739864029,  4211411849, 1159157388, 2425686396, 682876352,  3839396758, 3850230263,
+            7172862,    2073202095, 2495521439, 1792460591, 3322549330, 1800707247, 1681604823,
+            1897191103, 2001254661, 460709384,  1838563525, 1331912312, 3799280123, 687394409,
+            182724692,  3180579014, 3270850923, 1207000789, 3677654056, 3207028963, 3698329815,
+            917336604,  968345758,  2663744702, 3728476487, 2048264247, 1582204633, 1421306045,
+            707753954,  3351453510, 2201638097, 3985702677, 1230445993, 3313449429, 3525232325,
+            3776290873, 488419866,  4128036654, 903262508,  2875462080, 2839525687, 3795233033,
+            3073836924, 3759386482, 3864758211, 444677377,  811689323,  3352106110, 72527257,
+            3442416723, 1685429596, 4103504011, 1581081119, 1032558902, 2695457145, 2046339847,
+            3064313778, 955191717,
+        },
+        {
+            3960151235, 2927059282, 1953782535, 1747213715, 4001665960, 3093480895, 120342159,
+            4049699942, 3146137339, 3455866547, 389592550,  117023923,  2975708308, 2558290680,
+            1315331041, 3535013914, 123579397,  999070381,  3608575909, 3446325639, 33082285,
+            122771150,  3679750292, 605514820,  1708672928, 3981120809, 3437729620, 1718554639,
+            1947607898, 3397849389, 3334751518, 1690616691, 129595866,  2517132217, 1083929393,
+            2750637990, 2248230482, 3456769073, 1499935494, 2157032890, 546389702,  3874854712,
+            247758774,  386296337,  1982862002, 2100964103, 3524981518, 3096533832, 1785567921,
+            714666485,  2106199459, 4249536546, 4013401658, 3563583916, 2578199495, 1840846988,
+            126201394,  1383506229, 461689539,  1021743142, 4002251740, 3128741379, 3244971423,
+            2843706487, 574787520,  589285230,  1928072824, 307339479,  4268306222, 2361426654,
+            1948204852, 3310893673, 1030437771, 1719305389, 1885515715, 3119209159, 1990507886,
+            3796241541, 3320800595, 3600047205, 2396822621, 2538280614, 1678538020, 1312888782,
+            2264565984, 4062011835, 1839146130, 3498964448, 2521763509, 1683232053, 1582882113,
+            2916951642, 1219006655, 1716265792, 3177565306, 3656234863, 4191990171, 1006462525,
+            1985262878, 2982177802, 2660549446, 2154852305, 2663706427, 2891212972, 690084811,
+            1452364713, 1806879568, 3978913725, 194576690,  2375902031, 3197776749, 1288995022,
+            159300267,  2794839120, 4152061531, 2700453394, 3373952632, 3603163668, 1501005575,
+            3347146671, 3577235812, 753373989,  2289120269, 2922214466, 385831624,  4079595392,
+            185058167,  4283297904, 3378857598, 3019581912, 2940999442, 1573315346, 1989795963,
+            2863705997, 312025338,  3255224780, 549208707,  1959448243, 2722153959, 2089395704,
+            1010259439, 2006303317, 1394453065, 274665521,  1997648476, 888071015,  3384488831,
+            3962265406, 3436403047, 1178502852, 2388784070, 2204565822, 3931115703, 2211011437,
+            4016570592, 2251479575, 665012247,  1957209038, 4134412193, 2101868528, 3484467809,
+            3960151235, 2927059282, 1953782535, 1747213715, 2640271221, 3093480895, 120342159,
+            4049699942, 3146137339, 4087569721, 389592550,  117023923,  2975708308, 2558290680,
+            3781073549, 3535013914, 123579397,  999070381,  3608575909, 3434683877, 33082285,
+            122771150,  3679750292, 605514820,  2290981796, 3981120809, 3437729620, 1718554639,
+            1947607898, 1905701898, 3334751518, 1690616691, 129595866,  2517132217, 928439151,
+            2750637990, 2248230482, 3456769073, 1499935494, 205496510,  546389702,  3874854712,
+            247758774,  386296337,  2192978703, 2100964103, 3524981518, 3096533832, 1785567921,
+            121834676,  2106199459, 4249536546, 4013401658, 3563583916, 2726023619, 1840846988,
+            126201394,  1383506229, 461689539,  3305359822, 4002251740, 3128741379, 3244971423,
+            2843706487, 2772895936, 589285230,  1928072824, 307339479,  4268306222, 651801480,
+            1948204852, 3310893673, 1030437771, 1719305389, 919173800,  3119209159, 1990507886,
+            3796241541, 3320800595, 3497545160, 2396822621, 2538280614, 1678538020, 1312888782,
+            2760340330, 4062011835, 1839146130, 3498964448, 2521763509, 3149160120, 1582882113,
+            2916951642, 1219006655, 1716265792, 3002553200, 3656234863, 4191990171, 1006462525,
+            1985262878, 858202289,  2660549446, 2154852305, 2663706427, 2891212972, 289204828,
+            1452364713, 1806879568, 3978913725, 194576690,  3750608286, 3197776749, 1288995022,
+            159300267,  2794839120, 113797877,  2700453394, 3373952632, 3603163668, 1501005575,
+            4107212920, 3577235812, 753373989,  2289120269, 2922214466, 2231892392, 4079595392,
+            185058167,  4283297904, 3378857598, 3243097572, 2940999442, 1573315346, 1989795963,
+            2863705997, 2338687022, 3255224780, 549208707,  1959448243, 2722153959, 3884495836,
+            1010259439, 2006303317, 1394453065, 274665521,  822779755,  888071015,  3384488831,
+            3962265406, 3436403047, 1072287990, 2388784070, 2204565822, 3931115703, 2211011437,
+            2244650956, 2251479575, 665012247,  1957209038, 4134412193, 4094640869, 3484467809,
+            3960151235, 2927059282, 1953782535, 4129432438, 2640271221, 3093480895, 120342159,
+            4049699942, 273127215,  4087569721, 389592550,  117023923,  2975708308, 1022513418,
+            3781073549, 3535013914, 123579397,  999070381,  4161215594, 3434683877, 33082285,
+            122771150,  3679750292, 624247081,  2290981796, 3981120809, 3437729620, 1718554639,
+            1260938324, 1905701898, 3334751518, 1690616691, 129595866,  3902571854, 928439151,
+            2750637990, 2248230482, 3456769073, 1134177841, 205496510,  546389702,  3874854712,
+            247758774,  948342547,  2192978703, 2100964103, 3524981518, 3096533832, 1395475778,
+            121834676,  2106199459, 4249536546, 4013401658, 772440189,  2726023619, 1840846988,
+            126201394,  1383506229, 3994367327, 3305359822, 4002251740, 3128741379, 3244971423,
+            2670417068, 2772895936, 589285230,  1928072824, 307339479,  1669438359, 651801480,
+            1948204852, 3310893673, 1030437771, 17225213,   919173800,  3119209159, 1990507886,
+            3796241541, 3791131949, 3497545160, 2396822621, 2538280614, 1678538020, 938923670,
+            2760340330, 4062011835, 1839146130, 3498964448, 2095286958, 3149160120, 1582882113,
+            2916951642, 1219006655, 2373402689, 3002553200, 3656234863, 4191990171, 1006462525,
+            1560814926, 858202289,  2660549446, 2154852305, 2663706427, 377314363,  289204828,
+            1452364713, 1806879568, 3978913725, 3758075851, 3750608286, 3197776749, 1288995022,
+            159300267,  1308119102, 113797877,  2700453394, 3373952632, 3603163668, 2130968686,
+            4107212920, 3577235812, 753373989,  2289120269, 2554467741, 2231892392, 4079595392,
+            185058167,  4283297904, 1891478781, 3243097572, 2940999442, 1573315346, 1989795963,
+            2709710415, 2338687022, 3255224780, 549208707,  1959448243, 3948935093, 3884495836,
+            1010259439, 2006303317, 1394453065, 2175758521, 822779755,  888071015,  3384488831,
+            3962265406, 1349320583, 1072287990, 2388784070, 2204565822, 3931115703, 1392849745,
+            2244650956, 2251479575, 665012247,  1957209038, 283724009,  4094640869, 3484467809,
+            3960151235, 2927059282, 1698029971, 4129432438, 2640271221, 3093480895, 120342159,
+            1609457316, 273127215,  4087569721, 389592550,  117023923,  4182910090, 1022513418,
+            3781073549, 3535013914, 123579397,  2035936071, 4161215594, 3434683877, 33082285,
+            122771150,  3843414027, 624247081,  2290981796, 3981120809, 3437729620, 495739795,
+            1260938324, 1905701898, 3334751518, 1690616691, 536289876,  3902571854, 928439151,
+            2750637990, 2248230482, 2833280413, 1134177841, 205496510,  546389702,  3874854712,
+            4174777047, 948342547,  2192978703, 2100964103, 3524981518, 1470554912, 1395475778,
+            121834676,  2106199459, 4249536546, 3501576219, 772440189,  2726023619, 1840846988,
+            126201394,  1553107845, 3994367327, 3305359822, 4002251740, 3128741379, 937178500,
+            2670417068, 2772895936, 589285230,  1928072824, 3067733031, 1669438359, 651801480,
+            1948204852, 3310893673, 2289663390, 17225213,   919173800,  3119209159, 1990507886,
+            1682091085, 3791131949, 3497545160, 2396822621, 2538280614, 701839783,  938923670,
+            2760340330, 4062011835, 1839146130, 323940950,  2095286958, 3149160120, 1582882113,
+            2916951642, 4151857559, 2373402689, 3002553200, 3656234863, 4191990171, 3336053688,
+            1560814926, 858202289,  2660549446, 2154852305, 280859574,  377314363,  289204828,
+            1452364713, 1806879568, 2894171651, 3758075851, 3750608286, 3197776749, 1288995022,
+            1653139322, 1308119102, 113797877,  2700453394, 3373952632, 3788586016, 2130968686,
+            4107212920, 3577235812, 753373989,  4242223140, 2554467741, 2231892392, 4079595392,
+            185058167,  1114893062, 1891478781, 3243097572, 2940999442, 1573315346, 4148290901,
+            2709710415, 2338687022, 3255224780, 549208707,  977074768,  3948935093, 3884495836,
+            1010259439, 2006303317, 2011630476, 2175758521, 822779755,  888071015,  3384488831,
+            4144130003, 1349320583, 1072287990, 2388784070, 2204565822, 3555624838, 1392849745,
+            2244650956, 2251479575, 665012247,  2720267599, 290275423,  2128506076, 2161825596,
+            1862764197, 206871581,  1698241368, 385495375,  1851671700, 282084248,  192469650,
+            2488835902, 2910588852, 2745307687, 3093816171, 2750816115, 1366388909, 1562654943,
+            54581870,   1487432198, 2743596537, 2610720358, 833911169,  64376154,   3253865766,
+            207120086,  2246117729, 3858440878, 3337405107, 468365857,  3234732808, 694355877,
+            4252844202, 217924778,  2590811737, 198527828,  816257400,  3208280124, 2304555122,
+            281519508,  1094873304, 1378814861, 4275775806, 3286010833, 2245762343, 1823258556,
+            1160735462, 2879028153, 810378683,  1671312609, 4095835966, 2671125339, 2148970506,
+            1347790829, 3540517053, 612724856,  1728177162, 19929889,   979925568,  2434479505,
+            3146585800, 4016966786, 825754193,  1721116720, 1216049274, 3512063885, 3593707084,
+            425798925,  787053149,  1936790507, 1018281797, 1275975187, 3607108435, 4275546867,
+            2528223969, 2469479529, 1211858774, 2569253026, 3335149405, 1624933256, 141660623,
+            809712524,  2460869551, 3227573142, 2188983341, 817527877,  1350166509, 2463063952,
+            2122821336, 1794954874, 3328544113, 4169946839, 252576296,  477706022,  4209272261,
+            1400063649, 3491633673, 1763745111, 536579602,  2735454843, 1550845454, 1125567758,
+            2192930289, 3435494374, 2926496434, 1226220047, 4114640619, 1221558818, 3865450777,
+            2280613582, 765929968,  2338446929, 2831379382, 3099955106, 463358077,  1947536703,
+            877250335,  3291234357, 1696432902, 26718000,   3653167288, 2628492721, 2102865574,
+            4232016402, 3140013158, 2901106514, 2884808946, 3214242151, 924331134,  4172396580,
+            172456354,  4233959980, 3482016138, 499250354,  2657297290, 584330586,  3181238036,
+            2818156998, 3296692772, 1800425448, 2764327209, 2667099001, 1973896396, 2452616976,
+            2920850175, 4223852420, 2351289352, 227189937,  1015036890, 141482173,  3026815112,
+            1131147099, 319230172,  753844266,  2727293932, 1745362715, 3152451741, 3907234764,
+            1831406592, 3944470039,
+        },
+        {
+            933490479,  3313125146, 2945930915, 542702775,  3130541830, 368308568,  3300121037,
+            140923563,  1808225350, 675755439,  2664595689, 3804947896, 66087696,   3985381451,
+            1558686487, 3666416555, 3379695889, 220246018,  1672881009, 2892069150, 2510439884,
+            971925663,  1215662923, 2970012114, 594984746,  381749398,  4126927079, 3157981459,
+            600499293,  3135598818, 2890711024, 929922151,  1712326103, 943907415,  1675320624,
+            766232204,  1242772053, 742014665,  1335204104, 912281589,  1579210154, 1494775520,
+            48716808,   706192311,  554455417,  2354910751, 710935413,  3770093716, 2618571729,
+            1851928820, 974014776,  2544194101, 3827992215, 2080193937, 3067172658, 133705061,
+            1985507145, 4188841492, 1179470883, 3292594785, 3799701864, 1785609515, 1626741985,
+            2417986600, 2577828889, 2103802149, 3862233680, 2045555174, 3756889459, 3525687273,
+            3359828116, 1128334880, 4279898765, 3365073678, 3741890898, 3962233804, 1542976376,
+            1431279211, 889316331,  499902334,  142639181,  3020615902, 3786584874, 3959096841,
+            1471001814, 444005693,  2336687155, 1884580597, 2787582476, 3568988824, 726629321,
+            1555382645, 561967149,  517653649,  1158334950, 3067524150, 2615156777, 1056114710,
+            650390650,  4099106961, 1344359578, 2114055012, 525298544,  860422162,  1403313066,
+            3780107277, 3244928128, 1200762180, 786579282,  3137931875, 288597876,  4079398129,
+            4197847995, 2627528953, 3177628578, 1092891102, 1112988009, 2385639207, 3840109460,
+            1063115781, 2399314881, 3683866831, 585408824,  3084332398, 3670131980, 2513502155,
+            2472149522, 782346683,  2044193079, 3443480823, 2754845916, 1562587631, 58946750,
+            530224335,  143978470,  624320750,  3451936383, 610538090,  3587449239, 942698445,
+            1547999527, 4066958832, 2717053960, 2448272087, 329221939,  4136759320, 3355157104,
+            804791891,  1255329234, 4259135027, 1903478128, 2014593283, 3117585574, 4082044186,
+            2245579365, 827758187,  357189974,  4045139244, 1791392939, 3206246257, 2723246950,
+            933490479,  3313125146, 2945930915, 542702775,  1145300473, 368308568,  3300121037,
+            140923563,  1808225350, 746067834,  2664595689, 3804947896, 66087696,   3985381451,
+            1128517870, 3666416555, 3379695889, 220246018,  1672881009, 2872762634, 2510439884,
+            971925663,  1215662923, 2970012114, 2087121873, 381749398,  4126927079, 3157981459,
+            600499293,  2435083611, 2890711024, 929922151,  1712326103, 943907415,  1713175926,
+            766232204,  1242772053, 742014665,  1335204104, 3035035938, 1579210154, 1494775520,
+            48716808,   706192311,  3638171625, 2354910751, 710935413,  3770093716, 2618571729,
+            666602987,  974014776,  2544194101, 3827992215, 2080193937, 1312422541, 133705061,
+            1985507145, 4188841492, 1179470883, 106286374,  3799701864, 1785609515, 1626741985,
+            2417986600, 2375400568, 2103802149, 3862233680, 2045555174, 3756889459, 1846971205,
+            3359828116, 1128334880, 4279898765, 3365073678, 3969283286, 3962233804, 1542976376,
+            1431279211, 889316331,  18574084,   142639181,  3020615902, 3786584874, 3959096841,
+            209987162,  444005693,  2336687155, 1884580597, 2787582476, 3178649166, 726629321,
+            1555382645, 561967149,  517653649,  2007367326, 3067524150, 2615156777, 1056114710,
+            650390650,  4028867061, 1344359578, 2114055012, 525298544,  860422162,  3989503987,
+            3780107277, 3244928128, 1200762180, 786579282,  2255518878, 288597876,  4079398129,
+            4197847995, 2627528953, 2784599308, 1092891102, 1112988009, 2385639207, 3840109460,
+            3223947367, 2399314881, 3683866831, 585408824,  3084332398, 526068544,  2513502155,
+            2472149522, 782346683,  2044193079, 2226209337, 2754845916, 1562587631, 58946750,
+            530224335,  3213006637, 624320750,  3451936383, 610538090,  3587449239, 2739588261,
+            1547999527, 4066958832, 2717053960, 2448272087, 3353816627, 4136759320, 3355157104,
+            804791891,  1255329234, 4266569275, 1903478128, 2014593283, 3117585574, 4082044186,
+            3967062994, 827758187,  357189974,  4045139244, 1791392939, 616060239,  2723246950,
+            933490479,  3313125146, 2945930915, 1332038051, 1145300473, 368308568,  3300121037,
+            140923563,  2511885556, 746067834,  2664595689, 3804947896, 66087696,   1980317332,
+            1128517870, 3666416555, 3379695889, 220246018,  4000878201, 2872762634, 2510439884,
+            971925663,  1215662923, 4133354120, 2087121873, 381749398,  4126927079, 3157981459,
+            292243391,  2435083611, 2890711024, 929922151,  1712326103, 3006681689, 1713175926,
+            766232204,  1242772053, 742014665,  3456364219, 3035035938, 1579210154, 1494775520,
+            48716808,   609753091,  3638171625, 2354910751, 710935413,  3770093716, 1545748034,
+            666602987,  974014776,  2544194101, 3827992215, 3602145649, 1312422541, 133705061,
+            1985507145, 4188841492, 1147157356, 106286374,  3799701864, 1785609515, 1626741985,
+            3752675260, 2375400568, 2103802149, 3862233680, 2045555174, 2603373505, 1846971205,
+            3359828116, 1128334880, 4279898765, 370622143,  3969283286, 3962233804, 1542976376,
+            1431279211, 204166996,  18574084,   142639181,  3020615902, 3786584874, 2484528249,
+            209987162,  444005693,  2336687155, 1884580597, 533456943,  3178649166, 726629321,
+            1555382645, 561967149,  1113881605, 2007367326, 3067524150, 2615156777, 1056114710,
+            1606394648, 4028867061, 1344359578, 2114055012, 525298544,  217251176,  3989503987,
+            3780107277, 3244928128, 1200762180, 1459132888, 2255518878, 288597876,  4079398129,
+            4197847995, 1620854868, 2784599308, 1092891102, 1112988009, 2385639207, 1948295741,
+            3223947367, 2399314881, 3683866831, 585408824,  1988430831, 526068544,  2513502155,
+            2472149522, 782346683,  448235353,  2226209337, 2754845916, 1562587631, 58946750,
+            3185138268, 3213006637, 624320750,  3451936383, 610538090,  3510634555, 2739588261,
+            1547999527, 4066958832, 2717053960, 2715837145, 3353816627, 4136759320, 3355157104,
+            804791891,  1536141167, 4266569275, 1903478128, 2014593283, 3117585574, 1639076913,
+            3967062994, 827758187,  357189974,  4045139244, 3694506809, 616060239,  2723246950,
+            933490479,  3313125146, 2827380925, 1332038051, 1145300473, 368308568,  3300121037,
+            2624177120, 2511885556, 746067834,  2664595689, 3804947896, 1049488043, 1980317332,
+            1128517870, 3666416555, 3379695889, 2216940208, 4000878201, 2872762634, 2510439884,
+            971925663,  239365839,  4133354120, 2087121873, 381749398,  4126927079, 3612034133,
+            292243391,  2435083611, 2890711024, 929922151,  2616513455, 3006681689, 1713175926,
+            766232204,  1242772053, 1384815328, 3456364219, 3035035938, 1579210154, 1494775520,
+            799283929,  609753091,  3638171625, 2354910751, 710935413,  3392684583, 1545748034,
+            666602987,  974014776,  2544194101, 2279084188, 3602145649, 1312422541, 133705061,
+            1985507145, 3058135623, 1147157356, 106286374,  3799701864, 1785609515, 1161163240,
+            3752675260, 2375400568, 2103802149, 3862233680, 1614030006, 2603373505, 1846971205,
+            3359828116, 1128334880, 1940452033, 370622143,  3969283286, 3962233804, 1542976376,
+            3287376549, 204166996,  18574084,   142639181,  3020615902, 4224982082, 2484528249,
+            209987162,  444005693,  2336687155, 1912032864, 533456943,  3178649166, 726629321,
+            1555382645, 3342806318, 1113881605, 2007367326, 3067524150, 2615156777, 2857995866,
+            1606394648, 4028867061, 1344359578, 2114055012, 2790012367, 217251176,  3989503987,
+            3780107277, 3244928128, 3733656941, 1459132888, 2255518878, 288597876,  4079398129,
+            2259492957, 1620854868, 2784599308, 1092891102, 1112988009, 4291653838, 1948295741,
+            3223947367, 2399314881, 3683866831, 2901697017, 1988430831, 526068544,  2513502155,
+            2472149522, 2945726643, 448235353,  2226209337, 2754845916, 1562587631, 3659083222,
+            3185138268, 3213006637, 624320750,  3451936383, 630682079,  3510634555, 2739588261,
+            1547999527, 4066958832, 2759190315, 2715837145, 3353816627, 4136759320, 3355157104,
+            4288173763, 1536141167, 4266569275, 1903478128, 2014593283, 3216774546, 1639076913,
+            3967062994, 827758187,  357189974,  605356478,  4153231248, 711495261,  745228380,
+            3341106470, 3782166180, 1478103347, 170947306,  2532511578, 2598647660, 635215721,
+            1350321048, 1643587244, 3199482613, 121720609,  40648139,   4229660203, 2888024656,
+            1489753828, 62340729,   263058711,  4183661698, 2756883815, 3706559061, 3222886153,
+            301154090,  491727482,  3632306249, 434424174,  28120602,   3922272017, 2754818496,
+            4080732963, 656930109,  3810713213, 3237652811, 640778991,  3081487450, 2180381494,
+            4112032074, 1926478629, 3010963356, 3548761656, 2304149648, 749764857,  49839007,
+            865224891,  3171066614, 243849186,  3518666855, 2595318404, 1180925276, 1161335621,
+            1749652656, 1905095368, 2101344267, 581702892,  1346552346, 1497799920, 181740510,
+            2469299801, 2935064351, 3996499850, 4224114115, 549029700,  516827645,  2865295950,
+            1800430333, 1399806362, 922954381,  384456191,  1601818715, 181045790,  600485696,
+            1263873754, 3628858491, 2757408647, 1195222119, 1416335947, 2107267250, 2342023937,
+            77857785,   329690991,  956662767,  3118014778, 4046662235, 506844943,  3047851807,
+            420022834,  3179367942, 698851602,  3466529156, 1192668699, 2698864910, 3286411776,
+            263829821,  4117769567, 4290790138, 3319474485, 2964946423, 1288507997, 455736258,
+            733497220,  2287739544, 3524940605, 349364502,  1065989225, 2686954359, 3204364553,
+            80987396,   2530207478, 2520928176, 1522372955, 1215346887, 114113167,  1039579468,
+            1221858208, 1304335697, 3283411188, 2223998671, 4257048517, 1865293662, 1405601001,
+            174538047,  3215336426, 2367119536, 2472338038, 4078169485, 1533190144, 3196000053,
+            3724983339, 2584168243, 2495436034, 1603151164, 1248929244, 4086270641, 1710673573,
+            737405097,  102717413,  1563659448, 1834879061, 1221163402, 2575921585, 985906452,
+            1720132659, 2998919999, 382338068,  3073009357, 1892501758, 2254223590, 3952460715,
+            336434536,  1333932551, 2982976572, 3233306956, 1281386946, 4091313232, 2456692833,
+            2115681203, 1330392536,
+        },
+        {
+            3429025920, 2832109917, 4230329402, 3962337018, 712408009,  3287671588, 2123574311,
+            3087438119, 2472305889, 1393952304, 4056725489, 1300054241, 623918789,  1304585441,
+            3002305846, 4164023800, 618597094,  1404519643, 3309818796, 875326495,  2351053326,
+            1066297621, 624297474,  661972005,  838594091,  2660259550, 984506382,  1725543927,
+            3440320097, 1903882701, 3778833850, 2198002745, 3976045069, 3678210730, 2140280026,
+            3651907939, 1115386165, 3106338746, 4228431111, 1319813977, 728870104,  3158517811,
+            42276565,   2011853977, 4119728638, 2837307960, 3061059255, 865500623,  127335114,
+            3612093945, 2559568715, 3418167581, 2387543660, 2288940000, 3096536789, 2464385118,
+            4284994474, 892438402,  1033722952, 1469707266, 3395458648, 3038225050, 2613319757,
+            1541690272, 2163000811, 976192704,  4047504632, 3519727066, 3129850914, 845505666,
+            2286486977, 2110356138, 1280793634, 3283818900, 3269620238, 1018992101, 4054365504,
+            1538526594, 4112672849, 3395414414, 1627310242, 1308727661, 2999063827, 612793403,
+            4259543919, 2897779118, 1306467486, 2898611905, 3638137428, 2438822199, 2729554916,
+            4081190246, 2142942793, 3229717560, 2490527631, 3698645148, 2413099967, 3320894544,
+            1901305350, 479106306,  3239417622, 327879925,  2886281463, 3633834227, 801634374,
+            167276037,  4274480997, 1251716753, 1618455000, 3475448882, 3528089973, 1573542326,
+            161227427,  3197740269, 1803789219, 1373295185, 4140152524, 3391647403, 3479661752,
+            3862627885, 3799194436, 716154752,  410771350,  2047010469, 1504051582, 1377498209,
+            876263012,  1801559882, 3293120636, 673946966,  4211599477, 1443527439, 3234265614,
+            252148478,  3626924927, 59154202,   913622759,  2166411490, 2053669869, 3311341562,
+            1909155946, 3302984814, 1202183481, 1892675747, 3332975966, 1650381293, 1197092556,
+            3280946548, 3031131670, 1403640810, 351657991,  3905979374, 1479942685, 347773210,
+            2219120898, 1902666154, 950720243,  360656014,  1867926235, 2332646816, 3482380180,
+            3429025920, 2832109917, 4230329402, 3962337018, 2404392089, 3287671588, 2123574311,
+            3087438119, 2472305889, 3557742436, 4056725489, 1300054241, 623918789,  1304585441,
+            2965557012, 4164023800, 618597094,  1404519643, 3309818796, 3875472989, 2351053326,
+            1066297621, 624297474,  661972005,  3814088890, 2660259550, 984506382,  1725543927,
+            3440320097, 243842197,  3778833850, 2198002745, 3976045069, 3678210730, 669038562,
+            3651907939, 1115386165, 3106338746, 4228431111, 1157712347, 728870104,  3158517811,
+            42276565,   2011853977, 3051975787, 2837307960, 3061059255, 865500623,  127335114,
+            3177177411, 2559568715, 3418167581, 2387543660, 2288940000, 3203649618, 2464385118,
+            4284994474, 892438402,  1033722952, 694388065,  3395458648, 3038225050, 2613319757,
+            1541690272, 3577830912, 976192704,  4047504632, 3519727066, 3129850914, 316686791,
+            2286486977, 2110356138, 1280793634, 3283818900, 790258948,  1018992101, 4054365504,
+            1538526594, 4112672849, 2796250394, 1627310242, 1308727661, 2999063827, 612793403,
+            2594418302, 2897779118, 1306467486, 2898611905, 3638137428, 987884763,  2729554916,
+            4081190246, 2142942793, 3229717560, 3968039141, 3698645148, 2413099967, 3320894544,
+            1901305350, 4001062396, 3239417622, 327879925,  2886281463, 3633834227, 3041607634,
+            167276037,  4274480997, 1251716753, 1618455000, 3702169437, 3528089973, 1573542326,
+            161227427,  3197740269, 1569161411, 1373295185, 4140152524, 3391647403, 3479661752,
+            1733478708, 3799194436, 716154752,  410771350,  2047010469, 3038036434, 1377498209,
+            876263012,  1801559882, 3293120636, 3607657241, 4211599477, 1443527439, 3234265614,
+            252148478,  3336432484, 59154202,   913622759,  2166411490, 2053669869, 1956681571,
+            1909155946, 3302984814, 1202183481, 1892675747, 2048277189, 1650381293, 1197092556,
+            3280946548, 3031131670, 1587016586, 351657991,  3905979374, 1479942685, 347773210,
+            3235831348, 1902666154, 950720243,  360656014,  1867926235, 2498939946, 3482380180,
+            3429025920, 2832109917, 4230329402, 2027454999, 2404392089, 3287671588, 2123574311,
+            3087438119, 3739883482, 3557742436, 4056725489, 1300054241, 623918789,  3067060686,
+            2965557012, 4164023800, 618597094,  1404519643, 1059804366, 3875472989, 2351053326,
+            1066297621, 624297474,  1472796200, 3814088890, 2660259550, 984506382,  1725543927,
+            1181562225, 243842197,  3778833850, 2198002745, 3976045069, 2533415260, 669038562,
+            3651907939, 1115386165, 3106338746, 4139464506, 1157712347, 728870104,  3158517811,
+            42276565,   3380453654, 3051975787, 2837307960, 3061059255, 865500623,  1292635567,
+            3177177411, 2559568715, 3418167581, 2387543660, 951890477,  3203649618, 2464385118,
+            4284994474, 892438402,  4023765212, 694388065,  3395458648, 3038225050, 2613319757,
+            3901172128, 3577830912, 976192704,  4047504632, 3519727066, 4167853160, 316686791,
+            2286486977, 2110356138, 1280793634, 258504427,  790258948,  1018992101, 4054365504,
+            1538526594, 1961200288, 2796250394, 1627310242, 1308727661, 2999063827, 3115112956,
+            2594418302, 2897779118, 1306467486, 2898611905, 4238759859, 987884763,  2729554916,
+            4081190246, 2142942793, 2269643837, 3968039141, 3698645148, 2413099967, 3320894544,
+            3167334031, 4001062396, 3239417622, 327879925,  2886281463, 2881675923, 3041607634,
+            167276037,  4274480997, 1251716753, 3519991842, 3702169437, 3528089973, 1573542326,
+            161227427,  2970017918, 1569161411, 1373295185, 4140152524, 3391647403, 1332019262,
+            1733478708, 3799194436, 716154752,  410771350,  175363176,  3038036434, 1377498209,
+            876263012,  1801559882, 2562188906, 3607657241, 4211599477, 1443527439, 3234265614,
+            1247187153, 3336432484, 59154202,   913622759,  2166411490, 916839762,  1956681571,
+            1909155946, 3302984814, 1202183481, 929730535,  2048277189, 1650381293, 1197092556,
+            3280946548, 1360869467, 1587016586, 351657991,  3905979374, 1479942685, 475976169,
+            3235831348, 1902666154, 950720243,  360656014,  2469576590, 2498939946, 3482380180,
+            3429025920, 2832109917, 501490240,  2027454999, 2404392089, 3287671588, 2123574311,
+            3147028879, 3739883482, 3557742436, 4056725489, 1300054241, 3725256284, 3067060686,
+            2965557012, 4164023800, 618597094,  1299063451, 1059804366, 3875472989, 2351053326,
+            1066297621, 2383174252, 1472796200, 3814088890, 2660259550, 984506382,  4151002597,
+            1181562225, 243842197,  3778833850, 2198002745, 2420857403, 2533415260, 669038562,
+            3651907939, 1115386165, 3977646231, 4139464506, 1157712347, 728870104,  3158517811,
+            2179437365, 3380453654, 3051975787, 2837307960, 3061059255, 2283318809, 1292635567,
+            3177177411, 2559568715, 3418167581, 3704768608, 951890477,  3203649618, 2464385118,
+            4284994474, 4006843428, 4023765212, 694388065,  3395458648, 3038225050, 3670757863,
+            3901172128, 3577830912, 976192704,  4047504632, 2241810463, 4167853160, 316686791,
+            2286486977, 2110356138, 1935390258, 258504427,  790258948,  1018992101, 4054365504,
+            164099255,  1961200288, 2796250394, 1627310242, 1308727661, 273388049,  3115112956,
+            2594418302, 2897779118, 1306467486, 1963648430, 4238759859, 987884763,  2729554916,
+            4081190246, 3182717329, 2269643837, 3968039141, 3698645148, 2413099967, 1679066893,
+            3167334031, 4001062396, 3239417622, 327879925,  965183664,  2881675923, 3041607634,
+            167276037,  4274480997, 1614879164, 3519991842, 3702169437, 3528089973, 1573542326,
+            1066276379, 2970017918, 1569161411, 1373295185, 4140152524, 1825675671, 1332019262,
+            1733478708, 3799194436, 716154752,  3306512968, 175363176,  3038036434, 1377498209,
+            876263012,  2387339814, 2562188906, 3607657241, 4211599477, 1443527439, 1502810902,
+            1247187153, 3336432484, 59154202,   913622759,  2637388686, 916839762,  1956681571,
+            1909155946, 3302984814, 2351195168, 929730535,  2048277189, 1650381293, 1197092556,
+            277127787,  1360869467, 1587016586, 351657991,  3905979374, 2977250358, 475976169,
+            3235831348, 1902666154, 950720243,  2013076224, 4203804041, 3799365172, 1192579289,
+            1253910953, 3744696925, 112542131,  240763086,  1835215632, 3324141840, 2711660154,
+            3199455380, 2634392623, 1047866656, 2974656535, 1142126534, 1738955371, 1022080564,
+            2800802783, 4141420783, 509563143,  2350354327, 1794113913, 3251286512, 3172658573,
+            3294816686, 1882456938, 3966433095, 1756670244, 632587385,  2759896929, 4250690401,
+            2004770411, 2129932998, 3288224189, 4257205233, 3984739729, 718906111,  2820161224,
+            3061250639, 3743874059, 3654081056, 1304803028, 4042417779, 3296280079, 979021992,
+            3415728645, 1736982233, 3549461379, 2120799185, 2931263973, 3427731579, 117624888,
+            1547046593, 705055266,  2155273307, 1348154930, 2770414549, 3351606756, 1650761426,
+            3959174844, 1655856078, 4164327804, 536540324,  3269529048, 1881850264, 1700953546,
+            32583985,   82135658,   229447201,  3940560775, 2252461548, 3865788346, 4005539752,
+            3841394585, 218079753,  3452350410, 3692531299, 927097704,  965968733,  1738406230,
+            1968245358, 3467634873, 393834276,  3892458031, 3481529781, 2350146907, 3495241051,
+            862443659,  2683434218, 3913198196, 2554760766, 439669205,  2181148144, 1112633232,
+            2992815089, 515462978,  3293546511, 846034384,  2026921741, 453707663,  3474679927,
+            2138956423, 2676331945, 1286419096, 1406933759, 3857553916, 2039567278, 3061199,
+            3060099414, 74629604,   2127824984, 2731839742, 1658941828, 2747792733, 292521250,
+            1572789104, 446793018,  2529817153, 2715759736, 2953111797, 212804735,  243477202,
+            305999911,  4278349761, 2411072435, 935209153,  3438598579, 3216224924, 1374475973,
+            451399680,  231622788,  480214567,  325905836,  1845960385, 1935624265, 4128882228,
+            3522164664, 1724650600, 3563740658, 3497678109, 1296633491, 2079118273, 256656546,
+            2122788040, 2099069242, 4047054106, 3327372029, 3158675512, 3726328277, 2573365922,
+            2313605321, 3640387730, 2255231768, 2459564831, 3705005419, 1839257949, 1912473780,
+            2971719296, 3225990954,
+        },
+        {
+            3118623706, 952121321,  1331913096, 1945390758, 794566482,  1298719460, 1186448272,
+            2268124553, 2302154370, 1901833041, 416470292,  2367176740, 1303870147, 3873672096,
+            3759005396, 3515540852, 3805481341, 2255657528, 642900503,  947872915,  1960994380,
+            834408627,  2208701324, 3487371286, 1991618284, 3253094273, 3715532668, 3322199408,
+            2592449655, 3950191557, 3577151288, 3326706293, 1744559205, 3247953808, 505804013,
+            2964703022, 1543505759, 446584409,  3264542888, 1495013763, 2606216523, 2734142540,
+            3311973161, 391092901,  2909404940, 932054208,  2650348644, 1615514460, 1747208894,
+            338328946,  1751760773, 3131373651, 3950083993, 1494346527, 307598865,  4091386150,
+            3713359042, 3573523253, 2090505885, 190482883,  3015097174, 2022428548, 3414249630,
+            2320072104, 3645084022, 800051518,  1065441438, 1299783396, 1167166310, 2014613520,
+            3634326490, 1728162933, 2672901446, 2012589709, 2225112724, 126504126,  410229747,
+            2794313786, 2490373011, 4217046196, 4047282029, 400008710,  3679778779, 293114878,
+            846816558,  3451998899, 1032005024, 1413964364, 2387802253, 1524561415, 2347623535,
+            4161512353, 3268856355, 682660977,  986576696,  3835467297, 3742099178, 2969075008,
+            3770801234, 3197059780, 1242858873, 3206231363, 3071378482, 2432350880, 2481615232,
+            464594573,  244116481,  905186949,  2762581957, 514199390,  1542174738, 3966616708,
+            102122312,  1138866869, 73952140,   2689350222, 1089062633, 2735737875, 3493445888,
+            1721523519, 151732654,  202440007,  3944710858, 337969168,  3921749459, 1938828152,
+            1463260176, 3700446684, 762593003,  592824661,  3107494642, 1830290061, 3452661997,
+            1387868133, 1001874258, 1996805821, 4122653950, 1030153059, 490469576,  406416360,
+            3770487164, 587650428,  4086986523, 2244446263, 15992821,   4137100923, 1972066093,
+            427402272,  2829873021, 3878632912, 136252726,  2962530778, 3408426688, 3826849103,
+            3058358123, 1689329164, 2401537055, 1960367179, 2689717505, 1640623613, 733352463,
+            3118623706, 952121321,  1331913096, 1945390758, 768906987,  1298719460, 1186448272,
+            2268124553, 2302154370, 3764091866, 416470292,  2367176740, 1303870147, 3873672096,
+            557874650,  3515540852, 3805481341, 2255657528, 642900503,  813035207,  1960994380,
+            834408627,  2208701324, 3487371286, 1598672024, 3253094273, 3715532668, 3322199408,
+            2592449655, 1471058569, 3577151288, 3326706293, 1744559205, 3247953808, 3190913204,
+            2964703022, 1543505759, 446584409,  3264542888, 1371820307, 2606216523, 2734142540,
+            3311973161, 391092901,  2285151023, 932054208,  2650348644, 1615514460, 1747208894,
+            1583232546, 1751760773, 3131373651, 3950083993, 1494346527, 3139377053, 4091386150,
+            3713359042, 3573523253, 2090505885, 2395311709, 3015097174, 2022428548, 3414249630,
+            2320072104, 704041154,  800051518,  1065441438, 1299783396, 1167166310, 2952506105,
+            3634326490, 1728162933, 2672901446, 2012589709, 3542960142, 126504126,  410229747,
+            2794313786, 2490373011, 3670735168, 4047282029, 400008710,  3679778779, 293114878,
+            367482823,  3451998899, 1032005024, 1413964364, 2387802253, 1814384582, 2347623535,
+            4161512353, 3268856355, 682660977,  4069800125, 3835467297, 3742099178, 2969075008,
+            3770801234, 86081322,   1242858873, 3206231363, 3071378482, 2432350880, 2359673697,
+            464594573,  244116481,  905186949,  2762581957, 3966440070, 1542174738, 3966616708,
+            102122312,  1138866869, 1893683217, 2689350222, 1089062633, 2735737875, 3493445888,
+            3146769665, 151732654,  202440007,  3944710858, 337969168,  1595411042, 1938828152,
+            1463260176, 3700446684, 762593003,  851781553,  3107494642, 1830290061, 3452661997,
+            1387868133, 1531285802, 1996805821, 4122653950, 1030153059, 490469576,  2479618776,
+            3770487164, 587650428,  4086986523, 2244446263, 2589382281, 4137100923, 1972066093,
+            427402272,  2829873021, 231554319,  136252726,  2962530778, 3408426688, 3826849103,
+            1443091322, 1689329164, 2401537055, 1960367179, 2689717505, 2652455453, 733352463,
+            3118623706, 952121321,  1331913096, 603745780,  768906987,  1298719460, 1186448272,
+            2268124553, 3937557566, 3764091866, 416470292,  2367176740, 1303870147, 2616745681,
+            557874650,  3515540852, 3805481341, 2255657528, 3893051757, 813035207,  1960994380,
+            834408627,  2208701324, 273873713,  1598672024, 3253094273, 3715532668, 3322199408,
+            1600796374, 1471058569, 3577151288, 3326706293, 1744559205, 3928946918, 3190913204,
+            2964703022, 1543505759, 446584409,  2850240709, 1371820307, 2606216523, 2734142540,
+            3311973161, 83988455,   2285151023, 932054208,  2650348644, 1615514460, 64737474,
+            1583232546, 1751760773, 3131373651, 3950083993, 2181615136, 3139377053, 4091386150,
+            3713359042, 3573523253, 2319088791, 2395311709, 3015097174, 2022428548, 3414249630,
+            2440411288, 704041154,  800051518,  1065441438, 1299783396, 3320380897, 2952506105,
+            3634326490, 1728162933, 2672901446, 4107624454, 3542960142, 126504126,  410229747,
+            2794313786, 575509398,  3670735168, 4047282029, 400008710,  3679778779, 1850601062,
+            367482823,  3451998899, 1032005024, 1413964364, 1463060914, 1814384582, 2347623535,
+            4161512353, 3268856355, 4148488536, 4069800125, 3835467297, 3742099178, 2969075008,
+            1024729997, 86081322,   1242858873, 3206231363, 3071378482, 1368457023, 2359673697,
+            464594573,  244116481,  905186949,  3591227766, 3966440070, 1542174738, 3966616708,
+            102122312,  850762964,  1893683217, 2689350222, 1089062633, 2735737875, 4217865453,
+            3146769665, 151732654,  202440007,  3944710858, 327099534,  1595411042, 1938828152,
+            1463260176, 3700446684, 842068896,  851781553,  3107494642, 1830290061, 3452661997,
+            2389867019, 1531285802, 1996805821, 4122653950, 1030153059, 4223165125, 2479618776,
+            3770487164, 587650428,  4086986523, 453271798,  2589382281, 4137100923, 1972066093,
+            427402272,  2744017412, 231554319,  136252726,  2962530778, 3408426688, 1812136888,
+            1443091322, 1689329164, 2401537055, 1960367179, 1196217203, 2652455453, 733352463,
+            3118623706, 952121321,  3029066348, 603745780,  768906987,  1298719460, 1186448272,
+            203340260,  3937557566, 3764091866, 416470292,  2367176740, 4181667945, 2616745681,
+            557874650,  3515540852, 3805481341, 2030829563, 3893051757, 813035207,  1960994380,
+            834408627,  2630338821, 273873713,  1598672024, 3253094273, 3715532668, 2591564031,
+            1600796374, 1471058569, 3577151288, 3326706293, 1688383554, 3928946918, 3190913204,
+            2964703022, 1543505759, 4191573116, 2850240709, 1371820307, 2606216523, 2734142540,
+            404229152,  83988455,   2285151023, 932054208,  2650348644, 1197369272, 64737474,
+            1583232546, 1751760773, 3131373651, 2420380763, 2181615136, 3139377053, 4091386150,
+            3713359042, 3738901447, 2319088791, 2395311709, 3015097174, 2022428548, 2904314168,
+            2440411288, 704041154,  800051518,  1065441438, 2901949822, 3320380897, 2952506105,
+            3634326490, 1728162933, 3747890451, 4107624454, 3542960142, 126504126,  410229747,
+            3212151926, 575509398,  3670735168, 4047282029, 400008710,  3211890821, 1850601062,
+            367482823,  3451998899, 1032005024, 3089691149, 1463060914, 1814384582, 2347623535,
+            4161512353, 1855734776, 4148488536, 4069800125, 3835467297, 3742099178, 1189051443,
+            1024729997, 86081322,   1242858873, 3206231363, 2490466800, 1368457023, 2359673697,
+            464594573,  244116481,  3497904303, 3591227766, 3966440070, 1542174738, 3966616708,
+            2242949165, 850762964,  1893683217, 2689350222, 1089062633, 3623847798, 4217865453,
+            3146769665, 151732654,  202440007,  1178293509, 327099534,  1595411042, 1938828152,
+            1463260176, 3931698367, 842068896,  851781553,  3107494642, 1830290061, 1809577334,
+            2389867019, 1531285802, 1996805821, 4122653950, 2151714638, 4223165125, 2479618776,
+            3770487164, 587650428,  3667630345, 453271798,  2589382281, 4137100923, 1972066093,
+            3950103367, 2744017412, 231554319,  136252726,  2962530778, 3390442010, 1812136888,
+            1443091322, 1689329164, 2401537055, 3247932404, 679975466,  1440522982, 3942939576,
+            1636880797, 4183274525, 1743059874, 640216128,  3294127338, 60958875,   3219158925,
+            3772001835, 2937125570, 3036925883, 2232703037, 171442240,  3791664480, 973553604,
+            2052197949, 618410588,  2925316781, 3812784849, 2507066193, 863420927,  870026018,
+            708357587,  1647344150, 3483639361, 2324868757, 898867470,  1395318850, 2776008919,
+            4199042723, 684016274,  1819639110, 285672777,  1140806773, 1628785699, 2399459605,
+            3066702925, 873811847,  2653417709, 2523784297, 1951345809, 2186848921, 3570343616,
+            3183910758, 444562508,  2129086490, 3851885685, 1814317162, 5566626,    2233704120,
+            2441527532, 3376332515, 911925630,  3368345776, 1344335234, 2306552438, 258576290,
+            1407511318, 2712218689, 3018234347, 1832923971, 3427613046, 1896975750, 2729995469,
+            3970733945, 2902347951, 3868045476, 724492144,  2259467992, 1257990262, 819052938,
+            2956523763, 1859786133, 451724050,  1648674921, 1976509682, 1738100097, 748084368,
+            2557856061, 1348674805, 314290531,  1971202705, 2125836403, 3747693356, 1772361492,
+            1708929333, 3768869367, 24796374,   163523407,  3587244805, 1484149411, 111254193,
+            2874315668, 2357029757, 3299255445, 366749133,  4266849011, 194419163,  3931864670,
+            2551344342, 2532902047, 685814730,  514155482,  3632839262, 429879782,  1220084337,
+            2498518625, 2968356244, 2337972728, 3783401056, 3577359485, 2441041044, 1236515601,
+            3214878384, 602847717,  252854559,  3098447945, 2803014582, 1331507461, 197793635,
+            4094505516, 713378068,  1381783668, 2424779911, 3716395254, 3353639581, 1801275237,
+            3955944643, 3168106222, 3637715099, 531546363,  1591976151, 1939615116, 2932081537,
+            1545840875, 401664792,  643906566,  1068510661, 3220218507, 1145618510, 3615701654,
+            926821354,  2229287414, 1585160447, 1166000137, 3744011904, 700330235,  3175575186,
+            1446421973, 4122527697, 4168481502, 4033542120, 3062094715, 2090193249, 278319833,
+            1184170403, 572792751,
+        },
+        {
+            1351354003, 4266133398, 837720036,  355164405,  1208152222, 3392261193, 2947479673,
+            844702572,  1763492302, 3481971369, 1933347578, 865665999,  4050618252, 1431513582,
+            1807227645, 1278585706, 867136746,  4161713399, 3962846832, 3587037698, 1802930095,
+            872422256,  3557027384, 238291509,  4107870208, 2468332794, 1848331579, 3240095084,
+            426988291,  1378245989, 994331466,  1067940485, 1133209162, 1203962522, 2921446486,
+            865055634,  2608035100, 2355673536, 1319334156, 601524358,  3630486612, 2933651281,
+            4291621929, 177607442,  403638281,  779359501,  3255014452, 1407400428, 4293253754,
+            1964321641, 3409459870, 772378592,  701204775,  2988581360, 1275499589, 1841600679,
+            2148736217, 2228771654, 1222868545, 1068269964, 3840969753, 2205400172, 1194648157,
+            1321919750, 1286445778, 4238203900, 1776455225, 3233390932, 799858786,  835636759,
+            2323946555, 2207979698, 1581720926, 2042998880, 2594143099, 3720214203, 2067219667,
+            3799012622, 3434831900, 225370239,  1780043935, 331564372,  51210360,   3543770247,
+            303933917,  369121483,  2141021590, 2134110291, 2102975889, 2802730252, 1889017583,
+            382749199,  3615621479, 3242131234, 516769674,  1402457004, 263618504,  3013656123,
+            3926655224, 673479468,  2082026223, 460137830,  1110637849, 2703646305, 2606494412,
+            4049969152, 4068890666, 652760773,  83316786,   2505597899, 4095499949, 3501717978,
+            3549040526, 771729955,  100699723,  3970340686, 891026688,  1234189049, 1849646596,
+            46614126,   314507629,  524736500,  1226828331, 3477026418, 3203262864, 1907018431,
+            4004795422, 1031074692, 3138937062, 674521950,  3196212709, 3629049847, 1909835561,
+            1213362688, 2934138038, 3916854473, 2435298575, 4089434080, 2001137734, 2944752073,
+            1470038378, 557671018,  2547786424, 3822311677, 2940262507, 2397293009, 1914271720,
+            3670120716, 1770669295, 70759593,   4276437527, 4273190267, 1704927603, 77894216,
+            1773199418, 4285775546, 4212853334, 3505146246, 2078345492, 4243082340, 3366062302,
+            1351354003, 4266133398, 837720036,  355164405,  3687308187, 3392261193, 2947479673,
+            844702572,  1763492302, 3775536193, 1933347578, 865665999,  4050618252, 1431513582,
+            2336751245, 1278585706, 867136746,  4161713399, 3962846832, 3335564329, 1802930095,
+            872422256,  3557027384, 238291509,  1558607810, 2468332794, 1848331579, 3240095084,
+            426988291,  2780950906, 994331466,  1067940485, 1133209162, 1203962522, 1681372589,
+            865055634,  2608035100, 2355673536, 1319334156, 3096098014, 3630486612, 2933651281,
+            4291621929, 177607442,  623840788,  779359501,  3255014452, 1407400428, 4293253754,
+            1557011990, 3409459870, 772378592,  701204775,  2988581360, 1183490313, 1841600679,
+            2148736217, 2228771654, 1222868545, 2225024730, 3840969753, 2205400172, 1194648157,
+            1321919750, 1334135446, 4238203900, 1776455225, 3233390932, 799858786,  4004132513,
+            2323946555, 2207979698, 1581720926, 2042998880, 131360468,  3720214203, 2067219667,
+            3799012622, 3434831900, 2367855224, 1780043935, 331564372,  51210360,   3543770247,
+            73308470,   369121483,  2141021590, 2134110291, 2102975889, 1342811445, 1889017583,
+            382749199,  3615621479, 3242131234, 729398512,  1402457004, 263618504,  3013656123,
+            3926655224, 3543772451, 2082026223, 460137830,  1110637849, 2703646305, 1561011769,
+            4049969152, 4068890666, 652760773,  83316786,   2415682805, 4095499949, 3501717978,
+            3549040526, 771729955,  1650702727, 3970340686, 891026688,  1234189049, 1849646596,
+            2871661415, 314507629,  524736500,  1226828331, 3477026418, 3568617738, 1907018431,
+            4004795422, 1031074692, 3138937062, 3881510077, 3196212709, 3629049847, 1909835561,
+            1213362688, 2060483118, 3916854473, 2435298575, 4089434080, 2001137734, 3927783170,
+            1470038378, 557671018,  2547786424, 3822311677, 1140190743, 2397293009, 1914271720,
+            3670120716, 1770669295, 465937549,  4276437527, 4273190267, 1704927603, 77894216,
+            3745058794, 4285775546, 4212853334, 3505146246, 2078345492, 3732589145, 3366062302,
+            1351354003, 4266133398, 837720036,  3997025048, 3687308187, 3392261193, 2947479673,
+            844702572,  3190840141, 3775536193, 1933347578, 865665999,  4050618252, 1774230052,
+            2336751245, 1278585706, 867136746,  4161713399, 2711564598, 3335564329, 1802930095,
+            872422256,  3557027384, 1402265723, 1558607810, 2468332794, 1848331579, 3240095084,
+            272944362,  2780950906, 994331466,  1067940485, 1133209162, 3486314576, 1681372589,
+            865055634,  2608035100, 2355673536, 3390000971, 3096098014, 3630486612, 2933651281,
+            4291621929, 2817095319, 623840788,  779359501,  3255014452, 1407400428, 3465907022,
+            1557011990, 3409459870, 772378592,  701204775,  1725775643, 1183490313, 1841600679,
+            2148736217, 2228771654, 569029323,  2225024730, 3840969753, 2205400172, 1194648157,
+            2203150781, 1334135446, 4238203900, 1776455225, 3233390932, 1413502216, 4004132513,
+            2323946555, 2207979698, 1581720926, 117119527,  131360468,  3720214203, 2067219667,
+            3799012622, 1283567035, 2367855224, 1780043935, 331564372,  51210360,   2352796530,
+            73308470,   369121483,  2141021590, 2134110291, 3804569577, 1342811445, 1889017583,
+            382749199,  3615621479, 3880685803, 729398512,  1402457004, 263618504,  3013656123,
+            2576078922, 3543772451, 2082026223, 460137830,  1110637849, 906698267,  1561011769,
+            4049969152, 4068890666, 652760773,  1470473161, 2415682805, 4095499949, 3501717978,
+            3549040526, 2005206812, 1650702727, 3970340686, 891026688,  1234189049, 3258651091,
+            2871661415, 314507629,  524736500,  1226828331, 4092021735, 3568617738, 1907018431,
+            4004795422, 1031074692, 452220742,  3881510077, 3196212709, 3629049847, 1909835561,
+            1999673640, 2060483118, 3916854473, 2435298575, 4089434080, 3392598953, 3927783170,
+            1470038378, 557671018,  2547786424, 3292418260, 1140190743, 2397293009, 1914271720,
+            3670120716, 3752623307, 465937549,  4276437527, 4273190267, 1704927603, 2963238029,
+            3745058794, 4285775546, 4212853334, 3505146246, 514970610,  3732589145, 3366062302,
+            1351354003, 4266133398, 684088489,  3997025048, 3687308187, 3392261193, 2947479673,
+            1192969748, 3190840141, 3775536193, 1933347578, 865665999,  2352822153, 1774230052,
+            2336751245, 1278585706, 867136746,  3006437429, 2711564598, 3335564329, 1802930095,
+            872422256,  919399345,  1402265723, 1558607810, 2468332794, 1848331579, 1693741166,
+            272944362,  2780950906, 994331466,  1067940485, 3006238917, 3486314576, 1681372589,
+            865055634,  2608035100, 1981799199, 3390000971, 3096098014, 3630486612, 2933651281,
+            1939899552, 2817095319, 623840788,  779359501,  3255014452, 1318251675, 3465907022,
+            1557011990, 3409459870, 772378592,  3480530257, 1725775643, 1183490313, 1841600679,
+            2148736217, 2377827878, 569029323,  2225024730, 3840969753, 2205400172, 3688406153,
+            2203150781, 1334135446, 4238203900, 1776455225, 1339079941, 1413502216, 4004132513,
+            2323946555, 2207979698, 3535704137, 117119527,  131360468,  3720214203, 2067219667,
+            3494371280, 1283567035, 2367855224, 1780043935, 331564372,  1183513302, 2352796530,
+            73308470,   369121483,  2141021590, 3059447968, 3804569577, 1342811445, 1889017583,
+            382749199,  829681428,  3880685803, 729398512,  1402457004, 263618504,  1219449233,
+            2576078922, 3543772451, 2082026223, 460137830,  2308884910, 906698267,  1561011769,
+            4049969152, 4068890666, 3398970842, 1470473161, 2415682805, 4095499949, 3501717978,
+            3503989830, 2005206812, 1650702727, 3970340686, 891026688,  2121282244, 3258651091,
+            2871661415, 314507629,  524736500,  324461805,  4092021735, 3568617738, 1907018431,
+            4004795422, 472228381,  452220742,  3881510077, 3196212709, 3629049847, 640410001,
+            1999673640, 2060483118, 3916854473, 2435298575, 2967197656, 3392598953, 3927783170,
+            1470038378, 557671018,  2889308592, 3292418260, 1140190743, 2397293009, 1914271720,
+            3936638069, 3752623307, 465937549,  4276437527, 4273190267, 1835290133, 2963238029,
+            3745058794, 4285775546, 4212853334, 1113549612, 512206039,  3608934690, 1908744000,
+            4009346668, 3155651770, 795423539,  3257965015, 969404382,  3945084491, 330929347,
+            489689183,  2871810073, 4132259191, 3586389919, 3731394714, 3719364663, 3948155138,
+            3589779220, 2956085849, 1114184713, 400988076,  1853681340, 3484475327, 3868046207,
+            3149398816, 56912380,   540061074,  416486876,  2831828085, 1234354824, 137106187,
+            3161129263, 1353857042, 1449027626, 2414126884, 1596295953, 3051634843, 703614503,
+            177999038,  3871150992, 3624224806, 1729928490, 1112271727, 2882453917, 2383446381,
+            1891640341, 1678102412, 587634003,  1567952467, 625648109,  2751717070, 1226360903,
+            1034427250, 3059445339, 1676590320, 621624282,  4163091217, 283373835,  3331665355,
+            1218937001, 1964415559, 2648556187, 836894374,  1929451293, 2372936152, 3006045454,
+            1647072459, 1342672397, 3824063070, 3487273912, 596549063,  679398691,  1087066039,
+            1066889450, 2308385403, 3153313744, 2924145427, 3149022311, 1686041661, 2953567432,
+            3374443031, 681775847,  2786092450, 1559260217, 3850641503, 1381081208, 2108592208,
+            1333053359, 2776617259, 2743448442, 1605371372, 2250224693, 4124615526, 2124124136,
+            3772384738, 323112676,  304925088,  40978145,   3234801196, 2842552591, 2902676811,
+            59895101,   2432260356, 2027879114, 4049566449, 2747523930, 914673353,  4228599375,
+            1297027070, 1248775734, 996847152,  600750694,  4225446497, 1657132131, 3270222866,
+            3860862895, 992228273,  2435427169, 1785827494, 1287777749, 924409916,  1079056666,
+            2487128353, 333003794,  3674361861, 2739680136, 2542053055, 1075962289, 1903119133,
+            3147582940, 1325512607, 1474948338, 1828894895, 368392487,  4094760955, 2860589826,
+            3362660695, 402566281,  2230394970, 94945069,   3044239605, 2135268188, 2505616478,
+            3267865908, 1796769632, 3341803216, 51482116,   1088708627, 3456608706, 3904395358,
+            35392555,   3719327968, 3329610861, 948999802,  2025575784, 366975869,  2772498416,
+            2054813722, 2232043168,
+        },
+        {
+            4180191814, 2713568894, 541002693,  3434918919, 3787117098, 3334418240, 2041779359,
+            492508116,  3606120688, 3400606786, 2140940616, 1245636943, 3160016649, 4017799443,
+            1797510200, 1226406984, 1072957511, 1871455526, 2174101197, 3625355834, 446767608,
+            2415670432, 4241122790, 2872499266, 3875807437, 4137813367, 1519495002, 366744161,
+            2274866083, 430424544,  4018395305, 1410610568, 1973382507, 4184730176, 463664808,
+            4010555403, 4229312499, 555961842,  3799368260, 2249367030, 27282321,   3579641259,
+            221673216,  2656419824, 2397030357, 2520180979, 4290721813, 911138367,  1316937346,
+            2381976080, 2195662286, 805159858,  3011300128, 864789013,  705092904,  1794065712,
+            3551592025, 2722718157, 2998846280, 3958713151, 830890860,  1085607232, 1715574501,
+            1585907641, 2025706767, 337513721,  1343387032, 1794938336, 2103313138, 4046022902,
+            2476856528, 4102324022, 298131094,  2996939425, 963781851,  921929528,  1711526840,
+            1154358217, 3765231424, 1613751317, 4204276531, 4214917819, 3700338644, 3165060284,
+            6116162,    1596022931, 2051872747, 4119357399, 1892273983, 4251640156, 1675420525,
+            2743482992, 496689143,  876684966,  3459421153, 28649723,   3710567961, 1499919878,
+            2249527171, 83598952,   143625909,  403659383,  3032717280, 3844837875, 1232883305,
+            1405356964, 2935238890, 1722483165, 269143794,  4278416364, 1012646195, 2430527526,
+            2046106657, 1318725857, 2844119804, 905061918,  3753984353, 4288418433, 2599036349,
+            2014733439, 4153196950, 4061305416, 616908275,  1452602927, 2970754879, 3205711621,
+            3183906621, 975175747,  1722094470, 1607289294, 97092157,   4250044700, 3980196181,
+            352338134,  2674400893, 3231610413, 1792654142, 2813588754, 916346532,  1695849028,
+            999683057,  1942473180, 828647263,  1173189300, 245858395,  2697775026, 1002739707,
+            3021990418, 3253740987, 889718044,  2556110993, 378790518,  873907641,  2598751957,
+            1988473477, 2844726109, 2873246668, 1744616701, 782383002,  22206542,   1312207267,
+            4180191814, 2713568894, 541002693,  3434918919, 3955261144, 3334418240, 2041779359,
+            492508116,  3606120688, 661704692,  2140940616, 1245636943, 3160016649, 4017799443,
+            4289920996, 1226406984, 1072957511, 1871455526, 2174101197, 2297897083, 446767608,
+            2415670432, 4241122790, 2872499266, 2186433300, 4137813367, 1519495002, 366744161,
+            2274866083, 626597962,  4018395305, 1410610568, 1973382507, 4184730176, 4273532376,
+            4010555403, 4229312499, 555961842,  3799368260, 2406089340, 27282321,   3579641259,
+            221673216,  2656419824, 445034610,  2520180979, 4290721813, 911138367,  1316937346,
+            3582890422, 2195662286, 805159858,  3011300128, 864789013,  3947820580, 1794065712,
+            3551592025, 2722718157, 2998846280, 2640437463, 830890860,  1085607232, 1715574501,
+            1585907641, 960342351,  337513721,  1343387032, 1794938336, 2103313138, 3014400647,
+            2476856528, 4102324022, 298131094,  2996939425, 2825059267, 921929528,  1711526840,
+            1154358217, 3765231424, 614825181,  4204276531, 4214917819, 3700338644, 3165060284,
+            1723573140, 1596022931, 2051872747, 4119357399, 1892273983, 2010498075, 1675420525,
+            2743482992, 496689143,  876684966,  2166523636, 28649723,   3710567961, 1499919878,
+            2249527171, 2286441773, 143625909,  403659383,  3032717280, 3844837875, 2222734967,
+            1405356964, 2935238890, 1722483165, 269143794,  79315766,   1012646195, 2430527526,
+            2046106657, 1318725857, 4203844263, 905061918,  3753984353, 4288418433, 2599036349,
+            2922772608, 4153196950, 4061305416, 616908275,  1452602927, 4067799733, 3205711621,
+            3183906621, 975175747,  1722094470, 1581885281, 97092157,   4250044700, 3980196181,
+            352338134,  310672682,  3231610413, 1792654142, 2813588754, 916346532,  3281032068,
+            999683057,  1942473180, 828647263,  1173189300, 1270358363, 2697775026, 1002739707,
+            3021990418, 3253740987, 4269149184, 2556110993, 378790518,  873907641,  2598751957,
+            2587804303, 2844726109, 2873246668, 1744616701, 782383002,  2217161229, 1312207267,
+            4180191814, 2713568894, 541002693,  134997221,  3955261144, 3334418240, 2041779359,
+            492508116,  2762660690, 661704692,  2140940616, 1245636943, 3160016649, 238659275,
+            4289920996, 1226406984, 1072957511, 1871455526, 1839322981, 2297897083, 446767608,
+            2415670432, 4241122790, 2650301528, 2186433300, 4137813367, 1519495002, 366744161,
+            1516595723, 626597962,  4018395305, 1410610568, 1973382507, 2511508797, 4273532376,
+            4010555403, 4229312499, 555961842,  858813717,  2406089340, 27282321,   3579641259,
+            221673216,  163959862,  445034610,  2520180979, 4290721813, 911138367,  3180044611,
+            3582890422, 2195662286, 805159858,  3011300128, 374110147,  3947820580, 1794065712,
+            3551592025, 2722718157, 4131109882, 2640437463, 830890860,  1085607232, 1715574501,
+            3115602930, 960342351,  337513721,  1343387032, 1794938336, 3152637710, 3014400647,
+            2476856528, 4102324022, 298131094,  1251536070, 2825059267, 921929528,  1711526840,
+            1154358217, 3036799669, 614825181,  4204276531, 4214917819, 3700338644, 2426119669,
+            1723573140, 1596022931, 2051872747, 4119357399, 2364015283, 2010498075, 1675420525,
+            2743482992, 496689143,  4183597187, 2166523636, 28649723,   3710567961, 1499919878,
+            3317755073, 2286441773, 143625909,  403659383,  3032717280, 3310947601, 2222734967,
+            1405356964, 2935238890, 1722483165, 3041168959, 79315766,   1012646195, 2430527526,
+            2046106657, 1871618682, 4203844263, 905061918,  3753984353, 4288418433, 3713459066,
+            2922772608, 4153196950, 4061305416, 616908275,  1151949756, 4067799733, 3205711621,
+            3183906621, 975175747,  518775659,  1581885281, 97092157,   4250044700, 3980196181,
+            1262364567, 310672682,  3231610413, 1792654142, 2813588754, 3886907403, 3281032068,
+            999683057,  1942473180, 828647263,  3668346028, 1270358363, 2697775026, 1002739707,
+            3021990418, 2221839632, 4269149184, 2556110993, 378790518,  873907641,  395746011,
+            2587804303, 2844726109, 2873246668, 1744616701, 1835933278, 2217161229, 1312207267,
+            4180191814, 2713568894, 2291386484, 134997221,  3955261144, 3334418240, 2041779359,
+            4037899453, 2762660690, 661704692,  2140940616, 1245636943, 3072358745, 238659275,
+            4289920996, 1226406984, 1072957511, 1668335362, 1839322981, 2297897083, 446767608,
+            2415670432, 2190960139, 2650301528, 2186433300, 4137813367, 1519495002, 3862254974,
+            1516595723, 626597962,  4018395305, 1410610568, 161771302,  2511508797, 4273532376,
+            4010555403, 4229312499, 1669578763, 858813717,  2406089340, 27282321,   3579641259,
+            349011384,  163959862,  445034610,  2520180979, 4290721813, 3876143399, 3180044611,
+            3582890422, 2195662286, 805159858,  4165110576, 374110147,  3947820580, 1794065712,
+            3551592025, 477952899,  4131109882, 2640437463, 830890860,  1085607232, 3740868746,
+            3115602930, 960342351,  337513721,  1343387032, 2053416874, 3152637710, 3014400647,
+            2476856528, 4102324022, 4263913331, 1251536070, 2825059267, 921929528,  1711526840,
+            2774314555, 3036799669, 614825181,  4204276531, 4214917819, 514150906,  2426119669,
+            1723573140, 1596022931, 2051872747, 1693358180, 2364015283, 2010498075, 1675420525,
+            2743482992, 4057295364, 4183597187, 2166523636, 28649723,   3710567961, 3490960100,
+            3317755073, 2286441773, 143625909,  403659383,  469137243,  3310947601, 2222734967,
+            1405356964, 2935238890, 1336504753, 3041168959, 79315766,   1012646195, 2430527526,
+            2419435797, 1871618682, 4203844263, 905061918,  3753984353, 2397980449, 3713459066,
+            2922772608, 4153196950, 4061305416, 4100098530, 1151949756, 4067799733, 3205711621,
+            3183906621, 1453031251, 518775659,  1581885281, 97092157,   4250044700, 719987631,
+            1262364567, 310672682,  3231610413, 1792654142, 3996899582, 3886907403, 3281032068,
+            999683057,  1942473180, 342569619,  3668346028, 1270358363, 2697775026, 1002739707,
+            880017531,  2221839632, 4269149184, 2556110993, 378790518,  3970026969, 395746011,
+            2587804303, 2844726109, 2873246668, 2834017440, 413466454,  1475416098, 551179901,
+            1243477060, 156658398,  949744787,  2605556773, 3244328023, 4188898743, 1894088257,
+            633399111,  1304210645, 198287381,  2168440933, 2607174000, 3114658699, 1853544897,
+            2169021959, 1260145408, 3709947304, 3413302649, 958265340,  2481916031, 2266057382,
+            3109967417, 2883433555, 2985123498, 4268895904, 4268711764, 2777214395, 3436613824,
+            1629340468, 4117905720, 3970305388, 2514731938, 3655767169, 276856866,  2202898767,
+            1223751475, 1965250515, 2681142752, 570810360,  241132321,  3226713478, 2417263713,
+            2278067873, 3452773150, 4139742339, 92149443,   2406164485, 4155390463, 2973147718,
+            4132934909, 189503543,  1168193541, 1557430686, 1836448949, 615603831,  2729707805,
+            2305714744, 2398836493, 2737880741, 3484194102, 1759224738, 51476344,   1136687497,
+            569698287,  1710721715, 1953282990, 2680967389, 4212341498, 2465179405, 2143496452,
+            1855350478, 3778491051, 669846248,  2726974694, 3974763098, 95155589,   468305590,
+            3689960018, 4059941700, 2532398584, 810624698,  2653433467, 3682651540, 2101265427,
+            92618212,   312914066,  515624333,  3524653817, 1585484942, 2197068570, 3584286440,
+            956047152,  3489641160, 3858939263, 3753009383, 1462995435, 1699035871, 2668395427,
+            1135207009, 1547196529, 3642505270, 1527624213, 908438642,  503339619,  1208151525,
+            2596303076, 2822809360, 8217796,    2879507343, 881567391,  3531904962, 114739196,
+            3500257076, 3096599404, 2301936119, 4116148653, 710579096,  426079491,  2547642173,
+            2376855282, 233850287,  1994287420, 3984390912, 3531508209, 2164692645, 3567279386,
+            3885281893, 513286516,  2609917478, 3662999662, 1046873978, 1178780125, 129848866,
+            3409381436, 1234277956, 2199110068, 3184632250, 1407875396, 3024615759, 2010606283,
+            1279433018, 1874861022, 2074814797, 2702028257, 3937766586, 1249463048, 2945969218,
+            2615405625, 529365289,  3791353129, 2040552888, 1796584528, 2276751753, 2418205522,
+            169615837,  2744332928,
+        },
+        {
+            1223320478, 829042701,  2649263945, 2926578276, 1852366373, 4255305470, 1216994193,
+            473677422,  1350846791, 3618815096, 1030467273, 2493152153, 2286841004, 309432201,
+            4046356258, 2183499823, 3454118559, 3852708989, 745430977,  3108418112, 2887295358,
+            3988446990, 3251522631, 95260878,   603120572,  177895919,  2972472668, 332487871,
+            3486147894, 2454203980, 3358212330, 1248129178, 3538003705, 1049272910, 1320332843,
+            169566942,  2228403601, 1528639738, 3163806960, 2640996618, 3946858062, 1675220885,
+            3021866864, 3728780863, 2948679380, 4286703896, 208716055,  1008683287, 2674737941,
+            3494560808, 944903178,  3542870715, 1522369835, 3335619348, 2180540773, 2383377108,
+            2639463798, 3704773758, 297741453,  3974841230, 1320246597, 1761237817, 911279631,
+            2281345810, 1481906245, 466429960,  642412040,  1880632823, 3414736353, 1652960992,
+            1607721343, 1374279667, 3197155289, 195936129,  3889294528, 732066717,  1198044757,
+            1734274290, 1809128566, 1061951680, 3012868536, 3259763311, 2294479123, 814934631,
+            2168949247, 3343978200, 853887518,  1674268630, 1701439310, 2340466424, 4005297337,
+            3741836709, 2172303337, 607480050,  2222588111, 3917618550, 2877581306, 1951842790,
+            1525886526, 1261879004, 4095493524, 4160015482, 2800253982, 3333137291, 3042837000,
+            1866573509, 3622134067, 2626572710, 635453450,  307822710,  2924362640, 33300099,
+            843876426,  1456397860, 1264803558, 3665613548, 2141457689, 1739895045, 1422648304,
+            4080593214, 123068324,  156969559,  3522250130, 2737881660, 2460606221, 3594626605,
+            1962184229, 1228801538, 2356551762, 1689490251, 2663140622, 1776330643, 1083681334,
+            2585140713, 3611048913, 2265674721, 1770672480, 4032153740, 3878010749, 445393156,
+            2172928144, 2551370014, 2852919352, 2349960193, 2218432754, 284526198,  3693228332,
+            1980362271, 4139090862, 4204757553, 721108729,  2232944174, 2634444597, 2058649793,
+            1884625057, 3725943238, 1902311795, 3619841386, 2553038989, 233486649,  3610885734,
+            1223320478, 829042701,  2649263945, 2926578276, 2928508676, 4255305470, 1216994193,
+            473677422,  1350846791, 2593913227, 1030467273, 2493152153, 2286841004, 309432201,
+            1056598540, 2183499823, 3454118559, 3852708989, 745430977,  592961010,  2887295358,
+            3988446990, 3251522631, 95260878,   2133431096, 177895919,  2972472668, 332487871,
+            3486147894, 2691378345, 3358212330, 1248129178, 3538003705, 1049272910, 1258089746,
+            169566942,  2228403601, 1528639738, 3163806960, 2784545780, 3946858062, 1675220885,
+            3021866864, 3728780863, 3105124790, 4286703896, 208716055,  1008683287, 2674737941,
+            3535760780, 944903178,  3542870715, 1522369835, 3335619348, 2195161662, 2383377108,
+            2639463798, 3704773758, 297741453,  2147347825, 1320246597, 1761237817, 911279631,
+            2281345810, 3232326643, 466429960,  642412040,  1880632823, 3414736353, 4058282227,
+            1607721343, 1374279667, 3197155289, 195936129,  2264518082, 732066717,  1198044757,
+            1734274290, 1809128566, 3118398538, 3012868536, 3259763311, 2294479123, 814934631,
+            3116206440, 3343978200, 853887518,  1674268630, 1701439310, 1301524828, 4005297337,
+            3741836709, 2172303337, 607480050,  3144774247, 3917618550, 2877581306, 1951842790,
+            1525886526, 173095233,  4095493524, 4160015482, 2800253982, 3333137291, 745970117,
+            1866573509, 3622134067, 2626572710, 635453450,  647606989,  2924362640, 33300099,
+            843876426,  1456397860, 2265288546, 3665613548, 2141457689, 1739895045, 1422648304,
+            3443266009, 123068324,  156969559,  3522250130, 2737881660, 3509108038, 3594626605,
+            1962184229, 1228801538, 2356551762, 2237731658, 2663140622, 1776330643, 1083681334,
+            2585140713, 2934642988, 2265674721, 1770672480, 4032153740, 3878010749, 2670160340,
+            2172928144, 2551370014, 2852919352, 2349960193, 3827822011, 284526198,  3693228332,
+            1980362271, 4139090862, 3011953429, 721108729,  2232944174, 2634444597, 2058649793,
+            3261587226, 3725943238, 1902311795, 3619841386, 2553038989, 2241164169, 3610885734,
+            1223320478, 829042701,  2649263945, 1650809094, 2928508676, 4255305470, 1216994193,
+            473677422,  3298025603, 2593913227, 1030467273, 2493152153, 2286841004, 1807585232,
+            1056598540, 2183499823, 3454118559, 3852708989, 1604056339, 592961010,  2887295358,
+            3988446990, 3251522631, 2160607673, 2133431096, 177895919,  2972472668, 332487871,
+            1424640996, 2691378345, 3358212330, 1248129178, 3538003705, 1030717138, 1258089746,
+            169566942,  2228403601, 1528639738, 3524379899, 2784545780, 3946858062, 1675220885,
+            3021866864, 3885719181, 3105124790, 4286703896, 208716055,  1008683287, 3683631953,
+            3535760780, 944903178,  3542870715, 1522369835, 3438930113, 2195161662, 2383377108,
+            2639463798, 3704773758, 1524558108, 2147347825, 1320246597, 1761237817, 911279631,
+            1958850178, 3232326643, 466429960,  642412040,  1880632823, 985493663,  4058282227,
+            1607721343, 1374279667, 3197155289, 551913648,  2264518082, 732066717,  1198044757,
+            1734274290, 373581775,  3118398538, 3012868536, 3259763311, 2294479123, 312799370,
+            3116206440, 3343978200, 853887518,  1674268630, 3190417099, 1301524828, 4005297337,
+            3741836709, 2172303337, 768222943,  3144774247, 3917618550, 2877581306, 1951842790,
+            3361107523, 173095233,  4095493524, 4160015482, 2800253982, 3926340688, 745970117,
+            1866573509, 3622134067, 2626572710, 4291521378, 647606989,  2924362640, 33300099,
+            843876426,  4186950953, 2265288546, 3665613548, 2141457689, 1739895045, 795412578,
+            3443266009, 123068324,  156969559,  3522250130, 4058001855, 3509108038, 3594626605,
+            1962184229, 1228801538, 2487696571, 2237731658, 2663140622, 1776330643, 1083681334,
+            222944652,  2934642988, 2265674721, 1770672480, 4032153740, 2824651283, 2670160340,
+            2172928144, 2551370014, 2852919352, 1289007052, 3827822011, 284526198,  3693228332,
+            1980362271, 3685047472, 3011953429, 721108729,  2232944174, 2634444597, 3634355867,
+            3261587226, 3725943238, 1902311795, 3619841386, 3088654863, 2241164169, 3610885734,
+            1223320478, 829042701,  1557203409, 1650809094, 2928508676, 4255305470, 1216994193,
+            1009207420, 3298025603, 2593913227, 1030467273, 2493152153, 2388624397, 1807585232,
+            1056598540, 2183499823, 3454118559, 1111064275, 1604056339, 592961010,  2887295358,
+            3988446990, 3219977854, 2160607673, 2133431096, 177895919,  2972472668, 3708273748,
+            1424640996, 2691378345, 3358212330, 1248129178, 1803350049, 1030717138, 1258089746,
+            169566942,  2228403601, 1259031062, 3524379899, 2784545780, 3946858062, 1675220885,
+            1112405439, 3885719181, 3105124790, 4286703896, 208716055,  1948232064, 3683631953,
+            3535760780, 944903178,  3542870715, 2770775626, 3438930113, 2195161662, 2383377108,
+            2639463798, 2510101800, 1524558108, 2147347825, 1320246597, 1761237817, 3628289467,
+            1958850178, 3232326643, 466429960,  642412040,  2354050872, 985493663,  4058282227,
+            1607721343, 1374279667, 4058980900, 551913648,  2264518082, 732066717,  1198044757,
+            777102842,  373581775,  3118398538, 3012868536, 3259763311, 4002107360, 312799370,
+            3116206440, 3343978200, 853887518,  3086920901, 3190417099, 1301524828, 4005297337,
+            3741836709, 681904656,  768222943,  3144774247, 3917618550, 2877581306, 3517334064,
+            3361107523, 173095233,  4095493524, 4160015482, 381320918,  3926340688, 745970117,
+            1866573509, 3622134067, 3492186182, 4291521378, 647606989,  2924362640, 33300099,
+            1298826746, 4186950953, 2265288546, 3665613548, 2141457689, 4201422358, 795412578,
+            3443266009, 123068324,  156969559,  664284529,  4058001855, 3509108038, 3594626605,
+            1962184229, 1903595414, 2487696571, 2237731658, 2663140622, 1776330643, 15546234,
+            222944652,  2934642988, 2265674721, 1770672480, 3200185602, 2824651283, 2670160340,
+            2172928144, 2551370014, 3758503659, 1289007052, 3827822011, 284526198,  3693228332,
+            905443467,  3685047472, 3011953429, 721108729,  2232944174, 1934709369, 3634355867,
+            3261587226, 3725943238, 1902311795, 838830605,  3781358345, 3900224344, 3911609902,
+            8564476,    9812480,    2089450560, 1174976828, 2270081035, 1729535746, 1209819537,
+            1622262318, 378335355,  1358695539, 2362532665, 3991677445, 1964450251, 2861397398,
+            3485117812, 1591677000, 1753504523, 2358195160, 3597099792, 2706285388, 2143315551,
+            550424465,  1491573882, 1875605043, 502981111,  942757425,  344648643,  2997801686,
+            3706389891, 3779510659, 3080831510, 379883459,  3022510989, 1540207342, 322972947,
+            1537855379, 2788300288, 91465179,   1417551278, 1922458733, 2253614245, 3351618965,
+            3085216752, 219677948,  793890345,  1262400211, 2065956161, 984587441,  2647058601,
+            2664252287, 41951919,   3388974191, 3531937713, 40989423,   1123188830, 190361844,
+            3897227725, 2199682190, 2198909495, 528830086,  2519509317, 846003162,  1567093121,
+            2606611299, 2616104418, 2781264183, 898877552,  2095494985, 3518285402, 2753525210,
+            1427424888, 3193707924, 470650271,  3260313743, 3349496446, 609803690,  4274755691,
+            1523722149, 3815248320, 3340286598, 2094532523, 3074967520, 3002852448, 3222949234,
+            635765981,  960082444,  3308947457, 2549023116, 2219821939, 2933412573, 1237122759,
+            1405006383, 4273763744, 2198404915, 3361729609, 2964866022, 2319981108, 2952679850,
+            2645448460, 139723925,  1279783500, 3946376288, 1615157656, 1547878599, 3683497993,
+            248549622,  3844810056, 2911448116, 1728325874, 165630115,  1481930710, 2242366879,
+            1350478924, 4029047069, 2439361241, 1777564278, 4094691758, 4194724069, 2678811352,
+            2953818957, 3404057969, 2647116590, 3590368527, 2881085707, 3122433594, 1224153051,
+            2558820666, 893808548,  1212336796, 4291108069, 3759757261, 2561926185, 1507262584,
+            3863370918, 585767491,  230812017,  4101701469, 1254361695, 3801663564, 2109710744,
+            4231782664, 1818184528, 2354675131, 3230519927, 615137228,  878688698,  3702808840,
+            3913521539, 853984563,  2170553894, 2879076575, 3247035179, 3000533330, 1783062473,
+            2820702419, 1983242517,
+        },
+        {
+            2808551707, 3578508089, 2799050128, 3671650247, 3212161969, 1267355211, 2853025628,
+            488183554,  3587436209, 1616848028, 850686586,  2319399518, 789312838,  3517396727,
+            2144104498, 1820770419, 495597380,  1142037883, 471757159,  4097735084, 3720025770,
+            972431829,  4087571633, 3152924877, 1221381668, 2489923246, 211104059,  2673738759,
+            2321495451, 51662506,   2631089612, 413288088,  4133982813, 339390163,  204690773,
+            1196294076, 254920227,  3086679761, 934646374,  319676569,  3057287084, 1722226655,
+            766167647,  2060786942, 2756838733, 1480793209, 336673806,  3718728465, 2227923058,
+            1532410388, 3989774616, 1006431617, 2818650824, 4254265120, 2639372517, 2389324457,
+            2220875385, 1118241234, 476578593,  850395671,  3559193928, 3812970826, 1927442346,
+            2433712374, 3692746172, 3055947055, 1425267269, 1136537386, 3715602786, 593785240,
+            3104054533, 1574136405, 3806583172, 3754241144, 587417046,  854750826,  2704095240,
+            3666261884, 1079377511, 852693493,  4133802340, 1669178435, 2958032498, 2611694369,
+            3816619576, 3448468576, 3531486918, 1446339177, 2446877402, 3487257831, 949274984,
+            823372758,  143461309,  822951358,  1611655332, 3887948403, 3330035178, 3799272097,
+            3515187708, 2757137508, 3496766169, 3846550767, 2670278434, 973449030,  3687842476,
+            3578133114, 2257459081, 225617990,  3822232632, 3473321982, 2367252860, 3917550300,
+            3895005131, 722657191,  3219818761, 4034821527, 2799754771, 250118577,  1757015771,
+            3847339219, 2102661422, 3418874112, 4145220353, 238329762,  1268351433, 3246843062,
+            2238555960, 4242070303, 644032916,  3218794848, 1023724729, 2789181350, 3197306921,
+            3012756604, 1946632637, 4230054184, 3087998716, 2329226334, 3825476886, 3570341273,
+            3894468702, 2096367573, 142653163,  1684339885, 3727606348, 2457383045, 3091532678,
+            2612919290, 3875297628, 2653893659, 375404225,  4229223313, 2017357865, 2623098317,
+            1800250208, 3974765961, 3295312237, 878111901,  1397372014, 3775411023, 1395359746,
+            2808551707, 3578508089, 2799050128, 3671650247, 2249512329, 1267355211, 2853025628,
+            488183554,  3587436209, 1879750121, 850686586,  2319399518, 789312838,  3517396727,
+            526649460,  1820770419, 495597380,  1142037883, 471757159,  921694905,  3720025770,
+            972431829,  4087571633, 3152924877, 3497348403, 2489923246, 211104059,  2673738759,
+            2321495451, 4101940413, 2631089612, 413288088,  4133982813, 339390163,  4152299409,
+            1196294076, 254920227,  3086679761, 934646374,  3953432513, 3057287084, 1722226655,
+            766167647,  2060786942, 2804786600, 1480793209, 336673806,  3718728465, 2227923058,
+            3105650428, 3989774616, 1006431617, 2818650824, 4254265120, 1251157800, 2389324457,
+            2220875385, 1118241234, 476578593,  976161581,  3559193928, 3812970826, 1927442346,
+            2433712374, 522077330,  3055947055, 1425267269, 1136537386, 3715602786, 6939319,
+            3104054533, 1574136405, 3806583172, 3754241144, 3902011672, 854750826,  2704095240,
+            3666261884, 1079377511, 1424437587, 4133802340, 1669178435, 2958032498, 2611694369,
+            4274993315, 3448468576, 3531486918, 1446339177, 2446877402, 4285162221, 949274984,
+            823372758,  143461309,  822951358,  793928096,  3887948403, 3330035178, 3799272097,
+            3515187708, 865976493,  3496766169, 3846550767, 2670278434, 973449030,  205846952,
+            3578133114, 2257459081, 225617990,  3822232632, 440171255,  2367252860, 3917550300,
+            3895005131, 722657191,  42864928,   4034821527, 2799754771, 250118577,  1757015771,
+            2098914657, 2102661422, 3418874112, 4145220353, 238329762,  1147235440, 3246843062,
+            2238555960, 4242070303, 644032916,  1152385433, 1023724729, 2789181350, 3197306921,
+            3012756604, 637960324,  4230054184, 3087998716, 2329226334, 3825476886, 1163323788,
+            3894468702, 2096367573, 142653163,  1684339885, 245664462,  2457383045, 3091532678,
+            2612919290, 3875297628, 3630592649, 375404225,  4229223313, 2017357865, 2623098317,
+            1686175590, 3974765961, 3295312237, 878111901,  1397372014, 3236067569, 1395359746,
+            2808551707, 3578508089, 2799050128, 3331458753, 2249512329, 1267355211, 2853025628,
+            488183554,  3356356876, 1879750121, 850686586,  2319399518, 789312838,  3333873360,
+            526649460,  1820770419, 495597380,  1142037883, 668974032,  921694905,  3720025770,
+            972431829,  4087571633, 1283516975, 3497348403, 2489923246, 211104059,  2673738759,
+            1699739042, 4101940413, 2631089612, 413288088,  4133982813, 1145874971, 4152299409,
+            1196294076, 254920227,  3086679761, 2943080691, 3953432513, 3057287084, 1722226655,
+            766167647,  2884976193, 2804786600, 1480793209, 336673806,  3718728465, 1509966048,
+            3105650428, 3989774616, 1006431617, 2818650824, 3924730430, 1251157800, 2389324457,
+            2220875385, 1118241234, 2622646544, 976161581,  3559193928, 3812970826, 1927442346,
+            2082380512, 522077330,  3055947055, 1425267269, 1136537386, 3244197359, 6939319,
+            3104054533, 1574136405, 3806583172, 347703390,  3902011672, 854750826,  2704095240,
+            3666261884, 3512636651, 1424437587, 4133802340, 1669178435, 2958032498, 2960399147,
+            4274993315, 3448468576, 3531486918, 1446339177, 3205279595, 4285162221, 949274984,
+            823372758,  143461309,  261036387,  793928096,  3887948403, 3330035178, 3799272097,
+            1039067087, 865976493,  3496766169, 3846550767, 2670278434, 3746744994, 205846952,
+            3578133114, 2257459081, 225617990,  4283163503, 440171255,  2367252860, 3917550300,
+            3895005131, 1616844359, 42864928,   4034821527, 2799754771, 250118577,  2898427070,
+            2098914657, 2102661422, 3418874112, 4145220353, 3262229470, 1147235440, 3246843062,
+            2238555960, 4242070303, 1340786774, 1152385433, 1023724729, 2789181350, 3197306921,
+            1416061770, 637960324,  4230054184, 3087998716, 2329226334, 2205934871, 1163323788,
+            3894468702, 2096367573, 142653163,  2606586882, 245664462,  2457383045, 3091532678,
+            2612919290, 682277850,  3630592649, 375404225,  4229223313, 2017357865, 3572186923,
+            1686175590, 3974765961, 3295312237, 878111901,  467969004,  3236067569, 1395359746,
+            2808551707, 3578508089, 251373047,  3331458753, 2249512329, 1267355211, 2853025628,
+            50181258,   3356356876, 1879750121, 850686586,  2319399518, 2859744017, 3333873360,
+            526649460,  1820770419, 495597380,  4040935024, 668974032,  921694905,  3720025770,
+            972431829,  4104133456, 1283516975, 3497348403, 2489923246, 211104059,  701886211,
+            1699739042, 4101940413, 2631089612, 413288088,  4170648423, 1145874971, 4152299409,
+            1196294076, 254920227,  427170239,  2943080691, 3953432513, 3057287084, 1722226655,
+            1618768145, 2884976193, 2804786600, 1480793209, 336673806,  483970707,  1509966048,
+            3105650428, 3989774616, 1006431617, 2885423905, 3924730430, 1251157800, 2389324457,
+            2220875385, 2962049792, 2622646544, 976161581,  3559193928, 3812970826, 4117957649,
+            2082380512, 522077330,  3055947055, 1425267269, 724670361,  3244197359, 6939319,
+            3104054533, 1574136405, 3773614223, 347703390,  3902011672, 854750826,  2704095240,
+            2205782425, 3512636651, 1424437587, 4133802340, 1669178435, 2127765585, 2960399147,
+            4274993315, 3448468576, 3531486918, 528693857,  3205279595, 4285162221, 949274984,
+            823372758,  842414366,  261036387,  793928096,  3887948403, 3330035178, 3515808374,
+            1039067087, 865976493,  3496766169, 3846550767, 1301322692, 3746744994, 205846952,
+            3578133114, 2257459081, 2696495195, 4283163503, 440171255,  2367252860, 3917550300,
+            2603662168, 1616844359, 42864928,   4034821527, 2799754771, 1713250713, 2898427070,
+            2098914657, 2102661422, 3418874112, 498546510,  3262229470, 1147235440, 3246843062,
+            2238555960, 560585262,  1340786774, 1152385433, 1023724729, 2789181350, 3195572455,
+            1416061770, 637960324,  4230054184, 3087998716, 1947612744, 2205934871, 1163323788,
+            3894468702, 2096367573, 2972514704, 2606586882, 245664462,  2457383045, 3091532678,
+            4230521312, 682277850,  3630592649, 375404225,  4229223313, 3174616448, 3572186923,
+            1686175590, 3974765961, 3295312237, 1564210513, 2354163446, 2885390540, 2660419474,
+            747966597,  2289059432, 713536358,  1898151691, 568816675,  4151900611, 578679092,
+            933143652,  2767229370, 1102598335, 2037183220, 2097772627, 3192081586, 2945403018,
+            2164364092, 1671551884, 3398367307, 3880273611, 1715656540, 358665740,  3263538022,
+            2886488313, 2637613740, 3604012705, 2635449259, 590795642,  387899866,  1533265106,
+            2504160492, 174116913,  1675068053, 1765674992, 3615152872, 837473218,  2384890051,
+            2169169229, 3709696240, 2798987847, 1171123177, 173964224,  433839454,  3315237125,
+            124190242,  2612023353, 709502591,  3068775378, 1705560587, 2876130716, 1801191520,
+            4117000040, 313623868,  1188290175, 2732368689, 1219712144, 1210159666, 2383218407,
+            1656638216, 1282611549, 2755069928, 2780813618, 3321145707, 2726301238, 925077594,
+            383243246,  3303076308, 1737089762, 3525198084, 2586969372, 656677364,  169528140,
+            2510534618, 1341353583, 58807711,   1241637258, 1212589692, 2636565033, 2655000917,
+            1947629477, 1000855031, 3027209489, 842902948,  1624281725, 1575672148, 3442042536,
+            357506585,  2987254440, 1662899073, 2085132551, 760688655,  649945491,  742548538,
+            2896098175, 1564032075, 3939811054, 3885111871, 2538685572, 1764753257, 2666477241,
+            3677317557, 1882649041, 2329370371, 1139370872, 548906199,  648626194,  1791592657,
+            2072889184, 14053607,   3994224227, 4102042481, 845925569,  2035941845, 3281122858,
+            3093470150, 571786609,  2541632712, 1000592714, 642659238,  2016327875, 2558810313,
+            713933835,  3718006026, 785273963,  3645648487, 1076113771, 3288446411, 3412538211,
+            1316763359, 3856193149, 3705111879, 3324552296, 2097494766, 3770930868, 4197009648,
+            3085232281, 1554224149, 155391571,  947825404,  1281924276, 3474160035, 2319814703,
+            1650815089, 3929361730, 1528411346, 3225741520, 3470811678, 1553519259, 2328705676,
+            1994759020, 1582244022, 2250854975, 2420729086, 2761035427, 430621475,  3443653640,
+            2847998830, 1160453863,
+        },
+        {
+            1772287580, 4087444803, 1610986444, 3325142167, 435854340,  3278544526, 3275413769,
+            4256962666, 3295204934, 903418897,  3706432600, 2093424233, 2722597485, 3308053101,
+            1941427659, 3876428908, 1471234945, 2799422242, 3452688998, 4091636289, 955217262,
+            2897098079, 2560315486, 392204134,  3413261568, 494938610,  2728389029, 495116299,
+            3331593659, 2432190177, 3439023659, 3465428559, 1743850196, 3005181552, 2518732164,
+            3610582421, 3704918133, 342661572,  4183176152, 2636542557, 3434352265, 1950450612,
+            1884810685, 3081668154, 4074194167, 2575127238, 3253471392, 1851341498, 2109711518,
+            775789657,  1360592643, 2034667160, 469523313,  3487332695, 1558399873, 1955424450,
+            1864473234, 1948066151, 3886535736, 1066771973, 3191454662, 3088587824, 488104089,
+            3083281081, 1675120636, 492977881,  1658430225, 2622915938, 2159056148, 4049301968,
+            3214526427, 718910098,  2066822772, 2124261850, 1904947931, 681814628,  3060581028,
+            1227713212, 2446717627, 1098467719, 494023071,  591816638,  2706709710, 3691804439,
+            160600647,  2485206534, 2135301045, 2274831672, 3575786253, 1404560567, 1340970695,
+            4131269654, 1055679146, 1238313966, 2622627687, 1095599232, 870519214,  3999041104,
+            738546576,  3877845902, 3791606613, 3751344817, 3332231920, 2666832097, 2838724702,
+            710796338,  1413323892, 4107291419, 3061759038, 102296259,  2478667442, 1168518328,
+            4261569371, 2116241322, 2800352820, 3344590798, 1843054537, 3197585344, 4240622905,
+            4201572628, 2889763565, 755319377,  1042420334, 3450402236, 1018898496, 2490247803,
+            1823412369, 1644318502, 1834017551, 428035623,  1236496078, 1050497324, 3285035806,
+            2632454471, 673986681,  518116195,  2184345316, 3571776360, 3474678943, 1878994084,
+            3500977207, 1502323736, 2956070188, 475504717,  777493776,  1695316353, 130817436,
+            2167779933, 1713138572, 4245908169, 2429519689, 3580373360, 2514769178, 3419034765,
+            27362604,   3799231378, 3232641424, 2794059999, 1336157358, 3347585388, 1983845844,
+            1772287580, 4087444803, 1610986444, 3325142167, 3179930843, 3278544526, 3275413769,
+            4256962666, 3295204934, 2198814487, 3706432600, 2093424233, 2722597485, 3308053101,
+            1295882190, 3876428908, 1471234945, 2799422242, 3452688998, 3032993789, 955217262,
+            2897098079, 2560315486, 392204134,  290018168,  494938610,  2728389029, 495116299,
+            3331593659, 3277913231, 3439023659, 3465428559, 1743850196, 3005181552, 2349709993,
+            3610582421, 3704918133, 342661572,  4183176152, 3723722979, 3434352265, 1950450612,
+            1884810685, 3081668154, 1612719793, 2575127238, 3253471392, 1851341498, 2109711518,
+            3807162664, 1360592643, 2034667160, 469523313,  3487332695, 2996669558, 1955424450,
+            1864473234, 1948066151, 3886535736, 2042010473, 3191454662, 3088587824, 488104089,
+            3083281081, 567589989,  492977881,  1658430225, 2622915938, 2159056148, 1312187571,
+            3214526427, 718910098,  2066822772, 2124261850, 1351480144, 681814628,  3060581028,
+            1227713212, 2446717627, 3284583210, 494023071,  591816638,  2706709710, 3691804439,
+            2518094200, 2485206534, 2135301045, 2274831672, 3575786253, 901206662,  1340970695,
+            4131269654, 1055679146, 1238313966, 3419993079, 1095599232, 870519214,  3999041104,
+            738546576,  1604066606, 3791606613, 3751344817, 3332231920, 2666832097, 1536977244,
+            710796338,  1413323892, 4107291419, 3061759038, 317600375,  2478667442, 1168518328,
+            4261569371, 2116241322, 1389162204, 3344590798, 1843054537, 3197585344, 4240622905,
+            3523870021, 2889763565, 755319377,  1042420334, 3450402236, 2138004575, 2490247803,
+            1823412369, 1644318502, 1834017551, 3982854498, 1236496078, 1050497324, 3285035806,
+            2632454471, 1057838539, 518116195,  2184345316, 3571776360, 3474678943, 1112009827,
+            3500977207, 1502323736, 2956070188, 475504717,  1202484732, 1695316353, 130817436,
+            2167779933, 1713138572, 614283635,  2429519689, 3580373360, 2514769178, 3419034765,
+            3944575309, 3799231378, 3232641424, 2794059999, 1336157358, 2981572084, 1983845844,
+            1772287580, 4087444803, 1610986444, 1297765200, 3179930843, 3278544526, 3275413769,
+            4256962666, 845917759,  2198814487, 3706432600, 2093424233, 2722597485, 3457987151,
+            1295882190, 3876428908, 1471234945, 2799422242, 3461466016, 3032993789, 955217262,
+            2897098079, 2560315486, 3448432981, 290018168,  494938610,  2728389029, 495116299,
+            2022200240, 3277913231, 3439023659, 3465428559, 1743850196, 3024175760, 2349709993,
+            3610582421, 3704918133, 342661572,  2556719886, 3723722979, 3434352265, 1950450612,
+            1884810685, 2386815280, 1612719793, 2575127238, 3253471392, 1851341498, 769049576,
+            3807162664, 1360592643, 2034667160, 469523313,  2497727876, 2996669558, 1955424450,
+            1864473234, 1948066151, 3991075007, 2042010473, 3191454662, 3088587824, 488104089,
+            1599187005, 567589989,  492977881,  1658430225, 2622915938, 3173130312, 1312187571,
+            3214526427, 718910098,  2066822772, 886148558,  1351480144, 681814628,  3060581028,
+            1227713212, 3758496748, 3284583210, 494023071,  591816638,  2706709710, 3526430531,
+            2518094200, 2485206534, 2135301045, 2274831672, 2692994127, 901206662,  1340970695,
+            4131269654, 1055679146, 462809855,  3419993079, 1095599232, 870519214,  3999041104,
+            367633395,  1604066606, 3791606613, 3751344817, 3332231920, 3367304508, 1536977244,
+            710796338,  1413323892, 4107291419, 3865316403, 317600375,  2478667442, 1168518328,
+            4261569371, 2027281683, 1389162204, 3344590798, 1843054537, 3197585344, 3233043853,
+            3523870021, 2889763565, 755319377,  1042420334, 498953811,  2138004575, 2490247803,
+            1823412369, 1644318502, 733739193,  3982854498, 1236496078, 1050497324, 3285035806,
+            1014180900, 1057838539, 518116195,  2184345316, 3571776360, 3070483942, 1112009827,
+            3500977207, 1502323736, 2956070188, 1125419417, 1202484732, 1695316353, 130817436,
+            2167779933, 2991729,    614283635,  2429519689, 3580373360, 2514769178, 2853499801,
+            3944575309, 3799231378, 3232641424, 2794059999, 3052115131, 2981572084, 1983845844,
+            1772287580, 4087444803, 92736577,   1297765200, 3179930843, 3278544526, 3275413769,
+            219528719,  845917759,  2198814487, 3706432600, 2093424233, 2910293182, 3457987151,
+            1295882190, 3876428908, 1471234945, 2287674918, 3461466016, 3032993789, 955217262,
+            2897098079, 1749938722, 3448432981, 290018168,  494938610,  2728389029, 865098164,
+            2022200240, 3277913231, 3439023659, 3465428559, 62863283,   3024175760, 2349709993,
+            3610582421, 3704918133, 4294643462, 2556719886, 3723722979, 3434352265, 1950450612,
+            1943671608, 2386815280, 1612719793, 2575127238, 3253471392, 1123203718, 769049576,
+            3807162664, 1360592643, 2034667160, 2259730883, 2497727876, 2996669558, 1955424450,
+            1864473234, 449319212,  3991075007, 2042010473, 3191454662, 3088587824, 1489236350,
+            1599187005, 567589989,  492977881,  1658430225, 1165106263, 3173130312, 1312187571,
+            3214526427, 718910098,  2695845109, 886148558,  1351480144, 681814628,  3060581028,
+            1908146282, 3758496748, 3284583210, 494023071,  591816638,  3387607305, 3526430531,
+            2518094200, 2485206534, 2135301045, 3021289327, 2692994127, 901206662,  1340970695,
+            4131269654, 2167905288, 462809855,  3419993079, 1095599232, 870519214,  1286419033,
+            367633395,  1604066606, 3791606613, 3751344817, 1301279534, 3367304508, 1536977244,
+            710796338,  1413323892, 1280809601, 3865316403, 317600375,  2478667442, 1168518328,
+            3360441657, 2027281683, 1389162204, 3344590798, 1843054537, 2565593723, 3233043853,
+            3523870021, 2889763565, 755319377,  1448931812, 498953811,  2138004575, 2490247803,
+            1823412369, 261762189,  733739193,  3982854498, 1236496078, 1050497324, 3910521936,
+            1014180900, 1057838539, 518116195,  2184345316, 648787237,  3070483942, 1112009827,
+            3500977207, 1502323736, 2334139596, 1125419417, 1202484732, 1695316353, 130817436,
+            241361272,  2991729,    614283635,  2429519689, 3580373360, 3815050491, 2853499801,
+            3944575309, 3799231378, 3232641424, 4147543567, 2661140819, 3039521979, 2128096735,
+            3925101014, 77007692,   4271405727, 1931135020, 1730327003, 4227451343, 3350057541,
+            52716277,   3077709418, 1392223690, 2271336377, 1221310831, 3244710740, 3027196048,
+            951512069,  3788838665, 3695191015, 2583791644, 3184284848, 4270756437, 870959799,
+            4287135122, 3235439075, 2846989612, 1605494426, 1920016216, 3382447807, 2252198560,
+            1720091831, 158457387,  269586053,  618294917,  3138761099, 3252953947, 1047422816,
+            2783693389, 3457846749, 3919321868, 4152690968, 4119342476, 2948784909, 1461546579,
+            2766378394, 3880331470, 809553968,  3308305215, 2083620267, 2553480615, 2895619603,
+            3583706757, 3281764655, 2624645309, 3467694144, 1938292370, 1286647992, 4099746761,
+            3632110039, 2256363802, 3758007415, 2533277704, 2395717786, 2149902577, 3454620772,
+            3072974415, 1812806089, 1435100441, 2800761482, 426926172,  2615153086, 1192769705,
+            3854348587, 3564173630, 701981526,  2376778332, 3428905907, 3880145332, 1154017761,
+            3026271698, 817299222,  2785852244, 1711478134, 353258987,  630268438,  4210056163,
+            619110921,  3660678614, 4210050689, 1068519850, 2462993828, 490557017,  3771137114,
+            1560858269, 2427202756, 289915583,  59050083,   3787231351, 2165691481, 1691474216,
+            1434224488, 3715997629, 3178775669, 4185237236, 223377078,  1208068242, 1794529753,
+            3968345446, 1901404228, 234735681,  3125039483, 2987795652, 3062173909, 1284734545,
+            2591949956, 3642374443, 2742295700, 4143255952, 2842246952, 608501171,  3617392123,
+            2180679837, 3958201904, 3114935148, 2380604184, 2037094423, 2888013965, 3586563023,
+            822047364,  1373476105, 448546760,  2536391331, 2599917847, 513884140,  1001513148,
+            681757539,  2463853258, 3797105798, 365304032,  862825925,  2221830179, 3324615744,
+            377827447,  1645474192, 3912488284, 2854706373, 3985320249, 2290569400, 1857604352,
+            1624910456, 1626835977, 1147843962, 3567596083, 3422882560, 794822651,  2239034466,
+            1852409135, 2350526141,
+        },
+        {
+            3810471203, 1017064446, 1595207573, 441087832,  3326746890, 3294064431, 167972517,
+            3625210015, 1011845006, 2980240819, 1778354660, 3041730987, 1598611350, 2015169745,
+            2321724978, 3390812967, 2432904511, 113261909,  3957193232, 3806115908, 2965828929,
+            2035392295, 3500116619, 2881232416, 1672212265, 1607201428, 425148945,  1262591961,
+            2221781268, 4215047456, 2148245850, 2787488981, 1077262192, 2085467561, 3053954888,
+            3584435116, 3013084787, 287099941,  1290407232, 4078552287, 2658945475, 4251530898,
+            2403086478, 2884923598, 3545110453, 4105390090, 343200643,  3189888821, 4086304363,
+            3466483195, 259435633,  2846377387, 497258846,  272775541,  985737911,  2957688879,
+            2180784344, 3434619542, 3643384838, 2228652440, 3107480718, 2208729807, 596436263,
+            3255120711, 3248886970, 519242965,  602979109,  1619614,    1391563565, 56262588,
+            1584463910, 1849038201, 728022295,  848624947,  1813827408, 428214945,  1246345586,
+            4213351865, 168985863,  456608054,  4277869380, 3886828599, 2264054549, 3110967170,
+            3138175314, 2649164828, 3369378320, 3648350039, 3524848759, 1468470706, 3558859222,
+            2669673235, 831851874,  4285651092, 4224147373, 1088456706, 231954609,  3118005852,
+            225508069,  883105389,  856371341,  2001356578, 639336670,  2363501707, 3622399552,
+            4024065226, 1093546838, 4263608561, 1852072422, 425195042,  2441102396, 296426333,
+            384641750,  3559334435, 1757327033, 1016016207, 3595686646, 24777793,   623926105,
+            2169195923, 1779396793, 646997837,  1459728476, 2644865980, 1994581089, 3956278544,
+            919592580,  2153558858, 2029633394, 3837501009, 4016560170, 484838096,  3652199054,
+            1971790561, 605295089,  637470291,  278970544,  3574824693, 295866521,  1755035156,
+            2542341803, 1588716357, 1502596918, 4124554133, 3547049843, 1768033045, 1531734630,
+            101448323,  3233017580, 1793222944, 3187853500, 186000900,  803444571,  2820254958,
+            2009384608, 2384668855, 2222812920, 633608665,  2028480056, 1258028235, 545095949,
+            3810471203, 1017064446, 1595207573, 441087832,  899068662,  3294064431, 167972517,
+            3625210015, 1011845006, 3951305793, 1778354660, 3041730987, 1598611350, 2015169745,
+            1885149424, 3390812967, 2432904511, 113261909,  3957193232, 3953443155, 2965828929,
+            2035392295, 3500116619, 2881232416, 329153573,  1607201428, 425148945,  1262591961,
+            2221781268, 78028761,   2148245850, 2787488981, 1077262192, 2085467561, 647235899,
+            3584435116, 3013084787, 287099941,  1290407232, 1467385694, 2658945475, 4251530898,
+            2403086478, 2884923598, 3489351040, 4105390090, 343200643,  3189888821, 4086304363,
+            3521512280, 259435633,  2846377387, 497258846,  272775541,  1367093111, 2957688879,
+            2180784344, 3434619542, 3643384838, 411877686,  3107480718, 2208729807, 596436263,
+            3255120711, 584605030,  519242965,  602979109,  1619614,    1391563565, 3902518209,
+            1584463910, 1849038201, 728022295,  848624947,  1932969318, 428214945,  1246345586,
+            4213351865, 168985863,  2770345237, 4277869380, 3886828599, 2264054549, 3110967170,
+            2953581033, 2649164828, 3369378320, 3648350039, 3524848759, 2380353977, 3558859222,
+            2669673235, 831851874,  4285651092, 1214052447, 1088456706, 231954609,  3118005852,
+            225508069,  1766983646, 856371341,  2001356578, 639336670,  2363501707, 1782816591,
+            4024065226, 1093546838, 4263608561, 1852072422, 1149716600, 2441102396, 296426333,
+            384641750,  3559334435, 2391309970, 1016016207, 3595686646, 24777793,   623926105,
+            362098678,  1779396793, 646997837,  1459728476, 2644865980, 3238673748, 3956278544,
+            919592580,  2153558858, 2029633394, 115778559,  4016560170, 484838096,  3652199054,
+            1971790561, 737357475,  637470291,  278970544,  3574824693, 295866521,  3989745853,
+            2542341803, 1588716357, 1502596918, 4124554133, 3016849744, 1768033045, 1531734630,
+            101448323,  3233017580, 4157527581, 3187853500, 186000900,  803444571,  2820254958,
+            1980528062, 2384668855, 2222812920, 633608665,  2028480056, 3166710281, 545095949,
+            3810471203, 1017064446, 1595207573, 693962828,  899068662,  3294064431, 167972517,
+            3625210015, 1486040398, 3951305793, 1778354660, 3041730987, 1598611350, 2859363132,
+            1885149424, 3390812967, 2432904511, 113261909,  664880478,  3953443155, 2965828929,
+            2035392295, 3500116619, 558081801,  329153573,  1607201428, 425148945,  1262591961,
+            3716247699, 78028761,   2148245850, 2787488981, 1077262192, 4206362947, 647235899,
+            3584435116, 3013084787, 287099941,  2536781098, 1467385694, 2658945475, 4251530898,
+            2403086478, 3075072413, 3489351040, 4105390090, 343200643,  3189888821, 2540485172,
+            3521512280, 259435633,  2846377387, 497258846,  2442427327, 1367093111, 2957688879,
+            2180784344, 3434619542, 1593967423, 411877686,  3107480718, 2208729807, 596436263,
+            1048686529, 584605030,  519242965,  602979109,  1619614,    2072745381, 3902518209,
+            1584463910, 1849038201, 728022295,  846033949,  1932969318, 428214945,  1246345586,
+            4213351865, 1066373275, 2770345237, 4277869380, 3886828599, 2264054549, 1877859690,
+            2953581033, 2649164828, 3369378320, 3648350039, 2537763389, 2380353977, 3558859222,
+            2669673235, 831851874,  522748140,  1214052447, 1088456706, 231954609,  3118005852,
+            1381269315, 1766983646, 856371341,  2001356578, 639336670,  667275675,  1782816591,
+            4024065226, 1093546838, 4263608561, 2057337961, 1149716600, 2441102396, 296426333,
+            384641750,  340523210,  2391309970, 1016016207, 3595686646, 24777793,   3094832341,
+            362098678,  1779396793, 646997837,  1459728476, 1169681568, 3238673748, 3956278544,
+            919592580,  2153558858, 388335108,  115778559,  4016560170, 484838096,  3652199054,
+            1764858181, 737357475,  637470291,  278970544,  3574824693, 3671458900, 3989745853,
+            2542341803, 1588716357, 1502596918, 2102871406, 3016849744, 1768033045, 1531734630,
+            101448323,  3964942332, 4157527581, 3187853500, 186000900,  803444571,  3425652083,
+            1980528062, 2384668855, 2222812920, 633608665,  3035373876, 3166710281, 545095949,
+            3810471203, 1017064446, 669282349,  693962828,  899068662,  3294064431, 167972517,
+            2007256988, 1486040398, 3951305793, 1778354660, 3041730987, 2827768941, 2859363132,
+            1885149424, 3390812967, 2432904511, 3700915653, 664880478,  3953443155, 2965828929,
+            2035392295, 1461208330, 558081801,  329153573,  1607201428, 425148945,  1700881129,
+            3716247699, 78028761,   2148245850, 2787488981, 2706775080, 4206362947, 647235899,
+            3584435116, 3013084787, 2958545221, 2536781098, 1467385694, 2658945475, 4251530898,
+            2241012567, 3075072413, 3489351040, 4105390090, 343200643,  490164649,  2540485172,
+            3521512280, 259435633,  2846377387, 4073611831, 2442427327, 1367093111, 2957688879,
+            2180784344, 1835510773, 1593967423, 411877686,  3107480718, 2208729807, 3306732468,
+            1048686529, 584605030,  519242965,  602979109,  2978864605, 2072745381, 3902518209,
+            1584463910, 1849038201, 3284115169, 846033949,  1932969318, 428214945,  1246345586,
+            194166002,  1066373275, 2770345237, 4277869380, 3886828599, 1874087886, 1877859690,
+            2953581033, 2649164828, 3369378320, 4145454028, 2537763389, 2380353977, 3558859222,
+            2669673235, 739345884,  522748140,  1214052447, 1088456706, 231954609,  3605603781,
+            1381269315, 1766983646, 856371341,  2001356578, 2049940324, 667275675,  1782816591,
+            4024065226, 1093546838, 152524382,  2057337961, 1149716600, 2441102396, 296426333,
+            3195130788, 340523210,  2391309970, 1016016207, 3595686646, 180492441,  3094832341,
+            362098678,  1779396793, 646997837,  2458167607, 1169681568, 3238673748, 3956278544,
+            919592580,  3421005218, 388335108,  115778559,  4016560170, 484838096,  2649676374,
+            1764858181, 737357475,  637470291,  278970544,  2236401278, 3671458900, 3989745853,
+            2542341803, 1588716357, 1241570134, 2102871406, 3016849744, 1768033045, 1531734630,
+            1765654724, 3964942332, 4157527581, 3187853500, 186000900,  2189716659, 3425652083,
+            1980528062, 2384668855, 2222812920, 3955466207, 2426547616, 3846752458, 3015538636,
+            2342593365, 3613176865, 3484860981, 4278370194, 1979143878, 1159739458, 3714038404,
+            396530346,  3276617756, 3293940597, 4050183149, 1418571985, 402563753,  2702853013,
+            2289900621, 2267058511, 3482161995, 3375026019, 1988640267, 3674438074, 4124612310,
+            1057883705, 434730475,  3210959778, 4102029739, 2140938750, 3176753074, 2356971512,
+            3969685288, 1556275580, 2648433428, 3959375381, 478841344,  1496991528, 3309714981,
+            569990368,  3660587501, 2550379574, 1177519842, 2652707373, 543943404,  1912551128,
+            2278132032, 1484596780, 3570913985, 2982401320, 1413776035, 3177275459, 3036211597,
+            1091740466, 3448424311, 1445187645, 3205024875, 3135795254, 823738729,  3742134467,
+            4066657438, 1226311678, 2403605393, 537573634,  3457409768, 1940233423, 1761431281,
+            1129427309, 2443661283, 3200814257, 4094866249, 2666869754, 604785127,  2213464116,
+            3002782918, 468024929,  2490681314, 3666681384, 1583346053, 3049668798, 3592153237,
+            2573082448, 3082970021, 1461796708, 832526980,  3728763274, 355291229,  4029588456,
+            832358279,  2125298737, 3681181038, 3245535160, 1333342738, 1868897492, 446790068,
+            1278093154, 2090118615, 4158925515, 4062165914, 822726809,  1154960183, 286518382,
+            1170424276, 2554691236, 3674133415, 2765714969, 2330865375, 1908307334, 3537287082,
+            410252600,  3977128218, 424210327,  2919071615, 2715518134, 64568844,   480972649,
+            2488797168, 1302817038, 2213995265, 4229997295, 2200797852, 109368057,  3033807022,
+            1907400078, 645977948,  1410909090, 3700787906, 3375062371, 629087832,  1344281719,
+            4249981139, 3457543297, 1218556849, 864222854,  1458445945, 914545469,  3451164212,
+            1088025757, 1129933985, 953788883,  2406172924, 170364546,  3505490646, 1027553899,
+            2864067776, 436854871,  1342782209, 761167471,  2660173631, 4159507498, 4172028400,
+            2442254644, 2110123720, 2315991253, 873066601,  1725470559, 3831299052, 678672031,
+            1585431329, 3495750550,
+        },
+        {
+            443822763,  2617975176, 3254044970, 1660258831, 83579601,   1808539465, 317885672,
+            3991427137, 3321564893, 268585981,  1229400339, 3047551438, 2972941475, 4215493850,
+            566964640,  3688585429, 3339063541, 3534646061, 4186461028, 1286953281, 2598882345,
+            2383770576, 731405653,  2880475907, 1040589184, 3009480184, 1208201220, 1827920473,
+            1794801377, 3982078619, 742140518,  3971280655, 1193278016, 3169150563, 313287645,
+            1831105827, 2731649953, 2404393252, 924461258,  2677319062, 2948772966, 937895795,
+            4189679732, 1774271828, 2677727602, 2707002233, 1809047411, 661004983,  3014267383,
+            2872139608, 3968587297, 19885975,   543152887,  366391029,  722324037,  1913211813,
+            146321786,  1997608519, 592650622,  1044778758, 3832189925, 3612680318, 2368236502,
+            3064266221, 981157115,  1627679873, 1799333574, 834335418,  1498039174, 2805033332,
+            1998016692, 1169957544, 1895071516, 1069647228, 1480489520, 3966691071, 3103927323,
+            2431237369, 2137206113, 2353809068, 1068011303, 2520651972, 2499924180, 3686002233,
+            3687347316, 788249577,  2896504415, 3759760094, 4014757389, 2024401878, 2300962374,
+            4119410323, 2441666788, 2786492592, 579299204,  4122027806, 311807642,  3219204958,
+            150608954,  2022629101, 3790300010, 3662519329, 4052037551, 4248835625, 1718235383,
+            2958660371, 1735279524, 1378834913, 1216129888, 2437510690, 2676923343, 1599285231,
+            3753618998, 480529245,  3087281583, 550426644,  3736836926, 2485041496, 1737549696,
+            1645102176, 1200055703, 3260394491, 940980471,  2623481712, 557314689,  1019099714,
+            3916495751, 3969283486, 1943011707, 2345285361, 483435037,  2321927081, 3188348849,
+            1766202170, 2785488406, 2113378713, 2144453617, 1471687985, 334794809,  293421420,
+            1446462098, 2522107873, 779958686,  3335813282, 766374152,  766890676,  655476498,
+            289677673,  2505730670, 2939590586, 1929433288, 4281171844, 986273287,  1561174708,
+            1447107231, 3704800272, 777744840,  2069677978, 414840083,  3152336277, 4184350749,
+            443822763,  2617975176, 3254044970, 1660258831, 2908796181, 1808539465, 317885672,
+            3991427137, 3321564893, 772854637,  1229400339, 3047551438, 2972941475, 4215493850,
+            477447548,  3688585429, 3339063541, 3534646061, 4186461028, 488767979,  2598882345,
+            2383770576, 731405653,  2880475907, 3543144493, 3009480184, 1208201220, 1827920473,
+            1794801377, 3866001719, 742140518,  3971280655, 1193278016, 3169150563, 2481140666,
+            1831105827, 2731649953, 2404393252, 924461258,  761267842,  2948772966, 937895795,
+            4189679732, 1774271828, 403871172,  2707002233, 1809047411, 661004983,  3014267383,
+            3879775701, 3968587297, 19885975,   543152887,  366391029,  3542671199, 1913211813,
+            146321786,  1997608519, 592650622,  1309467735, 3832189925, 3612680318, 2368236502,
+            3064266221, 755548658,  1627679873, 1799333574, 834335418,  1498039174, 2702935557,
+            1998016692, 1169957544, 1895071516, 1069647228, 66509916,   3966691071, 3103927323,
+            2431237369, 2137206113, 1949363292, 1068011303, 2520651972, 2499924180, 3686002233,
+            736508513,  788249577,  2896504415, 3759760094, 4014757389, 2209946842, 2300962374,
+            4119410323, 2441666788, 2786492592, 1146775182, 4122027806, 311807642,  3219204958,
+            150608954,  4225852770, 3790300010, 3662519329, 4052037551, 4248835625, 997662360,
+            2958660371, 1735279524, 1378834913, 1216129888, 774488397,  2676923343, 1599285231,
+            3753618998, 480529245,  593086335,  550426644,  3736836926, 2485041496, 1737549696,
+            544025459,  1200055703, 3260394491, 940980471,  2623481712, 1453424658, 1019099714,
+            3916495751, 3969283486, 1943011707, 953496058,  483435037,  2321927081, 3188348849,
+            1766202170, 3696561411, 2113378713, 2144453617, 1471687985, 334794809,  2819725485,
+            1446462098, 2522107873, 779958686,  3335813282, 788019418,  766890676,  655476498,
+            289677673,  2505730670, 2450394548, 1929433288, 4281171844, 986273287,  1561174708,
+            531305960,  3704800272, 777744840,  2069677978, 414840083,  1984992764, 4184350749,
+            443822763,  2617975176, 3254044970, 2383298053, 2908796181, 1808539465, 317885672,
+            3991427137, 4121461164, 772854637,  1229400339, 3047551438, 2972941475, 10090604,
+            477447548,  3688585429, 3339063541, 3534646061, 3746127528, 488767979,  2598882345,
+            2383770576, 731405653,  1407818058, 3543144493, 3009480184, 1208201220, 1827920473,
+            2908141953, 3866001719, 742140518,  3971280655, 1193278016, 4199758007, 2481140666,
+            1831105827, 2731649953, 2404393252, 3417769941, 761267842,  2948772966, 937895795,
+            4189679732, 2179112981, 403871172,  2707002233, 1809047411, 661004983,  359685773,
+            3879775701, 3968587297, 19885975,   543152887,  442036819,  3542671199, 1913211813,
+            146321786,  1997608519, 1247905547, 1309467735, 3832189925, 3612680318, 2368236502,
+            3955518778, 755548658,  1627679873, 1799333574, 834335418,  857000832,  2702935557,
+            1998016692, 1169957544, 1895071516, 1275870005, 66509916,   3966691071, 3103927323,
+            2431237369, 3300337481, 1949363292, 1068011303, 2520651972, 2499924180, 77121214,
+            736508513,  788249577,  2896504415, 3759760094, 3512317936, 2209946842, 2300962374,
+            4119410323, 2441666788, 4183005285, 1146775182, 4122027806, 311807642,  3219204958,
+            261580567,  4225852770, 3790300010, 3662519329, 4052037551, 323897843,  997662360,
+            2958660371, 1735279524, 1378834913, 323957150,  774488397,  2676923343, 1599285231,
+            3753618998, 1921232288, 593086335,  550426644,  3736836926, 2485041496, 3602163236,
+            544025459,  1200055703, 3260394491, 940980471,  1028398083, 1453424658, 1019099714,
+            3916495751, 3969283486, 393822731,  953496058,  483435037,  2321927081, 3188348849,
+            285532832,  3696561411, 2113378713, 2144453617, 1471687985, 69322298,   2819725485,
+            1446462098, 2522107873, 779958686,  1787836942, 788019418,  766890676,  655476498,
+            289677673,  2660626516, 2450394548, 1929433288, 4281171844, 986273287,  2548103379,
+            531305960,  3704800272, 777744840,  2069677978, 2747864397, 1984992764, 4184350749,
+            443822763,  2617975176, 1502436985, 2383298053, 2908796181, 1808539465, 317885672,
+            996189897,  4121461164, 772854637,  1229400339, 3047551438, 688295839,  10090604,
+            477447548,  3688585429, 3339063541, 4237469526, 3746127528, 488767979,  2598882345,
+            2383770576, 2090764278, 1407818058, 3543144493, 3009480184, 1208201220, 3861453329,
+            2908141953, 3866001719, 742140518,  3971280655, 3433119849, 4199758007, 2481140666,
+            1831105827, 2731649953, 1932519025, 3417769941, 761267842,  2948772966, 937895795,
+            1085066096, 2179112981, 403871172,  2707002233, 1809047411, 3634902634, 359685773,
+            3879775701, 3968587297, 19885975,   2414316707, 442036819,  3542671199, 1913211813,
+            146321786,  3511220895, 1247905547, 1309467735, 3832189925, 3612680318, 1245975354,
+            3955518778, 755548658,  1627679873, 1799333574, 3804960549, 857000832,  2702935557,
+            1998016692, 1169957544, 3104216487, 1275870005, 66509916,   3966691071, 3103927323,
+            720883648,  3300337481, 1949363292, 1068011303, 2520651972, 2823297395, 77121214,
+            736508513,  788249577,  2896504415, 275465265,  3512317936, 2209946842, 2300962374,
+            4119410323, 2844156698, 4183005285, 1146775182, 4122027806, 311807642,  1651130530,
+            261580567,  4225852770, 3790300010, 3662519329, 840597500,  323897843,  997662360,
+            2958660371, 1735279524, 633847174,  323957150,  774488397,  2676923343, 1599285231,
+            2134556840, 1921232288, 593086335,  550426644,  3736836926, 1569973061, 3602163236,
+            544025459,  1200055703, 3260394491, 1803108998, 1028398083, 1453424658, 1019099714,
+            3916495751, 1797728352, 393822731,  953496058,  483435037,  2321927081, 2525981247,
+            285532832,  3696561411, 2113378713, 2144453617, 2430836689, 69322298,   2819725485,
+            1446462098, 2522107873, 4255934708, 1787836942, 788019418,  766890676,  655476498,
+            3689654014, 2660626516, 2450394548, 1929433288, 4281171844, 1933604952, 2548103379,
+            531305960,  3704800272, 777744840,  2346268423, 3513447542, 365789810,  4221773731,
+            1997167178, 399644303,  278805852,  2000160893, 4283987314, 427779976,  86022759,
+            4252394781, 2999125664, 4015668879, 2585311752, 747522593,  2377240724, 729143413,
+            3395968510, 607029651,  4185577020, 3002590200, 386303436,  2531086146, 400493154,
+            1589736874, 3920104228, 620808218,  2380991923, 3010412828, 3275119027, 3122520593,
+            1938418498, 1007005076, 412587084,  2285442346, 2791174285, 4251631863, 899648696,
+            3977830462, 3072299666, 2058893468, 2633616229, 468027657,  3129569573, 3422026104,
+            2671860340, 2078006660, 2380613975, 2774849668, 2667749811, 1690480850, 2850211809,
+            145626046,  1908538286, 3804603854, 2707687629, 1528201205, 3047365029, 2366003425,
+            3196603519, 771159084,  2860270830, 246303818,  806924153,  337275004,  1702373349,
+            3995861271, 2312635050, 914382425,  594028299,  3629132222, 1175222666, 2514763313,
+            3564556054, 3427148192, 3760883051, 1033746703, 1252788961, 3057674925, 1110852300,
+            3454744521, 3940478195, 3671879894, 1705064014, 992369827,  1620069320, 1258078799,
+            3730583666, 807359987,  435362192,  2907216820, 1928577470, 914727315,  2114363539,
+            2506764652, 2444953425, 1959227314, 276989619,  3707534483, 2771040965, 3817012339,
+            1144156281, 2161494463, 1004604069, 4093513240, 787763001,  3209087068, 3233341032,
+            4083164658, 2765145621, 249753082,  3352263927, 3248940870, 896753599,  2908181799,
+            472903814,  538939279,  969923902,  218349811,  616695316,  2821188381, 1057414308,
+            1524605040, 4043115245, 4010819293, 2197606038, 1149831340, 2206296201, 7244326,
+            2415236713, 3663896723, 675306236,  1801134902, 2655765679, 3460457737, 1320407721,
+            982095310,  335726041,  2222986428, 3514175052, 1100321181, 1169446823, 3987066634,
+            3146943896, 110473933,  4214872633, 2443829303, 3209812205, 2464418393, 1051729562,
+            3847993444, 2077116464, 3921692036, 2596312396, 377413023,  1698604487, 4074659092,
+            3983886588, 833064172,
+        },
+        {
+            3336317990, 2823679145, 2226390960, 3609459872, 3756053195, 2365671487, 145398597,
+            1872149105, 2404394943, 4028684282, 3767733640, 192586050,  3760413164, 3254630431,
+            2513984934, 2185386403, 393893009,  1653951750, 1065514460, 912800580,  1975653282,
+            1941732369, 938312836,  1585442441, 3864374965, 4220882252, 188428696,  4284377359,
+            1452575945, 1528101113, 3892961065, 3768660555, 483633303,  2891138536, 491895148,
+            2944942955, 630970845,  2830757917, 657034669,  468118443,  895627959,  1813447732,
+            2895573973, 3734854602, 806066251,  4004380912, 2756225326, 1472362481, 3070071461,
+            448964053,  2382698102, 1006288235, 1758992015, 2985151270, 1792109897, 817430135,
+            2766456632, 3786654759, 97607533,   3148246490, 2851628527, 2837196716, 2238409296,
+            2852932160, 3569084571, 717944649,  2439957272, 157843852,  1473105711, 694532958,
+            2629207859, 2700535847, 1986970953, 2524085827, 1055652587, 3618234164, 203025706,
+            3544794001, 2887756918, 104206976,  843131132,  3124877954, 609878650,  959314774,
+            4072371883, 1003446568, 414728466,  229135517,  1056359437, 3656352175, 2918608862,
+            1498379917, 263362135,  1148743949, 3930001168, 1579186359, 4164488936, 1164167466,
+            584773713,  372332217,  1844510966, 2035324533, 1045774944, 1150981915, 710269990,
+            2584231446, 4192332376, 3410144822, 1929691693, 2993432680, 3459115174, 2744551838,
+            2457745107, 3506526245, 3526669254, 3024072201, 3461374832, 633629993,  2782297786,
+            470136457,  1013324175, 3960474772, 2012273160, 3110558324, 988097204,  932601609,
+            129046622,  4025600327, 1366542971, 2225633988, 3600209367, 295052150,  1573185184,
+            440137923,  2823549886, 1374941174, 1735376369, 2214353652, 2025321509, 3078080315,
+            2590783047, 101177658,  4220711061, 2592005614, 2318404445, 2946672807, 1337119051,
+            3483064233, 20630604,   1833617477, 2559724646, 2216215934, 1007866628, 426345848,
+            763356833,  3111770391, 3072328300, 1616116039, 444811888,  2473729218, 568099614,
+            3336317990, 2823679145, 2226390960, 3609459872, 1639843651, 2365671487, 145398597,
+            1872149105, 2404394943, 4169673132, 3767733640, 192586050,  3760413164, 3254630431,
+            1083968928, 2185386403, 393893009,  1653951750, 1065514460, 4150911098, 1975653282,
+            1941732369, 938312836,  1585442441, 701161344,  4220882252, 188428696,  4284377359,
+            1452575945, 625136847,  3892961065, 3768660555, 483633303,  2891138536, 4212055191,
+            2944942955, 630970845,  2830757917, 657034669,  3466129075, 895627959,  1813447732,
+            2895573973, 3734854602, 1414426410, 4004380912, 2756225326, 1472362481, 3070071461,
+            2586486097, 2382698102, 1006288235, 1758992015, 2985151270, 1303575780, 817430135,
+            2766456632, 3786654759, 97607533,   2445191262, 2851628527, 2837196716, 2238409296,
+            2852932160, 29141094,   717944649,  2439957272, 157843852,  1473105711, 2649640096,
+            2629207859, 2700535847, 1986970953, 2524085827, 3775772989, 3618234164, 203025706,
+            3544794001, 2887756918, 4121695068, 843131132,  3124877954, 609878650,  959314774,
+            105118759,  1003446568, 414728466,  229135517,  1056359437, 2264912329, 2918608862,
+            1498379917, 263362135,  1148743949, 173414538,  1579186359, 4164488936, 1164167466,
+            584773713,  467135798,  1844510966, 2035324533, 1045774944, 1150981915, 1087780156,
+            2584231446, 4192332376, 3410144822, 1929691693, 3243040958, 3459115174, 2744551838,
+            2457745107, 3506526245, 2202217364, 3024072201, 3461374832, 633629993,  2782297786,
+            3283993088, 1013324175, 3960474772, 2012273160, 3110558324, 2555290628, 932601609,
+            129046622,  4025600327, 1366542971, 206647651,  3600209367, 295052150,  1573185184,
+            440137923,  4240169314, 1374941174, 1735376369, 2214353652, 2025321509, 3186046315,
+            2590783047, 101177658,  4220711061, 2592005614, 574291884,  2946672807, 1337119051,
+            3483064233, 20630604,   2114247315, 2559724646, 2216215934, 1007866628, 426345848,
+            3587142541, 3111770391, 3072328300, 1616116039, 444811888,  183579455,  568099614,
+            3336317990, 2823679145, 2226390960, 169612023,  1639843651, 2365671487, 145398597,
+            1872149105, 411504961,  4169673132, 3767733640, 192586050,  3760413164, 627538413,
+            1083968928, 2185386403, 393893009,  1653951750, 3260199580, 4150911098, 1975653282,
+            1941732369, 938312836,  985023464,  701161344,  4220882252, 188428696,  4284377359,
+            596318894,  625136847,  3892961065, 3768660555, 483633303,  53940266,   4212055191,
+            2944942955, 630970845,  2830757917, 1948905723, 3466129075, 895627959,  1813447732,
+            2895573973, 2750756912, 1414426410, 4004380912, 2756225326, 1472362481, 1019001913,
+            2586486097, 2382698102, 1006288235, 1758992015, 1144744978, 1303575780, 817430135,
+            2766456632, 3786654759, 3965268160, 2445191262, 2851628527, 2837196716, 2238409296,
+            2682503809, 29141094,   717944649,  2439957272, 157843852,  1686930541, 2649640096,
+            2629207859, 2700535847, 1986970953, 4170734449, 3775772989, 3618234164, 203025706,
+            3544794001, 969030480,  4121695068, 843131132,  3124877954, 609878650,  2264162048,
+            105118759,  1003446568, 414728466,  229135517,  3216114055, 2264912329, 2918608862,
+            1498379917, 263362135,  3643847774, 173414538,  1579186359, 4164488936, 1164167466,
+            2718678667, 467135798,  1844510966, 2035324533, 1045774944, 3384149025, 1087780156,
+            2584231446, 4192332376, 3410144822, 3845827496, 3243040958, 3459115174, 2744551838,
+            2457745107, 2419890516, 2202217364, 3024072201, 3461374832, 633629993,  3210641338,
+            3283993088, 1013324175, 3960474772, 2012273160, 4284300719, 2555290628, 932601609,
+            129046622,  4025600327, 2703658964, 206647651,  3600209367, 295052150,  1573185184,
+            2596798630, 4240169314, 1374941174, 1735376369, 2214353652, 1605100875, 3186046315,
+            2590783047, 101177658,  4220711061, 389841129,  574291884,  2946672807, 1337119051,
+            3483064233, 1338147514, 2114247315, 2559724646, 2216215934, 1007866628, 573485412,
+            3587142541, 3111770391, 3072328300, 1616116039, 2038595411, 183579455,  568099614,
+            3336317990, 2823679145, 2247140784, 169612023,  1639843651, 2365671487, 145398597,
+            4129782472, 411504961,  4169673132, 3767733640, 192586050,  28142286,   627538413,
+            1083968928, 2185386403, 393893009,  571373052,  3260199580, 4150911098, 1975653282,
+            1941732369, 4257388891, 985023464,  701161344,  4220882252, 188428696,  2387376080,
+            596318894,  625136847,  3892961065, 3768660555, 2517155008, 53940266,   4212055191,
+            2944942955, 630970845,  3426794675, 1948905723, 3466129075, 895627959,  1813447732,
+            3180965870, 2750756912, 1414426410, 4004380912, 2756225326, 2234890842, 1019001913,
+            2586486097, 2382698102, 1006288235, 121170628,  1144744978, 1303575780, 817430135,
+            2766456632, 1994002757, 3965268160, 2445191262, 2851628527, 2837196716, 1658969765,
+            2682503809, 29141094,   717944649,  2439957272, 2478648994, 1686930541, 2649640096,
+            2629207859, 2700535847, 139573921,  4170734449, 3775772989, 3618234164, 203025706,
+            3731155701, 969030480,  4121695068, 843131132,  3124877954, 2730700923, 2264162048,
+            105118759,  1003446568, 414728466,  2550636536, 3216114055, 2264912329, 2918608862,
+            1498379917, 298527794,  3643847774, 173414538,  1579186359, 4164488936, 1476732675,
+            2718678667, 467135798,  1844510966, 2035324533, 2061257800, 3384149025, 1087780156,
+            2584231446, 4192332376, 100670281,  3845827496, 3243040958, 3459115174, 2744551838,
+            78113849,   2419890516, 2202217364, 3024072201, 3461374832, 4102031504, 3210641338,
+            3283993088, 1013324175, 3960474772, 1807806534, 4284300719, 2555290628, 932601609,
+            129046622,  1008014525, 2703658964, 206647651,  3600209367, 295052150,  1797254339,
+            2596798630, 4240169314, 1374941174, 1735376369, 1870261585, 1605100875, 3186046315,
+            2590783047, 101177658,  3986342311, 389841129,  574291884,  2946672807, 1337119051,
+            2315426104, 1338147514, 2114247315, 2559724646, 2216215934, 2968232884, 573485412,
+            3587142541, 3111770391, 3072328300, 1673177605, 1703053952, 2286364629, 3752021725,
+            1701595844, 3421980332, 3778448688, 1600445301, 4430870,    1564270030, 3277708777,
+            2392864577, 3493133514, 4033039340, 1574067140, 1617596418, 3929499933, 3337271413,
+            3126576257, 3288799286, 2142920662, 3878985322, 1983441430, 2081630271, 1937064293,
+            2939252268, 3025028274, 1050230816, 3497920999, 3497590444, 3151663200, 1175706314,
+            3638533770, 1294081440, 3267420855, 2347799505, 163227781,  1009611092, 4229858580,
+            3751513079, 3128996928, 1398720224, 4248969811, 2057599736, 3826594340, 3871192005,
+            2959165306, 3341653575, 4220746247, 2176026033, 1938111866, 3175571182, 2965329893,
+            1743462462, 1943750067, 339904404,  916507131,  993863895,  2349682056, 657899458,
+            631164435,  3660911688, 1233040920, 2882763371, 2435157380, 3947191121, 3568953613,
+            1760592746, 2492399430, 3729232738, 1274534350, 826586418,  1300157066, 2587194363,
+            3085070391, 635085995,  1235651902, 4202863035, 2609056829, 3833155979, 2305936158,
+            2131923600, 1930650669, 2467205632, 3461312853, 1562209529, 598386918,  4257403978,
+            1610849133, 128707511,  3910025822, 414639061,  1252388305, 2975958271, 902798224,
+            1680708404, 1270632436, 2148281531, 2824045186, 1048109849, 671593339,  902024685,
+            363980145,  1862323113, 2747270585, 3698652260, 1486627756, 2609033984, 1550258674,
+            3169362475, 1774141043, 3986755459, 2101065959, 693661873,  1885386966, 1046147314,
+            310433553,  571061939,  3356170540, 2564564851, 1170299285, 2189006359, 1634124782,
+            2704396006, 593112330,  4264860544, 178820237,  2268305358, 2055704015, 181506927,
+            2183015097, 1973427404, 2502895848, 2534744257, 837555919,  679332826,  2696280310,
+            1765901323, 3840446550, 298238226,  859358994,  1547774531, 65720072,   3188587107,
+            610389028,  2673672011, 1925594860, 1710931461, 1203782057, 3898796302, 3416990408,
+            1101642736, 241908042,  1886381017, 3908939711, 3822575599, 1396472923, 1897057599,
+            2765995698, 497313701,
+        },
+        {
+            1998393432, 2665389278, 3989307699, 3267631636, 3861682977, 3243522970, 1243992413,
+            2200497260, 3821883021, 4187123083, 3451270040, 3044132745, 2101287249, 2340839784,
+            227040990,  1724350416, 3228881240, 3123386528, 4279362126, 3098224464, 2635534069,
+            3622906431, 206207480,  1894245533, 2152374527, 1011223653, 7271757,    2972858087,
+            207942127,  3355362797, 2593296740, 174093751,  3713822176, 4212355586, 3335605224,
+            1171716408, 2867257989, 1522213957, 2016192462, 4229688395, 2174928148, 1468226225,
+            3938290338, 493240317,  3229423344, 2585475729, 3112454413, 1881171707, 2555908056,
+            1997546352, 380428329,  3341885423, 3307510279, 3519476676, 3613100811, 2555826262,
+            109341943,  2382715395, 3883409616, 1593551879, 2163678014, 3379783137, 2810374300,
+            1516064864, 561144874,  316017838,  1899237567, 70857401,   3435185465, 4234661323,
+            2580352177, 32879620,   4171670150, 1986234067, 3589478191, 2073132526, 2603712175,
+            377997975,  2474419397, 3110698341, 812664089,  1778922726, 1686111212, 972784138,
+            3936486236, 2711468739, 423435866,  1661961159, 802312780,  1868728136, 1760295704,
+            3357409828, 215039860,  683184627,  4019111064, 3609261689, 2167554309, 1831085281,
+            3389357802, 4193421575, 628277197,  2900207619, 993609502,  3429627083, 2636466084,
+            3652352199, 1780133580, 1670387713, 4086070210, 4004540729, 783029246,  2165667566,
+            1739001057, 377639972,  1102689625, 1945278055, 3941185940, 3685368326, 1881761572,
+            2201338934, 801752,     2729497735, 492844690,  2998826141, 3844964457, 3679088359,
+            2196391660, 4222269404, 357321611,  3727170055, 1819614072, 2348798457, 4294366646,
+            1952884323, 3574345216, 2040734807, 232392443,  4183498179, 2614866055, 112120292,
+            3624018350, 3340709877, 3097507723, 1268833488, 3570501956, 3338260086, 293812421,
+            3683058169, 1147960351, 283731890,  2171233479, 1830154455, 4036602681, 1996981699,
+            132803834,  40256165,   2158110401, 3575159090, 3196553513, 3559872992, 3402884675,
+            1998393432, 2665389278, 3989307699, 3267631636, 3617519767, 3243522970, 1243992413,
+            2200497260, 3821883021, 3715729085, 3451270040, 3044132745, 2101287249, 2340839784,
+            3173635549, 1724350416, 3228881240, 3123386528, 4279362126, 2287520039, 2635534069,
+            3622906431, 206207480,  1894245533, 96723416,   1011223653, 7271757,    2972858087,
+            207942127,  1668335352, 2593296740, 174093751,  3713822176, 4212355586, 49226793,
+            1171716408, 2867257989, 1522213957, 2016192462, 118712412,  2174928148, 1468226225,
+            3938290338, 493240317,  3788174304, 2585475729, 3112454413, 1881171707, 2555908056,
+            3351139844, 380428329,  3341885423, 3307510279, 3519476676, 1368994724, 2555826262,
+            109341943,  2382715395, 3883409616, 1561509458, 2163678014, 3379783137, 2810374300,
+            1516064864, 2313252274, 316017838,  1899237567, 70857401,   3435185465, 2585770746,
+            2580352177, 32879620,   4171670150, 1986234067, 3317983509, 2073132526, 2603712175,
+            377997975,  2474419397, 908728599,  812664089,  1778922726, 1686111212, 972784138,
+            1992540005, 2711468739, 423435866,  1661961159, 802312780,  907108769,  1760295704,
+            3357409828, 215039860,  683184627,  2806826652, 3609261689, 2167554309, 1831085281,
+            3389357802, 2755692689, 628277197,  2900207619, 993609502,  3429627083, 3605915742,
+            3652352199, 1780133580, 1670387713, 4086070210, 3717326627, 783029246,  2165667566,
+            1739001057, 377639972,  2355216626, 1945278055, 3941185940, 3685368326, 1881761572,
+            4024097818, 801752,     2729497735, 492844690,  2998826141, 2719601647, 3679088359,
+            2196391660, 4222269404, 357321611,  1319821972, 1819614072, 2348798457, 4294366646,
+            1952884323, 3573866689, 2040734807, 232392443,  4183498179, 2614866055, 440744432,
+            3624018350, 3340709877, 3097507723, 1268833488, 224895395,  3338260086, 293812421,
+            3683058169, 1147960351, 3433425235, 2171233479, 1830154455, 4036602681, 1996981699,
+            2875889721, 40256165,   2158110401, 3575159090, 3196553513, 1094082574, 3402884675,
+            1998393432, 2665389278, 3989307699, 4068940467, 3617519767, 3243522970, 1243992413,
+            2200497260, 441678457,  3715729085, 3451270040, 3044132745, 2101287249, 2181502237,
+            3173635549, 1724350416, 3228881240, 3123386528, 1968352124, 2287520039, 2635534069,
+            3622906431, 206207480,  2065093599, 96723416,   1011223653, 7271757,    2972858087,
+            1094044749, 1668335352, 2593296740, 174093751,  3713822176, 2887397643, 49226793,
+            1171716408, 2867257989, 1522213957, 984348433,  118712412,  2174928148, 1468226225,
+            3938290338, 2279430036, 3788174304, 2585475729, 3112454413, 1881171707, 4247636500,
+            3351139844, 380428329,  3341885423, 3307510279, 2887754196, 1368994724, 2555826262,
+            109341943,  2382715395, 2836761616, 1561509458, 2163678014, 3379783137, 2810374300,
+            1635278016, 2313252274, 316017838,  1899237567, 70857401,   3481535811, 2585770746,
+            2580352177, 32879620,   4171670150, 2248003250, 3317983509, 2073132526, 2603712175,
+            377997975,  3286162818, 908728599,  812664089,  1778922726, 1686111212, 4024815755,
+            1992540005, 2711468739, 423435866,  1661961159, 2257259057, 907108769,  1760295704,
+            3357409828, 215039860,  3917391198, 2806826652, 3609261689, 2167554309, 1831085281,
+            4238043113, 2755692689, 628277197,  2900207619, 993609502,  2036092353, 3605915742,
+            3652352199, 1780133580, 1670387713, 118446953,  3717326627, 783029246,  2165667566,
+            1739001057, 203160626,  2355216626, 1945278055, 3941185940, 3685368326, 546361979,
+            4024097818, 801752,     2729497735, 492844690,  1023017124, 2719601647, 3679088359,
+            2196391660, 4222269404, 621859651,  1319821972, 1819614072, 2348798457, 4294366646,
+            1114888560, 3573866689, 2040734807, 232392443,  4183498179, 3959504609, 440744432,
+            3624018350, 3340709877, 3097507723, 3613295037, 224895395,  3338260086, 293812421,
+            3683058169, 1655305863, 3433425235, 2171233479, 1830154455, 4036602681, 3731384097,
+            2875889721, 40256165,   2158110401, 3575159090, 1847744924, 1094082574, 3402884675,
+            1998393432, 2665389278, 3781866777, 4068940467, 3617519767, 3243522970, 1243992413,
+            2723708256, 441678457,  3715729085, 3451270040, 3044132745, 4013832842, 2181502237,
+            3173635549, 1724350416, 3228881240, 2092292494, 1968352124, 2287520039, 2635534069,
+            3622906431, 3186333458, 2065093599, 96723416,   1011223653, 7271757,    649658033,
+            1094044749, 1668335352, 2593296740, 174093751,  4159420309, 2887397643, 49226793,
+            1171716408, 2867257989, 2590077953, 984348433,  118712412,  2174928148, 1468226225,
+            1065322711, 2279430036, 3788174304, 2585475729, 3112454413, 3932517386, 4247636500,
+            3351139844, 380428329,  3341885423, 1285273904, 2887754196, 1368994724, 2555826262,
+            109341943,  2318470582, 2836761616, 1561509458, 2163678014, 3379783137, 674658583,
+            1635278016, 2313252274, 316017838,  1899237567, 2192372173, 3481535811, 2585770746,
+            2580352177, 32879620,   300323274,  2248003250, 3317983509, 2073132526, 2603712175,
+            3086543917, 3286162818, 908728599,  812664089,  1778922726, 2263290659, 4024815755,
+            1992540005, 2711468739, 423435866,  819027349,  2257259057, 907108769,  1760295704,
+            3357409828, 1142221093, 3917391198, 2806826652, 3609261689, 2167554309, 4108155875,
+            4238043113, 2755692689, 628277197,  2900207619, 3041719497, 2036092353, 3605915742,
+            3652352199, 1780133580, 2397410862, 118446953,  3717326627, 783029246,  2165667566,
+            2721690354, 203160626,  2355216626, 1945278055, 3941185940, 2768842108, 546361979,
+            4024097818, 801752,     2729497735, 4045063232, 1023017124, 2719601647, 3679088359,
+            2196391660, 2666107451, 621859651,  1319821972, 1819614072, 2348798457, 3555102623,
+            1114888560, 3573866689, 2040734807, 232392443,  3359040541, 3959504609, 440744432,
+            3624018350, 3340709877, 1477919696, 3613295037, 224895395,  3338260086, 293812421,
+            4210187101, 1655305863, 3433425235, 2171233479, 1830154455, 4150241150, 3731384097,
+            2875889721, 40256165,   2158110401, 3350246687, 455561037,  2250400255, 3192153445,
+            3258870230, 1500391873, 4142878334, 1155955691, 1483275844, 4189436981, 323745948,
+            1976017426, 2804626790, 2717553615, 2315409034, 954508235,  3845175920, 3999878682,
+            1247696432, 1743319509, 2998248398, 3694350012, 4072006361, 191306987,  2816321878,
+            1324077734, 1083060006, 3406855480, 1619622379, 2160350,    3302238190, 3368021261,
+            3685228564, 3863934685, 771728612,  854205233,  2304696695, 421449207,  1265752117,
+            3852292419, 305345788,  1540622105, 1904883477, 833469256,  134406680,  3012455058,
+            4035477953, 2925192459, 1559200592, 3851612860, 718484562,  1377960276, 1586892849,
+            1361298269, 3417917896, 1281324499, 1012538763, 1350578667, 3946475598, 2982283954,
+            3548792804, 284542749,  1194648577, 3087899716, 3966595444, 2088330116, 3641652062,
+            327128507,  593906557,  1092448919, 2459189516, 4053392241, 3356198248, 2352376508,
+            470648997,  1017041256, 3234172340, 3928191489, 3266226858, 4219289150, 1229098319,
+            4275351308, 2720777751, 3566728718, 638322822,  2369792461, 2869492261, 3120083828,
+            1890399556, 3309991008, 3785452464, 4128660314, 3726791982, 167177896,  461294981,
+            3988638998, 2937794823, 3981029822, 1111681402, 2015965721, 7261806,    2669786265,
+            1083582734, 3270228881, 3892235938, 2695872715, 4246051290, 3214293333, 343604199,
+            3215604888, 661024127,  2931754053, 3787840039, 2053363765, 363432336,  112334132,
+            2871797223, 138911320,  3981126938, 2027332192, 1804730644, 590150270,  641538574,
+            6802174,    3551446076, 3908480472, 1004531022, 2097228524, 1919074232, 154482247,
+            121437972,  1215661323, 1178068273, 1097220699, 2823681422, 262636065,  2943371149,
+            1768780720, 3866040605, 1855991583, 3988248086, 629223947,  3380612330, 3552916762,
+            197596340,  573801686,  2049230598, 2910471867, 2686314264, 1726228846, 3516983332,
+            726840185,  1241204222, 2237574317, 70568042,   1932610099, 2221862221, 1510378092,
+            4050391637, 4077539568,
+        },
+        {
+            2717028258, 2739588353, 304692552,  3854553410, 1644403021, 953104582,  310645891,
+            831151463,  4187298422, 2978618542, 1281329387, 305609511,  1589677361, 617996646,
+            2667417533, 1704011305, 1768939903, 4007300010, 3211593113, 3328643113, 2601169090,
+            2921209689, 1950033261, 2408016015, 3748151706, 1741057683, 1898856554, 3932635230,
+            3641412297, 1087991123, 2077065462, 3222040609, 2872478649, 1392755422, 3203620101,
+            2303092249, 2960843883, 1668070824, 2045221400, 1768264883, 3770407342, 2321030261,
+            4191547374, 3274404965, 3856550949, 1611985837, 82530455,   1832283505, 3637022272,
+            1834922727, 1206267699, 1858056966, 3439257685, 1626599114, 1311885747, 1180969878,
+            2677354534, 653745134,  3954831020, 513219139,  3714449985, 2292702182, 1202820072,
+            74612494,   1182760691, 3969773959, 1175119685, 469041447,  513644452,  332799123,
+            2888093264, 681786619,  2889979259, 476341791,  2551273623, 295527045,  1482124259,
+            2743690437, 124311530,  2911253228, 1401800807, 621017536,  1907850553, 551862893,
+            1775148832, 1817701301, 2257755896, 4113032023, 1141672939, 2652195098, 3325859678,
+            2193021895, 2634675948, 2790892626, 2216808495, 1543291372, 3459843642, 2927030805,
+            1989287459, 3838113177, 2656261116, 3056628243, 1656669994, 2063779200, 3610882949,
+            3839008945, 2207921905, 551636805,  3952598762, 2431218753, 1795913136, 2855134387,
+            3564478078, 134611785,  4174618635, 297290528,  1802923511, 400850027,  2160248452,
+            4103054802, 1668453253, 1965941631, 22301980,   1268915561, 1586631850, 3717790919,
+            2223176410, 964392544,  1193663126, 583735974,  1338288925, 1827290914, 1963329812,
+            1736395536, 525480969,  1902177589, 73097908,   3722560733, 2441283385, 2341714620,
+            2843683899, 572435561,  3494904043, 1713891341, 2710192862, 1367741017, 540200196,
+            1997765289, 883982688,  4079247621, 3871727737, 1966372491, 4138041530, 3289760328,
+            2436098964, 1822412786, 4137422157, 767415844,  1833942251, 1144080284, 1560217988,
+            2717028258, 2739588353, 304692552,  3854553410, 2511214880, 953104582,  310645891,
+            831151463,  4187298422, 1111657182, 1281329387, 305609511,  1589677361, 617996646,
+            1647851135, 1704011305, 1768939903, 4007300010, 3211593113, 3040422441, 2601169090,
+            2921209689, 1950033261, 2408016015, 109562872,  1741057683, 1898856554, 3932635230,
+            3641412297, 2426191476, 2077065462, 3222040609, 2872478649, 1392755422, 2921410228,
+            2303092249, 2960843883, 1668070824, 2045221400, 3271670591, 3770407342, 2321030261,
+            4191547374, 3274404965, 3745213617, 1611985837, 82530455,   1832283505, 3637022272,
+            420500025,  1206267699, 1858056966, 3439257685, 1626599114, 931972305,  1180969878,
+            2677354534, 653745134,  3954831020, 65132892,   3714449985, 2292702182, 1202820072,
+            74612494,   1335135268, 3969773959, 1175119685, 469041447,  513644452,  851349877,
+            2888093264, 681786619,  2889979259, 476341791,  1558666967, 295527045,  1482124259,
+            2743690437, 124311530,  4256282787, 1401800807, 621017536,  1907850553, 551862893,
+            2713776076, 1817701301, 2257755896, 4113032023, 1141672939, 823661987,  3325859678,
+            2193021895, 2634675948, 2790892626, 1192703480, 1543291372, 3459843642, 2927030805,
+            1989287459, 3311133353, 2656261116, 3056628243, 1656669994, 2063779200, 1422764446,
+            3839008945, 2207921905, 551636805,  3952598762, 3940159218, 1795913136, 2855134387,
+            3564478078, 134611785,  3974540695, 297290528,  1802923511, 400850027,  2160248452,
+            3074387604, 1668453253, 1965941631, 22301980,   1268915561, 3256101951, 3717790919,
+            2223176410, 964392544,  1193663126, 3365121644, 1338288925, 1827290914, 1963329812,
+            1736395536, 25186710,   1902177589, 73097908,   3722560733, 2441283385, 2086195883,
+            2843683899, 572435561,  3494904043, 1713891341, 2945467011, 1367741017, 540200196,
+            1997765289, 883982688,  266232773,  3871727737, 1966372491, 4138041530, 3289760328,
+            2301680177, 1822412786, 4137422157, 767415844,  1833942251, 2527675911, 1560217988,
+            2717028258, 2739588353, 304692552,  1508720409, 2511214880, 953104582,  310645891,
+            831151463,  2764435099, 1111657182, 1281329387, 305609511,  1589677361, 3131207787,
+            1647851135, 1704011305, 1768939903, 4007300010, 1968280178, 3040422441, 2601169090,
+            2921209689, 1950033261, 1767878286, 109562872,  1741057683, 1898856554, 3932635230,
+            4176931697, 2426191476, 2077065462, 3222040609, 2872478649, 3493033663, 2921410228,
+            2303092249, 2960843883, 1668070824, 2112245534, 3271670591, 3770407342, 2321030261,
+            4191547374, 678222515,  3745213617, 1611985837, 82530455,   1832283505, 733085956,
+            420500025,  1206267699, 1858056966, 3439257685, 2121533261, 931972305,  1180969878,
+            2677354534, 653745134,  325913981,  65132892,   3714449985, 2292702182, 1202820072,
+            1960811243, 1335135268, 3969773959, 1175119685, 469041447,  3918128399, 851349877,
+            2888093264, 681786619,  2889979259, 2736224017, 1558666967, 295527045,  1482124259,
+            2743690437, 886458831,  4256282787, 1401800807, 621017536,  1907850553, 1302700975,
+            2713776076, 1817701301, 2257755896, 4113032023, 1269742216, 823661987,  3325859678,
+            2193021895, 2634675948, 3724057640, 1192703480, 1543291372, 3459843642, 2927030805,
+            351475026,  3311133353, 2656261116, 3056628243, 1656669994, 2588769348, 1422764446,
+            3839008945, 2207921905, 551636805,  2706051825, 3940159218, 1795913136, 2855134387,
+            3564478078, 2256596932, 3974540695, 297290528,  1802923511, 400850027,  4148297539,
+            3074387604, 1668453253, 1965941631, 22301980,   1244418792, 3256101951, 3717790919,
+            2223176410, 964392544,  849384496,  3365121644, 1338288925, 1827290914, 1963329812,
+            1796340517, 25186710,   1902177589, 73097908,   3722560733, 1916938301, 2086195883,
+            2843683899, 572435561,  3494904043, 3630802579, 2945467011, 1367741017, 540200196,
+            1997765289, 4112501336, 266232773,  3871727737, 1966372491, 4138041530, 1837368836,
+            2301680177, 1822412786, 4137422157, 767415844,  1707660652, 2527675911, 1560217988,
+            2717028258, 2739588353, 3418934362, 1508720409, 2511214880, 953104582,  310645891,
+            3791859752, 2764435099, 1111657182, 1281329387, 305609511,  3237539625, 3131207787,
+            1647851135, 1704011305, 1768939903, 3741097445, 1968280178, 3040422441, 2601169090,
+            2921209689, 2893702309, 1767878286, 109562872,  1741057683, 1898856554, 769410762,
+            4176931697, 2426191476, 2077065462, 3222040609, 1524627220, 3493033663, 2921410228,
+            2303092249, 2960843883, 2549791902, 2112245534, 3271670591, 3770407342, 2321030261,
+            466822461,  678222515,  3745213617, 1611985837, 82530455,   4179735572, 733085956,
+            420500025,  1206267699, 1858056966, 4293544479, 2121533261, 931972305,  1180969878,
+            2677354534, 4230863645, 325913981,  65132892,   3714449985, 2292702182, 284398808,
+            1960811243, 1335135268, 3969773959, 1175119685, 3361307968, 3918128399, 851349877,
+            2888093264, 681786619,  584270018,  2736224017, 1558666967, 295527045,  1482124259,
+            3483279430, 886458831,  4256282787, 1401800807, 621017536,  3348130606, 1302700975,
+            2713776076, 1817701301, 2257755896, 3673342196, 1269742216, 823661987,  3325859678,
+            2193021895, 1735311876, 3724057640, 1192703480, 1543291372, 3459843642, 1899360262,
+            351475026,  3311133353, 2656261116, 3056628243, 1829414064, 2588769348, 1422764446,
+            3839008945, 2207921905, 1554519516, 2706051825, 3940159218, 1795913136, 2855134387,
+            1378157701, 2256596932, 3974540695, 297290528,  1802923511, 458147521,  4148297539,
+            3074387604, 1668453253, 1965941631, 1134876050, 1244418792, 3256101951, 3717790919,
+            2223176410, 2533643880, 849384496,  3365121644, 1338288925, 1827290914, 2738226566,
+            1796340517, 25186710,   1902177589, 73097908,   1487940952, 1916938301, 2086195883,
+            2843683899, 572435561,  4026904860, 3630802579, 2945467011, 1367741017, 540200196,
+            2500724838, 4112501336, 266232773,  3871727737, 1966372491, 3190448659, 1837368836,
+            2301680177, 1822412786, 4137422157, 3963480259, 512757556,  649281692,  3343379835,
+            4184346678, 1333208514, 213463676,  3272380894, 2772726838, 566258037,  1576218945,
+            1026780955, 983141288,  349071512,  3555632162, 3968780135, 1910169442, 4227054476,
+            3895492200, 2612729471, 2539991707, 2928282031, 3171656803, 2682090223, 1285323124,
+            2282150884, 2522389691, 4092001480, 3159041413, 3950884357, 2193845874, 2741963304,
+            1813342702, 2340373585, 4081942068, 1571616556, 814421125,  1912337307, 370822718,
+            2854821197, 3876824785, 1724923838, 2549087397, 1212922713, 2954693214, 2988712954,
+            216125181,  1227494069, 821099795,  956077853,  208675472,  931956919,  2012648395,
+            67091091,   307187027,  939005117,  2437124513, 3384840977, 896873834,  3450040210,
+            372844017,  2363067397, 480640195,  418212009,  3908134970, 2769733690, 1839662843,
+            2799797015, 1746442659, 685071435,  3269271091, 1808276088, 1830386529, 1448532211,
+            1543444586, 1498533635, 653723133,  3409535658, 3199365486, 195689392,  1724740329,
+            2198961595, 128535862,  762970834,  862514641,  3628227097, 3214483207, 2171442832,
+            2890937455, 1605021097, 1632401675, 4015555606, 166802151,  2710376137, 2179747994,
+            1567984188, 1322848326, 694963475,  2760304731, 868619686,  709013268,  2960030018,
+            3613587271, 1302275940, 2450478629, 2689281584, 1934699064, 2365410611, 2678944371,
+            1322193353, 1424375273, 2902920313, 2573478285, 3864905997, 391281596,  1958893694,
+            3125657981, 3405615280, 3434888209, 740386191,  3944293968, 1946131287, 1604727434,
+            1103307453, 4155710768, 3188760760, 1709251407, 1201510110, 900776715,  4152427685,
+            2773034060, 2502440709, 2514742898, 2584004353, 493521094,  2628427142, 4130389513,
+            3936813366, 4045738686, 326592420,  2208857030, 3675805342, 2841280163, 3573722120,
+            2088599603, 2555735653, 1750130553, 2956556778, 531184489,  1311713584, 2808431905,
+            845892935,  3346302751, 3366642906, 779027619,  3383502345, 2005287962, 436355614,
+            2469566511, 4289550301,
+        },
+        {
+            428616149,  1058276015, 1236873727, 2472322739, 1878349874, 1128958274, 1747943059,
+            2225316809, 194036153,  2202803397, 671457802,  3268787706, 1664124681, 2355501028,
+            3655088248, 3937238976, 3553875982, 2658974136, 3083217863, 2737387884, 2760296878,
+            229522173,  2501593472, 1766571402, 864757533,  2804610890, 443800958,  1400585378,
+            2250753602, 2336472967, 3543791014, 1651381922, 2271837722, 2557280164, 1671472453,
+            4155253598, 339115310,  3300611424, 3679802820, 1744661430, 4072494101, 2810050520,
+            3324790847, 2920973140, 1868504753, 2891245992, 2366000615, 2679958612, 2100106202,
+            488870746,  2816804549, 1823495843, 950968318,  1829350520, 892019997,  1467060140,
+            2842026488, 2300458775, 1644528563, 1344123484, 4291477786, 71200959,   1967798255,
+            2406719602, 3720053605, 2621136064, 1295655592, 2384997589, 1840450264, 1432082880,
+            3053461542, 296316192,  3908679735, 2463807009, 1860938904, 2746960564, 3013813084,
+            3865676968, 2641442982, 1697099986, 675547636,  1984831636, 823920976,  3264228222,
+            144027911,  624242169,  730589867,  4199975743, 1563514145, 442708544,  3779622535,
+            1319517280, 2278479644, 1173054795, 879773369,  183765312,  585656678,  2965898064,
+            1884722993, 1849793197, 1944886042, 283420613,  4123725361, 2863126288, 4151198324,
+            4171172,    530752651,  2500240344, 2944498454, 2637797303, 3682964774, 2469148027,
+            1706257855, 2403081434, 3404172592, 4107940899, 1472294478, 3886960152, 4013815959,
+            1101496004, 2354114668, 719453117,  2551264882, 1532369285, 1605607517, 140859569,
+            201162287,  890273274,  1479560671, 1902841087, 3218244424, 1375587640, 1577559526,
+            517532090,  3310967818, 1172037839, 1426732171, 1128822414, 3289736236, 3815953392,
+            738849685,  388591290,  2035800936, 2286708820, 2711443601, 137858489,  3250578317,
+            401990851,  3281773118, 3339305953, 1472014801, 1569800327, 1877572467, 4023299775,
+            2613276500, 155387474,  1143673834, 2139103289, 3591794661, 348118695,  1406429478,
+            428616149,  1058276015, 1236873727, 2472322739, 3641482106, 1128958274, 1747943059,
+            2225316809, 194036153,  1805740602, 671457802,  3268787706, 1664124681, 2355501028,
+            749684830,  3937238976, 3553875982, 2658974136, 3083217863, 1371078257, 2760296878,
+            229522173,  2501593472, 1766571402, 3798779350, 2804610890, 443800958,  1400585378,
+            2250753602, 4013038054, 3543791014, 1651381922, 2271837722, 2557280164, 3391345880,
+            4155253598, 339115310,  3300611424, 3679802820, 433108265,  4072494101, 2810050520,
+            3324790847, 2920973140, 1928807808, 2891245992, 2366000615, 2679958612, 2100106202,
+            2897849897, 2816804549, 1823495843, 950968318,  1829350520, 224813508,  1467060140,
+            2842026488, 2300458775, 1644528563, 2084668196, 4291477786, 71200959,   1967798255,
+            2406719602, 1304839328, 2621136064, 1295655592, 2384997589, 1840450264, 1496850553,
+            3053461542, 296316192,  3908679735, 2463807009, 3513096207, 2746960564, 3013813084,
+            3865676968, 2641442982, 1302061971, 675547636,  1984831636, 823920976,  3264228222,
+            2774800012, 624242169,  730589867,  4199975743, 1563514145, 3511251303, 3779622535,
+            1319517280, 2278479644, 1173054795, 3339828048, 183765312,  585656678,  2965898064,
+            1884722993, 1108748720, 1944886042, 283420613,  4123725361, 2863126288, 1389457254,
+            4171172,    530752651,  2500240344, 2944498454, 3177078008, 3682964774, 2469148027,
+            1706257855, 2403081434, 4137312894, 4107940899, 1472294478, 3886960152, 4013815959,
+            1939518367, 2354114668, 719453117,  2551264882, 1532369285, 3036109973, 140859569,
+            201162287,  890273274,  1479560671, 3677826666, 3218244424, 1375587640, 1577559526,
+            517532090,  672520815,  1172037839, 1426732171, 1128822414, 3289736236, 3064230057,
+            738849685,  388591290,  2035800936, 2286708820, 3692875076, 137858489,  3250578317,
+            401990851,  3281773118, 2894231563, 1472014801, 1569800327, 1877572467, 4023299775,
+            2989949965, 155387474,  1143673834, 2139103289, 3591794661, 870011717,  1406429478,
+            428616149,  1058276015, 1236873727, 1454127999, 3641482106, 1128958274, 1747943059,
+            2225316809, 2419818460, 1805740602, 671457802,  3268787706, 1664124681, 2641623313,
+            749684830,  3937238976, 3553875982, 2658974136, 3068492461, 1371078257, 2760296878,
+            229522173,  2501593472, 2177974357, 3798779350, 2804610890, 443800958,  1400585378,
+            3769095517, 4013038054, 3543791014, 1651381922, 2271837722, 4030263781, 3391345880,
+            4155253598, 339115310,  3300611424, 129913694,  433108265,  4072494101, 2810050520,
+            3324790847, 173902690,  1928807808, 2891245992, 2366000615, 2679958612, 2439182978,
+            2897849897, 2816804549, 1823495843, 950968318,  568305935,  224813508,  1467060140,
+            2842026488, 2300458775, 3079856355, 2084668196, 4291477786, 71200959,   1967798255,
+            3423219107, 1304839328, 2621136064, 1295655592, 2384997589, 1133169021, 1496850553,
+            3053461542, 296316192,  3908679735, 3321879863, 3513096207, 2746960564, 3013813084,
+            3865676968, 2175766199, 1302061971, 675547636,  1984831636, 823920976,  27113186,
+            2774800012, 624242169,  730589867,  4199975743, 2007799972, 3511251303, 3779622535,
+            1319517280, 2278479644, 1342734105, 3339828048, 183765312,  585656678,  2965898064,
+            17402662,   1108748720, 1944886042, 283420613,  4123725361, 3788538824, 1389457254,
+            4171172,    530752651,  2500240344, 3209089731, 3177078008, 3682964774, 2469148027,
+            1706257855, 3944156846, 4137312894, 4107940899, 1472294478, 3886960152, 4267351972,
+            1939518367, 2354114668, 719453117,  2551264882, 270251862,  3036109973, 140859569,
+            201162287,  890273274,  2139353786, 3677826666, 3218244424, 1375587640, 1577559526,
+            3203722599, 672520815,  1172037839, 1426732171, 1128822414, 699505168,  3064230057,
+            738849685,  388591290,  2035800936, 3021300169, 3692875076, 137858489,  3250578317,
+            401990851,  584692463,  2894231563, 1472014801, 1569800327, 1877572467, 1062903034,
+            2989949965, 155387474,  1143673834, 2139103289, 2827326336, 870011717,  1406429478,
+            428616149,  1058276015, 776414584,  1454127999, 3641482106, 1128958274, 1747943059,
+            1665434561, 2419818460, 1805740602, 671457802,  3268787706, 638392680,  2641623313,
+            749684830,  3937238976, 3553875982, 848798537,  3068492461, 1371078257, 2760296878,
+            229522173,  1209449797, 2177974357, 3798779350, 2804610890, 443800958,  2558700383,
+            3769095517, 4013038054, 3543791014, 1651381922, 1806994248, 4030263781, 3391345880,
+            4155253598, 339115310,  3267908836, 129913694,  433108265,  4072494101, 2810050520,
+            1418836907, 173902690,  1928807808, 2891245992, 2366000615, 2725111580, 2439182978,
+            2897849897, 2816804549, 1823495843, 1904454702, 568305935,  224813508,  1467060140,
+            2842026488, 346490154,  3079856355, 2084668196, 4291477786, 71200959,   3228772828,
+            3423219107, 1304839328, 2621136064, 1295655592, 1305371662, 1133169021, 1496850553,
+            3053461542, 296316192,  787259791,  3321879863, 3513096207, 2746960564, 3013813084,
+            3564317391, 2175766199, 1302061971, 675547636,  1984831636, 3773260111, 27113186,
+            2774800012, 624242169,  730589867,  3557240592, 2007799972, 3511251303, 3779622535,
+            1319517280, 3134700183, 1342734105, 3339828048, 183765312,  585656678,  1272377520,
+            17402662,   1108748720, 1944886042, 283420613,  3938989950, 3788538824, 1389457254,
+            4171172,    530752651,  2593129509, 3209089731, 3177078008, 3682964774, 2469148027,
+            2632734231, 3944156846, 4137312894, 4107940899, 1472294478, 164721041,  4267351972,
+            1939518367, 2354114668, 719453117,  2859761878, 270251862,  3036109973, 140859569,
+            201162287,  3223013128, 2139353786, 3677826666, 3218244424, 1375587640, 836083222,
+            3203722599, 672520815,  1172037839, 1426732171, 164825127,  699505168,  3064230057,
+            738849685,  388591290,  1354554871, 3021300169, 3692875076, 137858489,  3250578317,
+            1271927909, 584692463,  2894231563, 1472014801, 1569800327, 549976641,  1062903034,
+            2989949965, 155387474,  1143673834, 3043972018, 3112433268, 3466030580, 1752454405,
+            1668884673, 2323337501, 4030384011, 1573636935, 125898039,  3555235635, 3797168014,
+            1956209730, 1448807166, 2228031986, 2429368976, 529895643,  1578160820, 1231141801,
+            853832120,  38692098,   2758358598, 1154468037, 4114043351, 310465553,  2698708829,
+            1409725422, 4217190323, 2202426634, 2535658310, 2944959053, 4119447565, 3002667360,
+            3107418422, 1006995816, 2705684557, 1736989447, 2315423756, 1462403663, 3657919354,
+            3752105241, 3526450634, 119399359,  3054435255, 383556322,  2542519124, 3880597784,
+            4190776044, 4127820698, 2676057665, 569563281,  3757208114, 3949573387, 1778442680,
+            1316553859, 788880480,  2252226627, 756081574,  1192115693, 4061125949, 1824652020,
+            400878225,  3064810326, 3103970428, 1944718755, 4094090576, 1242998879, 94251540,
+            461351003,  304568184,  4052311317, 2532712485, 269200945,  2294303506, 3331939878,
+            2767627105, 3668774859, 1270970180, 3093790996, 3384780901, 2376613453, 3052315885,
+            3091038153, 3064552187, 2015760873, 1920325088, 2415635351, 3538661356, 1151253379,
+            2140493485, 3155883296, 3409177114, 3678481502, 392246605,  3564100961, 2334106436,
+            3212892416, 911813479,  2696786302, 3886865564, 1563038663, 3651203563, 2403052421,
+            2199169153, 571985405,  4172048622, 3187107124, 2548605581, 2658139042, 3870985844,
+            506166077,  3296061780, 3146547639, 306682187,  3191343266, 4116527492, 856574192,
+            3337413888, 2147538610, 2960311835, 1088971990, 491629278,  220629026,  3809823948,
+            2841067017, 2860220310, 3235377351, 3898071783, 704912048,  4172173549, 1250612176,
+            3848891590, 378391103,  287427857,  2430641152, 3645249592, 1762589671, 2918923548,
+            3337122519, 71341806,   420564090,  431641453,  275340106,  970506586,  2407313907,
+            2742370918, 2197072630, 3527964417, 1717376712, 3124878220, 2994099765, 872407537,
+            2016408980, 1526089595, 4134813552, 2714310305, 4112537837, 3588727468, 3938270806,
+            1485453915, 1372142601,
+        },
+        {
+            4252479627, 2164875668, 1749193316, 873103539,  2836480343, 4151275413, 1433716141,
+            3572146608, 2071677975, 2125228936, 224298541,  2299999508, 3724204934, 4025878032,
+            1480255273, 203946052,  216120093,  3023448593, 2471990435, 373413953,  1656194679,
+            805611692,  922434783,  2765661286, 744065515,  1023190415, 426266428,  112836874,
+            1721348374, 667369057,  3448784200, 992494380,  2377462131, 331415801,  2597632781,
+            290342424,  2470359884, 1311907338, 3876118833, 3788380516, 1389402235, 378371000,
+            2095820789, 1266379988, 344222495,  122995930,  2526179486, 4145356885, 193517682,
+            3083595216, 3903380027, 1393336112, 337550895,  1491822848, 750939222,  1544462334,
+            1001219745, 3973795774, 130429916,  2436223046, 2662718322, 3928903689, 379249466,
+            2398675924, 196160686,  1128769947, 174364016,  605828074,  1511698074, 3680371638,
+            2955752394, 2269065224, 3153659249, 823936000,  1518594523, 787165057,  3782340160,
+            439978541,  2023172117, 3809285646, 1368107956, 1618198858, 468424890,  1906210152,
+            426707774,  2743473693, 1829272673, 576519161,  329463645,  1888166330, 1973160828,
+            3583145829, 2558215125, 3208543142, 1331720794, 4243082409, 3331543503, 2795124262,
+            1151147235, 3542700583, 2942475495, 2221419615, 2086975875, 1538635994, 872468969,
+            3436975086, 1155785998, 2182240658, 1894609648, 1012938330, 883759301,  155219798,
+            2685364185, 2134134778, 880002361,  554540024,  3166587679, 1943719579, 1687699092,
+            4084404186, 2396702966, 3872668912, 3782521018, 2538938218, 654940718,  1325703785,
+            3346985396, 3672117182, 215311688,  1841661946, 3665024956, 2905576772, 2284047416,
+            186256230,  2074655928, 1137858687, 2441188455, 3937447544, 3690676634, 457548431,
+            2800901975, 342307262,  4082624855, 3024433253, 1397998623, 992303442,  1552248682,
+            3263805895, 2298835610, 62309998,   603272409,  1285728279, 671160371,  3888070530,
+            3620030505, 3211672189, 2353723509, 2548582658, 3008009259, 828770477,  2428434522,
+            4252479627, 2164875668, 1749193316, 873103539,  1921063803, 4151275413, 1433716141,
+            3572146608, 2071677975, 4192425286, 224298541,  2299999508, 3724204934, 4025878032,
+            3218167719, 203946052,  216120093,  3023448593, 2471990435, 1454224457, 1656194679,
+            805611692,  922434783,  2765661286, 3546675185, 1023190415, 426266428,  112836874,
+            1721348374, 1892631322, 3448784200, 992494380,  2377462131, 331415801,  620352086,
+            290342424,  2470359884, 1311907338, 3876118833, 2253630772, 1389402235, 378371000,
+            2095820789, 1266379988, 56809575,   122995930,  2526179486, 4145356885, 193517682,
+            1200700477, 3903380027, 1393336112, 337550895,  1491822848, 2274691128, 1544462334,
+            1001219745, 3973795774, 130429916,  755116013,  2662718322, 3928903689, 379249466,
+            2398675924, 433170938,  1128769947, 174364016,  605828074,  1511698074, 564206686,
+            2955752394, 2269065224, 3153659249, 823936000,  3251848244, 787165057,  3782340160,
+            439978541,  2023172117, 648336232,  1368107956, 1618198858, 468424890,  1906210152,
+            4120006030, 2743473693, 1829272673, 576519161,  329463645,  18923205,   1973160828,
+            3583145829, 2558215125, 3208543142, 1568433701, 4243082409, 3331543503, 2795124262,
+            1151147235, 1524819262, 2942475495, 2221419615, 2086975875, 1538635994, 4267592583,
+            3436975086, 1155785998, 2182240658, 1894609648, 3113806206, 883759301,  155219798,
+            2685364185, 2134134778, 1568261730, 554540024,  3166587679, 1943719579, 1687699092,
+            1454314575, 2396702966, 3872668912, 3782521018, 2538938218, 3059191410, 1325703785,
+            3346985396, 3672117182, 215311688,  1435815031, 3665024956, 2905576772, 2284047416,
+            186256230,  576839190,  1137858687, 2441188455, 3937447544, 3690676634, 2992040749,
+            2800901975, 342307262,  4082624855, 3024433253, 3350228751, 992303442,  1552248682,
+            3263805895, 2298835610, 878751435,  603272409,  1285728279, 671160371,  3888070530,
+            1912364354, 3211672189, 2353723509, 2548582658, 3008009259, 2467906395, 2428434522,
+            4252479627, 2164875668, 1749193316, 1276257457, 1921063803, 4151275413, 1433716141,
+            3572146608, 2246476733, 4192425286, 224298541,  2299999508, 3724204934, 3847489714,
+            3218167719, 203946052,  216120093,  3023448593, 1173556998, 1454224457, 1656194679,
+            805611692,  922434783,  3414799173, 3546675185, 1023190415, 426266428,  112836874,
+            4229686456, 1892631322, 3448784200, 992494380,  2377462131, 4161533790, 620352086,
+            290342424,  2470359884, 1311907338, 2323124262, 2253630772, 1389402235, 378371000,
+            2095820789, 2942444507, 56809575,   122995930,  2526179486, 4145356885, 93327214,
+            1200700477, 3903380027, 1393336112, 337550895,  3615936205, 2274691128, 1544462334,
+            1001219745, 3973795774, 2354058295, 755116013,  2662718322, 3928903689, 379249466,
+            3721350592, 433170938,  1128769947, 174364016,  605828074,  3661885875, 564206686,
+            2955752394, 2269065224, 3153659249, 2571283168, 3251848244, 787165057,  3782340160,
+            439978541,  1526366861, 648336232,  1368107956, 1618198858, 468424890,  267029903,
+            4120006030, 2743473693, 1829272673, 576519161,  2143236308, 18923205,   1973160828,
+            3583145829, 2558215125, 2917490812, 1568433701, 4243082409, 3331543503, 2795124262,
+            1282226553, 1524819262, 2942475495, 2221419615, 2086975875, 1486018610, 4267592583,
+            3436975086, 1155785998, 2182240658, 2433066475, 3113806206, 883759301,  155219798,
+            2685364185, 3538067643, 1568261730, 554540024,  3166587679, 1943719579, 3867640597,
+            1454314575, 2396702966, 3872668912, 3782521018, 538362050,  3059191410, 1325703785,
+            3346985396, 3672117182, 13578333,   1435815031, 3665024956, 2905576772, 2284047416,
+            1835445479, 576839190,  1137858687, 2441188455, 3937447544, 3944544920, 2992040749,
+            2800901975, 342307262,  4082624855, 3879576604, 3350228751, 992303442,  1552248682,
+            3263805895, 927510630,  878751435,  603272409,  1285728279, 671160371,  4107782483,
+            1912364354, 3211672189, 2353723509, 2548582658, 1190584810, 2467906395, 2428434522,
+            4252479627, 2164875668, 2544365110, 1276257457, 1921063803, 4151275413, 1433716141,
+            1455733671, 2246476733, 4192425286, 224298541,  2299999508, 3897563589, 3847489714,
+            3218167719, 203946052,  216120093,  47869460,   1173556998, 1454224457, 1656194679,
+            805611692,  2889622461, 3414799173, 3546675185, 1023190415, 426266428,  3488983748,
+            4229686456, 1892631322, 3448784200, 992494380,  2223114754, 4161533790, 620352086,
+            290342424,  2470359884, 32131228,   2323124262, 2253630772, 1389402235, 378371000,
+            3402984478, 2942444507, 56809575,   122995930,  2526179486, 610200379,  93327214,
+            1200700477, 3903380027, 1393336112, 793575086,  3615936205, 2274691128, 1544462334,
+            1001219745, 4156604116, 2354058295, 755116013,  2662718322, 3928903689, 1612044600,
+            3721350592, 433170938,  1128769947, 174364016,  4226368441, 3661885875, 564206686,
+            2955752394, 2269065224, 2238211657, 2571283168, 3251848244, 787165057,  3782340160,
+            592431466,  1526366861, 648336232,  1368107956, 1618198858, 2722011445, 267029903,
+            4120006030, 2743473693, 1829272673, 263083136,  2143236308, 18923205,   1973160828,
+            3583145829, 3396749113, 2917490812, 1568433701, 4243082409, 3331543503, 3142690426,
+            1282226553, 1524819262, 2942475495, 2221419615, 1615928559, 1486018610, 4267592583,
+            3436975086, 1155785998, 284799108,  2433066475, 3113806206, 883759301,  155219798,
+            3482947546, 3538067643, 1568261730, 554540024,  3166587679, 3788780114, 3867640597,
+            1454314575, 2396702966, 3872668912, 762556664,  538362050,  3059191410, 1325703785,
+            3346985396, 1109761040, 13578333,   1435815031, 3665024956, 2905576772, 3878481873,
+            1835445479, 576839190,  1137858687, 2441188455, 2130772307, 3944544920, 2992040749,
+            2800901975, 342307262,  1030573257, 3879576604, 3350228751, 992303442,  1552248682,
+            2069097050, 927510630,  878751435,  603272409,  1285728279, 1570510820, 4107782483,
+            1912364354, 3211672189, 2353723509, 2041975314, 3271585763, 4208308940, 3961481961,
+            3003944931, 4173296518, 2873294215, 3470733951, 1158556606, 3447143999, 2915808811,
+            2141740087, 3047456360, 1000489014, 113258919,  2782257835, 3390051797, 1851324619,
+            3398035016, 2973007144, 4232092699, 2865536628, 2255757439, 2724484481, 430777374,
+            3294257207, 697297737,  4182770362, 2132179476, 3384203252, 2225557947, 1340776930,
+            2011523864, 809301948,  1860158343, 2274750139, 1092412844, 453003556,  2006606628,
+            2319959966, 1414950011, 1766568205, 1925038519, 3648976872, 4012319851, 1105832131,
+            458644150,  1428393823, 2321287279, 2647668786, 79190685,   3289656898, 924245950,
+            2473816435, 944239907,  1108017429, 2719439830, 1214511190, 3969114786, 3721622931,
+            1022858730, 2442027164, 764451691,  1686719480, 658187431,  2422906475, 3776443954,
+            3692912471, 282653831,  3106256043, 3841105892, 4136828562, 3824456432, 1134321259,
+            3653835086, 3478168685, 1039297869, 593826508,  1833830607, 285244513,  1522092962,
+            810479552,  1679554430, 3708269613, 3452079049, 292073825,  3771065509, 3574858282,
+            3938118071, 1152357843, 3918078671, 3475348945, 2177487045, 712537327,  2113727695,
+            2009771881, 2278937953, 2415418935, 1386568495, 4110139338, 1236823304, 246389299,
+            2679672891, 1095668816, 1751275012, 1402195185, 976972544,  3392972307, 227764857,
+            413566490,  688057246,  827555264,  2861636335, 572035932,  2120287505, 979975473,
+            2781408042, 2149671741, 1521920076, 929079482,  4232466753, 3715773297, 2215960917,
+            2253282995, 3996636865, 167361310,  2828342561, 972130285,  3655991181, 118670585,
+            145237722,  180863684,  823222477,  1758760584, 2325140941, 1345870273, 4144703660,
+            2280525075, 1289458446, 2543965752, 3236450402, 3219738929, 1425386409, 3869458564,
+            1079058387, 2350849735, 2977059342, 1448080914, 2449447197, 2866462799, 1078622222,
+            991531604,  206643762,  942771449,  465877024,  1075814076, 495159640,  3914612747,
+            2561154377, 667297588,
+        },
+        {
+            1865421371, 3855220097, 1192662720, 4053603741, 3498982078, 2149980242, 2238335564,
+            3222811776, 4085813132, 4165033841, 4028166647, 1560770711, 1838813654, 752041022,
+            2614535013, 2757001712, 2785653920, 3637983932, 87282193,   605048454,  924961619,
+            2682280948, 326431250,  4211686882, 833160077,  2504545012, 3952610051, 2681478826,
+            3369021896, 3356142984, 146379450,  1024932267, 2636884376, 2061811068, 1376983712,
+            361194627,  272549074,  192241473,  3727208608, 898476530,  2738601511, 3207243585,
+            2665084459, 2389742715, 2744065017, 3033430382, 770192937,  2541418947, 3454872293,
+            1577097398, 4108159492, 4219421026, 856464853,  3298781712, 2178867106, 2266047368,
+            4087648850, 3578908986, 3093601815, 1119634223, 3671095509, 2954169301, 1955466875,
+            3882719379, 2921692178, 3595064912, 803946480,  2134164180, 954279434,  3164638193,
+            2038017360, 2466144217, 3928575704, 3416495827, 602647914,  1223209540, 3199809225,
+            2808513978, 938324237,  3714656121, 1669584133, 3264385618, 902761440,  2043393982,
+            2846878985, 764960801,  1230586586, 486915550,  2410021040, 479648513,  476111955,
+            689036062,  3935398553, 1704467848, 2866523453, 4127270899, 1133622972, 3313003992,
+            2359068269, 3183429806, 1950272482, 1326018344, 1534546084, 1364075990, 1758534252,
+            3550724414, 591432841,  891034220,  1141814591, 3103578968, 4165735674, 2185345476,
+            2725964126, 938622176,  608813725,  888133966,  421620858,  3527977429, 793164895,
+            883970194,  2653160155, 3326119326, 1987333710, 2976200539, 2076107922, 1343977688,
+            4181822334, 2820231422, 4278414361, 264298438,  2870980378, 2166597194, 3610428477,
+            3523751966, 1698946292, 2824081025, 2139002735, 3068885560, 2596947845, 2153608790,
+            974462588,  1250349190, 44615848,   4043603166, 1938159648, 3799630632, 1410487989,
+            136065209,  1088176364, 1642339077, 1958726387, 2073434786, 933771929,  4072054702,
+            455203260,  2759771318, 4065759839, 1046141177, 1755449971, 3931223356, 3752531902,
+            1865421371, 3855220097, 1192662720, 4053603741, 3640601820, 2149980242, 2238335564,
+            3222811776, 4085813132, 3980562548, 4028166647, 1560770711, 1838813654, 752041022,
+            670533937,  2757001712, 2785653920, 3637983932, 87282193,   3980466606, 924961619,
+            2682280948, 326431250,  4211686882, 1663347455, 2504545012, 3952610051, 2681478826,
+            3369021896, 1689947333, 146379450,  1024932267, 2636884376, 2061811068, 112718424,
+            361194627,  272549074,  192241473,  3727208608, 1390957351, 2738601511, 3207243585,
+            2665084459, 2389742715, 4202117803, 3033430382, 770192937,  2541418947, 3454872293,
+            86249357,   4108159492, 4219421026, 856464853,  3298781712, 593053024,  2266047368,
+            4087648850, 3578908986, 3093601815, 289348723,  3671095509, 2954169301, 1955466875,
+            3882719379, 130090401,  3595064912, 803946480,  2134164180, 954279434,  1044443641,
+            2038017360, 2466144217, 3928575704, 3416495827, 2775502362, 1223209540, 3199809225,
+            2808513978, 938324237,  4210502235, 1669584133, 3264385618, 902761440,  2043393982,
+            3774048985, 764960801,  1230586586, 486915550,  2410021040, 1750392854, 476111955,
+            689036062,  3935398553, 1704467848, 2330012865, 4127270899, 1133622972, 3313003992,
+            2359068269, 472110226,  1950272482, 1326018344, 1534546084, 1364075990, 1986793636,
+            3550724414, 591432841,  891034220,  1141814591, 3814713993, 4165735674, 2185345476,
+            2725964126, 938622176,  1218699484, 888133966,  421620858,  3527977429, 793164895,
+            1554821561, 2653160155, 3326119326, 1987333710, 2976200539, 3431929083, 1343977688,
+            4181822334, 2820231422, 4278414361, 1755297453, 2870980378, 2166597194, 3610428477,
+            3523751966, 3175178411, 2824081025, 2139002735, 3068885560, 2596947845, 1801779549,
+            974462588,  1250349190, 44615848,   4043603166, 478782854,  3799630632, 1410487989,
+            136065209,  1088176364, 1418229287, 1958726387, 2073434786, 933771929,  4072054702,
+            3404885230, 2759771318, 4065759839, 1046141177, 1755449971, 2612191836, 3752531902,
+            1865421371, 3855220097, 1192662720, 348197893,  3640601820, 2149980242, 2238335564,
+            3222811776, 2689253279, 3980562548, 4028166647, 1560770711, 1838813654, 4082879926,
+            670533937,  2757001712, 2785653920, 3637983932, 2437009856, 3980466606, 924961619,
+            2682280948, 326431250,  3035929138, 1663347455, 2504545012, 3952610051, 2681478826,
+            378491109,  1689947333, 146379450,  1024932267, 2636884376, 3891892774, 112718424,
+            361194627,  272549074,  192241473,  1166960170, 1390957351, 2738601511, 3207243585,
+            2665084459, 3504326850, 4202117803, 3033430382, 770192937,  2541418947, 1460350268,
+            86249357,   4108159492, 4219421026, 856464853,  3756014281, 593053024,  2266047368,
+            4087648850, 3578908986, 2456229280, 289348723,  3671095509, 2954169301, 1955466875,
+            3164643165, 130090401,  3595064912, 803946480,  2134164180, 2885151028, 1044443641,
+            2038017360, 2466144217, 3928575704, 1311494491, 2775502362, 1223209540, 3199809225,
+            2808513978, 210763357,  4210502235, 1669584133, 3264385618, 902761440,  4263520968,
+            3774048985, 764960801,  1230586586, 486915550,  456893132,  1750392854, 476111955,
+            689036062,  3935398553, 3303532566, 2330012865, 4127270899, 1133622972, 3313003992,
+            3125813874, 472110226,  1950272482, 1326018344, 1534546084, 432100244,  1986793636,
+            3550724414, 591432841,  891034220,  3195889245, 3814713993, 4165735674, 2185345476,
+            2725964126, 1599473208, 1218699484, 888133966,  421620858,  3527977429, 3004128323,
+            1554821561, 2653160155, 3326119326, 1987333710, 2543685019, 3431929083, 1343977688,
+            4181822334, 2820231422, 616750014,  1755297453, 2870980378, 2166597194, 3610428477,
+            851625180,  3175178411, 2824081025, 2139002735, 3068885560, 2481354685, 1801779549,
+            974462588,  1250349190, 44615848,   1409190825, 478782854,  3799630632, 1410487989,
+            136065209,  3146828260, 1418229287, 1958726387, 2073434786, 933771929,  3197538503,
+            3404885230, 2759771318, 4065759839, 1046141177, 1157598630, 2612191836, 3752531902,
+            1865421371, 3855220097, 3238934533, 348197893,  3640601820, 2149980242, 2238335564,
+            1283961638, 2689253279, 3980562548, 4028166647, 1560770711, 3304871535, 4082879926,
+            670533937,  2757001712, 2785653920, 664115074,  2437009856, 3980466606, 924961619,
+            2682280948, 2622520428, 3035929138, 1663347455, 2504545012, 3952610051, 647863809,
+            378491109,  1689947333, 146379450,  1024932267, 3323700414, 3891892774, 112718424,
+            361194627,  272549074,  2486783762, 1166960170, 1390957351, 2738601511, 3207243585,
+            3847827218, 3504326850, 4202117803, 3033430382, 770192937,  570569892,  1460350268,
+            86249357,   4108159492, 4219421026, 166713290,  3756014281, 593053024,  2266047368,
+            4087648850, 1459141085, 2456229280, 289348723,  3671095509, 2954169301, 2065485135,
+            3164643165, 130090401,  3595064912, 803946480,  1032658086, 2885151028, 1044443641,
+            2038017360, 2466144217, 1102029355, 1311494491, 2775502362, 1223209540, 3199809225,
+            1567651341, 210763357,  4210502235, 1669584133, 3264385618, 2567323162, 4263520968,
+            3774048985, 764960801,  1230586586, 4073036209, 456893132,  1750392854, 476111955,
+            689036062,  2004015589, 3303532566, 2330012865, 4127270899, 1133622972, 2205796688,
+            3125813874, 472110226,  1950272482, 1326018344, 3572513558, 432100244,  1986793636,
+            3550724414, 591432841,  3487970872, 3195889245, 3814713993, 4165735674, 2185345476,
+            964113070,  1599473208, 1218699484, 888133966,  421620858,  2524343616, 3004128323,
+            1554821561, 2653160155, 3326119326, 2589293184, 2543685019, 3431929083, 1343977688,
+            4181822334, 807315547,  616750014,  1755297453, 2870980378, 2166597194, 297453390,
+            851625180,  3175178411, 2824081025, 2139002735, 2150787741, 2481354685, 1801779549,
+            974462588,  1250349190, 3313972880, 1409190825, 478782854,  3799630632, 1410487989,
+            2399710558, 3146828260, 1418229287, 1958726387, 2073434786, 2256785768, 3197538503,
+            3404885230, 2759771318, 4065759839, 1959168682, 3220259217, 788515126,  4132174225,
+            3505848280, 2433709867, 4175943505, 3747798187, 650494767,  2510247257, 342179175,
+            956294097,  753554215,  3733232734, 163274738,  2896935025, 309552327,  4054088324,
+            2514224517, 1045247704, 2412267165, 180120315,  119482137,  1233982578, 1354725377,
+            2833684607, 860102655,  559428440,  863800868,  55238911,   1612541328, 3026128745,
+            523001613,  656880219,  4113961461, 2049215193, 277664757,  1133508144, 264614573,
+            3394839447, 2732702692, 2632096802, 2748525253, 773039904,  1616454314, 133364716,
+            2800268949, 1895831427, 2776513583, 1482114643, 4074765560, 3187409025, 1555161491,
+            3668488468, 3864559079, 2897477010, 3036329955, 1258141381, 3491493305, 408552723,
+            2855954644, 2059391181, 3743997634, 3983621037, 609415878,  1145266795, 121072084,
+            772346119,  1239876370, 2727255072, 1830930653, 3058093102, 2201837322, 3358410487,
+            3426786136, 296132027,  568802287,  3116303900, 1330696994, 4272276600, 2256339396,
+            938482607,  593951004,  334737854,  1961308310, 946390768,  2510219150, 1613698996,
+            1025624418, 4176884451, 3874101333, 2660006416, 1968236548, 2098491647, 3427607911,
+            1911424127, 3597921448, 1400970020, 4179469598, 1790197302, 3976031334, 404298990,
+            3395445497, 77026349,   1690786285, 888151908,  194108146,  3187520527, 3897531296,
+            2628613438, 2326002676, 4041683160, 1611692269, 2906239435, 2352099246, 3505336626,
+            1091903386, 545100539,  1705557211, 1584192124, 2006825432, 1747672165, 3537297990,
+            342804002,  2067441785, 3952213632, 2947366249, 601767691,  2806067104, 2747528878,
+            3047357716, 780807784,  779494319,  3645344415, 3112062015, 2827820038, 1044286297,
+            225890044,  254525417,  3532770360, 2311096573, 166912608,  2585040349, 4050676864,
+            3412423420, 3731470697, 468619257,  1209009232, 1419354582, 3068158718, 2872474407,
+            608097913,  2678988701, 3408292282, 3214517065, 2265534481, 25854329,   3206287806,
+            1978563920, 3515922918,
+        },
+        {
+            1486053891, 1878909589, 303559897,  1517820255, 4144456646, 2824389643, 2965956478,
+            1781699771, 4114917373, 3957941791, 125790243,  2374366193, 1312820895, 255559276,
+            902575334,  509477660,  3815474942, 3617747235, 143034740,  1743675144, 3165839005,
+            1872832110, 672103232,  3406139380, 2444100301, 2217780102, 3655174478, 2184231581,
+            2217044148, 459664340,  3714742534, 970685827,  2980071875, 346871747,  3200800042,
+            454331701,  321842626,  675929983,  234522975,  1500775748, 2659850861, 1823869606,
+            3539896216, 2625204034, 2413920698, 1093324237, 1946476691, 1022724846, 2317608591,
+            2729256936, 2268613417, 1814780458, 1343163721, 2430800392, 740880961,  2795023662,
+            1084306242, 3510777566, 2144677961, 1844898576, 1330133562, 1488590409, 1283076433,
+            86499620,   750755113,  4030511634, 688565835,  1519301388, 3433422638, 2600398078,
+            4117195003, 4194368998, 3958043805, 3179850215, 3616931730, 3199125259, 482421873,
+            33273840,   1758847646, 1643063903, 3323098725, 3531078221, 463431993,  1568249476,
+            2961434979, 1563127442, 1323922151, 394522288,  580250716,  389101479,  3697070718,
+            403995335,  1260352900, 860225100,  3584098743, 3582740984, 4276093368, 1387376218,
+            2939480789, 3491388716, 2765480570, 3664441816, 2529960212, 3776708498, 3228900659,
+            1448007677, 1634627867, 814725213,  3745491449, 1417324712, 2478610844, 3424409371,
+            37441567,   3335934771, 4112888610, 1300174626, 807134554,  3357073849, 2489157606,
+            3501861156, 3206952513, 1550272647, 4138560272, 796404998,  1782305309, 325704946,
+            492517436,  3205536573, 716202545,  929483109,  617248409,  4141097165, 2470587082,
+            1024335120, 2818001172, 509237097,  2756547275, 1920836396, 770275025,  3731393148,
+            1627520119, 794404507,  2425600047, 2973161204, 1610713518, 119070846,  631871961,
+            4279135048, 720512621,  2336416010, 2563786441, 52272943,   3095875859, 2109921785,
+            2678220610, 3351500653, 1728841649, 3898990269, 850495049,  2217075040, 129727443,
+            1486053891, 1878909589, 303559897,  1517820255, 880939405,  2824389643, 2965956478,
+            1781699771, 4114917373, 1405654610, 125790243,  2374366193, 1312820895, 255559276,
+            1319803205, 509477660,  3815474942, 3617747235, 143034740,  1265779129, 3165839005,
+            1872832110, 672103232,  3406139380, 2428677333, 2217780102, 3655174478, 2184231581,
+            2217044148, 2155418054, 3714742534, 970685827,  2980071875, 346871747,  1632529483,
+            454331701,  321842626,  675929983,  234522975,  1521380618, 2659850861, 1823869606,
+            3539896216, 2625204034, 2904956763, 1093324237, 1946476691, 1022724846, 2317608591,
+            1928134739, 2268613417, 1814780458, 1343163721, 2430800392, 2217098156, 2795023662,
+            1084306242, 3510777566, 2144677961, 555425123,  1330133562, 1488590409, 1283076433,
+            86499620,   2737949717, 4030511634, 688565835,  1519301388, 3433422638, 1925330262,
+            4117195003, 4194368998, 3958043805, 3179850215, 2846903321, 3199125259, 482421873,
+            33273840,   1758847646, 3729626958, 3323098725, 3531078221, 463431993,  1568249476,
+            165572212,  1563127442, 1323922151, 394522288,  580250716,  2495137569, 3697070718,
+            403995335,  1260352900, 860225100,  1662620371, 3582740984, 4276093368, 1387376218,
+            2939480789, 353110937,  2765480570, 3664441816, 2529960212, 3776708498, 3971715532,
+            1448007677, 1634627867, 814725213,  3745491449, 995847142,  2478610844, 3424409371,
+            37441567,   3335934771, 3423669426, 1300174626, 807134554,  3357073849, 2489157606,
+            1929326219, 3206952513, 1550272647, 4138560272, 796404998,  1908432944, 325704946,
+            492517436,  3205536573, 716202545,  4161457968, 617248409,  4141097165, 2470587082,
+            1024335120, 470682742,  509237097,  2756547275, 1920836396, 770275025,  1425332626,
+            1627520119, 794404507,  2425600047, 2973161204, 3362475121, 119070846,  631871961,
+            4279135048, 720512621,  3714311860, 2563786441, 52272943,   3095875859, 2109921785,
+            2744962540, 3351500653, 1728841649, 3898990269, 850495049,  739029821,  129727443,
+            1486053891, 1878909589, 303559897,  272359357,  880939405,  2824389643, 2965956478,
+            1781699771, 2968368126, 1405654610, 125790243,  2374366193, 1312820895, 2080448078,
+            1319803205, 509477660,  3815474942, 3617747235, 733631781,  1265779129, 3165839005,
+            1872832110, 672103232,  3600976825, 2428677333, 2217780102, 3655174478, 2184231581,
+            3153696789, 2155418054, 3714742534, 970685827,  2980071875, 3017987520, 1632529483,
+            454331701,  321842626,  675929983,  709404306,  1521380618, 2659850861, 1823869606,
+            3539896216, 548287180,  2904956763, 1093324237, 1946476691, 1022724846, 1432133363,
+            1928134739, 2268613417, 1814780458, 1343163721, 1958535537, 2217098156, 2795023662,
+            1084306242, 3510777566, 2921528361, 555425123,  1330133562, 1488590409, 1283076433,
+            3707779815, 2737949717, 4030511634, 688565835,  1519301388, 2251728173, 1925330262,
+            4117195003, 4194368998, 3958043805, 3899214621, 2846903321, 3199125259, 482421873,
+            33273840,   2294296547, 3729626958, 3323098725, 3531078221, 463431993,  917839738,
+            165572212,  1563127442, 1323922151, 394522288,  1401274677, 2495137569, 3697070718,
+            403995335,  1260352900, 2542873211, 1662620371, 3582740984, 4276093368, 1387376218,
+            3342618882, 353110937,  2765480570, 3664441816, 2529960212, 2186416090, 3971715532,
+            1448007677, 1634627867, 814725213,  2187329082, 995847142,  2478610844, 3424409371,
+            37441567,   2426308868, 3423669426, 1300174626, 807134554,  3357073849, 3198926231,
+            1929326219, 3206952513, 1550272647, 4138560272, 3844879504, 1908432944, 325704946,
+            492517436,  3205536573, 2713162311, 4161457968, 617248409,  4141097165, 2470587082,
+            3975904649, 470682742,  509237097,  2756547275, 1920836396, 529649694,  1425332626,
+            1627520119, 794404507,  2425600047, 443356035,  3362475121, 119070846,  631871961,
+            4279135048, 4201865069, 3714311860, 2563786441, 52272943,   3095875859, 986321946,
+            2744962540, 3351500653, 1728841649, 3898990269, 1743358149, 739029821,  129727443,
+            1486053891, 1878909589, 2547689859, 272359357,  880939405,  2824389643, 2965956478,
+            3344839304, 2968368126, 1405654610, 125790243,  2374366193, 3446903587, 2080448078,
+            1319803205, 509477660,  3815474942, 3121615415, 733631781,  1265779129, 3165839005,
+            1872832110, 2602951700, 3600976825, 2428677333, 2217780102, 3655174478, 3283072576,
+            3153696789, 2155418054, 3714742534, 970685827,  113913353,  3017987520, 1632529483,
+            454331701,  321842626,  629570978,  709404306,  1521380618, 2659850861, 1823869606,
+            101809820,  548287180,  2904956763, 1093324237, 1946476691, 1151789313, 1432133363,
+            1928134739, 2268613417, 1814780458, 2702524602, 1958535537, 2217098156, 2795023662,
+            1084306242, 1853947594, 2921528361, 555425123,  1330133562, 1488590409, 1300531748,
+            3707779815, 2737949717, 4030511634, 688565835,  3212598260, 2251728173, 1925330262,
+            4117195003, 4194368998, 2508610726, 3899214621, 2846903321, 3199125259, 482421873,
+            2225346383, 2294296547, 3729626958, 3323098725, 3531078221, 3185341105, 917839738,
+            165572212,  1563127442, 1323922151, 2499466260, 1401274677, 2495137569, 3697070718,
+            403995335,  848685490,  2542873211, 1662620371, 3582740984, 4276093368, 2281244079,
+            3342618882, 353110937,  2765480570, 3664441816, 827826242,  2186416090, 3971715532,
+            1448007677, 1634627867, 3363945765, 2187329082, 995847142,  2478610844, 3424409371,
+            1188839169, 2426308868, 3423669426, 1300174626, 807134554,  3812930638, 3198926231,
+            1929326219, 3206952513, 1550272647, 3901404006, 3844879504, 1908432944, 325704946,
+            492517436,  3404727025, 2713162311, 4161457968, 617248409,  4141097165, 2813694193,
+            3975904649, 470682742,  509237097,  2756547275, 888346416,  529649694,  1425332626,
+            1627520119, 794404507,  2864389529, 443356035,  3362475121, 119070846,  631871961,
+            1638657967, 4201865069, 3714311860, 2563786441, 52272943,   1148791610, 986321946,
+            2744962540, 3351500653, 1728841649, 2720775703, 151518666,  3052326017, 423115,
+            179374573,  3453377666, 454035731,  4019639774, 4144043789, 1578670542, 2099166204,
+            1898093992, 449999395,  484995346,  2377417018, 2674305688, 762669038,  1334963472,
+            3726845490, 3153313250, 3435514648, 2430960246, 2991834009, 1378098981, 1527680755,
+            1092418578, 3837592432, 739627870,  21056200,   1386555256, 3412202716, 3676134517,
+            1441961315, 2518915083, 4029079380, 2137022037, 518362288,  3742913127, 2072942796,
+            2509330588, 3861928793, 151786698,  2869271813, 3046657867, 3746825020, 1048845174,
+            503995287,  3180737859, 3621047862, 6536180,    3553689321, 890654979,  1135090862,
+            3144629849, 830028542,  1733289196, 1914639127, 3319310048, 4111158629, 3958619714,
+            3401200177, 2285973341, 1144241988, 4098250266, 4180865015, 647970429,  2201115672,
+            3345277998, 2526918671, 558922030,  2724218603, 602067806,  2318017188, 221138830,
+            1389737535, 3024467777, 3279639686, 3036008489, 3093323273, 2084499739, 746316710,
+            1649437744, 2439967805, 1111262167, 3282643710, 3895060545, 2572583633, 4073230388,
+            1207008051, 1296313997, 1056886337, 805197015,  4123416700, 2862387530, 1213425637,
+            3803758433, 2682769330, 2770715193, 2062575641, 1960006258, 3398408409, 2080290798,
+            220192932,  1200086860, 2169141372, 3433240609, 1563102623, 3169289587, 1469987628,
+            3973000388, 2247773826, 2310917534, 3420589591, 1049830609, 3470885604, 1338677601,
+            2907908080, 3167500531, 3685708691, 3723401043, 914893464,  2984052296, 1603548273,
+            1645757770, 3334075689, 2699015676, 1671333686, 130166675,  3978280981, 2902515488,
+            3301326393, 3221241267, 3458875680, 1674461097, 3481869885, 2756018576, 2164364807,
+            2876393426, 1262416866, 180015393,  1678874782, 1357025198, 1332961200, 461866530,
+            2055633493, 734757292,  2171640885, 2602405814, 1400292295, 1416504249, 3459645819,
+            2946363092, 1441706425, 2290964237, 274534852,  2196866918, 3330845788, 4232230982,
+            1608414634, 2552079047,
+        },
+        {
+            109243989,  1280011190, 1868314433, 1152479928, 2555121087, 1885343936, 2696735454,
+            2596501318, 3219539390, 979624654,  1982911398, 120258746,  3992910779, 665915698,
+            3522485495, 295257638,  2854731914, 3528899703, 4137933275, 4158874685, 2035960307,
+            4286865279, 1477113968, 984548220,  3002862189, 3876693023, 2233979381, 3471928965,
+            2384086358, 3647362149, 2379602154, 2204916799, 887405702,  1030669279, 2999160244,
+            2655691102, 2826724982, 109601568,  3130182593, 782546834,  957140763,  1752636379,
+            2540677921, 2945643976, 2134356525, 1156590894, 2388050619, 1201797460, 706219575,
+            4145832536, 3265591518, 860656441,  1420247298, 58214649,   1376631912, 1857536473,
+            4252834197, 1465123756, 3540233243, 3986780299, 1637536949, 3123585239, 2799571825,
+            3305162237, 3301489718, 819948178,  404986149,  125523996,  3649539610, 2927686810,
+            3208858351, 1181587040, 3956694291, 1100068144, 3877787273, 277036681,  3698450599,
+            3350344227, 3267215084, 3426786013, 662304490,  3587979141, 1468821198, 1520637017,
+            1004136168, 2406744351, 1984413712, 570263665,  1936073575, 763866347,  686033215,
+            3146622892, 4227754142, 3155145901, 1024723501, 3770241602, 3946428103, 3111420563,
+            2037787234, 1099650739, 212370972,  165977239,  4272707019, 3195567399, 3384504547,
+            3341463878, 76557787,   621674826,  3306858953, 3186298139, 931175547,  59913032,
+            3820196888, 3082836165, 3598128072, 2615250082, 2895296266, 966742638,  921598717,
+            982367288,  3795143476, 828634024,  4238439439, 1248881973, 2297399994, 3609772637,
+            4271412439, 882311511,  2144738538, 3643477994, 1080984080, 1238230332, 435473361,
+            911716911,  1312020140, 1376623151, 2193810070, 3578934263, 3572254470, 3868137909,
+            835428778,  3993414668, 504263190,  1035527678, 2018252827, 901253063,  712719010,
+            1924601391, 2506939756, 1527082533, 893655981,  2883493273, 1116989515, 2401344493,
+            886873130,  885086378,  4269789238, 3608780425, 1318367205, 1474487668, 2756382619,
+            109243989,  1280011190, 1868314433, 1152479928, 555290730,  1885343936, 2696735454,
+            2596501318, 3219539390, 1673752105, 1982911398, 120258746,  3992910779, 665915698,
+            767197122,  295257638,  2854731914, 3528899703, 4137933275, 3568465830, 2035960307,
+            4286865279, 1477113968, 984548220,  3171588756, 3876693023, 2233979381, 3471928965,
+            2384086358, 963022324,  2379602154, 2204916799, 887405702,  1030669279, 3691734612,
+            2655691102, 2826724982, 109601568,  3130182593, 525508988,  957140763,  1752636379,
+            2540677921, 2945643976, 4019898564, 1156590894, 2388050619, 1201797460, 706219575,
+            675343769,  3265591518, 860656441,  1420247298, 58214649,   3362571648, 1857536473,
+            4252834197, 1465123756, 3540233243, 4087972513, 1637536949, 3123585239, 2799571825,
+            3305162237, 1223608106, 819948178,  404986149,  125523996,  3649539610, 2001394156,
+            3208858351, 1181587040, 3956694291, 1100068144, 3601976179, 277036681,  3698450599,
+            3350344227, 3267215084, 2661211110, 662304490,  3587979141, 1468821198, 1520637017,
+            3764864751, 2406744351, 1984413712, 570263665,  1936073575, 867397695,  686033215,
+            3146622892, 4227754142, 3155145901, 2073103219, 3770241602, 3946428103, 3111420563,
+            2037787234, 2790669199, 212370972,  165977239,  4272707019, 3195567399, 3553042482,
+            3341463878, 76557787,   621674826,  3306858953, 153594102,  931175547,  59913032,
+            3820196888, 3082836165, 727075433,  2615250082, 2895296266, 966742638,  921598717,
+            691618670,  3795143476, 828634024,  4238439439, 1248881973, 4100957056, 3609772637,
+            4271412439, 882311511,  2144738538, 3314640107, 1080984080, 1238230332, 435473361,
+            911716911,  4018305899, 1376623151, 2193810070, 3578934263, 3572254470, 2727038294,
+            835428778,  3993414668, 504263190,  1035527678, 2692539897, 901253063,  712719010,
+            1924601391, 2506939756, 903222257,  893655981,  2883493273, 1116989515, 2401344493,
+            2363276441, 885086378,  4269789238, 3608780425, 1318367205, 1565005267, 2756382619,
+            109243989,  1280011190, 1868314433, 2886558880, 555290730,  1885343936, 2696735454,
+            2596501318, 256701420,  1673752105, 1982911398, 120258746,  3992910779, 10671248,
+            767197122,  295257638,  2854731914, 3528899703, 2174633296, 3568465830, 2035960307,
+            4286865279, 1477113968, 2075800065, 3171588756, 3876693023, 2233979381, 3471928965,
+            4258033990, 963022324,  2379602154, 2204916799, 887405702,  1522874444, 3691734612,
+            2655691102, 2826724982, 109601568,  939380806,  525508988,  957140763,  1752636379,
+            2540677921, 249025748,  4019898564, 1156590894, 2388050619, 1201797460, 153981857,
+            675343769,  3265591518, 860656441,  1420247298, 2349777883, 3362571648, 1857536473,
+            4252834197, 1465123756, 3356563770, 4087972513, 1637536949, 3123585239, 2799571825,
+            2036396290, 1223608106, 819948178,  404986149,  125523996,  3263067540, 2001394156,
+            3208858351, 1181587040, 3956694291, 582360337,  3601976179, 277036681,  3698450599,
+            3350344227, 634623963,  2661211110, 662304490,  3587979141, 1468821198, 915984386,
+            3764864751, 2406744351, 1984413712, 570263665,  1181282452, 867397695,  686033215,
+            3146622892, 4227754142, 4049731430, 2073103219, 3770241602, 3946428103, 3111420563,
+            2014061935, 2790669199, 212370972,  165977239,  4272707019, 1936750206, 3553042482,
+            3341463878, 76557787,   621674826,  782108067,  153594102,  931175547,  59913032,
+            3820196888, 1751470526, 727075433,  2615250082, 2895296266, 966742638,  4020779271,
+            691618670,  3795143476, 828634024,  4238439439, 25953846,   4100957056, 3609772637,
+            4271412439, 882311511,  3216467229, 3314640107, 1080984080, 1238230332, 435473361,
+            1017367449, 4018305899, 1376623151, 2193810070, 3578934263, 1413432010, 2727038294,
+            835428778,  3993414668, 504263190,  2629088747, 2692539897, 901253063,  712719010,
+            1924601391, 2203075176, 903222257,  893655981,  2883493273, 1116989515, 2255079151,
+            2363276441, 885086378,  4269789238, 3608780425, 1322637147, 1565005267, 2756382619,
+            109243989,  1280011190, 3643195359, 2886558880, 555290730,  1885343936, 2696735454,
+            1827002854, 256701420,  1673752105, 1982911398, 120258746,  2460948060, 10671248,
+            767197122,  295257638,  2854731914, 4150356718, 2174633296, 3568465830, 2035960307,
+            4286865279, 3335657856, 2075800065, 3171588756, 3876693023, 2233979381, 1721506041,
+            4258033990, 963022324,  2379602154, 2204916799, 3555399703, 1522874444, 3691734612,
+            2655691102, 2826724982, 539755949,  939380806,  525508988,  957140763,  1752636379,
+            3496842606, 249025748,  4019898564, 1156590894, 2388050619, 4068354590, 153981857,
+            675343769,  3265591518, 860656441,  599391878,  2349777883, 3362571648, 1857536473,
+            4252834197, 2012396392, 3356563770, 4087972513, 1637536949, 3123585239, 1863936979,
+            2036396290, 1223608106, 819948178,  404986149,  1380790036, 3263067540, 2001394156,
+            3208858351, 1181587040, 1552978800, 582360337,  3601976179, 277036681,  3698450599,
+            2436805620, 634623963,  2661211110, 662304490,  3587979141, 341297740,  915984386,
+            3764864751, 2406744351, 1984413712, 2329120626, 1181282452, 867397695,  686033215,
+            3146622892, 1281034928, 4049731430, 2073103219, 3770241602, 3946428103, 738249936,
+            2014061935, 2790669199, 212370972,  165977239,  748909542,  1936750206, 3553042482,
+            3341463878, 76557787,   2482900416, 782108067,  153594102,  931175547,  59913032,
+            984739994,  1751470526, 727075433,  2615250082, 2895296266, 2451802446, 4020779271,
+            691618670,  3795143476, 828634024,  413687743,  25953846,   4100957056, 3609772637,
+            4271412439, 1347324233, 3216467229, 3314640107, 1080984080, 1238230332, 555936972,
+            1017367449, 4018305899, 1376623151, 2193810070, 3224058733, 1413432010, 2727038294,
+            835428778,  3993414668, 2297351708, 2629088747, 2692539897, 901253063,  712719010,
+            1018198680, 2203075176, 903222257,  893655981,  2883493273, 2637756987, 2255079151,
+            2363276441, 885086378,  4269789238, 3005995326, 3822655339, 1658868255, 1968818034,
+            546657951,  4284527240, 2357534762, 642850983,  3977628365, 897547920,  1608276054,
+            373708652,  2578933017, 3614844931, 497716654,  347878234,  2498010006, 4206298771,
+            2664364363, 2050793463, 505878798,  3698413735, 3019021046, 1397653432, 3846009813,
+            2864917885, 114910253,  3932027392, 2819269789, 3062014368, 629135068,  2159919513,
+            755114803,  3169613323, 100534431,  318226064,  1861306773, 1237549082, 4117438618,
+            995852142,  892805959,  3994914561, 873370344,  3475588510, 2258633720, 1791512784,
+            2537466924, 4284335113, 4187595042, 1838801299, 3277721532, 1349751788, 2827540684,
+            885499518,  2834083954, 2951606034, 2113401283, 1621346004, 1350237866, 655713226,
+            4211517931, 3991850415, 3832903178, 1887799677, 1257773281, 765159826,  1723120881,
+            3915296239, 3505417631, 3343259303, 1632876110, 4057389185, 3020919595, 1586491090,
+            2837250284, 4054048855, 2438657228, 4172676606, 433609913,  1087567,    1629151020,
+            3247088287, 1733918166, 1541883177, 1541843572, 607567536,  4136296476, 1900021594,
+            661197226,  121907023,  3267903963, 2275884606, 2647303189, 1221698769, 1555330247,
+            1013549035, 1264129059, 937191988,  155974271,  2334477457, 833539655,  2197833874,
+            2720064281, 662182327,  3763481068, 3337327840, 2974955332, 3058585631, 2941859834,
+            1967687620, 3485266071, 1543858879, 3869798651, 1015142697, 1715738923, 996907384,
+            2380562801, 1158060856, 1658315948, 217667044,  2662222341, 1496092388, 588169505,
+            3414341191, 1250526253, 1528483906, 1953239333, 3402647511, 490406264,  1240187891,
+            4691944,    2486378471, 3540910372, 1833262201, 1663562798, 2352933011, 2693221367,
+            210187773,  4123999722, 1037330464, 1436634543, 2508879554, 3249878024, 1665038686,
+            1391843572, 937336536,  3207614660, 595911983,  2214068438, 3057649425, 3292135750,
+            4169825246, 2077899190, 1309420103, 2068328938, 228282280,  2426647955, 382366588,
+            2585186277, 2933364559,
+        },
+        {
+            3189313664, 1074128131, 3212646707, 4119747699, 2866661461, 1363029517, 3222824536,
+            1328023827, 3427891933, 763284499,  432126372,  1935325245, 511954795,  1617400931,
+            1638895014, 2358305280, 4290511169, 3351678257, 1795820563, 572767797,  918735375,
+            640356549,  2006967162, 3524529923, 992478158,  1777190199, 658363697,  1160003345,
+            1591275595, 1608305197, 864399044,  651398986,  520096109,  1572448654, 1079822110,
+            3442757135, 594052674,  733996436,  1147110950, 541799286,  2428791151, 606854905,
+            4248220181, 3070982061, 896066024,  1559808941, 314570495,  1505832962, 3325555962,
+            2303540642, 1668029237, 212033168,  3473883153, 2231400049, 3858747788, 3459208089,
+            1145176480, 508452556,  586047150,  27303271,   2885188199, 2145298668, 258438046,
+            2444162828, 3105671637, 3100173015, 3623681791, 271872544,  3535133159, 721167890,
+            2770783791, 1183891182, 3231728173, 755082961,  2992362662, 3565323194, 500915102,
+            977659837,  4148816309, 1185392279, 1829775258, 2755228365, 3447075,    3099154988,
+            2897600590, 2633154806, 1565551149, 2867687193, 2258450695, 1827932800, 1516030979,
+            1398124768, 988861850,  2117051505, 3549960617, 2603432732, 3757912570, 2390552408,
+            715891717,  3974136916, 517087300,  4253143036, 3383882739, 2966276450, 3521436829,
+            3553138565, 3691105567, 2498869075, 1319999062, 2083426696, 1061455781, 2130049890,
+            3792479397, 3163314973, 3696135142, 2093203697, 1100212579, 4158694065, 2529611080,
+            1265880192, 3420263644, 1545574203, 615332086,  153398602,  965571057,  758231908,
+            4055071268, 4004828598, 3638327317, 2195047764, 2915957366, 629036666,  2618851374,
+            3598852150, 466330657,  123854925,  870090269,  3325329126, 984523573,  1220238682,
+            1902176661, 1388194890, 3219496161, 3554401431, 918687169,  1984558009, 1512194260,
+            3888303166, 3167589719, 1882761400, 1347392967, 3567318718, 4246097687, 3411695984,
+            2067362478, 672478417,  3121176147, 3291849934, 2573348820, 1988246920, 3470462359,
+            3189313664, 1074128131, 3212646707, 4119747699, 3598016162, 1363029517, 3222824536,
+            1328023827, 3427891933, 3470356201, 432126372,  1935325245, 511954795,  1617400931,
+            2315685271, 2358305280, 4290511169, 3351678257, 1795820563, 2682030556, 918735375,
+            640356549,  2006967162, 3524529923, 2234782146, 1777190199, 658363697,  1160003345,
+            1591275595, 1474157333, 864399044,  651398986,  520096109,  1572448654, 3587202026,
+            3442757135, 594052674,  733996436,  1147110950, 1103329987, 2428791151, 606854905,
+            4248220181, 3070982061, 3489897333, 1559808941, 314570495,  1505832962, 3325555962,
+            3655314147, 1668029237, 212033168,  3473883153, 2231400049, 98650745,   3459208089,
+            1145176480, 508452556,  586047150,  3627700627, 2885188199, 2145298668, 258438046,
+            2444162828, 2484065788, 3100173015, 3623681791, 271872544,  3535133159, 922749156,
+            2770783791, 1183891182, 3231728173, 755082961,  2587908749, 3565323194, 500915102,
+            977659837,  4148816309, 2718592178, 1829775258, 2755228365, 3447075,    3099154988,
+            2878033371, 2633154806, 1565551149, 2867687193, 2258450695, 923131445,  1516030979,
+            1398124768, 988861850,  2117051505, 801053081,  2603432732, 3757912570, 2390552408,
+            715891717,  3820775278, 517087300,  4253143036, 3383882739, 2966276450, 2466977911,
+            3553138565, 3691105567, 2498869075, 1319999062, 3042384203, 1061455781, 2130049890,
+            3792479397, 3163314973, 1939904159, 2093203697, 1100212579, 4158694065, 2529611080,
+            3001496926, 3420263644, 1545574203, 615332086,  153398602,  2539829926, 758231908,
+            4055071268, 4004828598, 3638327317, 2967548273, 2915957366, 629036666,  2618851374,
+            3598852150, 2474075118, 123854925,  870090269,  3325329126, 984523573,  1602435458,
+            1902176661, 1388194890, 3219496161, 3554401431, 1892462,    1984558009, 1512194260,
+            3888303166, 3167589719, 3479485175, 1347392967, 3567318718, 4246097687, 3411695984,
+            546851013,  672478417,  3121176147, 3291849934, 2573348820, 1991438783, 3470462359,
+            3189313664, 1074128131, 3212646707, 3927998941, 3598016162, 1363029517, 3222824536,
+            1328023827, 2761115936, 3470356201, 432126372,  1935325245, 511954795,  1508207399,
+            2315685271, 2358305280, 4290511169, 3351678257, 2418394988, 2682030556, 918735375,
+            640356549,  2006967162, 904837895,  2234782146, 1777190199, 658363697,  1160003345,
+            3188975636, 1474157333, 864399044,  651398986,  520096109,  2523821197, 3587202026,
+            3442757135, 594052674,  733996436,  1815943904, 1103329987, 2428791151, 606854905,
+            4248220181, 18493535,   3489897333, 1559808941, 314570495,  1505832962, 1955326186,
+            3655314147, 1668029237, 212033168,  3473883153, 2466493976, 98650745,   3459208089,
+            1145176480, 508452556,  3765930354, 3627700627, 2885188199, 2145298668, 258438046,
+            2567096881, 2484065788, 3100173015, 3623681791, 271872544,  2182754693, 922749156,
+            2770783791, 1183891182, 3231728173, 742278048,  2587908749, 3565323194, 500915102,
+            977659837,  1951816004, 2718592178, 1829775258, 2755228365, 3447075,    2874022813,
+            2878033371, 2633154806, 1565551149, 2867687193, 1269293108, 923131445,  1516030979,
+            1398124768, 988861850,  845969315,  801053081,  2603432732, 3757912570, 2390552408,
+            2175952358, 3820775278, 517087300,  4253143036, 3383882739, 2779312150, 2466977911,
+            3553138565, 3691105567, 2498869075, 580785888,  3042384203, 1061455781, 2130049890,
+            3792479397, 3290233990, 1939904159, 2093203697, 1100212579, 4158694065, 3828878191,
+            3001496926, 3420263644, 1545574203, 615332086,  2430003284, 2539829926, 758231908,
+            4055071268, 4004828598, 1633189408, 2967548273, 2915957366, 629036666,  2618851374,
+            2721739284, 2474075118, 123854925,  870090269,  3325329126, 1796971901, 1602435458,
+            1902176661, 1388194890, 3219496161, 468147718,  1892462,    1984558009, 1512194260,
+            3888303166, 1320492017, 3479485175, 1347392967, 3567318718, 4246097687, 134598381,
+            546851013,  672478417,  3121176147, 3291849934, 2295825749, 1991438783, 3470462359,
+            3189313664, 1074128131, 1658533022, 3927998941, 3598016162, 1363029517, 3222824536,
+            4117948925, 2761115936, 3470356201, 432126372,  1935325245, 1416929322, 1508207399,
+            2315685271, 2358305280, 4290511169, 3637475195, 2418394988, 2682030556, 918735375,
+            640356549,  206967786,  904837895,  2234782146, 1777190199, 658363697,  4031502436,
+            3188975636, 1474157333, 864399044,  651398986,  295855170,  2523821197, 3587202026,
+            3442757135, 594052674,  2703936954, 1815943904, 1103329987, 2428791151, 606854905,
+            3858806172, 18493535,   3489897333, 1559808941, 314570495,  3389662310, 1955326186,
+            3655314147, 1668029237, 212033168,  136117295,  2466493976, 98650745,   3459208089,
+            1145176480, 1673619751, 3765930354, 3627700627, 2885188199, 2145298668, 1968642257,
+            2567096881, 2484065788, 3100173015, 3623681791, 2215799595, 2182754693, 922749156,
+            2770783791, 1183891182, 1205950206, 742278048,  2587908749, 3565323194, 500915102,
+            1321707741, 1951816004, 2718592178, 1829775258, 2755228365, 3568873754, 2874022813,
+            2878033371, 2633154806, 1565551149, 4129457938, 1269293108, 923131445,  1516030979,
+            1398124768, 2064449741, 845969315,  801053081,  2603432732, 3757912570, 1233453316,
+            2175952358, 3820775278, 517087300,  4253143036, 2894409199, 2779312150, 2466977911,
+            3553138565, 3691105567, 659434574,  580785888,  3042384203, 1061455781, 2130049890,
+            2076772632, 3290233990, 1939904159, 2093203697, 1100212579, 1974322550, 3828878191,
+            3001496926, 3420263644, 1545574203, 52847527,   2430003284, 2539829926, 758231908,
+            4055071268, 1214726287, 1633189408, 2967548273, 2915957366, 629036666,  1395312308,
+            2721739284, 2474075118, 123854925,  870090269,  1468678964, 1796971901, 1602435458,
+            1902176661, 1388194890, 144362616,  468147718,  1892462,    1984558009, 1512194260,
+            730480211,  1320492017, 3479485175, 1347392967, 3567318718, 1563166902, 134598381,
+            546851013,  672478417,  3121176147, 1362289061, 70335529,   2952246245, 3317077479,
+            4254409491, 288818342,  3142329626, 1517940630, 1869307314, 1211470838, 3509543678,
+            4100205577, 2519242059, 1108709793, 2100654151, 3799007168, 1436219985, 63003995,
+            2305283154, 2467360563, 3721681113, 3715399283, 2761567125, 2251990644, 1456815719,
+            3365934370, 185944913,  3815238790, 1986060361, 2093881257, 3493439242, 3336564834,
+            451176963,  652302402,  2409656974, 3818808763, 264162349,  10486942,   2531776865,
+            2709955105, 3631174097, 3922432650, 3179021373, 3861729820, 1956324740, 3487780249,
+            3717995728, 271785229,  1665348311, 3829702431, 3870134028, 1646817909, 1809377620,
+            2596570120, 4035769586, 4253208020, 2574302270, 1134003733, 4199888207, 1451794733,
+            2425229025, 948603991,  445787362,  41033463,   1594099798, 4102022357, 3434426754,
+            2742269103, 3690948197, 1390060558, 1318050079, 2105242571, 683919295,  153381839,
+            1701258465, 1827573189, 1239714867, 3156474147, 1660078075, 1810796691, 3418745745,
+            3262065095, 3235537798, 4136529094, 1382595175, 1302187398, 4140060444, 3968010038,
+            837623996,  2717292607, 3085353471, 3617752561, 384279700,  3378872577, 4153835798,
+            1659590408, 3656988336, 1150379093, 3718173906, 994910578,  1198353035, 1994593029,
+            2489213938, 3388404027, 2314168098, 1877029760, 2970178487, 1994746449, 216627317,
+            2704681716, 2523317020, 2330116433, 3901225888, 1689242644, 2216440576, 3223282037,
+            2936284486, 3065030942, 2113851068, 3856507268, 2014017674, 1661932817, 3189044647,
+            1590408797, 2561535399, 1919765976, 1648675312, 3909552723, 2115486980, 1397285887,
+            1003105795, 1090202641, 964636415,  3757537457, 3946274575, 349326635,  3718803678,
+            3102667069, 3839930313, 207632987,  1856612589, 958655449,  1379432100, 230379302,
+            2094769843, 319809423,  462760951,  7501297,    7247263,    1982293542, 861291165,
+            417103054,  1449748287, 2567822792, 3376564239, 2588998465, 3346854903, 3480829210,
+            4024530399, 3354673422,
+        },
+        {
+            1768926800, 3047027850, 4176795552, 2029136621, 2251221313, 4154425877, 351211355,
+            2940462688, 3591323141, 946823740,  2284802624, 379066061,  375791667,  3245016153,
+            3911617783, 3060325109, 3260778088, 766301866,  697438385,  2021864625, 1682789626,
+            2720519774, 158865726,  57313137,   105517999,  181743471,  50291422,   3953840619,
+            2922171779, 3877765800, 3284223208, 839578082,  2653160390, 3797157157, 3434275056,
+            3066810864, 2123736102, 645614767,  1699373561, 2310087058, 361190413,  3803549836,
+            3277653133, 3891146837, 3013397404, 1311857705, 4022887073, 2439768518, 3176279083,
+            1907450580, 3329439590, 2342595153, 596261051,  809482593,  3320831995, 3818955897,
+            3572836144, 2142766826, 880990587,  1556191694, 1589894077, 2643953247, 2183588696,
+            4271960195, 643540974,  2323625149, 1610833486, 917978177,  4010270286, 3604995735,
+            527949574,  2331200893, 1622378887, 3136051875, 950561610,  59464019,   360307471,
+            3282183512, 771554326,  2497781698, 1064036569, 4216580647, 2486092575, 3304376102,
+            1329657097, 4023413351, 1127573061, 3121451196, 2076826451, 3166050233, 1143136505,
+            442566086,  2418857849, 4055520784, 1798841532, 42305969,   788682799,  1591365406,
+            1149288415, 3796088600, 355713738,  4178817981, 1946414889, 78839461,   1771791178,
+            2481017753, 1128869951, 1533784137, 845304694,  538956166,  2139219657, 810044155,
+            3818007115, 261391771,  3672131967, 2736516219, 2618226138, 1290229215, 2126803226,
+            2652015618, 3648569463, 3794895185, 1367918957, 1319470901, 1765972531, 2638793925,
+            808519799,  4115090712, 2270210549, 587263946,  88018112,   2447937793, 1996655442,
+            221638117,  1424928156, 2015696992, 1027941716, 1925560546, 3218177183, 3947651283,
+            343992130,  3652321022, 3589585176, 936515984,  1038661006, 2761322237, 2117811372,
+            696876835,  3376777589, 473239733,  40269991,   1017678587, 687266406,  2215227388,
+            2068943298, 6932138,    1529861990, 663040684,  825427964,  3932213407, 3928131002,
+            1768926800, 3047027850, 4176795552, 2029136621, 2920148947, 4154425877, 351211355,
+            2940462688, 3591323141, 299651293,  2284802624, 379066061,  375791667,  3245016153,
+            2682959679, 3060325109, 3260778088, 766301866,  697438385,  341855688,  1682789626,
+            2720519774, 158865726,  57313137,   2023231137, 181743471,  50291422,   3953840619,
+            2922171779, 122558294,  3284223208, 839578082,  2653160390, 3797157157, 1970210955,
+            3066810864, 2123736102, 645614767,  1699373561, 3535833196, 361190413,  3803549836,
+            3277653133, 3891146837, 171154683,  1311857705, 4022887073, 2439768518, 3176279083,
+            2390265005, 3329439590, 2342595153, 596261051,  809482593,  431465475,  3818955897,
+            3572836144, 2142766826, 880990587,  3628271862, 1589894077, 2643953247, 2183588696,
+            4271960195, 1401139219, 2323625149, 1610833486, 917978177,  4010270286, 3496396652,
+            527949574,  2331200893, 1622378887, 3136051875, 676862064,  59464019,   360307471,
+            3282183512, 771554326,  1444950788, 1064036569, 4216580647, 2486092575, 3304376102,
+            555229330,  4023413351, 1127573061, 3121451196, 2076826451, 2860356730, 1143136505,
+            442566086,  2418857849, 4055520784, 1213427931, 42305969,   788682799,  1591365406,
+            1149288415, 456244718,  355713738,  4178817981, 1946414889, 78839461,   3667084181,
+            2481017753, 1128869951, 1533784137, 845304694,  484222373,  2139219657, 810044155,
+            3818007115, 261391771,  88046303,   2736516219, 2618226138, 1290229215, 2126803226,
+            2625052008, 3648569463, 3794895185, 1367918957, 1319470901, 2510407300, 2638793925,
+            808519799,  4115090712, 2270210549, 1643933305, 88018112,   2447937793, 1996655442,
+            221638117,  3052952080, 2015696992, 1027941716, 1925560546, 3218177183, 604760413,
+            343992130,  3652321022, 3589585176, 936515984,  4281124970, 2761322237, 2117811372,
+            696876835,  3376777589, 2003282466, 40269991,   1017678587, 687266406,  2215227388,
+            1394128171, 6932138,    1529861990, 663040684,  825427964,  70542390,   3928131002,
+            1768926800, 3047027850, 4176795552, 1675130838, 2920148947, 4154425877, 351211355,
+            2940462688, 1943096978, 299651293,  2284802624, 379066061,  375791667,  1561623262,
+            2682959679, 3060325109, 3260778088, 766301866,  1868089646, 341855688,  1682789626,
+            2720519774, 158865726,  2295490464, 2023231137, 181743471,  50291422,   3953840619,
+            1853039102, 122558294,  3284223208, 839578082,  2653160390, 3590566184, 1970210955,
+            3066810864, 2123736102, 645614767,  204201162,  3535833196, 361190413,  3803549836,
+            3277653133, 315528092,  171154683,  1311857705, 4022887073, 2439768518, 3530033106,
+            2390265005, 3329439590, 2342595153, 596261051,  3213574361, 431465475,  3818955897,
+            3572836144, 2142766826, 4155846238, 3628271862, 1589894077, 2643953247, 2183588696,
+            1929294225, 1401139219, 2323625149, 1610833486, 917978177,  1501408677, 3496396652,
+            527949574,  2331200893, 1622378887, 2521118263, 676862064,  59464019,   360307471,
+            3282183512, 222477395,  1444950788, 1064036569, 4216580647, 2486092575, 3869494481,
+            555229330,  4023413351, 1127573061, 3121451196, 3876306195, 2860356730, 1143136505,
+            442566086,  2418857849, 2397988531, 1213427931, 42305969,   788682799,  1591365406,
+            3657151087, 456244718,  355713738,  4178817981, 1946414889, 2435297582, 3667084181,
+            2481017753, 1128869951, 1533784137, 1518128085, 484222373,  2139219657, 810044155,
+            3818007115, 2309286934, 88046303,   2736516219, 2618226138, 1290229215, 35195594,
+            2625052008, 3648569463, 3794895185, 1367918957, 454613577,  2510407300, 2638793925,
+            808519799,  4115090712, 3409684315, 1643933305, 88018112,   2447937793, 1996655442,
+            2163985161, 3052952080, 2015696992, 1027941716, 1925560546, 3125362890, 604760413,
+            343992130,  3652321022, 3589585176, 540594135,  4281124970, 2761322237, 2117811372,
+            696876835,  3563809720, 2003282466, 40269991,   1017678587, 687266406,  3806695743,
+            1394128171, 6932138,    1529861990, 663040684,  3275917138, 70542390,   3928131002,
+            1768926800, 3047027850, 2399768673, 1675130838, 2920148947, 4154425877, 351211355,
+            3773731511, 1943096978, 299651293,  2284802624, 379066061,  2656125592, 1561623262,
+            2682959679, 3060325109, 3260778088, 1624552618, 1868089646, 341855688,  1682789626,
+            2720519774, 1468087145, 2295490464, 2023231137, 181743471,  50291422,   2946047183,
+            1853039102, 122558294,  3284223208, 839578082,  3208858489, 3590566184, 1970210955,
+            3066810864, 2123736102, 3410010982, 204201162,  3535833196, 361190413,  3803549836,
+            1743120014, 315528092,  171154683,  1311857705, 4022887073, 222747576,  3530033106,
+            2390265005, 3329439590, 2342595153, 2201731527, 3213574361, 431465475,  3818955897,
+            3572836144, 1470891556, 4155846238, 3628271862, 1589894077, 2643953247, 1026792315,
+            1929294225, 1401139219, 2323625149, 1610833486, 4230306002, 1501408677, 3496396652,
+            527949574,  2331200893, 1721435313, 2521118263, 676862064,  59464019,   360307471,
+            1582588256, 222477395,  1444950788, 1064036569, 4216580647, 1384425350, 3869494481,
+            555229330,  4023413351, 1127573061, 3493463185, 3876306195, 2860356730, 1143136505,
+            442566086,  1726962227, 2397988531, 1213427931, 42305969,   788682799,  159849423,
+            3657151087, 456244718,  355713738,  4178817981, 3497236648, 2435297582, 3667084181,
+            2481017753, 1128869951, 2533904725, 1518128085, 484222373,  2139219657, 810044155,
+            214836099,  2309286934, 88046303,   2736516219, 2618226138, 2786684719, 35195594,
+            2625052008, 3648569463, 3794895185, 1473751867, 454613577,  2510407300, 2638793925,
+            808519799,  1179491924, 3409684315, 1643933305, 88018112,   2447937793, 1841416936,
+            2163985161, 3052952080, 2015696992, 1027941716, 1760867671, 3125362890, 604760413,
+            343992130,  3652321022, 3167510779, 540594135,  4281124970, 2761322237, 2117811372,
+            2445471414, 3563809720, 2003282466, 40269991,   1017678587, 1369729927, 3806695743,
+            1394128171, 6932138,    1529861990, 177034610,  394336247,  1073648303, 47944018,
+            4173993494, 3205538296, 4017471575, 1192015938, 2230679571, 2304156939, 2885660323,
+            1077290551, 2432927303, 3164215855, 1766277959, 150621412,  2930037156, 681224435,
+            3549593497, 2650290349, 3729704407, 743170414,  3607594567, 2474518804, 558798232,
+            3748458958, 3416330179, 1844719490, 4198260493, 821609825,  187111971,  2732912354,
+            1011207349, 1576143656, 32304544,   940564440,  3676963721, 1692557397, 4160921025,
+            43347167,   2463207443, 2484383239, 1343873691, 3598575734, 2359890488, 1129104740,
+            780617697,  4015029806, 3222385923, 883646985,  106620942,  4040295337, 1727647947,
+            2682233440, 922177055,  1550227240, 1774965492, 3918525727, 1281106158, 232198564,
+            3448085874, 3357970518, 1420067457, 1330884163, 4069175093, 170812427,  3541674579,
+            628250582,  3129707299, 1373527670, 4224593951, 1145296048, 2002714118, 1868290841,
+            3967892918, 3063317531, 1070556978, 3160699378, 2720765235, 3557124694, 1376717568,
+            1798782089, 3283362868, 3810187979, 3054533501, 3825489187, 2224376852, 3430575334,
+            1630167528, 1678294581, 1135131773, 1784710931, 3361989235, 2628598185, 229003829,
+            4022527896, 367927543,  907541681,  1973790262, 4168749384, 1735153385, 2780931310,
+            1989070331, 1784760687, 1371604919, 840285873,  2924276771, 2353540508, 3941774778,
+            1689339304, 4193402879, 1158207603, 4273164192, 3576269669, 902009648,  2630065500,
+            2904013557, 199305820,  2405056207, 3572870701, 3408587208, 179624826,  132004218,
+            781421586,  1725566264, 1277872698, 3005444241, 3156859827, 497197963,  1273764248,
+            737326809,  3787938822, 927359328,  2674654876, 618834427,  1025115178, 793935039,
+            2172939852, 4172577945, 524392727,  1736924573, 259254474,  3040520192, 2435924317,
+            2243012127, 2833125776, 336753003,  875216572,  3406198486, 1871714347, 2356704395,
+            498768445,  3385979269, 3199622055, 3167757056, 2139730557, 774756858,  3435677893,
+            2681273838, 2679716676,
+        },
+        {
+            3141008275, 1637819614, 2960999271, 2492887039, 1034259409, 1181393996, 4236749019,
+            307108979,  1027125580, 1907523349, 374704501,  2507132033, 206634189,  3515683294,
+            3393543109, 3617382251, 2520244249, 3918268232, 4276933641, 2662999315, 124573318,
+            2711675946, 2269172604, 46049729,   1860910402, 4117174948, 49636623,   3642611457,
+            744968529,  1543541134, 1644601252, 1162032521, 1719416431, 1510669145, 2894104809,
+            3579142139, 3769640687, 945682689,  2424974225, 1306610743, 3716006559, 3790483861,
+            1219496966, 2209865887, 3601427317, 3222542283, 2771257013, 3333879575, 1868108343,
+            3755733018, 3855455024, 3229513062, 3177824322, 3511035208, 47827514,   3845963745,
+            2517345656, 1517566251, 3855219213, 1633534747, 3129747158, 2974102101, 1156220599,
+            753500236,  4274746387, 225599190,  2120173545, 1778389281, 1870700409, 3229429364,
+            2989628232, 1118315174, 3106413724, 3315350220, 1439121953, 488571070,  40508765,
+            1119921090, 3040236203, 186752087,  814941352,  2725974635, 1904127167, 4003136584,
+            3888735300, 808347083,  4157221814, 542449828,  2543974004, 4115750988, 930415842,
+            2250425131, 224427671,  3196942956, 3882149704, 121440709,  839787289,  4251800318,
+            3584907798, 238863691,  1812797885, 2580107136, 1459855765, 1439713584, 2531160147,
+            4203273165, 2387565358, 505025260,  3536023042, 1001350196, 551543080,  2129881760,
+            3437446923, 184481682,  155440810,  3755514335, 2332061405, 3702748479, 1722440645,
+            2226256189, 360499996,  3613355962, 2555840592, 574962406,  1379412497, 4251984497,
+            4193622819, 2033890134, 22907043,   1206804127, 2670007186, 3720384227, 3712388076,
+            564995012,  2223504257, 3932762246, 349235771,  2542394331, 1584882548, 1671379726,
+            2026033582, 3978893015, 3222078134, 1758000572, 82655975,   4090840374, 1144866285,
+            3612673478, 1407704193, 2422273511, 4116221380, 398912399,  3396764967, 1120782090,
+            470518771,  3873723827, 3263642305, 1531426917, 1722204367, 3088639426, 2151418786,
+            3141008275, 1637819614, 2960999271, 2492887039, 1856649324, 1181393996, 4236749019,
+            307108979,  1027125580, 3449012769, 374704501,  2507132033, 206634189,  3515683294,
+            1657225389, 3617382251, 2520244249, 3918268232, 4276933641, 824336491,  124573318,
+            2711675946, 2269172604, 46049729,   1905563387, 4117174948, 49636623,   3642611457,
+            744968529,  1028613333, 1644601252, 1162032521, 1719416431, 1510669145, 1513473213,
+            3579142139, 3769640687, 945682689,  2424974225, 776776504,  3716006559, 3790483861,
+            1219496966, 2209865887, 817955062,  3222542283, 2771257013, 3333879575, 1868108343,
+            2612662823, 3855455024, 3229513062, 3177824322, 3511035208, 2469686359, 3845963745,
+            2517345656, 1517566251, 3855219213, 166532411,  3129747158, 2974102101, 1156220599,
+            753500236,  1037736796, 225599190,  2120173545, 1778389281, 1870700409, 2673845577,
+            2989628232, 1118315174, 3106413724, 3315350220, 2243832239, 488571070,  40508765,
+            1119921090, 3040236203, 1283556176, 814941352,  2725974635, 1904127167, 4003136584,
+            182593162,  808347083,  4157221814, 542449828,  2543974004, 1945007183, 930415842,
+            2250425131, 224427671,  3196942956, 1721416483, 121440709,  839787289,  4251800318,
+            3584907798, 2729258366, 1812797885, 2580107136, 1459855765, 1439713584, 1452466583,
+            4203273165, 2387565358, 505025260,  3536023042, 2056582495, 551543080,  2129881760,
+            3437446923, 184481682,  2897951562, 3755514335, 2332061405, 3702748479, 1722440645,
+            1020390926, 360499996,  3613355962, 2555840592, 574962406,  4065051984, 4251984497,
+            4193622819, 2033890134, 22907043,   2004163241, 2670007186, 3720384227, 3712388076,
+            564995012,  1577594552, 3932762246, 349235771,  2542394331, 1584882548, 2155375092,
+            2026033582, 3978893015, 3222078134, 1758000572, 1172187714, 4090840374, 1144866285,
+            3612673478, 1407704193, 3946319929, 4116221380, 398912399,  3396764967, 1120782090,
+            1884823414, 3873723827, 3263642305, 1531426917, 1722204367, 417174240,  2151418786,
+            3141008275, 1637819614, 2960999271, 123458222,  1856649324, 1181393996, 4236749019,
+            307108979,  183677867,  3449012769, 374704501,  2507132033, 206634189,  2933205145,
+            1657225389, 3617382251, 2520244249, 3918268232, 2353095644, 824336491,  124573318,
+            2711675946, 2269172604, 3844640341, 1905563387, 4117174948, 49636623,   3642611457,
+            4101026903, 1028613333, 1644601252, 1162032521, 1719416431, 470176938,  1513473213,
+            3579142139, 3769640687, 945682689,  4294804755, 776776504,  3716006559, 3790483861,
+            1219496966, 2556825536, 817955062,  3222542283, 2771257013, 3333879575, 3094489720,
+            2612662823, 3855455024, 3229513062, 3177824322, 183392573,  2469686359, 3845963745,
+            2517345656, 1517566251, 3615956065, 166532411,  3129747158, 2974102101, 1156220599,
+            2087109984, 1037736796, 225599190,  2120173545, 1778389281, 2228891328, 2673845577,
+            2989628232, 1118315174, 3106413724, 1592766214, 2243832239, 488571070,  40508765,
+            1119921090, 2898847537, 1283556176, 814941352,  2725974635, 1904127167, 3189469077,
+            182593162,  808347083,  4157221814, 542449828,  3855803294, 1945007183, 930415842,
+            2250425131, 224427671,  2282694858, 1721416483, 121440709,  839787289,  4251800318,
+            666229014,  2729258366, 1812797885, 2580107136, 1459855765, 3505189559, 1452466583,
+            4203273165, 2387565358, 505025260,  3400912083, 2056582495, 551543080,  2129881760,
+            3437446923, 649583623,  2897951562, 3755514335, 2332061405, 3702748479, 293476162,
+            1020390926, 360499996,  3613355962, 2555840592, 2271426454, 4065051984, 4251984497,
+            4193622819, 2033890134, 530105056,  2004163241, 2670007186, 3720384227, 3712388076,
+            3206074171, 1577594552, 3932762246, 349235771,  2542394331, 3042589319, 2155375092,
+            2026033582, 3978893015, 3222078134, 1082260507, 1172187714, 4090840374, 1144866285,
+            3612673478, 499210659,  3946319929, 4116221380, 398912399,  3396764967, 1621220626,
+            1884823414, 3873723827, 3263642305, 1531426917, 2683514220, 417174240,  2151418786,
+            3141008275, 1637819614, 457262752,  123458222,  1856649324, 1181393996, 4236749019,
+            2647515077, 183677867,  3449012769, 374704501,  2507132033, 3305353676, 2933205145,
+            1657225389, 3617382251, 2520244249, 3699697943, 2353095644, 824336491,  124573318,
+            2711675946, 1128563165, 3844640341, 1905563387, 4117174948, 49636623,   604335549,
+            4101026903, 1028613333, 1644601252, 1162032521, 1485075447, 470176938,  1513473213,
+            3579142139, 3769640687, 1898177793, 4294804755, 776776504,  3716006559, 3790483861,
+            364508301,  2556825536, 817955062,  3222542283, 2771257013, 567923760,  3094489720,
+            2612662823, 3855455024, 3229513062, 2063356478, 183392573,  2469686359, 3845963745,
+            2517345656, 2156524429, 3615956065, 166532411,  3129747158, 2974102101, 2356728586,
+            2087109984, 1037736796, 225599190,  2120173545, 2509770695, 2228891328, 2673845577,
+            2989628232, 1118315174, 3838562897, 1592766214, 2243832239, 488571070,  40508765,
+            2408551194, 2898847537, 1283556176, 814941352,  2725974635, 3020996568, 3189469077,
+            182593162,  808347083,  4157221814, 2256842415, 3855803294, 1945007183, 930415842,
+            2250425131, 1219122545, 2282694858, 1721416483, 121440709,  839787289,  1046305596,
+            666229014,  2729258366, 1812797885, 2580107136, 3924173133, 3505189559, 1452466583,
+            4203273165, 2387565358, 4138860001, 3400912083, 2056582495, 551543080,  2129881760,
+            1322919128, 649583623,  2897951562, 3755514335, 2332061405, 317589933,  293476162,
+            1020390926, 360499996,  3613355962, 145007017,  2271426454, 4065051984, 4251984497,
+            4193622819, 2422399300, 530105056,  2004163241, 2670007186, 3720384227, 2640881600,
+            3206074171, 1577594552, 3932762246, 349235771,  1148251148, 3042589319, 2155375092,
+            2026033582, 3978893015, 2502114164, 1082260507, 1172187714, 4090840374, 1144866285,
+            3013800352, 499210659,  3946319929, 4116221380, 398912399,  3208726640, 1621220626,
+            1884823414, 3873723827, 3263642305, 3985801666, 2628452852, 4244728165, 2942160501,
+            4022895941, 2349704476, 752239251,  1771505306, 2465744292, 3057368093, 1888095687,
+            1050173152, 1420802006, 3813292721, 616441273,  2222646680, 2192957770, 297060855,
+            346745509,  656197132,  4006260058, 2037906033, 3529551026, 4221743267, 3859616344,
+            3147473199, 1109038759, 2512747346, 1655266805, 1848589798, 3554643170, 1623546525,
+            2054573894, 3517027965, 1802765515, 3284972830, 1037303844, 1742300159, 3828020162,
+            139945435,  1262075452, 659961119,  417365114,  449016957,  3204041662, 3133453909,
+            855073696,  2264445020, 4192303799, 1602396355, 2535439298, 4005798284, 2526592494,
+            3637710098, 3682322775, 2795292365, 1175140209, 3653653632, 958974434,  1887884212,
+            491548194,  3226193014, 745513791,  2034728284, 3832215712, 2643075448, 745135164,
+            1339607581, 1719127487, 3785008837, 1476775550, 3223926298, 3589382875, 3865401205,
+            2695503680, 2590745474, 2502113996, 1943728437, 2895291831, 254445498,  1569608153,
+            1000567592, 1556466520, 664904490,  3653969579, 1033580110, 534238017,  343252222,
+            2325689772, 2831995091, 229963683,  2432875009, 2899005671, 4110242685, 2583957637,
+            3951250207, 3088475391, 1526103341, 3198624435, 902937435,  3919753707, 3417202497,
+            937814818,  3472458025, 3791599146, 2522628823, 3048808490, 2483589080, 310214836,
+            738265313,  439542541,  3625650552, 735606741,  1502365466, 889820582,  457144977,
+            1794060568, 2194400445, 2353762349, 481377473,  475116950,  3690884469, 1538344821,
+            1124839102, 4066642835, 3389211568, 4049427781, 3504860923, 3304346520, 2583831448,
+            882382740,  964080254,  146851216,  1280979860, 195615890,  1057648465, 3465742754,
+            2721796058, 1327641907, 1711427218, 3577860430, 2435923266, 610994117,  2752736817,
+            3704733599, 872071004,  2799273000, 3864557619, 2743489137, 1347622727, 2643215534,
+            774812942,  871361709,  3638033556, 764375376,  1827782963, 3551562051, 3004257361,
+            3276360487, 632102548,
+        },
+        {
+            3784850162, 703430317,  3398921736, 3626973488, 3817611413, 4103430533, 1901758844,
+            3509866787, 3681877847, 3456706576, 66754415,   3354486154, 3808242468, 3310343706,
+            1392057742, 2688041284, 987236814,  2442020435, 623721099,  4247465924, 4020293973,
+            1584976303, 2284509614, 3789262717, 4139267054, 177173634,  1873849630, 1188277526,
+            3244480560, 2114927122, 718821660,  2149885032, 626127942,  2845151149, 2622620256,
+            3585274544, 4109613761, 1159222420, 1492056926, 4062144900, 4269371222, 2705367084,
+            363939591,  1548968171, 1370972700, 2740572118, 468866981,  1847384910, 375500425,
+            2538202697, 3989328053, 491548150,  3850368974, 3886741808, 3218602390, 3956144218,
+            2942472672, 4266862699, 743878935,  185137692,  2797735722, 1818264415, 1101664427,
+            1884797000, 4212488041, 2467694136, 3430427016, 323390396,  2651307508, 2371134064,
+            3167633084, 3027229331, 2219257735, 280199947,  3717487783, 16341524,   696136945,
+            1192232020, 1581424603, 3226616583, 263326298,  228675210,  3172833871, 4255841790,
+            319898189,  472562213,  192946266,  1682058409, 3872977379, 1877565486, 3663184811,
+            3754708722, 2330822035, 2561230277, 3835720959, 3237816247, 734123279,  3210695735,
+            3209598098, 620645641,  1403118611, 1755942795, 142215598,  233547451,  2321049939,
+            2737904318, 647460756,  3852676920, 3013577080, 448796372,  692414843,  1160073871,
+            440378083,  2238844798, 1987268176, 1297254511, 3803305411, 3372501600, 2168265492,
+            193189972,  2049245030, 895746458,  2657035330, 1957533377, 2254842040, 4249501341,
+            654023194,  1732650614, 2828883103, 690895122,  2062571084, 1777903150, 2123875405,
+            2961085033, 2525999062, 1009523505, 333972733,  113624627,  2244660001, 3879075600,
+            2842312898, 986604115,  3576305346, 2435252158, 686680750,  3242566510, 3047767433,
+            925405124,  2278830086, 1678138806, 2913815156, 4258431311, 3992481182, 1562360455,
+            94156167,   386128019,  1149497713, 1724833043, 351904613,  885711909,  1973815171,
+            3784850162, 703430317,  3398921736, 3626973488, 2998828657, 4103430533, 1901758844,
+            3509866787, 3681877847, 2566436058, 66754415,   3354486154, 3808242468, 3310343706,
+            1640204561, 2688041284, 987236814,  2442020435, 623721099,  3412962731, 4020293973,
+            1584976303, 2284509614, 3789262717, 2036747288, 177173634,  1873849630, 1188277526,
+            3244480560, 2059674633, 718821660,  2149885032, 626127942,  2845151149, 446869831,
+            3585274544, 4109613761, 1159222420, 1492056926, 2678586011, 4269371222, 2705367084,
+            363939591,  1548968171, 2188563818, 2740572118, 468866981,  1847384910, 375500425,
+            408447874,  3989328053, 491548150,  3850368974, 3886741808, 1296287710, 3956144218,
+            2942472672, 4266862699, 743878935,  2926947814, 2797735722, 1818264415, 1101664427,
+            1884797000, 2374382437, 2467694136, 3430427016, 323390396,  2651307508, 2604382010,
+            3167633084, 3027229331, 2219257735, 280199947,  3980833744, 16341524,   696136945,
+            1192232020, 1581424603, 3668279233, 263326298,  228675210,  3172833871, 4255841790,
+            1334338083, 472562213,  192946266,  1682058409, 3872977379, 1120253575, 3663184811,
+            3754708722, 2330822035, 2561230277, 781423905,  3237816247, 734123279,  3210695735,
+            3209598098, 961774346,  1403118611, 1755942795, 142215598,  233547451,  2786851205,
+            2737904318, 647460756,  3852676920, 3013577080, 2954437789, 692414843,  1160073871,
+            440378083,  2238844798, 1814990165, 1297254511, 3803305411, 3372501600, 2168265492,
+            1968724012, 2049245030, 895746458,  2657035330, 1957533377, 3397562403, 4249501341,
+            654023194,  1732650614, 2828883103, 3583195345, 2062571084, 1777903150, 2123875405,
+            2961085033, 296179686,  1009523505, 333972733,  113624627,  2244660001, 2024818752,
+            2842312898, 986604115,  3576305346, 2435252158, 1846292330, 3242566510, 3047767433,
+            925405124,  2278830086, 2887810495, 2913815156, 4258431311, 3992481182, 1562360455,
+            3793687957, 386128019,  1149497713, 1724833043, 351904613,  3097306229, 1973815171,
+            3784850162, 703430317,  3398921736, 174452687,  2998828657, 4103430533, 1901758844,
+            3509866787, 105708509,  2566436058, 66754415,   3354486154, 3808242468, 3059169567,
+            1640204561, 2688041284, 987236814,  2442020435, 1271203137, 3412962731, 4020293973,
+            1584976303, 2284509614, 2275333719, 2036747288, 177173634,  1873849630, 1188277526,
+            2476819553, 2059674633, 718821660,  2149885032, 626127942,  910236498,  446869831,
+            3585274544, 4109613761, 1159222420, 3252358853, 2678586011, 4269371222, 2705367084,
+            363939591,  1819502257, 2188563818, 2740572118, 468866981,  1847384910, 4040330589,
+            408447874,  3989328053, 491548150,  3850368974, 3689464912, 1296287710, 3956144218,
+            2942472672, 4266862699, 3529290388, 2926947814, 2797735722, 1818264415, 1101664427,
+            1971767605, 2374382437, 2467694136, 3430427016, 323390396,  2503058704, 2604382010,
+            3167633084, 3027229331, 2219257735, 754120622,  3980833744, 16341524,   696136945,
+            1192232020, 1783125043, 3668279233, 263326298,  228675210,  3172833871, 2605082770,
+            1334338083, 472562213,  192946266,  1682058409, 3133487485, 1120253575, 3663184811,
+            3754708722, 2330822035, 1135634281, 781423905,  3237816247, 734123279,  3210695735,
+            2871442499, 961774346,  1403118611, 1755942795, 142215598,  3382536448, 2786851205,
+            2737904318, 647460756,  3852676920, 275853852,  2954437789, 692414843,  1160073871,
+            440378083,  2467335823, 1814990165, 1297254511, 3803305411, 3372501600, 67125972,
+            1968724012, 2049245030, 895746458,  2657035330, 3099154950, 3397562403, 4249501341,
+            654023194,  1732650614, 3613027184, 3583195345, 2062571084, 1777903150, 2123875405,
+            1223837720, 296179686,  1009523505, 333972733,  113624627,  3268454767, 2024818752,
+            2842312898, 986604115,  3576305346, 1424599960, 1846292330, 3242566510, 3047767433,
+            925405124,  780191814,  2887810495, 2913815156, 4258431311, 3992481182, 140385704,
+            3793687957, 386128019,  1149497713, 1724833043, 595975747,  3097306229, 1973815171,
+            3784850162, 703430317,  1889207406, 174452687,  2998828657, 4103430533, 1901758844,
+            4106744221, 105708509,  2566436058, 66754415,   3354486154, 49398134,   3059169567,
+            1640204561, 2688041284, 987236814,  3641229785, 1271203137, 3412962731, 4020293973,
+            1584976303, 1479301407, 2275333719, 2036747288, 177173634,  1873849630, 2974027293,
+            2476819553, 2059674633, 718821660,  2149885032, 2287577859, 910236498,  446869831,
+            3585274544, 4109613761, 2142798772, 3252358853, 2678586011, 4269371222, 2705367084,
+            2654225118, 1819502257, 2188563818, 2740572118, 468866981,  3494104842, 4040330589,
+            408447874,  3989328053, 491548150,  2106805963, 3689464912, 1296287710, 3956144218,
+            2942472672, 1269517925, 3529290388, 2926947814, 2797735722, 1818264415, 3322942170,
+            1971767605, 2374382437, 2467694136, 3430427016, 613847066,  2503058704, 2604382010,
+            3167633084, 3027229331, 1187608387, 754120622,  3980833744, 16341524,   696136945,
+            3789557801, 1783125043, 3668279233, 263326298,  228675210,  1537911870, 2605082770,
+            1334338083, 472562213,  192946266,  3050745907, 3133487485, 1120253575, 3663184811,
+            3754708722, 530093514,  1135634281, 781423905,  3237816247, 734123279,  2278284604,
+            2871442499, 961774346,  1403118611, 1755942795, 2016575354, 3382536448, 2786851205,
+            2737904318, 647460756,  95352122,   275853852,  2954437789, 692414843,  1160073871,
+            3434414398, 2467335823, 1814990165, 1297254511, 3803305411, 2306084896, 67125972,
+            1968724012, 2049245030, 895746458,  3516572591, 3099154950, 3397562403, 4249501341,
+            654023194,  1615803220, 3613027184, 3583195345, 2062571084, 1777903150, 3525075959,
+            1223837720, 296179686,  1009523505, 333972733,  845660339,  3268454767, 2024818752,
+            2842312898, 986604115,  1609729955, 1424599960, 1846292330, 3242566510, 3047767433,
+            2617368550, 780191814,  2887810495, 2913815156, 4258431311, 3787355175, 140385704,
+            3793687957, 386128019,  1149497713, 907652805,  3735859719, 3421391106, 2512710418,
+            1313474744, 536137832,  339467279,  331444274,  1984482183, 4278615471, 1856919828,
+            3306130732, 3367341925, 3091325847, 2337119891, 2159166003, 3982870528, 3587530831,
+            154459788,  1113946422, 3408970369, 2917130096, 730637715,  974575960,  2179840689,
+            2069104649, 228541426,  3610756548, 2111559597, 2837937946, 1600529829, 200735124,
+            3893155880, 821488235,  3961969993, 1864780613, 2397540688, 3173136338, 3949586174,
+            4247580015, 3219643432, 3449192354, 3673674080, 1415295676, 1252420828, 786895588,
+            1563840609, 3549060721, 3732134965, 1396982435, 3855929900, 1885038045, 2721977930,
+            4127747646, 2609481132, 1771598102, 92585424,   1290362987, 3287808289, 3138193037,
+            231284798,  3602554887, 285972807,  3766792502, 3137605770, 3991208027, 3805243553,
+            2408273710, 778981696,  1079314290, 1171028219, 582483658,  1282282486, 2152315687,
+            3224771807, 294617613,  2458196459, 3260898964, 2469857270, 2343587525, 2430127708,
+            367889364,  1610253719, 4249005718, 3488363436, 3376052768, 415430330,  744699147,
+            4247605258, 2995560063, 1139611179, 4226304044, 1461460971, 4239497540, 1255128108,
+            3317951653, 2083172561, 3157060274, 410915623,  2890825523, 1691702689, 543119984,
+            2015188160, 1025283936, 777089559,  2320638116, 2951195427, 2663778082, 1401648208,
+            785705554,  231992884,  372338362,  3915919400, 1814685379, 2249029841, 2792475070,
+            2209758474, 2327932084, 1959611299, 4076019371, 3275870957, 4083462899, 2085765290,
+            1089208676, 194949024,  1569191165, 4173120769, 1800833783, 3731784892, 848440099,
+            508327348,  4012403854, 895021686,  3277977449, 907796820,  3916625290, 2590498609,
+            2451745346, 3412909415, 1572270848, 3109122110, 2335617165, 1239816674, 827740578,
+            2554073440, 1956745811, 726865392,  2142944872, 297177346,  3505599084, 2435525230,
+            220919176,  598359502,  2408202353, 572983813,  2701740364, 1085750635, 1223237827,
+            2868262230, 3187011013,
+        },
+        {
+            2181892665, 1645076808, 1559298141, 3029933696, 2442416154, 1285006067, 2742329535,
+            2558542255, 942257813,  310186993,  2658207203, 2576239814, 1614528457, 1530189423,
+            2335622049, 2023345285, 2370583134, 1776932310, 3847825180, 4023028276, 2128871074,
+            3360026328, 3505948114, 2633525143, 720364296,  1090158915, 985128458,  1560734124,
+            1776848661, 3898007316, 3940738779, 3417011415, 3985896786, 1520549051, 1361679889,
+            1949400750, 2111694273, 3208202123, 2399573534, 2213869211, 3305629017, 3568819051,
+            3814299578, 2388501376, 3588392217, 656820755,  582207231,  2794962690, 564711675,
+            3628320714, 1806689587, 2123969531, 2088372995, 3579382220, 3267192627, 1230076303,
+            442717482,  1011602235, 2236812894, 2670130896, 2622971396, 3301751674, 2853521473,
+            2541000488, 1041253054, 2442177301, 2676887690, 2357202624, 3023787260, 179511758,
+            3797795235, 3140802107, 430681372,  3838040915, 2026202183, 876645470,  1751534143,
+            2470661687, 3285042982, 2263846303, 353159150,  3692664305, 528372551,  2028224213,
+            66771138,   3618244303, 713237828,  3506277458, 3368031440, 3554988973, 289632621,
+            310221008,  524316590,  822736850,  953364161,  388546546,  2665183011, 2064368721,
+            4137792550, 2005403949, 3906896553, 3548302631, 42922714,   3854734374, 465967811,
+            1036091841, 886758571,  200067316,  451500008,  4280913734, 1119772087, 718785745,
+            79105032,   1668558324, 1993020660, 424442429,  2374502204, 1346049758, 3594051956,
+            1991796795, 2501379665, 1822833056, 1335144226, 959686670,  405669826,  1472658881,
+            935315852,  4214410818, 820314107,  633550750,  3177894168, 592197343,  873553428,
+            3748973541, 342766796,  2234461294, 3567845706, 706346882,  1719666041, 3112996476,
+            2003376080, 2953175244, 2169939463, 339654180,  3408832629, 3919527776, 539129767,
+            1488926043, 679239883,  4237487750, 3665650646, 2281709296, 2558328245, 534340928,
+            170452420,  3542309443, 1042869343, 1002978257, 382121551,  1821366584, 797998392,
+            2181892665, 1645076808, 1559298141, 3029933696, 2043190490, 1285006067, 2742329535,
+            2558542255, 942257813,  3875809058, 2658207203, 2576239814, 1614528457, 1530189423,
+            1006596021, 2023345285, 2370583134, 1776932310, 3847825180, 547811195,  2128871074,
+            3360026328, 3505948114, 2633525143, 3289874675, 1090158915, 985128458,  1560734124,
+            1776848661, 2136506567, 3940738779, 3417011415, 3985896786, 1520549051, 1161350185,
+            1949400750, 2111694273, 3208202123, 2399573534, 2010555078, 3305629017, 3568819051,
+            3814299578, 2388501376, 2172477337, 656820755,  582207231,  2794962690, 564711675,
+            4265833147, 1806689587, 2123969531, 2088372995, 3579382220, 4224662088, 1230076303,
+            442717482,  1011602235, 2236812894, 1565075650, 2622971396, 3301751674, 2853521473,
+            2541000488, 2303036274, 2442177301, 2676887690, 2357202624, 3023787260, 1502345242,
+            3797795235, 3140802107, 430681372,  3838040915, 545788780,  876645470,  1751534143,
+            2470661687, 3285042982, 1137024667, 353159150,  3692664305, 528372551,  2028224213,
+            2753169372, 3618244303, 713237828,  3506277458, 3368031440, 3331988158, 289632621,
+            310221008,  524316590,  822736850,  1273722654, 388546546,  2665183011, 2064368721,
+            4137792550, 2121938435, 3906896553, 3548302631, 42922714,   3854734374, 876379464,
+            1036091841, 886758571,  200067316,  451500008,  3565755136, 1119772087, 718785745,
+            79105032,   1668558324, 1409589934, 424442429,  2374502204, 1346049758, 3594051956,
+            1924221136, 2501379665, 1822833056, 1335144226, 959686670,  3340757142, 1472658881,
+            935315852,  4214410818, 820314107,  3706825286, 3177894168, 592197343,  873553428,
+            3748973541, 3181154409, 2234461294, 3567845706, 706346882,  1719666041, 1874391027,
+            2003376080, 2953175244, 2169939463, 339654180,  4068081187, 3919527776, 539129767,
+            1488926043, 679239883,  2253320293, 3665650646, 2281709296, 2558328245, 534340928,
+            243163441,  3542309443, 1042869343, 1002978257, 382121551,  3608361161, 797998392,
+            2181892665, 1645076808, 1559298141, 3544783954, 2043190490, 1285006067, 2742329535,
+            2558542255, 3750729405, 3875809058, 2658207203, 2576239814, 1614528457, 222899922,
+            1006596021, 2023345285, 2370583134, 1776932310, 839258492,  547811195,  2128871074,
+            3360026328, 3505948114, 1335483628, 3289874675, 1090158915, 985128458,  1560734124,
+            3803134713, 2136506567, 3940738779, 3417011415, 3985896786, 1417196931, 1161350185,
+            1949400750, 2111694273, 3208202123, 4114239800, 2010555078, 3305629017, 3568819051,
+            3814299578, 2231149113, 2172477337, 656820755,  582207231,  2794962690, 771827643,
+            4265833147, 1806689587, 2123969531, 2088372995, 4014963561, 4224662088, 1230076303,
+            442717482,  1011602235, 1877568953, 1565075650, 2622971396, 3301751674, 2853521473,
+            2360917317, 2303036274, 2442177301, 2676887690, 2357202624, 3831004667, 1502345242,
+            3797795235, 3140802107, 430681372,  3844191462, 545788780,  876645470,  1751534143,
+            2470661687, 2789488920, 1137024667, 353159150,  3692664305, 528372551,  3257495373,
+            2753169372, 3618244303, 713237828,  3506277458, 2459808453, 3331988158, 289632621,
+            310221008,  524316590,  3691933924, 1273722654, 388546546,  2665183011, 2064368721,
+            1361824709, 2121938435, 3906896553, 3548302631, 42922714,   3076571194, 876379464,
+            1036091841, 886758571,  200067316,  3497142853, 3565755136, 1119772087, 718785745,
+            79105032,   1709923922, 1409589934, 424442429,  2374502204, 1346049758, 2934160389,
+            1924221136, 2501379665, 1822833056, 1335144226, 3968559417, 3340757142, 1472658881,
+            935315852,  4214410818, 3035271052, 3706825286, 3177894168, 592197343,  873553428,
+            2241540852, 3181154409, 2234461294, 3567845706, 706346882,  2863338859, 1874391027,
+            2003376080, 2953175244, 2169939463, 1193698943, 4068081187, 3919527776, 539129767,
+            1488926043, 3437341571, 2253320293, 3665650646, 2281709296, 2558328245, 2798207074,
+            243163441,  3542309443, 1042869343, 1002978257, 135807894,  3608361161, 797998392,
+            2181892665, 1645076808, 86172117,   3544783954, 2043190490, 1285006067, 2742329535,
+            710493230,  3750729405, 3875809058, 2658207203, 2576239814, 360538549,  222899922,
+            1006596021, 2023345285, 2370583134, 2742996487, 839258492,  547811195,  2128871074,
+            3360026328, 1347443709, 1335483628, 3289874675, 1090158915, 985128458,  2739995926,
+            3803134713, 2136506567, 3940738779, 3417011415, 148775570,  1417196931, 1161350185,
+            1949400750, 2111694273, 593005337,  4114239800, 2010555078, 3305629017, 3568819051,
+            2079677238, 2231149113, 2172477337, 656820755,  582207231,  1272552394, 771827643,
+            4265833147, 1806689587, 2123969531, 2862851366, 4014963561, 4224662088, 1230076303,
+            442717482,  3569461748, 1877568953, 1565075650, 2622971396, 3301751674, 2273046994,
+            2360917317, 2303036274, 2442177301, 2676887690, 3230975502, 3831004667, 1502345242,
+            3797795235, 3140802107, 600604127,  3844191462, 545788780,  876645470,  1751534143,
+            31275304,   2789488920, 1137024667, 353159150,  3692664305, 4070345064, 3257495373,
+            2753169372, 3618244303, 713237828,  506050594,  2459808453, 3331988158, 289632621,
+            310221008,  3397530573, 3691933924, 1273722654, 388546546,  2665183011, 1315944137,
+            1361824709, 2121938435, 3906896553, 3548302631, 663894907,  3076571194, 876379464,
+            1036091841, 886758571,  2885051308, 3497142853, 3565755136, 1119772087, 718785745,
+            3475445784, 1709923922, 1409589934, 424442429,  2374502204, 1247367271, 2934160389,
+            1924221136, 2501379665, 1822833056, 3183435165, 3968559417, 3340757142, 1472658881,
+            935315852,  3564004747, 3035271052, 3706825286, 3177894168, 592197343,  3168083530,
+            2241540852, 3181154409, 2234461294, 3567845706, 362558667,  2863338859, 1874391027,
+            2003376080, 2953175244, 569198085,  1193698943, 4068081187, 3919527776, 539129767,
+            2789580028, 3437341571, 2253320293, 3665650646, 2281709296, 2185760119, 2798207074,
+            243163441,  3542309443, 1042869343, 2133392511, 484062478,  3737211606, 2449312843,
+            3874571180, 488971575,  1076573523, 1784171606, 6937681,    2310196175, 3193027976,
+            3635115260, 1383201475, 303353760,  1556625919, 1171394566, 3831614312, 3185324588,
+            146168859,  3253110144, 1810533095, 352870161,  1621926821, 4110534110, 2889784872,
+            1479330225, 4181353815, 335088861,  3310138733, 384627393,  1285786970, 1431640194,
+            2808156737, 3501061052, 3879969800, 3033447131, 1425332118, 2392129922, 2982745374,
+            1859116631, 3717995505, 1201860040, 3037432064, 668771668,  2560390330, 4047959835,
+            2774185318, 312621379,  2472199919, 2249260669, 3131543758, 278605882,  143941946,
+            3708596591, 1594656323, 3907276767, 2384028567, 2053429429, 2872554983, 992427014,
+            3110501664, 127088112,  3842084498, 2051486903, 1652406236, 803805515,  855911964,
+            8757301,    845968001,  344325704,  3789896510, 906917563,  735814382,  3920613919,
+            843303628,  3428747630, 456310859,  714888986,  3644977262, 3749146930, 1781850404,
+            2373703387, 3255800551, 2221792623, 1515708418, 2610349701, 3208196972, 3148634566,
+            3078170588, 3152287009, 394234763,  4186810798, 2617215211, 967956848,  4121748712,
+            4104140026, 3566150583, 3545609240, 846597378,  2664047680, 3868331735, 3912269092,
+            94884115,   3409377923, 3903716966, 3593698433, 3334211047, 2832169414, 3677828146,
+            1398271544, 4040923655, 4042232704, 1691634469, 3713944821, 2136174059, 3937215616,
+            3688163147, 2865286660, 3147077296, 685865327,  1104004410, 3183241202, 2968198547,
+            3410331212, 955956449,  924664349,  3641949211, 1204039868, 3047250891, 627366856,
+            2881645099, 1145696992, 1828920528, 3769859241, 2329319403, 4267629523, 351762205,
+            1163459098, 2319029730, 1939154732, 3056136879, 2746533476, 153080591,  1722236156,
+            298724140,  1404150683, 1918690718, 897221601,  3338894786, 781992610,  1004928320,
+            2644533692, 1363266111, 3608099418, 225597836,  1451012740, 3560226803, 1929248657,
+            2089000608, 2946548963,
+        },
+        {
+            3872117793, 803220151,  70843412,   1661103032, 1976811457, 2186373604, 564259972,
+            1475436923, 2260980893, 4245534505, 1075107552, 3692990573, 370098873,  4045905424,
+            2420395420, 2332395402, 207483321,  622317750,  3004242500, 833623111,  3151161301,
+            1629139881, 352228793,  2439953368, 3183333619, 2703537080, 3218957129, 3164695888,
+            1741641842, 963394141,  4241612717, 1034476784, 2035880432, 3977821313, 1543311495,
+            3010014356, 1638490901, 2364265378, 3420329129, 333361555,  1133565821, 1450937015,
+            616059115,  3216393887, 3041978455, 3990855695, 1238628750, 512746184,  3256670217,
+            1616316512, 2791405051, 93474487,   2865892488, 1901471398, 2930857966, 2178431077,
+            2325598341, 3189256113, 1302432091, 808592927,  2945846737, 3487931071, 2018175258,
+            752981057,  1097082589, 1307115286, 175147508,  3611190164, 850238914,  3318706185,
+            199743319,  328621708,  3183670050, 3609998315, 4075306371, 3554549067, 2119566187,
+            1498503842, 1261870696, 2216745780, 950288337,  1117344941, 2150569143, 2899286760,
+            1594966374, 888858617,  35840654,   2829539211, 2511395669, 3607190544, 3278412778,
+            2249895907, 1320858068, 3576889788, 266766189,  1522426851, 1903494122, 1928370573,
+            2628132591, 3322025904, 220280169,  433606853,  1428961479, 986074592,  2128892987,
+            467697583,  1616913929, 325674890,  444442578,  649166208,  1689709565, 1493452467,
+            2222122038, 121114616,  2134348225, 3512035688, 1283058921, 4230441398, 3701238559,
+            337534132,  1418548715, 1190006478, 500654385,  1766924757, 1944680746, 940574010,
+            922744002,  186142284,  3131162902, 1693891092, 3031823448, 2143051534, 1429025284,
+            1487843160, 3606456133, 2079235652, 2447285474, 2669283767, 3232117829, 2490054343,
+            3225501736, 2911340385, 382319031,  1516937595, 622543191,  1388990570, 1749179860,
+            1924483707, 2593474505, 472539197,  122872799,  2586347240, 880588515,  4046335279,
+            1712182607, 4270737941, 1336703451, 3390078162, 382216945,  3733326081, 460422073,
+            3872117793, 803220151,  70843412,   1661103032, 250339760,  2186373604, 564259972,
+            1475436923, 2260980893, 657986735,  1075107552, 3692990573, 370098873,  4045905424,
+            3201950123, 2332395402, 207483321,  622317750,  3004242500, 3732213278, 3151161301,
+            1629139881, 352228793,  2439953368, 3572618926, 2703537080, 3218957129, 3164695888,
+            1741641842, 685933373,  4241612717, 1034476784, 2035880432, 3977821313, 3855995181,
+            3010014356, 1638490901, 2364265378, 3420329129, 2355603679, 1133565821, 1450937015,
+            616059115,  3216393887, 1733804102, 3990855695, 1238628750, 512746184,  3256670217,
+            2651059231, 2791405051, 93474487,   2865892488, 1901471398, 2113461797, 2178431077,
+            2325598341, 3189256113, 1302432091, 2986990416, 2945846737, 3487931071, 2018175258,
+            752981057,  2428033310, 1307115286, 175147508,  3611190164, 850238914,  1033628405,
+            199743319,  328621708,  3183670050, 3609998315, 4024297327, 3554549067, 2119566187,
+            1498503842, 1261870696, 290361143,  950288337,  1117344941, 2150569143, 2899286760,
+            168826051,  888858617,  35840654,   2829539211, 2511395669, 2890882060, 3278412778,
+            2249895907, 1320858068, 3576889788, 1794920145, 1522426851, 1903494122, 1928370573,
+            2628132591, 1251697758, 220280169,  433606853,  1428961479, 986074592,  2707115661,
+            467697583,  1616913929, 325674890,  444442578,  122781510,  1689709565, 1493452467,
+            2222122038, 121114616,  3425723636, 3512035688, 1283058921, 4230441398, 3701238559,
+            1646155473, 1418548715, 1190006478, 500654385,  1766924757, 3920475367, 940574010,
+            922744002,  186142284,  3131162902, 54639113,   3031823448, 2143051534, 1429025284,
+            1487843160, 4152687885, 2079235652, 2447285474, 2669283767, 3232117829, 1601035152,
+            3225501736, 2911340385, 382319031,  1516937595, 3508441679, 1388990570, 1749179860,
+            1924483707, 2593474505, 2835403456, 122872799,  2586347240, 880588515,  4046335279,
+            2958058367, 4270737941, 1336703451, 3390078162, 382216945,  450517882,  460422073,
+            3872117793, 803220151,  70843412,   2066343874, 250339760,  2186373604, 564259972,
+            1475436923, 1683787449, 657986735,  1075107552, 3692990573, 370098873,  2615082840,
+            3201950123, 2332395402, 207483321,  622317750,  2655424371, 3732213278, 3151161301,
+            1629139881, 352228793,  3236724760, 3572618926, 2703537080, 3218957129, 3164695888,
+            9775065,    685933373,  4241612717, 1034476784, 2035880432, 1621920075, 3855995181,
+            3010014356, 1638490901, 2364265378, 1509475888, 2355603679, 1133565821, 1450937015,
+            616059115,  3666188236, 1733804102, 3990855695, 1238628750, 512746184,  3900473826,
+            2651059231, 2791405051, 93474487,   2865892488, 222759186,  2113461797, 2178431077,
+            2325598341, 3189256113, 2505499508, 2986990416, 2945846737, 3487931071, 2018175258,
+            2766733928, 2428033310, 1307115286, 175147508,  3611190164, 1909211603, 1033628405,
+            199743319,  328621708,  3183670050, 1680331218, 4024297327, 3554549067, 2119566187,
+            1498503842, 3516256046, 290361143,  950288337,  1117344941, 2150569143, 3182619063,
+            168826051,  888858617,  35840654,   2829539211, 645798943,  2890882060, 3278412778,
+            2249895907, 1320858068, 1436708568, 1794920145, 1522426851, 1903494122, 1928370573,
+            3693049252, 1251697758, 220280169,  433606853,  1428961479, 3724415861, 2707115661,
+            467697583,  1616913929, 325674890,  1448052253, 122781510,  1689709565, 1493452467,
+            2222122038, 2177448198, 3425723636, 3512035688, 1283058921, 4230441398, 3050940272,
+            1646155473, 1418548715, 1190006478, 500654385,  1106232,    3920475367, 940574010,
+            922744002,  186142284,  4144806511, 54639113,   3031823448, 2143051534, 1429025284,
+            2067453848, 4152687885, 2079235652, 2447285474, 2669283767, 428527087,  1601035152,
+            3225501736, 2911340385, 382319031,  2565464472, 3508441679, 1388990570, 1749179860,
+            1924483707, 1737735237, 2835403456, 122872799,  2586347240, 880588515,  597822462,
+            2958058367, 4270737941, 1336703451, 3390078162, 2532634475, 450517882,  460422073,
+            3872117793, 803220151,  801648827,  2066343874, 250339760,  2186373604, 564259972,
+            3417948976, 1683787449, 657986735,  1075107552, 3692990573, 2235306692, 2615082840,
+            3201950123, 2332395402, 207483321,  699310933,  2655424371, 3732213278, 3151161301,
+            1629139881, 1152704006, 3236724760, 3572618926, 2703537080, 3218957129, 2726926336,
+            9775065,    685933373,  4241612717, 1034476784, 2398119652, 1621920075, 3855995181,
+            3010014356, 1638490901, 252854480,  1509475888, 2355603679, 1133565821, 1450937015,
+            2655911639, 3666188236, 1733804102, 3990855695, 1238628750, 1115900497, 3900473826,
+            2651059231, 2791405051, 93474487,   1862985957, 222759186,  2113461797, 2178431077,
+            2325598341, 4179075132, 2505499508, 2986990416, 2945846737, 3487931071, 564667776,
+            2766733928, 2428033310, 1307115286, 175147508,  1759077815, 1909211603, 1033628405,
+            199743319,  328621708,  2552816198, 1680331218, 4024297327, 3554549067, 2119566187,
+            2267805778, 3516256046, 290361143,  950288337,  1117344941, 2897506172, 3182619063,
+            168826051,  888858617,  35840654,   2035476068, 645798943,  2890882060, 3278412778,
+            2249895907, 3278449102, 1436708568, 1794920145, 1522426851, 1903494122, 1500763736,
+            3693049252, 1251697758, 220280169,  433606853,  3914497854, 3724415861, 2707115661,
+            467697583,  1616913929, 918435305,  1448052253, 122781510,  1689709565, 1493452467,
+            609575172,  2177448198, 3425723636, 3512035688, 1283058921, 3661181550, 3050940272,
+            1646155473, 1418548715, 1190006478, 1047301661, 1106232,    3920475367, 940574010,
+            922744002,  2510633517, 4144806511, 54639113,   3031823448, 2143051534, 3242814908,
+            2067453848, 4152687885, 2079235652, 2447285474, 736638210,  428527087,  1601035152,
+            3225501736, 2911340385, 1849570436, 2565464472, 3508441679, 1388990570, 1749179860,
+            84517579,   1737735237, 2835403456, 122872799,  2586347240, 4002124614, 597822462,
+            2958058367, 4270737941, 1336703451, 3078170472, 1186434751, 700631413,  1497890797,
+            1195347450, 2560167391, 1116697259, 1254138573, 747913260,  240954704,  3107512667,
+            360584144,  3422778960, 3516528389, 3301260366, 1254513537, 122269053,  1579582456,
+            873334104,  3918835024, 1731872444, 1974410416, 1811172641, 4172523062, 4092675777,
+            4124987343, 1936078756, 1757348689, 2694415512, 128641660,  1744777659, 3173116729,
+            983733754,  1430789547, 701906842,  3367232568, 3266433501, 3572590347, 1453272962,
+            2106553114, 993786201,  2149441250, 1295181065, 2962229026, 3709052556, 3255608941,
+            3677730029, 483873127,  102227292,  2626265293, 2018984578, 2266388762, 1191709548,
+            2152725916, 583672623,  2230473473, 1995194269, 1740347812, 2558095372, 3070195183,
+            3023333227, 2497183195, 1908755188, 773027539,  3646876518, 2272586839, 493318726,
+            2107067517, 2000805278, 2530829636, 3183628745, 677565332,  1497629423, 82094920,
+            2214054433, 2635367545, 470855467,  2184853389, 2942188934, 188335670,  3656661644,
+            1883526235, 3990873975, 1490784356, 4047548172, 3149642641, 3289988179, 2590918909,
+            2893039564, 2350687346, 4252624874, 15372456,   1614496594, 2364847678, 2604511825,
+            422365460,  4195174772, 3266964836, 2008671995, 54038434,   781948549,  1276017666,
+            2756376612, 2436825273, 1711863836, 3541493950, 3821378841, 1007557618, 345375815,
+            2081905201, 2227278118, 1185927141, 1082173792, 3567361925, 1940465859, 541632942,
+            1830210248, 3757851982, 775883450,  1666577465, 1004944607, 878440834,  2146344131,
+            4195798476, 370164841,  3649112729, 37066142,   2311278904, 1935745497, 2304799402,
+            4107299626, 1348526232, 2473609635, 3284032699, 2374292786, 1762329186, 857978496,
+            1039346432, 2621413355, 29961014,   3582263091, 4268542513, 3890612190, 3096173646,
+            2026544230, 3856142618, 2347115934, 319800326,  3255916105, 2430273059, 823505311,
+            874255188,  1401925393, 4203707857, 4259159566, 2606881118, 1978288664, 1447576038,
+            3860341401, 412510348,
+        },
+        {
+            1055408858, 2242191468, 3951867727, 2021898793, 3867124911, 1825785041, 1563129912,
+            2277044630, 3455188514, 3413690575, 3438723540, 2892828728, 1868808836, 4273620662,
+            1838982869, 3721924640, 328367656,  2300853974, 1492938905, 3650692707, 805657283,
+            1473918273, 483589279,  1236248813, 3990140981, 1921457806, 2448718771, 2040016348,
+            3971501876, 2640337270, 1874555762, 1654325741, 1286588662, 3868828996, 2592221260,
+            3583247731, 987993830,  2993481681, 668508543,  3952645550, 1801710364, 2941866314,
+            640471465,  3852954380, 3404399228, 3601890973, 3243267466, 3825872716, 523646370,
+            2492455688, 1151747465, 1653266989, 2605730992, 2837888732, 3429975678, 2845863475,
+            1006986440, 2079243229, 755578405,  995218690,  1060887138, 2787471088, 2421743998,
+            1449236507, 998372909,  1294281917, 2645848962, 3861962775, 1937472748, 1094239925,
+            3319089388, 1040252094, 3680420610, 3113605235, 1766958310, 2089542908, 1397793536,
+            2495353475, 3898900148, 902316452,  1384146911, 1208206938, 4267314589, 2096283803,
+            1981336251, 2235191311, 2475153997, 1579669109, 2552131472, 4015199206, 676294329,
+            3828408998, 956109521,  364068845,  1136278486, 3317917299, 558513482,  2526639875,
+            2241803775, 1585765239, 224180995,  2688256685, 4230341701, 330820321,  3305681416,
+            1231342797, 2050030233, 1368690223, 2460154410, 2597507041, 2819048825, 1409694980,
+            2351535298, 538444167,  1735417155, 2028903233, 323791444,  1245161039, 2117860786,
+            2423493767, 2110528363, 395728066,  4068325655, 3854177242, 3944997313, 4124842716,
+            2934242448, 1107452751, 254609724,  1771481814, 3428890864, 3228564077, 1679718460,
+            4002875183, 1709162927, 172850006,  3655878022, 4113521879, 849665772,  1208420189,
+            3114209397, 81839451,   2811603877, 1865812827, 1292297548, 4181903312, 3554617247,
+            2167049971, 501688783,  4228492251, 161048509,  3331354774, 1192444475, 3396872469,
+            306734005,  1908656574, 2751628983, 1827946450, 2451966689, 326947418,  238101309,
+            1055408858, 2242191468, 3951867727, 2021898793, 1599826377, 1825785041, 1563129912,
+            2277044630, 3455188514, 543661739,  3438723540, 2892828728, 1868808836, 4273620662,
+            78811512,   3721924640, 328367656,  2300853974, 1492938905, 3711144351, 805657283,
+            1473918273, 483589279,  1236248813, 3090867608, 1921457806, 2448718771, 2040016348,
+            3971501876, 257279647,  1874555762, 1654325741, 1286588662, 3868828996, 3210838348,
+            3583247731, 987993830,  2993481681, 668508543,  3913785535, 1801710364, 2941866314,
+            640471465,  3852954380, 543036935,  3601890973, 3243267466, 3825872716, 523646370,
+            2394596786, 1151747465, 1653266989, 2605730992, 2837888732, 2606838747, 2845863475,
+            1006986440, 2079243229, 755578405,  3417906685, 1060887138, 2787471088, 2421743998,
+            1449236507, 3480233273, 1294281917, 2645848962, 3861962775, 1937472748, 905305814,
+            3319089388, 1040252094, 3680420610, 3113605235, 4098598250, 2089542908, 1397793536,
+            2495353475, 3898900148, 1459442794, 1384146911, 1208206938, 4267314589, 2096283803,
+            2384383767, 2235191311, 2475153997, 1579669109, 2552131472, 3376920651, 676294329,
+            3828408998, 956109521,  364068845,  1739925130, 3317917299, 558513482,  2526639875,
+            2241803775, 2244756204, 224180995,  2688256685, 4230341701, 330820321,  406558494,
+            1231342797, 2050030233, 1368690223, 2460154410, 4246720399, 2819048825, 1409694980,
+            2351535298, 538444167,  3373744534, 2028903233, 323791444,  1245161039, 2117860786,
+            4041191134, 2110528363, 395728066,  4068325655, 3854177242, 2776160647, 4124842716,
+            2934242448, 1107452751, 254609724,  3891051754, 3428890864, 3228564077, 1679718460,
+            4002875183, 4084933670, 172850006,  3655878022, 4113521879, 849665772,  1500156443,
+            3114209397, 81839451,   2811603877, 1865812827, 289055461,  4181903312, 3554617247,
+            2167049971, 501688783,  4007157482, 161048509,  3331354774, 1192444475, 3396872469,
+            2125997236, 1908656574, 2751628983, 1827946450, 2451966689, 519892072,  238101309,
+            1055408858, 2242191468, 3951867727, 365848666,  1599826377, 1825785041, 1563129912,
+            2277044630, 679708018,  543661739,  3438723540, 2892828728, 1868808836, 4274474372,
+            78811512,   3721924640, 328367656,  2300853974, 2688420146, 3711144351, 805657283,
+            1473918273, 483589279,  86721567,   3090867608, 1921457806, 2448718771, 2040016348,
+            720915725,  257279647,  1874555762, 1654325741, 1286588662, 3196789026, 3210838348,
+            3583247731, 987993830,  2993481681, 2130892099, 3913785535, 1801710364, 2941866314,
+            640471465,  3097682615, 543036935,  3601890973, 3243267466, 3825872716, 1680337967,
+            2394596786, 1151747465, 1653266989, 2605730992, 1253042869, 2606838747, 2845863475,
+            1006986440, 2079243229, 1416723286, 3417906685, 1060887138, 2787471088, 2421743998,
+            1117391156, 3480233273, 1294281917, 2645848962, 3861962775, 2536034905, 905305814,
+            3319089388, 1040252094, 3680420610, 3690310043, 4098598250, 2089542908, 1397793536,
+            2495353475, 3825625538, 1459442794, 1384146911, 1208206938, 4267314589, 3595975491,
+            2384383767, 2235191311, 2475153997, 1579669109, 2114505936, 3376920651, 676294329,
+            3828408998, 956109521,  3980339119, 1739925130, 3317917299, 558513482,  2526639875,
+            475018383,  2244756204, 224180995,  2688256685, 4230341701, 2458413123, 406558494,
+            1231342797, 2050030233, 1368690223, 3805506601, 4246720399, 2819048825, 1409694980,
+            2351535298, 2753879452, 3373744534, 2028903233, 323791444,  1245161039, 358407900,
+            4041191134, 2110528363, 395728066,  4068325655, 3824774657, 2776160647, 4124842716,
+            2934242448, 1107452751, 2659486145, 3891051754, 3428890864, 3228564077, 1679718460,
+            2780496948, 4084933670, 172850006,  3655878022, 4113521879, 1941528093, 1500156443,
+            3114209397, 81839451,   2811603877, 1652804271, 289055461,  4181903312, 3554617247,
+            2167049971, 2309116765, 4007157482, 161048509,  3331354774, 1192444475, 368291009,
+            2125997236, 1908656574, 2751628983, 1827946450, 3666580948, 519892072,  238101309,
+            1055408858, 2242191468, 3400533986, 365848666,  1599826377, 1825785041, 1563129912,
+            3480155119, 679708018,  543661739,  3438723540, 2892828728, 2126557832, 4274474372,
+            78811512,   3721924640, 328367656,  3679162525, 2688420146, 3711144351, 805657283,
+            1473918273, 2394179950, 86721567,   3090867608, 1921457806, 2448718771, 33777822,
+            720915725,  257279647,  1874555762, 1654325741, 457351771,  3196789026, 3210838348,
+            3583247731, 987993830,  595564116,  2130892099, 3913785535, 1801710364, 2941866314,
+            359576194,  3097682615, 543036935,  3601890973, 3243267466, 2512228297, 1680337967,
+            2394596786, 1151747465, 1653266989, 1685504316, 1253042869, 2606838747, 2845863475,
+            1006986440, 4028530786, 1416723286, 3417906685, 1060887138, 2787471088, 2141947715,
+            1117391156, 3480233273, 1294281917, 2645848962, 62951365,   2536034905, 905305814,
+            3319089388, 1040252094, 2367378942, 3690310043, 4098598250, 2089542908, 1397793536,
+            399954353,  3825625538, 1459442794, 1384146911, 1208206938, 2406435552, 3595975491,
+            2384383767, 2235191311, 2475153997, 2721200142, 2114505936, 3376920651, 676294329,
+            3828408998, 2990566956, 3980339119, 1739925130, 3317917299, 558513482,  998440159,
+            475018383,  2244756204, 224180995,  2688256685, 1618514135, 2458413123, 406558494,
+            1231342797, 2050030233, 1828358658, 3805506601, 4246720399, 2819048825, 1409694980,
+            792769953,  2753879452, 3373744534, 2028903233, 323791444,  2740053737, 358407900,
+            4041191134, 2110528363, 395728066,  31519172,   3824774657, 2776160647, 4124842716,
+            2934242448, 2999458508, 2659486145, 3891051754, 3428890864, 3228564077, 1922629414,
+            2780496948, 4084933670, 172850006,  3655878022, 1232440264, 1941528093, 1500156443,
+            3114209397, 81839451,   782800186,  1652804271, 289055461,  4181903312, 3554617247,
+            1255140809, 2309116765, 4007157482, 161048509,  3331354774, 2895233430, 368291009,
+            2125997236, 1908656574, 2751628983, 763173174,  1702165444, 4173008954, 2826376466,
+            2330837612, 2832742746, 2398637195, 2151197203, 1309192637, 1486805639, 4126359906,
+            155237661,  1305039921, 2238740850, 3158450327, 3694883126, 2377107670, 3421546670,
+            244546312,  3661259034, 2458023718, 2201159574, 1593648661, 477271460,  1092609825,
+            3968889395, 453938882,  2439737959, 2051354603, 1408534876, 870125456,  1812622430,
+            3906909160, 4123301937, 836741638,  794037096,  3096980988, 3251716830, 158403122,
+            2372573189, 3405439021, 2112891057, 2679906862, 1835542598, 2621667424, 2032842143,
+            2404300986, 1393866772, 1530312761, 3596639666, 1574177616, 2922156731, 307227974,
+            2879406405, 1042248977, 2358150351, 3351399936, 2009188768, 1368364868, 2177436768,
+            2490719944, 2639192028, 462662359,  2588457786, 1671577376, 3809132455, 1694032409,
+            679220778,  1541839638, 250980258,  1715803682, 3628372946, 928319921,  3508105693,
+            1553895857, 792333299,  4205604117, 3174001983, 2045179159, 3496135884, 4179951990,
+            3534491229, 1247939600, 3335609976, 1337886590, 4166638333, 236911879,  3169495045,
+            406196233,  515258736,  3183544885, 2017019962, 3552159418, 1213376640, 2006258512,
+            1485648664, 2625022385, 813841730,  3574586663, 945943761,  1012915866, 2093509519,
+            3662546434, 3689922265, 4200559303, 2032692506, 1688366657, 717387547,  2210036086,
+            842316171,  1741322753, 3582468688, 1387050609, 394843497,  716312174,  1992029317,
+            1103868764, 2184759023, 682446725,  1957163064, 2064992714, 3134609666, 2221799991,
+            753694493,  1343544729, 2113049484, 3706220825, 2973997427, 4176088112, 4041078989,
+            3736654419, 1710749704, 3090918551, 2503843454, 2104489575, 405860984,  1742186543,
+            1669515516, 618931452,  3826037560, 1653798433, 736591337,  1482564596, 20230639,
+            3098255770, 2700743505, 2387773035, 3973139652, 4260097569, 78195185,   159854743,
+            1128848734, 3404369411, 607310057,  766228308,  226469233,  2716755175, 3021850662,
+            3399871634, 3144033580,
+        },
+        {
+            1208534643, 2832856129, 2167138653, 2736018528, 2645101543, 4180156039, 17037133,
+            1421283380, 1722671451, 384347811,  936310361,  864968364,  2202346218, 1797988851,
+            2301641673, 2396344174, 590657160,  526234380,  1853020912, 4104501360, 2561320760,
+            841437069,  360940050,  4187673839, 2436249243, 1313639960, 657680786,  97359423,
+            1279422366, 193412951,  3691615742, 2558548727, 683324631,  4047324473, 3581444354,
+            1186611145, 1801950561, 3570487154, 3447411496, 1700962903, 259380080,  3014347722,
+            1711828910, 2683068015, 3206474429, 1164528864, 3318616431, 2704854249, 2556057697,
+            3660181602, 1785172459, 2569371603, 2756784036, 917686397,  650216116,  785823515,
+            285343019,  2018431573, 2808143854, 1956446818, 2273080736, 2609196072, 1173120610,
+            530404603,  884504195,  780314918,  2396587460, 744745295,  1261146023, 940251130,
+            4167478350, 4048773635, 1326316871, 1199041798, 4088859795, 756826571,  3317174722,
+            2707808378, 2180713787, 2698057463, 2896832528, 2588038613, 1157840728, 2076086765,
+            1294805790, 2190191020, 693764522,  1704943926, 2590963533, 2425994690, 2894729455,
+            69382744,   631186738,  809109946,  225833428,  3913195464, 453234175,  3975264823,
+            1384254205, 816771336,  1696588340, 3366467345, 1012850114, 1785644058, 2701671397,
+            2966934384, 140232456,  1100989493, 330080440,  1079494897, 2319912201, 1162359678,
+            2598892696, 19474634,   875802279,  3503533916, 2431932033, 3092969747, 3725205569,
+            3713834097, 2563477139, 1342597116, 421480534,  569739228,  68628472,   2330428132,
+            2817186455, 1033819323, 3005650625, 384517217,  3791381958, 456260702,  1408526276,
+            2899575372, 891104188,  462828929,  4211346169, 1884841673, 2803161392, 2322134331,
+            2229711789, 1241501735, 3956960586, 3305441437, 3401705211, 3477548832, 1887079089,
+            506233730,  1645842373, 3042092570, 3690654173, 1742483231, 3069654545, 695791476,
+            3541844521, 2526257982, 2171427985, 1087701398, 2018071767, 1970764701, 71724132,
+            1208534643, 2832856129, 2167138653, 2736018528, 190747295,  4180156039, 17037133,
+            1421283380, 1722671451, 1065781586, 936310361,  864968364,  2202346218, 1797988851,
+            599281834,  2396344174, 590657160,  526234380,  1853020912, 1087142607, 2561320760,
+            841437069,  360940050,  4187673839, 2880577324, 1313639960, 657680786,  97359423,
+            1279422366, 391724513,  3691615742, 2558548727, 683324631,  4047324473, 4006630468,
+            1186611145, 1801950561, 3570487154, 3447411496, 1564629016, 259380080,  3014347722,
+            1711828910, 2683068015, 2611270036, 1164528864, 3318616431, 2704854249, 2556057697,
+            560921196,  1785172459, 2569371603, 2756784036, 917686397,  2962019375, 785823515,
+            285343019,  2018431573, 2808143854, 1480601440, 2273080736, 2609196072, 1173120610,
+            530404603,  2570695350, 780314918,  2396587460, 744745295,  1261146023, 2562402025,
+            4167478350, 4048773635, 1326316871, 1199041798, 3711456016, 756826571,  3317174722,
+            2707808378, 2180713787, 2937247358, 2896832528, 2588038613, 1157840728, 2076086765,
+            3060587886, 2190191020, 693764522,  1704943926, 2590963533, 3709710903, 2894729455,
+            69382744,   631186738,  809109946,  4161104259, 3913195464, 453234175,  3975264823,
+            1384254205, 793959790,  1696588340, 3366467345, 1012850114, 1785644058, 3772350201,
+            2966934384, 140232456,  1100989493, 330080440,  3612554396, 2319912201, 1162359678,
+            2598892696, 19474634,   2165707562, 3503533916, 2431932033, 3092969747, 3725205569,
+            316554319,  2563477139, 1342597116, 421480534,  569739228,  2759637824, 2330428132,
+            2817186455, 1033819323, 3005650625, 4032874816, 3791381958, 456260702,  1408526276,
+            2899575372, 4134766795, 462828929,  4211346169, 1884841673, 2803161392, 4149903895,
+            2229711789, 1241501735, 3956960586, 3305441437, 2386489518, 3477548832, 1887079089,
+            506233730,  1645842373, 796407817,  3690654173, 1742483231, 3069654545, 695791476,
+            2893604845, 2526257982, 2171427985, 1087701398, 2018071767, 355721289,  71724132,
+            1208534643, 2832856129, 2167138653, 551621841,  190747295,  4180156039, 17037133,
+            1421283380, 1557975225, 1065781586, 936310361,  864968364,  2202346218, 2849674223,
+            599281834,  2396344174, 590657160,  526234380,  1880715529, 1087142607, 2561320760,
+            841437069,  360940050,  252578572,  2880577324, 1313639960, 657680786,  97359423,
+            1048239266, 391724513,  3691615742, 2558548727, 683324631,  1018919149, 4006630468,
+            1186611145, 1801950561, 3570487154, 1814782284, 1564629016, 259380080,  3014347722,
+            1711828910, 3538064032, 2611270036, 1164528864, 3318616431, 2704854249, 2540959430,
+            560921196,  1785172459, 2569371603, 2756784036, 4099153844, 2962019375, 785823515,
+            285343019,  2018431573, 3482228243, 1480601440, 2273080736, 2609196072, 1173120610,
+            3017503392, 2570695350, 780314918,  2396587460, 744745295,  2329345241, 2562402025,
+            4167478350, 4048773635, 1326316871, 3680906521, 3711456016, 756826571,  3317174722,
+            2707808378, 772076566,  2937247358, 2896832528, 2588038613, 1157840728, 2102875809,
+            3060587886, 2190191020, 693764522,  1704943926, 911990240,  3709710903, 2894729455,
+            69382744,   631186738,  3930761031, 4161104259, 3913195464, 453234175,  3975264823,
+            2809095647, 793959790,  1696588340, 3366467345, 1012850114, 877743862,  3772350201,
+            2966934384, 140232456,  1100989493, 383335512,  3612554396, 2319912201, 1162359678,
+            2598892696, 1306373351, 2165707562, 3503533916, 2431932033, 3092969747, 2036163026,
+            316554319,  2563477139, 1342597116, 421480534,  4050211757, 2759637824, 2330428132,
+            2817186455, 1033819323, 1434279776, 4032874816, 3791381958, 456260702,  1408526276,
+            2493398662, 4134766795, 462828929,  4211346169, 1884841673, 2803076132, 4149903895,
+            2229711789, 1241501735, 3956960586, 1847847345, 2386489518, 3477548832, 1887079089,
+            506233730,  2357849321, 796407817,  3690654173, 1742483231, 3069654545, 3660992537,
+            2893604845, 2526257982, 2171427985, 1087701398, 2095302319, 355721289,  71724132,
+            1208534643, 2832856129, 4234231507, 551621841,  190747295,  4180156039, 17037133,
+            2899440125, 1557975225, 1065781586, 936310361,  864968364,  68693808,   2849674223,
+            599281834,  2396344174, 590657160,  61239547,   1880715529, 1087142607, 2561320760,
+            841437069,  1063266403, 252578572,  2880577324, 1313639960, 657680786,  3756956010,
+            1048239266, 391724513,  3691615742, 2558548727, 3392622593, 1018919149, 4006630468,
+            1186611145, 1801950561, 2215560752, 1814782284, 1564629016, 259380080,  3014347722,
+            3757115159, 3538064032, 2611270036, 1164528864, 3318616431, 2078755172, 2540959430,
+            560921196,  1785172459, 2569371603, 3963599415, 4099153844, 2962019375, 785823515,
+            285343019,  3839806200, 3482228243, 1480601440, 2273080736, 2609196072, 925705780,
+            3017503392, 2570695350, 780314918,  2396587460, 3022830554, 2329345241, 2562402025,
+            4167478350, 4048773635, 3718478346, 3680906521, 3711456016, 756826571,  3317174722,
+            561830819,  772076566,  2937247358, 2896832528, 2588038613, 1595557871, 2102875809,
+            3060587886, 2190191020, 693764522,  3881517522, 911990240,  3709710903, 2894729455,
+            69382744,   4257773962, 3930761031, 4161104259, 3913195464, 453234175,  579821310,
+            2809095647, 793959790,  1696588340, 3366467345, 2632772489, 877743862,  3772350201,
+            2966934384, 140232456,  2911180119, 383335512,  3612554396, 2319912201, 1162359678,
+            3615005592, 1306373351, 2165707562, 3503533916, 2431932033, 901496877,  2036163026,
+            316554319,  2563477139, 1342597116, 1335931247, 4050211757, 2759637824, 2330428132,
+            2817186455, 1198353991, 1434279776, 4032874816, 3791381958, 456260702,  309308288,
+            2493398662, 4134766795, 462828929,  4211346169, 278086665,  2803076132, 4149903895,
+            2229711789, 1241501735, 3767041662, 1847847345, 2386489518, 3477548832, 1887079089,
+            2061534754, 2357849321, 796407817,  3690654173, 1742483231, 1540400475, 3660992537,
+            2893604845, 2526257982, 2171427985, 2475379194, 1817783947, 2301325743, 18847591,
+            899497418,  995278267,  3983722454, 708781519,  2629213312, 2629537900, 978406134,
+            3116750818, 1284686996, 2321429027, 2910846869, 2701582363, 3148553301, 2225975559,
+            2663873037, 1344991547, 2201067998, 4030840685, 2356316844, 2089446622, 682656877,
+            708920510,  3886872264, 3184995280, 4179956331, 2486224626, 793079017,  2844509135,
+            4182409189, 284113903,  3107884833, 515232638,  2531016381, 970103712,  1077462104,
+            3125955871, 1893101128, 204096712,  2956238013, 3432009611, 1562989478, 4069366293,
+            1433785876, 4013958807, 593058433,  88881153,   1495283276, 1857773704, 4277959147,
+            1977098544, 1725231250, 1113505218, 2478169584, 2537163708, 3167794830, 3848973426,
+            4176669872, 3493181753, 568757038,  2664222557, 3558502340, 2013874966, 1758945827,
+            1472048514, 1669082720, 3279852751, 1283202976, 120909733,  2857018039, 2037071945,
+            634534546,  1037359621, 4040935928, 2607180061, 2003611111, 2968522205, 3424231281,
+            1046324228, 3882511123, 3450524985, 2440112332, 670240513,  2360458497, 2918723924,
+            2390758281, 321741633,  4284763103, 665366987,  1268433943, 2766132885, 1305863163,
+            279734775,  2967178748, 825399274,  3934314993, 2639985054, 3543720150, 4147329793,
+            2245158996, 4033992165, 2356203746, 4099470831, 1545526004, 2501181363, 522639716,
+            1771856121, 1066908614, 1516873788, 844669109,  1166026113, 2562418320, 1572838785,
+            1805892945, 599203736,  2665777063, 4079337601, 109348137,  3582867082, 1525768415,
+            421455667,  666783764,  883606674,  4250626993, 1793808430, 3329059565, 3394146596,
+            3363505837, 2129147089, 2693509544, 1467764248, 2657658151, 3781475144, 97062446,
+            1011190549, 3172132986, 2111361458, 3870389134, 4129437575, 1362213795, 2792044980,
+            579701273,  2253463116, 1725521970, 150636931,  2261023021, 1233344013, 4059978811,
+            2334054937, 127350512,  686755577,  4078298916, 4139917030, 2903686077, 1998908324,
+            3680242761, 1305456503,
+        },
+        {
+            4052471963, 683640040,  3043876021, 3466644483, 4222418025, 3035140128, 1466027937,
+            18198088,   3410320851, 3040963721, 488404231,  3157371815, 769336092,  3240417718,
+            808582581,  2075839263, 835026995,  3123726486, 3284240985, 1898453053, 3606056482,
+            512836002,  2715428547, 4182302879, 1644882480, 3160187826, 390292489,  980889545,
+            2776206633, 2482799995, 617042280,  3501667414, 689451808,  497018701,  238525753,
+            3890163301, 896679896,  1544533015, 3412477225, 3116575138, 4250402651, 3990990746,
+            819056741,  1459334146, 158377590,  3444755752, 8230450,    1378706455, 684191332,
+            3217423797, 2842520097, 1631477948, 2591254230, 959644473,  1020694107, 1748401915,
+            3452514983, 3892766171, 1227786994, 2086180800, 2394613217, 2091953150, 870094953,
+            2306851481, 571550601,  488878212,  873197214,  2630100528, 2067476907, 2162307009,
+            2026119728, 115875280,  2905867426, 248774881,  3110900450, 2236032812, 1888510348,
+            708001855,  996960491,  3514196956, 1407967546, 1826568876, 3659618284, 2614104317,
+            2230066308, 1055135881, 2537437343, 1858044413, 2608594891, 2750681169, 3241939420,
+            3966440877, 2375002886, 2417753441, 1405878685, 1081133199, 1496940727, 382467042,
+            2745477587, 1209424459, 811187075,  1385604734, 2623887355, 3443875720, 394141555,
+            4142998949, 4195414618, 1489846841, 2253433808, 1171450286, 84131191,   4387588,
+            2641405140, 3525405389, 3273000909, 423660319,  2366546732, 3698878607, 2161119729,
+            4263629085, 3029102089, 2692507376, 3266869596, 1658012061, 1960169440, 1002311379,
+            3724446882, 2004188516, 999513506,  2200093802, 4141037460, 351865836,  412875013,
+            1535823315, 3880657632, 3109944987, 3207577548, 3462087941, 584875517,  2635241084,
+            3834145971, 1693380373, 3524443732, 934775214,  1960588847, 2226778032, 1044609478,
+            12199016,   1120582000, 226430296,  665553142,  2570993348, 1685535237, 3325420136,
+            3925248326, 2855346376, 1205558328, 808835317,  3295908896, 4170076136, 2438272365,
+            4052471963, 683640040,  3043876021, 3466644483, 1385549869, 3035140128, 1466027937,
+            18198088,   3410320851, 2171386836, 488404231,  3157371815, 769336092,  3240417718,
+            2921774554, 2075839263, 835026995,  3123726486, 3284240985, 72352110,   3606056482,
+            512836002,  2715428547, 4182302879, 3869483469, 3160187826, 390292489,  980889545,
+            2776206633, 1385691983, 617042280,  3501667414, 689451808,  497018701,  2600411809,
+            3890163301, 896679896,  1544533015, 3412477225, 356556378,  4250402651, 3990990746,
+            819056741,  1459334146, 199003993,  3444755752, 8230450,    1378706455, 684191332,
+            1750733272, 2842520097, 1631477948, 2591254230, 959644473,  2113375576, 1748401915,
+            3452514983, 3892766171, 1227786994, 275473920,  2394613217, 2091953150, 870094953,
+            2306851481, 897057645,  488878212,  873197214,  2630100528, 2067476907, 944114068,
+            2026119728, 115875280,  2905867426, 248774881,  989201307,  2236032812, 1888510348,
+            708001855,  996960491,  2121706374, 1407967546, 1826568876, 3659618284, 2614104317,
+            2931815032, 1055135881, 2537437343, 1858044413, 2608594891, 1423973935, 3241939420,
+            3966440877, 2375002886, 2417753441, 2514473440, 1081133199, 1496940727, 382467042,
+            2745477587, 81977310,   811187075,  1385604734, 2623887355, 3443875720, 2100629879,
+            4142998949, 4195414618, 1489846841, 2253433808, 337182869,  84131191,   4387588,
+            2641405140, 3525405389, 661876463,  423660319,  2366546732, 3698878607, 2161119729,
+            309510684,  3029102089, 2692507376, 3266869596, 1658012061, 11119541,   1002311379,
+            3724446882, 2004188516, 999513506,  3486722046, 4141037460, 351865836,  412875013,
+            1535823315, 2818130700, 3109944987, 3207577548, 3462087941, 584875517,  322875622,
+            3834145971, 1693380373, 3524443732, 934775214,  3879414752, 2226778032, 1044609478,
+            12199016,   1120582000, 4207259464, 665553142,  2570993348, 1685535237, 3325420136,
+            553869152,  2855346376, 1205558328, 808835317,  3295908896, 470585896,  2438272365,
+            4052471963, 683640040,  3043876021, 1588419572, 1385549869, 3035140128, 1466027937,
+            18198088,   363815288,  2171386836, 488404231,  3157371815, 769336092,  2464768302,
+            2921774554, 2075839263, 835026995,  3123726486, 4229246330, 72352110,   3606056482,
+            512836002,  2715428547, 319830805,  3869483469, 3160187826, 390292489,  980889545,
+            2966401462, 1385691983, 617042280,  3501667414, 689451808,  4047377762, 2600411809,
+            3890163301, 896679896,  1544533015, 764316452,  356556378,  4250402651, 3990990746,
+            819056741,  965331966,  199003993,  3444755752, 8230450,    1378706455, 51902971,
+            1750733272, 2842520097, 1631477948, 2591254230, 426039404,  2113375576, 1748401915,
+            3452514983, 3892766171, 2833368447, 275473920,  2394613217, 2091953150, 870094953,
+            3524323828, 897057645,  488878212,  873197214,  2630100528, 3939852929, 944114068,
+            2026119728, 115875280,  2905867426, 3192643919, 989201307,  2236032812, 1888510348,
+            708001855,  2166012172, 2121706374, 1407967546, 1826568876, 3659618284, 135277096,
+            2931815032, 1055135881, 2537437343, 1858044413, 2588429924, 1423973935, 3241939420,
+            3966440877, 2375002886, 2477142003, 2514473440, 1081133199, 1496940727, 382467042,
+            1760129281, 81977310,   811187075,  1385604734, 2623887355, 4070531513, 2100629879,
+            4142998949, 4195414618, 1489846841, 2688068550, 337182869,  84131191,   4387588,
+            2641405140, 1837403234, 661876463,  423660319,  2366546732, 3698878607, 2916121190,
+            309510684,  3029102089, 2692507376, 3266869596, 303422295,  11119541,   1002311379,
+            3724446882, 2004188516, 2652711421, 3486722046, 4141037460, 351865836,  412875013,
+            113149471,  2818130700, 3109944987, 3207577548, 3462087941, 1443140792, 322875622,
+            3834145971, 1693380373, 3524443732, 901891935,  3879414752, 2226778032, 1044609478,
+            12199016,   2213168758, 4207259464, 665553142,  2570993348, 1685535237, 1114492412,
+            553869152,  2855346376, 1205558328, 808835317,  3266626294, 470585896,  2438272365,
+            4052471963, 683640040,  3581539398, 1588419572, 1385549869, 3035140128, 1466027937,
+            4075470388, 363815288,  2171386836, 488404231,  3157371815, 2759472233, 2464768302,
+            2921774554, 2075839263, 835026995,  1030654310, 4229246330, 72352110,   3606056482,
+            512836002,  961858496,  319830805,  3869483469, 3160187826, 390292489,  2366221117,
+            2966401462, 1385691983, 617042280,  3501667414, 295865937,  4047377762, 2600411809,
+            3890163301, 896679896,  21714884,   764316452,  356556378,  4250402651, 3990990746,
+            1012967081, 965331966,  199003993,  3444755752, 8230450,    1255302023, 51902971,
+            1750733272, 2842520097, 1631477948, 2321320272, 426039404,  2113375576, 1748401915,
+            3452514983, 2847013518, 2833368447, 275473920,  2394613217, 2091953150, 1250695522,
+            3524323828, 897057645,  488878212,  873197214,  1452317325, 3939852929, 944114068,
+            2026119728, 115875280,  4061820350, 3192643919, 989201307,  2236032812, 1888510348,
+            3986446165, 2166012172, 2121706374, 1407967546, 1826568876, 2910745432, 135277096,
+            2931815032, 1055135881, 2537437343, 2976455307, 2588429924, 1423973935, 3241939420,
+            3966440877, 2418897705, 2477142003, 2514473440, 1081133199, 1496940727, 1321648771,
+            1760129281, 81977310,   811187075,  1385604734, 17644628,   4070531513, 2100629879,
+            4142998949, 4195414618, 2697310527, 2688068550, 337182869,  84131191,   4387588,
+            1724191700, 1837403234, 661876463,  423660319,  2366546732, 693430992,  2916121190,
+            309510684,  3029102089, 2692507376, 3917396098, 303422295,  11119541,   1002311379,
+            3724446882, 841468294,  2652711421, 3486722046, 4141037460, 351865836,  1733384185,
+            113149471,  2818130700, 3109944987, 3207577548, 2326233100, 1443140792, 322875622,
+            3834145971, 1693380373, 1580706359, 901891935,  3879414752, 2226778032, 1044609478,
+            3805470822, 2213168758, 4207259464, 665553142,  2570993348, 3406548636, 1114492412,
+            553869152,  2855346376, 1205558328, 4287831475, 1329654114, 2347235746, 2477803138,
+            2962371859, 3610024283, 4197266903, 1162294689, 1746713323, 2815058477, 2152552186,
+            4214791071, 2382522482, 3713914466, 3974765132, 348354997,  1670276150, 2173074887,
+            381736894,  3866219357, 1919366695, 3635118824, 2298653261, 3534332682, 1627699897,
+            4168636618, 3787938690, 2144231271, 2067679462, 217001062,  2308928337, 1620415125,
+            3526559172, 749451561,  2456947371, 3543607786, 1893824735, 962598819,  2332807164,
+            1691114891, 2543992233, 2914780639, 1610287145, 1700599697, 3185174208, 552323208,
+            2367242224, 3797136972, 3415066418, 2468049249, 1677937401, 40445671,   2886682530,
+            2585715434, 194932329,  2994003812, 3099556382, 680852222,  135838738,  1371063256,
+            995454898,  3754526418, 803635682,  634588682,  3869250783, 2442285521, 1455637058,
+            570621479,  2512681851, 1220136924, 750260121,  2909903038, 1582019728, 955115170,
+            1608265445, 2157390890, 2303678604, 1568394164, 831914289,  1971271392, 1294799854,
+            1489945167, 442427880,  1305083700, 1211218668, 2380073713, 2798736785, 2193524273,
+            3227386915, 1636588977, 3612937642, 435113647,  1591761830, 536210039,  2475747073,
+            4223795480, 1786737271, 1444661534, 3249410301, 3333695212, 4169107188, 3280638635,
+            702659930,  1444127970, 225340755,  2255629368, 746584456,  3965677674, 2671132955,
+            2080717656, 2145343886, 3712441197, 368422910,  1297685674, 4076123901, 26214470,
+            2948764826, 40503299,   1198194334, 2100063637, 1966331612, 2189582064, 2064696934,
+            1797550642, 3469793941, 2868963812, 851437659,  240918534,  365060070,  3530600064,
+            39695324,   1753898837, 1286976449, 3131971360, 2406485219, 3365373704, 3224113403,
+            1651742834, 587601940,  1574206085, 3739575036, 1413669616, 38172232,   293127854,
+            4126190109, 1891744061, 787878666,  456643669,  4228710325, 2025132037, 1492133135,
+            3122840937, 969442079,  3272420439, 3836126369, 1877655562, 2766212758, 3867984746,
+            3348077578, 1841216706,
+        },
+        {
+            1626075205, 489485816,  1436240561, 2530345839, 4018257937, 4055026545, 60215627,
+            3425375895, 458469187,  3211366636, 3010091278, 861482084,  1605490001, 2683741319,
+            869083887,  2600126273, 2226563440, 1323383756, 3603636293, 3469841507, 3275089208,
+            2240337923, 1742671379, 1940896207, 1014678566, 1848735349, 857344395,  1217166653,
+            1530342605, 2476413639, 600710842,  3496804272, 1484430335, 3025805958, 617241180,
+            1941623945, 1865685525, 1096887058, 3874216851, 851602821,  3658007577, 823939009,
+            2950815522, 1356909919, 1462889464, 3775423651, 4082943967, 2542604810, 3011433969,
+            3007716094, 668308916,  4138068845, 4086724707, 3133898164, 3432208258, 3644918371,
+            1174511588, 2493477698, 298587312,  2039939826, 1492478400, 830773121,  2602350794,
+            949565181,  771082792,  1185626767, 2279122449, 2276416942, 4158680314, 818989306,
+            1437115553, 3371946515, 86155715,   3491619545, 2126534182, 2907025401, 3273397518,
+            3297472798, 1805610400, 4012532889, 573347879,  2811937358, 3747873887, 3095609228,
+            3972938440, 1799071193, 3720303821, 1322588255, 1326402463, 1723428441, 1155153461,
+            1964885919, 968970561,  321164097,  3421613292, 1222257711, 27146610,   3898586175,
+            169449758,  3841043561, 3628228553, 2763694906, 2719199432, 1017308254, 49371220,
+            2667988244, 1962424612, 490004067,  1912326609, 1493277779, 983613266,  811112500,
+            1348797016, 2809382130, 70792172,   2040698338, 1875922572, 1229156293, 2393925535,
+            525780982,  1147328105, 2928085605, 186125823,  3670289837, 1453774282, 2411726319,
+            761163959,  76437603,   292756622,  1819226211, 1541775213, 980759417,  1172131546,
+            2348962085, 467451687,  3076531422, 2089973507, 3828784037, 3829371918, 3310655235,
+            2067324598, 1830078033, 3206653846, 255648657,  490930563,  3724220293, 2546355748,
+            2662333503, 2568095540, 3678851717, 185923106,  2686992701, 1312643166, 2036203006,
+            1305056159, 1799117343, 1890800590, 2681458780, 1456956696, 3808192225, 3272885149,
+            1626075205, 489485816,  1436240561, 2530345839, 3234635460, 4055026545, 60215627,
+            3425375895, 458469187,  4065919648, 3010091278, 861482084,  1605490001, 2683741319,
+            3923800855, 2600126273, 2226563440, 1323383756, 3603636293, 629440710,  3275089208,
+            2240337923, 1742671379, 1940896207, 554189255,  1848735349, 857344395,  1217166653,
+            1530342605, 2529057261, 600710842,  3496804272, 1484430335, 3025805958, 3093929346,
+            1941623945, 1865685525, 1096887058, 3874216851, 3392808718, 3658007577, 823939009,
+            2950815522, 1356909919, 3685086011, 3775423651, 4082943967, 2542604810, 3011433969,
+            1580132930, 668308916,  4138068845, 4086724707, 3133898164, 3925145240, 3644918371,
+            1174511588, 2493477698, 298587312,  1874564099, 1492478400, 830773121,  2602350794,
+            949565181,  1972259712, 1185626767, 2279122449, 2276416942, 4158680314, 2080294532,
+            1437115553, 3371946515, 86155715,   3491619545, 3694280377, 2907025401, 3273397518,
+            3297472798, 1805610400, 1559110554, 573347879,  2811937358, 3747873887, 3095609228,
+            2479700669, 1799071193, 3720303821, 1322588255, 1326402463, 1264372617, 1155153461,
+            1964885919, 968970561,  321164097,  4225313265, 1222257711, 27146610,   3898586175,
+            169449758,  1125157421, 3628228553, 2763694906, 2719199432, 1017308254, 386071026,
+            2667988244, 1962424612, 490004067,  1912326609, 2520912674, 983613266,  811112500,
+            1348797016, 2809382130, 3977889478, 2040698338, 1875922572, 1229156293, 2393925535,
+            427825265,  1147328105, 2928085605, 186125823,  3670289837, 3783644771, 2411726319,
+            761163959,  76437603,   292756622,  4044497677, 1541775213, 980759417,  1172131546,
+            2348962085, 3885301475, 3076531422, 2089973507, 3828784037, 3829371918, 2160029080,
+            2067324598, 1830078033, 3206653846, 255648657,  1491723404, 3724220293, 2546355748,
+            2662333503, 2568095540, 3016461414, 185923106,  2686992701, 1312643166, 2036203006,
+            1594452755, 1799117343, 1890800590, 2681458780, 1456956696, 1829798344, 3272885149,
+            1626075205, 489485816,  1436240561, 3282852325, 3234635460, 4055026545, 60215627,
+            3425375895, 3734155351, 4065919648, 3010091278, 861482084,  1605490001, 3893592659,
+            3923800855, 2600126273, 2226563440, 1323383756, 744905594,  629440710,  3275089208,
+            2240337923, 1742671379, 2708865408, 554189255,  1848735349, 857344395,  1217166653,
+            3778386771, 2529057261, 600710842,  3496804272, 1484430335, 1939013811, 3093929346,
+            1941623945, 1865685525, 1096887058, 12917155,   3392808718, 3658007577, 823939009,
+            2950815522, 4135463156, 3685086011, 3775423651, 4082943967, 2542604810, 645180337,
+            1580132930, 668308916,  4138068845, 4086724707, 2628796146, 3925145240, 3644918371,
+            1174511588, 2493477698, 224570203,  1874564099, 1492478400, 830773121,  2602350794,
+            3410474096, 1972259712, 1185626767, 2279122449, 2276416942, 1678706898, 2080294532,
+            1437115553, 3371946515, 86155715,   1322517922, 3694280377, 2907025401, 3273397518,
+            3297472798, 2799112577, 1559110554, 573347879,  2811937358, 3747873887, 1241028586,
+            2479700669, 1799071193, 3720303821, 1322588255, 3172273770, 1264372617, 1155153461,
+            1964885919, 968970561,  683296857,  4225313265, 1222257711, 27146610,   3898586175,
+            2001900349, 1125157421, 3628228553, 2763694906, 2719199432, 2002029671, 386071026,
+            2667988244, 1962424612, 490004067,  1090328786, 2520912674, 983613266,  811112500,
+            1348797016, 4063268856, 3977889478, 2040698338, 1875922572, 1229156293, 3864823986,
+            427825265,  1147328105, 2928085605, 186125823,  980195420,  3783644771, 2411726319,
+            761163959,  76437603,   2773624772, 4044497677, 1541775213, 980759417,  1172131546,
+            4269830283, 3885301475, 3076531422, 2089973507, 3828784037, 4267970788, 2160029080,
+            2067324598, 1830078033, 3206653846, 1231547531, 1491723404, 3724220293, 2546355748,
+            2662333503, 2518070016, 3016461414, 185923106,  2686992701, 1312643166, 376826575,
+            1594452755, 1799117343, 1890800590, 2681458780, 2713310470, 1829798344, 3272885149,
+            1626075205, 489485816,  1123249104, 3282852325, 3234635460, 4055026545, 60215627,
+            963960252,  3734155351, 4065919648, 3010091278, 861482084,  1723491823, 3893592659,
+            3923800855, 2600126273, 2226563440, 3093191466, 744905594,  629440710,  3275089208,
+            2240337923, 886799016,  2708865408, 554189255,  1848735349, 857344395,  1660286724,
+            3778386771, 2529057261, 600710842,  3496804272, 2428721572, 1939013811, 3093929346,
+            1941623945, 1865685525, 2931391211, 12917155,   3392808718, 3658007577, 823939009,
+            4093039401, 4135463156, 3685086011, 3775423651, 4082943967, 780501922,  645180337,
+            1580132930, 668308916,  4138068845, 3187829629, 2628796146, 3925145240, 3644918371,
+            1174511588, 1928577630, 224570203,  1874564099, 1492478400, 830773121,  4017538948,
+            3410474096, 1972259712, 1185626767, 2279122449, 4266639829, 1678706898, 2080294532,
+            1437115553, 3371946515, 3675156544, 1322517922, 3694280377, 2907025401, 3273397518,
+            3426626419, 2799112577, 1559110554, 573347879,  2811937358, 893124557,  1241028586,
+            2479700669, 1799071193, 3720303821, 3315192136, 3172273770, 1264372617, 1155153461,
+            1964885919, 1075317532, 683296857,  4225313265, 1222257711, 27146610,   917235288,
+            2001900349, 1125157421, 3628228553, 2763694906, 453256603,  2002029671, 386071026,
+            2667988244, 1962424612, 690315055,  1090328786, 2520912674, 983613266,  811112500,
+            1589786105, 4063268856, 3977889478, 2040698338, 1875922572, 920787207,  3864823986,
+            427825265,  1147328105, 2928085605, 2307830298, 980195420,  3783644771, 2411726319,
+            761163959,  1605957652, 2773624772, 4044497677, 1541775213, 980759417,  1062498199,
+            4269830283, 3885301475, 3076531422, 2089973507, 24484593,   4267970788, 2160029080,
+            2067324598, 1830078033, 3914396427, 1231547531, 1491723404, 3724220293, 2546355748,
+            2235511998, 2518070016, 3016461414, 185923106,  2686992701, 2198815783, 376826575,
+            1594452755, 1799117343, 1890800590, 243510777,  374755346,  2084597589, 2317993823,
+            2650230473, 330258433,  1137515171, 3935464506, 1705510734, 52009780,   272206154,
+            2414218292, 4056007545, 3670120354, 478908399,  1045188822, 2244776916, 4175783057,
+            109935964,  766218202,  3110873325, 117882511,  897444759,  1999993299, 3577598689,
+            311503218,  1794322300, 1341584816, 2533578507, 197324808,  2796247234, 2696249114,
+            3646510715, 1965048131, 3350851516, 3711608557, 2503636246, 394816218,  2983998919,
+            208640501,  104123720,  505220706,  1741427330, 1631407626, 1863094633, 1287224486,
+            2222185292, 4194165628, 4075868534, 3043667065, 1693176028, 2564403762, 986140373,
+            2438443077, 988845926,  3636693599, 4045479807, 507363999,  3456727227, 2538706111,
+            3062938049, 2031355203, 3435887494, 3560512378, 3374275455, 993817795,  2347765956,
+            3500720433, 2794592684, 1162831070, 3535266124, 2221561686, 4122875090, 2356327063,
+            3755995184, 2548104797, 1940710162, 968903868,  2149181031, 879948,     3178725084,
+            3099448734, 2001335551, 1171466693, 221026466,  1606067075, 2417976709, 62165789,
+            2775992317, 2369475044, 2828171215, 366693206,  36856001,   101049862,  522910258,
+            1061317903, 79211020,   1709937762, 760292562,  367231888,  3388244017, 1763913952,
+            1853161120, 1792223552, 3274484691, 4204673483, 3662897522, 890236509,  1131852736,
+            3606468392, 2026958289, 2868651517, 1332432206, 1576346113, 6904571,    2078460959,
+            1240036919, 3009648961, 1885899629, 236001958,  2524731017, 1879399805, 1203199437,
+            1908268378, 2599091789, 1003060514, 2550661960, 1635492975, 176595452,  1473745775,
+            4211709699, 2775216225, 2229042285, 1732036520, 2648722539, 1825148881, 146432142,
+            772986090,  131793961,  569337284,  3499823859, 3522070530, 797612262,  2939549054,
+            3557632968, 709872752,  3273604987, 2323174384, 3532732284, 258613497,  31137654,
+            2229545928, 317888712,  2704872622, 2855133836, 1529315528, 3626550511, 3462213152,
+            2438219059, 4201127724,
+        },
+        {
+            314367219,  2561050032, 3309472711, 2647700058, 1758648303, 405386006,  1351089332,
+            2293303231, 2039454603, 3569823309, 266203235,  2819329359, 4175208406, 3612989158,
+            3581231359, 3937551979, 3162376200, 2746491487, 3067667065, 3135015725, 1986215690,
+            2746560461, 1101616117, 3064674184, 2865748,    3499037655, 4162368250, 2247052251,
+            1354048869, 402219696,  4158086235, 2558377726, 1748502558, 3384024507, 2899395216,
+            193778254,  523505908,  516807688,  1215416154, 1456402647, 257397892,  4265111241,
+            1891960833, 3527547193, 4248055501, 198489448,  470470659,  885542401,  1126918615,
+            3924452491, 1941284633, 1132014198, 699436586,  3954699695, 3385071135, 3045029249,
+            236925312,  3973416737, 125243523,  1423716177, 829487668,  2397686005, 1804488235,
+            1815665795, 1042076102, 291375296,  4197058607, 1400027920, 3244057994, 4185830493,
+            3388870053, 4169890605, 2298775702, 1063571656, 4024549861, 4099071076, 2485298194,
+            1611163121, 598583129,  432902647,  3429358996, 313685582,  782074049,  2655608943,
+            1079800263, 3834348811, 577389067,  1437902418, 1340537313, 4099821584, 2716537992,
+            2321689794, 2487003707, 1896730846, 4011634225, 1325412738, 102743939,  799279642,
+            3812230635, 663135842,  3616752448, 984741944,  2468593328, 3881522554, 285600317,
+            1854423144, 2386812572, 1604037964, 4218186129, 1581989288, 3962347731, 1878056942,
+            1239961756, 2631858753, 2910841979, 3992887168, 1464040341, 2758827783, 2131425993,
+            1088013127, 3788359881, 4271734978, 355679393,  3160852429, 1630941506, 3379358859,
+            2896019886, 1074855638, 3364321584, 1643821167, 978205080,  171454957,  2237802578,
+            1327009405, 375349986,  1804472164, 3746860179, 4250022569, 771602876,  4169714466,
+            2306266524, 3413487613, 423710207,  3690539776, 1356054588, 2849417272, 2415523728,
+            2952502226, 2474512134, 3991043153, 3498035056, 522806728,  2170006639, 901163884,
+            1106371740, 3277957344, 1451168491, 766913982,  1756654611, 182462476,  536438377,
+            314367219,  2561050032, 3309472711, 2647700058, 383340776,  405386006,  1351089332,
+            2293303231, 2039454603, 611563961,  266203235,  2819329359, 4175208406, 3612989158,
+            3872064666, 3937551979, 3162376200, 2746491487, 3067667065, 2417247173, 1986215690,
+            2746560461, 1101616117, 3064674184, 913205763,  3499037655, 4162368250, 2247052251,
+            1354048869, 1154876254, 4158086235, 2558377726, 1748502558, 3384024507, 1820235804,
+            193778254,  523505908,  516807688,  1215416154, 118412879,  257397892,  4265111241,
+            1891960833, 3527547193, 1827186298, 198489448,  470470659,  885542401,  1126918615,
+            1812300031, 1941284633, 1132014198, 699436586,  3954699695, 452254642,  3045029249,
+            236925312,  3973416737, 125243523,  1780442556, 829487668,  2397686005, 1804488235,
+            1815665795, 3498267611, 291375296,  4197058607, 1400027920, 3244057994, 3618424291,
+            3388870053, 4169890605, 2298775702, 1063571656, 3434623607, 4099071076, 2485298194,
+            1611163121, 598583129,  315463434,  3429358996, 313685582,  782074049,  2655608943,
+            815211596,  3834348811, 577389067,  1437902418, 1340537313, 2922791249, 2716537992,
+            2321689794, 2487003707, 1896730846, 2393077433, 1325412738, 102743939,  799279642,
+            3812230635, 2880719588, 3616752448, 984741944,  2468593328, 3881522554, 3239642502,
+            1854423144, 2386812572, 1604037964, 4218186129, 2309887186, 3962347731, 1878056942,
+            1239961756, 2631858753, 2646262775, 3992887168, 1464040341, 2758827783, 2131425993,
+            3340980881, 3788359881, 4271734978, 355679393,  3160852429, 3583924283, 3379358859,
+            2896019886, 1074855638, 3364321584, 3036940036, 978205080,  171454957,  2237802578,
+            1327009405, 3410512477, 1804472164, 3746860179, 4250022569, 771602876,  370346991,
+            2306266524, 3413487613, 423710207,  3690539776, 901434766,  2849417272, 2415523728,
+            2952502226, 2474512134, 3511227370, 3498035056, 522806728,  2170006639, 901163884,
+            2259131003, 3277957344, 1451168491, 766913982,  1756654611, 86113353,   536438377,
+            314367219,  2561050032, 3309472711, 562332208,  383340776,  405386006,  1351089332,
+            2293303231, 2119200831, 611563961,  266203235,  2819329359, 4175208406, 491278184,
+            3872064666, 3937551979, 3162376200, 2746491487, 1228775753, 2417247173, 1986215690,
+            2746560461, 1101616117, 2917331554, 913205763,  3499037655, 4162368250, 2247052251,
+            402996476,  1154876254, 4158086235, 2558377726, 1748502558, 1961292888, 1820235804,
+            193778254,  523505908,  516807688,  2070455989, 118412879,  257397892,  4265111241,
+            1891960833, 3733074178, 1827186298, 198489448,  470470659,  885542401,  4120772393,
+            1812300031, 1941284633, 1132014198, 699436586,  460620685,  452254642,  3045029249,
+            236925312,  3973416737, 3150036981, 1780442556, 829487668,  2397686005, 1804488235,
+            2080624952, 3498267611, 291375296,  4197058607, 1400027920, 455906696,  3618424291,
+            3388870053, 4169890605, 2298775702, 4273080608, 3434623607, 4099071076, 2485298194,
+            1611163121, 4120675618, 315463434,  3429358996, 313685582,  782074049,  871712660,
+            815211596,  3834348811, 577389067,  1437902418, 2098346345, 2922791249, 2716537992,
+            2321689794, 2487003707, 396546470,  2393077433, 1325412738, 102743939,  799279642,
+            833355693,  2880719588, 3616752448, 984741944,  2468593328, 978370569,  3239642502,
+            1854423144, 2386812572, 1604037964, 4173255689, 2309887186, 3962347731, 1878056942,
+            1239961756, 2735827234, 2646262775, 3992887168, 1464040341, 2758827783, 1205332549,
+            3340980881, 3788359881, 4271734978, 355679393,  2892816893, 3583924283, 3379358859,
+            2896019886, 1074855638, 1875279534, 3036940036, 978205080,  171454957,  2237802578,
+            3478159190, 3410512477, 1804472164, 3746860179, 4250022569, 4058203822, 370346991,
+            2306266524, 3413487613, 423710207,  1410342768, 901434766,  2849417272, 2415523728,
+            2952502226, 3012703166, 3511227370, 3498035056, 522806728,  2170006639, 2726325603,
+            2259131003, 3277957344, 1451168491, 766913982,  2538617892, 86113353,   536438377,
+            314367219,  2561050032, 1504449889, 562332208,  383340776,  405386006,  1351089332,
+            2507909164, 2119200831, 611563961,  266203235,  2819329359, 2469211406, 491278184,
+            3872064666, 3937551979, 3162376200, 1594141408, 1228775753, 2417247173, 1986215690,
+            2746560461, 1165376819, 2917331554, 913205763,  3499037655, 4162368250, 3902968831,
+            402996476,  1154876254, 4158086235, 2558377726, 1106024634, 1961292888, 1820235804,
+            193778254,  523505908,  3823029002, 2070455989, 118412879,  257397892,  4265111241,
+            1250193010, 3733074178, 1827186298, 198489448,  470470659,  979282927,  4120772393,
+            1812300031, 1941284633, 1132014198, 21418470,   460620685,  452254642,  3045029249,
+            236925312,  125044424,  3150036981, 1780442556, 829487668,  2397686005, 3417934929,
+            2080624952, 3498267611, 291375296,  4197058607, 1186572875, 455906696,  3618424291,
+            3388870053, 4169890605, 1905917867, 4273080608, 3434623607, 4099071076, 2485298194,
+            246196177,  4120675618, 315463434,  3429358996, 313685582,  1058208902, 871712660,
+            815211596,  3834348811, 577389067,  3116015161, 2098346345, 2922791249, 2716537992,
+            2321689794, 4188707961, 396546470,  2393077433, 1325412738, 102743939,  33173706,
+            833355693,  2880719588, 3616752448, 984741944,  384169152,  978370569,  3239642502,
+            1854423144, 2386812572, 2482039309, 4173255689, 2309887186, 3962347731, 1878056942,
+            2832175256, 2735827234, 2646262775, 3992887168, 1464040341, 29173332,   1205332549,
+            3340980881, 3788359881, 4271734978, 442060639,  2892816893, 3583924283, 3379358859,
+            2896019886, 3495899515, 1875279534, 3036940036, 978205080,  171454957,  1539843079,
+            3478159190, 3410512477, 1804472164, 3746860179, 3854038770, 4058203822, 370346991,
+            2306266524, 3413487613, 2436524391, 1410342768, 901434766,  2849417272, 2415523728,
+            800406555,  3012703166, 3511227370, 3498035056, 522806728,  3309726249, 2726325603,
+            2259131003, 3277957344, 1451168491, 2584154851, 2200287587, 1581859264, 2121814774,
+            2098534177, 44144467,   1181168292, 3281646490, 380273945,  2732491375, 1378249703,
+            3470144795, 3122030609, 3261967188, 403646599,  1653302040, 4081590538, 4036955309,
+            2143960132, 1369073227, 2389874596, 3628926186, 1070101855, 298948900,  2356972877,
+            493531286,  2759475982, 3286902379, 2891822176, 2071317965, 160167632,  177220917,
+            1544059644, 3586094000, 3809023517, 49180444,   513761999,  1771975795, 3303152740,
+            732078298,  154876334,  2931347708, 3188567998, 3956157283, 2454695370, 4234596011,
+            3396507399, 1507457032, 128412282,  1628720127, 3954788378, 1318939445, 3445688850,
+            3244374518, 3034038914, 1570608489, 65512164,   3238178827, 3838602992, 2749366329,
+            1146954328, 1809701367, 1389187730, 1993740845, 3344738854, 2089826270, 1294556685,
+            848704520,  1835504877, 1221585136, 2675607744, 1986108942, 1610986267, 100883565,
+            2113678450, 1597826667, 3650195810, 1060767049, 4065532744, 4010811973, 687144295,
+            2194748560, 1308894467, 2163884607, 83744199,   4194362754, 62700349,   2406675262,
+            888567005,  3523791188, 2946677893, 222869661,  2980719253, 2986442170, 4003840797,
+            4147415202, 404331787,  30485622,   3910264169, 3157581905, 2760470054, 961123505,
+            3694391350, 1214270060, 976579708,  3333333561, 3208318871, 2333320111, 41236610,
+            1332195949, 458267169,  3253775201, 2912753278, 4249856559, 3974113790, 377981392,
+            241852635,  1717813158, 438645946,  2589672717, 2621098589, 3570506538, 1072165054,
+            2781242704, 253387017,  1869633902, 242773041,  1216323243, 597346951,  1631053717,
+            1230035789, 2496882966, 3648825475, 4253229826, 2273281525, 2955049363, 3407394399,
+            3791407339, 1837166135, 3348993961, 1230403363, 2900459985, 1560463231, 1259457680,
+            3261536524, 2068937216, 3932885863, 3195735063, 2344731033, 571959713,  232555296,
+            577355579,  2449181829, 1085448047, 2429376543, 552790987,  3853812194, 1194650753,
+            3247666938, 49471002,
+        },
+        {
+            2220923022, 1550966376, 2301148949, 3957956442, 985467129,  1504270278, 3766217199,
+            1676651528, 3978116945, 1443245867, 3087842218, 929310295,  3995426468, 423062017,
+            2831269619, 688439551,  1835897351, 2125491047, 3587786911, 2866267856, 1579219257,
+            3596797381, 4194431747, 544605908,  200029477,  3589297439, 272101376,  592889894,
+            2054406526, 2907959678, 1806386885, 2620932426, 4161536324, 2127390760, 2059855085,
+            3819540664, 2750869447, 3321266233, 2185525170, 1580116458, 1517480254, 546490183,
+            618395226,  292932596,  2129579194, 3925112303, 4115149038, 2854319148, 1939073505,
+            1037630740, 2693685924, 3452950222, 2162206604, 845403370,  1014926615, 2864496104,
+            846994207,  1076495175, 3604924518, 2293164358, 2591440307, 2396847001, 1020642955,
+            1734675827, 5928095,    796868642,  3257431830, 1755923013, 329635944,  1505035825,
+            1800134953, 431055636,  2886074044, 3442131391, 3886718202, 2086813920, 3558629343,
+            217797804,  2973642437, 1936372934, 2620499134, 3220510771, 2687904608, 2315549516,
+            2141207628, 455828027,  480573984,  1163203638, 4273418060, 2186277438, 3202330194,
+            2670553402, 285879495,  3547121211, 1243756637, 2519970955, 1237179128, 3131378717,
+            3340223725, 927168605,  2866221954, 2232634894, 629151721,  3189417712, 2809591103,
+            2304105576, 833991330,  1608499950, 178571433,  1199227912, 4150286497, 1781387723,
+            1513108420, 474995625,  3194853318, 570568822,  3620217398, 1648989982, 254396462,
+            971375691,  3202455493, 3393692531, 3052284884, 3229454341, 4238802789, 839479566,
+            2154283071, 2693102534, 197572536,  3363610326, 4149404805, 2708788832, 287364870,
+            404476938,  1341196486, 1505032706, 4133977208, 3155322619, 342671428,  53584759,
+            2950424832, 43932126,   1869987491, 3192545232, 537882128,  4141842646, 1260429126,
+            965834858,  4273261343, 2649532559, 1588760250, 2493902354, 1321443209, 65386581,
+            2190774976, 4124949584, 7473648,    651975069,  1893782506, 3494182015, 788155732,
+            2220923022, 1550966376, 2301148949, 3957956442, 755378552,  1504270278, 3766217199,
+            1676651528, 3978116945, 3567947698, 3087842218, 929310295,  3995426468, 423062017,
+            409818948,  688439551,  1835897351, 2125491047, 3587786911, 478873715,  1579219257,
+            3596797381, 4194431747, 544605908,  3936561280, 3589297439, 272101376,  592889894,
+            2054406526, 1257680470, 1806386885, 2620932426, 4161536324, 2127390760, 2327238282,
+            3819540664, 2750869447, 3321266233, 2185525170, 542590562,  1517480254, 546490183,
+            618395226,  292932596,  3907597443, 3925112303, 4115149038, 2854319148, 1939073505,
+            535193846,  2693685924, 3452950222, 2162206604, 845403370,  342852181,  2864496104,
+            846994207,  1076495175, 3604924518, 204394949,  2591440307, 2396847001, 1020642955,
+            1734675827, 3936106950, 796868642,  3257431830, 1755923013, 329635944,  1182440259,
+            1800134953, 431055636,  2886074044, 3442131391, 1495590974, 2086813920, 3558629343,
+            217797804,  2973642437, 4034991189, 2620499134, 3220510771, 2687904608, 2315549516,
+            2757854936, 455828027,  480573984,  1163203638, 4273418060, 2073587560, 3202330194,
+            2670553402, 285879495,  3547121211, 2860111914, 2519970955, 1237179128, 3131378717,
+            3340223725, 2331854084, 2866221954, 2232634894, 629151721,  3189417712, 2181902732,
+            2304105576, 833991330,  1608499950, 178571433,  3834714043, 4150286497, 1781387723,
+            1513108420, 474995625,  1448672086, 570568822,  3620217398, 1648989982, 254396462,
+            308793664,  3202455493, 3393692531, 3052284884, 3229454341, 574557469,  839479566,
+            2154283071, 2693102534, 197572536,  1527694714, 4149404805, 2708788832, 287364870,
+            404476938,  1062829502, 1505032706, 4133977208, 3155322619, 342671428,  567608576,
+            2950424832, 43932126,   1869987491, 3192545232, 1611638741, 4141842646, 1260429126,
+            965834858,  4273261343, 1999449852, 1588760250, 2493902354, 1321443209, 65386581,
+            3079055036, 4124949584, 7473648,    651975069,  1893782506, 1077187985, 788155732,
+            2220923022, 1550966376, 2301148949, 3220809580, 755378552,  1504270278, 3766217199,
+            1676651528, 251804540,  3567947698, 3087842218, 929310295,  3995426468, 4291902560,
+            409818948,  688439551,  1835897351, 2125491047, 565511089,  478873715,  1579219257,
+            3596797381, 4194431747, 801769248,  3936561280, 3589297439, 272101376,  592889894,
+            44713349,   1257680470, 1806386885, 2620932426, 4161536324, 183799796,  2327238282,
+            3819540664, 2750869447, 3321266233, 537672093,  542590562,  1517480254, 546490183,
+            618395226,  556337353,  3907597443, 3925112303, 4115149038, 2854319148, 3133825320,
+            535193846,  2693685924, 3452950222, 2162206604, 2775178662, 342852181,  2864496104,
+            846994207,  1076495175, 2760190922, 204394949,  2591440307, 2396847001, 1020642955,
+            1084258268, 3936106950, 796868642,  3257431830, 1755923013, 2132086699, 1182440259,
+            1800134953, 431055636,  2886074044, 3944038521, 1495590974, 2086813920, 3558629343,
+            217797804,  3552595578, 4034991189, 2620499134, 3220510771, 2687904608, 1215448685,
+            2757854936, 455828027,  480573984,  1163203638, 2493166074, 2073587560, 3202330194,
+            2670553402, 285879495,  2541641941, 2860111914, 2519970955, 1237179128, 3131378717,
+            1416480940, 2331854084, 2866221954, 2232634894, 629151721,  2046657358, 2181902732,
+            2304105576, 833991330,  1608499950, 1326471862, 3834714043, 4150286497, 1781387723,
+            1513108420, 903818815,  1448672086, 570568822,  3620217398, 1648989982, 3527462412,
+            308793664,  3202455493, 3393692531, 3052284884, 2993274871, 574557469,  839479566,
+            2154283071, 2693102534, 3341085648, 1527694714, 4149404805, 2708788832, 287364870,
+            3774154414, 1062829502, 1505032706, 4133977208, 3155322619, 454733227,  567608576,
+            2950424832, 43932126,   1869987491, 4159382979, 1611638741, 4141842646, 1260429126,
+            965834858,  2134614608, 1999449852, 1588760250, 2493902354, 1321443209, 3740012004,
+            3079055036, 4124949584, 7473648,    651975069,  3249143260, 1077187985, 788155732,
+            2220923022, 1550966376, 2844238171, 3220809580, 755378552,  1504270278, 3766217199,
+            3073535828, 251804540,  3567947698, 3087842218, 929310295,  2590313066, 4291902560,
+            409818948,  688439551,  1835897351, 888918722,  565511089,  478873715,  1579219257,
+            3596797381, 358434429,  801769248,  3936561280, 3589297439, 272101376,  2112525853,
+            44713349,   1257680470, 1806386885, 2620932426, 4122448994, 183799796,  2327238282,
+            3819540664, 2750869447, 3380359395, 537672093,  542590562,  1517480254, 546490183,
+            3417634840, 556337353,  3907597443, 3925112303, 4115149038, 1782476621, 3133825320,
+            535193846,  2693685924, 3452950222, 1013495264, 2775178662, 342852181,  2864496104,
+            846994207,  1000891698, 2760190922, 204394949,  2591440307, 2396847001, 1610783422,
+            1084258268, 3936106950, 796868642,  3257431830, 3521611039, 2132086699, 1182440259,
+            1800134953, 431055636,  2698284545, 3944038521, 1495590974, 2086813920, 3558629343,
+            2154512427, 3552595578, 4034991189, 2620499134, 3220510771, 1804088936, 1215448685,
+            2757854936, 455828027,  480573984,  594781430,  2493166074, 2073587560, 3202330194,
+            2670553402, 748308099,  2541641941, 2860111914, 2519970955, 1237179128, 1085350094,
+            1416480940, 2331854084, 2866221954, 2232634894, 629946415,  2046657358, 2181902732,
+            2304105576, 833991330,  2812997137, 1326471862, 3834714043, 4150286497, 1781387723,
+            1409204895, 903818815,  1448672086, 570568822,  3620217398, 2453593585, 3527462412,
+            308793664,  3202455493, 3393692531, 459087878,  2993274871, 574557469,  839479566,
+            2154283071, 2975800279, 3341085648, 1527694714, 4149404805, 2708788832, 483199316,
+            3774154414, 1062829502, 1505032706, 4133977208, 4240974326, 454733227,  567608576,
+            2950424832, 43932126,   1428164015, 4159382979, 1611638741, 4141842646, 1260429126,
+            2792701835, 2134614608, 1999449852, 1588760250, 2493902354, 3590021705, 3740012004,
+            3079055036, 4124949584, 7473648,    4285064706, 2610973068, 3500253266, 3792990154,
+            2255937709, 2736339050, 310965913,  994590472,  3634980659, 4170359859, 1130549637,
+            1902598801, 3595894873, 2393851928, 515080177,  678898106,  376093472,  613152002,
+            483655186,  4271756652, 2774618706, 188054607,  474972876,  3758233577, 2059973694,
+            404123560,  2520346365, 3471274307, 2039649478, 4113576015, 2235032640, 2821743028,
+            2354104307, 672173123,  681408363,  2759366896, 3442504258, 540367956,  3410422657,
+            3792691387, 2595224799, 919600434,  3771112790, 3303693038, 4003630447, 2607957800,
+            1997805726, 1574358277, 1498608022, 1627449398, 1357714409, 650830786,  4004963814,
+            1797701101, 4183887882, 2633989840, 3891372514, 1640325471, 3403717506, 346236707,
+            1696346382, 4127545849, 75203034,   1882865343, 246814095,  668116910,  200006994,
+            3966568464, 3517344847, 599115944,  471441254,  1924556556, 2591437053, 852086595,
+            2527342427, 1197894354, 593304859,  3209328776, 1962869065, 3020917379, 2830175685,
+            1459352553, 2020568736, 3841595011, 3780175038, 1278992450, 2804327070, 3612827033,
+            3714901189, 2334060377, 3209198965, 2547341402, 4005913853, 3475374385, 1590927205,
+            3304061384, 1996629482, 2459013631, 3163736874, 1864689477, 2116140551, 4250194739,
+            1813277814, 2577094275, 761036815,  2157278388, 939768170,  2925150084, 1297705383,
+            1276454726, 200180185,  3985280349, 1518013092, 791293958,  3283761426, 2675415713,
+            1928189120, 2222621439, 1166383332, 2777654886, 3284422138, 3308091369, 2138210289,
+            504415502,  4062264436, 2635789809, 4020503968, 1628333999, 2283377289, 288865385,
+            1104077461, 4175551823, 2445290777, 468734389,  1253122586, 3194260734, 3276306432,
+            2544361805, 3255308020, 1187823693, 2497177570, 1746912788, 1929735103, 1389391551,
+            4245391295, 1776537687, 1019469304, 3408459835, 2871484398, 1576591160, 141566989,
+            2919570310, 3510548950, 2786301738, 4171307408, 1642200490, 3021643747, 1794544135,
+            3715118267, 682461419,
+        },
+        {
+            448725004,  1973129079, 415692355,  1644323896, 1365751269, 2020292799, 3024792866,
+            1330258445, 3448701738, 3669528761, 1527894691, 2794359523, 213197793,  3918593407,
+            1461083677, 3090909405, 1080414335, 3772132348, 3395163645, 3944667,    2162018326,
+            3744088638, 3293425507, 3831416109, 1458556170, 3256590499, 753989969,  3623943535,
+            1518045704, 4175780446, 1154620080, 773605637,  2245413152, 3615326362, 652568832,
+            693600070,  2022644674, 560170236,  547514022,  2717915225, 671075912,  2788296784,
+            3261902694, 3327882459, 774843486,  2006522427, 3845473538, 3051883157, 1708705098,
+            668829349,  1215710910, 2655930874, 3165431996, 2021006848, 3208526183, 3305978800,
+            3906140543, 3729329954, 716915197,  3446107956, 261994418,  3329711182, 1947662437,
+            1260749803, 2903585291, 943909834,  2445388241, 2692780293, 2051780727, 4062077444,
+            154256124,  35584276,   3059817392, 2838049026, 3225568830, 1870866616, 2189837689,
+            3164349394, 439965136,  1071365155, 3693303123, 460404401,  1305509429, 3275070979,
+            2134404900, 4019949540, 2794653052, 2350761899, 3641562907, 2163439164, 1642672757,
+            2505433243, 1811617736, 2791161132, 1221526297, 1570253374, 153839098,  44907762,
+            3027096621, 3821842775, 418718665,  2205534017, 3619425163, 2922249308, 2616214202,
+            2106928241, 4008254940, 189597391,  2701655664, 1315051421, 1612962171, 1486399129,
+            3532362552, 2124445019, 160198740,  9440259,    110668192,  2527900208, 4265037720,
+            685162693,  1157535180, 2687487570, 4103465411, 1198196156, 3310190878, 367166777,
+            1761082924, 2840402021, 1599265562, 434777242,  352675591,  3779360833, 229936354,
+            3724264483, 359247599,  1557061870, 559799662,  2401381577, 2824842004, 3580391824,
+            2451233292, 3579803991, 2001247134, 105928994,  2603910572, 2837336674, 124895810,
+            1353103622, 2740218964, 3951419080, 2606539151, 3562295897, 3787548817, 2974245342,
+            2122398374, 2396461493, 626625853,  2653615590, 32868499,   1152592035, 229348598,
+            448725004,  1973129079, 415692355,  1644323896, 1359092033, 2020292799, 3024792866,
+            1330258445, 3448701738, 463410701,  1527894691, 2794359523, 213197793,  3918593407,
+            785233986,  3090909405, 1080414335, 3772132348, 3395163645, 2391864462, 2162018326,
+            3744088638, 3293425507, 3831416109, 3475514941, 3256590499, 753989969,  3623943535,
+            1518045704, 2821947373, 1154620080, 773605637,  2245413152, 3615326362, 1617255108,
+            693600070,  2022644674, 560170236,  547514022,  2942778390, 671075912,  2788296784,
+            3261902694, 3327882459, 3294675537, 2006522427, 3845473538, 3051883157, 1708705098,
+            858543899,  1215710910, 2655930874, 3165431996, 2021006848, 910868281,  3305978800,
+            3906140543, 3729329954, 716915197,  1021530474, 261994418,  3329711182, 1947662437,
+            1260749803, 478451371,  943909834,  2445388241, 2692780293, 2051780727, 1198882192,
+            154256124,  35584276,   3059817392, 2838049026, 2820960321, 1870866616, 2189837689,
+            3164349394, 439965136,  1650108068, 3693303123, 460404401,  1305509429, 3275070979,
+            2670437902, 4019949540, 2794653052, 2350761899, 3641562907, 2913742780, 1642672757,
+            2505433243, 1811617736, 2791161132, 3236947064, 1570253374, 153839098,  44907762,
+            3027096621, 1543391016, 418718665,  2205534017, 3619425163, 2922249308, 1141585846,
+            2106928241, 4008254940, 189597391,  2701655664, 1865262609, 1612962171, 1486399129,
+            3532362552, 2124445019, 3658422179, 9440259,    110668192,  2527900208, 4265037720,
+            2409079373, 1157535180, 2687487570, 4103465411, 1198196156, 3200503423, 367166777,
+            1761082924, 2840402021, 1599265562, 246931525,  352675591,  3779360833, 229936354,
+            3724264483, 1177978725, 1557061870, 559799662,  2401381577, 2824842004, 2323708744,
+            2451233292, 3579803991, 2001247134, 105928994,  597104495,  2837336674, 124895810,
+            1353103622, 2740218964, 2450875552, 2606539151, 3562295897, 3787548817, 2974245342,
+            4106540031, 2396461493, 626625853,  2653615590, 32868499,   2384390196, 229348598,
+            448725004,  1973129079, 415692355,  618922126,  1359092033, 2020292799, 3024792866,
+            1330258445, 3518879031, 463410701,  1527894691, 2794359523, 213197793,  464824883,
+            785233986,  3090909405, 1080414335, 3772132348, 3842426231, 2391864462, 2162018326,
+            3744088638, 3293425507, 3446701915, 3475514941, 3256590499, 753989969,  3623943535,
+            72445421,   2821947373, 1154620080, 773605637,  2245413152, 3256923847, 1617255108,
+            693600070,  2022644674, 560170236,  3565766921, 2942778390, 671075912,  2788296784,
+            3261902694, 1658434043, 3294675537, 2006522427, 3845473538, 3051883157, 79696111,
+            858543899,  1215710910, 2655930874, 3165431996, 3224061201, 910868281,  3305978800,
+            3906140543, 3729329954, 3999041800, 1021530474, 261994418,  3329711182, 1947662437,
+            1481955661, 478451371,  943909834,  2445388241, 2692780293, 552989581,  1198882192,
+            154256124,  35584276,   3059817392, 3796803250, 2820960321, 1870866616, 2189837689,
+            3164349394, 1055391362, 1650108068, 3693303123, 460404401,  1305509429, 2768599040,
+            2670437902, 4019949540, 2794653052, 2350761899, 670109263,  2913742780, 1642672757,
+            2505433243, 1811617736, 2738794769, 3236947064, 1570253374, 153839098,  44907762,
+            27696561,   1543391016, 418718665,  2205534017, 3619425163, 141376763,  1141585846,
+            2106928241, 4008254940, 189597391,  2851270785, 1865262609, 1612962171, 1486399129,
+            3532362552, 27671370,   3658422179, 9440259,    110668192,  2527900208, 1199580753,
+            2409079373, 1157535180, 2687487570, 4103465411, 727882363,  3200503423, 367166777,
+            1761082924, 2840402021, 3422420249, 246931525,  352675591,  3779360833, 229936354,
+            2526110051, 1177978725, 1557061870, 559799662,  2401381577, 3478746170, 2323708744,
+            2451233292, 3579803991, 2001247134, 1187420786, 597104495,  2837336674, 124895810,
+            1353103622, 906799761,  2450875552, 2606539151, 3562295897, 3787548817, 4011150742,
+            4106540031, 2396461493, 626625853,  2653615590, 371800015,  2384390196, 229348598,
+            448725004,  1973129079, 2001406289, 618922126,  1359092033, 2020292799, 3024792866,
+            1418986098, 3518879031, 463410701,  1527894691, 2794359523, 2983320811, 464824883,
+            785233986,  3090909405, 1080414335, 1244805001, 3842426231, 2391864462, 2162018326,
+            3744088638, 304221213,  3446701915, 3475514941, 3256590499, 753989969,  4161054275,
+            72445421,   2821947373, 1154620080, 773605637,  2509296648, 3256923847, 1617255108,
+            693600070,  2022644674, 3465025559, 3565766921, 2942778390, 671075912,  2788296784,
+            20287780,   1658434043, 3294675537, 2006522427, 3845473538, 2603727741, 79696111,
+            858543899,  1215710910, 2655930874, 1953507868, 3224061201, 910868281,  3305978800,
+            3906140543, 1516876641, 3999041800, 1021530474, 261994418,  3329711182, 473477274,
+            1481955661, 478451371,  943909834,  2445388241, 2784171087, 552989581,  1198882192,
+            154256124,  35584276,   3263698315, 3796803250, 2820960321, 1870866616, 2189837689,
+            1282585103, 1055391362, 1650108068, 3693303123, 460404401,  4275911694, 2768599040,
+            2670437902, 4019949540, 2794653052, 3024110721, 670109263,  2913742780, 1642672757,
+            2505433243, 2698615626, 2738794769, 3236947064, 1570253374, 153839098,  3881440109,
+            27696561,   1543391016, 418718665,  2205534017, 119918142,  141376763,  1141585846,
+            2106928241, 4008254940, 3455427366, 2851270785, 1865262609, 1612962171, 1486399129,
+            1188901781, 27671370,   3658422179, 9440259,    110668192,  1030002803, 1199580753,
+            2409079373, 1157535180, 2687487570, 933844486,  727882363,  3200503423, 367166777,
+            1761082924, 2329663979, 3422420249, 246931525,  352675591,  3779360833, 3098718564,
+            2526110051, 1177978725, 1557061870, 559799662,  2397454867, 3478746170, 2323708744,
+            2451233292, 3579803991, 3574008037, 1187420786, 597104495,  2837336674, 124895810,
+            641726218,  906799761,  2450875552, 2606539151, 3562295897, 1212909364, 4011150742,
+            4106540031, 2396461493, 626625853,  3038180512, 4039273811, 1652416553, 778402932,
+            1301638858, 3230497751, 3892615952, 8356881,    2130889105, 783861102,  1959253749,
+            2806954269, 3455092539, 2780453160, 4112205303, 2815611745, 3007147199, 1180835452,
+            2748035792, 1715190659, 1409134140, 480339278,  1102252203, 2035225266, 70826319,
+            1606609302, 3432980367, 780096705,  701576256,  1312068772, 2266852762, 3137596177,
+            1943390238, 196136572,  1293987915, 2772329269, 4008433904, 3412333806, 2110488974,
+            2981412996, 91159803,   3088361618, 3060592279, 4255802347, 1436981275, 2172647940,
+            797979669,  3364243132, 2784886855, 401557252,  3290046664, 3431419618, 3495328143,
+            37905543,   393811633,  3729092557, 3887037145, 3603615652, 3844619852, 4149288842,
+            1945259134, 3673231116, 3835801962, 2415080888, 4026813871, 2950324021, 2244985682,
+            2836956330, 3314048376, 2023831757, 2477577559, 403777410,  3778562579, 1565340808,
+            4143635428, 1301954312, 4048482412, 94916305,   3614710390, 2814336413, 4083871763,
+            3490461550, 1471272376, 1886048165, 1998645021, 908930301,  1954782901, 1880379257,
+            2238418559, 2544335881, 776922778,  3655114268, 4211081995, 2726702480, 3027986258,
+            2120014575, 380117007,  2063082726, 524840787,  443960823,  1863611762, 3109690452,
+            1166130361, 3681123819, 967807832,  3161689670, 2710743500, 1783916296, 4250369426,
+            2416864682, 1137851399, 86872920,   4096393511, 1997830327, 3162797311, 3358417322,
+            3480139256, 2774511565, 1487276186, 202608246,  823425611,  4252843356, 3306587770,
+            4197698938, 2231323315, 449112500,  3282825791, 3540528428, 281820233,  1539207429,
+            2332691577, 1492476670, 3960725377, 2880689459, 1706310755, 1100933063, 1805066623,
+            670478580,  1411746543, 3385459840, 4044218212, 2146147703, 2964515149, 976359941,
+            2821244937, 4005973389, 1002521960, 2097667866, 1586546805, 4153317911, 1495578476,
+            2132492390, 1226304247, 3674377815, 1079914456, 2461759452, 3673223400, 904248702,
+            3240193665, 1341552436,
+        },
+        {
+            2972868776, 1453324679, 2301414336, 1497689072, 3825875344, 1676335040, 3707167868,
+            155682751,  3080397502, 2487224200, 1119615662, 1280050958, 2710404189, 950970239,
+            1511114432, 3235057513, 1046354424, 298201170,  1794772594, 4292129362, 4251164695,
+            1936537579, 3557124510, 4223370834, 2346965182, 2892188496, 591714040,  308459591,
+            2348853654, 2213889636, 1879846904, 3669599205, 4226913692, 3509725689, 127083168,
+            4205534903, 3482437009, 3373568270, 2809568284, 4035113701, 363425408,  1339909364,
+            975232631,  725420981,  723012950,  3124462045, 1806565292, 2216611278, 1221324291,
+            1460078362, 2957167052, 2716432828, 2426023517, 1449996270, 377805826,  3670252930,
+            2351468018, 1149094178, 4147588768, 2000740833, 2818282108, 3232606695, 764342280,
+            1457765681, 2784236562, 2544247397, 653559961,  3357827322, 3358228125, 685026168,
+            2990040780, 2000139787, 3309565934, 56871197,   162068466,  857439714,  1815074730,
+            3160001601, 3740792752, 937088729,  3153808277, 330312294,  3163834583, 3980779799,
+            2542943826, 3764577660, 1476930917, 4255501769, 4124037264, 54264787,   4254679960,
+            238763159,  3381732956, 1547206533, 2284541334, 2942463799, 1264045393, 3015380824,
+            2879524865, 2427844832, 2976753968, 1220022287, 3206123937, 1800800965, 479722359,
+            1039644858, 3250604634, 1148477546, 893369478,  3461695942, 1432783985, 2553517263,
+            1883450314, 1945546377, 3436637860, 81229448,   3990715555, 2339102160, 3004303327,
+            2237985773, 3134110274, 2493023870, 147901422,  855617522,  2957365201, 1613188,
+            3514955906, 1715171361, 436854664,  3293877520, 1087216723, 4272892122, 2722167065,
+            983901937,  3489951876, 1272145389, 158390244,  4076622389, 1373216776, 2397060015,
+            19674797,   682776940,  590690202,  3189331564, 1404837209, 762849177,  2477844424,
+            285731697,  3084835362, 3148239666, 3066641969, 4019858341, 949960663,  419910220,
+            1082973169, 1071448786, 1959924917, 151227002,  1401600035, 255929821,  523443242,
+            2972868776, 1453324679, 2301414336, 1497689072, 942408855,  1676335040, 3707167868,
+            155682751,  3080397502, 1251386619, 1119615662, 1280050958, 2710404189, 950970239,
+            3724866560, 3235057513, 1046354424, 298201170,  1794772594, 2665903184, 4251164695,
+            1936537579, 3557124510, 4223370834, 1360097778, 2892188496, 591714040,  308459591,
+            2348853654, 1456336979, 1879846904, 3669599205, 4226913692, 3509725689, 435605830,
+            4205534903, 3482437009, 3373568270, 2809568284, 3202945214, 363425408,  1339909364,
+            975232631,  725420981,  2803157625, 3124462045, 1806565292, 2216611278, 1221324291,
+            3622673413, 2957167052, 2716432828, 2426023517, 1449996270, 2375711795, 3670252930,
+            2351468018, 1149094178, 4147588768, 2749567678, 2818282108, 3232606695, 764342280,
+            1457765681, 3888560828, 2544247397, 653559961,  3357827322, 3358228125, 3700347204,
+            2990040780, 2000139787, 3309565934, 56871197,   3461888044, 857439714,  1815074730,
+            3160001601, 3740792752, 3080676028, 3153808277, 330312294,  3163834583, 3980779799,
+            3033030228, 3764577660, 1476930917, 4255501769, 4124037264, 247687937,  4254679960,
+            238763159,  3381732956, 1547206533, 2859586419, 2942463799, 1264045393, 3015380824,
+            2879524865, 2558462232, 2976753968, 1220022287, 3206123937, 1800800965, 2046029610,
+            1039644858, 3250604634, 1148477546, 893369478,  2862489481, 1432783985, 2553517263,
+            1883450314, 1945546377, 3466043239, 81229448,   3990715555, 2339102160, 3004303327,
+            2052406270, 3134110274, 2493023870, 147901422,  855617522,  587173215,  1613188,
+            3514955906, 1715171361, 436854664,  4290689404, 1087216723, 4272892122, 2722167065,
+            983901937,  1420954596, 1272145389, 158390244,  4076622389, 1373216776, 88087619,
+            19674797,   682776940,  590690202,  3189331564, 650371392,  762849177,  2477844424,
+            285731697,  3084835362, 1404782966, 3066641969, 4019858341, 949960663,  419910220,
+            699612616,  1071448786, 1959924917, 151227002,  1401600035, 4263167296, 523443242,
+            2972868776, 1453324679, 2301414336, 3537255283, 942408855,  1676335040, 3707167868,
+            155682751,  1726583256, 1251386619, 1119615662, 1280050958, 2710404189, 687284565,
+            3724866560, 3235057513, 1046354424, 298201170,  786441424,  2665903184, 4251164695,
+            1936537579, 3557124510, 1969268198, 1360097778, 2892188496, 591714040,  308459591,
+            1762360444, 1456336979, 1879846904, 3669599205, 4226913692, 2295492466, 435605830,
+            4205534903, 3482437009, 3373568270, 3198579416, 3202945214, 363425408,  1339909364,
+            975232631,  1676428316, 2803157625, 3124462045, 1806565292, 2216611278, 1365842561,
+            3622673413, 2957167052, 2716432828, 2426023517, 2409093656, 2375711795, 3670252930,
+            2351468018, 1149094178, 2986454854, 2749567678, 2818282108, 3232606695, 764342280,
+            2869324337, 3888560828, 2544247397, 653559961,  3357827322, 1799081153, 3700347204,
+            2990040780, 2000139787, 3309565934, 2106396953, 3461888044, 857439714,  1815074730,
+            3160001601, 1822786368, 3080676028, 3153808277, 330312294,  3163834583, 2497406713,
+            3033030228, 3764577660, 1476930917, 4255501769, 3387787667, 247687937,  4254679960,
+            238763159,  3381732956, 3564707385, 2859586419, 2942463799, 1264045393, 3015380824,
+            440218586,  2558462232, 2976753968, 1220022287, 3206123937, 3677811962, 2046029610,
+            1039644858, 3250604634, 1148477546, 33715668,   2862489481, 1432783985, 2553517263,
+            1883450314, 1660735150, 3466043239, 81229448,   3990715555, 2339102160, 1900922810,
+            2052406270, 3134110274, 2493023870, 147901422,  145305414,  587173215,  1613188,
+            3514955906, 1715171361, 1982685834, 4290689404, 1087216723, 4272892122, 2722167065,
+            2947770953, 1420954596, 1272145389, 158390244,  4076622389, 2064736194, 88087619,
+            19674797,   682776940,  590690202,  1910793470, 650371392,  762849177,  2477844424,
+            285731697,  2041866977, 1404782966, 3066641969, 4019858341, 949960663,  1389968454,
+            699612616,  1071448786, 1959924917, 151227002,  3177401124, 4263167296, 523443242,
+            2972868776, 1453324679, 191803393,  3537255283, 942408855,  1676335040, 3707167868,
+            523499710,  1726583256, 1251386619, 1119615662, 1280050958, 2655443757, 687284565,
+            3724866560, 3235057513, 1046354424, 1779597225, 786441424,  2665903184, 4251164695,
+            1936537579, 64120507,   1969268198, 1360097778, 2892188496, 591714040,  2903331628,
+            1762360444, 1456336979, 1879846904, 3669599205, 1147930107, 2295492466, 435605830,
+            4205534903, 3482437009, 1612638465, 3198579416, 3202945214, 363425408,  1339909364,
+            1009757362, 1676428316, 2803157625, 3124462045, 1806565292, 3508206259, 1365842561,
+            3622673413, 2957167052, 2716432828, 3413073642, 2409093656, 2375711795, 3670252930,
+            2351468018, 2183175057, 2986454854, 2749567678, 2818282108, 3232606695, 1724271681,
+            2869324337, 3888560828, 2544247397, 653559961,  2572241980, 1799081153, 3700347204,
+            2990040780, 2000139787, 3254314654, 2106396953, 3461888044, 857439714,  1815074730,
+            2773364825, 1822786368, 3080676028, 3153808277, 330312294,  444328005,  2497406713,
+            3033030228, 3764577660, 1476930917, 446731380,  3387787667, 247687937,  4254679960,
+            238763159,  4195140204, 3564707385, 2859586419, 2942463799, 1264045393, 4024828151,
+            440218586,  2558462232, 2976753968, 1220022287, 1819496767, 3677811962, 2046029610,
+            1039644858, 3250604634, 766263574,  33715668,   2862489481, 1432783985, 2553517263,
+            3102115585, 1660735150, 3466043239, 81229448,   3990715555, 2533351871, 1900922810,
+            2052406270, 3134110274, 2493023870, 3075421012, 145305414,  587173215,  1613188,
+            3514955906, 3176938113, 1982685834, 4290689404, 1087216723, 4272892122, 798560780,
+            2947770953, 1420954596, 1272145389, 158390244,  2866055869, 2064736194, 88087619,
+            19674797,   682776940,  3105942201, 1910793470, 650371392,  762849177,  2477844424,
+            489207783,  2041866977, 1404782966, 3066641969, 4019858341, 3654927249, 1389968454,
+            699612616,  1071448786, 1959924917, 234239209,  3480311250, 1313966415, 1298642215,
+            351736890,  1533660526, 1180540434, 387277503,  2842528951, 400407852,  2275354898,
+            1327110573, 2693677057, 1026394943, 1252877428, 2639058843, 1740353072, 3244559502,
+            2201384047, 1152740269, 2145659423, 2134514141, 470097986,  3902980533, 175272018,
+            375055229,  2208221150, 2253712031, 3713721947, 2012869859, 3619080193, 2306721908,
+            3610603461, 893064677,  202597812,  1689363078, 2385019883, 2622917857, 122687659,
+            3139995055, 1791773803, 1306467663, 1782683047, 531829232,  1953321827, 2518041112,
+            1890224295, 169835830,  113269224,  1754231854, 4089860953, 927194061,  3032713843,
+            1227120553, 1029863078, 2935301270, 2594988152, 2196786444, 1188285363, 4223648008,
+            1192081445, 2570648112, 3407582441, 2121739283, 2575938391, 3667093005, 425308557,
+            2882268839, 3564416027, 938396398,  362770983,  3538504511, 705317343,  3288654019,
+            647387981,  4281735684, 2546726764, 1236925068, 1739560761, 3087805351, 1544935812,
+            3760374175, 378513988,  1074072888, 2741364451, 2769066945, 429143323,  2558130176,
+            1950106768, 1816192747, 1579644196, 2480459297, 847280216,  1353375042, 794554665,
+            2835680246, 2751405305, 3763230105, 3971531132, 2917255253, 427370562,  2584275099,
+            3776300480, 1486594126, 4175410297, 2799912607, 355904482,  1485693636, 4162733831,
+            148276358,  3613339505, 1756708842, 1827261979, 2187882483, 561501872,  4042708323,
+            2546489177, 2793883542, 3996870174, 277320476,  1821884462, 1629494913, 569470102,
+            287948039,  3828019561, 3752246338, 2525871580, 3646966505, 3443489595, 3712269170,
+            2454081933, 106857509,  1142931041, 4135138610, 2832716344, 3755476283, 1404296801,
+            2251013871, 4201350026, 2969169198, 2605203216, 832353709,  1250814575, 1338897964,
+            1323417729, 4267979466, 1195694195, 916503693,  274947533,  1025210964, 692383529,
+            879515854,  1306014255, 509836121,  2829731176, 2750597462, 2049641159, 686962305,
+            21039945,   1050413467,
+        },
+        {
+            3260991747, 2008049313, 221559352,  996702586,  666541051,  2826809995, 3302494401,
+            1585356992, 1168815454, 1158607537, 3042995898, 3681901968, 638173843,  3159367032,
+            2763654802, 2218666018, 1384935240, 8954650,    3488769776, 1198564174, 795529809,
+            2366558984, 3688104582, 387867294,  2245121172, 403044700,  1673885573, 2332232685,
+            4004722370, 3375088805, 4194033760, 3006079994, 2163920349, 551888978,  3096824588,
+            392732545,  2015723930, 1893969457, 2234980301, 772928732,  2750591897, 2111776192,
+            1813490288, 4144417715, 922521498,  4293851532, 4158598211, 4182338167, 1979844654,
+            4196081666, 1634650710, 1827934261, 3760325973, 2882354348, 405785764,  879292285,
+            2950716571, 2869924178, 2794079069, 2209132615, 2158115842, 3409247802, 2489943888,
+            426284036,  1079373269, 120558253,  3870030181, 45752797,   948329283,  3415726035,
+            1421232605, 1118342633, 991982460,  3139951699, 12135483,   3173630974, 534497874,
+            3684815918, 256975476,  1528207667, 1142704260, 27401611,   2418294382, 464561605,
+            910853074,  3750901445, 3058346928, 102569126,  3010395716, 1426255669, 2660161665,
+            3003382452, 676102187,  2988694666, 2804714434, 3593674216, 3934387353, 2196392752,
+            1688203469, 2908821049, 4236404541, 2269339426, 1207441348, 1705809809, 3918800557,
+            1894767988, 3771892547, 2841815215, 3220837448, 3499908082, 3852887272, 2366771273,
+            938996002,  2570855408, 1787606251, 2242095532, 2746238017, 289817564,  3123893240,
+            2575079607, 180500122,  1642286940, 3920039965, 3882756,    427103974,  2737501911,
+            1895932851, 1090470532, 302231702,  54592018,   1125590404, 2070274065, 3707357474,
+            2399024425, 569589707,  682287643,  1798489814, 3288380910, 235253834,  1622960531,
+            1191358286, 3023725140, 374358906,  1262579013, 1177267757, 553276572,  740016002,
+            2605390562, 2524388517, 3345789155, 3127370669, 531189178,  2366831748, 747813761,
+            689032781,  4051816805, 4290627168, 559313987,  1596388738, 3822315665, 3035687244,
+            3260991747, 2008049313, 221559352,  996702586,  939789649,  2826809995, 3302494401,
+            1585356992, 1168815454, 1548464082, 3042995898, 3681901968, 638173843,  3159367032,
+            3903879287, 2218666018, 1384935240, 8954650,    3488769776, 2169112711, 795529809,
+            2366558984, 3688104582, 387867294,  1350083227, 403044700,  1673885573, 2332232685,
+            4004722370, 1746413602, 4194033760, 3006079994, 2163920349, 551888978,  2325175756,
+            392732545,  2015723930, 1893969457, 2234980301, 3210442553, 2750591897, 2111776192,
+            1813490288, 4144417715, 2236011258, 4293851532, 4158598211, 4182338167, 1979844654,
+            68520800,   1634650710, 1827934261, 3760325973, 2882354348, 919405304,  879292285,
+            2950716571, 2869924178, 2794079069, 2649328140, 2158115842, 3409247802, 2489943888,
+            426284036,  3988578176, 120558253,  3870030181, 45752797,   948329283,  115811744,
+            1421232605, 1118342633, 991982460,  3139951699, 2131713230, 3173630974, 534497874,
+            3684815918, 256975476,  2760699236, 1142704260, 27401611,   2418294382, 464561605,
+            2503091596, 3750901445, 3058346928, 102569126,  3010395716, 388469023,  2660161665,
+            3003382452, 676102187,  2988694666, 2863279439, 3593674216, 3934387353, 2196392752,
+            1688203469, 1534307536, 4236404541, 2269339426, 1207441348, 1705809809, 1795006136,
+            1894767988, 3771892547, 2841815215, 3220837448, 3863076875, 3852887272, 2366771273,
+            938996002,  2570855408, 2860609617, 2242095532, 2746238017, 289817564,  3123893240,
+            192345575,  180500122,  1642286940, 3920039965, 3882756,    364454170,  2737501911,
+            1895932851, 1090470532, 302231702,  863701645,  1125590404, 2070274065, 3707357474,
+            2399024425, 2922082067, 682287643,  1798489814, 3288380910, 235253834,  3111545055,
+            1191358286, 3023725140, 374358906,  1262579013, 3676196456, 553276572,  740016002,
+            2605390562, 2524388517, 2629109189, 3127370669, 531189178,  2366831748, 747813761,
+            4217263806, 4051816805, 4290627168, 559313987,  1596388738, 1329443687, 3035687244,
+            3260991747, 2008049313, 221559352,  2307394056, 939789649,  2826809995, 3302494401,
+            1585356992, 1202263969, 1548464082, 3042995898, 3681901968, 638173843,  2613034232,
+            3903879287, 2218666018, 1384935240, 8954650,    3926379146, 2169112711, 795529809,
+            2366558984, 3688104582, 2529995707, 1350083227, 403044700,  1673885573, 2332232685,
+            2072873617, 1746413602, 4194033760, 3006079994, 2163920349, 1199246202, 2325175756,
+            392732545,  2015723930, 1893969457, 4108387070, 3210442553, 2750591897, 2111776192,
+            1813490288, 3345966470, 2236011258, 4293851532, 4158598211, 4182338167, 4177801094,
+            68520800,   1634650710, 1827934261, 3760325973, 3125084795, 919405304,  879292285,
+            2950716571, 2869924178, 1376407130, 2649328140, 2158115842, 3409247802, 2489943888,
+            208555677,  3988578176, 120558253,  3870030181, 45752797,   3623906436, 115811744,
+            1421232605, 1118342633, 991982460,  774849351,  2131713230, 3173630974, 534497874,
+            3684815918, 2891701300, 2760699236, 1142704260, 27401611,   2418294382, 2518187928,
+            2503091596, 3750901445, 3058346928, 102569126,  142451366,  388469023,  2660161665,
+            3003382452, 676102187,  2678500489, 2863279439, 3593674216, 3934387353, 2196392752,
+            4142958998, 1534307536, 4236404541, 2269339426, 1207441348, 2866288625, 1795006136,
+            1894767988, 3771892547, 2841815215, 2515127437, 3863076875, 3852887272, 2366771273,
+            938996002,  3153283354, 2860609617, 2242095532, 2746238017, 289817564,  3954620332,
+            192345575,  180500122,  1642286940, 3920039965, 979394136,  364454170,  2737501911,
+            1895932851, 1090470532, 2744272926, 863701645,  1125590404, 2070274065, 3707357474,
+            2907808101, 2922082067, 682287643,  1798489814, 3288380910, 3757098692, 3111545055,
+            1191358286, 3023725140, 374358906,  3107377947, 3676196456, 553276572,  740016002,
+            2605390562, 3939579651, 2629109189, 3127370669, 531189178,  2366831748, 764896729,
+            4217263806, 4051816805, 4290627168, 559313987,  3429338630, 1329443687, 3035687244,
+            3260991747, 2008049313, 2536028838, 2307394056, 939789649,  2826809995, 3302494401,
+            4162781867, 1202263969, 1548464082, 3042995898, 3681901968, 3976301298, 2613034232,
+            3903879287, 2218666018, 1384935240, 2820112183, 3926379146, 2169112711, 795529809,
+            2366558984, 2517369632, 2529995707, 1350083227, 403044700,  1673885573, 3422791374,
+            2072873617, 1746413602, 4194033760, 3006079994, 2906334411, 1199246202, 2325175756,
+            392732545,  2015723930, 1343418901, 4108387070, 3210442553, 2750591897, 2111776192,
+            3956670874, 3345966470, 2236011258, 4293851532, 4158598211, 4274153493, 4177801094,
+            68520800,   1634650710, 1827934261, 2339898131, 3125084795, 919405304,  879292285,
+            2950716571, 2237164807, 1376407130, 2649328140, 2158115842, 3409247802, 2921161440,
+            208555677,  3988578176, 120558253,  3870030181, 4066803708, 3623906436, 115811744,
+            1421232605, 1118342633, 329806906,  774849351,  2131713230, 3173630974, 534497874,
+            1630047171, 2891701300, 2760699236, 1142704260, 27401611,   2518940866, 2518187928,
+            2503091596, 3750901445, 3058346928, 3022405486, 142451366,  388469023,  2660161665,
+            3003382452, 1433412281, 2678500489, 2863279439, 3593674216, 3934387353, 3165524733,
+            4142958998, 1534307536, 4236404541, 2269339426, 4238346384, 2866288625, 1795006136,
+            1894767988, 3771892547, 768585867,  2515127437, 3863076875, 3852887272, 2366771273,
+            2889984924, 3153283354, 2860609617, 2242095532, 2746238017, 2766852812, 3954620332,
+            192345575,  180500122,  1642286940, 421197006,  979394136,  364454170,  2737501911,
+            1895932851, 206885675,  2744272926, 863701645,  1125590404, 2070274065, 160534944,
+            2907808101, 2922082067, 682287643,  1798489814, 1280312093, 3757098692, 3111545055,
+            1191358286, 3023725140, 3897279914, 3107377947, 3676196456, 553276572,  740016002,
+            3760043170, 3939579651, 2629109189, 3127370669, 531189178,  3602760491, 764896729,
+            4217263806, 4051816805, 4290627168, 1542808725, 1168030942, 1773982446, 3344077508,
+            563375327,  742720052,  1219102438, 1389669268, 3773303103, 1792853329, 3902608117,
+            383034918,  394141386,  2783378318, 4187651723, 1146628548, 1038737037, 2420538056,
+            652633831,  4118816651, 3524023885, 1663032663, 438217062,  613955352,  3119443329,
+            4089953908, 2482415482, 2318970874, 575241957,  15237658,   106346104,  1174646605,
+            4006824598, 3910986687, 891047928,  2494594491, 907024573,  1578132568, 1465411918,
+            4116476711, 419755053,  2466692795, 3217856249, 2988181704, 946982778,  4131199534,
+            2399314747, 4161368964, 983827875,  1008182302, 2354495483, 3546115914, 1876396299,
+            637223975,  3937202256, 261833165,  796620703,  2212450522, 3043788264, 4282782869,
+            3658528899, 3626707644, 2995513608, 698315819,  3675097354, 2464790671, 2959390009,
+            1206625501, 4183644209, 1785956428, 2714351780, 1166985671, 1312376396, 2923003425,
+            939402554,  2878879041, 383853886,  8312778,    2118286848, 1325901577, 2271477560,
+            950701550,  117249839,  1915797795, 1313985919, 2358275926, 4225851257, 1393173356,
+            2483110608, 2607220305, 371265183,  3552043791, 3873906125, 3446739654, 2810619358,
+            2932958277, 951103923,  20182276,   2355895031, 1814295281, 3739351317, 2450278133,
+            3493935976, 2021481688, 259148641,  3780300013, 1056113549, 1379484720, 3505680964,
+            4041626405, 1907413758, 1026382948, 1018273300, 4101599129, 4287787036, 3272734543,
+            2787502142, 670417596,  914159086,  2802947189, 4030967069, 3032347659, 4082092896,
+            2341302404, 1267556546, 587319280,  3323088972, 3895503052, 1358822421, 2243768681,
+            1632779793, 2490699517, 780734854,  3998055277, 3260037962, 3379934445, 975397784,
+            3137881859, 349095991,  3336019125, 3759442906, 2890172615, 1941196291, 3401721564,
+            2378205586, 4228473714, 339912408,  2910090691, 1986673579, 1452306231, 4185121735,
+            426661733,  4089405542, 1862952355, 3580724750, 4207363797, 746227198,  32366631,
+            4206081689, 187852796,
+        },
+        {
+            2643556981, 3717747824, 3763840229, 2694596507, 2591149657, 1210879141, 2276342449,
+            3609219570, 1161350492, 373145515,  2909264809, 3236868264, 2077698301, 774333976,
+            2765834347, 3788693937, 853784234,  3109014026, 1102278195, 4290636282, 3869599360,
+            3187120816, 2805061862, 2687068695, 2199189578, 614593641,  1204980751, 917714312,
+            2067989245, 2172128121, 3724643168, 3863461739, 1287128351, 49371170,   1593720253,
+            422253740,  50857631,   949080199,  993070857,  1929946618, 3100256245, 2303448179,
+            1545333137, 2442820636, 3739905329, 2876007067, 3280237307, 4114137952, 1124715327,
+            2630734909, 3248703273, 2944884034, 1952313804, 3724707299, 3494898749, 2163124025,
+            2537989451, 430361733,  3994498160, 1248420217, 634668273,  3030974430, 1332338603,
+            2522052563, 2166619050, 3404494333, 3536017119, 431597364,  1777759503, 2234178428,
+            1792234490, 3016676258, 2275105050, 3483001854, 1145691531, 4180865584, 1782975788,
+            236528131,  3013970636, 2283586291, 1400719498, 1433478013, 611458110,  1863912346,
+            3383334379, 384922758,  3080875275, 3494117686, 4215696155, 1599196041, 3719278046,
+            1515660545, 824089732,  1624009888, 2834088314, 517948805,  1655368129, 283787093,
+            3404229407, 3258867785, 1729211136, 812349893,  2956162428, 2085396663, 2215832718,
+            3747858251, 1897324327, 4136808415, 3285547695, 2715459995, 1597801772, 288154238,
+            552370176,  3523750539, 930875404,  1721955397, 3142721149, 4282220693, 1058488152,
+            3134164577, 3915697992, 671134636,  3463353565, 880778783,  3109162672, 2419411287,
+            2857600627, 2381512477, 2934849550, 3723947769, 2811544198, 2851202789, 80055848,
+            3172860550, 792228171,  317455199,  1547690028, 2725838589, 2670403408, 578765958,
+            3908339171, 4058492808, 3884429068, 3278791431, 2695436760, 1092371408, 4043220374,
+            4103591262, 2504937778, 3141628490, 781211427,  707394329,  1904145820, 1713462924,
+            2906373407, 1000310749, 1461633606, 170188787,  3950443816, 3501831061, 3637755864,
+            2643556981, 3717747824, 3763840229, 2694596507, 3433856398, 1210879141, 2276342449,
+            3609219570, 1161350492, 3764498155, 2909264809, 3236868264, 2077698301, 774333976,
+            2081626860, 3788693937, 853784234,  3109014026, 1102278195, 3588309321, 3869599360,
+            3187120816, 2805061862, 2687068695, 4214496015, 614593641,  1204980751, 917714312,
+            2067989245, 3958669841, 3724643168, 3863461739, 1287128351, 49371170,   1194080299,
+            422253740,  50857631,   949080199,  993070857,  4056039350, 3100256245, 2303448179,
+            1545333137, 2442820636, 2218386290, 2876007067, 3280237307, 4114137952, 1124715327,
+            2229636834, 3248703273, 2944884034, 1952313804, 3724707299, 818501638,  2163124025,
+            2537989451, 430361733,  3994498160, 667871827,  634668273,  3030974430, 1332338603,
+            2522052563, 3951803220, 3404494333, 3536017119, 431597364,  1777759503, 3944139881,
+            1792234490, 3016676258, 2275105050, 3483001854, 3427553211, 4180865584, 1782975788,
+            236528131,  3013970636, 1031805862, 1400719498, 1433478013, 611458110,  1863912346,
+            3223758514, 384922758,  3080875275, 3494117686, 4215696155, 1445472402, 3719278046,
+            1515660545, 824089732,  1624009888, 2980451031, 517948805,  1655368129, 283787093,
+            3404229407, 275359993,  1729211136, 812349893,  2956162428, 2085396663, 1002848410,
+            3747858251, 1897324327, 4136808415, 3285547695, 1458069902, 1597801772, 288154238,
+            552370176,  3523750539, 623749612,  1721955397, 3142721149, 4282220693, 1058488152,
+            1391470225, 3915697992, 671134636,  3463353565, 880778783,  1870011739, 2419411287,
+            2857600627, 2381512477, 2934849550, 4278021603, 2811544198, 2851202789, 80055848,
+            3172860550, 930904936,  317455199,  1547690028, 2725838589, 2670403408, 4040535342,
+            3908339171, 4058492808, 3884429068, 3278791431, 3978195722, 1092371408, 4043220374,
+            4103591262, 2504937778, 3047005844, 781211427,  707394329,  1904145820, 1713462924,
+            1665966883, 1000310749, 1461633606, 170188787,  3950443816, 817842504,  3637755864,
+            2643556981, 3717747824, 3763840229, 1288044232, 3433856398, 1210879141, 2276342449,
+            3609219570, 2248264726, 3764498155, 2909264809, 3236868264, 2077698301, 3811782764,
+            2081626860, 3788693937, 853784234,  3109014026, 3919214092, 3588309321, 3869599360,
+            3187120816, 2805061862, 3618361622, 4214496015, 614593641,  1204980751, 917714312,
+            1707762531, 3958669841, 3724643168, 3863461739, 1287128351, 1643079816, 1194080299,
+            422253740,  50857631,   949080199,  3381185014, 4056039350, 3100256245, 2303448179,
+            1545333137, 1329956923, 2218386290, 2876007067, 3280237307, 4114137952, 1219135022,
+            2229636834, 3248703273, 2944884034, 1952313804, 3819170518, 818501638,  2163124025,
+            2537989451, 430361733,  501497397,  667871827,  634668273,  3030974430, 1332338603,
+            1269163659, 3951803220, 3404494333, 3536017119, 431597364,  367649125,  3944139881,
+            1792234490, 3016676258, 2275105050, 985112507,  3427553211, 4180865584, 1782975788,
+            236528131,  3383562191, 1031805862, 1400719498, 1433478013, 611458110,  497750985,
+            3223758514, 384922758,  3080875275, 3494117686, 857818703,  1445472402, 3719278046,
+            1515660545, 824089732,  2518231661, 2980451031, 517948805,  1655368129, 283787093,
+            2645338932, 275359993,  1729211136, 812349893,  2956162428, 981829120,  1002848410,
+            3747858251, 1897324327, 4136808415, 2307206452, 1458069902, 1597801772, 288154238,
+            552370176,  3633128611, 623749612,  1721955397, 3142721149, 4282220693, 165662375,
+            1391470225, 3915697992, 671134636,  3463353565, 1161913086, 1870011739, 2419411287,
+            2857600627, 2381512477, 1134092983, 4278021603, 2811544198, 2851202789, 80055848,
+            3349362652, 930904936,  317455199,  1547690028, 2725838589, 4128082379, 4040535342,
+            3908339171, 4058492808, 3884429068, 528706053,  3978195722, 1092371408, 4043220374,
+            4103591262, 3435118143, 3047005844, 781211427,  707394329,  1904145820, 846132961,
+            1665966883, 1000310749, 1461633606, 170188787,  2198310595, 817842504,  3637755864,
+            2643556981, 3717747824, 508100670,  1288044232, 3433856398, 1210879141, 2276342449,
+            3159911273, 2248264726, 3764498155, 2909264809, 3236868264, 2087240362, 3811782764,
+            2081626860, 3788693937, 853784234,  1457378242, 3919214092, 3588309321, 3869599360,
+            3187120816, 90237988,   3618361622, 4214496015, 614593641,  1204980751, 2637182512,
+            1707762531, 3958669841, 3724643168, 3863461739, 3421892320, 1643079816, 1194080299,
+            422253740,  50857631,   4286203815, 3381185014, 4056039350, 3100256245, 2303448179,
+            3360120139, 1329956923, 2218386290, 2876007067, 3280237307, 414651208,  1219135022,
+            2229636834, 3248703273, 2944884034, 1201567368, 3819170518, 818501638,  2163124025,
+            2537989451, 1942510697, 501497397,  667871827,  634668273,  3030974430, 2186361505,
+            1269163659, 3951803220, 3404494333, 3536017119, 3403648160, 367649125,  3944139881,
+            1792234490, 3016676258, 1430537681, 985112507,  3427553211, 4180865584, 1782975788,
+            457127230,  3383562191, 1031805862, 1400719498, 1433478013, 3318528713, 497750985,
+            3223758514, 384922758,  3080875275, 2638707004, 857818703,  1445472402, 3719278046,
+            1515660545, 970042672,  2518231661, 2980451031, 517948805,  1655368129, 2823333420,
+            2645338932, 275359993,  1729211136, 812349893,  2760297781, 981829120,  1002848410,
+            3747858251, 1897324327, 415772834,  2307206452, 1458069902, 1597801772, 288154238,
+            2352471840, 3633128611, 623749612,  1721955397, 3142721149, 673799283,  165662375,
+            1391470225, 3915697992, 671134636,  2875144968, 1161913086, 1870011739, 2419411287,
+            2857600627, 3625870499, 1134092983, 4278021603, 2811544198, 2851202789, 3698692108,
+            3349362652, 930904936,  317455199,  1547690028, 107811632,  4128082379, 4040535342,
+            3908339171, 4058492808, 122953546,  528706053,  3978195722, 1092371408, 4043220374,
+            2318738025, 3435118143, 3047005844, 781211427,  707394329,  3495633046, 846132961,
+            1665966883, 1000310749, 1461633606, 3966866980, 1896515777, 4062686143, 3074930675,
+            3338132452, 837403220,  2438802468, 1388047396, 758544810,  881171733,  3058170085,
+            1182629334, 394469752,  990627329,  2936744090, 2872122429, 3724407246, 2570584315,
+            94453811,   1045747573, 511479846,  3012717110, 2645795732, 3961591394, 3411279559,
+            3204312654, 2401451720, 3005343744, 1369401370, 2302885026, 1281551962, 3623850168,
+            3437840786, 963065138,  2619748972, 178532185,  2817966425, 3767163428, 3660019447,
+            1437150380, 4214434258, 3350970286, 2759062719, 3252129317, 585935537,  884882594,
+            3953723358, 428514069,  4236091601, 1613166664, 112019666,  2128394825, 511377073,
+            2067827774, 3316279295, 1722220768, 647230453,  2105611512, 2527416055, 1099801038,
+            3287470555, 2856354535, 2489730348, 1542521697, 3917568905, 391145015,  3177583856,
+            1640945846, 926366210,  2337874661, 1623646675, 671924950,  3789552749, 2135534824,
+            4230679960, 128615837,  3098611163, 3689742857, 1472612352, 244316355,  444206933,
+            599980542,  3898190878, 2544114713, 967829945,  677857382,  2534222541, 3178387936,
+            1988259098, 1356724289, 2182459301, 3694845918, 1971363052, 3920753290, 4167557323,
+            3932147095, 1508610153, 1080493490, 2692432627, 2289691666, 579322773,  37116463,
+            1115532193, 4252417322, 3936497005, 2057754722, 936665316,  198611528,  816767453,
+            3707651994, 3278375239, 2593850749, 3390654196, 3430530975, 999843173,  2321936590,
+            2408955830, 1371166102, 920513380,  2490133495, 2298036118, 3722926778, 2942484082,
+            1891973959, 3827563141, 3925112243, 109540524,  12464911,   859005196,  316871689,
+            1094401176, 3641142973, 1351129317, 2833080278, 3162286356, 2311557208, 111332995,
+            1112151838, 3289609430, 76624906,   2100771167, 2069506671, 2371330980, 2105675402,
+            2507574121, 1143749143, 1131947357, 1559973720, 2984590418, 4042882946, 1075984006,
+            3390510319, 111717072,  3006608452, 2644861799, 1393610455, 2202791489, 2971998368,
+            3530144643, 3925228638,
+        },
+        {
+            3153603485, 1371519385, 3897278605, 4175168453, 174509874,  873608047,  3640196768,
+            3789488216, 2450553037, 70029034,   1972684973, 1488354167, 219405702,  1882227474,
+            684795781,  4065244859, 354869827,  4214700304, 1458400434, 481186134,  1648892885,
+            1941131840, 2129879925, 693559626,  3023790315, 3107224231, 3625482333, 1039310651,
+            3620536306, 1358367234, 442358691,  1902269011, 2227449546, 3848846268, 1009783102,
+            4207605901, 2741922941, 1216650893, 522587111,  1208119027, 936919715,  3567633542,
+            1189412544, 4265583340, 2424190644, 866185630,  3762083936, 2643849860, 3201414059,
+            2241069144, 774675851,  385714334,  1135362459, 2252410713, 3719669345, 1679574708,
+            2354130486, 2534051462, 1842418166, 2731884520, 430992785,  839115378,  3857698045,
+            2214611758, 2910719310, 3928312419, 1309931648, 640155620,  1860998824, 3355936176,
+            4150912912, 1737401972, 808384398,  3019599345, 4227514665, 982969989,  877404728,
+            2312555245, 2758637448, 3395174555, 2099830738, 1988080813, 1258352847, 743574269,
+            1310831410, 776670132,  3334507138, 1082351078, 1516269829, 2439836891, 3532271517,
+            778800970,  2571886934, 1789675148, 3725762283, 1620663617, 3188328249, 2977179775,
+            488127190,  2739104376, 1657949440, 354625371,  608799443,  186755272,  3659585081,
+            1495017416, 2364367967, 397802110,  1120059639, 3285844773, 1801630336, 3012304678,
+            889733271,  3237574215, 706782340,  3807095583, 3569220305, 480236898,  2622456428,
+            1132301787, 2128260058, 2647432483, 2413758461, 1788697014, 2776308036, 2826100389,
+            3013786006, 1843179607, 2107749221, 3698902295, 4101208233, 2174293573, 2361530751,
+            4294194279, 2189629815, 3941044569, 3040777519, 305026740,  3388995181, 4150561365,
+            2898603595, 3496119805, 4136042821, 1318489896, 2871327700, 1856198073, 2829181891,
+            3295475036, 3297279081, 2165197997, 2248527929, 2471171853, 3558792440, 1821494426,
+            3149783162, 389038130,  3183654481, 798153403,  40015023,   478749535,  4002116430,
+            3153603485, 1371519385, 3897278605, 4175168453, 3180060196, 873608047,  3640196768,
+            3789488216, 2450553037, 948355982,  1972684973, 1488354167, 219405702,  1882227474,
+            3591336399, 4065244859, 354869827,  4214700304, 1458400434, 107436646,  1648892885,
+            1941131840, 2129879925, 693559626,  2344405866, 3107224231, 3625482333, 1039310651,
+            3620536306, 1648273048, 442358691,  1902269011, 2227449546, 3848846268, 2969342543,
+            4207605901, 2741922941, 1216650893, 522587111,  1670089567, 936919715,  3567633542,
+            1189412544, 4265583340, 1527275774, 866185630,  3762083936, 2643849860, 3201414059,
+            3721813173, 774675851,  385714334,  1135362459, 2252410713, 224031709,  1679574708,
+            2354130486, 2534051462, 1842418166, 3773634048, 430992785,  839115378,  3857698045,
+            2214611758, 894268917,  3928312419, 1309931648, 640155620,  1860998824, 611414581,
+            4150912912, 1737401972, 808384398,  3019599345, 3548183444, 982969989,  877404728,
+            2312555245, 2758637448, 2976641425, 2099830738, 1988080813, 1258352847, 743574269,
+            791963959,  776670132,  3334507138, 1082351078, 1516269829, 3303876123, 3532271517,
+            778800970,  2571886934, 1789675148, 787812509,  1620663617, 3188328249, 2977179775,
+            488127190,  3879243123, 1657949440, 354625371,  608799443,  186755272,  3065814194,
+            1495017416, 2364367967, 397802110,  1120059639, 2210951659, 1801630336, 3012304678,
+            889733271,  3237574215, 3345057422, 3807095583, 3569220305, 480236898,  2622456428,
+            3839398413, 2128260058, 2647432483, 2413758461, 1788697014, 553757362,  2826100389,
+            3013786006, 1843179607, 2107749221, 1743369258, 4101208233, 2174293573, 2361530751,
+            4294194279, 3017174303, 3941044569, 3040777519, 305026740,  3388995181, 3385301776,
+            2898603595, 3496119805, 4136042821, 1318489896, 3377847055, 1856198073, 2829181891,
+            3295475036, 3297279081, 135600725,  2248527929, 2471171853, 3558792440, 1821494426,
+            3752556202, 389038130,  3183654481, 798153403,  40015023,   2773200373, 4002116430,
+            3153603485, 1371519385, 3897278605, 779555011,  3180060196, 873608047,  3640196768,
+            3789488216, 2057489957, 948355982,  1972684973, 1488354167, 219405702,  142148429,
+            3591336399, 4065244859, 354869827,  4214700304, 3119650436, 107436646,  1648892885,
+            1941131840, 2129879925, 3664291603, 2344405866, 3107224231, 3625482333, 1039310651,
+            474488983,  1648273048, 442358691,  1902269011, 2227449546, 1574061549, 2969342543,
+            4207605901, 2741922941, 1216650893, 1532680581, 1670089567, 936919715,  3567633542,
+            1189412544, 1207184430, 1527275774, 866185630,  3762083936, 2643849860, 1142886029,
+            3721813173, 774675851,  385714334,  1135362459, 2909946474, 224031709,  1679574708,
+            2354130486, 2534051462, 3717477716, 3773634048, 430992785,  839115378,  3857698045,
+            504762031,  894268917,  3928312419, 1309931648, 640155620,  1723354427, 611414581,
+            4150912912, 1737401972, 808384398,  3215199721, 3548183444, 982969989,  877404728,
+            2312555245, 1539693415, 2976641425, 2099830738, 1988080813, 1258352847, 3250776916,
+            791963959,  776670132,  3334507138, 1082351078, 687205191,  3303876123, 3532271517,
+            778800970,  2571886934, 1948073017, 787812509,  1620663617, 3188328249, 2977179775,
+            769260513,  3879243123, 1657949440, 354625371,  608799443,  3515222393, 3065814194,
+            1495017416, 2364367967, 397802110,  2968077439, 2210951659, 1801630336, 3012304678,
+            889733271,  897947976,  3345057422, 3807095583, 3569220305, 480236898,  3323254260,
+            3839398413, 2128260058, 2647432483, 2413758461, 1354586061, 553757362,  2826100389,
+            3013786006, 1843179607, 2000547103, 1743369258, 4101208233, 2174293573, 2361530751,
+            1186766534, 3017174303, 3941044569, 3040777519, 305026740,  2508152438, 3385301776,
+            2898603595, 3496119805, 4136042821, 830959548,  3377847055, 1856198073, 2829181891,
+            3295475036, 1182909517, 135600725,  2248527929, 2471171853, 3558792440, 1526130149,
+            3752556202, 389038130,  3183654481, 798153403,  2120362703, 2773200373, 4002116430,
+            3153603485, 1371519385, 3173827445, 779555011,  3180060196, 873608047,  3640196768,
+            2446154035, 2057489957, 948355982,  1972684973, 1488354167, 1984185387, 142148429,
+            3591336399, 4065244859, 354869827,  400189763,  3119650436, 107436646,  1648892885,
+            1941131840, 699826664,  3664291603, 2344405866, 3107224231, 3625482333, 1308529542,
+            474488983,  1648273048, 442358691,  1902269011, 2429128490, 1574061549, 2969342543,
+            4207605901, 2741922941, 2470068610, 1532680581, 1670089567, 936919715,  3567633542,
+            3998188826, 1207184430, 1527275774, 866185630,  3762083936, 3724974550, 1142886029,
+            3721813173, 774675851,  385714334,  2443981375, 2909946474, 224031709,  1679574708,
+            2354130486, 2398268539, 3717477716, 3773634048, 430992785,  839115378,  1623956912,
+            504762031,  894268917,  3928312419, 1309931648, 3512831506, 1723354427, 611414581,
+            4150912912, 1737401972, 1184063849, 3215199721, 3548183444, 982969989,  877404728,
+            4104756519, 1539693415, 2976641425, 2099830738, 1988080813, 1258754405, 3250776916,
+            791963959,  776670132,  3334507138, 4086521360, 687205191,  3303876123, 3532271517,
+            778800970,  1217504104, 1948073017, 787812509,  1620663617, 3188328249, 734411146,
+            769260513,  3879243123, 1657949440, 354625371,  1013118041, 3515222393, 3065814194,
+            1495017416, 2364367967, 2010073356, 2968077439, 2210951659, 1801630336, 3012304678,
+            1735839019, 897947976,  3345057422, 3807095583, 3569220305, 1372048098, 3323254260,
+            3839398413, 2128260058, 2647432483, 2198821350, 1354586061, 553757362,  2826100389,
+            3013786006, 3277960237, 2000547103, 1743369258, 4101208233, 2174293573, 2411282206,
+            1186766534, 3017174303, 3941044569, 3040777519, 3573917471, 2508152438, 3385301776,
+            2898603595, 3496119805, 2196928635, 830959548,  3377847055, 1856198073, 2829181891,
+            662485206,  1182909517, 135600725,  2248527929, 2471171853, 937339975,  1526130149,
+            3752556202, 389038130,  3183654481, 3146566220, 871543803,  1399802211, 3361119470,
+            2408013134, 3929240533, 3686364022, 2880653990, 3257947100, 2626093778, 852200821,
+            979792686,  966996587,  3323780406, 2438505028, 1002590107, 3745410597, 2974790332,
+            3836425601, 2659822983, 4129051512, 3319158637, 1974642371, 4230605373, 377119768,
+            2359739350, 1585260819, 3557345118, 1789223521, 1632117472, 2573248360, 2036830048,
+            3342413011, 584103903,  263712079,  2461558165, 1711857620, 2213279474, 2288791229,
+            2733334196, 605056342,  160884522,  2415662744, 2283509232, 1220074282, 4218252077,
+            1344096606, 890334805,  3000580646, 1007403832, 2918824846, 2719384356, 2279030164,
+            926581043,  1263867253, 1685665131, 3090246859, 3145419264, 3494742148, 1474363949,
+            3200044030, 3710920759, 1684801591, 4152036473, 672459811,  1161799529, 586681125,
+            3703583885, 3178367104, 1851439562, 3521749372, 1641984061, 1832640530, 1380125133,
+            673489017,  1306815391, 2922931361, 1718399321, 3820014621, 1978172597, 3984478130,
+            1690834260, 1945768526, 3336539595, 7940929,    118239740,  3761123591, 1426016760,
+            957217577,  1462286325, 1633066835, 1784487188, 453614570,  2366524964, 3413179009,
+            2773446231, 2012272657, 1453360848, 2899224109, 2305030880, 2099234753, 1291312253,
+            72248852,   3146676568, 193946719,  2888110494, 1964217259, 1120328678, 1080969064,
+            3206198103, 4170767447, 1503751609, 1391129557, 2499058488, 308375251,  2586711342,
+            1431134968, 3566940256, 1161036172, 3155195775, 439231030,  1700809096, 1492687423,
+            3537063943, 188561656,  3847517804, 3864215860, 3021209660, 2791887863, 4096962340,
+            3606509794, 3148012051, 1171659014, 3992405867, 3730427856, 2819996413, 3025390544,
+            1456387938, 466607596,  3495181710, 780771676,  4220257859, 1861441589, 2805252901,
+            200404334,  2148036286, 49944261,   863861113,  4196967030, 2492200911, 2922747612,
+            2303274506, 3486050887, 3353210898, 1104683051, 2482982451, 2753684084, 4275505041,
+            561803579,  910962953,
+        },
+        {
+            2703572377, 1826671106, 1758375892, 541236644,  3352736214, 111437063,  3634119187,
+            3860933048, 83095447,   2585207315, 1067962858, 3844735990, 2243470535, 2943238890,
+            3616734078, 543562666,  2349287037, 3972856042, 528551248,  4259976946, 2992168300,
+            1659842964, 1498139559, 2962254699, 1360697431, 1573769753, 3276235458, 1683008165,
+            1928441411, 4137362934, 1514902521, 3838428602, 3787843367, 95072852,   2445101966,
+            4269216729, 3106719562, 1304951776, 1423377429, 219986635,  215529944,  4175689857,
+            3279713872, 1993821688, 1118731804, 2630982101, 2310502661, 2418639501, 3971232313,
+            600388583,  3141067325, 2084555420, 3919423388, 882638982,  2232856252, 310425438,
+            4066706035, 2619982570, 2329504712, 1725775392, 3433742837, 4257029836, 3760582383,
+            1349459142, 249690399,  3475983153, 468550883,  2482158239, 1880790697, 637267833,
+            835991176,  1180341781, 1047506879, 4265527450, 3602968952, 1123900689, 1442949438,
+            3773548126, 1872206401, 2926657752, 456830562,  2567179147, 945819111,  772456466,
+            1151524047, 4141869734, 4095453753, 1087878147, 828165102,  2051167877, 3629998129,
+            2798818620, 1595155046, 2688973509, 1514191779, 3919077628, 3867681816, 136034252,
+            3719501425, 3069091253, 1254528486, 2775966313, 573202898,  3181618004, 4076727715,
+            1828672058, 486195008,  2525801890, 1179921298, 2396529061, 2791919708, 1849947344,
+            1114337246, 2534230467, 1257617022, 1022492727, 890027397,  1956710932, 246435123,
+            2536975768, 2241469151, 3813123616, 1756066227, 2804146885, 3501935744, 3937277734,
+            407774172,  1647740376, 3533794929, 470509296,  2710010631, 439672051,  2194683800,
+            1604152575, 2213346442, 2412895212, 1500748467, 1808646621, 1897714523, 1423917376,
+            2920865012, 735002828,  209415583,  2864529693, 320745770,  4082181435, 1471485592,
+            1918853330, 3206704710, 1123659512, 4085102275, 3311744307, 2004930362, 1355764722,
+            3850800120, 2797313305, 1976464694, 2860596395, 2811159483, 3548022784, 1307537805,
+            2703572377, 1826671106, 1758375892, 541236644,  2512906714, 111437063,  3634119187,
+            3860933048, 83095447,   1654679770, 1067962858, 3844735990, 2243470535, 2943238890,
+            3353279309, 543562666,  2349287037, 3972856042, 528551248,  2248500730, 2992168300,
+            1659842964, 1498139559, 2962254699, 3022407849, 1573769753, 3276235458, 1683008165,
+            1928441411, 2636345234, 1514902521, 3838428602, 3787843367, 95072852,   260815773,
+            4269216729, 3106719562, 1304951776, 1423377429, 4120660400, 215529944,  4175689857,
+            3279713872, 1993821688, 52605597,   2630982101, 2310502661, 2418639501, 3971232313,
+            1179834311, 3141067325, 2084555420, 3919423388, 882638982,  4283976266, 310425438,
+            4066706035, 2619982570, 2329504712, 968614073,  3433742837, 4257029836, 3760582383,
+            1349459142, 4030028031, 3475983153, 468550883,  2482158239, 1880790697, 1382760498,
+            835991176,  1180341781, 1047506879, 4265527450, 324909907,  1123900689, 1442949438,
+            3773548126, 1872206401, 2908122998, 456830562,  2567179147, 945819111,  772456466,
+            996879262,  4141869734, 4095453753, 1087878147, 828165102,  2284472642, 3629998129,
+            2798818620, 1595155046, 2688973509, 1931248911, 3919077628, 3867681816, 136034252,
+            3719501425, 2779783460, 1254528486, 2775966313, 573202898,  3181618004, 3069919579,
+            1828672058, 486195008,  2525801890, 1179921298, 2054848822, 2791919708, 1849947344,
+            1114337246, 2534230467, 3948179979, 1022492727, 890027397,  1956710932, 246435123,
+            3477995926, 2241469151, 3813123616, 1756066227, 2804146885, 2202344947, 3937277734,
+            407774172,  1647740376, 3533794929, 3604416681, 2710010631, 439672051,  2194683800,
+            1604152575, 375576395,  2412895212, 1500748467, 1808646621, 1897714523, 3250434993,
+            2920865012, 735002828,  209415583,  2864529693, 3364442018, 4082181435, 1471485592,
+            1918853330, 3206704710, 3106110855, 4085102275, 3311744307, 2004930362, 1355764722,
+            90069406,   2797313305, 1976464694, 2860596395, 2811159483, 2592275434, 1307537805,
+            2703572377, 1826671106, 1758375892, 1714620718, 2512906714, 111437063,  3634119187,
+            3860933048, 3931944182, 1654679770, 1067962858, 3844735990, 2243470535, 3724429112,
+            3353279309, 543562666,  2349287037, 3972856042, 4011586746, 2248500730, 2992168300,
+            1659842964, 1498139559, 4062106088, 3022407849, 1573769753, 3276235458, 1683008165,
+            1182000129, 2636345234, 1514902521, 3838428602, 3787843367, 1451504572, 260815773,
+            4269216729, 3106719562, 1304951776, 1741699914, 4120660400, 215529944,  4175689857,
+            3279713872, 581515696,  52605597,   2630982101, 2310502661, 2418639501, 4237441901,
+            1179834311, 3141067325, 2084555420, 3919423388, 1518678322, 4283976266, 310425438,
+            4066706035, 2619982570, 1923439763, 968614073,  3433742837, 4257029836, 3760582383,
+            1553508610, 4030028031, 3475983153, 468550883,  2482158239, 3615972502, 1382760498,
+            835991176,  1180341781, 1047506879, 1728048196, 324909907,  1123900689, 1442949438,
+            3773548126, 1787294211, 2908122998, 456830562,  2567179147, 945819111,  4022333174,
+            996879262,  4141869734, 4095453753, 1087878147, 79700734,   2284472642, 3629998129,
+            2798818620, 1595155046, 1019283830, 1931248911, 3919077628, 3867681816, 136034252,
+            1991732951, 2779783460, 1254528486, 2775966313, 573202898,  3113547370, 3069919579,
+            1828672058, 486195008,  2525801890, 1091342883, 2054848822, 2791919708, 1849947344,
+            1114337246, 3650689819, 3948179979, 1022492727, 890027397,  1956710932, 819853736,
+            3477995926, 2241469151, 3813123616, 1756066227, 1807453817, 2202344947, 3937277734,
+            407774172,  1647740376, 1077405617, 3604416681, 2710010631, 439672051,  2194683800,
+            2979791933, 375576395,  2412895212, 1500748467, 1808646621, 708854744,  3250434993,
+            2920865012, 735002828,  209415583,  1254883034, 3364442018, 4082181435, 1471485592,
+            1918853330, 1003337503, 3106110855, 4085102275, 3311744307, 2004930362, 2081003221,
+            90069406,   2797313305, 1976464694, 2860596395, 1387461698, 2592275434, 1307537805,
+            2703572377, 1826671106, 3183043060, 1714620718, 2512906714, 111437063,  3634119187,
+            349727987,  3931944182, 1654679770, 1067962858, 3844735990, 2139657166, 3724429112,
+            3353279309, 543562666,  2349287037, 252634900,  4011586746, 2248500730, 2992168300,
+            1659842964, 2803440283, 4062106088, 3022407849, 1573769753, 3276235458, 4181712675,
+            1182000129, 2636345234, 1514902521, 3838428602, 672909997,  1451504572, 260815773,
+            4269216729, 3106719562, 1890791884, 1741699914, 4120660400, 215529944,  4175689857,
+            1739961439, 581515696,  52605597,   2630982101, 2310502661, 1030631509, 4237441901,
+            1179834311, 3141067325, 2084555420, 4186984147, 1518678322, 4283976266, 310425438,
+            4066706035, 2600903550, 1923439763, 968614073,  3433742837, 4257029836, 3680773712,
+            1553508610, 4030028031, 3475983153, 468550883,  3321257912, 3615972502, 1382760498,
+            835991176,  1180341781, 1534293504, 1728048196, 324909907,  1123900689, 1442949438,
+            360924304,  1787294211, 2908122998, 456830562,  2567179147, 2400684333, 4022333174,
+            996879262,  4141869734, 4095453753, 1775311559, 79700734,   2284472642, 3629998129,
+            2798818620, 1690342640, 1019283830, 1931248911, 3919077628, 3867681816, 1503209803,
+            1991732951, 2779783460, 1254528486, 2775966313, 814777063,  3113547370, 3069919579,
+            1828672058, 486195008,  2683375202, 1091342883, 2054848822, 2791919708, 1849947344,
+            3236225587, 3650689819, 3948179979, 1022492727, 890027397,  2002469780, 819853736,
+            3477995926, 2241469151, 3813123616, 2288859290, 1807453817, 2202344947, 3937277734,
+            407774172,  304032161,  1077405617, 3604416681, 2710010631, 439672051,  2963836151,
+            2979791933, 375576395,  2412895212, 1500748467, 1839903636, 708854744,  3250434993,
+            2920865012, 735002828,  994524077,  1254883034, 3364442018, 4082181435, 1471485592,
+            2202194924, 1003337503, 3106110855, 4085102275, 3311744307, 1732944348, 2081003221,
+            90069406,   2797313305, 1976464694, 1110462091, 1000323529, 4093028295, 4244651575,
+            2338181141, 785417353,  1397823005, 3551804003, 987140065,  2857692066, 4132226714,
+            3044032421, 3611809268, 2697047538, 2552654923, 2139492206, 1476801718, 1483410106,
+            2961565530, 1195406802, 723323648,  1391191524, 1125771389, 3615019963, 788081705,
+            3224957792, 3872793936, 2091211864, 2519073092, 310318798,  1474598348, 2288737959,
+            354816220,  121638995,  992796162,  1476962326, 3717429556, 791680685,  3617818914,
+            1487441538, 1995966960, 4276746531, 308567612,  1272521470, 4011010372, 2180500651,
+            1752017120, 1587877301, 3650405779, 4109197034, 649073736,  3678317178, 2403692317,
+            1713855912, 2418209883, 2910854031, 2754042917, 4145554450, 1903957113, 3787172191,
+            4171415839, 2338167893, 2887857522, 2819797602, 3021697109, 2385498132, 341935333,
+            2215862971, 2980577964, 637327142,  3235941991, 2833907210, 2939217266, 1295862734,
+            255114434,  4030138745, 163203333,  2034006561, 2185693816, 1660923959, 3908697652,
+            1440347572, 1032349609, 3500344258, 4153706612, 1093300897, 3437907804, 3314432232,
+            1534828219, 2999753392, 2919182293, 3495839726, 2959535758, 1943912836, 2759371831,
+            2734569084, 377085792,  3894856458, 2722490206, 766900007,  2829274896, 47603742,
+            1081936669, 1007494612, 2533625344, 47690960,   3873151298, 2778631629, 526970541,
+            728970018,  342913788,  1694010270, 1267820104, 267914626,  1792637484, 3494346220,
+            3265142044, 964667739,  1718120581, 2736101965, 4092331589, 874251732,  3653242861,
+            3788488242, 1386850069, 3567038325, 4208059109, 202187323,  1491374005, 2909759308,
+            4017747712, 1852145653, 1041492732, 3276285938, 4032881877, 3527246531, 578334556,
+            3024333781, 4186958591, 682557164,  2964013061, 3707892625, 4148277321, 922485752,
+            2565136140, 2787144970, 2640793255, 3618418813, 522584031,  3967081188, 2466488660,
+            272724664,  730645927,  2460989472, 1641156323, 1089315176, 665256116,  1538168417,
+            1592840191, 4165685990,
+        },
+        {
+            3235984466, 89830527,   3024305696, 4129593476, 2096150640, 4134472847, 1929962883,
+            758158654,  4098344804, 2879350262, 2463385837, 1703801139, 1955603023, 92212181,
+            2496850386, 2566809159, 682916418,  3211463537, 380455022,  718289963,  1152177483,
+            2090395230, 2281683260, 4094031576, 13395381,   883173193,  3532833765, 1603009066,
+            767044302,  2036267,    1799056345, 1287600629, 1543846331, 3120728072, 2871616557,
+            1502485175, 1572530931, 2213527659, 3786634867, 3601348004, 3868126375, 1674526895,
+            1072960536, 2901971200, 2288822227, 3282226745, 2128837541, 4203005342, 1370299898,
+            3366694529, 2090468896, 633415930,  1874784978, 2148622071, 1647645389, 4252080107,
+            429896314,  3245945705, 1366542477, 1512719598, 2926091341, 3393257871, 1353706435,
+            2884122494, 4028946002, 1506081627, 2382828395, 2085223746, 3838084525, 2673627328,
+            183849761,  1884359129, 2864329529, 1179280201, 592648061,  2582569912, 354569833,
+            3127842875, 2881845889, 150182764,  1231379643, 1996804881, 3942243497, 2337422361,
+            4196228639, 3393454276, 1278437716, 3079931602, 721254074,  624157003,  3001031961,
+            315982062,  3605572410, 4192619476, 1230940260, 2521550928, 4081337260, 4132000441,
+            3930627530, 3426503747, 3294506475, 3756611368, 1069767895, 2623719076, 1554715049,
+            1154660223, 1659766156, 222052536,  4283522313, 4067342193, 1868787793, 225293776,
+            580067143,  3820427538, 2424846743, 3906600566, 2366434122, 3075006449, 567747445,
+            1025394842, 1865262114, 1218042232, 2464714210, 4276612066, 1900848894, 2505861381,
+            3416141874, 1993837249, 461024596,  2707776101, 1468201821, 3578531238, 3831728894,
+            3467918996, 2457434380, 824079692,  984492963,  1984706811, 1163335538, 177313511,
+            1507339109, 653786009,  2510990170, 1500033517, 4096424862, 3260759322, 778189022,
+            1037485748, 3829768886, 2204203920, 2467026071, 1811683937, 171068925,  158202034,
+            2111577448, 219313854,  1946578893, 1226620613, 4003688571, 1156291104, 1254482032,
+            3235984466, 89830527,   3024305696, 4129593476, 3343885581, 4134472847, 1929962883,
+            758158654,  4098344804, 1472569947, 2463385837, 1703801139, 1955603023, 92212181,
+            4058025257, 2566809159, 682916418,  3211463537, 380455022,  3164899401, 1152177483,
+            2090395230, 2281683260, 4094031576, 1118872918, 883173193,  3532833765, 1603009066,
+            767044302,  1946060073, 1799056345, 1287600629, 1543846331, 3120728072, 483400420,
+            1502485175, 1572530931, 2213527659, 3786634867, 1274458561, 3868126375, 1674526895,
+            1072960536, 2901971200, 2879664033, 3282226745, 2128837541, 4203005342, 1370299898,
+            2168500818, 2090468896, 633415930,  1874784978, 2148622071, 3313238849, 4252080107,
+            429896314,  3245945705, 1366542477, 1325688912, 2926091341, 3393257871, 1353706435,
+            2884122494, 3685090422, 1506081627, 2382828395, 2085223746, 3838084525, 12307632,
+            183849761,  1884359129, 2864329529, 1179280201, 149331830,  2582569912, 354569833,
+            3127842875, 2881845889, 2592418711, 1231379643, 1996804881, 3942243497, 2337422361,
+            2146819315, 3393454276, 1278437716, 3079931602, 721254074,  487170794,  3001031961,
+            315982062,  3605572410, 4192619476, 2876682028, 2521550928, 4081337260, 4132000441,
+            3930627530, 3458802633, 3294506475, 3756611368, 1069767895, 2623719076, 1182274272,
+            1154660223, 1659766156, 222052536,  4283522313, 895670569,  1868787793, 225293776,
+            580067143,  3820427538, 12121617,   3906600566, 2366434122, 3075006449, 567747445,
+            708591941,  1865262114, 1218042232, 2464714210, 4276612066, 3374682764, 2505861381,
+            3416141874, 1993837249, 461024596,  3187361887, 1468201821, 3578531238, 3831728894,
+            3467918996, 188884156,  824079692,  984492963,  1984706811, 1163335538, 3740864385,
+            1507339109, 653786009,  2510990170, 1500033517, 3559058178, 3260759322, 778189022,
+            1037485748, 3829768886, 1299914002, 2467026071, 1811683937, 171068925,  158202034,
+            856759371,  219313854,  1946578893, 1226620613, 4003688571, 43406874,   1254482032,
+            3235984466, 89830527,   3024305696, 131945965,  3343885581, 4134472847, 1929962883,
+            758158654,  326788050,  1472569947, 2463385837, 1703801139, 1955603023, 1004236804,
+            4058025257, 2566809159, 682916418,  3211463537, 89507151,   3164899401, 1152177483,
+            2090395230, 2281683260, 1643810149, 1118872918, 883173193,  3532833765, 1603009066,
+            3619892564, 1946060073, 1799056345, 1287600629, 1543846331, 987047455,  483400420,
+            1502485175, 1572530931, 2213527659, 801702751,  1274458561, 3868126375, 1674526895,
+            1072960536, 24929999,   2879664033, 3282226745, 2128837541, 4203005342, 3271583401,
+            2168500818, 2090468896, 633415930,  1874784978, 2829098021, 3313238849, 4252080107,
+            429896314,  3245945705, 1085898652, 1325688912, 2926091341, 3393257871, 1353706435,
+            984057092,  3685090422, 1506081627, 2382828395, 2085223746, 4255586432, 12307632,
+            183849761,  1884359129, 2864329529, 3181451602, 149331830,  2582569912, 354569833,
+            3127842875, 2638394581, 2592418711, 1231379643, 1996804881, 3942243497, 2200701280,
+            2146819315, 3393454276, 1278437716, 3079931602, 865768503,  487170794,  3001031961,
+            315982062,  3605572410, 543807019,  2876682028, 2521550928, 4081337260, 4132000441,
+            999709694,  3458802633, 3294506475, 3756611368, 1069767895, 422317683,  1182274272,
+            1154660223, 1659766156, 222052536,  2255033558, 895670569,  1868787793, 225293776,
+            580067143,  2174012912, 12121617,   3906600566, 2366434122, 3075006449, 4261548842,
+            708591941,  1865262114, 1218042232, 2464714210, 5900118,    3374682764, 2505861381,
+            3416141874, 1993837249, 800536749,  3187361887, 1468201821, 3578531238, 3831728894,
+            4044019014, 188884156,  824079692,  984492963,  1984706811, 2766175217, 3740864385,
+            1507339109, 653786009,  2510990170, 3485203405, 3559058178, 3260759322, 778189022,
+            1037485748, 2145290129, 1299914002, 2467026071, 1811683937, 171068925,  400208610,
+            856759371,  219313854,  1946578893, 1226620613, 2202126638, 43406874,   1254482032,
+            3235984466, 89830527,   773316707,  131945965,  3343885581, 4134472847, 1929962883,
+            4177644794, 326788050,  1472569947, 2463385837, 1703801139, 167055166,  1004236804,
+            4058025257, 2566809159, 682916418,  344373351,  89507151,   3164899401, 1152177483,
+            2090395230, 2094687342, 1643810149, 1118872918, 883173193,  3532833765, 2454950237,
+            3619892564, 1946060073, 1799056345, 1287600629, 3480511968, 987047455,  483400420,
+            1502485175, 1572530931, 3862366257, 801702751,  1274458561, 3868126375, 1674526895,
+            761964980,  24929999,   2879664033, 3282226745, 2128837541, 239692085,  3271583401,
+            2168500818, 2090468896, 633415930,  4281998145, 2829098021, 3313238849, 4252080107,
+            429896314,  299701434,  1085898652, 1325688912, 2926091341, 3393257871, 222584723,
+            984057092,  3685090422, 1506081627, 2382828395, 1574885141, 4255586432, 12307632,
+            183849761,  1884359129, 2306418226, 3181451602, 149331830,  2582569912, 354569833,
+            2246753098, 2638394581, 2592418711, 1231379643, 1996804881, 324604669,  2200701280,
+            2146819315, 3393454276, 1278437716, 2256790927, 865768503,  487170794,  3001031961,
+            315982062,  3647001148, 543807019,  2876682028, 2521550928, 4081337260, 3300646673,
+            999709694,  3458802633, 3294506475, 3756611368, 871053861,  422317683,  1182274272,
+            1154660223, 1659766156, 2323399182, 2255033558, 895670569,  1868787793, 225293776,
+            2275278859, 2174012912, 12121617,   3906600566, 2366434122, 1055090488, 4261548842,
+            708591941,  1865262114, 1218042232, 3481766462, 5900118,    3374682764, 2505861381,
+            3416141874, 3855707936, 800536749,  3187361887, 1468201821, 3578531238, 1315315487,
+            4044019014, 188884156,  824079692,  984492963,  1557431956, 2766175217, 3740864385,
+            1507339109, 653786009,  2405161133, 3485203405, 3559058178, 3260759322, 778189022,
+            1565595130, 2145290129, 1299914002, 2467026071, 1811683937, 4010810463, 400208610,
+            856759371,  219313854,  1946578893, 2499365686, 3463987807, 3379396388, 1494721483,
+            2128863659, 2443444041, 2050718847, 1061808032, 635902907,  3698545937, 3802864330,
+            1460398401, 3406700740, 2390261325, 2449948531, 2189188998, 2547578158, 945140629,
+            1717186543, 868749377,  3653288007, 92498785,   3669965983, 3876943410, 959284418,
+            3314508629, 1118817842, 3722533142, 268124709,  1784722750, 1285635953, 2407508567,
+            313785554,  2393573843, 737960587,  475112854,  2488678079, 2951680339, 3446430185,
+            4077954811, 3368358721, 3664351921, 2165228260, 2593400763, 3734092420, 4227516681,
+            4273216065, 2427108965, 1363136594, 1772903557, 1368196219, 1242528721, 4024856616,
+            3463184513, 333611186,  1198782153, 23855603,   2119389790, 1743971749, 1098829910,
+            4103834049, 1957581578, 1349276830, 2727047576, 2244481116, 673479420,  1868743403,
+            1781612950, 4214309614, 2871672360, 365631135,  1726573904, 2697642747, 2702476819,
+            3587959925, 3106270331, 3617574792, 3705517242, 3690832408, 4119046807, 2447953521,
+            1685813256, 3185790294, 2301361545, 3423058076, 1241704324, 1072957049, 1252394766,
+            165644189,  1523801390, 788311258,  998553387,  23431256,   2117744967, 472234945,
+            3888317889, 3068355168, 264669652,  3079727927, 4105002678, 1886981427, 1155170699,
+            2924321608, 206117294,  1774738662, 1722807040, 4135454743, 1015831648, 2571688567,
+            142629147,  2482765438, 159099716,  1649808373, 3506413471, 3209344202, 2285942173,
+            2571910559, 320916943,  3581306321, 3687179551, 4028126121, 3506520381, 1814929711,
+            2715773091, 4156902345, 2738536754, 3554564612, 3820786935, 3575264275, 1810334844,
+            284956468,  3980700775, 2278249795, 14048004,   550107987,  2526185481, 200818080,
+            3337510415, 3865738936, 3483571124, 536507820,  1127150392, 3889072329, 959940424,
+            1626319917, 3210940680, 809028005,  4286788200, 732027242,  3925533808, 409588851,
+            1161347465, 988169752,  2006801162, 3835072413, 3540822710, 1008514793, 734397451,
+            416749632,  365260542,
+        },
+        {
+            985624668,  4195931946, 3606283281, 324126738,  3443797104, 594134747,  3787879712,
+            2461303916, 118295281,  2431814952, 3302759949, 60011355,   4074772373, 878214749,
+            3980023093, 2205517987, 1113723634, 1075047646, 2610447528, 3453013288, 1346748164,
+            1423899204, 581903280,  815713868,  2983984159, 2359515872, 2910158265, 2055125382,
+            3869357299, 3379270625, 1180993339, 962488807,  3718505783, 4211113513, 2481412587,
+            1842318804, 2001681025, 2879003661, 2472960562, 225444460,  1813706440, 3776746637,
+            133124327,  4135947519, 1242416117, 585983913,  901897499,  2263136902, 1745445177,
+            2144485508, 1766058486, 1696616862, 69080065,   503788702,  826186404,  4135546499,
+            3250109194, 1798180229, 514909393,  2278962148, 972286029,  3011212683, 3604206245,
+            1681984638, 1554282832, 161659808,  3558789869, 3034865691, 3250638851, 3383082950,
+            2060983552, 3233635409, 3177013391, 1803681935, 1461160137, 2015487882, 1997532686,
+            3979352208, 2757661349, 2774591924, 3890953195, 3921011150, 1584012689, 2922943262,
+            1035695994, 503352819,  3694102629, 2684690499, 1714449882, 989062102,  3910505446,
+            4188342974, 4116205096, 2307184662, 4016180023, 1966301490, 1019086055, 959221741,
+            2973652716, 281297721,  2443779800, 2141355187, 155608987,  4053784992, 1117201409,
+            4178674669, 876341781,  3988010170, 525234707,  3982494853, 1126401157, 2465750634,
+            827023186,  2875089969, 3860655773, 2138007168, 680926535,  3827991863, 845198867,
+            2806749677, 914380790,  2378911177, 280790823,  862515615,  61457475,   4065938091,
+            3845318662, 1732310211, 1893774814, 3243677160, 1444158513, 4263574998, 1830166944,
+            60621381,   3238475788, 123695043,  221197129,  3724221363, 2703899102, 649685422,
+            3319504760, 1758142277, 480769183,  1904015126, 2406055285, 2012557962, 844308211,
+            4055059949, 4044811306, 2879000943, 2510264860, 302336824,  1392535993, 2567270050,
+            1095942952, 3818225859, 611721412,  4018511938, 1483065056, 113696916,  1274641458,
+            985624668,  4195931946, 3606283281, 324126738,  2189156435, 594134747,  3787879712,
+            2461303916, 118295281,  1873845536, 3302759949, 60011355,   4074772373, 878214749,
+            2219856896, 2205517987, 1113723634, 1075047646, 2610447528, 2897593025, 1346748164,
+            1423899204, 581903280,  815713868,  815117645,  2359515872, 2910158265, 2055125382,
+            3869357299, 1605592487, 1180993339, 962488807,  3718505783, 4211113513, 3044213111,
+            1842318804, 2001681025, 2879003661, 2472960562, 1525896466, 1813706440, 3776746637,
+            133124327,  4135947519, 1761243830, 585983913,  901897499,  2263136902, 1745445177,
+            1365366637, 1766058486, 1696616862, 69080065,   503788702,  668163708,  4135546499,
+            3250109194, 1798180229, 514909393,  594591287,  972286029,  3011212683, 3604206245,
+            1681984638, 3273642262, 161659808,  3558789869, 3034865691, 3250638851, 2850632514,
+            2060983552, 3233635409, 3177013391, 1803681935, 4237757491, 2015487882, 1997532686,
+            3979352208, 2757661349, 643941274,  3890953195, 3921011150, 1584012689, 2922943262,
+            285458735,  503352819,  3694102629, 2684690499, 1714449882, 2289627801, 3910505446,
+            4188342974, 4116205096, 2307184662, 1923237692, 1966301490, 1019086055, 959221741,
+            2973652716, 2017711948, 2443779800, 2141355187, 155608987,  4053784992, 49901271,
+            4178674669, 876341781,  3988010170, 525234707,  2329294319, 1126401157, 2465750634,
+            827023186,  2875089969, 3199403165, 2138007168, 680926535,  3827991863, 845198867,
+            43862405,   914380790,  2378911177, 280790823,  862515615,  2001058365, 4065938091,
+            3845318662, 1732310211, 1893774814, 2345351993, 1444158513, 4263574998, 1830166944,
+            60621381,   2777455722, 123695043,  221197129,  3724221363, 2703899102, 2264173566,
+            3319504760, 1758142277, 480769183,  1904015126, 4169238659, 2012557962, 844308211,
+            4055059949, 4044811306, 4187579512, 2510264860, 302336824,  1392535993, 2567270050,
+            1606142607, 3818225859, 611721412,  4018511938, 1483065056, 2020430017, 1274641458,
+            985624668,  4195931946, 3606283281, 3144920310, 2189156435, 594134747,  3787879712,
+            2461303916, 2249454431, 1873845536, 3302759949, 60011355,   4074772373, 1578533783,
+            2219856896, 2205517987, 1113723634, 1075047646, 325544005,  2897593025, 1346748164,
+            1423899204, 581903280,  3736905110, 815117645,  2359515872, 2910158265, 2055125382,
+            2314664375, 1605592487, 1180993339, 962488807,  3718505783, 1720761211, 3044213111,
+            1842318804, 2001681025, 2879003661, 1644729568, 1525896466, 1813706440, 3776746637,
+            133124327,  2866272401, 1761243830, 585983913,  901897499,  2263136902, 4098247854,
+            1365366637, 1766058486, 1696616862, 69080065,   2614968527, 668163708,  4135546499,
+            3250109194, 1798180229, 1575101748, 594591287,  972286029,  3011212683, 3604206245,
+            3733056031, 3273642262, 161659808,  3558789869, 3034865691, 3449757631, 2850632514,
+            2060983552, 3233635409, 3177013391, 1836842684, 4237757491, 2015487882, 1997532686,
+            3979352208, 237440708,  643941274,  3890953195, 3921011150, 1584012689, 1473709779,
+            285458735,  503352819,  3694102629, 2684690499, 520785800,  2289627801, 3910505446,
+            4188342974, 4116205096, 191713011,  1923237692, 1966301490, 1019086055, 959221741,
+            797481886,  2017711948, 2443779800, 2141355187, 155608987,  3549062137, 49901271,
+            4178674669, 876341781,  3988010170, 1658127614, 2329294319, 1126401157, 2465750634,
+            827023186,  1775560282, 3199403165, 2138007168, 680926535,  3827991863, 3543837130,
+            43862405,   914380790,  2378911177, 280790823,  3880307017, 2001058365, 4065938091,
+            3845318662, 1732310211, 3149236777, 2345351993, 1444158513, 4263574998, 1830166944,
+            2991366390, 2777455722, 123695043,  221197129,  3724221363, 2112184761, 2264173566,
+            3319504760, 1758142277, 480769183,  194362353,  4169238659, 2012557962, 844308211,
+            4055059949, 1207878964, 4187579512, 2510264860, 302336824,  1392535993, 4220196967,
+            1606142607, 3818225859, 611721412,  4018511938, 2937793035, 2020430017, 1274641458,
+            985624668,  4195931946, 782624517,  3144920310, 2189156435, 594134747,  3787879712,
+            1392905250, 2249454431, 1873845536, 3302759949, 60011355,   445975557,  1578533783,
+            2219856896, 2205517987, 1113723634, 302523279,  325544005,  2897593025, 1346748164,
+            1423899204, 3438702289, 3736905110, 815117645,  2359515872, 2910158265, 648108159,
+            2314664375, 1605592487, 1180993339, 962488807,  2038614127, 1720761211, 3044213111,
+            1842318804, 2001681025, 2394448711, 1644729568, 1525896466, 1813706440, 3776746637,
+            2215854774, 2866272401, 1761243830, 585983913,  901897499,  336747758,  4098247854,
+            1365366637, 1766058486, 1696616862, 3208275153, 2614968527, 668163708,  4135546499,
+            3250109194, 4070711816, 1575101748, 594591287,  972286029,  3011212683, 3583466711,
+            3733056031, 3273642262, 161659808,  3558789869, 618274973,  3449757631, 2850632514,
+            2060983552, 3233635409, 2276091938, 1836842684, 4237757491, 2015487882, 1997532686,
+            3496404497, 237440708,  643941274,  3890953195, 3921011150, 3144363586, 1473709779,
+            285458735,  503352819,  3694102629, 2763448898, 520785800,  2289627801, 3910505446,
+            4188342974, 1371418861, 191713011,  1923237692, 1966301490, 1019086055, 1667721888,
+            797481886,  2017711948, 2443779800, 2141355187, 1832972014, 3549062137, 49901271,
+            4178674669, 876341781,  1663336970, 1658127614, 2329294319, 1126401157, 2465750634,
+            814807722,  1775560282, 3199403165, 2138007168, 680926535,  4284956023, 3543837130,
+            43862405,   914380790,  2378911177, 1500483708, 3880307017, 2001058365, 4065938091,
+            3845318662, 649680279,  3149236777, 2345351993, 1444158513, 4263574998, 25325522,
+            2991366390, 2777455722, 123695043,  221197129,  2331419143, 2112184761, 2264173566,
+            3319504760, 1758142277, 1312769352, 194362353,  4169238659, 2012557962, 844308211,
+            710491955,  1207878964, 4187579512, 2510264860, 302336824,  2945841917, 4220196967,
+            1606142607, 3818225859, 611721412,  2797814291, 4008348578, 3399396234, 3828958919,
+            441837633,  1557894457, 941166515,  3654247320, 696085175,  1600321516, 3172851737,
+            2863500255, 3737282921, 3113215903, 3161223667, 1150714984, 2394822747, 4190887718,
+            2582748890, 3656991401, 3878871994, 1545171177, 1700696447, 3302219482, 3469927555,
+            1248296335, 1520812253, 1925835132, 1433820032, 3420363641, 1152804836, 4068217321,
+            150803414,  3242166369, 1941636170, 3502084150, 694371562,  3832157692, 3279770832,
+            589518836,  2837688540, 706775507,  221810020,  1514440029, 3673317256, 3694449539,
+            4140862519, 388630449,  302750233,  4187958557, 2422943346, 1937243016, 2524053008,
+            4108323600, 4232195936, 2153520307, 2878990957, 2456043611, 2375126768, 1758288268,
+            230382152,  1158713431, 227499307,  3970706461, 3414460720, 2935430402, 1261261591,
+            1843130142, 3380203693, 2440635758, 4144924948, 289425718,  871375469,  1642188166,
+            2106624428, 2499777039, 2720066297, 942051543,  321108479,  2913996651, 3121211415,
+            360573000,  3260272385, 517688672,  407729125,  810357442,  4168570390, 1740500645,
+            1369591395, 1280568011, 3264536767, 4012864740, 4227390633, 1722374442, 1189264226,
+            2977239252, 4152198290, 3616679195, 3333574942, 2119140138, 2131945038, 3641256333,
+            4209590779, 3783066990, 3506334120, 1934715542, 3357392480, 656171497,  66136411,
+            1576263235, 2299360793, 199043013,  355039002,  3378409902, 2178733358, 397845675,
+            730001274,  1669477177, 3452875526, 2134821732, 3313280355, 208204776,  1675072473,
+            2687136286, 3510502996, 3591125528, 1015790704, 638854757,  2803070197, 1535729264,
+            3790918614, 2082559009, 1453405019, 195108869,  1927770155, 212119931,  567556633,
+            285181090,  3449757410, 3986144644, 913533948,  3162884603, 3244337218, 1200890812,
+            2186263748, 3018331668, 4258747228, 4131580077, 247685166,  2033603236, 3144471136,
+            2436230483, 3603638375, 793922591,  3134051843, 754115760,  2204573261, 2028733994,
+            660065445,  3301067878,
+        },
+        {
+            1676507466, 1017841240, 2992644565, 476936158,  2468072723, 3113105154, 1154120402,
+            460889625,  1942263502, 1761593999, 3020908939, 3078194866, 310971889,  1644896012,
+            3756044556, 3549937583, 3710822994, 3554313733, 2174654326, 4251063242, 2340485150,
+            950951909,  4288936895, 3744348848, 706644559,  1085927825, 1595992020, 3288724966,
+            1367247946, 2950094970, 3925419886, 2628739022, 2528254629, 3582224789, 3907345559,
+            3373329273, 4255542251, 1185418446, 4018656113, 2854344020, 1381160022, 3642438773,
+            4284399225, 935780030,  4142412144, 1263328494, 1154237693, 2684443667, 3067549398,
+            4253090033, 1251034970, 1874233020, 3222830495, 3866931656, 286048055,  3146635362,
+            1436483376, 2821876495, 3927829532, 2648886905, 2142862852, 1368937545, 2647327844,
+            1072219385, 2621337706, 3543274652, 911792564,  1204178178, 4127214323, 2821691380,
+            3101998294, 730811902,  1989156224, 2872353003, 278290276,  1390223786, 2657819643,
+            552729795,  1736270535, 2759207116, 1897013739, 3657020278, 1387364861, 1966588302,
+            1049203087, 486446521,  3675999281, 714737345,  686837530,  85509025,   3609089773,
+            2117061768, 3935682560, 3859508784, 4105287041, 1808988481, 83680601,   1464326680,
+            1657693523, 3318062731, 1391154023, 234460119,  3551348221, 2245244809, 3635923821,
+            2814385745, 3497626257, 916790795,  245338628,  2514528380, 3711787525, 2239286063,
+            1054058916, 3963706010, 3176203796, 2230543409, 2173597546, 3786733892, 1396036965,
+            1038764273, 2032556038, 3216540537, 3298170974, 1008892557, 141155464,  1863766055,
+            3931110690, 191299053,  2019139711, 2409528317, 739418419,  1377144055, 2876702705,
+            3911939673, 1197696462, 2814009721, 600813233,  1535885024, 1486280357, 3084650548,
+            2324695947, 2293284974, 2036339249, 3465600153, 1624446108, 327866771,  3356772175,
+            1826625240, 1947102360, 3661848193, 1421374867, 3228945021, 1358646008, 1067180174,
+            2190741258, 643362354,  109899594,  2064362635, 3249674888, 2165543887, 4180291913,
+            1676507466, 1017841240, 2992644565, 476936158,  3608467942, 3113105154, 1154120402,
+            460889625,  1942263502, 1862994005, 3020908939, 3078194866, 310971889,  1644896012,
+            693774191,  3549937583, 3710822994, 3554313733, 2174654326, 37658897,   2340485150,
+            950951909,  4288936895, 3744348848, 2258231402, 1085927825, 1595992020, 3288724966,
+            1367247946, 3850509554, 3925419886, 2628739022, 2528254629, 3582224789, 3124287811,
+            3373329273, 4255542251, 1185418446, 4018656113, 1989726178, 1381160022, 3642438773,
+            4284399225, 935780030,  3622052196, 1263328494, 1154237693, 2684443667, 3067549398,
+            2786224913, 1251034970, 1874233020, 3222830495, 3866931656, 1529490307, 3146635362,
+            1436483376, 2821876495, 3927829532, 979247444,  2142862852, 1368937545, 2647327844,
+            1072219385, 294065371,  3543274652, 911792564,  1204178178, 4127214323, 103582737,
+            3101998294, 730811902,  1989156224, 2872353003, 1885087777, 1390223786, 2657819643,
+            552729795,  1736270535, 3325206451, 1897013739, 3657020278, 1387364861, 1966588302,
+            2117065739, 486446521,  3675999281, 714737345,  686837530,  3946214694, 3609089773,
+            2117061768, 3935682560, 3859508784, 2916136885, 1808988481, 83680601,   1464326680,
+            1657693523, 3438751781, 1391154023, 234460119,  3551348221, 2245244809, 3948410079,
+            2814385745, 3497626257, 916790795,  245338628,  1767303496, 3711787525, 2239286063,
+            1054058916, 3963706010, 4140631909, 2230543409, 2173597546, 3786733892, 1396036965,
+            1116033475, 2032556038, 3216540537, 3298170974, 1008892557, 667272562,  1863766055,
+            3931110690, 191299053,  2019139711, 272901326,  739418419,  1377144055, 2876702705,
+            3911939673, 3839312742, 2814009721, 600813233,  1535885024, 1486280357, 4256065219,
+            2324695947, 2293284974, 2036339249, 3465600153, 1215859603, 327866771,  3356772175,
+            1826625240, 1947102360, 4240407984, 1421374867, 3228945021, 1358646008, 1067180174,
+            4100357988, 643362354,  109899594,  2064362635, 3249674888, 2898852084, 4180291913,
+            1676507466, 1017841240, 2992644565, 1569683812, 3608467942, 3113105154, 1154120402,
+            460889625,  966040649,  1862994005, 3020908939, 3078194866, 310971889,  786634113,
+            693774191,  3549937583, 3710822994, 3554313733, 1578429713, 37658897,   2340485150,
+            950951909,  4288936895, 2528123823, 2258231402, 1085927825, 1595992020, 3288724966,
+            3544041088, 3850509554, 3925419886, 2628739022, 2528254629, 2562145937, 3124287811,
+            3373329273, 4255542251, 1185418446, 3693565710, 1989726178, 1381160022, 3642438773,
+            4284399225, 3271478204, 3622052196, 1263328494, 1154237693, 2684443667, 3615401444,
+            2786224913, 1251034970, 1874233020, 3222830495, 2572413057, 1529490307, 3146635362,
+            1436483376, 2821876495, 3993894153, 979247444,  2142862852, 1368937545, 2647327844,
+            1353904396, 294065371,  3543274652, 911792564,  1204178178, 3165709748, 103582737,
+            3101998294, 730811902,  1989156224, 893293786,  1885087777, 1390223786, 2657819643,
+            552729795,  3388458110, 3325206451, 1897013739, 3657020278, 1387364861, 3025318046,
+            2117065739, 486446521,  3675999281, 714737345,  2085926890, 3946214694, 3609089773,
+            2117061768, 3935682560, 868009118,  2916136885, 1808988481, 83680601,   1464326680,
+            797410789,  3438751781, 1391154023, 234460119,  3551348221, 4068940987, 3948410079,
+            2814385745, 3497626257, 916790795,  3722456098, 1767303496, 3711787525, 2239286063,
+            1054058916, 2030352819, 4140631909, 2230543409, 2173597546, 3786733892, 3211336683,
+            1116033475, 2032556038, 3216540537, 3298170974, 2589589144, 667272562,  1863766055,
+            3931110690, 191299053,  1139480458, 272901326,  739418419,  1377144055, 2876702705,
+            1954361769, 3839312742, 2814009721, 600813233,  1535885024, 3587775605, 4256065219,
+            2324695947, 2293284974, 2036339249, 1534849280, 1215859603, 327866771,  3356772175,
+            1826625240, 720372669,  4240407984, 1421374867, 3228945021, 1358646008, 3409069246,
+            4100357988, 643362354,  109899594,  2064362635, 4243434294, 2898852084, 4180291913,
+            1676507466, 1017841240, 3243922356, 1569683812, 3608467942, 3113105154, 1154120402,
+            1479311403, 966040649,  1862994005, 3020908939, 3078194866, 1556392996, 786634113,
+            693774191,  3549937583, 3710822994, 920664071,  1578429713, 37658897,   2340485150,
+            950951909,  740197415,  2528123823, 2258231402, 1085927825, 1595992020, 2580760267,
+            3544041088, 3850509554, 3925419886, 2628739022, 3867556156, 2562145937, 3124287811,
+            3373329273, 4255542251, 3185271749, 3693565710, 1989726178, 1381160022, 3642438773,
+            3042165367, 3271478204, 3622052196, 1263328494, 1154237693, 1016814036, 3615401444,
+            2786224913, 1251034970, 1874233020, 2956086971, 2572413057, 1529490307, 3146635362,
+            1436483376, 1513970396, 3993894153, 979247444,  2142862852, 1368937545, 3275665128,
+            1353904396, 294065371,  3543274652, 911792564,  2209636872, 3165709748, 103582737,
+            3101998294, 730811902,  965151434,  893293786,  1885087777, 1390223786, 2657819643,
+            3278634059, 3388458110, 3325206451, 1897013739, 3657020278, 4293473749, 3025318046,
+            2117065739, 486446521,  3675999281, 620561205,  2085926890, 3946214694, 3609089773,
+            2117061768, 163384588,  868009118,  2916136885, 1808988481, 83680601,   10243015,
+            797410789,  3438751781, 1391154023, 234460119,  1278218413, 4068940987, 3948410079,
+            2814385745, 3497626257, 1233272798, 3722456098, 1767303496, 3711787525, 2239286063,
+            3968895688, 2030352819, 4140631909, 2230543409, 2173597546, 2866251044, 3211336683,
+            1116033475, 2032556038, 3216540537, 4233849723, 2589589144, 667272562,  1863766055,
+            3931110690, 2468422423, 1139480458, 272901326,  739418419,  1377144055, 4240143411,
+            1954361769, 3839312742, 2814009721, 600813233,  3976840004, 3587775605, 4256065219,
+            2324695947, 2293284974, 437604123,  1534849280, 1215859603, 327866771,  3356772175,
+            2757237699, 720372669,  4240407984, 1421374867, 3228945021, 3284801305, 3409069246,
+            4100357988, 643362354,  109899594,  1301585321, 2528806870, 1838904064, 448772403,
+            1097849740, 1899994097, 618309123,  1911948510, 2309256224, 1861398151, 905306403,
+            1067595802, 36868624,   3780886191, 835126206,  3190251977, 2672497726, 2085944002,
+            2912993968, 2493776706, 667136329,  1474890786, 2383346554, 943528949,  3376706013,
+            2495573574, 144956345,  793159960,  1591274917, 477107637,  1383815442, 67384899,
+            2355242218, 1687409818, 3801093871, 2108217811, 3455908733, 4172160797, 3935534685,
+            631067839,  1187677548, 2280856137, 3020767646, 2063176246, 3736904984, 2952933848,
+            2975164686, 4144473303, 34670977,   1250976509, 3484166554, 1532744745, 225700994,
+            1878713627, 2122358980, 1456610194, 2917522161, 2818947075, 102678939,  53743858,
+            2095250656, 4023979225, 3094092874, 4128760696, 3411610028, 3020200609, 2225866341,
+            586320946,  63813522,   1238216159, 2825692263, 2169937231, 3298517640, 1542128261,
+            2205544184, 1258655704, 2629012083, 4113650203, 3198617867, 2742310794, 3372657381,
+            3115904410, 1948638822, 1123521744, 1080429281, 4086706732, 4142693211, 817377147,
+            2570194641, 26001503,   2861456160, 4185725555, 2573003804, 1618628779, 2588489212,
+            3996192609, 1555844274, 1003123505, 1326350123, 1130583849, 3017128756, 74119042,
+            4041266437, 1938014170, 3528465794, 4203969698, 1913054398, 3617979809, 2218810167,
+            2453899816, 1997423206, 477446533,  303090065,  757937082,  1523238256, 3140505311,
+            1422588701, 3642014639, 1740624195, 1276017154, 3072526193, 3675105122, 1335122682,
+            4080595263, 2308519420, 3299182769, 1461978532, 3098694217, 2982399822, 3088698511,
+            586759229,  3548750902, 1449857891, 2866451663, 2525162286, 57294602,   4107991297,
+            1214672265, 2940391280, 4285346034, 3338216759, 737207923,  4264163846, 59219141,
+            2300024654, 1876616814, 1976543605, 783571061,  1724699622, 1967524469, 1650309916,
+            3322257631, 3975521122, 273342162,  1156754241, 185315896,  3368133921, 66314655,
+            4153777915, 3519901897,
+        },
+        {
+            593832592,  246586301,  3915418583, 1560209072, 87645153,   1524036266, 2107185286,
+            3718698439, 4246841866, 140191566,  2685307939, 2081898217, 1119056328, 287318224,
+            810494505,  500114461,  240037818,  2641533362, 961046449,  557068561,  3299225208,
+            2966578378, 1096668757, 2870974168, 1670690750, 1566199692, 3070506472, 127606212,
+            1055471862, 2191576630, 3153959397, 2063695340, 3339560212, 3912369852, 1486332905,
+            2728690969, 2527551174, 2695029512, 2564110273, 523719378,  3049511955, 1298556056,
+            1455763586, 2701387106, 65428480,   1427761988, 1299437191, 1379476008, 3649817534,
+            3419888605, 3929140387, 1597486673, 3128114634, 2085850687, 3067626300, 3207969420,
+            3230202084, 2242210466, 403375004,  2627948194, 2610369084, 3945853070, 3426713745,
+            1658959046, 1848874642, 2609175594, 3840967546, 1838211217, 42197520,   3587854722,
+            1570882730, 3731490385, 1669492220, 304989523,  2845633061, 1959962934, 1191233807,
+            2060728147, 4200927443, 3770104070, 422731858,  568752140,  2373467915, 1474466741,
+            1907985100, 3981409756, 1976254789, 1395108303, 3828640666, 2022479216, 2628632324,
+            2377006033, 3395512828, 824756362,  1878318938, 127785110,  3660287061, 298201983,
+            2980471263, 446448649,  1845107234, 4057903874, 2466520526, 2497352403, 3876967448,
+            1721583826, 3770115034, 1040008931, 3095616514, 4008622913, 2111551705, 1469271872,
+            461608981,  3018813497, 1552678643, 925630701,  2334942451, 2661991720, 2731164877,
+            3100554025, 142055720,  1486359019, 1691983695, 2056164604, 2055721244, 246118853,
+            2660676692, 469806817,  810224396,  512010629,  2414103991, 1582990689, 3504005487,
+            566991906,  785972933,  3170112612, 2582314447, 1836079313, 3167683576, 3890174500,
+            963355285,  169739317,  1049994664, 3857345412, 4209559743, 2789246697, 1127427770,
+            1163632784, 2683544497, 1096604987, 835394002,  3540033879, 3250335392, 233042751,
+            744797696,  778124612,  2084011646, 133394496,  330736218,  3447591748, 2765333747,
+            593832592,  246586301,  3915418583, 1560209072, 466962714,  1524036266, 2107185286,
+            3718698439, 4246841866, 338637075,  2685307939, 2081898217, 1119056328, 287318224,
+            1668599999, 500114461,  240037818,  2641533362, 961046449,  3962030551, 3299225208,
+            2966578378, 1096668757, 2870974168, 4076137599, 1566199692, 3070506472, 127606212,
+            1055471862, 409323625,  3153959397, 2063695340, 3339560212, 3912369852, 3410020011,
+            2728690969, 2527551174, 2695029512, 2564110273, 3191374898, 3049511955, 1298556056,
+            1455763586, 2701387106, 2904131412, 1427761988, 1299437191, 1379476008, 3649817534,
+            3367942078, 3929140387, 1597486673, 3128114634, 2085850687, 54115464,   3207969420,
+            3230202084, 2242210466, 403375004,  408146319,  2610369084, 3945853070, 3426713745,
+            1658959046, 2296671064, 2609175594, 3840967546, 1838211217, 42197520,   2699288151,
+            1570882730, 3731490385, 1669492220, 304989523,  3134030716, 1959962934, 1191233807,
+            2060728147, 4200927443, 968785529,  422731858,  568752140,  2373467915, 1474466741,
+            2433853688, 3981409756, 1976254789, 1395108303, 3828640666, 911865621,  2628632324,
+            2377006033, 3395512828, 824756362,  1942308477, 127785110,  3660287061, 298201983,
+            2980471263, 3715987595, 1845107234, 4057903874, 2466520526, 2497352403, 2443189204,
+            1721583826, 3770115034, 1040008931, 3095616514, 1497287021, 2111551705, 1469271872,
+            461608981,  3018813497, 3679238362, 925630701,  2334942451, 2661991720, 2731164877,
+            3038355071, 142055720,  1486359019, 1691983695, 2056164604, 3532177836, 246118853,
+            2660676692, 469806817,  810224396,  232908337,  2414103991, 1582990689, 3504005487,
+            566991906,  1753229370, 3170112612, 2582314447, 1836079313, 3167683576, 4283429921,
+            963355285,  169739317,  1049994664, 3857345412, 3589340269, 2789246697, 1127427770,
+            1163632784, 2683544497, 2293873924, 835394002,  3540033879, 3250335392, 233042751,
+            2206330999, 778124612,  2084011646, 133394496,  330736218,  413439323,  2765333747,
+            593832592,  246586301,  3915418583, 1203033206, 466962714,  1524036266, 2107185286,
+            3718698439, 545061386,  338637075,  2685307939, 2081898217, 1119056328, 3958525739,
+            1668599999, 500114461,  240037818,  2641533362, 2292350044, 3962030551, 3299225208,
+            2966578378, 1096668757, 4289444210, 4076137599, 1566199692, 3070506472, 127606212,
+            4155542815, 409323625,  3153959397, 2063695340, 3339560212, 351655507,  3410020011,
+            2728690969, 2527551174, 2695029512, 2705087573, 3191374898, 3049511955, 1298556056,
+            1455763586, 2038452840, 2904131412, 1427761988, 1299437191, 1379476008, 711709033,
+            3367942078, 3929140387, 1597486673, 3128114634, 1467285853, 54115464,   3207969420,
+            3230202084, 2242210466, 3823426609, 408146319,  2610369084, 3945853070, 3426713745,
+            3176925017, 2296671064, 2609175594, 3840967546, 1838211217, 905539963,  2699288151,
+            1570882730, 3731490385, 1669492220, 3498928960, 3134030716, 1959962934, 1191233807,
+            2060728147, 3378448797, 968785529,  422731858,  568752140,  2373467915, 1706402518,
+            2433853688, 3981409756, 1976254789, 1395108303, 4136191165, 911865621,  2628632324,
+            2377006033, 3395512828, 3131823765, 1942308477, 127785110,  3660287061, 298201983,
+            392013686,  3715987595, 1845107234, 4057903874, 2466520526, 947397900,  2443189204,
+            1721583826, 3770115034, 1040008931, 217112815,  1497287021, 2111551705, 1469271872,
+            461608981,  1533242326, 3679238362, 925630701,  2334942451, 2661991720, 1056667393,
+            3038355071, 142055720,  1486359019, 1691983695, 1235898915, 3532177836, 246118853,
+            2660676692, 469806817,  1159875465, 232908337,  2414103991, 1582990689, 3504005487,
+            48119110,   1753229370, 3170112612, 2582314447, 1836079313, 3625586565, 4283429921,
+            963355285,  169739317,  1049994664, 2930243609, 3589340269, 2789246697, 1127427770,
+            1163632784, 1536220049, 2293873924, 835394002,  3540033879, 3250335392, 3782406546,
+            2206330999, 778124612,  2084011646, 133394496,  3386823186, 413439323,  2765333747,
+            593832592,  246586301,  3967484902, 1203033206, 466962714,  1524036266, 2107185286,
+            2291616883, 545061386,  338637075,  2685307939, 2081898217, 3902254922, 3958525739,
+            1668599999, 500114461,  240037818,  2313193489, 2292350044, 3962030551, 3299225208,
+            2966578378, 1426701615, 4289444210, 4076137599, 1566199692, 3070506472, 3381814495,
+            4155542815, 409323625,  3153959397, 2063695340, 4131405640, 351655507,  3410020011,
+            2728690969, 2527551174, 2622923666, 2705087573, 3191374898, 3049511955, 1298556056,
+            1394039953, 2038452840, 2904131412, 1427761988, 1299437191, 3267082142, 711709033,
+            3367942078, 3929140387, 1597486673, 919913815,  1467285853, 54115464,   3207969420,
+            3230202084, 2773841169, 3823426609, 408146319,  2610369084, 3945853070, 1473449931,
+            3176925017, 2296671064, 2609175594, 3840967546, 955882787,  905539963,  2699288151,
+            1570882730, 3731490385, 4198086533, 3498928960, 3134030716, 1959962934, 1191233807,
+            1928091492, 3378448797, 968785529,  422731858,  568752140,  3983313351, 1706402518,
+            2433853688, 3981409756, 1976254789, 2749555318, 4136191165, 911865621,  2628632324,
+            2377006033, 742138296,  3131823765, 1942308477, 127785110,  3660287061, 577999312,
+            392013686,  3715987595, 1845107234, 4057903874, 2549085497, 947397900,  2443189204,
+            1721583826, 3770115034, 3665613884, 217112815,  1497287021, 2111551705, 1469271872,
+            2108351201, 1533242326, 3679238362, 925630701,  2334942451, 3159728112, 1056667393,
+            3038355071, 142055720,  1486359019, 769407932,  1235898915, 3532177836, 246118853,
+            2660676692, 763785890,  1159875465, 232908337,  2414103991, 1582990689, 3784250295,
+            48119110,   1753229370, 3170112612, 2582314447, 1769505225, 3625586565, 4283429921,
+            963355285,  169739317,  3663613778, 2930243609, 3589340269, 2789246697, 1127427770,
+            3569170532, 1536220049, 2293873924, 835394002,  3540033879, 1965521160, 3782406546,
+            2206330999, 778124612,  2084011646, 2056718370, 3146203969, 3345317153, 2361123730,
+            840839592,  1948619679, 1390921878, 2610666385, 2307045491, 410416133,  163351321,
+            2403409233, 1723478427, 2178522941, 1094383019, 2065247821, 613607246,  728037371,
+            3031428853, 3354937794, 147757425,  1682352955, 4010621504, 2646669482, 2198265667,
+            3401144559, 2395506545, 164391672,  3408019164, 1099645278, 241883707,  3381122752,
+            4081885109, 1626203829, 1942789688, 3072091721, 3825491870, 4240427441, 1855488810,
+            3752566264, 3848845915, 65662247,   2666138429, 3663726993, 2679689613, 293102257,
+            2024756475, 807057499,  3623038990, 2810786676, 243230756,  3447440490, 2344923497,
+            2833047912, 1373121459, 2774009503, 206454908,  1499958320, 328702923,  3279094059,
+            2060973294, 1010809423, 4206003870, 4028302351, 3535585567, 985688795,  825605832,
+            1257246465, 627304510,  176844768,  29301712,   1825875050, 3953584063, 322250360,
+            1419041558, 2680325044, 39636241,   1237953395, 1875976300, 1672143644, 3820829616,
+            627695840,  318395166,  3106985772, 1817901825, 1546050520, 3331962512, 3883371623,
+            3027065844, 281472461,  1435640473, 2995466926, 1483743120, 436222404,  2505494621,
+            1739061536, 2602044706, 2631207011, 2024368710, 3052969252, 3023604788, 4274829923,
+            2457139787, 3428338815, 2311018488, 2010375311, 1146853409, 3255533419, 1239731173,
+            2765368039, 1157362241, 477260163,  1948897601, 335238813,  433635392,  3498300858,
+            3177632724, 2545493080, 3402379252, 124802989,  1753720711, 2078664542, 2203176639,
+            672989605,  3245358537, 2758248855, 3190342214, 441429850,  2343414224, 329050974,
+            2197114878, 1688950829, 1055674033, 2012753412, 877680691,  273671311,  1908186202,
+            2251928438, 4203772084, 3519840095, 2939674409, 3327090400, 508907877,  3776619844,
+            3631286225, 932409453,  3989651263, 1131071270, 2526690123, 819641762,  3419956593,
+            526736661,  1156941444, 3427548032, 4253491794, 2155637602, 4116386410, 338289656,
+            2544374671, 3116969675,
+        },
+        {
+            2887366013, 2429491453, 1329630683, 2486719101, 2587819794, 1797355784, 1032132580,
+            3900172754, 1788867816, 203703271,  1081978912, 4156385502, 244009357,  4228819859,
+            2498715330, 1649789770, 3932898591, 3892424093, 4211910640, 2607417106, 375180696,
+            691540399,  2224782346, 26787691,   3810981091, 2947112950, 2894363803, 2318355333,
+            320841632,  3966622323, 3029836837, 1943105589, 1085722533, 791997626,  1531068231,
+            4139719786, 221160858,  540873842,  2593612434, 1723102322, 1219964996, 4014581986,
+            2811525125, 416481730,  2649662518, 1702666089, 3419712487, 1436341874, 412259036,
+            623854124,  2098643261, 3872337787, 1907032427, 4131996437, 3844606245, 2849744516,
+            2674758897, 2735533225, 4086706136, 2470509901, 4125867244, 2854693322, 2008478970,
+            1741952946, 1587958013, 2864420780, 4090493074, 267364874,  2667873685, 1894947183,
+            2374225586, 548826903,  1457641878, 3032565398, 225691986,  4033312385, 318976430,
+            926308232,  1036880109, 4104274307, 2656310264, 3207989199, 2596493373, 482067109,
+            944486224,  2312088459, 4197888875, 375652445,  2919146272, 4095624015, 1249473469,
+            761514426,  2723662834, 17949525,   112017777,  2658277828, 3401344784, 2034251752,
+            153232632,  1470945588, 2579249771, 2840880614, 2281139533, 1140931637, 612846666,
+            2000826801, 3062255076, 3186140953, 3091720506, 279267844,  1588708322, 3500512184,
+            3393408383, 3106087939, 1080931564, 1137283996, 263486811,  1899484599, 2111281337,
+            1954990086, 530586118,  2385746473, 3226292605, 4152071379, 3002398736, 1579492413,
+            2652280827, 956892231,  3497070809, 2615064539, 2302599436, 740665892,  3296503983,
+            2333274332, 779862090,  511167561,  1180224862, 360571978,  1982243868, 3367690788,
+            1744635551, 1826661439, 2622563356, 273309594,  1533725388, 145887364,  1536281720,
+            3540684674, 1008603554, 3966600781, 4034013589, 2857542149, 1807535706, 3571706258,
+            3437493263, 95492974,   2056543038, 2862086816, 542637248,  251751498,  4194383035,
+            2887366013, 2429491453, 1329630683, 2486719101, 2645155665, 1797355784, 1032132580,
+            3900172754, 1788867816, 2040437990, 1081978912, 4156385502, 244009357,  4228819859,
+            1508077287, 1649789770, 3932898591, 3892424093, 4211910640, 1193668384, 375180696,
+            691540399,  2224782346, 26787691,   2637518699, 2947112950, 2894363803, 2318355333,
+            320841632,  1678981539, 3029836837, 1943105589, 1085722533, 791997626,  1010569472,
+            4139719786, 221160858,  540873842,  2593612434, 3400484592, 1219964996, 4014581986,
+            2811525125, 416481730,  1885985813, 1702666089, 3419712487, 1436341874, 412259036,
+            608427648,  2098643261, 3872337787, 1907032427, 4131996437, 958744771,  2849744516,
+            2674758897, 2735533225, 4086706136, 806621230,  4125867244, 2854693322, 2008478970,
+            1741952946, 146473863,  2864420780, 4090493074, 267364874,  2667873685, 1132651696,
+            2374225586, 548826903,  1457641878, 3032565398, 3280903048, 4033312385, 318976430,
+            926308232,  1036880109, 1224380713, 2656310264, 3207989199, 2596493373, 482067109,
+            2819074001, 2312088459, 4197888875, 375652445,  2919146272, 3268715557, 1249473469,
+            761514426,  2723662834, 17949525,   2629178618, 2658277828, 3401344784, 2034251752,
+            153232632,  3577508475, 2579249771, 2840880614, 2281139533, 1140931637, 480454152,
+            2000826801, 3062255076, 3186140953, 3091720506, 767226734,  1588708322, 3500512184,
+            3393408383, 3106087939, 2524563246, 1137283996, 263486811,  1899484599, 2111281337,
+            3625445099, 530586118,  2385746473, 3226292605, 4152071379, 907141618,  1579492413,
+            2652280827, 956892231,  3497070809, 265189015,  2302599436, 740665892,  3296503983,
+            2333274332, 2420287626, 511167561,  1180224862, 360571978,  1982243868, 928417047,
+            1744635551, 1826661439, 2622563356, 273309594,  3232210001, 145887364,  1536281720,
+            3540684674, 1008603554, 1027911561, 4034013589, 2857542149, 1807535706, 3571706258,
+            3535119186, 95492974,   2056543038, 2862086816, 542637248,  499121768,  4194383035,
+            2887366013, 2429491453, 1329630683, 60266898,   2645155665, 1797355784, 1032132580,
+            3900172754, 187075426,  2040437990, 1081978912, 4156385502, 244009357,  2805842211,
+            1508077287, 1649789770, 3932898591, 3892424093, 2629619148, 1193668384, 375180696,
+            691540399,  2224782346, 305151209,  2637518699, 2947112950, 2894363803, 2318355333,
+            3843885649, 1678981539, 3029836837, 1943105589, 1085722533, 1975048448, 1010569472,
+            4139719786, 221160858,  540873842,  2603841009, 3400484592, 1219964996, 4014581986,
+            2811525125, 3278318493, 1885985813, 1702666089, 3419712487, 1436341874, 1863150024,
+            608427648,  2098643261, 3872337787, 1907032427, 3864702028, 958744771,  2849744516,
+            2674758897, 2735533225, 765229792,  806621230,  4125867244, 2854693322, 2008478970,
+            778699793,  146473863,  2864420780, 4090493074, 267364874,  1663303039, 1132651696,
+            2374225586, 548826903,  1457641878, 547542908,  3280903048, 4033312385, 318976430,
+            926308232,  508610207,  1224380713, 2656310264, 3207989199, 2596493373, 1549671241,
+            2819074001, 2312088459, 4197888875, 375652445,  1692274382, 3268715557, 1249473469,
+            761514426,  2723662834, 1339406016, 2629178618, 2658277828, 3401344784, 2034251752,
+            1979737568, 3577508475, 2579249771, 2840880614, 2281139533, 1588649451, 480454152,
+            2000826801, 3062255076, 3186140953, 1539523759, 767226734,  1588708322, 3500512184,
+            3393408383, 3295624567, 2524563246, 1137283996, 263486811,  1899484599, 3632336247,
+            3625445099, 530586118,  2385746473, 3226292605, 3964310813, 907141618,  1579492413,
+            2652280827, 956892231,  3403038209, 265189015,  2302599436, 740665892,  3296503983,
+            3671011394, 2420287626, 511167561,  1180224862, 360571978,  899621288,  928417047,
+            1744635551, 1826661439, 2622563356, 1575999487, 3232210001, 145887364,  1536281720,
+            3540684674, 3482604768, 1027911561, 4034013589, 2857542149, 1807535706, 414942591,
+            3535119186, 95492974,   2056543038, 2862086816, 1492020503, 499121768,  4194383035,
+            2887366013, 2429491453, 3375077821, 60266898,   2645155665, 1797355784, 1032132580,
+            1739803115, 187075426,  2040437990, 1081978912, 4156385502, 2089937959, 2805842211,
+            1508077287, 1649789770, 3932898591, 3712840041, 2629619148, 1193668384, 375180696,
+            691540399,  2223313378, 305151209,  2637518699, 2947112950, 2894363803, 3357937749,
+            3843885649, 1678981539, 3029836837, 1943105589, 1145495605, 1975048448, 1010569472,
+            4139719786, 221160858,  3130770587, 2603841009, 3400484592, 1219964996, 4014581986,
+            3556888022, 3278318493, 1885985813, 1702666089, 3419712487, 1197173887, 1863150024,
+            608427648,  2098643261, 3872337787, 2652054581, 3864702028, 958744771,  2849744516,
+            2674758897, 573295722,  765229792,  806621230,  4125867244, 2854693322, 2579783391,
+            778699793,  146473863,  2864420780, 4090493074, 602560371,  1663303039, 1132651696,
+            2374225586, 548826903,  3274816253, 547542908,  3280903048, 4033312385, 318976430,
+            2543235687, 508610207,  1224380713, 2656310264, 3207989199, 4226573821, 1549671241,
+            2819074001, 2312088459, 4197888875, 4120875957, 1692274382, 3268715557, 1249473469,
+            761514426,  3329545695, 1339406016, 2629178618, 2658277828, 3401344784, 1951338036,
+            1979737568, 3577508475, 2579249771, 2840880614, 3879000796, 1588649451, 480454152,
+            2000826801, 3062255076, 3229056049, 1539523759, 767226734,  1588708322, 3500512184,
+            1708121146, 3295624567, 2524563246, 1137283996, 263486811,  2052530021, 3632336247,
+            3625445099, 530586118,  2385746473, 4252094469, 3964310813, 907141618,  1579492413,
+            2652280827, 510086302,  3403038209, 265189015,  2302599436, 740665892,  3679069040,
+            3671011394, 2420287626, 511167561,  1180224862, 300797377,  899621288,  928417047,
+            1744635551, 1826661439, 368966893,  1575999487, 3232210001, 145887364,  1536281720,
+            3842180433, 3482604768, 1027911561, 4034013589, 2857542149, 553474082,  414942591,
+            3535119186, 95492974,   2056543038, 2873869141, 1161314518, 4214561400, 4244846808,
+            2744970413, 998562728,  175688973,  1863141381, 1732102090, 325946105,  100781132,
+            3792643295, 93502701,   1796834349, 1328979632, 1634974831, 2747588745, 1839482115,
+            1707615741, 3581554302, 3063803540, 2746393798, 4231468571, 4068892936, 732595885,
+            4174876440, 1726094490, 2509852830, 527512635,  1425248178, 2210242936, 3971683152,
+            387294246,  1683139261, 206979647,  3190206657, 1767728297, 1368329753, 3538403529,
+            918050659,  3361880891, 3275325201, 1234475059, 3480234557, 1054852140, 447775328,
+            3779817709, 400372686,  3828081791, 2828677849, 2803933821, 515095847,  391395128,
+            3700640935, 1396836527, 2470261853, 1298838448, 3210010576, 316705728,  3562731193,
+            2982183089, 295604947,  1280046334, 3105414741, 205141053,  804929371,  905013438,
+            2208238500, 701319631,  1716674943, 4274549541, 1726669783, 4018447647, 4073162037,
+            1104558765, 1078240216, 342147116,  2492538067, 1868684285, 47477951,   2188762632,
+            1883839693, 3309779589, 1086936708, 3478490045, 2211383610, 2550425355, 2733195756,
+            3844390684, 4209262325, 3150497665, 3930962871, 1589757082, 1049784618, 2119923187,
+            2534529289, 2690059139, 947805350,  2647841219, 3468355372, 1705668770, 2875121879,
+            3446996264, 298372801,  2908178049, 3760655308, 1723022766, 4023015713, 2517576290,
+            2972713383, 2753228675, 3495064035, 2726760853, 179337060,  2006682665, 4046587733,
+            3623674341, 958042527,  3441043243, 4134331405, 3132857921, 271218719,  159400338,
+            623096363,  4183898216, 1637936318, 3620321636, 1701205323, 1350376052, 3455388885,
+            3024085585, 689317081,  2240648607, 597309615,  1043967373, 1124153994, 713641229,
+            1652126106, 2025803962, 1056552459, 3502700859, 3240834298, 4105442642, 3286405189,
+            2753533658, 1259898335, 1592097074, 51031757,   3282907804, 3407815192, 2202962454,
+            1716358983, 2849627047, 2493346862, 1693408699, 2999080183, 2453605589, 2323941802,
+            1479617272, 1568682390,
+        },
+        {
+            3672467167, 68684525,   1738833632, 3081329135, 2583806115, 2291130512, 503032614,
+            3658059597, 571493931,  685537959,  3498787788, 422428426,  3879256913, 1173158320,
+            4000800121, 298972869,  1718342816, 2541691685, 2490502642, 2321452806, 4223212804,
+            1812334632, 3717655725, 4238191852, 3001307165, 2621896355, 2572404999, 3590094954,
+            760765206,  2293618001, 1392353032, 1733137169, 2674005018, 4067961151, 1505710487,
+            451078217,  2591688848, 12635611,   507045428,  694822241,  1789383090, 1140183890,
+            1720695967, 1994318191, 3340349873, 2793804971, 1054433135, 2345087879, 3179939285,
+            1651968615, 1793223686, 1055357758, 914271617,  483007580,  2127727816, 2754998083,
+            3179053982, 598442002,  1950227301, 213053613,  3566888111, 2832258993, 4260365359,
+            443662829,  1706542890, 3852730296, 3643260763, 2163607277, 1812905006, 171529637,
+            215187467,  2369406909, 1929000706, 2572441025, 2133955541, 810692262,  1337974799,
+            4030350704, 2159178715, 3769451556, 1026825278, 593628480,  1817383139, 878832429,
+            2253876350, 203612980,  2102950440, 3407143936, 1912362251, 1595387637, 2827580539,
+            305467658,  3292706746, 44135525,   4001933553, 3697343089, 760470915,  587414402,
+            1419378814, 2852774010, 3891626781, 2757016765, 1090707384, 3997074427, 1047182100,
+            2855539022, 36229159,   1591415533, 3471572739, 1237952140, 2614469314, 213338525,
+            886212578,  2620301943, 713590207,  2430496777, 1198164420, 2644841698, 3654164701,
+            36283572,   1461695896, 1770331341, 1641501876, 3470919184, 3181021559, 3053795110,
+            3533531372, 3134337355, 668308383,  388340999,  3221275220, 1589659138, 294382235,
+            1447443579, 690177534,  1799726917, 2838977761, 4172949119, 2360858031, 159385920,
+            2248389027, 1790015671, 3925738275, 1049918544, 4107349511, 1619955951, 4188275966,
+            1672572975, 2672697497, 1863413666, 747724021,  4037561738, 1605940213, 445253292,
+            3362434828, 610898209,  1473244091, 735444769,  1540599852, 2449351720, 1032410949,
+            3672467167, 68684525,   1738833632, 3081329135, 519684794,  2291130512, 503032614,
+            3658059597, 571493931,  2400186105, 3498787788, 422428426,  3879256913, 1173158320,
+            4120704752, 298972869,  1718342816, 2541691685, 2490502642, 1686027891, 4223212804,
+            1812334632, 3717655725, 4238191852, 642431972,  2621896355, 2572404999, 3590094954,
+            760765206,  2949609717, 1392353032, 1733137169, 2674005018, 4067961151, 1526077846,
+            451078217,  2591688848, 12635611,   507045428,  2417951415, 1789383090, 1140183890,
+            1720695967, 1994318191, 3465605863, 2793804971, 1054433135, 2345087879, 3179939285,
+            3079297626, 1793223686, 1055357758, 914271617,  483007580,  306802527,  2754998083,
+            3179053982, 598442002,  1950227301, 2473418737, 3566888111, 2832258993, 4260365359,
+            443662829,  2097776414, 3852730296, 3643260763, 2163607277, 1812905006, 3957721904,
+            215187467,  2369406909, 1929000706, 2572441025, 3779486126, 810692262,  1337974799,
+            4030350704, 2159178715, 1127012865, 1026825278, 593628480,  1817383139, 878832429,
+            361018423,  203612980,  2102950440, 3407143936, 1912362251, 1475218277, 2827580539,
+            305467658,  3292706746, 44135525,   1900092336, 3697343089, 760470915,  587414402,
+            1419378814, 343303227,  3891626781, 2757016765, 1090707384, 3997074427, 745490961,
+            2855539022, 36229159,   1591415533, 3471572739, 3920625546, 2614469314, 213338525,
+            886212578,  2620301943, 827771411,  2430496777, 1198164420, 2644841698, 3654164701,
+            2747674190, 1461695896, 1770331341, 1641501876, 3470919184, 919857376,  3053795110,
+            3533531372, 3134337355, 668308383,  201138876,  3221275220, 1589659138, 294382235,
+            1447443579, 4211579707, 1799726917, 2838977761, 4172949119, 2360858031, 416103844,
+            2248389027, 1790015671, 3925738275, 1049918544, 3481887924, 1619955951, 4188275966,
+            1672572975, 2672697497, 564854400,  747724021,  4037561738, 1605940213, 445253292,
+            604900912,  610898209,  1473244091, 735444769,  1540599852, 3036173307, 1032410949,
+            3672467167, 68684525,   1738833632, 973022696,  519684794,  2291130512, 503032614,
+            3658059597, 1500301452, 2400186105, 3498787788, 422428426,  3879256913, 3923611748,
+            4120704752, 298972869,  1718342816, 2541691685, 2323881484, 1686027891, 4223212804,
+            1812334632, 3717655725, 2109094458, 642431972,  2621896355, 2572404999, 3590094954,
+            1837882537, 2949609717, 1392353032, 1733137169, 2674005018, 3252348987, 1526077846,
+            451078217,  2591688848, 12635611,   3971261781, 2417951415, 1789383090, 1140183890,
+            1720695967, 2906966040, 3465605863, 2793804971, 1054433135, 2345087879, 915518921,
+            3079297626, 1793223686, 1055357758, 914271617,  791633499,  306802527,  2754998083,
+            3179053982, 598442002,  324402573,  2473418737, 3566888111, 2832258993, 4260365359,
+            2168046398, 2097776414, 3852730296, 3643260763, 2163607277, 2595175979, 3957721904,
+            215187467,  2369406909, 1929000706, 657446369,  3779486126, 810692262,  1337974799,
+            4030350704, 1865557469, 1127012865, 1026825278, 593628480,  1817383139, 3414354529,
+            361018423,  203612980,  2102950440, 3407143936, 1739372987, 1475218277, 2827580539,
+            305467658,  3292706746, 825045562,  1900092336, 3697343089, 760470915,  587414402,
+            2000637694, 343303227,  3891626781, 2757016765, 1090707384, 4015377800, 745490961,
+            2855539022, 36229159,   1591415533, 2208656873, 3920625546, 2614469314, 213338525,
+            886212578,  2729976209, 827771411,  2430496777, 1198164420, 2644841698, 1922667440,
+            2747674190, 1461695896, 1770331341, 1641501876, 357535311,  919857376,  3053795110,
+            3533531372, 3134337355, 1004072597, 201138876,  3221275220, 1589659138, 294382235,
+            1148950143, 4211579707, 1799726917, 2838977761, 4172949119, 892664404,  416103844,
+            2248389027, 1790015671, 3925738275, 2612357890, 3481887924, 1619955951, 4188275966,
+            1672572975, 2005534713, 564854400,  747724021,  4037561738, 1605940213, 2620990454,
+            604900912,  610898209,  1473244091, 735444769,  3571225334, 3036173307, 1032410949,
+            3672467167, 68684525,   3327351604, 973022696,  519684794,  2291130512, 503032614,
+            3814902238, 1500301452, 2400186105, 3498787788, 422428426,  1756753750, 3923611748,
+            4120704752, 298972869,  1718342816, 652903081,  2323881484, 1686027891, 4223212804,
+            1812334632, 1599640566, 2109094458, 642431972,  2621896355, 2572404999, 1668409355,
+            1837882537, 2949609717, 1392353032, 1733137169, 3691709793, 3252348987, 1526077846,
+            451078217,  2591688848, 3353622601, 3971261781, 2417951415, 1789383090, 1140183890,
+            4113853791, 2906966040, 3465605863, 2793804971, 1054433135, 2195882948, 915518921,
+            3079297626, 1793223686, 1055357758, 898713552,  791633499,  306802527,  2754998083,
+            3179053982, 2469350088, 324402573,  2473418737, 3566888111, 2832258993, 1377718274,
+            2168046398, 2097776414, 3852730296, 3643260763, 3492388484, 2595175979, 3957721904,
+            215187467,  2369406909, 4243449339, 657446369,  3779486126, 810692262,  1337974799,
+            3960230785, 1865557469, 1127012865, 1026825278, 593628480,  732793312,  3414354529,
+            361018423,  203612980,  2102950440, 2401792405, 1739372987, 1475218277, 2827580539,
+            305467658,  2454275289, 825045562,  1900092336, 3697343089, 760470915,  2146882409,
+            2000637694, 343303227,  3891626781, 2757016765, 3997473261, 4015377800, 745490961,
+            2855539022, 36229159,   2375394427, 2208656873, 3920625546, 2614469314, 213338525,
+            2055366274, 2729976209, 827771411,  2430496777, 1198164420, 1789631187, 1922667440,
+            2747674190, 1461695896, 1770331341, 4284442852, 357535311,  919857376,  3053795110,
+            3533531372, 2124270060, 1004072597, 201138876,  3221275220, 1589659138, 1418386120,
+            1148950143, 4211579707, 1799726917, 2838977761, 3540708069, 892664404,  416103844,
+            2248389027, 1790015671, 3936883,    2612357890, 3481887924, 1619955951, 4188275966,
+            2963623483, 2005534713, 564854400,  747724021,  4037561738, 3431155922, 2620990454,
+            604900912,  610898209,  1473244091, 3880001339, 2879060316, 3300897679, 3960972039,
+            3201086624, 3814462934, 3426650044, 1930881632, 1981178788, 2956279691, 4272406256,
+            372705521,  1359389771, 1590302979, 3940206208, 3817999127, 2527835456, 2739078164,
+            716997849,  3235607043, 2550297745, 3688700200, 354502605,  2285793656, 2339138034,
+            3912354142, 2262255668, 469322622,  1319943359, 1916101235, 200441823,  509436982,
+            2160284593, 1687919695, 4153615582, 495735041,  3694469424, 2086893117, 4223008799,
+            105344742,  1698033424, 1149223145, 4183918790, 4176151950, 415739351,  817762972,
+            3768072560, 1931430949, 2698979439, 3481477932, 1994322914, 4078299950, 1268233995,
+            3254069145, 91029129,   498234704,  1636613942, 3710087092, 3876816560, 3510446387,
+            3870169008, 1370156410, 2442498047, 2324396523, 1258730334, 621954739,  1053015373,
+            491820717,  3386515432, 2203703266, 120167176,  2383669740, 1038666440, 2927342870,
+            3583197824, 1236241846, 2474675929, 679052891,  2451259584, 2177706146, 606842882,
+            3546980104, 2289281509, 353873434,  2041926837, 1238346748, 2729109726, 2843938395,
+            2938124210, 2554443866, 1494477920, 693378319,  2020963566, 2000385949, 3744098787,
+            650307220,  2631327075, 1529128757, 595871428,  3206666562, 458062987,  875238192,
+            3729317374, 1368843921, 3478430230, 3234384578, 3232435428, 321359326,  994274524,
+            361184397,  4285497594, 915263578,  1486882838, 9988613,    829077170,  677216046,
+            4141828204, 165804609,  1086678519, 2933434608, 1351662802, 2640085040, 2611502932,
+            2033698714, 2008873254, 3995557835, 1020873906, 67873555,   2230337823, 1263800417,
+            1148712155, 3985159589, 2979503513, 2854714997, 1539343345, 2751484352, 1569100732,
+            2020758949, 2126757134, 3426641899, 2808587825, 1953320148, 1096398464, 1502907172,
+            3751230087, 765557661,  765290990,  3056075500, 2040620632, 422573751,  3613558930,
+            1741145769, 273531216,  837238736,  494297893,  2903251124, 1636782182, 4256592784,
+            3652746656, 4258393217,
+        },
+        {
+            3963931157, 216777741,  1101514797, 532096953,  3426232083, 3788882013, 1282589229,
+            3173668428, 1661908106, 3800142411, 245446097,  928894309,  1070085982, 1154967743,
+            2726339337, 4043382644, 1953729177, 3393496831, 3416495107, 3912947532, 1809431356,
+            3399423953, 358832938,  3833807015, 3646289618, 2525209404, 4249451794, 81437713,
+            572646649,  2788639973, 2908324615, 3516161364, 1444325808, 1385271470, 3441465746,
+            3459906338, 3896509015, 2915982891, 1627203859, 2982333695, 1419776191, 2186448071,
+            3113257607, 1899491231, 81076624,   3217097549, 3922079684, 4013195993, 3250737764,
+            387126838,  1536210671, 1213076068, 1906651616, 654713029,  3324239183, 2878541386,
+            2797640695, 911649168,  2835305208, 3149367912, 570677046,  1702688956, 2397005606,
+            4015291628, 130764647,  2747616871, 1087392097, 3145204317, 1473283097, 3215653373,
+            203369221,  1862879244, 2282848751, 2659042107, 2932003419, 2568898686, 3094785597,
+            474158906,  1299571118, 1428266038, 4137056306, 543183846,  1258933470, 2369323677,
+            1928638601, 2554554867, 1208974756, 1411996873, 3160352522, 1102644684, 3623301748,
+            3317671121, 2162022089, 2525827643, 3921935830, 3392063286, 3754422701, 2149705072,
+            1733728877, 1403123949, 2419841031, 1038968331, 2608182377, 4202765804, 2311802984,
+            189123777,  2160813333, 445257662,  2914698589, 4183352218, 126563014,  1936875431,
+            3269776118, 2166196540, 3375119064, 208471399,  2853292901, 1279101531, 1141637713,
+            642863467,  2578630030, 1418436274, 1989782275, 1927045491, 3326973198, 1499894297,
+            75525463,   1213100805, 2925771894, 3655866501, 828075178,  1624342150, 2712980125,
+            1434598840, 148999294,  2778338230, 980548418,  1385618078, 2173552693, 3986613276,
+            1092250394, 2506990430, 2099615387, 1594208023, 1871293921, 679016030,  3475555194,
+            4175686563, 2798400641, 2988633515, 1494162497, 3994860948, 4279208070, 2974764426,
+            2635806699, 806064710,  489103395,  2074139111, 3104580356, 3226893874, 3547761645,
+            3963931157, 216777741,  1101514797, 532096953,  3206186214, 3788882013, 1282589229,
+            3173668428, 1661908106, 3021563479, 245446097,  928894309,  1070085982, 1154967743,
+            1823683140, 4043382644, 1953729177, 3393496831, 3416495107, 634698409,  1809431356,
+            3399423953, 358832938,  3833807015, 2980034384, 2525209404, 4249451794, 81437713,
+            572646649,  3173830085, 2908324615, 3516161364, 1444325808, 1385271470, 2446387653,
+            3459906338, 3896509015, 2915982891, 1627203859, 3835896900, 1419776191, 2186448071,
+            3113257607, 1899491231, 1391047335, 3217097549, 3922079684, 4013195993, 3250737764,
+            2795224941, 1536210671, 1213076068, 1906651616, 654713029,  1871255359, 2878541386,
+            2797640695, 911649168,  2835305208, 3318096843, 570677046,  1702688956, 2397005606,
+            4015291628, 1769126543, 2747616871, 1087392097, 3145204317, 1473283097, 2534986901,
+            203369221,  1862879244, 2282848751, 2659042107, 2644397706, 2568898686, 3094785597,
+            474158906,  1299571118, 485934949,  4137056306, 543183846,  1258933470, 2369323677,
+            322761346,  2554554867, 1208974756, 1411996873, 3160352522, 3255344374, 3623301748,
+            3317671121, 2162022089, 2525827643, 865193920,  3392063286, 3754422701, 2149705072,
+            1733728877, 2455683429, 2419841031, 1038968331, 2608182377, 4202765804, 1649524388,
+            189123777,  2160813333, 445257662,  2914698589, 958343856,  126563014,  1936875431,
+            3269776118, 2166196540, 3567508269, 208471399,  2853292901, 1279101531, 1141637713,
+            1815991350, 2578630030, 1418436274, 1989782275, 1927045491, 1779793601, 1499894297,
+            75525463,   1213100805, 2925771894, 63758760,   828075178,  1624342150, 2712980125,
+            1434598840, 3922245395, 2778338230, 980548418,  1385618078, 2173552693, 1426990935,
+            1092250394, 2506990430, 2099615387, 1594208023, 3973097144, 679016030,  3475555194,
+            4175686563, 2798400641, 3749740083, 1494162497, 3994860948, 4279208070, 2974764426,
+            1242203581, 806064710,  489103395,  2074139111, 3104580356, 4242742320, 3547761645,
+            3963931157, 216777741,  1101514797, 3388954621, 3206186214, 3788882013, 1282589229,
+            3173668428, 1685053849, 3021563479, 245446097,  928894309,  1070085982, 2088393733,
+            1823683140, 4043382644, 1953729177, 3393496831, 2109966006, 634698409,  1809431356,
+            3399423953, 358832938,  765897248,  2980034384, 2525209404, 4249451794, 81437713,
+            3855659682, 3173830085, 2908324615, 3516161364, 1444325808, 3231160010, 2446387653,
+            3459906338, 3896509015, 2915982891, 4085534944, 3835896900, 1419776191, 2186448071,
+            3113257607, 2428204726, 1391047335, 3217097549, 3922079684, 4013195993, 908485244,
+            2795224941, 1536210671, 1213076068, 1906651616, 2343294176, 1871255359, 2878541386,
+            2797640695, 911649168,  2950442104, 3318096843, 570677046,  1702688956, 2397005606,
+            953372144,  1769126543, 2747616871, 1087392097, 3145204317, 2753916901, 2534986901,
+            203369221,  1862879244, 2282848751, 2778438256, 2644397706, 2568898686, 3094785597,
+            474158906,  3900353409, 485934949,  4137056306, 543183846,  1258933470, 3028362302,
+            322761346,  2554554867, 1208974756, 1411996873, 194804146,  3255344374, 3623301748,
+            3317671121, 2162022089, 2211700745, 865193920,  3392063286, 3754422701, 2149705072,
+            2542028995, 2455683429, 2419841031, 1038968331, 2608182377, 145150974,  1649524388,
+            189123777,  2160813333, 445257662,  3817855698, 958343856,  126563014,  1936875431,
+            3269776118, 2665533624, 3567508269, 208471399,  2853292901, 1279101531, 795773696,
+            1815991350, 2578630030, 1418436274, 1989782275, 727833985,  1779793601, 1499894297,
+            75525463,   1213100805, 2216796905, 63758760,   828075178,  1624342150, 2712980125,
+            2333576139, 3922245395, 2778338230, 980548418,  1385618078, 2364293103, 1426990935,
+            1092250394, 2506990430, 2099615387, 2505669645, 3973097144, 679016030,  3475555194,
+            4175686563, 2005572655, 3749740083, 1494162497, 3994860948, 4279208070, 545200833,
+            1242203581, 806064710,  489103395,  2074139111, 1735591189, 4242742320, 3547761645,
+            3963931157, 216777741,  3675658124, 3388954621, 3206186214, 3788882013, 1282589229,
+            4010194507, 1685053849, 3021563479, 245446097,  928894309,  2321679293, 2088393733,
+            1823683140, 4043382644, 1953729177, 3892677707, 2109966006, 634698409,  1809431356,
+            3399423953, 3503290753, 765897248,  2980034384, 2525209404, 4249451794, 2734522544,
+            3855659682, 3173830085, 2908324615, 3516161364, 1442518010, 3231160010, 2446387653,
+            3459906338, 3896509015, 3297226048, 4085534944, 3835896900, 1419776191, 2186448071,
+            1832894710, 2428204726, 1391047335, 3217097549, 3922079684, 3126958640, 908485244,
+            2795224941, 1536210671, 1213076068, 1161534478, 2343294176, 1871255359, 2878541386,
+            2797640695, 3129301650, 2950442104, 3318096843, 570677046,  1702688956, 2384236752,
+            953372144,  1769126543, 2747616871, 1087392097, 3255132372, 2753916901, 2534986901,
+            203369221,  1862879244, 3560687524, 2778438256, 2644397706, 2568898686, 3094785597,
+            3822092042, 3900353409, 485934949,  4137056306, 543183846,  2741641545, 3028362302,
+            322761346,  2554554867, 1208974756, 141352351,  194804146,  3255344374, 3623301748,
+            3317671121, 2126949987, 2211700745, 865193920,  3392063286, 3754422701, 540511501,
+            2542028995, 2455683429, 2419841031, 1038968331, 2760815137, 145150974,  1649524388,
+            189123777,  2160813333, 1690209971, 3817855698, 958343856,  126563014,  1936875431,
+            826294856,  2665533624, 3567508269, 208471399,  2853292901, 757974182,  795773696,
+            1815991350, 2578630030, 1418436274, 3484196530, 727833985,  1779793601, 1499894297,
+            75525463,   1344783732, 2216796905, 63758760,   828075178,  1624342150, 2648676079,
+            2333576139, 3922245395, 2778338230, 980548418,  2006240470, 2364293103, 1426990935,
+            1092250394, 2506990430, 1453061907, 2505669645, 3973097144, 679016030,  3475555194,
+            1080014424, 2005572655, 3749740083, 1494162497, 3994860948, 1883486351, 545200833,
+            1242203581, 806064710,  489103395,  697020048,  610091753,  158305681,  1543665489,
+            2818489936, 627075741,  1710918340, 383298088,  2419740738, 3518685635, 1762830512,
+            3637566600, 1976966818, 1924907529, 1908639718, 1386521048, 2797544443, 783700388,
+            469976595,  2585182723, 1789258092, 3520189256, 2249945389, 397935380,  389803601,
+            2609706965, 3135076113, 972586636,  2689954268, 596921939,  1589953139, 3379110835,
+            3010771708, 232353854,  3198137505, 2121892254, 4101189210, 1577461235, 1997839204,
+            520695899,  1399961199, 705242323,  3027749008, 1801082489, 691292056,  4053694789,
+            2927862717, 674412544,  356687027,  62768706,   894460272,  2681023469, 58787591,
+            505366424,  3824222325, 3757161534, 1793236323, 3099744082, 2787397661, 3137021420,
+            3187621884, 1845148835, 999209645,  382599518,  3655375195, 841095694,  369782027,
+            1872336404, 2839435708, 2215666392, 285003949,  2859093654, 3137732594, 2793337090,
+            1062379072, 4029201747, 1502289617, 1903104112, 3075242939, 828682340,  1786829261,
+            4188547702, 3901134904, 3979169587, 1291091209, 2855593941, 1094760175, 2950001959,
+            2397795587, 1110032758, 2022964975, 3041582721, 2321799781, 2503164999, 2808381830,
+            2107139110, 2373948625, 1539122497, 523666337,  4200210036, 1895337137, 4183038415,
+            425529454,  1464814088, 2135339956, 1209954419, 1511319542, 839053990,  1417796998,
+            3948480676, 3317038577, 884309334,  3713532628, 3852531637, 405716813,  2384551572,
+            1427198361, 1998219552, 792877795,  3714355612, 2845513843, 2005746018, 3696007939,
+            3090293179, 2093854188, 3062113700, 1622197934, 80908676,   3030194659, 3681672164,
+            2512260628, 174237008,  31973329,   4194662974, 3975163104, 3933228357, 3169576961,
+            2365319406, 4266380824, 2325989878, 4080770487, 2226082145, 138636942,  1565346265,
+            475472579,  429424056,  1325632171, 3663394470, 915034142,  519218752,  3489361456,
+            2409945192, 4163781703, 665729652,  2124490293, 3410244523, 3137833764, 2608370149,
+            3513914456, 3782837790,
+        },
+        {
+            3226719582, 2263373742, 3911232170, 1676445627, 689582522,  2562760629, 1172691660,
+            3066921598, 4114227903, 2113800438, 3265415458, 2219593443, 1041363353, 2831778035,
+            3416302809, 3366689985, 1275367773, 3376641161, 3089727134, 613305694,  1231513546,
+            399858315,  1250173725, 4195714857, 994288691,  1358970514, 3291110403, 95038871,
+            521473558,  535024823,  1621933467, 3029119600, 3942603894, 2499463949, 4270833446,
+            256306357,  2465601811, 3247363485, 2819806572, 2630448239, 1128158007, 1468669804,
+            785071742,  656156867,  1259802051, 4195729674, 2179499115, 4188523730, 2026176609,
+            2174574632, 1598872418, 233452734,  4103612159, 1792901525, 385764625,  1585031549,
+            3577180857, 1780848793, 3675722415, 2767880915, 539918016,  2092712646, 4268727448,
+            707069452,  2476955437, 2748170059, 1745344547, 1952953253, 4233985131, 3175511218,
+            2305700420, 2209576121, 1081663512, 2492607223, 240781308,  3164395285, 1007184136,
+            883667735,  2516483324, 1317971331, 1999852561, 1181256242, 3343037910, 3754140235,
+            3230524116, 1043430220, 2237579989, 1421063375, 650862536,  500195385,  3844318282,
+            1080870179, 1314917272, 3386113883, 2934937701, 1727532521, 1015781007, 15094245,
+            46136242,   3173675339, 1613246692, 1936588388, 932807914,  1386894578, 3408815219,
+            192754555,  1673168264, 798050805,  2773139082, 2675716403, 907458901,  2887499477,
+            1482949876, 4125403335, 1084086086, 993363739,  998498902,  925132444,  311341410,
+            2393892110, 372002362,  36217916,   1692512806, 661948421,  3524175979, 1760988122,
+            3606344669, 1932451156, 2295547948, 3600688380, 842354888,  1571133633, 1826673825,
+            511375656,  589197489,  1284295544, 2120354341, 605839693,  4000990206, 2760194184,
+            3704648828, 1655582789, 917685812,  1023987375, 1744477122, 134063342,  4239870640,
+            719820264,  2212509454, 2305107591, 795536031,  1847185835, 867576645,  638131327,
+            1917605966, 3176287909, 3677522813, 1757369973, 2601396974, 1648158332, 625253491,
+            3226719582, 2263373742, 3911232170, 1676445627, 1585621523, 2562760629, 1172691660,
+            3066921598, 4114227903, 2218840685, 3265415458, 2219593443, 1041363353, 2831778035,
+            135596842,  3366689985, 1275367773, 3376641161, 3089727134, 3865220600, 1231513546,
+            399858315,  1250173725, 4195714857, 2357020518, 1358970514, 3291110403, 95038871,
+            521473558,  439944052,  1621933467, 3029119600, 3942603894, 2499463949, 1888363604,
+            256306357,  2465601811, 3247363485, 2819806572, 151442410,  1128158007, 1468669804,
+            785071742,  656156867,  631232454,  4195729674, 2179499115, 4188523730, 2026176609,
+            1494367322, 1598872418, 233452734,  4103612159, 1792901525, 2637880837, 1585031549,
+            3577180857, 1780848793, 3675722415, 195352857,  539918016,  2092712646, 4268727448,
+            707069452,  2848573484, 2748170059, 1745344547, 1952953253, 4233985131, 1485281313,
+            2305700420, 2209576121, 1081663512, 2492607223, 2851167044, 3164395285, 1007184136,
+            883667735,  2516483324, 2171611524, 1999852561, 1181256242, 3343037910, 3754140235,
+            1038286476, 1043430220, 2237579989, 1421063375, 650862536,  2335313207, 3844318282,
+            1080870179, 1314917272, 3386113883, 2776110534, 1727532521, 1015781007, 15094245,
+            46136242,   3199458790, 1613246692, 1936588388, 932807914,  1386894578, 772373907,
+            192754555,  1673168264, 798050805,  2773139082, 2267509286, 907458901,  2887499477,
+            1482949876, 4125403335, 3164493050, 993363739,  998498902,  925132444,  311341410,
+            1743473885, 372002362,  36217916,   1692512806, 661948421,  2485159104, 1760988122,
+            3606344669, 1932451156, 2295547948, 2465777465, 842354888,  1571133633, 1826673825,
+            511375656,  2053020354, 1284295544, 2120354341, 605839693,  4000990206, 2910292131,
+            3704648828, 1655582789, 917685812,  1023987375, 3670953004, 134063342,  4239870640,
+            719820264,  2212509454, 3673188198, 795536031,  1847185835, 867576645,  638131327,
+            4178372568, 3176287909, 3677522813, 1757369973, 2601396974, 184365350,  625253491,
+            3226719582, 2263373742, 3911232170, 495215641,  1585621523, 2562760629, 1172691660,
+            3066921598, 609689528,  2218840685, 3265415458, 2219593443, 1041363353, 1326016411,
+            135596842,  3366689985, 1275367773, 3376641161, 3326002096, 3865220600, 1231513546,
+            399858315,  1250173725, 859447769,  2357020518, 1358970514, 3291110403, 95038871,
+            1494575777, 439944052,  1621933467, 3029119600, 3942603894, 646723916,  1888363604,
+            256306357,  2465601811, 3247363485, 1327163996, 151442410,  1128158007, 1468669804,
+            785071742,  3342545812, 631232454,  4195729674, 2179499115, 4188523730, 1537777554,
+            1494367322, 1598872418, 233452734,  4103612159, 229900584,  2637880837, 1585031549,
+            3577180857, 1780848793, 348034063,  195352857,  539918016,  2092712646, 4268727448,
+            1370105335, 2848573484, 2748170059, 1745344547, 1952953253, 2485767121, 1485281313,
+            2305700420, 2209576121, 1081663512, 1270332254, 2851167044, 3164395285, 1007184136,
+            883667735,  797428598,  2171611524, 1999852561, 1181256242, 3343037910, 3741395086,
+            1038286476, 1043430220, 2237579989, 1421063375, 3872979540, 2335313207, 3844318282,
+            1080870179, 1314917272, 3381258651, 2776110534, 1727532521, 1015781007, 15094245,
+            3308124042, 3199458790, 1613246692, 1936588388, 932807914,  3954083451, 772373907,
+            192754555,  1673168264, 798050805,  520073793,  2267509286, 907458901,  2887499477,
+            1482949876, 4045191970, 3164493050, 993363739,  998498902,  925132444,  100350379,
+            1743473885, 372002362,  36217916,   1692512806, 2671758559, 2485159104, 1760988122,
+            3606344669, 1932451156, 3133296326, 2465777465, 842354888,  1571133633, 1826673825,
+            1630190974, 2053020354, 1284295544, 2120354341, 605839693,  3859696545, 2910292131,
+            3704648828, 1655582789, 917685812,  3465037181, 3670953004, 134063342,  4239870640,
+            719820264,  3519413895, 3673188198, 795536031,  1847185835, 867576645,  3975989089,
+            4178372568, 3176287909, 3677522813, 1757369973, 3426143973, 184365350,  625253491,
+            3226719582, 2263373742, 3062853671, 495215641,  1585621523, 2562760629, 1172691660,
+            2288795399, 609689528,  2218840685, 3265415458, 2219593443, 4228156623, 1326016411,
+            135596842,  3366689985, 1275367773, 3579199272, 3326002096, 3865220600, 1231513546,
+            399858315,  2883971610, 859447769,  2357020518, 1358970514, 3291110403, 3269438466,
+            1494575777, 439944052,  1621933467, 3029119600, 4025852808, 646723916,  1888363604,
+            256306357,  2465601811, 8412071,    1327163996, 151442410,  1128158007, 1468669804,
+            676804601,  3342545812, 631232454,  4195729674, 2179499115, 3614072652, 1537777554,
+            1494367322, 1598872418, 233452734,  2239518186, 229900584,  2637880837, 1585031549,
+            3577180857, 4183539319, 348034063,  195352857,  539918016,  2092712646, 1878450365,
+            1370105335, 2848573484, 2748170059, 1745344547, 2330960499, 2485767121, 1485281313,
+            2305700420, 2209576121, 2682629435, 1270332254, 2851167044, 3164395285, 1007184136,
+            1322558309, 797428598,  2171611524, 1999852561, 1181256242, 2845404589, 3741395086,
+            1038286476, 1043430220, 2237579989, 3405746273, 3872979540, 2335313207, 3844318282,
+            1080870179, 2409967303, 3381258651, 2776110534, 1727532521, 1015781007, 3945657911,
+            3308124042, 3199458790, 1613246692, 1936588388, 3903559203, 3954083451, 772373907,
+            192754555,  1673168264, 385675635,  520073793,  2267509286, 907458901,  2887499477,
+            3164648327, 4045191970, 3164493050, 993363739,  998498902,  808606264,  100350379,
+            1743473885, 372002362,  36217916,   2651405971, 2671758559, 2485159104, 1760988122,
+            3606344669, 1274426133, 3133296326, 2465777465, 842354888,  1571133633, 3130116725,
+            1630190974, 2053020354, 1284295544, 2120354341, 3995215846, 3859696545, 2910292131,
+            3704648828, 1655582789, 3313702495, 3465037181, 3670953004, 134063342,  4239870640,
+            1987241565, 3519413895, 3673188198, 795536031,  1847185835, 8137994,    3975989089,
+            4178372568, 3176287909, 3677522813, 4106741878, 75370843,   4256150582, 899965470,
+            796736729,  1915731928, 3982408689, 2655204237, 482235300,  2265806552, 936011028,
+            1536375183, 1803096370, 1631607634, 3858905510, 896433241,  2359452348, 2690389626,
+            2214252081, 700970832,  1016018888, 4079785035, 3981396571, 3666512793, 723627139,
+            704541710,  1855581285, 3699362362, 57916105,   2262714174, 3828704156, 347944709,
+            2390333453, 1172319190, 2854670448, 1170772522, 1677136733, 733205345,  1654039968,
+            2552611212, 452304043,  3629981088, 3517404218, 3100393680, 4047150325, 3967971953,
+            2178680710, 1399928725, 3568157541, 3444315380, 844626075,  3285304745, 3516969135,
+            2406106685, 1906964733, 3385467647, 1858664816, 967529109,  4126509209, 3982875187,
+            3257457324, 1189127110, 1617807104, 180915986,  1627053247, 1158234638, 362152839,
+            2722308918, 3824424603, 768538652,  653025918,  1239018132, 131648200,  2710529442,
+            1412673705, 578719333,  1524083405, 1365509129, 1189739479, 262352713,  2106836765,
+            842264777,  1627492619, 1243360621, 1693891903, 1063887156, 3867084102, 3900636545,
+            1844924876, 1211461236, 3856280217, 3660114829, 4275058507, 2094196559, 2977034506,
+            3880552851, 1074009498, 3195839642, 4124443531, 3105483676, 24417457,   2092280500,
+            2859308514, 1507443779, 2920940204, 1888471519, 3506491465, 3094041281, 468927732,
+            1474067998, 4111290741, 3256886930, 154197299,  679522831,  847656386,  686666446,
+            938563739,  4006785751, 708306430,  3468022614, 2532100146, 334874844,  1292340295,
+            2548823563, 2444690947, 1227132853, 2193949939, 2375117734, 1196558737, 2877892752,
+            567379604,  3589229024, 2794921242, 739262104,  3702189453, 2747029970, 675238254,
+            2021327827, 3753357747, 3081090481, 3039517398, 1527348528, 3171366545, 275824178,
+            3433089614, 1441314261, 2422973322, 1591994103, 2217585371, 2211450421, 3217620065,
+            3384416828, 411034811,  3264185309, 3991234882, 823313097,  829353923,  3717343394,
+            614387578,  2580316639,
+        },
+        {
+            2879946359, 2331596569, 477371694,  1517238374, 3933132317, 892751693,  1362176688,
+            1779859277, 3722169855, 3054745605, 1223147886, 2669145571, 1700746932, 1595913845,
+            310122833,  1823947250, 674481592,  3481360670, 490009913,  3391321590, 1946683190,
+            2407507551, 2607816063, 3404335003, 1135033752, 329826583,  1525173912, 849265760,
+            2895183947, 676767266,  989127421,  340238499,  2932022587, 1207485238, 1919750121,
+            2952853345, 1469250422, 2724453016, 80833431,   1610020629, 1065898469, 548686937,
+            1581944994, 3507126832, 3265129520, 3529906050, 3551339984, 3170716887, 2655783227,
+            2370727160, 1438156111, 1271560367, 3017069883, 4004231364, 2539537387, 1791495045,
+            1820885165, 1397304558, 2599110285, 4256869365, 1649295591, 1083315542, 2383644925,
+            1783937928, 511336031,  719141121,  3909984005, 178564516,  4177770100, 4155526511,
+            3476603656, 2477923231, 1457667864, 50047136,   1711348281, 1470163491, 3925874231,
+            3962642976, 1147646470, 3296492883, 1188879213, 3329949,    2105049702, 3084949475,
+            522216382,  3970334019, 1501948841, 1386149144, 2458291565, 4141481560, 2418914624,
+            1081033471, 1372188403, 4239028300, 3036800771, 1829513434, 973921210,  2801961784,
+            3600504429, 1971810186, 1455389859, 229502057,  3069461528, 1794867474, 962101823,
+            1244615513, 830610920,  297438617,  4116786157, 2029533944, 475195158,  2318129411,
+            2635813304, 3717404175, 3677234100, 2428020209, 235124597,  988454102,  689615399,
+            2241790958, 3791001903, 2624499270, 1437812271, 2111039853, 2970121485, 2813509036,
+            3052980424, 3093772580, 2569363504, 195086119,  2344490488, 72747940,   2798959400,
+            2630860374, 257078568,  1910450199, 3310754396, 1815982769, 3005900205, 2742592486,
+            3789298681, 3657214879, 1845915714, 2380758108, 2964657944, 1781919346, 4013604734,
+            4231581112, 3046401602, 1974227379, 3886222641, 2471169468, 1425486811, 3156108441,
+            3002890854, 558959709,  2204082744, 2546323734, 3000096118, 1031570412, 3270189044,
+            2879946359, 2331596569, 477371694,  1517238374, 3178264583, 892751693,  1362176688,
+            1779859277, 3722169855, 3133551984, 1223147886, 2669145571, 1700746932, 1595913845,
+            3485875857, 1823947250, 674481592,  3481360670, 490009913,  464951486,  1946683190,
+            2407507551, 2607816063, 3404335003, 921774956,  329826583,  1525173912, 849265760,
+            2895183947, 4161413649, 989127421,  340238499,  2932022587, 1207485238, 242476504,
+            2952853345, 1469250422, 2724453016, 80833431,   21247658,   1065898469, 548686937,
+            1581944994, 3507126832, 2399020267, 3529906050, 3551339984, 3170716887, 2655783227,
+            1808278574, 1438156111, 1271560367, 3017069883, 4004231364, 2675729888, 1791495045,
+            1820885165, 1397304558, 2599110285, 1501313627, 1649295591, 1083315542, 2383644925,
+            1783937928, 1845889441, 719141121,  3909984005, 178564516,  4177770100, 875765868,
+            3476603656, 2477923231, 1457667864, 50047136,   2602160451, 1470163491, 3925874231,
+            3962642976, 1147646470, 2544656822, 1188879213, 3329949,    2105049702, 3084949475,
+            4206749142, 3970334019, 1501948841, 1386149144, 2458291565, 1731595771, 2418914624,
+            1081033471, 1372188403, 4239028300, 2652834011, 1829513434, 973921210,  2801961784,
+            3600504429, 2308074294, 1455389859, 229502057,  3069461528, 1794867474, 1590395990,
+            1244615513, 830610920,  297438617,  4116786157, 1576703646, 475195158,  2318129411,
+            2635813304, 3717404175, 282194451,  2428020209, 235124597,  988454102,  689615399,
+            206517439,  3791001903, 2624499270, 1437812271, 2111039853, 5812238,    2813509036,
+            3052980424, 3093772580, 2569363504, 1003993079, 2344490488, 72747940,   2798959400,
+            2630860374, 407067809,  1910450199, 3310754396, 1815982769, 3005900205, 2169456741,
+            3789298681, 3657214879, 1845915714, 2380758108, 1814205529, 1781919346, 4013604734,
+            4231581112, 3046401602, 1364614097, 3886222641, 2471169468, 1425486811, 3156108441,
+            3000604946, 558959709,  2204082744, 2546323734, 3000096118, 1720903861, 3270189044,
+            2879946359, 2331596569, 477371694,  3268582168, 3178264583, 892751693,  1362176688,
+            1779859277, 3793144729, 3133551984, 1223147886, 2669145571, 1700746932, 3537192398,
+            3485875857, 1823947250, 674481592,  3481360670, 2194105328, 464951486,  1946683190,
+            2407507551, 2607816063, 3184814049, 921774956,  329826583,  1525173912, 849265760,
+            3476343075, 4161413649, 989127421,  340238499,  2932022587, 2865284612, 242476504,
+            2952853345, 1469250422, 2724453016, 768865575,  21247658,   1065898469, 548686937,
+            1581944994, 1232887919, 2399020267, 3529906050, 3551339984, 3170716887, 3866278660,
+            1808278574, 1438156111, 1271560367, 3017069883, 2302704811, 2675729888, 1791495045,
+            1820885165, 1397304558, 64876419,   1501313627, 1649295591, 1083315542, 2383644925,
+            4124088639, 1845889441, 719141121,  3909984005, 178564516,  3732202719, 875765868,
+            3476603656, 2477923231, 1457667864, 766110504,  2602160451, 1470163491, 3925874231,
+            3962642976, 156863958,  2544656822, 1188879213, 3329949,    2105049702, 2263405500,
+            4206749142, 3970334019, 1501948841, 1386149144, 1941586094, 1731595771, 2418914624,
+            1081033471, 1372188403, 3430142403, 2652834011, 1829513434, 973921210,  2801961784,
+            1917977426, 2308074294, 1455389859, 229502057,  3069461528, 1143410970, 1590395990,
+            1244615513, 830610920,  297438617,  2797231323, 1576703646, 475195158,  2318129411,
+            2635813304, 1989390860, 282194451,  2428020209, 235124597,  988454102,  3955450765,
+            206517439,  3791001903, 2624499270, 1437812271, 2106348122, 5812238,    2813509036,
+            3052980424, 3093772580, 1034295159, 1003993079, 2344490488, 72747940,   2798959400,
+            3305443333, 407067809,  1910450199, 3310754396, 1815982769, 3455931170, 2169456741,
+            3789298681, 3657214879, 1845915714, 1635788359, 1814205529, 1781919346, 4013604734,
+            4231581112, 2113200600, 1364614097, 3886222641, 2471169468, 1425486811, 962642943,
+            3000604946, 558959709,  2204082744, 2546323734, 334841678,  1720903861, 3270189044,
+            2879946359, 2331596569, 535368156,  3268582168, 3178264583, 892751693,  1362176688,
+            119858609,  3793144729, 3133551984, 1223147886, 2669145571, 3845630167, 3537192398,
+            3485875857, 1823947250, 674481592,  1306147690, 2194105328, 464951486,  1946683190,
+            2407507551, 2607972725, 3184814049, 921774956,  329826583,  1525173912, 2286206432,
+            3476343075, 4161413649, 989127421,  340238499,  2946679496, 2865284612, 242476504,
+            2952853345, 1469250422, 636313374,  768865575,  21247658,   1065898469, 548686937,
+            1013442971, 1232887919, 2399020267, 3529906050, 3551339984, 813007439,  3866278660,
+            1808278574, 1438156111, 1271560367, 1112769217, 2302704811, 2675729888, 1791495045,
+            1820885165, 2608878433, 64876419,   1501313627, 1649295591, 1083315542, 655688153,
+            4124088639, 1845889441, 719141121,  3909984005, 1156188529, 3732202719, 875765868,
+            3476603656, 2477923231, 2101362097, 766110504,  2602160451, 1470163491, 3925874231,
+            579001012,  156863958,  2544656822, 1188879213, 3329949,    1808748518, 2263405500,
+            4206749142, 3970334019, 1501948841, 244624314,  1941586094, 1731595771, 2418914624,
+            1081033471, 3696511975, 3430142403, 2652834011, 1829513434, 973921210,  704792652,
+            1917977426, 2308074294, 1455389859, 229502057,  3757420070, 1143410970, 1590395990,
+            1244615513, 830610920,  3160667444, 2797231323, 1576703646, 475195158,  2318129411,
+            1525846081, 1989390860, 282194451,  2428020209, 235124597,  3369859756, 3955450765,
+            206517439,  3791001903, 2624499270, 1047256111, 2106348122, 5812238,    2813509036,
+            3052980424, 1323825232, 1034295159, 1003993079, 2344490488, 72747940,   2308858851,
+            3305443333, 407067809,  1910450199, 3310754396, 3542502729, 3455931170, 2169456741,
+            3789298681, 3657214879, 2155426007, 1635788359, 1814205529, 1781919346, 4013604734,
+            1095782222, 2113200600, 1364614097, 3886222641, 2471169468, 3585281207, 962642943,
+            3000604946, 558959709,  2204082744, 2237583211, 2765188885, 3427591967, 2160090296,
+            1945572048, 262641778,  3097850427, 2518933369, 1789823653, 3165783843, 1586934466,
+            3534949750, 1274548870, 3703386784, 588667604,  1266157624, 2878883564, 1317575829,
+            615513580,  915181625,  846915376,  235888831,  2389156947, 1486827551, 1502871498,
+            2834037653, 3964941914, 1107111387, 3811230411, 2395200050, 2332121605, 2069746793,
+            763565398,  3075254554, 1965515317, 98035203,   935698359,  2783010792, 2123650087,
+            2853230706, 1907342565, 45066012,   3444444402, 1963247843, 1433188859, 3754773690,
+            276659296,  2485568636, 2118244846, 833020456,  2014851980, 2582251548, 1657118301,
+            4171180498, 3161626239, 2645605244, 954992219,  3574001175, 1686403892, 4219034835,
+            1458390247, 3794951881, 3104764603, 534782205,  3224577933, 4091009345, 3441940595,
+            1687763321, 2642488388, 4051773420, 3515333087, 492645701,  4052915105, 290798306,
+            650206958,  3876536294, 1688900839, 788459715,  4113902690, 343470968,  794773839,
+            1491158001, 4287817757, 3181201303, 2254066660, 434438379,  1550743605, 2535333020,
+            1188901545, 2692321526, 2284887531, 851139131,  3572795695, 4172064516, 3515682183,
+            4276459184, 1744670476, 1087507938, 3068998969, 3470406038, 1430048778, 2921997882,
+            3584282172, 2098974494, 135159033,  776222520,  1301853973, 729730019,  167960348,
+            2125997498, 3021958250, 2515899322, 1265509328, 3104579523, 2801423676, 1162629723,
+            3948696365, 1746939904, 356199541,  2487932926, 3507797628, 165407572,  556427796,
+            598404932,  1306267617, 3156815371, 583101932,  2142736553, 1049995775, 3028224338,
+            2643004132, 2015489201, 2946017933, 61124073,   1319588691, 4108489015, 4126134561,
+            1842015846, 298409594,  3062825922, 269791108,  3274891981, 248492527,  2407594378,
+            1851581043, 2692980680, 553299743,  1098549592, 760749313,  1198388083, 2874088965,
+            3927920971, 2548805779, 3334335298, 555673203,  2291344373, 1562390338, 1681976509,
+            3600381359, 4157110770,
+        },
+        {
+            3212670511, 2153890933, 3389886302, 1679212425, 785515994,  1690035549, 962461839,
+            3640286237, 2301044507, 1910937887, 1142148809, 3245573732, 4117348033, 3976342376,
+            3415747994, 3582248192, 1966205684, 2771477410, 2674572269, 876608859,  1434522460,
+            408643068,  3365059323, 3921654422, 1649056382, 2014601419, 1555489831, 1188870717,
+            2171915279, 4255644222, 82775988,   1490062301, 1510938253, 1946745561, 216663702,
+            2100953920, 2053436353, 87855084,   4064756739, 3262919864, 3796114505, 111059952,
+            4158134036, 519828811,  1502095139, 480817312,  3067368763, 1141560125, 1959957723,
+            2360513480, 3023544934, 2523337925, 836886107,  1158245305, 2493334248, 2042859741,
+            3145003667, 875425746,  3021854247, 1658568518, 2885761,    3459772512, 3100734919,
+            1385670675, 1891958720, 1777736228, 914691402,  3793284329, 1426052767, 3494876375,
+            2154155559, 803057789,  2383558656, 3603487205, 3514986451, 1709472704, 3460406793,
+            1004452150, 2944352161, 1411310532, 385359737,  3821256454, 3553084631, 2034479847,
+            2819146749, 406752143,  784756521,  3618615044, 1477019288, 1680600,    2417417802,
+            2281769642, 3202208293, 2059859798, 1962450048, 1706598865, 2955736789, 840128589,
+            2972407555, 1590043562, 3530713159, 213291443,  3957318061, 1510092553, 1577137960,
+            1659634508, 2394399613, 2756077993, 1275222214, 3640461128, 2715808259, 725619310,
+            1112786880, 1521643391, 1758763269, 2337719558, 2251023383, 1752914648, 999489268,
+            1459305500, 2758241773, 1971214466, 2938474470, 2143119156, 2383442154, 949297524,
+            2502051844, 897901634,  4247473697, 1976584440, 2238070868, 3550286351, 756951370,
+            2286225164, 2376523739, 746680483,  731554793,  2064563598, 1619898191, 2033452205,
+            1919758267, 3344692592, 3895181770, 4176278728, 3237981830, 2860981081, 2053769331,
+            157311464,  1201516486, 2484534576, 1975651513, 222498320,  1189392814, 2620758671,
+            54063389,   661698866,  876716783,  2340138819, 4134809989, 414974325,  3414438654,
+            3212670511, 2153890933, 3389886302, 1679212425, 3790319322, 1690035549, 962461839,
+            3640286237, 2301044507, 2383626279, 1142148809, 3245573732, 4117348033, 3976342376,
+            4142800936, 3582248192, 1966205684, 2771477410, 2674572269, 3221539936, 1434522460,
+            408643068,  3365059323, 3921654422, 771191244,  2014601419, 1555489831, 1188870717,
+            2171915279, 320618350,  82775988,   1490062301, 1510938253, 1946745561, 3271824692,
+            2100953920, 2053436353, 87855084,   4064756739, 2043280650, 3796114505, 111059952,
+            4158134036, 519828811,  3157634347, 480817312,  3067368763, 1141560125, 1959957723,
+            2858914969, 3023544934, 2523337925, 836886107,  1158245305, 1757885452, 2042859741,
+            3145003667, 875425746,  3021854247, 120347518,  2885761,    3459772512, 3100734919,
+            1385670675, 2661031647, 1777736228, 914691402,  3793284329, 1426052767, 768521597,
+            2154155559, 803057789,  2383558656, 3603487205, 3388125628, 1709472704, 3460406793,
+            1004452150, 2944352161, 820679032,  385359737,  3821256454, 3553084631, 2034479847,
+            1604307882, 406752143,  784756521,  3618615044, 1477019288, 2996146664, 2417417802,
+            2281769642, 3202208293, 2059859798, 2305609619, 1706598865, 2955736789, 840128589,
+            2972407555, 2954436492, 3530713159, 213291443,  3957318061, 1510092553, 4032708322,
+            1659634508, 2394399613, 2756077993, 1275222214, 2701131602, 2715808259, 725619310,
+            1112786880, 1521643391, 1520119626, 2337719558, 2251023383, 1752914648, 999489268,
+            132023133,  2758241773, 1971214466, 2938474470, 2143119156, 4110135379, 949297524,
+            2502051844, 897901634,  4247473697, 1725478235, 2238070868, 3550286351, 756951370,
+            2286225164, 204194829,  746680483,  731554793,  2064563598, 1619898191, 1908759394,
+            1919758267, 3344692592, 3895181770, 4176278728, 2017413224, 2860981081, 2053769331,
+            157311464,  1201516486, 982921805,  1975651513, 222498320,  1189392814, 2620758671,
+            2892057301, 661698866,  876716783,  2340138819, 4134809989, 77109873,   3414438654,
+            3212670511, 2153890933, 3389886302, 1567957442, 3790319322, 1690035549, 962461839,
+            3640286237, 935321414,  2383626279, 1142148809, 3245573732, 4117348033, 741795793,
+            4142800936, 3582248192, 1966205684, 2771477410, 2040221430, 3221539936, 1434522460,
+            408643068,  3365059323, 3035064600, 771191244,  2014601419, 1555489831, 1188870717,
+            1659397424, 320618350,  82775988,   1490062301, 1510938253, 2960290001, 3271824692,
+            2100953920, 2053436353, 87855084,   2771081412, 2043280650, 3796114505, 111059952,
+            4158134036, 641981117,  3157634347, 480817312,  3067368763, 1141560125, 3789183399,
+            2858914969, 3023544934, 2523337925, 836886107,  2554877500, 1757885452, 2042859741,
+            3145003667, 875425746,  3829356005, 120347518,  2885761,    3459772512, 3100734919,
+            2754364285, 2661031647, 1777736228, 914691402,  3793284329, 3105084886, 768521597,
+            2154155559, 803057789,  2383558656, 520614030,  3388125628, 1709472704, 3460406793,
+            1004452150, 2760554751, 820679032,  385359737,  3821256454, 3553084631, 1136986682,
+            1604307882, 406752143,  784756521,  3618615044, 3551003262, 2996146664, 2417417802,
+            2281769642, 3202208293, 2997834248, 2305609619, 1706598865, 2955736789, 840128589,
+            3380678618, 2954436492, 3530713159, 213291443,  3957318061, 3061718766, 4032708322,
+            1659634508, 2394399613, 2756077993, 277911057,  2701131602, 2715808259, 725619310,
+            1112786880, 1519388368, 1520119626, 2337719558, 2251023383, 1752914648, 3566835597,
+            132023133,  2758241773, 1971214466, 2938474470, 2787782228, 4110135379, 949297524,
+            2502051844, 897901634,  3924587650, 1725478235, 2238070868, 3550286351, 756951370,
+            2027967155, 204194829,  746680483,  731554793,  2064563598, 2816390631, 1908759394,
+            1919758267, 3344692592, 3895181770, 2473875938, 2017413224, 2860981081, 2053769331,
+            157311464,  1886208153, 982921805,  1975651513, 222498320,  1189392814, 2652276669,
+            2892057301, 661698866,  876716783,  2340138819, 910165364,  77109873,   3414438654,
+            3212670511, 2153890933, 627403186,  1567957442, 3790319322, 1690035549, 962461839,
+            3558357884, 935321414,  2383626279, 1142148809, 3245573732, 2885149890, 741795793,
+            4142800936, 3582248192, 1966205684, 4042181787, 2040221430, 3221539936, 1434522460,
+            408643068,  1498836946, 3035064600, 771191244,  2014601419, 1555489831, 2935049386,
+            1659397424, 320618350,  82775988,   1490062301, 2482071158, 2960290001, 3271824692,
+            2100953920, 2053436353, 2692402096, 2771081412, 2043280650, 3796114505, 111059952,
+            2718672360, 641981117,  3157634347, 480817312,  3067368763, 1440455522, 3789183399,
+            2858914969, 3023544934, 2523337925, 3757150169, 2554877500, 1757885452, 2042859741,
+            3145003667, 1765356059, 3829356005, 120347518,  2885761,    3459772512, 1983257601,
+            2754364285, 2661031647, 1777736228, 914691402,  983906121,  3105084886, 768521597,
+            2154155559, 803057789,  207920004,  520614030,  3388125628, 1709472704, 3460406793,
+            88367398,   2760554751, 820679032,  385359737,  3821256454, 255272841,  1136986682,
+            1604307882, 406752143,  784756521,  1909046907, 3551003262, 2996146664, 2417417802,
+            2281769642, 1713779253, 2997834248, 2305609619, 1706598865, 2955736789, 483189064,
+            3380678618, 2954436492, 3530713159, 213291443,  2570339738, 3061718766, 4032708322,
+            1659634508, 2394399613, 1544361015, 277911057,  2701131602, 2715808259, 725619310,
+            1669035844, 1519388368, 1520119626, 2337719558, 2251023383, 1669872591, 3566835597,
+            132023133,  2758241773, 1971214466, 1107196584, 2787782228, 4110135379, 949297524,
+            2502051844, 2613154326, 3924587650, 1725478235, 2238070868, 3550286351, 1249371684,
+            2027967155, 204194829,  746680483,  731554793,  4103975442, 2816390631, 1908759394,
+            1919758267, 3344692592, 1511927326, 2473875938, 2017413224, 2860981081, 2053769331,
+            1858231586, 1886208153, 982921805,  1975651513, 222498320,  2347138704, 2652276669,
+            2892057301, 661698866,  876716783,  238734257,  2181196260, 1421887250, 3119293051,
+            1088071406, 2388332484, 1209001658, 819394715,  2537465761, 852394616,  3070562123,
+            2432023207, 3119636352, 3872931518, 3690901129, 4128722266, 2945551160, 820333409,
+            59905790,   617167272,  3128469281, 3529159815, 648599447,  1179349690, 2601984370,
+            3811672268, 632045539,  1174663648, 3242967172, 3823137616, 4092104336, 515619425,
+            3510280473, 2033540862, 3520445279, 4067500704, 3007457160, 3315170743, 4074760790,
+            1695928928, 2563563325, 2372480486, 2699520333, 2296201364, 335733223,  2680934653,
+            3611862811, 2864660648, 1522520863, 246935590,  1134721115, 2909371976, 3138633865,
+            2886724117, 347916657,  3535954782, 3332975342, 4097999573, 3941612406, 2014211033,
+            3051305323, 2292522095, 1374934227, 2124135738, 2242938006, 3934835214, 1538538766,
+            1278557852, 1218483097, 2514500125, 3138428273, 4154517350, 3179003397, 210010370,
+            678734082,  3415918185, 2862874119, 1987415471, 3946692722, 285557656,  1413682975,
+            1030331737, 675558039,  4211552557, 1019650131, 3339383553, 3014476015, 2584327130,
+            3031872416, 419012365,  1981107550, 4090006709, 2620492410, 2761287207, 384495146,
+            1834853354, 3285287718, 1421540449, 2682058794, 3583066012, 1819208544, 2980517681,
+            3819541186, 3510210055, 3965570398, 2073072743, 1784805647, 1897974736, 3027347234,
+            3121041338, 4094984080, 3159426225, 2318532021, 577361479,  1512032785, 3366589177,
+            633613647,  1108003800, 804611687,  1931498021, 3238337817, 2609875497, 2190017353,
+            4011207454, 1358280347, 2294622450, 2906598449, 890196496,  1822092244, 2170456927,
+            340291350,  653291285,  145216672,  3651792469, 3515814882, 2383759602, 1029627975,
+            929334005,  3615748420, 3148840078, 956476671,  3449757421, 1782688522, 461697128,
+            1776934867, 1678016107, 1041911925, 2909669783, 3578872319, 2144754342, 2843316757,
+            3350974263, 3084292014, 2369830371, 4169314650, 4181479057, 1926901761, 3972839356,
+            1085144425, 1742554203,
+        },
+        {
+            1327691044, 2291807625, 162402056,  984133598,  3788715264, 2232698079, 1553780183,
+            768681004,  1162561525, 2543466801, 1149744122, 2473368595, 1733785614, 2578465602,
+            1798902955, 2564193171, 562787630,  580886029,  3638741275, 3396578665, 3129990479,
+            3925867382, 2558837374, 980197829,  3100711143, 3403345053, 769980373,  1984399342,
+            3409080713, 153751125,  352389402,  3624592327, 3469115696, 1067486735, 1528615470,
+            707110996,  1632524991, 2908584713, 789637486,  2278861040, 2499733754, 3473844244,
+            3662827769, 833533643,  2640382447, 3984914436, 364669600,  2913066673, 863941695,
+            1737907909, 2612424684, 3223560389, 1210308400, 261679570,  3464458136, 1433490497,
+            3507982983, 313677358,  1679918522, 2109697258, 2755493889, 3968055707, 341918397,
+            1836023805, 1108203532, 608187323,  2226004949, 4061250141, 613273175,  3399643417,
+            2507484650, 2141101322, 748080794,  2955768879, 2544357098, 1114286645, 1853090167,
+            4153147806, 1595193052, 2633993979, 343259515,  3288669182, 2319800879, 4090421080,
+            4180682964, 3329687971, 1402958956, 1329789630, 1002486134, 2645465726, 534257890,
+            3225919115, 1725086569, 313658790,  4251349365, 2049921019, 3619040278, 535990330,
+            1798234637, 3754091367, 2282054106, 3330744361, 3942512599, 419024689,  2779171624,
+            1871135081, 1588980685, 3523057263, 4161828279, 1298585522, 642909025,  2025057172,
+            627398785,  1803469775, 1239464447, 1833281432, 581224033,  1136406239, 858543904,
+            2051448095, 1353261799, 4118107340, 3029455524, 667274842,  638957534,  3924787658,
+            3218932491, 2742811644, 280746834,  4047086684, 4026403966, 3889093105, 1567214645,
+            2765551259, 1121296241, 406419896,  702527986,  126433947,  887793629,  1248674821,
+            4071328169, 2690395751, 2530475570, 3992872504, 1586480342, 2642797038, 1029722270,
+            1838630370, 473811167,  1557917635, 271241697,  3712031260, 3948579569, 802896608,
+            534425688,  3201241741, 2673817208, 1908332310, 3142874495, 1745769871, 3928392311,
+            1327691044, 2291807625, 162402056,  984133598,  2821281264, 2232698079, 1553780183,
+            768681004,  1162561525, 744739923,  1149744122, 2473368595, 1733785614, 2578465602,
+            2739264050, 2564193171, 562787630,  580886029,  3638741275, 445568653,  3129990479,
+            3925867382, 2558837374, 980197829,  649844485,  3403345053, 769980373,  1984399342,
+            3409080713, 1846939737, 352389402,  3624592327, 3469115696, 1067486735, 956802082,
+            707110996,  1632524991, 2908584713, 789637486,  3176114010, 2499733754, 3473844244,
+            3662827769, 833533643,  738120696,  3984914436, 364669600,  2913066673, 863941695,
+            3755209773, 2612424684, 3223560389, 1210308400, 261679570,  950563562,  1433490497,
+            3507982983, 313677358,  1679918522, 2316241587, 2755493889, 3968055707, 341918397,
+            1836023805, 2983785693, 608187323,  2226004949, 4061250141, 613273175,  3599796924,
+            2507484650, 2141101322, 748080794,  2955768879, 3632251825, 1114286645, 1853090167,
+            4153147806, 1595193052, 401762298,  343259515,  3288669182, 2319800879, 4090421080,
+            186259018,  3329687971, 1402958956, 1329789630, 1002486134, 2599019710, 534257890,
+            3225919115, 1725086569, 313658790,  44771858,   2049921019, 3619040278, 535990330,
+            1798234637, 345542316,  2282054106, 3330744361, 3942512599, 419024689,  373328451,
+            1871135081, 1588980685, 3523057263, 4161828279, 2780714922, 642909025,  2025057172,
+            627398785,  1803469775, 556720110,  1833281432, 581224033,  1136406239, 858543904,
+            4015026149, 1353261799, 4118107340, 3029455524, 667274842,  2280585245, 3924787658,
+            3218932491, 2742811644, 280746834,  3023044551, 4026403966, 3889093105, 1567214645,
+            2765551259, 357120821,  406419896,  702527986,  126433947,  887793629,  3814435400,
+            4071328169, 2690395751, 2530475570, 3992872504, 1730273744, 2642797038, 1029722270,
+            1838630370, 473811167,  2624761973, 271241697,  3712031260, 3948579569, 802896608,
+            671707477,  3201241741, 2673817208, 1908332310, 3142874495, 3050815549, 3928392311,
+            1327691044, 2291807625, 162402056,  1890375059, 2821281264, 2232698079, 1553780183,
+            768681004,  1631554437, 744739923,  1149744122, 2473368595, 1733785614, 2489656407,
+            2739264050, 2564193171, 562787630,  580886029,  3537262174, 445568653,  3129990479,
+            3925867382, 2558837374, 1597426382, 649844485,  3403345053, 769980373,  1984399342,
+            156340241,  1846939737, 352389402,  3624592327, 3469115696, 1039455374, 956802082,
+            707110996,  1632524991, 2908584713, 4218178072, 3176114010, 2499733754, 3473844244,
+            3662827769, 810854920,  738120696,  3984914436, 364669600,  2913066673, 2583862349,
+            3755209773, 2612424684, 3223560389, 1210308400, 974621733,  950563562,  1433490497,
+            3507982983, 313677358,  291399786,  2316241587, 2755493889, 3968055707, 341918397,
+            1107304301, 2983785693, 608187323,  2226004949, 4061250141, 4036431254, 3599796924,
+            2507484650, 2141101322, 748080794,  1503689549, 3632251825, 1114286645, 1853090167,
+            4153147806, 1549618894, 401762298,  343259515,  3288669182, 2319800879, 1713130165,
+            186259018,  3329687971, 1402958956, 1329789630, 3332287121, 2599019710, 534257890,
+            3225919115, 1725086569, 2916761764, 44771858,   2049921019, 3619040278, 535990330,
+            976813160,  345542316,  2282054106, 3330744361, 3942512599, 401210399,  373328451,
+            1871135081, 1588980685, 3523057263, 178084087,  2780714922, 642909025,  2025057172,
+            627398785,  876482555,  556720110,  1833281432, 581224033,  1136406239, 1582557303,
+            4015026149, 1353261799, 4118107340, 3029455524, 1702321591, 2280585245, 3924787658,
+            3218932491, 2742811644, 3511541623, 3023044551, 4026403966, 3889093105, 1567214645,
+            4169980648, 357120821,  406419896,  702527986,  126433947,  241898104,  3814435400,
+            4071328169, 2690395751, 2530475570, 2042926089, 1730273744, 2642797038, 1029722270,
+            1838630370, 3933822361, 2624761973, 271241697,  3712031260, 3948579569, 1498901497,
+            671707477,  3201241741, 2673817208, 1908332310, 3401731417, 3050815549, 3928392311,
+            1327691044, 2291807625, 3120506164, 1890375059, 2821281264, 2232698079, 1553780183,
+            2554430435, 1631554437, 744739923,  1149744122, 2473368595, 3343772756, 2489656407,
+            2739264050, 2564193171, 562787630,  2225732383, 3537262174, 445568653,  3129990479,
+            3925867382, 1708131764, 1597426382, 649844485,  3403345053, 769980373,  1747650660,
+            156340241,  1846939737, 352389402,  3624592327, 1606235389, 1039455374, 956802082,
+            707110996,  1632524991, 1329760796, 4218178072, 3176114010, 2499733754, 3473844244,
+            2165045235, 810854920,  738120696,  3984914436, 364669600,  2907168470, 2583862349,
+            3755209773, 2612424684, 3223560389, 2492484038, 974621733,  950563562,  1433490497,
+            3507982983, 352996669,  291399786,  2316241587, 2755493889, 3968055707, 272251637,
+            1107304301, 2983785693, 608187323,  2226004949, 3028331498, 4036431254, 3599796924,
+            2507484650, 2141101322, 587141433,  1503689549, 3632251825, 1114286645, 1853090167,
+            3356247257, 1549618894, 401762298,  343259515,  3288669182, 3602161650, 1713130165,
+            186259018,  3329687971, 1402958956, 2117054221, 3332287121, 2599019710, 534257890,
+            3225919115, 3199318608, 2916761764, 44771858,   2049921019, 3619040278, 4241158370,
+            976813160,  345542316,  2282054106, 3330744361, 3847972493, 401210399,  373328451,
+            1871135081, 1588980685, 2545242774, 178084087,  2780714922, 642909025,  2025057172,
+            876391965,  876482555,  556720110,  1833281432, 581224033,  236309322,  1582557303,
+            4015026149, 1353261799, 4118107340, 1277468622, 1702321591, 2280585245, 3924787658,
+            3218932491, 1472942832, 3511541623, 3023044551, 4026403966, 3889093105, 1914440108,
+            4169980648, 357120821,  406419896,  702527986,  3640291715, 241898104,  3814435400,
+            4071328169, 2690395751, 2822869103, 2042926089, 1730273744, 2642797038, 1029722270,
+            2174645219, 3933822361, 2624761973, 271241697,  3712031260, 3342729954, 1498901497,
+            671707477,  3201241741, 2673817208, 3398681973, 2015732836, 4028573246, 2876508206,
+            3999812838, 1107947772, 1904978796, 3401026016, 1252474158, 4155961681, 513097003,
+            1549438784, 2415709717, 3711763487, 4118586696, 90412209,   849606726,  753148553,
+            1473717684, 3403720680, 2020879432, 1038959207, 2974657639, 171880940,  1715971985,
+            2323480228, 3415275295, 674881854,  939886752,  3496955266, 3666751880, 2996423376,
+            2124553817, 1824920237, 4025900592, 4035805347, 2317549208, 3631668495, 98695631,
+            2211223817, 3241186608, 1584838750, 2717764358, 3606498098, 658434952,  608013327,
+            3164593391, 914865819,  581970367,  3526773986, 3994428,    3312075928, 2087853229,
+            2519811463, 320456441,  621955782,  1872819993, 3834675426, 2886256786, 141880242,
+            3489965938, 82262336,   3393496942, 1698089024, 2942681104, 430548755,  3125594236,
+            1070154972, 486710617,  1099928980, 1745971570, 588956792,  898673927,  513731730,
+            4058750784, 3726832665, 2972187614, 1882208922, 4044191585, 581058878,  3253326607,
+            3757962820, 628975005,  1852737617, 919677801,  3017758106, 3347420109, 2467507544,
+            2026716022, 3155372524, 4287301344, 3860686057, 4255042345, 2046844472, 4145560696,
+            1308237566, 2562177545, 1497534026, 2445646954, 2125013430, 3591922066, 2799557911,
+            1558284854, 1288313411, 3148039482, 2733529509, 847967264,  3770941540, 44634937,
+            869559208,  1740229892, 3709666641, 494367151,  2462073506, 4051570915, 1811685031,
+            1815049447, 3391895602, 2504258087, 3735657653, 2349812839, 3221531465, 78847705,
+            2137800355, 1477573011, 1967115016, 3316058203, 4096629022, 1593457144, 4245487897,
+            756128451,  3405196297, 705258663,  1173115168, 3987351403, 871351389,  2453488430,
+            2118194683, 649054474,  1530406435, 1109273700, 2598657511, 2492419999, 2010441175,
+            2239720574, 4240202909, 1425919218, 758733051,  1243134251, 3617413317, 2955797562,
+            833853401,  3687500352, 1203272245, 1469230036, 3553529567, 351308861,  1302849476,
+            1705940625, 3680601116,
+        },
+        {
+            1822875635, 3741067287, 781581427,  3309017971, 1289336812, 3579699054, 3489931575,
+            1543813765, 3425766000, 3382607317, 3874766134, 3963225307, 2325958149, 3771372447,
+            1701868027, 2423523746, 1030907269, 315813831,  3362495888, 3674465335, 663063703,
+            2837069162, 1906090058, 1762245342, 3310878811, 2584783130, 2120539002, 3025246617,
+            4201689654, 2563530549, 2290636380, 926777356,  1124877072, 1231882461, 4188503348,
+            2170962863, 2415885258, 4076010823, 1568619699, 3906811971, 2911574374, 120855140,
+            136558780,  802752569,  3963102335, 901571495,  2809438336, 422453577,  2597130844,
+            3960540359, 480489061,  952811886,  3048491690, 3329714424, 3522307939, 71659307,
+            662383199,  2687941813, 3270702431, 1357272179, 3278899778, 444519079,  593586217,
+            1891979977, 3647064451, 2753533011, 1699203779, 1190736808, 4175904780, 2375464617,
+            4236064627, 3176336063, 907026279,  147194723,  3010364347, 2497030376, 4199147449,
+            1919251868, 3769112708, 4021498552, 1526799880, 867985541,  3674178085, 243764672,
+            4251049497, 2737635123, 312344421,  326770633,  3809867665, 3507765008, 3756869459,
+            3868863405, 84804059,   2485786220, 2089399755, 722611195,  528172903,  1842158020,
+            2609133091, 3198449974, 3774306522, 1168903673, 623657238,  3991607478, 2430301614,
+            171957363,  996061288,  1867519423, 2409755114, 1048493697, 855890861,  2685094245,
+            2897263937, 965320437,  4235455146, 428207186,  2077588766, 2277154642, 2170013601,
+            1058585390, 1211528667, 977330201,  770294947,  3967588971, 2061443541, 959515764,
+            1779530707, 2818306173, 1658815239, 216195422,  1975709938, 1691413809, 4025903852,
+            3455478305, 1194683964, 1888201391, 4102483098, 431770996,  995987276,  3106510205,
+            2457707918, 2092242495, 2769715019, 3642235952, 406809335,  4214043488, 948647736,
+            3332936746, 3950739535, 2330566996, 2644932989, 4250652422, 3138150012, 2899850518,
+            3201176928, 3611791605, 679742248,  2936774088, 2767429180, 2305254523, 2459044740,
+            1822875635, 3741067287, 781581427,  3309017971, 1468568873, 3579699054, 3489931575,
+            1543813765, 3425766000, 2886584154, 3874766134, 3963225307, 2325958149, 3771372447,
+            2780869454, 2423523746, 1030907269, 315813831,  3362495888, 273851433,  663063703,
+            2837069162, 1906090058, 1762245342, 2585223809, 2584783130, 2120539002, 3025246617,
+            4201689654, 3623127737, 2290636380, 926777356,  1124877072, 1231882461, 722227456,
+            2170962863, 2415885258, 4076010823, 1568619699, 297748631,  2911574374, 120855140,
+            136558780,  802752569,  1583607201, 901571495,  2809438336, 422453577,  2597130844,
+            3941313185, 480489061,  952811886,  3048491690, 3329714424, 3128181615, 71659307,
+            662383199,  2687941813, 3270702431, 2084617671, 3278899778, 444519079,  593586217,
+            1891979977, 2348565123, 2753533011, 1699203779, 1190736808, 4175904780, 3685530911,
+            4236064627, 3176336063, 907026279,  147194723,  59954415,   2497030376, 4199147449,
+            1919251868, 3769112708, 3344775020, 1526799880, 867985541,  3674178085, 243764672,
+            23991795,   2737635123, 312344421,  326770633,  3809867665, 2013384475, 3756869459,
+            3868863405, 84804059,   2485786220, 1863897302, 722611195,  528172903,  1842158020,
+            2609133091, 2986377866, 3774306522, 1168903673, 623657238,  3991607478, 878012980,
+            171957363,  996061288,  1867519423, 2409755114, 978187268,  855890861,  2685094245,
+            2897263937, 965320437,  3021210308, 428207186,  2077588766, 2277154642, 2170013601,
+            1058959159, 1211528667, 977330201,  770294947,  3967588971, 4277943929, 959515764,
+            1779530707, 2818306173, 1658815239, 4038111644, 1975709938, 1691413809, 4025903852,
+            3455478305, 390713817,  1888201391, 4102483098, 431770996,  995987276,  1065540145,
+            2457707918, 2092242495, 2769715019, 3642235952, 2548138932, 4214043488, 948647736,
+            3332936746, 3950739535, 1576069736, 2644932989, 4250652422, 3138150012, 2899850518,
+            3884290971, 3611791605, 679742248,  2936774088, 2767429180, 31009471,   2459044740,
+            1822875635, 3741067287, 781581427,  1071472515, 1468568873, 3579699054, 3489931575,
+            1543813765, 1433346989, 2886584154, 3874766134, 3963225307, 2325958149, 1108264987,
+            2780869454, 2423523746, 1030907269, 315813831,  16202533,   273851433,  663063703,
+            2837069162, 1906090058, 119567035,  2585223809, 2584783130, 2120539002, 3025246617,
+            316050275,  3623127737, 2290636380, 926777356,  1124877072, 2866070426, 722227456,
+            2170962863, 2415885258, 4076010823, 2962835203, 297748631,  2911574374, 120855140,
+            136558780,  201381718,  1583607201, 901571495,  2809438336, 422453577,  3545715570,
+            3941313185, 480489061,  952811886,  3048491690, 706608658,  3128181615, 71659307,
+            662383199,  2687941813, 3857401408, 2084617671, 3278899778, 444519079,  593586217,
+            2516210661, 2348565123, 2753533011, 1699203779, 1190736808, 4150822874, 3685530911,
+            4236064627, 3176336063, 907026279,  3164704672, 59954415,   2497030376, 4199147449,
+            1919251868, 557002563,  3344775020, 1526799880, 867985541,  3674178085, 2611898826,
+            23991795,   2737635123, 312344421,  326770633,  2567124174, 2013384475, 3756869459,
+            3868863405, 84804059,   504027313,  1863897302, 722611195,  528172903,  1842158020,
+            1834235136, 2986377866, 3774306522, 1168903673, 623657238,  259212412,  878012980,
+            171957363,  996061288,  1867519423, 992460261,  978187268,  855890861,  2685094245,
+            2897263937, 600802753,  3021210308, 428207186,  2077588766, 2277154642, 147483103,
+            1058959159, 1211528667, 977330201,  770294947,  1956737144, 4277943929, 959515764,
+            1779530707, 2818306173, 1546156854, 4038111644, 1975709938, 1691413809, 4025903852,
+            3108977696, 390713817,  1888201391, 4102483098, 431770996,  472672414,  1065540145,
+            2457707918, 2092242495, 2769715019, 829253718,  2548138932, 4214043488, 948647736,
+            3332936746, 2106981074, 1576069736, 2644932989, 4250652422, 3138150012, 1191219568,
+            3884290971, 3611791605, 679742248,  2936774088, 146029583,  31009471,   2459044740,
+            1822875635, 3741067287, 1661073869, 1071472515, 1468568873, 3579699054, 3489931575,
+            2081684919, 1433346989, 2886584154, 3874766134, 3963225307, 1174598311, 1108264987,
+            2780869454, 2423523746, 1030907269, 4182706005, 16202533,   273851433,  663063703,
+            2837069162, 485265153,  119567035,  2585223809, 2584783130, 2120539002, 3470825616,
+            316050275,  3623127737, 2290636380, 926777356,  1740116662, 2866070426, 722227456,
+            2170962863, 2415885258, 4022512117, 2962835203, 297748631,  2911574374, 120855140,
+            1408455596, 201381718,  1583607201, 901571495,  2809438336, 9741285,    3545715570,
+            3941313185, 480489061,  952811886,  2357778631, 706608658,  3128181615, 71659307,
+            662383199,  2733332957, 3857401408, 2084617671, 3278899778, 444519079,  609546484,
+            2516210661, 2348565123, 2753533011, 1699203779, 991197152,  4150822874, 3685530911,
+            4236064627, 3176336063, 3497189564, 3164704672, 59954415,   2497030376, 4199147449,
+            1483059946, 557002563,  3344775020, 1526799880, 867985541,  535610095,  2611898826,
+            23991795,   2737635123, 312344421,  2906833021, 2567124174, 2013384475, 3756869459,
+            3868863405, 2840908651, 504027313,  1863897302, 722611195,  528172903,  312078916,
+            1834235136, 2986377866, 3774306522, 1168903673, 1280265636, 259212412,  878012980,
+            171957363,  996061288,  3382555279, 992460261,  978187268,  855890861,  2685094245,
+            4280292474, 600802753,  3021210308, 428207186,  2077588766, 1914430855, 147483103,
+            1058959159, 1211528667, 977330201,  800748023,  1956737144, 4277943929, 959515764,
+            1779530707, 1474313372, 1546156854, 4038111644, 1975709938, 1691413809, 2084364343,
+            3108977696, 390713817,  1888201391, 4102483098, 3252160410, 472672414,  1065540145,
+            2457707918, 2092242495, 3899323224, 829253718,  2548138932, 4214043488, 948647736,
+            1806969453, 2106981074, 1576069736, 2644932989, 4250652422, 72437717,   1191219568,
+            3884290971, 3611791605, 679742248,  1452736923, 3657194833, 2577959805, 3123905931,
+            3537193535, 2288724364, 4150894882, 1553141774, 4142576231, 3406183170, 1483671739,
+            2876054439, 2426542718, 1064619954, 3143656024, 1789469815, 257665489,  3042120338,
+            383584677,  4045351843, 2279563461, 1099824275, 2970191218, 71340103,   922733024,
+            469987683,  2485644975, 4260443968, 3903936011, 2666902822, 2400317099, 1855988340,
+            64688790,   1658884316, 2292285156, 602963713,  4161172312, 105818233,  2008427428,
+            3162859531, 1058904835, 4034085572, 2770055452, 356177200,  748644982,  2496139469,
+            1861659476, 2404844490, 3964946999, 3158015575, 793859151,  2142092161, 3067021555,
+            1657387108, 1213518159, 3159236335, 1419516091, 1525994205, 1247084544, 985487929,
+            548171826,  3857822939, 2711497915, 2486085152, 2678963009, 2848843829, 3986784200,
+            1029743708, 1708382151, 3066919154, 1349012523, 439738368,  1055726134, 910083918,
+            3490240122, 1683676819, 611660916,  2866123186, 1957508370, 961028659,  1740021044,
+            2709839392, 1240479580, 3371374371, 2569851637, 1614309129, 1161529457, 3545182488,
+            1996569446, 2371089323, 1900665803, 3551559148, 3548340327, 441132615,  1900579964,
+            2422016603, 838937190,  3723128911, 3643850697, 3911155664, 2656563710, 3376924223,
+            1180571411, 182377438,  597428574,  988753303,  232444067,  2770345869, 1501444094,
+            1341671048, 263939674,  2580293957, 2973075771, 3035557224, 1161698086, 185135958,
+            4058088088, 1807884112, 457042914,  1381131056, 1166656901, 3796755500, 4269821511,
+            3384117850, 3056242330, 2071638160, 2810809170, 3356181063, 481930501,  2552755198,
+            1609235856, 333323675,  1066831959, 3268619747, 3876862801, 97084852,   3119257609,
+            3303798390, 1357538432, 1152130715, 3588211758, 336053172,  137079594,  933851419,
+            2782188693, 4081666613, 455326061,  709808443,  3182383759, 1182949871, 466934935,
+            1885402874, 234163240,  1342563904, 3450052413, 3222904202, 3293106783, 2202551087,
+            1691209908, 3012182081,
+        },
+        {
+            3962742058, 3641642089, 1515511544, 414031481,  866756842,  2624028988, 3289221995,
+            3614331353, 149374591,  2008769568, 1757737619, 3524510048, 1428920328, 801684392,
+            3412721231, 3322130248, 1543493009, 164509877,  3059320738, 2399470604, 1372081269,
+            3145252966, 3068835498, 4010915437, 3410880691, 3074091398, 3474542693, 2874711560,
+            2340776162, 3123311126, 3292885265, 2153050796, 1248678197, 3948228324, 4279488356,
+            3816196027, 3769907798, 436416938,  328245966,  2344427004, 835539326,  604652794,
+            3967595754, 3791948896, 841323168,  2016436934, 2905774210, 2293423905, 1320207611,
+            3912740579, 3676217602, 180376726,  1754534884, 781095648,  788648678,  3637942755,
+            785539427,  1215459175, 1951563568, 1994980205, 4107655483, 4211299410, 273099356,
+            1792199544, 173400177,  3528559464, 3673061418, 1202927600, 3838505975, 1219196328,
+            3790207758, 1883808689, 105860869,  3223121938, 2353217279, 1049834297, 739174810,
+            3251675038, 528337072,  3532092769, 715529810,  4149062524, 3994636507, 3407258325,
+            3660815421, 1694783128, 4151209792, 3561987923, 3081951816, 3192017128, 1457796558,
+            1628455662, 2434512698, 3100349013, 1467612099, 264121052,  566153048,  835114180,
+            3672015642, 1554123524, 2288289475, 4246204119, 2387839284, 2717060749, 1408362855,
+            2629214628, 2902122588, 1768467902, 1758649841, 1195345407, 608936824,  2824066577,
+            897224202,  1311652585, 2759893551, 1486464932, 3586782844, 4085244448, 3718597382,
+            1793630132, 269711390,  1099021424, 1155689608, 4031484282, 2349877136, 4085900404,
+            2985725536, 2846057851, 3435185057, 2155015012, 3663437088, 3482449100, 1472083191,
+            4105565676, 1474420129, 1763412502, 3485696704, 392941561,  211216423,  2369680625,
+            535326320,  625209122,  1831990830, 326034718,  1651772317, 744281078,  413385259,
+            4291248051, 2746659269, 936032021,  1871820780, 2745126536, 3491736120, 2594677698,
+            462479348,  2042010387, 3821153327, 1428271183, 2835351263, 421620631,  3013846699,
+            3962742058, 3641642089, 1515511544, 414031481,  1087570820, 2624028988, 3289221995,
+            3614331353, 149374591,  179603684,  1757737619, 3524510048, 1428920328, 801684392,
+            4130358984, 3322130248, 1543493009, 164509877,  3059320738, 2526801096, 1372081269,
+            3145252966, 3068835498, 4010915437, 2890395738, 3074091398, 3474542693, 2874711560,
+            2340776162, 3018851413, 3292885265, 2153050796, 1248678197, 3948228324, 3018091431,
+            3816196027, 3769907798, 436416938,  328245966,  1076649898, 835539326,  604652794,
+            3967595754, 3791948896, 4207666656, 2016436934, 2905774210, 2293423905, 1320207611,
+            1246644226, 3676217602, 180376726,  1754534884, 781095648,  825901660,  3637942755,
+            785539427,  1215459175, 1951563568, 2625151827, 4107655483, 4211299410, 273099356,
+            1792199544, 1285365969, 3528559464, 3673061418, 1202927600, 3838505975, 4195130825,
+            3790207758, 1883808689, 105860869,  3223121938, 3732751091, 1049834297, 739174810,
+            3251675038, 528337072,  2143863072, 715529810,  4149062524, 3994636507, 3407258325,
+            3949932159, 1694783128, 4151209792, 3561987923, 3081951816, 737737469,  1457796558,
+            1628455662, 2434512698, 3100349013, 516114141,  264121052,  566153048,  835114180,
+            3672015642, 2240631111, 2288289475, 4246204119, 2387839284, 2717060749, 3003096055,
+            2629214628, 2902122588, 1768467902, 1758649841, 3399227330, 608936824,  2824066577,
+            897224202,  1311652585, 3824529496, 1486464932, 3586782844, 4085244448, 3718597382,
+            541917432,  269711390,  1099021424, 1155689608, 4031484282, 1712428182, 4085900404,
+            2985725536, 2846057851, 3435185057, 1252900150, 3663437088, 3482449100, 1472083191,
+            4105565676, 889365207,  1763412502, 3485696704, 392941561,  211216423,  823529854,
+            535326320,  625209122,  1831990830, 326034718,  2079415808, 744281078,  413385259,
+            4291248051, 2746659269, 513553213,  1871820780, 2745126536, 3491736120, 2594677698,
+            3578527861, 2042010387, 3821153327, 1428271183, 2835351263, 2182487449, 3013846699,
+            3962742058, 3641642089, 1515511544, 2038082882, 1087570820, 2624028988, 3289221995,
+            3614331353, 3540733312, 179603684,  1757737619, 3524510048, 1428920328, 417959886,
+            4130358984, 3322130248, 1543493009, 164509877,  386720177,  2526801096, 1372081269,
+            3145252966, 3068835498, 1768527826, 2890395738, 3074091398, 3474542693, 2874711560,
+            3471036518, 3018851413, 3292885265, 2153050796, 1248678197, 2032847408, 3018091431,
+            3816196027, 3769907798, 436416938,  2671866247, 1076649898, 835539326,  604652794,
+            3967595754, 917993735,  4207666656, 2016436934, 2905774210, 2293423905, 1366159002,
+            1246644226, 3676217602, 180376726,  1754534884, 3100518427, 825901660,  3637942755,
+            785539427,  1215459175, 585379919,  2625151827, 4107655483, 4211299410, 273099356,
+            1607157553, 1285365969, 3528559464, 3673061418, 1202927600, 3000435761, 4195130825,
+            3790207758, 1883808689, 105860869,  2561702754, 3732751091, 1049834297, 739174810,
+            3251675038, 2596780936, 2143863072, 715529810,  4149062524, 3994636507, 469549025,
+            3949932159, 1694783128, 4151209792, 3561987923, 320772014,  737737469,  1457796558,
+            1628455662, 2434512698, 2391750818, 516114141,  264121052,  566153048,  835114180,
+            2651497747, 2240631111, 2288289475, 4246204119, 2387839284, 1759109422, 3003096055,
+            2629214628, 2902122588, 1768467902, 3494209963, 3399227330, 608936824,  2824066577,
+            897224202,  175943042,  3824529496, 1486464932, 3586782844, 4085244448, 2337358808,
+            541917432,  269711390,  1099021424, 1155689608, 2297465901, 1712428182, 4085900404,
+            2985725536, 2846057851, 2474244894, 1252900150, 3663437088, 3482449100, 1472083191,
+            3821821896, 889365207,  1763412502, 3485696704, 392941561,  3063529322, 823529854,
+            535326320,  625209122,  1831990830, 3006435074, 2079415808, 744281078,  413385259,
+            4291248051, 4177403463, 513553213,  1871820780, 2745126536, 3491736120, 3085772757,
+            3578527861, 2042010387, 3821153327, 1428271183, 3240990310, 2182487449, 3013846699,
+            3962742058, 3641642089, 4061284760, 2038082882, 1087570820, 2624028988, 3289221995,
+            2979700149, 3540733312, 179603684,  1757737619, 3524510048, 2244602255, 417959886,
+            4130358984, 3322130248, 1543493009, 1959062224, 386720177,  2526801096, 1372081269,
+            3145252966, 1762634972, 1768527826, 2890395738, 3074091398, 3474542693, 1366423916,
+            3471036518, 3018851413, 3292885265, 2153050796, 2353219695, 2032847408, 3018091431,
+            3816196027, 3769907798, 1616410432, 2671866247, 1076649898, 835539326,  604652794,
+            2384421377, 917993735,  4207666656, 2016436934, 2905774210, 2640994983, 1366159002,
+            1246644226, 3676217602, 180376726,  1630638885, 3100518427, 825901660,  3637942755,
+            785539427,  954889245,  585379919,  2625151827, 4107655483, 4211299410, 3635957997,
+            1607157553, 1285365969, 3528559464, 3673061418, 3947927375, 3000435761, 4195130825,
+            3790207758, 1883808689, 471145957,  2561702754, 3732751091, 1049834297, 739174810,
+            3818742555, 2596780936, 2143863072, 715529810,  4149062524, 4036754625, 469549025,
+            3949932159, 1694783128, 4151209792, 2160628336, 320772014,  737737469,  1457796558,
+            1628455662, 3415617135, 2391750818, 516114141,  264121052,  566153048,  2121575742,
+            2651497747, 2240631111, 2288289475, 4246204119, 133155506,  1759109422, 3003096055,
+            2629214628, 2902122588, 3328805473, 3494209963, 3399227330, 608936824,  2824066577,
+            3981066554, 175943042,  3824529496, 1486464932, 3586782844, 3317274485, 2337358808,
+            541917432,  269711390,  1099021424, 3468321780, 2297465901, 1712428182, 4085900404,
+            2985725536, 3871317131, 2474244894, 1252900150, 3663437088, 3482449100, 3591169721,
+            3821821896, 889365207,  1763412502, 3485696704, 3311630544, 3063529322, 823529854,
+            535326320,  625209122,  3821419488, 3006435074, 2079415808, 744281078,  413385259,
+            4163194901, 4177403463, 513553213,  1871820780, 2745126536, 2902521749, 3085772757,
+            3578527861, 2042010387, 3821153327, 3965917861, 1220641431, 3740515620, 707959457,
+            2824757097, 896276172,  311778415,  3328058205, 429601355,  3626986883, 4049706407,
+            3321564598, 3468256546, 1847613035, 429975606,  4202516654, 3397667654, 4191961331,
+            2531262670, 2201588282, 1703874132, 337912362,  1197637934, 1851678946, 627482349,
+            3588948795, 2914112112, 2669023890, 1574166260, 245524186,  2231373220, 3628672276,
+            2855123885, 524569806,  525815122,  3039883879, 733054075,  2567702261, 3554295228,
+            625015742,  91211438,   1145717429, 3215396100, 451981946,  1747220725, 290815383,
+            1540249392, 1854028860, 3830141352, 76380634,   205050332,  3162984159, 110752566,
+            3293999245, 2581607643, 314719859,  3415689406, 4180824302, 367804857,  473879220,
+            561902427,  1689009718, 3850100948, 1125751793, 2853278373, 3297003686, 66785803,
+            1879214196, 2566277812, 3672465972, 768998820,  3950203763, 2290207673, 2259215700,
+            2241345499, 3093620200, 2322280523, 3722728203, 3506703086, 3618150418, 2101066096,
+            2738089645, 974837878,  501076079,  561901205,  533137984,  741530958,  2758402577,
+            2420286440, 1784132859, 771111320,  3508903163, 4096111396, 3805882753, 1110071638,
+            773507142,  3477018658, 3533511446, 943694277,  3959491852, 1033188550, 65965395,
+            1477429561, 369500328,  1175239512, 3278777295, 2477228222, 3745804166, 2668708235,
+            2051963264, 2082158355, 907982961,  1023696984, 4128720153, 673779596,  716439051,
+            2469215126, 4100062222, 3682633237, 2399834465, 1074730155, 3320570233, 3414472918,
+            3631095091, 3402420558, 1462133187, 607784470,  4071273978, 2045352367, 482581272,
+            2355889411, 3680481666, 26161795,   4202031597, 2414158248, 1423213735, 1831889434,
+            3423914563, 202617040,  1161945847, 1079861927, 2235439735, 866624797,  45200483,
+            492427795,  3181775905, 1583364033, 3981621443, 2527323843, 3137287477, 2978752522,
+            1235843103, 2975295064, 2949338469, 3227181705, 4024961028, 1122566033, 4110800964,
+            541710385,  1509901090,
+        },
+        {
+            3445514659, 448378240,  3723012552, 1578837905, 1207011131, 3825908126, 1969022581,
+            3112087916, 3647230184, 2873784504, 3093788698, 2119726037, 2534784546, 1336496135,
+            615722009,  3262542694, 3066517683, 1740964498, 885532828,  2978322270, 4200026735,
+            3763614596, 2976831215, 3441018436, 924060402,  3711699446, 2855999080, 1230015715,
+            1989722873, 2501746153, 2470511447, 367830227,  3294930279, 1530740707, 2733963509,
+            1463937325, 1055001211, 1487660158, 3992316304, 1797891500, 477667834,  758310147,
+            2171521478, 3170431707, 1635611865, 816231214,  888935266,  674782203,  931095223,
+            420538789,  974294645,  280841799,  1222578255, 1202698041, 345504309,  741871552,
+            3117500161, 2644977650, 3890517980, 1886170396, 3227501410, 2113987148, 43087254,
+            3826999888, 3533844402, 711905002,  2450995968, 417834677,  4036848978, 2501038067,
+            817975973,  3274686035, 2867818021, 839342582,  774981129,  3104225624, 4075494777,
+            1554098908, 3756118191, 2302882921, 2650845237, 3960372821, 2277713152, 2766393100,
+            3336643539, 3176156865, 3500557080, 898743176,  4169138916, 3338348589, 2507145565,
+            537253657,  256422559,  3001324461, 3320941809, 4277255511, 4039920292, 2116579512,
+            208000029,  273935008,  3127838999, 3386817666, 1394226534, 2859946395, 235179121,
+            1617754742, 1651505618, 1402105696, 3746787865, 3600294834, 1727444467, 1696520983,
+            2965012995, 2979559559, 3351088880, 3973810989, 1926388033, 3674712882, 201154767,
+            710289370,  3877635709, 3966183307, 2247617788, 1272751807, 3973567885, 4101698022,
+            4083624186, 243990928,  4057932128, 2736688600, 1268712631, 3640744472, 3277615384,
+            3191863004, 2854947630, 1612341140, 276113790,  3882889532, 3816836683, 3493070175,
+            3312856366, 1080006106, 2277956561, 387390354,  926063027,  888931237,  472092791,
+            1220719735, 2384779611, 3730469664, 3109984641, 309778478,  3343627835, 1832424072,
+            1910919414, 4020959305, 481727676,  1369529826, 2990384495, 2448198280, 1180672184,
+            3445514659, 448378240,  3723012552, 1578837905, 2199826880, 3825908126, 1969022581,
+            3112087916, 3647230184, 1778656029, 3093788698, 2119726037, 2534784546, 1336496135,
+            2674028952, 3262542694, 3066517683, 1740964498, 885532828,  515945751,  4200026735,
+            3763614596, 2976831215, 3441018436, 2907953663, 3711699446, 2855999080, 1230015715,
+            1989722873, 4161478871, 2470511447, 367830227,  3294930279, 1530740707, 4127079440,
+            1463937325, 1055001211, 1487660158, 3992316304, 3248365272, 477667834,  758310147,
+            2171521478, 3170431707, 4126533197, 816231214,  888935266,  674782203,  931095223,
+            526852805,  974294645,  280841799,  1222578255, 1202698041, 1244909226, 741871552,
+            3117500161, 2644977650, 3890517980, 3905478733, 3227501410, 2113987148, 43087254,
+            3826999888, 801541836,  711905002,  2450995968, 417834677,  4036848978, 271712366,
+            817975973,  3274686035, 2867818021, 839342582,  2045698749, 3104225624, 4075494777,
+            1554098908, 3756118191, 484269252,  2650845237, 3960372821, 2277713152, 2766393100,
+            3178496851, 3176156865, 3500557080, 898743176,  4169138916, 963634682,  2507145565,
+            537253657,  256422559,  3001324461, 1582030262, 4277255511, 4039920292, 2116579512,
+            208000029,  3449513325, 3127838999, 3386817666, 1394226534, 2859946395, 1158686324,
+            1617754742, 1651505618, 1402105696, 3746787865, 785706596,  1727444467, 1696520983,
+            2965012995, 2979559559, 1850060246, 3973810989, 1926388033, 3674712882, 201154767,
+            3349834904, 3877635709, 3966183307, 2247617788, 1272751807, 925321098,  4101698022,
+            4083624186, 243990928,  4057932128, 1110307623, 1268712631, 3640744472, 3277615384,
+            3191863004, 3414996815, 1612341140, 276113790,  3882889532, 3816836683, 1058008473,
+            3312856366, 1080006106, 2277956561, 387390354,  3195172705, 888931237,  472092791,
+            1220719735, 2384779611, 2644790135, 3109984641, 309778478,  3343627835, 1832424072,
+            463857,     4020959305, 481727676,  1369529826, 2990384495, 4136266604, 1180672184,
+            3445514659, 448378240,  3723012552, 2397709360, 2199826880, 3825908126, 1969022581,
+            3112087916, 2031876777, 1778656029, 3093788698, 2119726037, 2534784546, 497286839,
+            2674028952, 3262542694, 3066517683, 1740964498, 3790925406, 515945751,  4200026735,
+            3763614596, 2976831215, 2018849581, 2907953663, 3711699446, 2855999080, 1230015715,
+            2482124325, 4161478871, 2470511447, 367830227,  3294930279, 3721748893, 4127079440,
+            1463937325, 1055001211, 1487660158, 512446089,  3248365272, 477667834,  758310147,
+            2171521478, 1873500090, 4126533197, 816231214,  888935266,  674782203,  2874533719,
+            526852805,  974294645,  280841799,  1222578255, 2146055991, 1244909226, 741871552,
+            3117500161, 2644977650, 2650185000, 3905478733, 3227501410, 2113987148, 43087254,
+            671121294,  801541836,  711905002,  2450995968, 417834677,  402105854,  271712366,
+            817975973,  3274686035, 2867818021, 899793428,  2045698749, 3104225624, 4075494777,
+            1554098908, 4148040367, 484269252,  2650845237, 3960372821, 2277713152, 2773658159,
+            3178496851, 3176156865, 3500557080, 898743176,  4182682776, 963634682,  2507145565,
+            537253657,  256422559,  2788472617, 1582030262, 4277255511, 4039920292, 2116579512,
+            1398980105, 3449513325, 3127838999, 3386817666, 1394226534, 1887579577, 1158686324,
+            1617754742, 1651505618, 1402105696, 127809648,  785706596,  1727444467, 1696520983,
+            2965012995, 3858767964, 1850060246, 3973810989, 1926388033, 3674712882, 2794901332,
+            3349834904, 3877635709, 3966183307, 2247617788, 249906922,  925321098,  4101698022,
+            4083624186, 243990928,  4192550245, 1110307623, 1268712631, 3640744472, 3277615384,
+            3955131684, 3414996815, 1612341140, 276113790,  3882889532, 1240456254, 1058008473,
+            3312856366, 1080006106, 2277956561, 4166046352, 3195172705, 888931237,  472092791,
+            1220719735, 2445974526, 2644790135, 3109984641, 309778478,  3343627835, 2315694563,
+            463857,     4020959305, 481727676,  1369529826, 799892832,  4136266604, 1180672184,
+            3445514659, 448378240,  1816759545, 2397709360, 2199826880, 3825908126, 1969022581,
+            3385553742, 2031876777, 1778656029, 3093788698, 2119726037, 1989080051, 497286839,
+            2674028952, 3262542694, 3066517683, 1022123038, 3790925406, 515945751,  4200026735,
+            3763614596, 4288797899, 2018849581, 2907953663, 3711699446, 2855999080, 1649736399,
+            2482124325, 4161478871, 2470511447, 367830227,  1613510121, 3721748893, 4127079440,
+            1463937325, 1055001211, 574733033,  512446089,  3248365272, 477667834,  758310147,
+            4066753350, 1873500090, 4126533197, 816231214,  888935266,  1054558175, 2874533719,
+            526852805,  974294645,  280841799,  1974642219, 2146055991, 1244909226, 741871552,
+            3117500161, 1871783736, 2650185000, 3905478733, 3227501410, 2113987148, 3026661187,
+            671121294,  801541836,  711905002,  2450995968, 4094849277, 402105854,  271712366,
+            817975973,  3274686035, 1713471465, 899793428,  2045698749, 3104225624, 4075494777,
+            2027085142, 4148040367, 484269252,  2650845237, 3960372821, 1223832981, 2773658159,
+            3178496851, 3176156865, 3500557080, 3512309352, 4182682776, 963634682,  2507145565,
+            537253657,  2871705658, 2788472617, 1582030262, 4277255511, 4039920292, 3468099738,
+            1398980105, 3449513325, 3127838999, 3386817666, 3261593767, 1887579577, 1158686324,
+            1617754742, 1651505618, 1700824655, 127809648,  785706596,  1727444467, 1696520983,
+            1695907198, 3858767964, 1850060246, 3973810989, 1926388033, 2075318427, 2794901332,
+            3349834904, 3877635709, 3966183307, 1376288007, 249906922,  925321098,  4101698022,
+            4083624186, 2908774911, 4192550245, 1110307623, 1268712631, 3640744472, 2364618573,
+            3955131684, 3414996815, 1612341140, 276113790,  2552932171, 1240456254, 1058008473,
+            3312856366, 1080006106, 1751115541, 4166046352, 3195172705, 888931237,  472092791,
+            1101410236, 2445974526, 2644790135, 3109984641, 309778478,  1693319671, 2315694563,
+            463857,     4020959305, 481727676,  2072514493, 3878833670, 106616796,  1027528739,
+            1483266788, 1630648893, 987424718,  1480716365, 2060410648, 1654334514, 342711368,
+            2208585378, 2166726821, 3515164576, 443477761,  1888262685, 3378069832, 2425870131,
+            2999422082, 4120843898, 3004638427, 400749238,  2101063495, 2819122020, 864685878,
+            933417226,  3966841779, 2710576789, 4234068660, 3613972611, 1577220516, 2073693358,
+            983868440,  1938600123, 3945569835, 3478857894, 1148020940, 3174181417, 2234444190,
+            1522989757, 2551810675, 2335028143, 3421731124, 1641365053, 2021914323, 611466866,
+            900996619,  4036822494, 4127855553, 2456301952, 1204588485, 3536625299, 2971874420,
+            199306695,  2107797044, 3944379779, 613032824,  3454205863, 2292840974, 2535163450,
+            829784885,  1582662674, 1807243729, 86927636,   1731047682, 3819150143, 2860665967,
+            4083347538, 1422168431, 1707923792, 2883278473, 3367652784, 2779069302, 1280429446,
+            819681627,  3122852048, 2525162472, 259574531,  864711668,  3121356164, 11608095,
+            2820358379, 2254360712, 2723945332, 1268962916, 4249286675, 1910555571, 2288054257,
+            459704021,  2735155216, 2540923844, 2062078776, 4190566046, 1280034424, 1307356830,
+            1249993937, 2891703039, 1159486026, 813750056,  4023652373, 3497573794, 3648750284,
+            954177336,  2013166885, 1468309565, 3293842997, 1557300845, 779250295,  87154692,
+            2800551969, 1019358868, 2053146942, 2363675932, 2497145275, 692055462,  1307592212,
+            1332940700, 735531220,  564492906,  3857583579, 3350478836, 2999364605, 2193264496,
+            2585121807, 2638153740, 1524723967, 35832227,   1850977287, 3283096147, 326921482,
+            599925221,  4045169746, 920736451,  3676189166, 2734157348, 1737897206, 2191818516,
+            1681360744, 680590492,  3483794498, 247483538,  2531978201, 3741661159, 3758807678,
+            628946768,  181128283,  1653877582, 2596600286, 615943871,  273321242,  2143167560,
+            1041763316, 2949812234, 846650237,  2334671612, 1774419119, 221085016,  2267794619,
+            2267864906, 1753622275,
+        },
+        {
+            3828483064, 3293007969, 96110007,   1460322382, 2008178795, 3417468022, 3605877289,
+            1039727273, 2808747487, 3263626662, 1517448283, 3254465295, 1804323711, 591689762,
+            3921529670, 3866633595, 2449841085, 1872997009, 214608245,  2135162514, 3364041490,
+            146282031,  182757962,  1722361676, 2917811993, 2438461017, 3131659220, 3089835567,
+            1268055322, 260686020,  475389326,  1247127202, 1387524277, 3409313824, 3714419481,
+            3979464915, 3559322560, 729546120,  853340617,  724470539,  905835109,  931648962,
+            4277751873, 3256759200, 882834817,  1766509471, 4258370514, 2671696839, 3106137250,
+            2221092271, 2660359080, 25391025,   785329444,  1190966982, 1395230385, 4275034554,
+            4116075513, 2731048875, 1843621351, 2644530424, 3561669668, 23047930,   936221537,
+            3169541434, 2914746291, 3244972045, 3405799649, 4129673985, 716085748,  4228735993,
+            3478411942, 4056137625, 1109197296, 155017298,  3308234558, 198632058,  784578049,
+            855645977,  644156581,  1155478101, 3699754027, 2543164107, 1519331150, 1398816537,
+            2367814268, 1963724571, 1011675893, 1161241930, 2393606595, 4147933879, 1671385922,
+            1060072836, 2234566007, 2316465574, 2262532868, 1963679387, 892109373,  715223673,
+            4281908394, 2415652486, 415688935,  1006957361, 755703357,  187096889,  2214136655,
+            1640858799, 3335156211, 4175064136, 565967903,  181814303,  3636190436, 1941883183,
+            70206526,   815511628,  1596751391, 3670685804, 867437598,  799535639,  349245782,
+            1010473218, 213833838,  1979436825, 2349642781, 1592680579, 1930830339, 1933506055,
+            2507306844, 2713980943, 2943842297, 4078731595, 1124811231, 4054359423, 998939992,
+            1769277984, 3120698711, 171991872,  3190678008, 3070954668, 2754979813, 2552427248,
+            2029183627, 2189889109, 2749157589, 3438161257, 1545623630, 2582046291, 543329770,
+            276610960,  2774759358, 1738186720, 4051181829, 1111669314, 4278098795, 557681058,
+            1655761790, 1812523505, 4203966891, 1083916989, 2709157467, 3654849955, 4080840790,
+            3828483064, 3293007969, 96110007,   1460322382, 3244527443, 3417468022, 3605877289,
+            1039727273, 2808747487, 1153115802, 1517448283, 3254465295, 1804323711, 591689762,
+            1999350491, 3866633595, 2449841085, 1872997009, 214608245,  3014042940, 3364041490,
+            146282031,  182757962,  1722361676, 2305522312, 2438461017, 3131659220, 3089835567,
+            1268055322, 2966989843, 475389326,  1247127202, 1387524277, 3409313824, 3669642840,
+            3979464915, 3559322560, 729546120,  853340617,  2534969318, 905835109,  931648962,
+            4277751873, 3256759200, 3071409846, 1766509471, 4258370514, 2671696839, 3106137250,
+            3982323697, 2660359080, 25391025,   785329444,  1190966982, 3518779012, 4275034554,
+            4116075513, 2731048875, 1843621351, 1574365817, 3561669668, 23047930,   936221537,
+            3169541434, 587716252,  3244972045, 3405799649, 4129673985, 716085748,  4150591919,
+            3478411942, 4056137625, 1109197296, 155017298,  3484716928, 198632058,  784578049,
+            855645977,  644156581,  2253708009, 3699754027, 2543164107, 1519331150, 1398816537,
+            1809993370, 1963724571, 1011675893, 1161241930, 2393606595, 2049842328, 1671385922,
+            1060072836, 2234566007, 2316465574, 2882192901, 1963679387, 892109373,  715223673,
+            4281908394, 3725907837, 415688935,  1006957361, 755703357,  187096889,  3653351701,
+            1640858799, 3335156211, 4175064136, 565967903,  671442836,  3636190436, 1941883183,
+            70206526,   815511628,  689096079,  3670685804, 867437598,  799535639,  349245782,
+            1409823935, 213833838,  1979436825, 2349642781, 1592680579, 3020552525, 1933506055,
+            2507306844, 2713980943, 2943842297, 807111025,  1124811231, 4054359423, 998939992,
+            1769277984, 575722070,  171991872,  3190678008, 3070954668, 2754979813, 992968996,
+            2029183627, 2189889109, 2749157589, 3438161257, 1774742408, 2582046291, 543329770,
+            276610960,  2774759358, 4077876496, 4051181829, 1111669314, 4278098795, 557681058,
+            3798334816, 1812523505, 4203966891, 1083916989, 2709157467, 3396125868, 4080840790,
+            3828483064, 3293007969, 96110007,   4228474327, 3244527443, 3417468022, 3605877289,
+            1039727273, 2364275894, 1153115802, 1517448283, 3254465295, 1804323711, 2700221989,
+            1999350491, 3866633595, 2449841085, 1872997009, 2550298920, 3014042940, 3364041490,
+            146282031,  182757962,  649021180,  2305522312, 2438461017, 3131659220, 3089835567,
+            1927160067, 2966989843, 475389326,  1247127202, 1387524277, 2067383142, 3669642840,
+            3979464915, 3559322560, 729546120,  2485639027, 2534969318, 905835109,  931648962,
+            4277751873, 2531970454, 3071409846, 1766509471, 4258370514, 2671696839, 2848732647,
+            3982323697, 2660359080, 25391025,   785329444,  2167387408, 3518779012, 4275034554,
+            4116075513, 2731048875, 1109540916, 1574365817, 3561669668, 23047930,   936221537,
+            3144163798, 587716252,  3244972045, 3405799649, 4129673985, 3789142861, 4150591919,
+            3478411942, 4056137625, 1109197296, 3598941818, 3484716928, 198632058,  784578049,
+            855645977,  3019277604, 2253708009, 3699754027, 2543164107, 1519331150, 2689091193,
+            1809993370, 1963724571, 1011675893, 1161241930, 4135288294, 2049842328, 1671385922,
+            1060072836, 2234566007, 4006103636, 2882192901, 1963679387, 892109373,  715223673,
+            1120226575, 3725907837, 415688935,  1006957361, 755703357,  4032237476, 3653351701,
+            1640858799, 3335156211, 4175064136, 620726439,  671442836,  3636190436, 1941883183,
+            70206526,   2572397350, 689096079,  3670685804, 867437598,  799535639,  3246834632,
+            1409823935, 213833838,  1979436825, 2349642781, 219472898,  3020552525, 1933506055,
+            2507306844, 2713980943, 1259230346, 807111025,  1124811231, 4054359423, 998939992,
+            731742035,  575722070,  171991872,  3190678008, 3070954668, 1042425391, 992968996,
+            2029183627, 2189889109, 2749157589, 3191658824, 1774742408, 2582046291, 543329770,
+            276610960,  3649536787, 4077876496, 4051181829, 1111669314, 4278098795, 2254073533,
+            3798334816, 1812523505, 4203966891, 1083916989, 1710866690, 3396125868, 4080840790,
+            3828483064, 3293007969, 2835374485, 4228474327, 3244527443, 3417468022, 3605877289,
+            3159642965, 2364275894, 1153115802, 1517448283, 3254465295, 2424876304, 2700221989,
+            1999350491, 3866633595, 2449841085, 2891734332, 2550298920, 3014042940, 3364041490,
+            146282031,  3042691806, 649021180,  2305522312, 2438461017, 3131659220, 1994185947,
+            1927160067, 2966989843, 475389326,  1247127202, 1992192671, 2067383142, 3669642840,
+            3979464915, 3559322560, 3207739691, 2485639027, 2534969318, 905835109,  931648962,
+            2003942422, 2531970454, 3071409846, 1766509471, 4258370514, 387112790,  2848732647,
+            3982323697, 2660359080, 25391025,   31369063,   2167387408, 3518779012, 4275034554,
+            4116075513, 417357428,  1109540916, 1574365817, 3561669668, 23047930,   2938865941,
+            3144163798, 587716252,  3244972045, 3405799649, 3078369555, 3789142861, 4150591919,
+            3478411942, 4056137625, 2353411487, 3598941818, 3484716928, 198632058,  784578049,
+            3170805436, 3019277604, 2253708009, 3699754027, 2543164107, 1994058884, 2689091193,
+            1809993370, 1963724571, 1011675893, 4191410667, 4135288294, 2049842328, 1671385922,
+            1060072836, 4200002063, 4006103636, 2882192901, 1963679387, 892109373,  1499872058,
+            1120226575, 3725907837, 415688935,  1006957361, 1041707723, 4032237476, 3653351701,
+            1640858799, 3335156211, 910528793,  620726439,  671442836,  3636190436, 1941883183,
+            3607988358, 2572397350, 689096079,  3670685804, 867437598,  2103522469, 3246834632,
+            1409823935, 213833838,  1979436825, 3881392235, 219472898,  3020552525, 1933506055,
+            2507306844, 1507921649, 1259230346, 807111025,  1124811231, 4054359423, 1270470746,
+            731742035,  575722070,  171991872,  3190678008, 112464447,  1042425391, 992968996,
+            2029183627, 2189889109, 401099207,  3191658824, 1774742408, 2582046291, 543329770,
+            2691213651, 3649536787, 4077876496, 4051181829, 1111669314, 227070850,  2254073533,
+            3798334816, 1812523505, 4203966891, 1527076326, 906455472,  3460605250, 3702677761,
+            1925985836, 2671904135, 868084743,  2572051724, 2868904298, 421254653,  1236228014,
+            239408814,  1042575571, 1770454220, 4161923974, 1276327104, 1618237542, 1248512191,
+            4152973281, 882142886,  150732116,  841943134,  3788141589, 1246516437, 1053307648,
+            100632597,  1459285212, 4079872821, 2041166049, 2397536467, 4223537749, 3163200203,
+            320449157,  3420814097, 2896694688, 3169829302, 2330758908, 3402118533, 627383356,
+            981171149,  2525538358, 1273431395, 404784636,  3154597063, 4218691628, 3864964631,
+            2205696277, 66005340,   1712967275, 1498538196, 837309509,  3712815437, 1747221895,
+            2065214271, 3475490786, 1086143957, 991787039,  890726369,  4063213346, 3354205565,
+            1650300030, 3353368556, 859791069,  1921943182, 1438273871, 307712788,  377333215,
+            3538360705, 1443030304, 143953956,  4223113822, 480598317,  4267817289, 716093301,
+            3041514093, 2055135917, 2401610478, 377790023,  3406656485, 2050036681, 3177029094,
+            3070052613, 476525098,  4085126117, 3584403881, 2869002206, 2146606472, 2816617021,
+            2684103945, 2031020754, 1349448288, 52255529,   598347667,  1353924542, 3937410066,
+            2031975900, 1327647443, 306012706,  3135930966, 552690843,  3076420191, 426573323,
+            1766718246, 4200496743, 2077233146, 2720599762, 2019094988, 1409042862, 2482948288,
+            786513838,  2862641314, 3603704156, 154610869,  3650908398, 1488027564, 3429483776,
+            3017237157, 52242033,   4010850390, 2480188528, 4149524334, 853821474,  1292325436,
+            2571671930, 782122953,  3831942613, 3690182598, 432224379,  3704779713, 3074186425,
+            1244252391, 4211379534, 4172168143, 1503056806, 2024900209, 2830315299, 697954290,
+            3307166632, 2785946698, 258611166,  3100756969, 3194345942, 2152202233, 3144187613,
+            3281689686, 3637256824, 3475270591, 1897444087, 416340351,  2167815980, 3905702744,
+            1218765323, 2435014936, 1647055880, 2471769357, 3398637707, 3340487433, 1094821300,
+            2737068244, 3475812645,
+        },
+        {
+            665016681,  2650993758, 182048245,  3337710175, 1858410868, 1860001651, 1425191173,
+            805564476,  2766372254, 4263735349, 3436346071, 2719855008, 1826578960, 3220338892,
+            3184175158, 1671781690, 2709760387, 1986018695, 2594965028, 2479897539, 2446181264,
+            2468796493, 3925642479, 1164772909, 83669325,   3737322150, 192847750,  2144687812,
+            3798930999, 2994042099, 2507399372, 538982759,  900033325,  2905550796, 982027825,
+            1709473775, 3858736234, 879479090,  4292453839, 3769637282, 566306678,  3469534456,
+            923820042,  1354896140, 1903241111, 3306010020, 1249475808, 2520358104, 4175729459,
+            2770040289, 1912706815, 416896749,  2436525736, 210889703,  3344995332, 235099759,
+            706660522,  348849339,  1516307907, 2167636207, 3819437652, 2003446215, 2548083936,
+            3561848072, 2040186748, 921774744,  1596964828, 2832240506, 2569034076, 3192736901,
+            3628800411, 3397197298, 4110622792, 1643611809, 1564805058, 2895258512, 443164709,
+            4098088674, 3952462826, 1595146636, 2408976748, 705398299,  2328746555, 2038518124,
+            1563058655, 779620912,  2651997086, 12774178,   649600788,  2854089514, 567363656,
+            220073728,  2631102919, 3617845654, 1194717920, 142450545,  2025342745, 1020598749,
+            2938879906, 3022382243, 3908842593, 3678568979, 1962527042, 22096492,   4077231102,
+            2158557876, 1979749766, 1607428931, 910654152,  3814220256, 2962675300, 490096726,
+            822785514,  1705507995, 2180174987, 2687896018, 3273719590, 207696360,  444192522,
+            3016864431, 1461523981, 1058918133, 2635754511, 3460331249, 115666311,  932979360,
+            3464467306, 420020288,  3584058614, 79615467,   3367614095, 334562388,  1190816396,
+            1726621652, 3255631316, 3065613646, 153149511,  1900665119, 2034135739, 1648526613,
+            1381158301, 2287146146, 2869499338, 3329407403, 3640772601, 1279673193, 1485431831,
+            867838510,  914316778,  225356632,  3523597476, 411913240,  1132698583, 657496828,
+            838254424,  4176956743, 3132037503, 1343617669, 1760397512, 2464069515, 1462462558,
+            665016681,  2650993758, 182048245,  3337710175, 3278966731, 1860001651, 1425191173,
+            805564476,  2766372254, 1167159277, 3436346071, 2719855008, 1826578960, 3220338892,
+            2128410446, 1671781690, 2709760387, 1986018695, 2594965028, 244911936,  2446181264,
+            2468796493, 3925642479, 1164772909, 612840335,  3737322150, 192847750,  2144687812,
+            3798930999, 4231805558, 2507399372, 538982759,  900033325,  2905550796, 1293175971,
+            1709473775, 3858736234, 879479090,  4292453839, 3500670196, 566306678,  3469534456,
+            923820042,  1354896140, 2490483634, 3306010020, 1249475808, 2520358104, 4175729459,
+            3441282155, 1912706815, 416896749,  2436525736, 210889703,  600640111,  235099759,
+            706660522,  348849339,  1516307907, 1248217968, 3819437652, 2003446215, 2548083936,
+            3561848072, 1893754476, 921774744,  1596964828, 2832240506, 2569034076, 413019582,
+            3628800411, 3397197298, 4110622792, 1643611809, 3372838999, 2895258512, 443164709,
+            4098088674, 3952462826, 3135065665, 2408976748, 705398299,  2328746555, 2038518124,
+            1320159607, 779620912,  2651997086, 12774178,   649600788,  2273747351, 567363656,
+            220073728,  2631102919, 3617845654, 2262440268, 142450545,  2025342745, 1020598749,
+            2938879906, 1318796711, 3908842593, 3678568979, 1962527042, 22096492,   1943224863,
+            2158557876, 1979749766, 1607428931, 910654152,  3140294954, 2962675300, 490096726,
+            822785514,  1705507995, 81422678,   2687896018, 3273719590, 207696360,  444192522,
+            481437053,  1461523981, 1058918133, 2635754511, 3460331249, 2912122844, 932979360,
+            3464467306, 420020288,  3584058614, 1385879296, 3367614095, 334562388,  1190816396,
+            1726621652, 1617806685, 3065613646, 153149511,  1900665119, 2034135739, 3975486183,
+            1381158301, 2287146146, 2869499338, 3329407403, 988105383,  1279673193, 1485431831,
+            867838510,  914316778,  688153008,  3523597476, 411913240,  1132698583, 657496828,
+            3922859092, 4176956743, 3132037503, 1343617669, 1760397512, 3873057517, 1462462558,
+            665016681,  2650993758, 182048245,  2768809549, 3278966731, 1860001651, 1425191173,
+            805564476,  140425360,  1167159277, 3436346071, 2719855008, 1826578960, 2902740417,
+            2128410446, 1671781690, 2709760387, 1986018695, 3639978381, 244911936,  2446181264,
+            2468796493, 3925642479, 3861820948, 612840335,  3737322150, 192847750,  2144687812,
+            2556202611, 4231805558, 2507399372, 538982759,  900033325,  2939665315, 1293175971,
+            1709473775, 3858736234, 879479090,  238873474,  3500670196, 566306678,  3469534456,
+            923820042,  3378839988, 2490483634, 3306010020, 1249475808, 2520358104, 2925777156,
+            3441282155, 1912706815, 416896749,  2436525736, 26385973,   600640111,  235099759,
+            706660522,  348849339,  3699216671, 1248217968, 3819437652, 2003446215, 2548083936,
+            3136083453, 1893754476, 921774744,  1596964828, 2832240506, 1446111187, 413019582,
+            3628800411, 3397197298, 4110622792, 948401183,  3372838999, 2895258512, 443164709,
+            4098088674, 4149824228, 3135065665, 2408976748, 705398299,  2328746555, 509254461,
+            1320159607, 779620912,  2651997086, 12774178,   2821798579, 2273747351, 567363656,
+            220073728,  2631102919, 994631377,  2262440268, 142450545,  2025342745, 1020598749,
+            314370248,  1318796711, 3908842593, 3678568979, 1962527042, 1769440139, 1943224863,
+            2158557876, 1979749766, 1607428931, 805479513,  3140294954, 2962675300, 490096726,
+            822785514,  1503587559, 81422678,   2687896018, 3273719590, 207696360,  1740305608,
+            481437053,  1461523981, 1058918133, 2635754511, 4134908738, 2912122844, 932979360,
+            3464467306, 420020288,  927131125,  1385879296, 3367614095, 334562388,  1190816396,
+            3307107568, 1617806685, 3065613646, 153149511,  1900665119, 1548448614, 3975486183,
+            1381158301, 2287146146, 2869499338, 3716006885, 988105383,  1279673193, 1485431831,
+            867838510,  4127689121, 688153008,  3523597476, 411913240,  1132698583, 327301129,
+            3922859092, 4176956743, 3132037503, 1343617669, 622219211,  3873057517, 1462462558,
+            665016681,  2650993758, 519369683,  2768809549, 3278966731, 1860001651, 1425191173,
+            2215261674, 140425360,  1167159277, 3436346071, 2719855008, 1359635237, 2902740417,
+            2128410446, 1671781690, 2709760387, 4192769394, 3639978381, 244911936,  2446181264,
+            2468796493, 2566812647, 3861820948, 612840335,  3737322150, 192847750,  248393746,
+            2556202611, 4231805558, 2507399372, 538982759,  1652871712, 2939665315, 1293175971,
+            1709473775, 3858736234, 255734823,  238873474,  3500670196, 566306678,  3469534456,
+            3988945696, 3378839988, 2490483634, 3306010020, 1249475808, 51888835,   2925777156,
+            3441282155, 1912706815, 416896749,  2725619827, 26385973,   600640111,  235099759,
+            706660522,  1746924964, 3699216671, 1248217968, 3819437652, 2003446215, 66886696,
+            3136083453, 1893754476, 921774744,  1596964828, 2692461255, 1446111187, 413019582,
+            3628800411, 3397197298, 4193839601, 948401183,  3372838999, 2895258512, 443164709,
+            3438180032, 4149824228, 3135065665, 2408976748, 705398299,  4008309701, 509254461,
+            1320159607, 779620912,  2651997086, 858739150,  2821798579, 2273747351, 567363656,
+            220073728,  2647908954, 994631377,  2262440268, 142450545,  2025342745, 3344490931,
+            314370248,  1318796711, 3908842593, 3678568979, 4177713027, 1769440139, 1943224863,
+            2158557876, 1979749766, 1144633797, 805479513,  3140294954, 2962675300, 490096726,
+            1169061405, 1503587559, 81422678,   2687896018, 3273719590, 1056192210, 1740305608,
+            481437053,  1461523981, 1058918133, 355946322,  4134908738, 2912122844, 932979360,
+            3464467306, 3784472736, 927131125,  1385879296, 3367614095, 334562388,  2279023584,
+            3307107568, 1617806685, 3065613646, 153149511,  2981377077, 1548448614, 3975486183,
+            1381158301, 2287146146, 1306762668, 3716006885, 988105383,  1279673193, 1485431831,
+            1486005499, 4127689121, 688153008,  3523597476, 411913240,  4291549869, 327301129,
+            3922859092, 4176956743, 3132037503, 936534179,  646469608,  4234507642, 1920276150,
+            163170972,  2849019133, 743539229,  982785829,  481300418,  4193375741, 4246873592,
+            475165217,  2658624187, 3801317367, 2052833129, 3242024966, 2052376004, 3883167784,
+            832360117,  3948455928, 877426816,  1010239615, 3644525458, 1550812483, 1274369027,
+            2608194867, 3016569717, 3847561004, 2342290764, 1325546643, 1702519347, 2323359754,
+            963998369,  1411037769, 1092203194, 3932407527, 807729197,  2821999059, 3110155383,
+            127901194,  4053001613, 1039772256, 2345501073, 2253853392, 1737634717, 2957419937,
+            2964757069, 1246669295, 442350457,  1034220087, 3788503595, 726815960,  2438197918,
+            2154883135, 3050708230, 3099847914, 925305437,  1547776263, 3675968914, 3976928552,
+            3277093834, 3087581299, 3711791029, 3221489211, 3791058970, 3979494604, 865939990,
+            3294810404, 3807706346, 886000331,  3381292080, 341997378,  3695105738, 1202152390,
+            796691310,  764497604,  1794418031, 2761355002, 940744405,  1102717530, 323178013,
+            3108519641, 1465852670, 3260350581, 2089158447, 3713264370, 1293104847, 1450593186,
+            3771374777, 1767402861, 2106829237, 2657961563, 2198313138, 2962288947, 831304278,
+            3197960794, 4142219146, 1435304056, 3577388831, 1792485914, 1726285316, 424564419,
+            802647242,  826611254,  3672068677, 2125017080, 88073808,   4161592940, 2817188836,
+            899523996,  3503406624, 3042698330, 3021064214, 2697792301, 2999774728, 3584810890,
+            2552291619, 107841067,  3079678580, 1719935469, 3102978420, 606458561,  1342785371,
+            57045010,   4149440204, 2190745131, 2487532471, 741703575,  316652748,  2363449420,
+            565437375,  826837013,  2951862801, 2727818049, 483842606,  136661172,  3352529903,
+            3039282441, 1898054219, 2317457742, 2720159079, 328622418,  1339888180, 2737309907,
+            4051354958, 65530574,   1308915554, 2474226823, 2845638176, 3856317769, 4050195210,
+            2851846129, 1610366544, 1995988960, 2768079684, 1210179771, 3085580822, 2758279711,
+            1304041035, 3041745676,
+        },
+        {
+            2452451286, 3095791716, 637202086,  210643439,  3461971033, 713794606,  699636542,
+            609524544,  904045357,  3561724068, 4151083401, 1171375004, 4007946370, 1925847270,
+            3690144399, 3009284984, 2477771454, 1036024590, 1274561498, 2990145273, 822373877,
+            122456576,  4201666568, 3425592622, 2473659611, 3020244816, 2635301972, 3753234010,
+            2366830782, 2673286869, 2502915673, 3876950969, 389735915,  2379755007, 478055364,
+            437382574,  1094065594, 2133592927, 3046053236, 3703060048, 2499661037, 3714385981,
+            3055309611, 4238635514, 2985096828, 149278815,  1187263060, 1940556092, 788265897,
+            4245520728, 3621139356, 2174641867, 472529437,  2306853815, 494596419,  732605249,
+            1502681163, 951871980,  2058132156, 1107021317, 1079077950, 1579873082, 636718362,
+            3590800435, 3752730879, 2354682539, 3474237790, 2304603395, 3004825834, 2657237976,
+            2156225770, 4048921106, 31826423,   1206094617, 2444186066, 1634735367, 3683745694,
+            2115999250, 2699661881, 3367290463, 1020271572, 2306375386, 1344800145, 2346982925,
+            978925803,  1610283147, 1379348083, 2648936523, 458683746,  1892974781, 2295868984,
+            1736543722, 1872469010, 2721845919, 3605322792, 2760684065, 1765799368, 3532944683,
+            875857205,  1363453352, 1110305408, 3785190323, 1494051228, 1975669590, 1935686497,
+            4052587483, 1389024457, 3883249469, 656317610,  1606817867, 210431537,  2201125287,
+            551646640,  3355348553, 3724661532, 1755173756, 2015733708, 3997425374, 3933689989,
+            3006887785, 860013451,  1593283280, 1821773058, 3523611736, 1578951474, 696516442,
+            3550370021, 284222981,  1965900355, 2985605260, 3223374989, 3588113546, 710272002,
+            1274309585, 659720977,  10321246,   3278098156, 1470001845, 2238104289, 42005352,
+            584389225,  2151356707, 2977407981, 1049149968, 3752765191, 1174501502, 2841486101,
+            3132392182, 3389652515, 3373443700, 2541650292, 682118172,  2328268658, 2140993285,
+            3207412960, 3600434712, 3348172471, 3183102971, 608787770,  3794406523, 132712194,
+            2452451286, 3095791716, 637202086,  210643439,  2001995411, 713794606,  699636542,
+            609524544,  904045357,  1710564691, 4151083401, 1171375004, 4007946370, 1925847270,
+            833172308,  3009284984, 2477771454, 1036024590, 1274561498, 1866905795, 822373877,
+            122456576,  4201666568, 3425592622, 2564929227, 3020244816, 2635301972, 3753234010,
+            2366830782, 4205846686, 2502915673, 3876950969, 389735915,  2379755007, 365839130,
+            437382574,  1094065594, 2133592927, 3046053236, 1678011607, 2499661037, 3714385981,
+            3055309611, 4238635514, 271961318,  149278815,  1187263060, 1940556092, 788265897,
+            18061616,   3621139356, 2174641867, 472529437,  2306853815, 2797897964, 732605249,
+            1502681163, 951871980,  2058132156, 744233914,  1079077950, 1579873082, 636718362,
+            3590800435, 163999911,  2354682539, 3474237790, 2304603395, 3004825834, 3044027809,
+            2156225770, 4048921106, 31826423,   1206094617, 3835334376, 1634735367, 3683745694,
+            2115999250, 2699661881, 71631549,   1020271572, 2306375386, 1344800145, 2346982925,
+            2446382148, 1610283147, 1379348083, 2648936523, 458683746,  1033089380, 2295868984,
+            1736543722, 1872469010, 2721845919, 455092067,  2760684065, 1765799368, 3532944683,
+            875857205,  946092635,  1110305408, 3785190323, 1494051228, 1975669590, 3396585523,
+            4052587483, 1389024457, 3883249469, 656317610,  3837924265, 210431537,  2201125287,
+            551646640,  3355348553, 1155454789, 1755173756, 2015733708, 3997425374, 3933689989,
+            3058164178, 860013451,  1593283280, 1821773058, 3523611736, 2764638276, 696516442,
+            3550370021, 284222981,  1965900355, 1484798527, 3223374989, 3588113546, 710272002,
+            1274309585, 1496630380, 10321246,   3278098156, 1470001845, 2238104289, 114465444,
+            584389225,  2151356707, 2977407981, 1049149968, 2127531598, 1174501502, 2841486101,
+            3132392182, 3389652515, 3742494185, 2541650292, 682118172,  2328268658, 2140993285,
+            1740452582, 3600434712, 3348172471, 3183102971, 608787770,  3898505849, 132712194,
+            2452451286, 3095791716, 637202086,  4031013660, 2001995411, 713794606,  699636542,
+            609524544,  668169573,  1710564691, 4151083401, 1171375004, 4007946370, 3034446223,
+            833172308,  3009284984, 2477771454, 1036024590, 1784601725, 1866905795, 822373877,
+            122456576,  4201666568, 2031238810, 2564929227, 3020244816, 2635301972, 3753234010,
+            2258412720, 4205846686, 2502915673, 3876950969, 389735915,  320386142,  365839130,
+            437382574,  1094065594, 2133592927, 512317875,  1678011607, 2499661037, 3714385981,
+            3055309611, 3829851798, 271961318,  149278815,  1187263060, 1940556092, 1037765869,
+            18061616,   3621139356, 2174641867, 472529437,  1403315093, 2797897964, 732605249,
+            1502681163, 951871980,  3057020076, 744233914,  1079077950, 1579873082, 636718362,
+            2073382764, 163999911,  2354682539, 3474237790, 2304603395, 966993399,  3044027809,
+            2156225770, 4048921106, 31826423,   3718099147, 3835334376, 1634735367, 3683745694,
+            2115999250, 2479467344, 71631549,   1020271572, 2306375386, 1344800145, 4113976428,
+            2446382148, 1610283147, 1379348083, 2648936523, 3668090339, 1033089380, 2295868984,
+            1736543722, 1872469010, 1360757218, 455092067,  2760684065, 1765799368, 3532944683,
+            1986821805, 946092635,  1110305408, 3785190323, 1494051228, 3180090724, 3396585523,
+            4052587483, 1389024457, 3883249469, 1247838137, 3837924265, 210431537,  2201125287,
+            551646640,  1288326027, 1155454789, 1755173756, 2015733708, 3997425374, 3901527480,
+            3058164178, 860013451,  1593283280, 1821773058, 3787522877, 2764638276, 696516442,
+            3550370021, 284222981,  2599353278, 1484798527, 3223374989, 3588113546, 710272002,
+            2026139034, 1496630380, 10321246,   3278098156, 1470001845, 1823043254, 114465444,
+            584389225,  2151356707, 2977407981, 2451941187, 2127531598, 1174501502, 2841486101,
+            3132392182, 4119672590, 3742494185, 2541650292, 682118172,  2328268658, 4267411084,
+            1740452582, 3600434712, 3348172471, 3183102971, 255492199,  3898505849, 132712194,
+            2452451286, 3095791716, 1750935389, 4031013660, 2001995411, 713794606,  699636542,
+            1119220471, 668169573,  1710564691, 4151083401, 1171375004, 1777495402, 3034446223,
+            833172308,  3009284984, 2477771454, 2890077386, 1784601725, 1866905795, 822373877,
+            122456576,  2807910754, 2031238810, 2564929227, 3020244816, 2635301972, 1720602776,
+            2258412720, 4205846686, 2502915673, 3876950969, 471926185,  320386142,  365839130,
+            437382574,  1094065594, 3128494845, 512317875,  1678011607, 2499661037, 3714385981,
+            4119197664, 3829851798, 271961318,  149278815,  1187263060, 2846354050, 1037765869,
+            18061616,   3621139356, 2174641867, 2327505243, 1403315093, 2797897964, 732605249,
+            1502681163, 1814362624, 3057020076, 744233914,  1079077950, 1579873082, 3180919075,
+            2073382764, 163999911,  2354682539, 3474237790, 1333270614, 966993399,  3044027809,
+            2156225770, 4048921106, 167089530,  3718099147, 3835334376, 1634735367, 3683745694,
+            933521483,  2479467344, 71631549,   1020271572, 2306375386, 1239741855, 4113976428,
+            2446382148, 1610283147, 1379348083, 3937100383, 3668090339, 1033089380, 2295868984,
+            1736543722, 532901844,  1360757218, 455092067,  2760684065, 1765799368, 2130894651,
+            1986821805, 946092635,  1110305408, 3785190323, 1812808271, 3180090724, 3396585523,
+            4052587483, 1389024457, 1793970609, 1247838137, 3837924265, 210431537,  2201125287,
+            267385944,  1288326027, 1155454789, 1755173756, 2015733708, 1544214616, 3901527480,
+            3058164178, 860013451,  1593283280, 2337436480, 3787522877, 2764638276, 696516442,
+            3550370021, 2995014325, 2599353278, 1484798527, 3223374989, 3588113546, 3003059513,
+            2026139034, 1496630380, 10321246,   3278098156, 3628434978, 1823043254, 114465444,
+            584389225,  2151356707, 2819886270, 2451941187, 2127531598, 1174501502, 2841486101,
+            3547857378, 4119672590, 3742494185, 2541650292, 682118172,  21448720,   4267411084,
+            1740452582, 3600434712, 3348172471, 2394665641, 3645147461, 997878261,  1054563390,
+            4226266016, 910015181,  4240336867, 938754074,  4035059815, 197350924,  529408499,
+            3639278755, 35054391,   617199811,  4215968647, 3805932043, 334789255,  2085802558,
+            828630549,  813145705,  1489353611, 174103241,  38286025,   1460764744, 4056076385,
+            2732522099, 990790885,  2955044590, 3519730245, 3645998972, 2245078951, 4247743217,
+            1126858407, 686795469,  3654156669, 2564816358, 3682292022, 2090338175, 2991223556,
+            4201029045, 4276499848, 1651930237, 975112770,  2547465692, 3363632043, 1049489396,
+            4064156817, 4178117216, 3164476009, 2528132773, 510662094,  949596390,  2440426740,
+            1678695913, 2518296763, 1602595193, 3036406295, 3676059489, 1379730207, 610779467,
+            652823304,  1189095308, 3385613129, 3411411610, 424344499,  959841413,  4017223783,
+            1436736751, 583793811,  2125751327, 2404274090, 2486651135, 4100501549, 633521870,
+            3389578428, 1640276533, 1011037923, 803585170,  1576036629, 3342879122, 204314244,
+            958009449,  784745065,  2454557975, 3144704596, 1809778113, 3242617828, 2125418715,
+            3492151847, 2111727170, 1409359619, 1509743909, 1692031810, 1867480728, 2759724306,
+            1416757676, 3459988154, 2525977455, 4223677824, 625703286,  43249318,   2216032592,
+            3100562883, 367914135,  789925621,  3816659898, 1256159059, 1062831800, 4060257518,
+            480774016,  3881214073, 3884194692, 906400958,  1139367346, 3814897039, 2240435394,
+            162521143,  1987004812, 2047344343, 4265337057, 4186228941, 1253528126, 2504459023,
+            2027243746, 378584050,  3316625062, 3356140687, 120115813,  522651829,  4105022261,
+            1782540876, 2615341187, 2435701413, 2885748236, 3600597502, 2211072173, 856351280,
+            1219911710, 3970026826, 1990388682, 4013507243, 930923657,  1540729407, 1560752283,
+            2144477938, 2264365417, 786658775,  3167146644, 3255393498, 2215126180, 1129959546,
+            2418135448, 1705830038, 3132951423, 767789579,  37726116,   58257332,   4246956344,
+            2594069470, 1275338182,
+        },
+};
@@ -27,12 +27,20 @@
 #include <miopen/logger.hpp>
 #include <miopen/config.h>
 
+#include <condition_variable>
 #include <cstdlib>
 #include <chrono>
 #include <ios>
 #include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <vector>
 
 #ifdef __linux__
+#include <pthread.h>
 #include <unistd.h>
 #include <sys/syscall.h> /* For SYS_xxx definitions */
 #endif
@@ -60,6 +68,10 @@ MIOPEN_DECLARE_ENV_VAR(MIOPEN_ENABLE_LOGGING_ELAPSED_TIME)
 /// See LoggingLevel in the header.
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_LOG_LEVEL)
 
+/// Hand the log messages over to a background thread which writes them out,
+/// so the calling threads do not wait for the output.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_ENABLE_LOGGING_ASYNC)
+
 namespace debug {
 
 bool LoggingQuiet = false;
@@ -100,6 +112,36 @@ inline int GetProcessAndThreadId()
 #endif
 }
 
+/// Incremented in the child after each fork(). The state kept per thread or relying on the
+/// threads of the parent process is not valid in the child then.
+unsigned& ForkGeneration()
+{
+    static unsigned generation = 0;
+    return generation;
+}
+
+void HandleForks()
+{
+#ifdef __linux__
+    static const auto registered = pthread_atfork(nullptr, nullptr, []() { ++ForkGeneration(); });
+    (void)registered;
+#endif
+}
+
+inline int GetCachedProcessAndThreadId()
+{
+    HandleForks();
+    static thread_local auto generation = ForkGeneration();
+    static thread_local auto id         = GetProcessAndThreadId();
+    // The thread which has called fork() has another id in the child.
+    if(generation != ForkGeneration())
+    {
+        generation = ForkGeneration();
+        id         = GetProcessAndThreadId();
+    }
+    return id;
+}
+
 inline float GetTimeDiff()
 {
     static auto prev = std::chrono::steady_clock::now();
@@ -110,16 +152,219 @@ inline float GetTimeDiff()
     return rv;
 }
 
+LoggingLevel GetDefaultLoggingLevel()
+{
+#ifdef NDEBUG // Simplest way.
+    return LoggingLevel::Warning;
+#else
+    return LoggingLevel::Info;
+#endif
+}
+
+/// Appends to a string which keeps its capacity between the messages.
+class StringBuf : public std::streambuf
+{
+    public:
+    std::string str;
+
+    protected:
+    int_type overflow(int_type c) override
+    {
+        if(!traits_type::eq_int_type(c, traits_type::eof()))
+            str.push_back(traits_type::to_char_type(c));
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        str.append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+};
+
+struct MessageBuffer
+{
+    StringBuf buf;
+    std::ostream stream{&buf};
+    std::ios fresh_state{nullptr};
+
+    MessageBuffer() { fresh_state.copyfmt(stream); }
+};
+
+/// Buffers of the calling thread, one per nesting level of the messages.
+struct MessageBuffers
+{
+    std::vector<std::unique_ptr<MessageBuffer>> buffers;
+    std::size_t used = 0;
+
+    static MessageBuffers& Get()
+    {
+        static thread_local MessageBuffers instance;
+        return instance;
+    }
+
+    MessageBuffer& Acquire()
+    {
+        if(used == buffers.size())
+            buffers.emplace_back(new MessageBuffer{});
+        auto& buffer = *buffers[used++];
+        buffer.buf.str.clear();
+        buffer.stream.copyfmt(buffer.fresh_state);
+        buffer.stream.clear();
+        return buffer;
+    }
+
+    void Release() { --used; }
+};
+
+/// Bounded queue of the messages and the thread which writes them into std::cerr.
+/// The producers wait while the queue is full, so no message is dropped.
+/// Forked children write their messages directly, as the writer thread is not copied to them.
+class AsyncSink
+{
+    public:
+    static AsyncSink* Get()
+    {
+        // Leaked, because messages may be written during the destruction of the static objects.
+        static AsyncSink* const instance =
+            miopen::IsEnabled(MIOPEN_ENABLE_LOGGING_ASYNC{}) ? new AsyncSink{} : nullptr;
+        if(instance == nullptr || instance->generation != ForkGeneration())
+            return nullptr;
+        return instance;
+    }
+
+    /// Takes the content of the message, leaving a previously written string of the same
+    /// capacity in its place. \return false if the sink is already stopped.
+    bool Push(std::string& message)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [&]() { return count < ring.size() || stopped; });
+        if(stopped)
+            return false;
+        ring[(first + count) % ring.size()].swap(message);
+        ++count;
+        lock.unlock();
+        not_empty.notify_one();
+        return true;
+    }
+
+    private:
+    static constexpr std::size_t capacity = 4096;
+    /// PIPE_BUF on Linux.
+    static constexpr std::size_t atomic_write = 4096;
+
+    std::vector<std::string> ring;
+    std::size_t first = 0;
+    std::size_t count = 0;
+    bool stopped      = false;
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::thread writer;
+    unsigned generation = ForkGeneration();
+
+    AsyncSink() : ring(capacity)
+    {
+        HandleForks();
+        writer = std::thread{[this]() { Run(); }};
+        std::atexit([]() {
+            // Nothing to join in a forked child.
+            if(auto* const sink = Get())
+                sink->Stop();
+        });
+    }
+
+    void Run()
+    {
+        std::string batch;
+        std::vector<std::size_t> ends;
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            not_empty.wait(lock, [&]() { return count > 0 || stopped; });
+            if(count == 0)
+                return;
+            batch.clear();
+            ends.clear();
+            for(; count > 0; --count, first = (first + 1) % ring.size())
+            {
+                batch += ring[first];
+                ends.push_back(batch.size());
+            }
+            lock.unlock();
+            not_full.notify_all();
+            WriteBatch(batch, ends);
+            lock.lock();
+        }
+    }
+
+    /// Writes whole messages in pieces of up to atomic_write bytes. Larger writes into a pipe
+    /// may be interleaved with the messages of other processes, e.g. forked children.
+    static void WriteBatch(const std::string& batch, const std::vector<std::size_t>& ends)
+    {
+        std::size_t begin = 0;
+        for(auto end = ends.begin(); end != ends.end();)
+        {
+            auto last = end++;
+            while(end != ends.end() && *end - begin <= atomic_write)
+                last = end++;
+            std::cerr.write(batch.data() + begin, static_cast<std::streamsize>(*last - begin));
+            begin = *last;
+        }
+    }
+
+    /// Writes out everything queued. Later messages are written by the calling threads.
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        not_empty.notify_all();
+        not_full.notify_all();
+        if(writer.joinable())
+            writer.join();
+    }
+};
+
 } // namespace
 
-bool IsLoggingDebugQuiet()
+namespace logger {
+
+Switches ReadSwitches()
 {
-    return debug::LoggingQuiet && !miopen::IsEnabled(MIOPEN_DEBUG_LOGGING_QUIETING_DISABLE{});
+    const auto level = miopen::Value(MIOPEN_LOG_LEVEL{});
+    Switches switches{};
+    switches.max_level      = level == LoggingLevel::Default ? GetDefaultLoggingLevel()
+                                                             : static_cast<LoggingLevel>(level);
+    switches.function_calls = miopen::IsEnabled(MIOPEN_ENABLE_LOGGING{});
+    switches.cmd            = miopen::IsEnabled(MIOPEN_ENABLE_LOGGING_CMD{});
+    return switches;
 }
 
-bool IsLoggingFunctionCalls()
+Message::Message() : stream(&MessageBuffers::Get().Acquire().stream) {}
+
+Message::~Message() { MessageBuffers::Get().Release(); }
+
+static void Write(std::string& message)
 {
-    return miopen::IsEnabled(MIOPEN_ENABLE_LOGGING{}) && !IsLoggingDebugQuiet();
+    auto* const sink = AsyncSink::Get();
+    if(sink == nullptr || !sink->Push(message))
+        std::cerr.write(message.data(), static_cast<std::streamsize>(message.size()));
+    message.clear();
+}
+
+void Message::Write() { logger::Write(static_cast<StringBuf*>(stream->rdbuf())->str); }
+
+void StartSink() { (void)AsyncSink::Get(); }
+
+void WriteMessage(std::string message) { logger::Write(message); }
+
+} // namespace logger
+
+bool IsLoggingDebugQuiet()
+{
+    return debug::LoggingQuiet && !miopen::IsEnabled(MIOPEN_DEBUG_LOGGING_QUIETING_DISABLE{});
 }
 
 bool IsLogging(const LoggingLevel level, const bool disableQuieting)
@@ -133,11 +378,7 @@ bool IsLogging(const LoggingLevel level, const bool disableQuieting)
     }
     if(enabled_level != LoggingLevel::Default)
         return enabled_level >= level;
-#ifdef NDEBUG // Simplest way.
-    return LoggingLevel::Warning >= level;
-#else
-    return LoggingLevel::Info >= level;
-#endif
+    return static_cast<int>(GetDefaultLoggingLevel()) >= static_cast<int>(level);
 }
 
 const char* LoggingLevelToCString(const LoggingLevel level)
@@ -163,29 +404,41 @@ const char* LoggingLevelToCString(const LoggingLevel level)
     else
         return "<Unknown>";
 }
-bool IsLoggingCmd()
-{
-    return miopen::IsEnabled(MIOPEN_ENABLE_LOGGING_CMD{}) && !IsLoggingDebugQuiet();
-}
 
-std::string LoggingPrefix()
+std::ostream& LoggingPrefix(std::ostream& os)
 {
-    std::stringstream ss;
-    if(miopen::IsEnabled(MIOPEN_ENABLE_LOGGING_MPMT{}))
-    {
-        ss << GetProcessAndThreadId() << ' ';
-    }
-    ss << "MIOpen";
+    static const std::string constant_part = []() {
+        std::string part = "MIOpen";
 #if MIOPEN_BACKEND_OPENCL
-    ss << "(OpenCL)";
+        part += "(OpenCL)";
 #elif MIOPEN_BACKEND_HIP
-    ss << "(HIP)";
+        part += "(HIP)";
 #endif
-    if(miopen::IsEnabled(MIOPEN_ENABLE_LOGGING_ELAPSED_TIME{}))
+        return part;
+    }();
+    static const bool mpmt         = miopen::IsEnabled(MIOPEN_ENABLE_LOGGING_MPMT{});
+    static const bool elapsed_time = miopen::IsEnabled(MIOPEN_ENABLE_LOGGING_ELAPSED_TIME{});
+
+    if(mpmt)
     {
-        ss << std::fixed << std::setprecision(3) << std::setw(8) << GetTimeDiff();
+        os << GetCachedProcessAndThreadId() << ' ';
     }
-    ss << ": ";
+    os << constant_part;
+    if(elapsed_time)
+    {
+        const auto flags     = os.flags();
+        const auto precision = os.precision();
+        os << std::fixed << std::setprecision(3) << std::setw(8) << GetTimeDiff();
+        os.flags(flags);
+        os.precision(precision);
+    }
+    return os << ": ";
+}
+
+std::string LoggingPrefix()
+{
+    std::ostringstream ss;
+    LoggingPrefix(ss);
     return ss.str();
 }
 
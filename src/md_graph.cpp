@@ -959,25 +959,13 @@ bool FusionMDGraph::CmpOpKey(const FusionMDGraph_Edge_Map& edge_val,
     {
         if(kv.first == "constraints")
         {
-            tree_visit v(attr_fun);
+            // The expressions are parsed once per process, see CompiledMDGExpr.
+            std::unordered_map<std::string, int> tabl;
             for(auto& edg_op : kv.second)
             {
-                using It = std::string::const_iterator;
-                It f(edg_op.begin()), l(edg_op.end());
-                MDGExprParser p;
-                boost::spirit::utree e;
-                auto parse_success =
-                    boost::spirit::qi::phrase_parse(f, l, p, boost::spirit::ascii::space, e);
-                if(!parse_success)
-                {
-                    MIOPEN_LOG_I2(
-                        "Remaining unparsed: " << std::string(edg_op.begin(), edg_op.end()));
-                    MIOPEN_THROW(miopenStatusInternalError,
-                                 "Unable to parse graph constraint expression");
-                }
-                visit_res r = boost::spirit::utree::visit(e, v);
-                v.tabl.insert(r.tabl.begin(), r.tabl.end());
-                syms = v.tabl;
+                visit_res r = CompiledMDGExpr::Get(edg_op).Eval(attr_fun, tabl);
+                tabl.insert(r.tabl.begin(), r.tabl.end());
+                syms = tabl;
                 if(r.b_res)
                 {
                     MIOPEN_LOG_I2("Constraint satisfied: " + edg_op);
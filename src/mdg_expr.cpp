@@ -1,5 +1,7 @@
 #include <miopen/mdg_expr.hpp>
 
+#include <mutex>
+
 namespace miopen {
 
 MDGExprParser::MDGExprParser() : MDGExprParser::base_type(expression)
@@ -50,4 +52,268 @@ MDGExprParser::MDGExprParser() : MDGExprParser::base_type(expression)
     BOOST_SPIRIT_DEBUG_NODE(variable);
 }
 
+static MDGraph_op_t GetOp(const std::string& sym)
+{
+    static const std::unordered_map<std::string, MDGraph_op_t> ops = {
+        {"+", OpAdd},
+        {"-", OpSub},
+        {"*", OpMul},
+        {"/", OpDiv},
+        {"%", OpModulo},
+        {">=", OpGTE},
+        {"<=", OpLTE},
+        {"====", OpEqual},
+        {"!=", OpNotEqual},
+        {"^", OpPow},
+        {"&", OpAnd},
+        {"|", OpOr},
+        {"~", OpCeil},
+        {"===", OpAssign},
+        {">>", OpGT},
+        {"<<", OpLT},
+    };
+    const auto it = ops.find(sym);
+    if(it == ops.end())
+        MIOPEN_THROW(miopenStatusInternalError, "Parsing error: Unknown operator: " + sym);
+    return it->second;
+}
+
+// Lowers the parse tree into the nodes of a CompiledMDGExpr, each utree type is handled as
+// tree_visit handles it.
+struct tree_compile
+{
+    using result_type = std::size_t;
+    using Node        = CompiledMDGExpr::Node;
+    using NodeKind    = CompiledMDGExpr::NodeKind;
+
+    std::vector<Node>& nodes;
+
+    std::size_t Constant(int res = 0, bool b_res = false) const
+    {
+        Node n;
+        n.res   = res;
+        n.b_res = b_res;
+        nodes.push_back(n);
+        return nodes.size() - 1;
+    }
+
+    std::size_t operator()(spirit::utree::invalid_type) const { return Constant(); }
+    std::size_t operator()(spirit::utree::nil_type) const { return Constant(); }
+    std::size_t operator()(double d) const { return Constant(static_cast<int>(d)); }
+    std::size_t operator()(int i) const { return Constant(i); }
+    std::size_t operator()(bool b) const { return Constant(0, b); }
+
+    template <typename T>
+    std::size_t operator()(T /*val*/) const
+    {
+        return Constant();
+    }
+
+    std::size_t operator()(spirit::binary_range_type const& /*b*/) const { return Constant(); }
+    std::size_t operator()(spirit::any_ptr const&) const { return Constant(); }
+    std::size_t operator()(spirit::function_base const&) const { return Constant(); }
+
+    std::size_t operator()(spirit::utf8_string_range_type const& str) const
+    {
+        Node n;
+        n.kind = NodeKind::Variable;
+        n.sym  = std::string(str.begin(), str.end());
+        nodes.push_back(n);
+        return nodes.size() - 1;
+    }
+
+    // An operator outside of the operator position has no value.
+    std::size_t operator()(spirit::utf8_symbol_range_type const& str) const
+    {
+        GetOp(std::string(str.begin(), str.end()));
+        return Constant();
+    }
+
+    template <typename Iterator>
+    std::size_t operator()(boost::iterator_range<Iterator> const& range) const
+    {
+        std::vector<spirit::utree> v(range.begin(), range.end());
+        assert(v.size() == 3);
+        auto op = OpAny;
+        if(v[0].which() == spirit::utree_type::symbol_type)
+        {
+            const auto sym = v[0].get<spirit::utf8_symbol_range_type>();
+            op             = GetOp(std::string(sym.begin(), sym.end()));
+        }
+        else
+        {
+            spirit::utree::visit(v[0], *this);
+            nodes.pop_back();
+        }
+        const auto lhs = spirit::utree::visit(v[1], *this);
+        const auto rhs = spirit::utree::visit(v[2], *this);
+
+        const auto is_constant = [&](std::size_t i) { return nodes[i].kind == NodeKind::Constant; };
+        const auto is_foldable = op != OpAssign && op != OpAny && op != OpEval &&
+                                 !((op == OpDiv || op == OpModulo || op == OpCeil) &&
+                                   nodes[rhs].res == 0);
+        if(is_constant(lhs) && is_constant(rhs) && is_foldable)
+        {
+            const auto value = CompiledMDGExpr::Apply(
+                op, {nodes[lhs].res, nodes[lhs].b_res}, {nodes[rhs].res, nodes[rhs].b_res});
+            nodes.resize(lhs);
+            return Constant(value.res, value.b_res);
+        }
+
+        Node n;
+        n.kind = NodeKind::Binary;
+        n.op   = op;
+        n.lhs  = lhs;
+        n.rhs  = rhs;
+        nodes.push_back(n);
+        return nodes.size() - 1;
+    }
+};
+
+CompiledMDGExpr::CompiledMDGExpr(const std::string& expr)
+{
+    Iterator f(expr.begin()), l(expr.end());
+    MDGExprParser p;
+    spirit::utree e;
+    if(!qi::phrase_parse(f, l, p, ascii::space, e))
+    {
+        MIOPEN_LOG_I2("Remaining unparsed: " << expr);
+        MIOPEN_THROW(miopenStatusInternalError, "Unable to parse graph constraint expression");
+    }
+    spirit::utree::visit(e, tree_compile{nodes});
+}
+
+const CompiledMDGExpr& CompiledMDGExpr::Get(const std::string& expr)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, CompiledMDGExpr> compiled;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = compiled.find(expr);
+    if(it == compiled.end())
+        it = compiled.emplace(expr, CompiledMDGExpr{expr}).first;
+    return it->second;
+}
+
+CompiledMDGExpr::Value
+CompiledMDGExpr::Apply(MDGraph_op_t op, const Value& lhs_res, const Value& rhs_res)
+{
+    if(lhs_res.sym != nullptr)
+        MIOPEN_THROW("Invalid variable access: " + *lhs_res.sym);
+
+    Value r;
+    switch(op)
+    {
+    // Arith ops
+    case OpAdd: r.res    = lhs_res.res + rhs_res.res; break;
+    case OpSub: r.res    = lhs_res.res - rhs_res.res; break;
+    case OpMul: r.res    = lhs_res.res * rhs_res.res; break;
+    case OpDiv: r.res    = lhs_res.res / rhs_res.res; break;
+    case OpModulo: r.res = lhs_res.res % rhs_res.res; break;
+    case OpPow: r.res    = static_cast<int>(std::pow(lhs_res.res, rhs_res.res)); break;
+    case OpCeil:
+    {
+        int vv = lhs_res.res;
+        int mm = rhs_res.res;
+        r.res  = (vv % mm != 0) ? (vv / mm + 1) * mm : vv;
+        break;
+    }
+    // Logical ops
+    case OpEqual:
+        r.b_res = lhs_res.res == rhs_res.res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpNotEqual:
+        r.b_res = lhs_res.res != rhs_res.res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpGTE:
+        r.b_res = lhs_res.res >= rhs_res.res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpLTE:
+        r.b_res = lhs_res.res <= rhs_res.res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpGT:
+        r.b_res = lhs_res.res > rhs_res.res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpLT:
+        r.b_res = lhs_res.res < rhs_res.res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpAnd:
+        r.b_res = lhs_res.b_res && rhs_res.b_res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpOr:
+        r.b_res = lhs_res.b_res || rhs_res.b_res;
+        r.res   = static_cast<int>(r.b_res);
+        break;
+    case OpAssign:
+    case OpAny:
+    case OpEval: MIOPEN_THROW("Unsupported op");
+    }
+    return r;
+}
+
+visit_res CompiledMDGExpr::Eval(const std::function<bool(const std::string&, int&)>& var_lookup,
+                                const std::unordered_map<std::string, int>& tabl) const
+{
+    std::vector<Value> values(nodes.size());
+    visit_res result;
+    for(std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        const auto& n = nodes[i];
+        auto& value   = values[i];
+        switch(n.kind)
+        {
+        case NodeKind::Constant:
+            value.res   = n.res;
+            value.b_res = n.b_res;
+            break;
+        case NodeKind::Variable:
+        {
+            int v = 0;
+            if(var_lookup(n.sym, v))
+            {
+                value.res = v;
+            }
+            else
+            {
+                const auto it = tabl.find(n.sym);
+                if(it != tabl.end())
+                    value.res = it->second;
+                else
+                    value.sym = &n.sym;
+            }
+            break;
+        }
+        case NodeKind::Binary:
+            if(n.op != OpAssign)
+            {
+                value = Apply(n.op, values[n.lhs], values[n.rhs]);
+                break;
+            }
+            {
+                static const std::string no_sym;
+                const auto& sym = values[n.lhs].sym != nullptr ? *values[n.lhs].sym : no_sym;
+                int val         = 0;
+                if(var_lookup(sym, val))
+                    MIOPEN_THROW("Invalid variable assignment: " + sym);
+                MIOPEN_LOG_I2(" Adding variable: " + sym);
+                // Only the assignment at the root of the expression reaches the table.
+                if(i + 1 == nodes.size())
+                    result.tabl[sym] = values[n.rhs].res;
+                value.b_res = true;
+            }
+            break;
+        }
+    }
+    result.res   = values.back().res;
+    result.b_res = values.back().b_res;
+    return result;
+}
+
 } // namespace miopen
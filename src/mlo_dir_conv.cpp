@@ -126,7 +126,9 @@ static auto GetDirectSolvers()
                                            miopen::solver::ConvOclDirectFwdGen,
                                            miopen::solver::ConvOclDirectFwd3x3,
                                            miopen::solver::ConvOclDirectFwd1x1,
-                                           miopen::solver::ConvOclDirectFwd>{};
+                                           miopen::solver::ConvOclDirectFwd,
+                                           miopen::solver::ConvOclDirectFwd1x1Dynamic,
+                                           miopen::solver::ConvOclDirectFwdDynamic>{};
 }
 
 static auto GetImplicitGemmSolvers()
@@ -35,6 +35,7 @@
 #include <miopen/find_db.hpp>
 #include <miopen/finddb_kernel_cache_key.hpp>
 #include <miopen/find_controls.hpp>
+#include <miopen/find_solution.hpp>
 #include <miopen/float_equal.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel.hpp>
@@ -54,7 +55,9 @@
 #include <miopen/gemm_v2.hpp>
 #endif
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
 #include <type_traits>
 
 #include <boost/range/adaptors.hpp>
@@ -69,6 +72,8 @@ MIOPEN_DECLARE_ENV_VAR(MIOPEN_CONV_PRECISE_ROCBLAS_TIMING)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_FFT)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEVICE_ARCH)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_IMMED_FALLBACK)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_IMMED_ASYNC_COMPILE)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_GEMM_IMAGES_PER_LAUNCH)
 
 #if MIOPEN_USE_GEMM
 #ifdef CPPCHECK
@@ -140,6 +145,40 @@ static inline void AddKernels(const Handle& handle,
     }
 }
 
+#if MIOPEN_USE_GEMM
+/// Number of images of the minibatch which the GEMM convolutions transform and multiply per
+/// launch, as many as the workspace holds. MIOPEN_DEBUG_CONV_GEMM_IMAGES_PER_LAUNCH lowers the
+/// limit, 1 restores the image by image processing.
+static std::size_t GetGemmImagesPerLaunch(std::size_t in_n,
+                                          std::size_t workspace_per_image,
+                                          std::size_t workspace_size)
+{
+    if(workspace_per_image == 0)
+        return 1;
+
+    // Offsets within the workspace are int in the kernels.
+    auto images = std::min(workspace_size, static_cast<std::size_t>(INT_MAX)) / workspace_per_image;
+    const auto limit = miopen::Value(MIOPEN_DEBUG_CONV_GEMM_IMAGES_PER_LAUNCH{});
+    if(limit != 0)
+        images = std::min<std::size_t>(images, limit);
+    return std::max<std::size_t>(1, std::min(images, in_n));
+}
+
+/// Turns the GEMM of one image into the strided batched GEMM of several images, which share
+/// the matrix A (the weights) while their matrices B and C follow each other.
+static GemmDescriptor BatchGemmOverImages(GemmDescriptor gemm_desc,
+                                          std::size_t images,
+                                          std::size_t b_stride,
+                                          std::size_t c_stride)
+{
+    gemm_desc.batch_count = static_cast<int>(images);
+    gemm_desc.strideA     = 0;
+    gemm_desc.strideB     = static_cast<long long int>(b_stride);
+    gemm_desc.strideC     = static_cast<long long int>(c_stride);
+    return gemm_desc;
+}
+#endif
+
 static inline void ValidateGroupCount(const TensorDescriptor& xDesc,
                                       const TensorDescriptor& wDesc,
                                       const ConvolutionDescriptor& conv)
@@ -255,6 +294,57 @@ ConvolutionDescriptor::FindDataImplicitGemmSolutions(Handle& handle,
     }
 }
 
+static Invoker PrepareInvoker(Handle& handle,
+                              ConvolutionContext& ctx,
+                              const NetworkConfig& config,
+                              solver::Id solver_id,
+                              conv::Direction dir)
+{
+    ctx.DetectRocm();
+    ctx.SetupFloats();
+
+    const auto solver = solver_id.GetSolver();
+    auto db           = GetDb(ctx);
+    auto solution     = solver.FindSolution(ctx, db, {}); // auto tune is not expected here
+    const auto invoker =
+        handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
+
+    handle.RegisterInvoker(invoker, config, solver_id, AlgorithmName(solver_id.GetAlgo(dir)));
+    return invoker;
+}
+
+/// Rebuilds the invoker of a solution which a find-db record refers to, so a find-db hit does
+/// not repeat the Find. The kernels are expected to come from the kernel cache.
+static bool RebuildFindDbInvoker(Handle& handle,
+                                 const ProblemDescription& problem,
+                                 const std::string& solver_name,
+                                 conv::Direction dir,
+                                 const std::function<bool()>& fft_finder)
+{
+    const auto solver_id = solver::Id{solver_name};
+    if(!solver_id.IsValid())
+        return false;
+
+    // Todo: remove when all finds will use invokers.
+    // MIOpenGEMM kernels are built on the first launch of the GEMM, so only FFT is built here.
+    if(solver_id == solver::Id::gemm())
+        return true;
+    if(solver_id == solver::Id::fft())
+        return fft_finder && fft_finder();
+
+    auto ctx = ConvolutionContext{problem};
+    ctx.SetStream(&handle);
+    ctx.DetectRocm();
+    ctx.disable_search_enforce = true;
+
+    const auto solver = solver_id.GetSolver();
+    if(solver.IsEmpty() || !solver.IsApplicable(ctx))
+        return false;
+
+    PrepareInvoker(handle, ctx, ctx.BuildConfKey(), solver_id, dir);
+    return true;
+}
+
 template <class InvokeParams>
 static void EvaluateInvokers(Handle& handle,
                              const std::vector<solver::ConvSolution>& solutions,
@@ -809,7 +899,22 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
         ctx.skip_solutions_that_take_long_time_to_build_and_have_narrow_coverage =
             miopen::FindMode(ctx).IsFastHybrid();
         ctx.use_dynamic_solutions_only = miopen::FindMode(ctx).IsDynamicHybrid();
-        perf_db = UserFindDbRecord::TryLoad(handle, problem, [&](DbRecord& record) {
+        const auto rebuild = [&](const std::string& solver_id) {
+            return RebuildFindDbInvoker(
+                handle, problem, solver_id, conv::Direction::Forward, [&]() {
+                    const auto workspace_fft = ForwardGetWorkSpaceSizeFFT(wDesc, xDesc, yDesc);
+                    std::vector<KernelInvoke> ignore0;
+                    const auto network_config = problem.BuildConfKey();
+                    return FindFwdFFTKernel(handle,
+                                            xDesc,
+                                            wDesc,
+                                            yDesc,
+                                            workspace_fft,
+                                            ignore0,
+                                            network_config) == 0;
+                });
+        };
+        perf_db = UserFindDbRecord::TryLoad(handle, problem, rebuild, [&](DbRecord& record) {
             DirConvFindCore(handle,
                             xDesc,
                             x,
@@ -1189,8 +1294,15 @@ void ConvolutionDescriptor::ConvFwdGemm(Handle& handle,
                                                               std::size_t(1),
                                                               std::multiplies<std::size_t>());
 
-                for(std::size_t i = 0; i < in_n; i++)
+                const auto images = GetGemmImagesPerLaunch(
+                    in_n,
+                    in_c * in_spatial_size * GetTypeSize(tensors.xDesc.GetType()),
+                    workSpaceSize);
+
+                for(std::size_t i = 0; i < in_n; i += images)
                 {
+                    const auto count = std::min(images, in_n - i);
+
                     std::size_t out_offset = i * wei_k * out_spatial_size;
 
                     std::size_t in_offset = i * in_c * in_spatial_size;
@@ -1202,20 +1314,24 @@ void ConvolutionDescriptor::ConvFwdGemm(Handle& handle,
                                            0,
                                            tensors.x,
                                            workSpace,
-                                           tensors.xDesc.GetType());
+                                           tensors.xDesc.GetType(),
+                                           static_cast<int>(count));
                     if(handle.IsProfilingEnabled())
                         t1 += handle.GetKernelTime();
 
-                    CallGemm(handle,
-                             gemm_desc,
-                             tensors.w,
-                             0,
-                             workSpace,
-                             0,
-                             tensors.y,
-                             out_offset,
-                             nullptr,
-                             false);
+                    CallGemmStridedBatched(handle,
+                                           BatchGemmOverImages(gemm_desc,
+                                                               count,
+                                                               in_c * in_spatial_size,
+                                                               wei_k * out_spatial_size),
+                                           tensors.w,
+                                           0,
+                                           workSpace,
+                                           0,
+                                           tensors.y,
+                                           out_offset,
+                                           nullptr,
+                                           false);
                     if(handle.IsProfilingEnabled())
                         time_0 += handle.GetKernelTime();
                 }
@@ -1274,10 +1390,23 @@ void ConvolutionDescriptor::ConvFwdGemm(Handle& handle,
         std::size_t in_spatial_size = std::accumulate(
             in_spatial.begin(), in_spatial.end(), std::size_t(1), std::multiplies<std::size_t>());
 
+        std::size_t wei_spatial_size = std::accumulate(
+            wei_spatial.begin(), wei_spatial.end(), std::size_t(1), std::multiplies<std::size_t>());
+
+        // Columns of one image, int8 also keeps them transposed after the columns of the launch.
+        const auto col_size = in_c * wei_spatial_size * out_spatial_size;
+        const auto images =
+            GetSpatialDimension() == 2
+                ? GetGemmImagesPerLaunch(in_n,
+                                         ForwardGetWorkSpaceSizeGEMM(tensors.wDesc, tensors.yDesc),
+                                         workSpaceSize)
+                : std::size_t{1};
+
         float time_0 = 0;
-        float t1     = 0;
-        for(std::size_t i = 0; i < in_n; i++)
+        for(std::size_t i = 0; i < in_n; i += images)
         {
+            const auto count = std::min(images, in_n - i);
+
             std::size_t out_offset = i * wei_k * out_spatial_size;
 
             std::size_t in_offset = i * in_c * in_spatial_size;
@@ -1294,20 +1423,16 @@ void ConvolutionDescriptor::ConvFwdGemm(Handle& handle,
                       GetConvStrides(),
                       GetConvDilations(),
                       workSpace,
-                      tensors.xDesc.GetType());
+                      tensors.xDesc.GetType(),
+                      count);
 
             if(handle.IsProfilingEnabled())
-                t1 = handle.GetKernelTime();
+                time_0 += handle.GetKernelTime();
 
             std::size_t wksp_offset = 0;
             if(tensors.wDesc.GetType() == miopenInt8)
             {
-                std::size_t wei_spatial_size = std::accumulate(wei_spatial.begin(),
-                                                               wei_spatial.end(),
-                                                               std::size_t(1),
-                                                               std::multiplies<std::size_t>());
-
-                wksp_offset = in_c * wei_spatial_size * out_spatial_size;
+                wksp_offset = count * col_size;
 
                 transpose_packed_MN2NM(handle,
                                        static_cast<int>(in_c * wei_spatial_size),
@@ -1316,56 +1441,62 @@ void ConvolutionDescriptor::ConvFwdGemm(Handle& handle,
                                        wksp_offset,
                                        workSpace,
                                        workSpace,
-                                       tensors.xDesc.GetType());
+                                       tensors.xDesc.GetType(),
+                                       static_cast<int>(count));
 
                 if(handle.IsProfilingEnabled())
-                    t1 += handle.GetKernelTime();
+                    time_0 += handle.GetKernelTime();
             }
 
             // tensors.y = tensors.w * Im2Col(tensors.x)
             if(group_count > 1)
-                CallGemmStridedBatched(handle,
-                                       gemm_desc,
-                                       tensors.w,
-                                       0,
-                                       workSpace,
-                                       0,
-                                       tensors.y,
-                                       out_offset,
-                                       nullptr,
-                                       false);
-            else
-                CallGemm(handle,
-                         gemm_desc,
-                         tensors.w,
-                         0,
-                         workSpace,
-                         wksp_offset,
-                         tensors.y,
-                         out_offset,
-                         nullptr,
-                         false,
-                         (tensors.wDesc.GetType() == miopenInt8 ||
-                          tensors.wDesc.GetType() == miopenInt8x4)
-                             ? GemmBackend_t::rocblas
-                             : GemmBackend_t::miopengemm);
-
-            // Update times for both the kernels
-            if(handle.IsProfilingEnabled())
             {
-                if(i == in_n - 1)
+                // The groups are already batched, so the images are multiplied one by one.
+                for(std::size_t j = 0; j < count; ++j)
                 {
-                    handle.AccumKernelTime(t1 + time_0);
-                    time_0 = handle.GetKernelTime();
+                    CallGemmStridedBatched(handle,
+                                           gemm_desc,
+                                           tensors.w,
+                                           0,
+                                           workSpace,
+                                           j * col_size,
+                                           tensors.y,
+                                           out_offset + j * wei_k * out_spatial_size,
+                                           nullptr,
+                                           false);
+                    if(handle.IsProfilingEnabled())
+                        time_0 += handle.GetKernelTime();
                 }
-                else
-                {
-                    handle.AccumKernelTime(t1);
+            }
+            else
+            {
+                CallGemmStridedBatched(
+                    handle,
+                    BatchGemmOverImages(gemm_desc, count, col_size, wei_k * out_spatial_size),
+                    tensors.w,
+                    0,
+                    workSpace,
+                    wksp_offset,
+                    tensors.y,
+                    out_offset,
+                    nullptr,
+                    false,
+                    (tensors.wDesc.GetType() == miopenInt8 ||
+                     tensors.wDesc.GetType() == miopenInt8x4)
+                        ? GemmBackend_t::rocblas
+                        : GemmBackend_t::miopengemm);
+                if(handle.IsProfilingEnabled())
                     time_0 += handle.GetKernelTime();
-                }
             }
         }
 
+        // Report the time of all the kernels.
+        if(handle.IsProfilingEnabled())
+        {
+            handle.ResetKernelTime();
+            handle.AccumKernelTime(time_0);
+        }
+
         if((tensors.wDesc.GetType() == miopenInt8 || tensors.wDesc.GetType() == miopenInt8x4) &&
            tensors.yDesc.GetType() != miopenInt32)
         {
@@ -1631,6 +1762,11 @@ void GetSolutions(Handle& handle,
     ctx.SetStream(&handle);
     ctx.DetectRocm();
 
+    // Entries which need IsApplicable(), with the index of their check.
+    std::vector<std::pair<SortWrapper, std::size_t>> pending;
+    std::vector<solver::ApplicabilityCheck> checks;
+    std::string set_id;
+
     for(const auto& pair : fdb_record)
     {
         const auto algo = static_cast<miopenConvAlgorithm_t>(algoResolver(pair.first));
@@ -1646,14 +1782,28 @@ void GetSolutions(Handle& handle,
             MIOPEN_LOG_I("[Warning] incorrect solver_id: " << pair.second.solver_id);
             continue;
         }
+        const auto entry =
+            SortWrapper{pair.second.time, pair.second.workspace, solver_id.Value(), algo};
         // gemm and fft are always applicable.
         // These can be disabled/enabled at algorithm level.
-        if(!(solver_id == solver::Id::gemm() || solver_id == solver::Id::fft()))
-            if(!solver_id.GetSolver().IsApplicable(ctx))
-                continue;
-
-        interim.emplace_back(pair.second.time, pair.second.workspace, solver_id.Value(), algo);
+        if(solver_id == solver::Id::gemm() || solver_id == solver::Id::fft())
+        {
+            interim.push_back(entry);
+            continue;
+        }
+        const auto solver = solver_id.GetSolver();
+        pending.emplace_back(entry, checks.size());
+        checks.emplace_back(
+            [solver](const ConvolutionContext& c) { return solver.IsApplicable(c); });
+        set_id += pair.second.solver_id + ';';
     }
+
+    // The find-db record of a problem lists the same solvers on every query,
+    // so their applicability is evaluated once per process.
+    const auto applicable = solver::Applicability{set_id, ctx, checks};
+    for(const auto& entry : pending)
+        if(applicable[entry.second])
+            interim.push_back(entry.first);
     std::sort(begin(interim), end(interim));
 
     auto i = std::size_t{0};
@@ -1899,25 +2049,6 @@ static std::vector<KernelInvoke> CompileSolver(const Handle& handle,
     return kernels;
 }
 
-static Invoker PrepareInvoker(Handle& handle,
-                              ConvolutionContext& ctx,
-                              const NetworkConfig& config,
-                              solver::Id solver_id,
-                              conv::Direction dir)
-{
-    ctx.DetectRocm();
-    ctx.SetupFloats();
-
-    const auto solver = solver_id.GetSolver();
-    auto db           = GetDb(ctx);
-    auto solution     = solver.FindSolution(ctx, db, {}); // auto tune is not expected here
-    const auto invoker =
-        handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
-
-    handle.RegisterInvoker(invoker, config, solver_id, AlgorithmName(solver_id.GetAlgo(dir)));
-    return invoker;
-}
-
 static Invoker LoadOrPrepareInvoker(Handle& handle,
                                     ConvolutionContext& ctx,
                                     solver::Id solver_id,
@@ -1930,6 +2061,96 @@ static Invoker LoadOrPrepareInvoker(Handle& handle,
     return PrepareInvoker(handle, ctx, config, solver_id, dir);
 }
 
+static void EnqueuePrepareInvoker(Handle& handle,
+                                  const ConvolutionContext& ctx,
+                                  const NetworkConfig& config,
+                                  solver::Id solver_id,
+                                  conv::Direction dir)
+{
+    const auto key = CompileQueue::Key{config.ToString(), solver_id.ToString()};
+    handle.GetCompileQueue().Enqueue(
+        key, [&handle, job_ctx = ctx, config, solver_id, dir]() mutable {
+            PrepareInvoker(handle, job_ctx, config, solver_id, dir);
+        });
+}
+
+/// Non-blocking counterpart of LoadOrPrepareInvoker() for the immediate mode.
+/// If MIOPEN_IMMED_ASYNC_COMPILE is enabled and the invoker is not ready yet, it is queued
+/// for compilation in background, and the call is served by an already built fallback:
+/// the fastest find-db solution of the same problem which has a registered invoker and fits
+/// into the workspace, or GEMM (if provided by the caller). Only rocBLAS GEMM qualifies as
+/// it does not need to build kernels at run time. Once the background job
+/// registers the preferred invoker, subsequent calls pick it up from the invoker cache.
+/// The call blocks as before if there is no suitable fallback.
+static Invoker
+LoadOrPrepareInvokerAsync(Handle& handle,
+                          ConvolutionContext& ctx,
+                          solver::Id solver_id,
+                          conv::Direction dir,
+                          std::size_t workspace_size,
+                          const std::function<boost::optional<Invoker>()>& gemm_fallback)
+{
+    const auto config = ctx.BuildConfKey();
+    auto invoker      = handle.GetInvoker(config, solver_id);
+    if(invoker)
+        return *invoker;
+
+    auto& queue    = handle.GetCompileQueue();
+    const auto key = CompileQueue::Key{config.ToString(), solver_id.ToString()};
+
+    // Failed background build is repeated in the foreground to report the error.
+    if(!miopen::IsEnabled(MIOPEN_IMMED_ASYNC_COMPILE{}) || queue.HasFailed(key))
+        return PrepareInvoker(handle, ctx, config, solver_id, dir);
+
+    EnqueuePrepareInvoker(handle, ctx, config, solver_id, dir);
+
+    {
+        auto best_time = std::numeric_limits<float>::max();
+        boost::optional<Invoker> fallback;
+        auto fallback_id = solver::Id{};
+        const FindDbRecord fdb_record{handle, ctx};
+
+        for(const auto& pair : fdb_record)
+        {
+            const auto id = solver::Id{pair.second.solver_id};
+            if(!id.IsValid() || id == solver_id || pair.second.workspace > workspace_size ||
+               pair.second.time >= best_time)
+                continue;
+            const auto cached = handle.GetInvoker(config, id);
+            if(!cached)
+                continue;
+            best_time   = pair.second.time;
+            fallback    = *cached;
+            fallback_id = id;
+        }
+
+        if(fallback)
+        {
+            MIOPEN_LOG_I("Solver " << solver_id.ToString() << " is being built, using "
+                                   << fallback_id.ToString());
+            return *fallback;
+        }
+    }
+
+    if(gemm_fallback)
+    {
+        const auto gemm = gemm_fallback();
+        if(gemm)
+        {
+            MIOPEN_LOG_I("Solver " << solver_id.ToString() << " is being built, using GEMM");
+            return *gemm;
+        }
+    }
+
+    MIOPEN_LOG_I("Solver " << solver_id.ToString()
+                           << " is being built, no fallback available, waiting.");
+    queue.Wait(key);
+    invoker = handle.GetInvoker(config, solver_id);
+    if(invoker)
+        return *invoker;
+    return PrepareInvoker(handle, ctx, config, solver_id, dir);
+}
+
 static bool CheckInvokerSupport(const solver::Id solver_id, conv::Direction dir)
 {
     const auto& algo = solver_id.GetAlgo(dir);
@@ -1947,6 +2168,14 @@ static void CompileSolution(Handle& handle,
 
     if(CheckInvokerSupport(solver_id, dir))
     {
+        if(miopen::IsEnabled(MIOPEN_IMMED_ASYNC_COMPILE{}))
+        {
+            // Do not block, the build is finished in background.
+            const auto config = ctx.BuildConfKey();
+            if(!handle.GetInvoker(config, solver_id))
+                EnqueuePrepareInvoker(handle, ctx, config, solver_id, dir);
+            return;
+        }
         LoadOrPrepareInvoker(handle, ctx, solver_id, dir);
         return;
     }
@@ -1984,6 +2213,110 @@ static void CompileSolution(Handle& handle,
     MIOPEN_THROW(miopenStatusNotImplemented);
 }
 
+void PrefetchConvDbRecords(Handle& handle, const std::vector<ProblemDescription>& problems)
+{
+    if(problems.empty())
+        return;
+
+    auto ctxs = std::vector<ConvolutionContext>{};
+    ctxs.reserve(problems.size());
+
+    for(const auto& problem : problems)
+    {
+        ctxs.emplace_back(problem);
+        ctxs.back().SetStream(&handle);
+        ctxs.back().DetectRocm();
+        ctxs.back().SetupFloats();
+    }
+
+    FindDbRecord::Prefetch(handle, ctxs);
+    // All of the contexts share the handle, so they also share the perf-db.
+    GetDb(ctxs.front()).Prefetch(ctxs);
+}
+
+std::size_t PrecompileConvolutions(Handle& handle, const std::vector<ProblemDescription>& problems)
+{
+    PrefetchConvDbRecords(handle, problems);
+
+    struct PendingInvoker
+    {
+        NetworkConfig config;
+        solver::Id solver_id;
+        conv::Direction dir;
+    };
+
+    std::vector<PendingInvoker> pending;
+    std::vector<solver::ConvSolution> solutions;
+
+    for(const auto& problem : problems)
+    {
+        auto dir = conv::Direction::BackwardWeights;
+        if(problem.direction.IsForward())
+            dir = conv::Direction::Forward;
+        else if(problem.direction.IsBackwardData())
+            dir = conv::Direction::BackwardData;
+
+        auto ctx = ConvolutionContext{problem};
+        ctx.SetStream(&handle);
+        ctx.DetectRocm();
+        ctx.SetupFloats();
+        ctx.disable_search_enforce = true;
+
+        const auto config = ctx.BuildConfKey();
+        const FindDbRecord fdb_record{handle, ctx};
+
+        if(fdb_record.empty())
+        {
+            MIOPEN_LOG_W("No find-db record, skipping: " << config.ToString());
+            continue;
+        }
+
+        auto db = GetDb(ctx);
+
+        for(const auto& pair : fdb_record)
+        {
+            const auto solver_id = solver::Id{pair.second.solver_id};
+            if(!solver_id.IsValid() || !CheckInvokerSupport(solver_id, dir))
+                continue;
+            if(handle.GetInvoker(config, solver_id))
+                continue;
+            const auto is_pending = [&](const PendingInvoker& item) {
+                return item.solver_id == solver_id && item.config.ToString() == config.ToString();
+            };
+            if(std::any_of(pending.begin(), pending.end(), is_pending))
+                continue;
+
+            const auto solver = solver_id.GetSolver();
+            if(!solver.IsApplicable(ctx))
+                continue;
+
+            auto solution = solver.FindSolution(ctx, db, {}); // auto tune is not expected here
+            if(!solution.Succeeded() || !solution.invoker_factory)
+                continue;
+
+            pending.push_back({config, solver_id, dir});
+            solutions.push_back(std::move(solution));
+        }
+    }
+
+    MIOPEN_LOG_I("Precompiling " << solutions.size() << " solutions of " << problems.size()
+                                 << " problems");
+    PrecompileSolutions(handle, solutions);
+
+    // Programs are in the kernel cache already, so this does not compile.
+    for(std::size_t i = 0; i < pending.size(); ++i)
+    {
+        const auto& item     = pending[i];
+        const auto& solution = solutions[i];
+        const auto invoker =
+            handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
+        handle.RegisterInvoker(
+            invoker, item.config, item.solver_id, AlgorithmName(item.solver_id.GetAlgo(item.dir)));
+    }
+
+    return pending.size();
+}
+
 void ConvolutionDescriptor::CompileForwardSolution(Handle& handle,
                                                    const TensorDescriptor& wDesc,
                                                    const TensorDescriptor& xDesc,
@@ -2028,8 +2361,16 @@ void ConvolutionDescriptor::ConvolutionForwardImmediate(Handle& handle,
 
         if(CheckInvokerSupport(solver_id, conv::Direction::Forward))
         {
-            const auto invoker =
-                LoadOrPrepareInvoker(handle, ctx, solver_id, conv::Direction::Forward);
+            const auto gemm_fallback = [&]() -> boost::optional<Invoker> {
+                if(!MIOPEN_USE_ROCBLAS || !IsGemmApplicableFwd(wDesc, xDesc, yDesc) ||
+                   ForwardGetValidWorkSpaceSizeGemm(handle, wDesc, xDesc, yDesc) > workSpaceSize)
+                    return boost::none;
+                return Invoker{[&](const Handle&, const AnyInvokeParams&) {
+                    ConvFwdGemm(handle, tensors, workSpace, workSpaceSize);
+                }};
+            };
+            const auto invoker    = LoadOrPrepareInvokerAsync(
+                handle, ctx, solver_id, conv::Direction::Forward, workSpaceSize, gemm_fallback);
             const auto invoke_ctx = conv::DataInvokeParams{tensors, workSpace, workSpaceSize};
             invoker(handle, invoke_ctx);
             return;
@@ -2154,7 +2495,22 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
     }
     else
     {
-        perf_db = UserFindDbRecord::TryLoad(handle, problem, [&](DbRecord& record) {
+        const auto rebuild = [&](const std::string& solver_id) {
+            return RebuildFindDbInvoker(
+                handle, problem, solver_id, conv::Direction::BackwardData, [&]() {
+                    const auto workspace_fft = BackwardGetWorkSpaceSizeFFT(wDesc, dyDesc, dxDesc);
+                    std::vector<KernelInvoke> ignore0;
+                    const auto network_config = problem.BuildConfKey();
+                    return FindBwdFFTKernel(handle,
+                                            dyDesc,
+                                            wDesc,
+                                            dxDesc,
+                                            workspace_fft,
+                                            ignore0,
+                                            network_config) == 0;
+                });
+        };
+        perf_db = UserFindDbRecord::TryLoad(handle, problem, rebuild, [&](DbRecord& record) {
             const auto network_config = problem.BuildConfKey();
             const auto invoke_ctx     = conv::DataInvokeParams{
                 {dyDesc, dy, wDesc, w, dxDesc, dx}, workSpace, workSpaceSize};
@@ -2780,40 +3136,63 @@ void ConvolutionDescriptor::ConvBwdGemm(Handle& handle,
         std::size_t in_spatial_size = std::accumulate(
             in_spatial.begin(), in_spatial.end(), std::size_t(1), std::multiplies<std::size_t>());
 
+        std::size_t wei_spatial_size = std::accumulate(
+            wei_spatial.begin(), wei_spatial.end(), std::size_t(1), std::multiplies<std::size_t>());
+
+        const auto col_size = in_c * wei_spatial_size * out_spatial_size;
+        const auto images =
+            GetSpatialDimension() == 2
+                ? GetGemmImagesPerLaunch(
+                      in_n,
+                      BackwardDataGetWorkSpaceSizeGEMM(tensors.wDesc, tensors.dyDesc),
+                      workSpaceSize)
+                : std::size_t{1};
+
         float time_0 = 0;
-        float t1     = 0;
-        for(std::size_t i = 0; i < in_n; i++)
+        for(std::size_t i = 0; i < in_n; i += images)
         {
+            const auto count = std::min(images, in_n - i);
+
             std::size_t out_offset = i * wei_k * out_spatial_size;
             std::size_t in_offset  = i * in_c * in_spatial_size;
 
             // tensors.dx = transpose(tensors.w) * tensors.dy
             if(group_count > 1)
-                CallGemmStridedBatched(handle,
-                                       gemm_desc,
-                                       tensors.w,
-                                       0,
-                                       tensors.dy,
-                                       out_offset,
-                                       workSpace,
-                                       0,
-                                       nullptr,
-                                       false);
+            {
+                // The groups are already batched, so the images are multiplied one by one.
+                for(std::size_t j = 0; j < count; ++j)
+                {
+                    CallGemmStridedBatched(handle,
+                                           gemm_desc,
+                                           tensors.w,
+                                           0,
+                                           tensors.dy,
+                                           out_offset + j * wei_k * out_spatial_size,
+                                           workSpace,
+                                           j * col_size,
+                                           nullptr,
+                                           false);
+                    if(handle.IsProfilingEnabled())
+                        time_0 += handle.GetKernelTime();
+                }
+            }
             else
-                CallGemm(handle,
-                         gemm_desc,
-                         tensors.w,
-                         0,
-                         tensors.dy,
-                         out_offset,
-                         workSpace,
-                         0,
-                         nullptr,
-                         false,
-                         GemmBackend_t::miopengemm);
-
-            if(handle.IsProfilingEnabled())
-                t1 = handle.GetKernelTime();
+            {
+                CallGemmStridedBatched(
+                    handle,
+                    BatchGemmOverImages(gemm_desc, count, wei_k * out_spatial_size, col_size),
+                    tensors.w,
+                    0,
+                    tensors.dy,
+                    out_offset,
+                    workSpace,
+                    0,
+                    nullptr,
+                    false,
+                    GemmBackend_t::miopengemm);
+                if(handle.IsProfilingEnabled())
+                    time_0 += handle.GetKernelTime();
+            }
 
             Col2ImGPU(handle,
                       GetSpatialDimension(),
@@ -2827,17 +3206,17 @@ void ConvolutionDescriptor::ConvBwdGemm(Handle& handle,
                       in_spatial,
                       tensors.dx,
                       in_offset,
-                      tensors.dyDesc.GetType());
-
-            // Update times for both the kernels
+                      tensors.dyDesc.GetType(),
+                      count);
             if(handle.IsProfilingEnabled())
-            {
-                if(i == in_n - 1)
-                    handle.AccumKernelTime(t1 + time_0);
-                else
-                    handle.AccumKernelTime(t1);
                 time_0 += handle.GetKernelTime();
-            }
+        }
+
+        // Report the time of all the kernels.
+        if(handle.IsProfilingEnabled())
+        {
+            handle.ResetKernelTime();
+            handle.AccumKernelTime(time_0);
         }
     }
 #ifdef NDEBUG
@@ -3007,8 +3386,21 @@ void ConvolutionDescriptor::ConvolutionBackwardImmediate(Handle& handle,
 
         if(CheckInvokerSupport(solver_id, conv::Direction::BackwardData))
         {
-            const auto invoker =
-                LoadOrPrepareInvoker(handle, ctx, solver_id, conv::Direction::BackwardData);
+            ctx.SetStream(&handle);
+            const auto gemm_fallback = [&]() -> boost::optional<Invoker> {
+                if(!MIOPEN_USE_ROCBLAS || !IsGemmApplicableBwd(dyDesc, wDesc, dxDesc) ||
+                   BackwardGetValidWorkSpaceSizeGemm(dyDesc, wDesc, dxDesc) > workSpaceSize)
+                    return boost::none;
+                return Invoker{[&](const Handle&, const AnyInvokeParams&) {
+                    ConvBwdGemm(handle, tensors, workSpace, workSpaceSize);
+                }};
+            };
+            const auto invoker    = LoadOrPrepareInvokerAsync(handle,
+                                                           ctx,
+                                                           solver_id,
+                                                           conv::Direction::BackwardData,
+                                                           workSpaceSize,
+                                                           gemm_fallback);
             const auto invoke_ctx = conv::DataInvokeParams{tensors, workSpace, workSpaceSize};
             invoker(handle, invoke_ctx);
             return;
@@ -3125,7 +3517,11 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
     }
     else
     {
-        perf_db = UserFindDbRecord::TryLoad(handle, problem, [&](DbRecord& record) {
+        const auto rebuild = [&](const std::string& solver_id) {
+            return RebuildFindDbInvoker(
+                handle, problem, solver_id, conv::Direction::BackwardWeights, nullptr);
+        };
+        perf_db = UserFindDbRecord::TryLoad(handle, problem, rebuild, [&](DbRecord& record) {
 #if MIOPEN_USE_GEMM
             if(!miopen::IsDisabled(MIOPEN_DEBUG_CONV_GEMM{}) &&
                !(IsAnyBufferBF16(xDesc, dyDesc, dwDesc) && !IsUseRocBlas))
@@ -3730,8 +4126,20 @@ void ConvolutionDescriptor::ConvolutionWrwImmediate(Handle& handle,
                          " requested in immediate WrW, which is not supported.");
         }
 
-        const auto invoker =
-            LoadOrPrepareInvoker(handle, ctx, solver_id, conv::Direction::BackwardWeights);
+        const auto gemm_fallback = [&]() -> boost::optional<Invoker> {
+            if(!MIOPEN_USE_ROCBLAS || !IsGemmApplicableWrw(dyDesc, xDesc, dwDesc) ||
+               WrwGetValidWorkSpaceSizeGemm(dyDesc, xDesc, dwDesc) > workSpaceSize)
+                return boost::none;
+            return Invoker{[&](const Handle&, const AnyInvokeParams&) {
+                BackwardWeightsGemm(handle, tensors, workSpace, workSpaceSize);
+            }};
+        };
+        const auto invoker    = LoadOrPrepareInvokerAsync(handle,
+                                                       ctx,
+                                                       solver_id,
+                                                       conv::Direction::BackwardWeights,
+                                                       workSpaceSize,
+                                                       gemm_fallback);
         const auto invoke_ctx = conv::WrWInvokeParams{tensors, workSpace, workSpaceSize};
         invoker(handle, invoke_ctx);
     });
@@ -75,37 +75,11 @@ void CTCLossDescriptor::CTCLoss(const Handle& handle,
     int class_sz      = probsDesc.GetLengths()[2];
     int batch_size    = probsDesc.GetLengths()[1];
     int max_time_step = probsDesc.GetLengths()[0];
-    std::vector<int> repeat(batch_size, 0);
-    std::vector<int> labels_offset(batch_size, 0);
-    int max_label_len   = 0;
-    int total_label_len = 0;
 
-    for(int i = 0; i < batch_size; i++)
-    {
-        if(inputLengths[i] > max_time_step)
-        {
-            MIOPEN_THROW("Wrong input time step");
-        }
-        max_label_len = std::max(max_label_len, labelLengths[i]);
-        total_label_len += labelLengths[i];
-        labels_offset[i] = i == 0 ? 0 : (labels_offset[i - 1] + labelLengths[i - 1]);
-
-        for(int j = 0; j < labelLengths[i]; j++)
-        {
-            if(labels[labels_offset[i] + j] >= class_sz)
-            {
-                MIOPEN_THROW("Wrong label id");
-            }
-            if(j > 0)
-                if(labels[labels_offset[i] + j] == labels[labels_offset[i] + j - 1])
-                    repeat[i]++;
-        }
-
-        if(labelLengths[i] + repeat[i] > inputLengths[i])
-        {
-            MIOPEN_THROW("Error: label length exceeds input time step");
-        }
-    }
+    const auto meta = GetCTCLossMetadata(
+        class_sz, batch_size, max_time_step, labels, labelLengths, inputLengths);
+    const int max_label_len   = meta.max_label_len;
+    const int total_label_len = meta.total_label_len;
 
     int max_S_len       = 2 * max_label_len + 1;
     int lb_prime_offset = 4 * batch_size + total_label_len;
@@ -116,57 +90,20 @@ void CTCLossDescriptor::CTCLoss(const Handle& handle,
 
     int alpha_offset = problog_offset + class_sz * batch_size * max_time_step;
     int beta_offset  = alpha_offset + max_time_step * batch_size * max_S_len;
-    int batch_bytes  = 4 * batch_size; // batch size multiples sizeof(int)
+
+    // Lengths, offsets, repeats and labels go to the head of the workspace in one transfer.
+    const auto staging_bytes = meta.staging.size() * sizeof(int);
 
 #if MIOPEN_BACKEND_OPENCL
     auto q = handle.GetStream();
 
-    cl_context ctx;
-    clGetCommandQueueInfo(q, CL_QUEUE_CONTEXT, sizeof(cl_context), &ctx, nullptr);
-
-    clEnqueueWriteBuffer(q, workSpace, CL_FALSE, 0, batch_bytes, inputLengths, 0, nullptr, nullptr);
-    clEnqueueWriteBuffer(
-        q, workSpace, CL_FALSE, batch_bytes, batch_bytes, labelLengths, 0, nullptr, nullptr);
-    clEnqueueWriteBuffer(q,
-                         workSpace,
-                         CL_FALSE,
-                         2 * batch_bytes,
-                         batch_bytes,
-                         labels_offset.data(),
-                         0,
-                         nullptr,
-                         nullptr);
+    // Blocking, the staging buffer does not outlive this call.
     clEnqueueWriteBuffer(
-        q, workSpace, CL_FALSE, 3 * batch_bytes, batch_bytes, repeat.data(), 0, nullptr, nullptr);
-    clEnqueueWriteBuffer(q,
-                         workSpace,
-                         CL_FALSE,
-                         4 * batch_bytes,
-                         total_label_len * sizeof(int),
-                         labels,
-                         0,
-                         nullptr,
-                         nullptr);
+        q, workSpace, CL_TRUE, 0, staging_bytes, meta.staging.data(), 0, nullptr, nullptr);
 
 #elif MIOPEN_BACKEND_HIP
 
-    hipMemcpy(static_cast<int*>(workSpace), inputLengths, batch_bytes, hipMemcpyHostToDevice);
-    hipMemcpy(static_cast<int*>(workSpace) + batch_size,
-              labelLengths,
-              batch_bytes,
-              hipMemcpyHostToDevice);
-    hipMemcpy(static_cast<int*>(workSpace) + 2 * batch_size,
-              labels_offset.data(),
-              batch_bytes,
-              hipMemcpyHostToDevice);
-    hipMemcpy(static_cast<int*>(workSpace) + 3 * batch_size,
-              repeat.data(),
-              batch_bytes,
-              hipMemcpyHostToDevice);
-    hipMemcpy(static_cast<int*>(workSpace) + 4 * batch_size,
-              labels,
-              total_label_len * sizeof(int),
-              hipMemcpyHostToDevice);
+    hipMemcpy(workSpace, meta.staging.data(), staging_bytes, hipMemcpyHostToDevice);
 #endif
 
     std::string program_name = "MIOpenCTCLoss.cl";
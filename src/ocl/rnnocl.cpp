@@ -68,61 +68,22 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
     {
         MIOPEN_THROW(miopenStatusBadParm);
     }
-    if(workSpaceSize < GetWorkspaceSize(handle, seqLen, xDesc))
+    // Shape validation and the derived sizes only depend on the shapes, reuse them across calls.
+    const auto plan = GetForwardPlan(handle, seqLen, xDesc, yDesc, hyDesc);
+    if(workSpaceSize < plan->workspace_size)
     {
         MIOPEN_THROW("Workspace is required");
     }
 
     std::string network_config;
-    std::vector<int> in_n;
-    int in_h  = xDesc[0].GetLengths()[1]; // input vector size
-    int hy_d  = hyDesc.GetLengths()[0];   // biNumLayers
-    int hy_n  = hyDesc.GetLengths()[1];   // max batch size
-    int hy_h  = hyDesc.GetLengths()[2];   // hidden size
-    int out_h = yDesc[0].GetLengths()[1]; // output vector size
-
-    if(in_h <= 0 || hy_h <= 0 || hy_n <= 0 || hy_d <= 0 || out_h <= 0 || seqLen <= 0)
-    {
-        MIOPEN_THROW(miopenStatusBadParm);
-    }
-
-    int batch_n = 0;
-    for(int i = 0; i < seqLen; i++)
-    {
-        int batchval, inputvec, batchvalout, outputvec;
-        std::tie(batchval, inputvec)     = miopen::tien<2>(xDesc[i].GetLengths());
-        std::tie(batchvalout, outputvec) = miopen::tien<2>(yDesc[i].GetLengths());
-        if(batchval != batchvalout)
-        {
-            MIOPEN_THROW(miopenStatusBadParm,
-                         "Input batch length: " + std::to_string(batchval) +
-                             ", Output batch length: " + std::to_string(batchvalout));
-        }
-        if(i == 0)
-        {
-            if(batchval <= 0)
-            {
-                MIOPEN_THROW(miopenStatusBadParm, "Input batch is ZERO!");
-            }
-        }
-        else
-        {
-            if(batchval > in_n.back() || batchval < 0)
-            {
-                MIOPEN_THROW(miopenStatusBadParm,
-                             "Incorrect input batch size at time " + std::to_string(i) +
-                                 "! Batch size must not ascend!");
-            }
-        }
-        in_n.push_back(batchval);
-        batch_n += batchval;
-    }
-
-    int bi = dirMode != 0u ? 2 : 1;
-    if(out_h != (bi * hy_h))
-    {
-        MIOPEN_THROW(miopenStatusBadParm, "Output size doesn't match hidden state size!");
-    }
+    const auto& in_n  = plan->in_n;
+    const int batch_n = plan->batch_n;
+    int in_h          = plan->in_h;  // input vector size
+    const int hy_d    = plan->hy_d;  // biNumLayers
+    const int hy_n    = plan->hy_n;  // max batch size
+    const int hy_h    = plan->hy_h;  // hidden size
+    const int out_h   = plan->out_h; // output vector size
+    const int bi      = plan->bi;
 
     float ctime    = 0.;
     int in_stride  = in_h;
@@ -257,22 +218,7 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
             }
             else
             {
-                miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                  false,
-                                                                  true,
-                                                                  batch_n,
-                                                                  wei_len * bi,
-                                                                  in_h,
-                                                                  in_stride,
-                                                                  in_stride,
-                                                                  hy_stride,
-                                                                  1, // batch count
-                                                                  0, // Stride A
-                                                                  0, // Stride B
-                                                                  0, // Stride C
-                                                                  1, // alpha
-                                                                  1, // beta
-                                                                  xDesc[0].GetType()};
+                const auto& gemm_desc = plan->input_gemm;
 
                 miopenStatus_t gemm_status = CallGemm(handle,
                                                       gemm_desc,
@@ -306,22 +252,7 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
             wei_shift = (in_h + hy_h) * wei_stride + (li - 1) * (bi * hy_h + hy_h) * wei_stride;
             prelayer_shift = (li - 1) * batch_n * hy_stride + hid_off;
 
-            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                              false,
-                                                              true,
-                                                              batch_n,
-                                                              wei_len * bi,
-                                                              hy_h * bi,
-                                                              hy_stride,
-                                                              bi_stride,
-                                                              hy_stride,
-                                                              1, // batch count
-                                                              0, // Stride A
-                                                              0, // Stride B
-                                                              0, // Stride C
-                                                              1, // alpha
-                                                              1, // beta
-                                                              xDesc[0].GetType()};
+            const auto& gemm_desc = plan->layer_gemm;
             miopenStatus_t gemm_status = CallGemm(handle,
                                                   gemm_desc,
                                                   workSpace,
@@ -542,27 +473,17 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
         }
 
         // from hidden state
-        int bacc   = 0;
-        int baccbi = batch_n;
         for(int ti = 0; ti < seqLen; ti++)
         {
-            baccbi -= in_n.at(seqLen - 1 - ti);
-            wei_shift         = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
-            int pretime_shift = 0;
-            int use_time      = 0;
+            wei_shift = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
 
             for(int ri = 0; ri < bi; ri++)
             {
-                int cur_time  = ri == 0 ? ti : seqLen - 1 - ti;
-                int cur_batch = ri == 0 ? bacc : baccbi;
-                offset        = hid_shift + cur_batch * hy_stride;
-                if(ti > 0)
-                {
-                    pretime_shift =
-                        ri == 0 ? hid_shift + (bacc - in_n.at(ti - 1)) * hy_stride
-                                : hid_shift + (baccbi + in_n.at(seqLen - 1 - ti)) * hy_stride;
-                    use_time = ri == 0 ? ti : seqLen - ti;
-                }
+                const auto& step        = plan->steps[ti * bi + ri];
+                const int cur_time      = step.cur_time;
+                const int use_time      = step.use_time;
+                const int pretime_shift = ti > 0 ? hid_shift + step.pre_batch * hy_stride : 0;
+                offset                  = hid_shift + step.cur_batch * hy_stride;
 
                 if(in_n.at(cur_time) > 0)
                 {
@@ -570,22 +491,7 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                     {
                         if(hx != nullptr)
                         {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(cur_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              uni_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
+                            const auto& gemm_desc = step.hx_gemm;
 
                             miopenStatus_t gemm_status =
                                 CallGemm(handle,
@@ -619,23 +525,7 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                     {
                         if(ri == 1 && hx != nullptr && in_n.at(cur_time) > in_n.at(use_time))
                         {
-                            miopen::GemmDescriptor gemm_desc =
-                                GemmDescriptor{false,
-                                               false,
-                                               true,
-                                               (in_n.at(cur_time) - in_n.at(use_time)),
-                                               wei_len,
-                                               hy_h,
-                                               uni_stride,
-                                               uni_stride,
-                                               hy_stride,
-                                               1, // batch count
-                                               0, // Stride A
-                                               0, // Stride B
-                                               0, // Stride C
-                                               1, // alpha
-                                               1, // beta
-                                               xDesc[0].GetType()};
+                            const auto& gemm_desc = step.tail_gemm;
                             miopenStatus_t gemm_status =
                                 CallGemm(handle,
                                          gemm_desc,
@@ -667,22 +557,7 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
 
                         if(in_n.at(use_time) > 0)
                         {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(use_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              hy_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
+                            const auto& gemm_desc = step.h_gemm;
 
                             miopenStatus_t gemm_status =
                                 CallGemm(handle,
@@ -1167,7 +1042,6 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
                 }
             }
 
-            bacc += in_n.at(ti);
         }
 
         // update hy, cy
@@ -1176,8 +1050,8 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
             hx_size[2] = hy_h;
             sp_size[2] = hy_h;
 
-            bacc   = batch_n;
-            baccbi = 0;
+            int bacc   = batch_n;
+            int baccbi = 0;
             for(int ti = seqLen - 1; ti >= 0; ti--)
             {
                 bacc -= in_n.at(ti);
@@ -1299,7 +1173,9 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
     {
         MIOPEN_THROW(miopenStatusBadParm);
     }
-    if(workSpaceSize < GetWorkspaceSize(handle, seqLen, xDesc))
+    // Shape validation and the derived sizes only depend on the shapes, reuse them across calls.
+    const auto plan = GetForwardPlan(handle, seqLen, xDesc, yDesc, hyDesc);
+    if(workSpaceSize < plan->workspace_size)
     {
         MIOPEN_THROW("Workspace is required");
     }
@@ -1309,55 +1185,14 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
     }
 
     std::string network_config;
-    std::vector<int> in_n;
-    int in_h  = xDesc[0].GetLengths()[1]; // input vector size
-    int hy_d  = hyDesc.GetLengths()[0];   // biNumLayers
-    int hy_n  = hyDesc.GetLengths()[1];   // max batch size
-    int hy_h  = hyDesc.GetLengths()[2];   // hidden size
-    int out_h = yDesc[0].GetLengths()[1]; // output vector size
-
-    if(in_h <= 0 || hy_h <= 0 || hy_n <= 0 || hy_d <= 0 || out_h <= 0 || seqLen <= 0)
-    {
-        MIOPEN_THROW(miopenStatusBadParm);
-    }
-
-    int batch_n = 0;
-    for(int i = 0; i < seqLen; i++)
-    {
-        int batchval, inputvec, batchvalout, outputvec;
-        std::tie(batchval, inputvec)     = miopen::tien<2>(xDesc[i].GetLengths());
-        std::tie(batchvalout, outputvec) = miopen::tien<2>(yDesc[i].GetLengths());
-        if(batchval != batchvalout)
-        {
-            MIOPEN_THROW(miopenStatusBadParm,
-                         "Input batch length: " + std::to_string(batchval) +
-                             ", Output batch length: " + std::to_string(batchvalout));
-        }
-        if(i == 0)
-        {
-            if(batchval <= 0)
-            {
-                MIOPEN_THROW(miopenStatusBadParm, "Input batch is ZERO!");
-            }
-        }
-        else
-        {
-            if(batchval > in_n.back() || batchval < 0)
-            {
-                MIOPEN_THROW(miopenStatusBadParm,
-                             "Incorrect input batch size at time " + std::to_string(i) +
-                                 "! Batch size must not ascend!");
-            }
-        }
-        in_n.push_back(batchval);
-        batch_n += batchval;
-    }
-
-    int bi = dirMode != 0u ? 2 : 1;
-    if(out_h != (bi * hy_h))
-    {
-        MIOPEN_THROW(miopenStatusBadParm, "Output size doesn't match hidden state size!");
-    }
+    const auto& in_n  = plan->in_n;
+    const int batch_n = plan->batch_n;
+    int in_h          = plan->in_h;  // input vector size
+    const int hy_d    = plan->hy_d;  // biNumLayers
+    const int hy_n    = plan->hy_n;  // max batch size
+    const int hy_h    = plan->hy_h;  // hidden size
+    const int out_h   = plan->out_h; // output vector size
+    const int bi      = plan->bi;
 
     float ctime    = 0.;
     int in_stride  = in_h;
@@ -1492,22 +1327,7 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
             }
             else
             {
-                miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                  false,
-                                                                  true,
-                                                                  batch_n,
-                                                                  wei_len * bi,
-                                                                  in_h,
-                                                                  in_stride,
-                                                                  in_stride,
-                                                                  hy_stride,
-                                                                  1, // batch count
-                                                                  0, // Stride A
-                                                                  0, // Stride B
-                                                                  0, // Stride C
-                                                                  1, // alpha
-                                                                  1, // beta
-                                                                  xDesc[0].GetType()};
+                const auto& gemm_desc = plan->input_gemm;
 
                 miopenStatus_t gemm_status = CallGemm(handle,
                                                       gemm_desc,
@@ -1585,22 +1405,9 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
                 prelayer_shift = drop_out_offset;
             }
 
-            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                              false,
-                                                              true,
-                                                              batch_n,
-                                                              wei_len * bi,
-                                                              hy_h * bi,
-                                                              use_dropout ? hy_h * bi : hy_stride,
-                                                              bi_stride,
-                                                              hy_stride,
-                                                              1, // batch count
-                                                              0, // Stride A
-                                                              0, // Stride B
-                                                              0, // Stride C
-                                                              1, // alpha
-                                                              1, // beta
-                                                              xDesc[0].GetType()};
+            auto gemm_desc = plan->layer_gemm;
+            if(use_dropout)
+                gemm_desc.lda = hy_h * bi;
 
             miopenStatus_t gemm_status = CallGemm(handle,
                                                   gemm_desc,
@@ -1822,27 +1629,17 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
         }
 
         // from hidden state
-        int bacc   = 0;
-        int baccbi = batch_n;
         for(int ti = 0; ti < seqLen; ti++)
         {
-            baccbi -= in_n.at(seqLen - 1 - ti);
-            wei_shift         = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
-            int pretime_shift = 0;
-            int use_time      = 0;
+            wei_shift = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
 
             for(int ri = 0; ri < bi; ri++)
             {
-                int cur_time  = ri == 0 ? ti : seqLen - 1 - ti;
-                int cur_batch = ri == 0 ? bacc : baccbi;
-                offset        = hid_shift + cur_batch * hy_stride;
-                if(ti > 0)
-                {
-                    pretime_shift =
-                        ri == 0 ? hid_shift + (bacc - in_n.at(ti - 1)) * hy_stride
-                                : hid_shift + (baccbi + in_n.at(seqLen - 1 - ti)) * hy_stride;
-                    use_time = ri == 0 ? ti : seqLen - ti;
-                }
+                const auto& step        = plan->steps[ti * bi + ri];
+                const int cur_time      = step.cur_time;
+                const int use_time      = step.use_time;
+                const int pretime_shift = ti > 0 ? hid_shift + step.pre_batch * hy_stride : 0;
+                offset                  = hid_shift + step.cur_batch * hy_stride;
 
                 if(in_n.at(cur_time) > 0)
                 {
@@ -1850,22 +1647,7 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
                     {
                         if(hx != nullptr)
                         {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(cur_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              uni_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
+                            const auto& gemm_desc = step.hx_gemm;
 
                             miopenStatus_t gemm_status =
                                 CallGemm(handle,
@@ -1899,23 +1681,7 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
                     {
                         if(ri == 1 && hx != nullptr && in_n.at(cur_time) > in_n.at(use_time))
                         {
-                            miopen::GemmDescriptor gemm_desc =
-                                GemmDescriptor{false,
-                                               false,
-                                               true,
-                                               (in_n.at(cur_time) - in_n.at(use_time)),
-                                               wei_len,
-                                               hy_h,
-                                               uni_stride,
-                                               uni_stride,
-                                               hy_stride,
-                                               1, // batch count
-                                               0, // Stride A
-                                               0, // Stride B
-                                               0, // Stride C
-                                               1, // alpha
-                                               1, // beta
-                                               xDesc[0].GetType()};
+                            const auto& gemm_desc = step.tail_gemm;
 
                             miopenStatus_t gemm_status =
                                 CallGemm(handle,
@@ -1948,22 +1714,7 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
 
                         if(in_n.at(use_time) > 0)
                         {
-                            miopen::GemmDescriptor gemm_desc = GemmDescriptor{false,
-                                                                              false,
-                                                                              true,
-                                                                              in_n.at(use_time),
-                                                                              wei_len,
-                                                                              hy_h,
-                                                                              hy_stride,
-                                                                              uni_stride,
-                                                                              hy_stride,
-                                                                              1, // batch count
-                                                                              0, // Stride A
-                                                                              0, // Stride B
-                                                                              0, // Stride C
-                                                                              1, // alpha
-                                                                              1, // beta
-                                                                              xDesc[0].GetType()};
+                            const auto& gemm_desc = step.h_gemm;
 
                             miopenStatus_t gemm_status =
                                 CallGemm(handle,
@@ -2039,7 +1790,8 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
                                                          offset + 3 * hy_h + ri * wei_len,
                                                          offset + bi * wei_len + ri * hy_h,
                                                          pretime_shift + bi * wei_len + ri * hy_h,
-                                                         (li * batch_n + cur_batch) * bi * hy_h +
+                                                         (li * batch_n + step.cur_batch) * bi *
+                                                                 hy_h +
                                                              ri * hy_h +
                                                              nLayers * batch_n * hy_stride,
                                                          offset + hid_off + ri * hy_h);
@@ -2469,7 +2221,6 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
                 }
             }
 
-            bacc += in_n.at(ti);
         }
 
         // update hy, cy
@@ -2478,8 +2229,8 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
             hx_size[2] = hy_h;
             sp_size[2] = hy_h;
 
-            bacc   = batch_n;
-            baccbi = 0;
+            int bacc   = batch_n;
+            int baccbi = 0;
             for(int ti = seqLen - 1; ti >= 0; ti--)
             {
                 bacc -= in_n.at(ti);
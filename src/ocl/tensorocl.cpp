@@ -2182,48 +2182,23 @@ void TransformTensor(const Handle& handle,
             {
                 MIOPEN_THROW("Invalid y channel size");
             }
-
-            int8_t zero = 0;
-            SetTensor(handle, yDesc, y, &zero);
         }
         else if(x_len[1] % 4 != 0)
         {
             MIOPEN_THROW("Invalid x channel size");
         }
 
-        size_t batch_n = x_len[0];
-
-        x_len[0] = 1;
-        y_len[0] = 1;
-
-        miopen::TensorDescriptor x_batch_desc, y_batch_desc;
-        x_batch_desc = miopen::TensorDescriptor(miopenInt8, x_len);
-        y_batch_desc = miopen::TensorDescriptor(miopenInt8, y_len);
-
-        size_t x_batch_sz = x_batch_desc.GetElementSize();
-        size_t y_batch_sz = y_batch_desc.GetElementSize();
-
-        for(unsigned long i = 0; i < batch_n; i++)
+        if(!std::equal(x_len.begin() + 2, x_len.end(), y_len.begin() + 2))
         {
-            size_t x_offset = i * x_batch_sz;
-            size_t y_offset = i * y_batch_sz;
-
-            if(float_equal(*(static_cast<const float*>(alpha)), 1) &&
-               float_equal(*(static_cast<const float*>(beta)), 0))
-            {
-                CopyTensor(handle,
-                           ((x_len[1] <= y_len[1]) ? x_batch_desc : y_batch_desc),
-                           x,
-                           ((x_len[1] <= y_len[1]) ? x_batch_desc : y_batch_desc),
-                           y,
-                           x_offset,
-                           y_offset);
-            }
-            else
-            {
-                // TODO: support y=alpha*x+beta*y
-            }
+            MIOPEN_THROW("Tensor x and y spatial sizes do not match");
         }
+
+        const auto hw = std::accumulate(
+            x_len.begin() + 2, x_len.end(), std::size_t{1}, std::multiplies<std::size_t>());
+
+        // Padding, copy and scaling of the whole batch at once.
+        transform_int8_channels(
+            handle, x_len[0], x_len[1], y_len[1], hw, x, y, Xoffset, Yoffset, alpha, beta);
     }
     else if(xDesc.GetType() == miopenInt8 && yDesc.GetType() == miopenInt8x4 && x_len.size() >= 3)
     {
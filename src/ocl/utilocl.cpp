@@ -55,7 +55,8 @@ float Im2d2ColGPU(const Handle& handle,
                   const int dilation_h,
                   const int dilation_w,
                   Data_t col,
-                  miopenDataType_t type)
+                  miopenDataType_t type,
+                  const int batch_count)
 {
     std::string program_name = "MIOpenIm2d2Col.cl";
     std::string kernel_name  = "Im2d2Col";
@@ -73,7 +74,8 @@ float Im2d2ColGPU(const Handle& handle,
         "_" + std::to_string(stride_w) +
         "d" + std::to_string(dilation_h) +
         "_" + std::to_string(dilation_w) +
-        "t" + std::to_string(type);
+        "t" + std::to_string(type) +
+        "b" + std::to_string(batch_count);
     // clang-format on
 
     auto&& kernels = handle.GetKernels("miopenIm2d2Col", network_config);
@@ -83,6 +85,11 @@ float Im2d2ColGPU(const Handle& handle,
     int data_size_bound_pack = type == miopenInt8x4 ? data_size_bound * 4 : data_size_bound;
     int im_offset_pack       = type == miopenInt8x4 ? im_offset / 4 : im_offset;
 
+    // The images of the batch and their columns follow each other.
+    const int c_pack           = type == miopenInt8x4 ? c / 4 : c;
+    const int im_batch_stride  = c_pack * in_h * in_w;
+    const int col_batch_stride = c_pack * wei_h * wei_w * out_h * out_w;
+
     if(!kernels.empty())
     {
         auto kernel = kernels.front();
@@ -101,12 +108,12 @@ float Im2d2ColGPU(const Handle& handle,
                stride_w,
                dilation_h,
                dilation_w,
-               col);
+               col,
+               im_batch_stride,
+               col_batch_stride);
     }
     else
     {
-        const int c_pack = type == miopenInt8x4 ? c / 4 : c;
-
         std::string params;
         int num_ch_per_wg;
         if((out_h <= 8 && out_w <= 8) && (stride_h == 1 && stride_w == 1) && (c_pack % 4 == 0))
@@ -195,9 +202,9 @@ float Im2d2ColGPU(const Handle& handle,
 
         const std::vector<size_t> vld{256, 1, 1};
         size_t global_threads = 256 * std::max(1, (c_pack / num_ch_per_wg)) * num_blks;
-        const std::vector<size_t> vgd{global_threads, 1, 1};
+        const std::vector<size_t> vgd{global_threads, static_cast<size_t>(batch_count), 1};
         handle.AddKernel(
-            "miopenIm2Col", network_config, program_name, kernel_name, vld, vgd, params)(
+            "miopenIm2d2Col", network_config, program_name, kernel_name, vld, vgd, params)(
             data_size_bound_pack,
             im,
             im_offset_pack,
@@ -213,7 +220,9 @@ float Im2d2ColGPU(const Handle& handle,
             stride_w,
             dilation_h,
             dilation_w,
-            col);
+            col,
+            im_batch_stride,
+            col_batch_stride);
     }
 
     return handle.GetKernelTime();
@@ -357,7 +366,8 @@ float Col2Im2dGPU(const Handle& handle,
                   const int in_w,
                   Data_t im,
                   int im_offset,
-                  miopenDataType_t type)
+                  miopenDataType_t type,
+                  const int batch_count)
 {
     std::string program_name = "MIOpenCol2Im2d.cl";
     std::string kernel_name  = "Col2Im2d";
@@ -375,11 +385,16 @@ float Col2Im2dGPU(const Handle& handle,
         "v" + std::to_string(stride_w) +
         "l" + std::to_string(dilation_h) +
         "j" + std::to_string(dilation_w) +
-        "t" + std::to_string(type);
+        "t" + std::to_string(type) +
+        "b" + std::to_string(batch_count);
     // clang-format on
 
     auto&& kernels = handle.GetKernels("miopenCol2Im2d", network_config);
 
+    // The columns of the batch and their images follow each other.
+    const int col_batch_stride = in_c * wei_h * wei_w * out_h * out_w;
+    const int im_batch_stride  = in_c * in_h * in_w;
+
     if(!kernels.empty())
     {
         auto kernel = kernels.front();
@@ -397,7 +412,9 @@ float Col2Im2dGPU(const Handle& handle,
                in_h,
                in_w,
                im,
-               im_offset);
+               im_offset,
+               col_batch_stride,
+               im_batch_stride);
     }
     else
     {
@@ -405,7 +422,7 @@ float Col2Im2dGPU(const Handle& handle,
 
         const std::vector<size_t> vld{256, 1, 1};
         size_t global_threads = in_c * in_h * in_w;
-        const std::vector<size_t> vgd{global_threads, 1, 1};
+        const std::vector<size_t> vgd{global_threads, static_cast<size_t>(batch_count), 1};
 
         handle.AddKernel(
             "miopenCol2Im2d", network_config, program_name, kernel_name, vld, vgd, params)(
@@ -423,7 +440,9 @@ float Col2Im2dGPU(const Handle& handle,
             in_h,
             in_w,
             im,
-            im_offset);
+            im_offset,
+            col_batch_stride,
+            im_batch_stride);
     }
     return handle.GetKernelTime();
 }
@@ -552,8 +571,12 @@ float Im2ColGPU(
     const std::vector<int>& stride_spatial,
     const std::vector<int>& dilation_spatial,
     Data_t col,
-    miopenDataType_t type)
+    miopenDataType_t type,
+    std::size_t batch_count)
 {
+    if(spatial_dim != 2 && batch_count != 1)
+        MIOPEN_THROW("Only 2D im2col processes several images at once");
+
     switch(spatial_dim)
     {
     case 2:
@@ -575,7 +598,8 @@ float Im2ColGPU(
                            dilation_spatial[0],
                            dilation_spatial[1],
                            col,
-                           type);
+                           type,
+                           batch_count);
     }
     case 3:
     {
@@ -622,8 +646,12 @@ float Col2ImGPU(
     const decltype(boost::adaptors::slice(std::vector<std::size_t>(), 0, 1))& in_spatial,
     Data_t im,
     std::size_t im_offset,
-    miopenDataType_t type)
+    miopenDataType_t type,
+    std::size_t batch_count)
 {
+    if(spatial_dim != 2 && batch_count != 1)
+        MIOPEN_THROW("Only 2D col2im processes several images at once");
+
     switch(spatial_dim)
     {
     case 2:
@@ -645,7 +673,8 @@ float Col2ImGPU(
                            in_spatial[1],
                            im,
                            im_offset,
-                           type);
+                           type,
+                           batch_count);
     }
     case 3:
     {
@@ -1066,14 +1095,15 @@ float transpose_packed_MN2NM(const Handle& handle,
                              int out_offset,
                              ConstData_t in,
                              Data_t out,
-                             miopenDataType_t type)
+                             miopenDataType_t type,
+                             int batch_count)
 {
 
     std::string program_name = "MIOpenUtilKernels4.cl";
 
     std::string network_config = "n" + std::to_string(n) + "m" + std::to_string(m) + "inoff" +
                                  std::to_string(in_offset) + "otoff" + std::to_string(out_offset) +
-                                 "t" + std::to_string(type);
+                                 "t" + std::to_string(type) + "b" + std::to_string(batch_count);
 
     std::string kernel_name = "transpose_packed_MN2NM";
 
@@ -1109,7 +1139,7 @@ float transpose_packed_MN2NM(const Handle& handle,
         size_t ld0 = WG_SIZE;
         size_t gd0 = m * n;
         const std::vector<size_t> vld{ld0, 1, 1};
-        std::vector<size_t> vgd{gd0, 1, 1};
+        std::vector<size_t> vgd{gd0, static_cast<size_t>(batch_count), 1};
 
         handle.AddKernel(kernel_name, network_config, program_name, kernel_name, vld, vgd, params)(
             in, out);
@@ -1117,4 +1147,71 @@ float transpose_packed_MN2NM(const Handle& handle,
 
     return handle.GetKernelTime();
 }
+
+float transform_int8_channels(const Handle& handle,
+                              std::size_t n,
+                              std::size_t c_in,
+                              std::size_t c_out,
+                              std::size_t hw,
+                              ConstData_t in,
+                              Data_t out,
+                              std::size_t in_offset,
+                              std::size_t out_offset,
+                              const void* alpha,
+                              const void* beta)
+{
+    const auto alpha_fp  = *(static_cast<const float*>(alpha));
+    const auto beta_fp   = *(static_cast<const float*>(beta));
+    const auto use_alpha = !float_equal(alpha_fp, 1.0);
+    const auto use_beta  = !float_equal(beta_fp, 0);
+
+    std::string program_name = "MIOpenUtilKernels4.cl";
+    std::string kernel_name  = "transform_int8_channels";
+
+    // clang-format off
+    std::string network_config =
+        "n" + std::to_string(n) +
+        "ci" + std::to_string(c_in) +
+        "co" + std::to_string(c_out) +
+        "hw" + std::to_string(hw) +
+        "a" + std::to_string(static_cast<int>(use_alpha)) +
+        "b" + std::to_string(static_cast<int>(use_beta));
+    // clang-format on
+
+    auto&& kernels = handle.GetKernels(kernel_name, network_config);
+
+    if(!kernels.empty())
+    {
+        auto kernel = kernels.front();
+        kernel(in,
+               out,
+               static_cast<unsigned>(in_offset),
+               static_cast<unsigned>(out_offset),
+               alpha_fp,
+               beta_fp);
+    }
+    else
+    {
+        std::string params = GetDataTypeKernelParams(miopenInt8);
+        params += " -DNC_TRANS_INT8_CHANNELS=1";
+        params += " -DC_IN=" + std::to_string(c_in);
+        params += " -DC_OUT=" + std::to_string(c_out);
+        params += " -DHW=" + std::to_string(hw);
+        params += " -DUSE_ALPHA=" + std::to_string(static_cast<int>(use_alpha));
+        params += " -DUSE_BETA=" + std::to_string(static_cast<int>(use_beta));
+
+        const std::vector<size_t> vld{WG_SIZE, 1, 1};
+        const std::vector<size_t> vgd{(c_out * hw + WG_SIZE - 1) / WG_SIZE * WG_SIZE, n, 1};
+
+        handle.AddKernel(kernel_name, network_config, program_name, kernel_name, vld, vgd, params)(
+            in,
+            out,
+            static_cast<unsigned>(in_offset),
+            static_cast<unsigned>(out_offset),
+            alpha_fp,
+            beta_fp);
+    }
+
+    return handle.GetKernelTime();
+}
 } // namespace miopen
@@ -27,6 +27,7 @@
 #include <miopen/handle_lock.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/oclkernel.hpp>
+#include <miopen/trace.hpp>
 
 namespace miopen {
 
@@ -52,6 +53,7 @@ static std::string DimToFormattedString(const size_t* dims, size_t count)
 
 void OCLKernelInvoke::run() const
 {
+    MIOPEN_TRACE_SPAN("KernelLaunch", "kernel");
 #ifndef NDEBUG
     MIOPEN_LOG_I2("kernel_name = " << GetName() << ", work_dim = " << work_dim
                                    << ", global_work_offset = "
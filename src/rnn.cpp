@@ -25,12 +25,18 @@
  *******************************************************************************/
 
 #include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
 #include <miopen/rnn.hpp>
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <mutex>
 #include <numeric>
 #include <ostream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 
 // MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_AMD_ROCM_PRECOMPILED_BINARIES)
 // MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_AMD_ASM_KERNELS_PERF_FILTERING)
@@ -43,11 +49,27 @@
 
 namespace miopen {
 
+static std::size_t& RNNLaunchCount()
+{
+    static thread_local std::size_t count = 0;
+    return count;
+}
+
+std::size_t GetRNNLaunchCount() { return RNNLaunchCount(); }
+
 void profileRNNkernels(const Handle& handle, unsigned char select, float& ctime)
 {
 
     float ktime = 0.;
     assert((select < 3) && "profileSequence case incorrect");
+
+    // Each call follows a launch, the first one of an RNN call resets the counter.
+    if(select == 0)
+        RNNLaunchCount() = 1;
+    else
+        ++RNNLaunchCount();
+    if(select == 2)
+        MIOPEN_LOG_I2("RNN launches: " << RNNLaunchCount());
     switch(select)
     {
 
@@ -293,6 +315,7 @@ RNNDescriptor::RNNDescriptor()
     typeSize                    = 4;
     workspaceScale              = 1;
     miopen::deref(&dropoutDesc) = new miopen::DropoutDescriptor();
+    forwardPlans                = std::make_shared<ForwardPlanCache>();
 }
 
 RNNDescriptor::RNNDescriptor(int hsz,
@@ -304,7 +327,6 @@ RNNDescriptor::RNNDescriptor(int hsz,
                              miopenRNNAlgo_t amode,
                              miopenDataType_t dType)
 {
-
     if(hsz < 0 || layers < 0)
     {
         MIOPEN_THROW(miopenStatusBadParm,
@@ -351,6 +373,7 @@ RNNDescriptor::RNNDescriptor(int hsz,
     biasMode                    = bmode;
     dataType                    = dType;
     miopen::deref(&dropoutDesc) = new miopen::DropoutDescriptor();
+    forwardPlans                = std::make_shared<ForwardPlanCache>();
 
     switch(rmode)
     {
@@ -387,9 +410,9 @@ RNNDescriptor::RNNDescriptor(int hsz,
       inputMode(inMode),
       biasMode(bmode),
       dataType(dType),
-      dropoutDesc(dropDesc)
+      dropoutDesc(dropDesc),
+      forwardPlans(std::make_shared<ForwardPlanCache>())
 {
-
     if(hsz < 0 || layers < 0)
     {
         MIOPEN_THROW(miopenStatusBadParm,
@@ -464,6 +487,209 @@ size_t RNNDescriptor::GetWorkspaceSize(Handle& /* handle */,
     return size_t(dirMode == miopenRNNbidirection ? 2 * x : x);
 }
 
+struct RNNDescriptor::ForwardPlanCache
+{
+    // Enough for the sequence lengths of a bucketed workload, cleared when exceeded.
+    static constexpr std::size_t max_plans = 64;
+
+    std::mutex mutex;
+    // Keyed by the hash of the shapes, plans of colliding shapes share the bucket.
+    std::unordered_multimap<std::uint64_t, std::shared_ptr<const RNNForwardPlan>> plans;
+};
+
+static void HashCombine(std::uint64_t& seed, std::size_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+// Passes everything a forward plan is derived from to f, besides the RNN descriptor which owns
+// the cache. The lengths are only read, not copied, in one pass over the sequence.
+template <class F>
+static void VisitForwardShapes(int seqLen,
+                               c_array_view<const miopenTensorDescriptor_t> xDesc,
+                               c_array_view<const miopenTensorDescriptor_t> yDesc,
+                               const TensorDescriptor& hyDesc,
+                               F f)
+{
+    const auto visit_lengths = [&](const TensorDescriptor& desc) {
+        const auto& lengths = desc.GetLengths();
+        f(lengths.size());
+        for(auto len : lengths)
+            f(len);
+    };
+    f(seqLen);
+    f(xDesc[0].GetType());
+    visit_lengths(hyDesc);
+    for(int i = 0; i < seqLen; i++)
+    {
+        visit_lengths(xDesc[i]);
+        visit_lengths(yDesc[i]);
+    }
+}
+
+// A GEMM of the forward pass, which adds A * B^T to C.
+static GemmDescriptor
+ForwardGemm(int m, int n, int k, int lda, int ldb, int ldc, miopenDataType_t type)
+{
+    return GemmDescriptor{false,
+                          false,
+                          true,
+                          m,
+                          n,
+                          k,
+                          lda,
+                          ldb,
+                          ldc,
+                          1, // batch count
+                          0, // Stride A
+                          0, // Stride B
+                          0, // Stride C
+                          1, // alpha
+                          1, // beta
+                          type};
+}
+
+std::shared_ptr<const RNNForwardPlan>
+RNNDescriptor::GetForwardPlan(Handle& handle,
+                              const int seqLen,
+                              c_array_view<const miopenTensorDescriptor_t> xDesc,
+                              c_array_view<const miopenTensorDescriptor_t> yDesc,
+                              const TensorDescriptor& hyDesc) const
+{
+    if(seqLen <= 0)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+
+    std::uint64_t key = 0;
+    VisitForwardShapes(
+        seqLen, xDesc, yDesc, hyDesc, [&](std::size_t value) { HashCombine(key, value); });
+
+    {
+        std::lock_guard<std::mutex> lock(forwardPlans->mutex);
+        const auto range = forwardPlans->plans.equal_range(key);
+        for(auto it = range.first; it != range.second; ++it)
+        {
+            // The hash may collide, so the shapes of the plan are compared as well.
+            const auto& shapes = it->second->shapes;
+            auto matches       = true;
+            auto n             = std::size_t{0};
+            VisitForwardShapes(seqLen, xDesc, yDesc, hyDesc, [&](std::size_t value) {
+                matches = matches && n < shapes.size() && shapes[n] == value;
+                ++n;
+            });
+            if(matches && n == shapes.size())
+                return it->second;
+        }
+    }
+
+    auto plan = std::make_shared<RNNForwardPlan>();
+    VisitForwardShapes(seqLen, xDesc, yDesc, hyDesc, [&](std::size_t value) {
+        plan->shapes.push_back(value);
+    });
+    plan->in_h  = xDesc[0].GetLengths()[1];
+    plan->hy_d  = hyDesc.GetLengths()[0];
+    plan->hy_n  = hyDesc.GetLengths()[1];
+    plan->hy_h  = hyDesc.GetLengths()[2];
+    plan->out_h = yDesc[0].GetLengths()[1];
+
+    if(plan->in_h <= 0 || plan->hy_h <= 0 || plan->hy_n <= 0 || plan->hy_d <= 0 ||
+       plan->out_h <= 0)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+
+    plan->in_n.reserve(seqLen);
+    for(int i = 0; i < seqLen; i++)
+    {
+        int batchval, inputvec, batchvalout, outputvec;
+        std::tie(batchval, inputvec)     = miopen::tien<2>(xDesc[i].GetLengths());
+        std::tie(batchvalout, outputvec) = miopen::tien<2>(yDesc[i].GetLengths());
+        if(batchval != batchvalout)
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Input batch length: " + std::to_string(batchval) +
+                             ", Output batch length: " + std::to_string(batchvalout));
+        }
+        if(i == 0)
+        {
+            if(batchval <= 0)
+            {
+                MIOPEN_THROW(miopenStatusBadParm, "Input batch is ZERO!");
+            }
+        }
+        else
+        {
+            if(batchval > plan->in_n.back() || batchval < 0)
+            {
+                MIOPEN_THROW(miopenStatusBadParm,
+                             "Incorrect input batch size at time " + std::to_string(i) +
+                                 "! Batch size must not ascend!");
+            }
+        }
+        plan->in_n.push_back(batchval);
+        plan->batch_n += batchval;
+    }
+
+    plan->bi = dirMode != 0u ? 2 : 1;
+    if(plan->out_h != (plan->bi * plan->hy_h))
+    {
+        MIOPEN_THROW(miopenStatusBadParm, "Output size doesn't match hidden state size!");
+    }
+
+    plan->workspace_size = GetWorkspaceSize(handle, seqLen, xDesc);
+
+    const auto& in_n     = plan->in_n;
+    const int bi         = plan->bi;
+    const int hy_h       = plan->hy_h;
+    const int hy_stride  = hy_h * bi * static_cast<int>(workspaceScale);
+    const int uni_stride = hy_h;
+    const auto type      = xDesc[0].GetType();
+    int wei_len          = hy_h;
+    if(rnnMode == miopenLSTM)
+        wei_len = hy_h * 4;
+    else if(rnnMode == miopenGRU)
+        wei_len = hy_h * 3;
+
+    plan->input_gemm = ForwardGemm(
+        plan->batch_n, wei_len * bi, plan->in_h, plan->in_h, plan->in_h, hy_stride, type);
+    plan->layer_gemm =
+        ForwardGemm(plan->batch_n, wei_len * bi, hy_h * bi, hy_stride, hy_h * bi, hy_stride, type);
+
+    plan->steps.resize(seqLen * bi);
+    int bacc   = 0;
+    int baccbi = plan->batch_n;
+    for(int ti = 0; ti < seqLen; ti++)
+    {
+        baccbi -= in_n.at(seqLen - 1 - ti);
+        for(int ri = 0; ri < bi; ri++)
+        {
+            auto& step     = plan->steps[ti * bi + ri];
+            step.cur_time  = ri == 0 ? ti : seqLen - 1 - ti;
+            step.cur_batch = ri == 0 ? bacc : baccbi;
+            if(ti > 0)
+            {
+                step.pre_batch =
+                    ri == 0 ? bacc - in_n.at(ti - 1) : baccbi + in_n.at(seqLen - 1 - ti);
+                step.use_time = ri == 0 ? ti : seqLen - ti;
+            }
+            const int cur_n = in_n.at(step.cur_time);
+            const int use_n = in_n.at(step.use_time);
+            step.hx_gemm =
+                ForwardGemm(cur_n, wei_len, hy_h, uni_stride, uni_stride, hy_stride, type);
+            step.tail_gemm =
+                ForwardGemm(cur_n - use_n, wei_len, hy_h, uni_stride, uni_stride, hy_stride, type);
+            step.h_gemm = ForwardGemm(use_n, wei_len, hy_h, hy_stride, uni_stride, hy_stride, type);
+        }
+        bacc += in_n.at(ti);
+    }
+
+    std::lock_guard<std::mutex> lock(forwardPlans->mutex);
+    if(forwardPlans->plans.size() >= ForwardPlanCache::max_plans)
+        forwardPlans->plans.clear();
+    return forwardPlans->plans.emplace(key, std::move(plan))->second;
+}
+
 size_t RNNDescriptor::GetReserveSize(Handle& /* handle */,
                                      const int seqLength,
                                      c_array_view<const miopenTensorDescriptor_t> xDesc) const
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/shared_file_store.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+namespace fs = boost::filesystem;
+
+static const char* TmpExt() { return ".tmp"; }
+
+SharedFileStore::SharedFileStore(fs::path root_, std::size_t max_size_)
+    : root(std::move(root_)), max_size(max_size_)
+{
+}
+
+std::size_t SharedFileStore::Publish(const fs::path& file,
+                                     const std::function<void(std::ostream&)>& write) const
+{
+    boost::system::error_code ec;
+    fs::create_directories(root, ec);
+    const auto tmp = root / fs::unique_path(file.filename().string() + ".%%%%-%%%%" + TmpExt());
+    std::size_t written = 0;
+    {
+        std::ofstream os{tmp.string(), std::ios::binary};
+        write(os);
+        written = os ? static_cast<std::size_t>(os.tellp()) : 0;
+        if(written == 0)
+        {
+            MIOPEN_LOG_W("Unable to write " << tmp);
+            fs::remove(tmp, ec);
+            return 0;
+        }
+    }
+    fs::rename(tmp, file, ec);
+    if(ec)
+    {
+        fs::remove(tmp, ec);
+        return 0;
+    }
+    return written;
+}
+
+void SharedFileStore::Touch(const fs::path& file)
+{
+    boost::system::error_code ec;
+    fs::last_write_time(file, std::time(nullptr), ec);
+}
+
+std::size_t SharedFileStore::Account(std::atomic<std::size_t>& unchecked_bytes,
+                                     std::size_t written,
+                                     const fs::path& keep) const
+{
+    // Each process checks the size once it has written a part of the bound, since it does not
+    // know what the others have written.
+    if((unchecked_bytes += written) <= max_size / 16)
+        return 0;
+    unchecked_bytes = 0;
+    return Evict(keep);
+}
+
+// The times only have a resolution of seconds, so the file which has just been stored is kept
+// explicitly.
+std::size_t SharedFileStore::Evict(const fs::path& keep) const
+{
+    auto& lock = LockFile::Get((root / "evict.lock").c_str());
+    std::lock_guard<LockFile> guard(lock);
+
+    std::vector<std::pair<std::time_t, fs::path>> entries;
+    std::size_t total = 0;
+    boost::system::error_code ec;
+    boost::system::error_code it_ec;
+    for(fs::directory_iterator it{root, it_ec}, end; !it_ec && it != end; it.increment(it_ec))
+    {
+        const auto& p = it->path();
+        if(!fs::is_regular_file(p, ec) || p.extension() == ".lock")
+            continue;
+        const auto size = fs::file_size(p, ec);
+        const auto time = fs::last_write_time(p, ec);
+        if(ec)
+            continue;
+        if(p.extension() == TmpExt())
+        {
+            // Left behind by a process which died while storing.
+            if(time + 3600 < std::time(nullptr))
+                fs::remove(p, ec);
+            continue;
+        }
+        total += size;
+        entries.emplace_back(time, p);
+    }
+    if(total <= max_size)
+        return 0;
+
+    std::sort(entries.begin(), entries.end());
+    std::size_t evicted = 0;
+    for(const auto& entry : entries)
+    {
+        if(total <= max_size / 4 * 3)
+            break;
+        if(entry.second == keep)
+            continue;
+        // Processes which have opened the file keep reading it.
+        const auto size = fs::file_size(entry.second, ec);
+        if(!ec && fs::remove(entry.second, ec))
+        {
+            total -= size;
+            ++evicted;
+        }
+    }
+    MIOPEN_LOG_I2("Evicted " << evicted << " files from " << root << ", " << total
+                             << " bytes left");
+    return evicted;
+}
+
+} // namespace miopen
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/shared_kernel_cache.hpp>
+#include <miopen/env.hpp>
+#include <miopen/expanduser.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/make_unique.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/shared_file_store.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/version.h>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_SHARED_KERNEL_CACHE_DIR)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_SHARED_KERNEL_CACHE_SIZE_MB)
+
+namespace fs = boost::filesystem;
+namespace ip = boost::interprocess;
+
+static const char* Magic() { return "miopen-shared-kernel"; }
+
+// The first entry of each process checks the size, since it does not know what the others have
+// written.
+SharedKernelCache::SharedKernelCache(fs::path root_, std::size_t max_size_)
+    : files(std::move(root_), max_size_), unchecked_bytes(max_size_)
+{
+}
+
+const SharedKernelCache* SharedKernelCache::Get()
+{
+    static const auto cache = []() -> std::unique_ptr<SharedKernelCache> {
+        const char* const dir = GetStringEnv(MIOPEN_SHARED_KERNEL_CACHE_DIR{});
+        if(dir == nullptr || strlen(dir) == 0)
+            return nullptr;
+
+        const auto version = std::to_string(MIOPEN_VERSION_MAJOR) + "." +
+                             std::to_string(MIOPEN_VERSION_MINOR) + "." +
+                             std::to_string(MIOPEN_VERSION_PATCH) + "." +
+                             MIOPEN_STRINGIZE(MIOPEN_VERSION_TWEAK);
+        const auto root = fs::path{ExpandUser(dir)} / version;
+        boost::system::error_code ec;
+        fs::create_directories(root, ec);
+        // The entries are run on the device, so nobody but the owner may write them.
+        struct stat st;
+        if(ec || stat(root.c_str(), &st) != 0 || st.st_uid != getuid())
+        {
+            MIOPEN_LOG_W("Shared kernel cache is disabled, " << root
+                                                             << " is not a directory of this user");
+            return nullptr;
+        }
+        fs::permissions(root, fs::owner_all, ec);
+
+        const auto max_size = Value(MIOPEN_SHARED_KERNEL_CACHE_SIZE_MB{}, 1024) * 1024 * 1024;
+        MIOPEN_LOG_I2("Shared kernel cache: " << root << ", " << max_size << " bytes");
+        return make_unique<SharedKernelCache>(root, max_size);
+    }();
+    return cache.get();
+}
+
+const fs::path& SharedKernelCache::Path() const { return files.Path(); }
+
+fs::path SharedKernelCache::EntryPath(const std::string& key) const
+{
+    return files.Path() / md5(key);
+}
+
+boost::optional<std::string> SharedKernelCache::Load(const std::string& key) const
+{
+    const auto file = EntryPath(key);
+    boost::system::error_code ec;
+    if(!fs::exists(file, ec))
+        return boost::none;
+
+    std::string binary;
+    try
+    {
+        const ip::file_mapping mapping{file.c_str(), ip::read_only};
+        const ip::mapped_region region{mapping, ip::read_only};
+        const auto* const begin = static_cast<const char*>(region.get_address());
+        const auto* const end   = begin + region.get_size();
+        const auto* const data  = std::find(begin, end, '\n');
+        if(data == end)
+            return boost::none;
+
+        std::istringstream header{std::string(begin, data)};
+        std::string magic;
+        std::size_t key_size    = 0;
+        std::size_t binary_size = 0;
+        if(!(header >> magic >> key_size >> binary_size) || magic != Magic() ||
+           static_cast<std::size_t>(end - data) != 1 + key_size + binary_size ||
+           key.compare(0, key.size(), data + 1, key_size) != 0)
+            return boost::none;
+        binary.assign(data + 1 + key_size, binary_size);
+    }
+    catch(const ip::interprocess_exception& ex)
+    {
+        // The entry has just been evicted.
+        MIOPEN_LOG_I2("Unable to map " << file << ": " << ex.what());
+        return boost::none;
+    }
+
+    SharedFileStore::Touch(file);
+    return binary;
+}
+
+void SharedKernelCache::Store(const std::string& key, const std::string& binary) const
+{
+    std::ostringstream header;
+    header << Magic() << ' ' << key.size() << ' ' << binary.size() << '\n';
+    if(header.str().size() + key.size() + binary.size() > files.MaxSize())
+        return;
+
+    const auto file    = EntryPath(key);
+    const auto written = files.Publish(file, [&](std::ostream& os) {
+        os << header.str();
+        os.write(key.data(), key.size());
+        os.write(binary.data(), binary.size());
+    });
+    if(written != 0)
+        files.Account(unchecked_bytes, written, file);
+}
+
+std::string SharedKernelCache::LoadOrPopulate(const std::string& key,
+                                              const std::function<std::string()>& load) const
+{
+    if(auto binary = Load(key))
+        return std::move(*binary);
+
+    // The keys are spread over a few locks, so that workers only wait for each other when they
+    // miss similar kernels.
+    const auto lock_path = Path() / ("populate-" + md5(key).substr(0, 1) + ".lock");
+    auto& lock           = LockFile::Get(lock_path.c_str());
+    std::lock_guard<LockFile> guard(lock);
+
+    if(auto binary = Load(key))
+        return std::move(*binary);
+    auto binary = load();
+    if(!binary.empty())
+        Store(key, binary);
+    return binary;
+}
+
+} // namespace miopen
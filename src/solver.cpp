@@ -25,9 +25,11 @@
  *******************************************************************************/
 
 #include <miopen/solver.hpp>
+#include <miopen/compile_queue.hpp>
 #include <miopen/conv_algo_name.hpp>
 
 #include <miopen/db.hpp>
+#include <miopen/find_solution.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/par_for.hpp>
 #include <miopen/stringutils.hpp>
@@ -35,12 +37,19 @@
 #include <miopen/timer.hpp>
 
 #include <boost/range/adaptor/transformed.hpp>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 namespace miopen {
 namespace solver {
 
-MIOPEN_DECLARE_ENV_VAR(MIOPEN_COMPILE_PARALLEL_LEVEL)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_APPLICABILITY_CACHE)
 
 std::ostream& operator<<(std::ostream& os, const KernelInfo& k)
 {
@@ -60,7 +69,7 @@ std::vector<Program> PrecompileKernels(const Handle& h, const std::vector<Kernel
 
     // clang-format off
     par_for(kernels.size(),
-            max_threads{Value(MIOPEN_COMPILE_PARALLEL_LEVEL{}, 20)},
+            max_threads{GetCompileParallelLevel()},
             [&](auto i) {
                 const KernelInfo& k = kernels[i];
                 programs[i]         = h.LoadProgram(k.kernel_file, k.comp_options, false, "");
@@ -73,7 +82,9 @@ std::vector<Program> PrecompileKernels(const Handle& h, const std::vector<Kernel
 void PrecompileSolutions(const Handle& h, const std::vector<ConvSolution>& sols)
 {
     // Find all kernels that need to be compiled from the solutions
+    // Solutions often share programs, so each one is built only once.
     std::vector<KernelInfo> kernels;
+    std::set<std::pair<std::string, std::string>> programs_seen;
     for(auto&& sol : sols)
     {
         if(!sol.Succeeded())
@@ -82,6 +93,8 @@ void PrecompileSolutions(const Handle& h, const std::vector<ConvSolution>& sols)
         {
             if(h.HasProgram(kernel.kernel_file, kernel.comp_options))
                 continue;
+            if(!programs_seen.emplace(kernel.kernel_file, kernel.comp_options).second)
+                continue;
             kernels.push_back(kernel);
         }
     }
@@ -97,6 +110,96 @@ void PrecompileSolutions(const Handle& h, const std::vector<ConvSolution>& sols)
     }
 }
 
+static std::string GetApplicabilityKey(const ConvolutionContext& ctx)
+{
+    // Serialize() covers the perf-db key of the problem, the rest are the inputs of
+    // IsApplicable() which are not part of that key.
+    std::ostringstream ss;
+    ctx.Serialize(ss);
+    ss << ' ' << ctx.weights_layout << ' ' << ctx.out_layout;
+    ss << ' ' << ctx.in_stride << 'x' << ctx.in_channel_stride << 'x' << ctx.in_batch_stride;
+    ss << ' ' << ctx.out_stride << 'x' << ctx.out_channel_stride << 'x' << ctx.out_batch_stride;
+    ss << ' ' << ctx.GetStream().GetDbBasename();
+    ss << ' ' << ctx.use_asm_kernels << ctx.use_hip_kernels << ctx.use_opencl_convolutions
+       << ctx.use_binaries << ctx.rmv.getValue() << ctx.use_dynamic_solutions_only
+       << ctx.skip_solutions_that_take_long_time_to_build_and_have_narrow_coverage;
+    return ss.str();
+}
+
+namespace {
+
+// Memoized results of one solver set for one problem, an element is either kUnknown or the
+// result of the check of the same index.
+using ApplicabilityFlags = std::vector<signed char>;
+const signed char kUnknown = -1;
+
+struct ApplicabilityCache
+{
+    // Each entry is a few dozen bytes, the bound only guards processes which see an
+    // unusually large number of distinct problems.
+    static constexpr std::size_t max_entries = 4096;
+
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<ApplicabilityFlags>> entries;
+};
+
+ApplicabilityCache& GetApplicabilityCache()
+{
+    static ApplicabilityCache cache;
+    return cache;
+}
+
+} // namespace
+
+Applicability::Applicability(const std::string& set_id,
+                             const ConvolutionContext& ctx_,
+                             const std::vector<ApplicabilityCheck>& checks_)
+    : ctx(ctx_), checks(checks_)
+{
+    if(miopen::IsDisabled(MIOPEN_DEBUG_APPLICABILITY_CACHE{}))
+    {
+        flags = std::make_shared<ApplicabilityFlags>(checks.size(), kUnknown);
+        return;
+    }
+
+    const auto key = set_id + ' ' + GetApplicabilityKey(ctx);
+    auto& cache    = GetApplicabilityCache();
+    const std::lock_guard<std::mutex> lock(cache.mutex);
+    auto& entry = cache.entries[key];
+    if(entry == nullptr)
+    {
+        if(cache.entries.size() > ApplicabilityCache::max_entries)
+        {
+            MIOPEN_LOG_I2("Applicability cache is full, dropping " << cache.entries.size()
+                                                                  << " entries");
+            cache.entries.clear();
+            flags = std::make_shared<ApplicabilityFlags>(checks.size(), kUnknown);
+            cache.entries.emplace(key, flags);
+            return;
+        }
+        entry = std::make_shared<ApplicabilityFlags>(checks.size(), kUnknown);
+    }
+    flags = entry;
+}
+
+bool Applicability::operator[](std::size_t i) const
+{
+    auto& cache = GetApplicabilityCache();
+    {
+        const std::lock_guard<std::mutex> lock(cache.mutex);
+        if((*flags)[i] != kUnknown)
+            return (*flags)[i] != 0;
+    }
+
+    // IsApplicable() is evaluated on the calling thread, which has the device of the handle
+    // current, and without the lock, so a concurrent miss only duplicates the work.
+    // An exception leaves the flag unknown and reaches the caller which asked for it.
+    const auto is_applicable = checks[i](ctx);
+    const std::lock_guard<std::mutex> lock(cache.mutex);
+    (*flags)[i] = is_applicable ? 1 : 0;
+    return is_applicable;
+}
+
 std::ostream& operator<<(std::ostream& os, const ConvSolution& s)
 {
     auto strings =
@@ -368,6 +471,9 @@ inline SolverRegistrar::SolverRegistrar(IdRegistryData& registry)
                        ++id,
                        ConvAsmImplicitGemmGTCDynamicBwdXdlops{},
                        miopenConvolutionAlgoImplicitGEMM);
+
+    RegisterWithSolver(registry, ++id, ConvOclDirectFwd1x1Dynamic{}, miopenConvolutionAlgoDirect);
+    RegisterWithSolver(registry, ++id, ConvOclDirectFwdDynamic{}, miopenConvolutionAlgoDirect);
 }
 
 } // namespace solver
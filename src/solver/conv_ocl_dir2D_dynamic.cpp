@@ -0,0 +1,259 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/solver.hpp>
+
+#include <miopen/conv/data_invoke_params.hpp>
+#include <miopen/env.hpp>
+#include <miopen/find_controls.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/visit_float.hpp>
+
+#include <climits>
+#include <string>
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_DIRECT_OCL_FWD1X1_DYNAMIC)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_DIRECT_OCL_FWD_DYNAMIC)
+
+namespace miopen {
+namespace solver {
+
+static constexpr int DynamicGroupSize = 64;
+static constexpr int DynamicReadUnit  = 4;
+
+static bool IsApplicableDynamicBase(const ConvolutionContext& params)
+{
+    // The shape-agnostic kernels are slower than the tuned ones, they only pay off when
+    // building the kernels for each new shape is what has to be avoided.
+    if(!params.use_dynamic_solutions_only && !miopen::FindMode(params).IsDynamicHybrid())
+        return false;
+    if(!params.use_opencl_convolutions)
+        return false;
+    if(!params.Is2d())
+        return false;
+    if(!(params.direction.IsForward() || params.direction.IsBackwardData()))
+        return false;
+    if(!(params.IsFp32() || params.IsFp16() || params.IsBfp16()))
+        return false;
+    if(params.IsAsymmetricPadH() || params.IsAsymmetricPadW())
+        return false;
+    // The kernels index with int.
+    const auto in_elements  = static_cast<std::size_t>(params.batch_sz) * params.in_batch_stride;
+    const auto out_elements = static_cast<std::size_t>(params.batch_sz) * params.out_batch_stride;
+    const auto wei_elements = static_cast<std::size_t>(params.n_inputs) * params.n_outputs *
+                              params.kernel_size_h * params.kernel_size_w;
+    return params.group_counts == 1 && params.bias == 0 && params.in_layout == "NCHW" &&
+           in_elements <= INT_MAX && out_elements <= INT_MAX && wei_elements <= INT_MAX;
+}
+
+static int GetDynamicOutMaps(const ConvolutionContext& params)
+{
+    return params.n_outputs >= 32 ? 8 : 4;
+}
+
+/// Only the tile goes into the build options, the rest of the problem is passed at launch.
+static KernelInfo GetDynamicKernel(const ConvolutionContext& params, const std::string& name)
+{
+    const auto out_maps   = GetDynamicOutMaps(params);
+    const auto pix_groups = (params.out_width * params.out_height + DynamicReadUnit - 1) /
+                            DynamicReadUnit;
+    const auto gbl_wk0 = static_cast<std::size_t>(params.batch_sz) * pix_groups;
+
+    KernelInfo kernel;
+    kernel.kernel_file  = "MIOpenConvDirDynamic.cl";
+    kernel.kernel_name  = name;
+    kernel.comp_options = std::string(" -DMLO_GRP_SZ0=") + std::to_string(DynamicGroupSize) +
+                          std::string(" -DMLO_N_LCL_OUT_MAPS=") + std::to_string(out_maps) +
+                          std::string(" -DMLO_READ_UNIT=") + std::to_string(DynamicReadUnit) +
+                          params.general_compile_options;
+    kernel.l_wk = {DynamicGroupSize, 1, 1};
+    kernel.g_wk = {(gbl_wk0 + DynamicGroupSize - 1) / DynamicGroupSize * DynamicGroupSize,
+                   static_cast<std::size_t>((params.n_outputs + out_maps - 1) / out_maps),
+                   1};
+    return kernel;
+}
+
+bool ConvOclDirectFwd1x1Dynamic::IsApplicable(const ConvolutionContext& params) const
+{
+    if(miopen::IsDisabled(MIOPEN_DEBUG_CONV_DIRECT_OCL_FWD1X1_DYNAMIC{}))
+        return false;
+    if(!IsApplicableDynamicBase(params))
+        return false;
+    // Backward data with a stride would scatter, leaving the gaps of dx unwritten.
+    const auto strided = params.kernel_stride_w != 1 || params.kernel_stride_h != 1;
+    return params.kernel_size_w == 1 && params.kernel_size_h == 1 && params.pad_w == 0 &&
+           params.pad_h == 0 && params.kernel_dilation_w == 1 && params.kernel_dilation_h == 1 &&
+           (params.direction.IsForward() || !strided);
+}
+
+ConvSolution ConvOclDirectFwd1x1Dynamic::GetSolution(const ConvolutionContext& params) const
+{
+    ConvSolution result;
+    result.construction_params.push_back(GetDynamicKernel(params, "MIOpenConv1x1Dyn"));
+
+    const auto is_forward = params.direction.IsForward();
+    // KCHW weights: forward reads w[o][i], backward data reads w[i][o].
+    const int wei_out_stride = is_forward ? params.n_inputs : 1;
+    const int wei_in_stride  = is_forward ? 1 : params.n_outputs;
+
+    const int batch              = params.batch_sz;
+    const int n_inputs           = params.n_inputs;
+    const int n_outputs          = params.n_outputs;
+    const int in_stride          = params.in_stride;
+    const int in_channel_stride  = params.in_channel_stride;
+    const int in_batch_stride    = params.in_batch_stride;
+    const int out_width          = params.out_width;
+    const int out_height         = params.out_height;
+    const int out_stride         = params.out_stride;
+    const int out_channel_stride = params.out_channel_stride;
+    const int out_batch_stride   = params.out_batch_stride;
+    const int stride_w           = params.kernel_stride_w;
+    const int stride_h           = params.kernel_stride_h;
+
+    result.invoker_factory = [=](const std::vector<Kernel>& kernels) {
+        const auto kernel = kernels[0];
+        return [=](const Handle& handle, const AnyInvokeParams& primitive_params) {
+            const auto& tensors = primitive_params.CastTo<conv::DataInvokeParams>().tensors;
+            visit_float(tensors.inDesc.GetType(), [&](auto as_float) {
+                handle.Run(kernel)(tensors.in,
+                                   tensors.w,
+                                   tensors.out,
+                                   as_float(0.0f),
+                                   batch,
+                                   n_inputs,
+                                   n_outputs,
+                                   in_stride,
+                                   in_channel_stride,
+                                   in_batch_stride,
+                                   out_width,
+                                   out_height,
+                                   out_stride,
+                                   out_channel_stride,
+                                   out_batch_stride,
+                                   stride_w,
+                                   stride_h,
+                                   wei_out_stride,
+                                   wei_in_stride);
+            });
+        };
+    };
+    return result;
+}
+
+bool ConvOclDirectFwdDynamic::IsApplicable(const ConvolutionContext& params) const
+{
+    if(miopen::IsDisabled(MIOPEN_DEBUG_CONV_DIRECT_OCL_FWD_DYNAMIC{}))
+        return false;
+    if(!IsApplicableDynamicBase(params))
+        return false;
+    // Backward data is computed as a forward convolution with the flipped filter,
+    // which holds for unit strides only.
+    return params.direction.IsForward() ||
+           (params.kernel_stride_w == 1 && params.kernel_stride_h == 1);
+}
+
+ConvSolution ConvOclDirectFwdDynamic::GetSolution(const ConvolutionContext& params) const
+{
+    ConvSolution result;
+    result.construction_params.push_back(GetDynamicKernel(params, "MIOpenConvDirDyn"));
+
+    const auto is_forward  = params.direction.IsForward();
+    const auto filter_size = params.kernel_size_w * params.kernel_size_h;
+    // KCHW weights: forward reads w[o][i], backward data reads w[i][o] flipped.
+    const int wei_out_stride = is_forward ? params.n_inputs * filter_size : filter_size;
+    const int wei_in_stride  = is_forward ? filter_size : params.n_outputs * filter_size;
+    const int flip           = is_forward ? 0 : 1;
+    int pad_w                = params.pad_w;
+    int pad_h                = params.pad_h;
+    if(!is_forward)
+    {
+        // The flipped filter needs the complementary padding.
+        pad_w = (params.kernel_size_w - 1) * params.kernel_dilation_w - pad_w;
+        pad_h = (params.kernel_size_h - 1) * params.kernel_dilation_h - pad_h;
+    }
+
+    const int batch              = params.batch_sz;
+    const int n_inputs           = params.n_inputs;
+    const int n_outputs          = params.n_outputs;
+    const int in_width           = params.in_width;
+    const int in_height          = params.in_height;
+    const int in_stride          = params.in_stride;
+    const int in_channel_stride  = params.in_channel_stride;
+    const int in_batch_stride    = params.in_batch_stride;
+    const int out_width          = params.out_width;
+    const int out_height         = params.out_height;
+    const int out_stride         = params.out_stride;
+    const int out_channel_stride = params.out_channel_stride;
+    const int out_batch_stride   = params.out_batch_stride;
+    const int filter_w           = params.kernel_size_w;
+    const int filter_h           = params.kernel_size_h;
+    const int stride_w           = params.kernel_stride_w;
+    const int stride_h           = params.kernel_stride_h;
+    const int dilation_w         = params.kernel_dilation_w;
+    const int dilation_h         = params.kernel_dilation_h;
+
+    result.invoker_factory = [=](const std::vector<Kernel>& kernels) {
+        const auto kernel = kernels[0];
+        return [=](const Handle& handle, const AnyInvokeParams& primitive_params) {
+            const auto& tensors = primitive_params.CastTo<conv::DataInvokeParams>().tensors;
+            visit_float(tensors.inDesc.GetType(), [&](auto as_float) {
+                handle.Run(kernel)(tensors.in,
+                                   tensors.w,
+                                   tensors.out,
+                                   as_float(0.0f),
+                                   batch,
+                                   n_inputs,
+                                   n_outputs,
+                                   in_width,
+                                   in_height,
+                                   in_stride,
+                                   in_channel_stride,
+                                   in_batch_stride,
+                                   out_width,
+                                   out_height,
+                                   out_stride,
+                                   out_channel_stride,
+                                   out_batch_stride,
+                                   filter_w,
+                                   filter_h,
+                                   stride_w,
+                                   stride_h,
+                                   pad_w,
+                                   pad_h,
+                                   dilation_w,
+                                   dilation_h,
+                                   wei_out_stride,
+                                   wei_in_stride,
+                                   flip);
+            });
+        };
+    };
+    return result;
+}
+
+} // namespace solver
+} // namespace miopen
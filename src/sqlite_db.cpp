@@ -25,6 +25,7 @@
  *******************************************************************************/
 #include <miopen/sqlite_db.hpp>
 #include <miopen/db_record.hpp>
+#include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
@@ -51,6 +52,10 @@
 #include <shared_mutex>
 #include <string>
 
+/// Opt-in write-ahead-log journal for the user perf db. Readers do not block the writer and
+/// commits do not wait for a disk sync, which helps when several tuning processes share the db.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_PERFDB_SQLITE_WAL)
+
 extern "C" {
 int miopen_sqlite3_memvfs_init(sqlite3* db, char** pzErrMsg, const sqlite3_api_routines* pApi);
 }
@@ -350,6 +355,16 @@ SQLitePerfDb::SQLitePerfDb(const std::string& filename_,
             MIOPEN_LOG_I(filename + " database invalid");
         return;
     }
+    if(!is_system && !InMemDb && miopen::IsEnabled(MIOPEN_DEBUG_PERFDB_SQLITE_WAL{}))
+    {
+        // The journal mode is stored in the file, the other connections pick it up.
+        const auto res  = sql.Exec("PRAGMA journal_mode=WAL;");
+        const auto mode = res.empty() ? std::string{} : res.front().begin()->second;
+        if(mode == "wal")
+            sql.Exec("PRAGMA synchronous=NORMAL;");
+        else
+            MIOPEN_LOG_W("Unable to enable WAL journal for " << filename << ", mode: " << mode);
+    }
     ProblemDescription prob_desc{conv::Direction::Forward};
     prob_desc.in_data_type      = miopenFloat;
     prob_desc.out_data_type     = miopenFloat;
@@ -421,4 +436,66 @@ SQLitePerfDb::SQLitePerfDb(const std::string& filename_,
         }
     }
 }
+
+void SQLitePerfDb::BeginBatch()
+{
+    if(batch_depth == 0)
+    {
+        batch_rollback = false;
+        // Take the write lock upfront, upgrading a read transaction later may deadlock.
+        if(!dbInvalid)
+            sql.Exec("BEGIN IMMEDIATE;");
+    }
+    ++batch_depth;
+}
+
+bool SQLitePerfDb::EndBatch(bool commit)
+{
+    assert(batch_depth > 0);
+    if(!commit)
+        batch_rollback = true;
+    if(--batch_depth > 0 || dbInvalid)
+        return !batch_rollback;
+
+    if(batch_rollback)
+    {
+        MIOPEN_LOG_I2("Rolling back write batch to " << filename);
+        sql.Exec("ROLLBACK;");
+        return false;
+    }
+
+    try
+    {
+        sql.Exec("COMMIT;");
+    }
+    catch(const Exception&)
+    {
+        sql.Exec("ROLLBACK;");
+        throw;
+    }
+    return true;
+}
+
+SQLitePerfDb::WriteBatch::~WriteBatch()
+{
+    if(db == nullptr)
+        return;
+    try
+    {
+        db->EndBatch(false);
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_E("Unable to roll back write batch: " << ex.what());
+    }
+}
+
+bool SQLitePerfDb::WriteBatch::Commit()
+{
+    if(db == nullptr)
+        return false;
+    const auto batch_db = db;
+    db                  = nullptr;
+    return batch_db->EndBatch(true);
+}
 } // namespace miopen
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include <miopen/tmp_dir.hpp>
+#include <miopen/compiler_server.hpp>
 #include <miopen/env.hpp>
 #include <boost/filesystem.hpp>
 #include <miopen/errors.hpp>
@@ -43,7 +44,10 @@ void SystemCmd(std::string cmd)
 #ifdef MIOPEN_USE_CLANG_TIDY
     (void)cmd;
 #else
-    if(std::system(cmd.c_str()) != 0)
+    auto rc = 0;
+    if(!CompilerServer::Instance().Run(cmd, rc))
+        rc = std::system(cmd.c_str());
+    if(rc != 0)
         MIOPEN_THROW("Can't execute " + cmd);
 #endif
 }
@@ -0,0 +1,283 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/trace.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <unistd.h>
+
+/// Collects latency statistics of the spans, prints them at exit.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_TRACE)
+/// Path of the Chrome trace written at exit, enables MIOPEN_TRACE.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_TRACE_FILE)
+
+namespace miopen {
+namespace trace {
+
+namespace {
+
+bool IsTraceFileSet()
+{
+    const auto path = GetStringEnv(MIOPEN_TRACE_FILE{});
+    return path != nullptr && *path != '\0';
+}
+
+// Timestamps of the trace are relative to the load of the library.
+const Clock::time_point origin = Clock::now();
+
+// Bounds the memory of long-running processes, about 40 MB of events.
+constexpr std::size_t max_events = std::size_t{1} << 20;
+
+struct Event
+{
+    const char* name;
+    const char* category;
+    int tid;
+    Clock::duration start;
+    Clock::duration duration;
+};
+
+struct Stats
+{
+    const char* category = nullptr;
+    std::size_t count    = 0;
+    Clock::duration total{};
+    Clock::duration min = Clock::duration::max();
+    Clock::duration max{};
+    std::array<std::size_t, SpanStats::buckets_count> buckets{};
+};
+
+int ThreadId()
+{
+    static std::atomic<int> next{0};
+    static thread_local const int id = next++;
+    return id;
+}
+
+std::size_t Bucket(Clock::duration d)
+{
+    auto ns     = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    auto bucket = std::size_t{0};
+    while(ns > 1 && bucket + 1 < SpanStats::buckets_count)
+    {
+        ns /= 2;
+        ++bucket;
+    }
+    return bucket;
+}
+
+double ToUs(Clock::duration d) { return std::chrono::duration<double, std::micro>(d).count(); }
+
+void JsonString(std::ostream& os, const char* str)
+{
+    os << '"';
+    for(; *str != '\0'; ++str)
+    {
+        if(*str == '"' || *str == '\\')
+            os << '\\' << *str;
+        else if(static_cast<unsigned char>(*str) < 0x20)
+            os << ' ';
+        else
+            os << *str;
+    }
+    os << '"';
+}
+
+class Registry
+{
+    public:
+    static Registry& Instance()
+    {
+        // Never destroyed, spans may end in static destructors of other objects.
+        static auto& instance = *new Registry{};
+        return instance;
+    }
+
+    void Add(const char* name, const char* category, Clock::time_point start, Clock::time_point end)
+    {
+        const auto duration = end - start;
+        const auto tid      = ThreadId();
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto& stats    = spans[name];
+        stats.category = category;
+        ++stats.count;
+        stats.total += duration;
+        stats.min = std::min(stats.min, duration);
+        stats.max = std::max(stats.max, duration);
+        ++stats.buckets[Bucket(duration)];
+
+        if(!trace_path.empty())
+        {
+            if(events.size() < max_events)
+                events.push_back({name, category, tid, start - origin, duration});
+            else
+                ++dropped_events;
+        }
+    }
+
+    std::vector<SpanStats> GetStats() const
+    {
+        // Different pointers may refer to equal names, e.g. the same literal in two libraries.
+        std::map<std::string, SpanStats> by_name;
+        std::lock_guard<std::mutex> lock(mutex);
+        for(const auto& span : spans)
+        {
+            auto& result    = by_name[span.first];
+            const auto& src = span.second;
+            const auto min  = ToUs(src.min);
+            result.min_us   = result.count == 0 ? min : std::min(result.min_us, min);
+            result.name     = span.first;
+            result.category = src.category;
+            result.count += src.count;
+            result.total_us += ToUs(src.total);
+            result.max_us = std::max(result.max_us, ToUs(src.max));
+            for(auto i = std::size_t{0}; i < src.buckets.size(); ++i)
+                result.buckets[i] += src.buckets[i];
+        }
+
+        std::vector<SpanStats> result;
+        result.reserve(by_name.size());
+        for(auto& span : by_name)
+            result.push_back(std::move(span.second));
+        return result;
+    }
+
+    bool WriteChromeTrace(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if(!file)
+            return false;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto pid = ::getpid();
+        file << "{\"traceEvents\":[";
+        file << std::fixed << std::setprecision(3);
+        for(auto i = std::size_t{0}; i < events.size(); ++i)
+        {
+            const auto& event = events[i];
+            file << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+            JsonString(file, event.name);
+            file << ",\"cat\":";
+            JsonString(file, event.category);
+            file << ",\"ph\":\"X\",\"ts\":" << ToUs(event.start)
+                 << ",\"dur\":" << ToUs(event.duration) << ",\"pid\":" << pid
+                 << ",\"tid\":" << event.tid << '}';
+        }
+        file << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":"
+             << dropped_events << "}}\n";
+        return static_cast<bool>(file);
+    }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        spans.clear();
+        events.clear();
+        dropped_events = 0;
+    }
+
+    private:
+    // The statics of the logging may be destroyed by the time Flush() runs, so the prefix is
+    // taken now. The asynchronous writer is started before the exit handler is registered, so
+    // it only stops after the handler.
+    Registry() : prefix(LoggingPrefix())
+    {
+        if(IsTraceFileSet())
+            trace_path = GetStringEnv(MIOPEN_TRACE_FILE{});
+        logger::StartSink();
+        std::atexit([]() { Instance().Flush(); });
+    }
+
+    void Flush() const
+    {
+        const auto stats = GetStats();
+        for(const auto& span : stats)
+        {
+            std::ostringstream ss;
+            ss << prefix << "Trace [" << span.category << "] " << span.name << ": "
+               << span.count << " calls, total " << span.total_us / 1000 << " ms, mean "
+               << span.total_us / span.count << " us, p50 <" << span.QuantileUs(0.5)
+               << " us, p99 <" << span.QuantileUs(0.99) << " us, max " << span.max_us << " us\n";
+            logger::WriteMessage(ss.str());
+        }
+
+        if(!trace_path.empty() && !WriteChromeTrace(trace_path))
+            logger::WriteMessage(prefix + "Unable to write trace file " + trace_path + '\n');
+    }
+
+    mutable std::mutex mutex;
+    std::unordered_map<const char*, Stats> spans;
+    std::vector<Event> events;
+    std::size_t dropped_events = 0;
+    std::string trace_path;
+    const std::string prefix;
+};
+
+} // namespace
+
+bool IsEnabledImpl() { return miopen::IsEnabled(MIOPEN_TRACE{}) || IsTraceFileSet(); }
+
+void Record(const char* name, const char* category, Clock::time_point start, Clock::time_point end)
+{
+    Registry::Instance().Add(name, category, start, end);
+}
+
+double SpanStats::QuantileUs(double q) const
+{
+    const auto target = static_cast<std::size_t>(std::ceil(q * count));
+    auto seen         = std::size_t{0};
+    for(auto i = std::size_t{0}; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if(seen >= target && seen > 0)
+            return std::ldexp(1.0, static_cast<int>(i) + 1) / 1000;
+    }
+    return max_us;
+}
+
+std::vector<SpanStats> GetStats() { return Registry::Instance().GetStats(); }
+
+bool WriteChromeTrace(const std::string& path)
+{
+    return Registry::Instance().WriteChromeTrace(path);
+}
+
+void Reset() { Registry::Instance().Reset(); }
+
+} // namespace trace
+} // namespace miopen
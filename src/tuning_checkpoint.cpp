@@ -0,0 +1,420 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/tuning_checkpoint.hpp>
+
+#include <miopen/db_path.hpp>
+#include <miopen/env.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_TUNING_CHECKPOINT)
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+const char* const file_signature = "MIOpenTuningCheckpoint 1";
+
+boost::filesystem::path GetDefaultDirectory()
+{
+    const auto& udb = GetUserDbPath();
+    if(udb.empty())
+        return {};
+    return boost::filesystem::path(udb) / "tuning";
+}
+
+char EncodeStatus(const SearchOutcome& outcome)
+{
+    return outcome.failed ? 'F' : outcome.candidate ? 'C' : 'M';
+}
+
+bool DecodeStatus(char status, SearchOutcome& outcome)
+{
+    outcome.failed    = status == 'F';
+    outcome.candidate = status == 'C';
+    return status == 'F' || status == 'C' || status == 'M';
+}
+
+} // namespace
+
+TuningCheckpoint::TuningCheckpoint(const std::string& key_, const std::string& path_)
+    : key(key_), path(path_)
+{
+    if(path.empty())
+        return;
+    Read();
+    loaded = entries.size();
+    if(loaded != 0)
+        MIOPEN_LOG_I("Loaded " << loaded << " results from " << path);
+}
+
+std::string TuningCheckpoint::GetDefaultPath(const std::string& key)
+{
+    const auto directory = GetDefaultDirectory();
+    if(directory.empty() || miopen::IsDisabled(MIOPEN_DEBUG_TUNING_CHECKPOINT{}))
+        return {};
+    return (directory / (md5(key) + ".txt")).string();
+}
+
+void TuningCheckpoint::Read()
+{
+    std::ifstream in(path);
+    if(!in)
+        return;
+
+    std::string line;
+    if(!std::getline(in, line) || line != file_signature)
+        return;
+    if(!std::getline(in, line) || line != key)
+    {
+        MIOPEN_LOG_I("Ignoring " << path << " saved by another search: " << line);
+        return;
+    }
+
+    // A line without the end of line has been interrupted while written and is not used.
+    while(std::getline(in, line) && !in.eof())
+    {
+        std::istringstream ss(line);
+        auto entry  = Entry{};
+        char status = 0;
+        if(!(ss >> status >> entry.outcome.time) || ss.get() != ' ' ||
+           !std::getline(ss, entry.config) || !DecodeStatus(status, entry.outcome))
+        {
+            MIOPEN_LOG_W("Ill-formed line in " << path << ": " << line);
+            break;
+        }
+        entries.push_back(entry);
+    }
+}
+
+bool TuningCheckpoint::Load(std::size_t n, const std::string& config, SearchOutcome& outcome)
+{
+    if(n >= entries.size())
+        return false;
+    if(entries[n].config != config)
+    {
+        MIOPEN_LOG_W("Search space differs from " << path << " at #" << n
+                                                  << ", resuming from there");
+        entries.resize(n);
+        synced = false;
+        return false;
+    }
+    outcome = entries[n].outcome;
+    return true;
+}
+
+void TuningCheckpoint::Save(std::size_t n, const std::string& config, const SearchOutcome& outcome)
+{
+    if(path.empty())
+        return;
+
+    if(n != entries.size())
+    {
+        entries.resize(n);
+        synced = false;
+    }
+    entries.push_back({config, outcome});
+
+    if(synced)
+        Write(entries.back());
+    else
+        Rewrite();
+}
+
+void TuningCheckpoint::Rewrite()
+{
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(boost::filesystem::path(path).parent_path(), ec);
+
+    file.close();
+    file.open(path, std::ios::out | std::ios::trunc);
+    if(!file)
+    {
+        MIOPEN_LOG_W("Unable to write the tuning checkpoint: " << path);
+        path.clear();
+        return;
+    }
+
+    file << file_signature << '\n' << key << '\n';
+    // Times are saved with all the digits, so that a resumed search compares the same values.
+    file << std::setprecision(std::numeric_limits<float>::max_digits10);
+    for(const auto& entry : entries)
+        Write(entry);
+    synced = true;
+}
+
+void TuningCheckpoint::Write(const Entry& entry)
+{
+    file << EncodeStatus(entry.outcome) << ' ' << entry.outcome.time << ' ' << entry.config
+         << std::endl;
+}
+
+void TuningCheckpoint::Remove()
+{
+    if(path.empty())
+        return;
+    file.close();
+    boost::system::error_code ec;
+    boost::filesystem::remove(path, ec);
+}
+
+void TuningCheckpoint::Append(const TuningCheckpoint& other)
+{
+    entries.insert(entries.end(), other.entries.begin(), other.entries.end());
+    loaded += other.entries.size();
+    synced = false;
+}
+
+TuningShards::TuningShards(const std::string& key_, std::size_t n_total_, std::size_t shard_size_)
+    : TuningShards(key_,
+                   shard_size_ != 0 ? GetDefaultDirectory().string() : std::string{},
+                   n_total_,
+                   shard_size_)
+{
+}
+
+TuningShards::TuningShards(const std::string& key_,
+                           const std::string& directory_,
+                           std::size_t n_total_,
+                           std::size_t shard_size_)
+    : key(key_),
+      directory(directory_),
+      n_total(n_total_),
+      shard_size(std::max<std::size_t>(shard_size_, 1))
+{
+    if(directory.empty())
+        return;
+
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(directory, ec);
+    n_shards = (n_total + shard_size - 1) / shard_size;
+    completed.resize(n_shards, false);
+
+    // Held shared by every process taking part in the search, for the last one to clean up.
+    const auto participants_path = boost::filesystem::path(directory) / (md5(key) + ".shards");
+    participants                 = &LockFile::Get(LockFilePath(participants_path).c_str());
+    participants->lock_shared();
+    MIOPEN_LOG_I("Searching " << n_total << " configs in " << n_shards << " shards: " << key);
+}
+
+TuningShards::~TuningShards()
+{
+    if(participants == nullptr)
+        return;
+
+    try
+    {
+        if(checkpoint)
+        {
+            checkpoint.reset();
+            lock->unlock();
+        }
+        participants->unlock_shared();
+
+        // Files of an interrupted search are kept to resume it.
+        if(!IsDone() || !participants->try_lock())
+            return;
+        boost::system::error_code ec;
+        for(std::size_t shard = 0; shard < n_shards; ++shard)
+        {
+            boost::filesystem::remove(GetPath(shard), ec);
+            boost::filesystem::remove(GetTakeOverPath(shard), ec);
+            boost::filesystem::remove(GetDonePath(shard), ec);
+        }
+        participants->unlock();
+    }
+    catch(...)
+    {
+        MIOPEN_LOG_W("Unable to clean up the tuning shards of " << key);
+    }
+}
+
+std::string TuningShards::GetKey(std::size_t shard) const
+{
+    return key + " shard " + std::to_string(shard) + "/" + std::to_string(n_shards);
+}
+
+std::string TuningShards::GetPath(std::size_t shard) const
+{
+    const auto name = md5(key) + "." + std::to_string(shard) + ".txt";
+    return (boost::filesystem::path(directory) / name).string();
+}
+
+std::string TuningShards::GetTakeOverPath(std::size_t shard) const
+{
+    const auto name = md5(key) + "." + std::to_string(shard) + ".takeover.txt";
+    return (boost::filesystem::path(directory) / name).string();
+}
+
+std::string TuningShards::GetDonePath(std::size_t shard) const { return GetPath(shard) + ".done"; }
+
+LockFile& TuningShards::GetLock(std::size_t shard) const
+{
+    return LockFile::Get(LockFilePath(GetPath(shard)).c_str());
+}
+
+LockFile& TuningShards::GetTakeOverLock(std::size_t shard) const
+{
+    return LockFile::Get(LockFilePath(GetPath(shard) + ".takeover").c_str());
+}
+
+bool TuningShards::IsDone(std::size_t shard) const
+{
+    return completed[shard] || boost::filesystem::exists(GetDonePath(shard));
+}
+
+bool TuningShards::IsDone() const
+{
+    for(std::size_t shard = 0; shard < n_shards; ++shard)
+        if(!IsDone(shard))
+            return false;
+    return true;
+}
+
+std::size_t TuningShards::GetEnd() const
+{
+    return std::min(n_total, (claimed + 1) * shard_size);
+}
+
+bool TuningShards::Claim()
+{
+    assert(!checkpoint);
+    for(std::size_t shard = 0; shard < n_shards; ++shard)
+    {
+        if(IsDone(shard))
+            continue;
+        if(!Claim(shard, GetLock(shard), GetPath(shard)))
+            continue;
+        MIOPEN_LOG_I("Claimed shard " << shard << '/' << n_shards << " of " << key);
+        return true;
+    }
+    return false;
+}
+
+bool TuningShards::TakeOver()
+{
+    assert(!checkpoint);
+    for(std::size_t shard = 0; shard < n_shards; ++shard)
+    {
+        // Held by the process which has taken the shard over, so that there is only one. The
+        // owner may still be alive and writing its file, so the outcomes go to another one.
+        if(IsDone(shard) || !Claim(shard, GetTakeOverLock(shard), GetTakeOverPath(shard)))
+            continue;
+        // Resumes from the outcomes the owner has saved so far.
+        if(checkpoint->GetLoadedCount() == 0)
+            checkpoint->Append(TuningCheckpoint{GetKey(shard), GetPath(shard)});
+        MIOPEN_LOG_W("Took over shard " << shard << '/' << n_shards << " of " << key);
+        return true;
+    }
+    return false;
+}
+
+bool TuningShards::Claim(std::size_t shard, LockFile& shard_lock, const std::string& path)
+{
+    if(!shard_lock.try_lock())
+        return false;
+    // Might have been completed before it has been locked.
+    if(IsDone(shard))
+    {
+        shard_lock.unlock();
+        return false;
+    }
+    claimed    = shard;
+    lock       = &shard_lock;
+    checkpoint = std::make_unique<TuningCheckpoint>(GetKey(shard), path);
+    progress_stamp.clear();
+    return true;
+}
+
+void TuningShards::Complete()
+{
+    assert(checkpoint);
+    checkpoint.reset();
+    // Otherwise this process would claim the shard again and again if the marker can not be
+    // written.
+    completed[claimed] = true;
+    if(!std::ofstream{GetDonePath(claimed)})
+        MIOPEN_LOG_E("Unable to mark the tuning shard as done: " << GetDonePath(claimed));
+    lock->unlock();
+}
+
+bool TuningShards::IsStalled(std::chrono::seconds timeout)
+{
+    // Progress of the other processes shows up as new markers or as their checkpoints growing.
+    std::ostringstream stamp;
+    for(std::size_t shard = 0; shard < n_shards; ++shard)
+    {
+        stamp << IsDone(shard);
+        for(const auto& path : {GetPath(shard), GetTakeOverPath(shard)})
+        {
+            boost::system::error_code ec;
+            stamp << ' ' << boost::filesystem::file_size(path, ec) << ' '
+                  << boost::filesystem::last_write_time(path, ec);
+        }
+        stamp << ';';
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if(stamp.str() != progress_stamp)
+    {
+        progress_stamp = stamp.str();
+        progress_time  = now;
+        return false;
+    }
+    return now - progress_time > timeout;
+}
+
+void TuningShards::Merge(TuningCheckpoint& merged) const
+{
+    for(std::size_t shard = 0; shard < n_shards; ++shard)
+    {
+        // Outcomes are looked up by their position, so the ones after a gap can not be used.
+        const auto size = std::min(n_total, (shard + 1) * shard_size) - shard * shard_size;
+        // The owner and the process which has taken it over write copies of the shard, one of
+        // them is used as a whole.
+        const TuningCheckpoint owned{GetKey(shard), GetPath(shard)};
+        const TuningCheckpoint taken_over{GetKey(shard), GetTakeOverPath(shard)};
+        const auto& outcomes =
+            owned.GetLoadedCount() >= taken_over.GetLoadedCount() ? owned : taken_over;
+        merged.Append(outcomes);
+        if(!IsDone(shard) || outcomes.GetLoadedCount() != size)
+            break;
+    }
+}
+
+} // namespace solver
+} // namespace miopen
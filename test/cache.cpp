@@ -145,10 +145,20 @@ void check_cache_str()
     CHECK(p.filename().string() == name + ".o");
 }
 
+// Equivalent options of different solvers share the cached binary.
+void check_cache_equivalent_args()
+{
+    const auto p = miopen::GetCacheFile("gfx", "base", "-DB=2 -DA=1 -cl-std=CL2.0", false);
+    CHECK(p == miopen::GetCacheFile("gfx", "base", " -cl-std=CL2.0  -D A=1 -DB=2", false));
+    CHECK(p == miopen::GetCacheFile("gfx", "base", "-DA=0 -cl-std=CL2.0 -DB=2 -DA=1", false));
+    CHECK(p != miopen::GetCacheFile("gfx", "base", "-DA=2 -DB=2 -cl-std=CL2.0", false));
+}
+
 int main()
 {
     check_cache_file();
     check_cache_str();
+    check_cache_equivalent_args();
 #if MIOPEN_ENABLE_SQLITE
     check_bz2_compress();
     check_bz2_decompress();
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/compile_queue.hpp>
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+void check_jobs_are_executed()
+{
+    miopen::CompileQueue queue(4);
+    std::atomic<int> done{0};
+
+    for(auto i = 0; i < 16; ++i)
+        CHECK(queue.Enqueue({"config", std::to_string(i)}, [&]() { ++done; }));
+
+    queue.WaitAll();
+    EXPECT(done == 16);
+}
+
+void check_duplicates_are_ignored()
+{
+    miopen::CompileQueue queue(1);
+    std::atomic<bool> release{false};
+    std::atomic<int> done{0};
+    const auto key = miopen::CompileQueue::Key{"config", "solver"};
+
+    CHECK(queue.Enqueue(key, [&]() {
+        while(!release)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++done;
+    }));
+    EXPECT(queue.IsPending(key));
+    EXPECT(!queue.Enqueue(key, [&]() { ++done; }));
+
+    release = true;
+    queue.Wait(key);
+    EXPECT(!queue.IsPending(key));
+    EXPECT(done == 1);
+
+    // Finished jobs can be queued again.
+    EXPECT(queue.Enqueue(key, [&]() { ++done; }));
+    queue.Wait(key);
+    EXPECT(done == 2);
+}
+
+void check_failures_are_reported()
+{
+    miopen::CompileQueue queue(2);
+    const auto key = miopen::CompileQueue::Key{"config", "failing"};
+
+    CHECK(queue.Enqueue(key, []() { throw std::runtime_error("build error"); }));
+    queue.Wait(key);
+    EXPECT(queue.HasFailed(key));
+    EXPECT(!queue.HasFailed({"config", "other"}));
+
+    CHECK(queue.Enqueue(key, []() {}));
+    queue.Wait(key);
+    EXPECT(!queue.HasFailed(key));
+}
+
+void check_destructor_completes_jobs()
+{
+    std::atomic<int> done{0};
+    {
+        miopen::CompileQueue queue(2);
+        for(auto i = 0; i < 8; ++i)
+            queue.Enqueue({"config", std::to_string(i)}, [&]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                ++done;
+            });
+    }
+    EXPECT(done == 8);
+}
+
+int main()
+{
+    check_jobs_are_executed();
+    check_duplicates_are_ignored();
+    check_failures_are_reported();
+    check_destructor_completes_jobs();
+}
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/compiler_server.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include "test.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+// A mock of the offline compiler: copies the source to the output, fails on the "fail" source.
+static std::string WriteMockCompiler(const miopen::TmpDir& dir)
+{
+    const auto path = dir.path / "mock-cc";
+    std::ofstream(path.string()) << "#!/bin/sh\n"
+                                    "[ \"$1\" = fail ] && exit 3\n"
+                                    "cp \"$1\" \"$2\"\n";
+    boost::filesystem::permissions(path, boost::filesystem::owner_all);
+    return path.string();
+}
+
+static std::string Job(const miopen::TmpDir& dir, const std::string& cc, int n)
+{
+    const auto src = "src" + std::to_string(n) + ".s";
+    const auto obj = "obj" + std::to_string(n) + ".o";
+    return "cd " + dir.path.string() + "; echo 'kernel " + std::to_string(n) + "' > " + src +
+           "; " + cc + " " + src + " " + obj;
+}
+
+void check_jobs()
+{
+    miopen::TmpDir dir{"compiler-server"};
+    const auto cc = WriteMockCompiler(dir);
+    miopen::CompilerServer server;
+
+    auto rc = -1;
+    EXPECT(server.Run(Job(dir, cc, 0), rc));
+    EXPECT(rc == 0);
+    EXPECT(boost::filesystem::exists(dir.path / "obj0.o"));
+
+    // Failures and ill-formed commands are reported and do not break the server.
+    EXPECT(server.Run(cc + " fail out.o", rc));
+    EXPECT(rc == 3);
+    EXPECT(server.Run("echo 'unterminated", rc));
+    EXPECT(rc != 0);
+    EXPECT(server.Run("exit 5", rc));
+    EXPECT(rc == 5);
+    EXPECT(server.Run("true", rc));
+    EXPECT(rc == 0);
+    EXPECT(server.JobsDone() == 5);
+
+    std::vector<std::thread> threads;
+    for(auto t = 1; t <= 4; ++t)
+        threads.emplace_back([&, t]() {
+            auto thread_rc = -1;
+            EXPECT(server.Run(Job(dir, cc, t), thread_rc));
+            EXPECT(thread_rc == 0);
+        });
+    for(auto& thread : threads)
+        thread.join();
+    for(auto t = 1; t <= 4; ++t)
+        EXPECT(boost::filesystem::exists(dir.path / ("obj" + std::to_string(t) + ".o")));
+}
+
+void check_fallback()
+{
+    miopen::CompilerServer missing{"/nonexistent/sh"};
+    auto rc = 0;
+    EXPECT(!missing.Run("true", rc));
+    EXPECT(!missing.IsAvailable());
+
+    miopen::CompilerServer disabled{""};
+    EXPECT(!disabled.Run("true", rc));
+}
+
+void check_throughput()
+{
+    miopen::TmpDir dir{"compiler-server"};
+    const auto cc  = WriteMockCompiler(dir);
+    const auto n   = 64;
+    using clock    = std::chrono::steady_clock;
+    using duration = std::chrono::duration<double>;
+
+    miopen::CompilerServer server;
+    auto rc          = 0;
+    const auto start = clock::now();
+    for(auto i = 0; i < n; ++i)
+    {
+        EXPECT(server.Run(Job(dir, cc, i), rc));
+        EXPECT(rc == 0);
+    }
+    const auto server_time = duration(clock::now() - start).count();
+
+    const auto spawn_start = clock::now();
+    for(auto i = 0; i < n; ++i)
+        EXPECT(std::system(Job(dir, cc, i).c_str()) == 0);
+    const auto spawn_time = duration(clock::now() - spawn_start).count();
+
+    std::cout << "Compiler server: " << n / server_time << " jobs/s, spawn per job: "
+              << n / spawn_time << " jobs/s" << std::endl;
+}
+#endif
+
+int main()
+{
+#ifdef __linux__
+    check_jobs();
+    check_fallback();
+    check_throughput();
+#endif
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/convolution.hpp>
+#include <miopen/db_cache.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/tensor.hpp>
+
+#include "get_handle.hpp"
+#include "test.hpp"
+
+#include <cstddef>
+#include <vector>
+
+struct conv_problems
+{
+    std::vector<miopen::TensorDescriptor> x;
+    std::vector<miopen::TensorDescriptor> w;
+    std::vector<miopen::TensorDescriptor> y;
+    std::vector<miopen::ConvolutionDescriptor> conv;
+    std::vector<miopenConvDirection_t> dirs;
+
+    void add(const std::vector<int>& in, const std::vector<int>& wei, miopenConvDirection_t dir)
+    {
+        x.emplace_back(miopenFloat, in);
+        w.emplace_back(miopenFloat, wei);
+        conv.push_back(miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}});
+        y.push_back(conv.back().GetForwardOutputTensor(x.back(), w.back()));
+        dirs.push_back(dir);
+    }
+
+    miopenStatus_t prefetch() const
+    {
+        std::vector<miopenTensorDescriptor_t> xs, ws, ys;
+        std::vector<miopenConvolutionDescriptor_t> convs;
+        for(std::size_t i = 0; i < x.size(); ++i)
+        {
+            xs.push_back(const_cast<miopen::TensorDescriptor*>(&x[i]));
+            ws.push_back(const_cast<miopen::TensorDescriptor*>(&w[i]));
+            ys.push_back(const_cast<miopen::TensorDescriptor*>(&y[i]));
+            convs.push_back(const_cast<miopen::ConvolutionDescriptor*>(&conv[i]));
+        }
+        return miopenConvolutionPrefetchDbRecords(
+            &get_handle(), x.size(), xs.data(), ws.data(), convs.data(), ys.data(), dirs.data());
+    }
+
+    miopen::ConvolutionContext context(std::size_t i) const
+    {
+        auto dir = miopen::conv::Direction::Forward;
+        if(dirs[i] == miopenConvDirectionBackwardData)
+            dir = miopen::conv::Direction::BackwardData;
+        else if(dirs[i] == miopenConvDirectionBackwardWeights)
+            dir = miopen::conv::Direction::BackwardWeights;
+        auto ctx = miopen::ConvolutionContext{
+            miopen::ProblemDescription{x[i], w[i], y[i], conv[i], dir}};
+        ctx.SetStream(&get_handle());
+        ctx.DetectRocm();
+        ctx.SetupFloats();
+        return ctx;
+    }
+};
+
+int main()
+{
+    auto& cache = miopen::DbRecordCache::Instance();
+    if(!cache.IsEnabled())
+        return 0;
+
+    conv_problems problems;
+    problems.add({1, 16, 14, 14}, {32, 16, 3, 3}, miopenConvDirectionForward);
+    problems.add({2, 32, 7, 7}, {32, 32, 1, 1}, miopenConvDirectionBackwardData);
+    problems.add({4, 8, 28, 28}, {16, 8, 3, 3}, miopenConvDirectionBackwardWeights);
+
+    cache.Clear();
+    EXPECT(problems.prefetch() == miopenStatusSuccess);
+    EXPECT(cache.Size() > 0);
+
+    // The lookups for single problems, as made by the immediate mode calls, do not read the
+    // dbs, whether they have records of the problems or not.
+    const auto before = cache.GetStats();
+    for(std::size_t i = 0; i < problems.x.size(); ++i)
+    {
+        const auto ctx = problems.context(i);
+        const miopen::FindDbRecord find_record{get_handle(), ctx};
+        (void)miopen::GetDb(ctx).FindRecord(ctx);
+    }
+    const auto after = cache.GetStats();
+    EXPECT(after.lookups > before.lookups);
+    EXPECT(after.hits - before.hits == after.lookups - before.lookups);
+    cache.Clear();
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+// The GEMM convolutions transform and multiply as many images per launch as the workspace holds.
+// These checks give them room for 1, 2, 3 and all images of a minibatch which none of the
+// counts but 1 divides, so the last launch of each pass handles the remainder.
+#include <miopen/config.h>
+#include <miopen/convolution.hpp>
+#include <miopen/tensor.hpp>
+
+#include "driver.hpp"
+#include "cpu_conv.hpp"
+#include "get_handle.hpp"
+#include "tensor_holder.hpp"
+#include "test.hpp"
+#include "verify.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#if MIOPEN_USE_GEMM
+struct gemm_images_case
+{
+    std::vector<std::size_t> in;
+    std::vector<std::size_t> wei;
+    std::vector<int> pads;
+    std::vector<int> strides;
+};
+
+static float gen_value(std::size_t n, std::size_t c, std::size_t h, std::size_t w)
+{
+    return static_cast<float>((n * 7 + c * 5 + h * 3 + w) % 11) / 11.0f - 0.5f;
+}
+
+template <class F>
+static void for_each_workspace(std::size_t in_n, std::size_t per_image, F f)
+{
+    for(auto images : {std::size_t{1}, std::size_t{2}, std::size_t{3}, in_n})
+        f(per_image * images);
+}
+
+static void check_close(const tensor<float>& ref, const std::vector<float>& gpu, const char* what)
+{
+    const auto error = miopen::rms_range(ref.data, gpu);
+    if(!(error < 1e-5))
+    {
+        std::cout << what << ": rms error " << error << std::endl;
+        FAIL(what);
+    }
+}
+
+static void check_case(const gemm_images_case& c)
+{
+    auto&& handle = get_handle();
+
+    const auto filter = miopen::ConvolutionDescriptor{
+        2, miopenConvolution, miopenPaddingDefault, c.pads, c.strides, {1, 1}};
+
+    auto input   = tensor<float>{c.in}.generate(gen_value);
+    auto weights = tensor<float>{c.wei}.generate(gen_value);
+    auto output  = tensor<float>{filter.GetForwardOutputTensor(input.desc, weights.desc)};
+    output.generate(gen_value);
+
+    const auto in_n = c.in[0];
+    const auto x    = handle.Write(input.data);
+    const auto w    = handle.Write(weights.data);
+    const auto dy   = handle.Write(output.data);
+    auto y          = handle.Create(output.data.size() * sizeof(float));
+    auto dx         = handle.Create(input.data.size() * sizeof(float));
+    auto dw         = handle.Create(weights.data.size() * sizeof(float));
+
+    const float alpha = 1;
+    const float beta  = 0;
+
+    auto y_ref = output;
+    cpu_convolution_forward(
+        2, input, weights, y_ref, filter.GetConvPads(), filter.GetConvStrides(), {1, 1}, 1);
+    for_each_workspace(in_n,
+                       filter.ForwardGetWorkSpaceSizeGEMM(weights.desc, output.desc),
+                       [&](std::size_t size) {
+                           auto workspace = handle.Create(size);
+                           filter.ConvolutionForward(handle,
+                                                     &alpha,
+                                                     input.desc,
+                                                     x.get(),
+                                                     weights.desc,
+                                                     w.get(),
+                                                     miopenConvolutionFwdAlgoGEMM,
+                                                     &beta,
+                                                     output.desc,
+                                                     y.get(),
+                                                     workspace.get(),
+                                                     size);
+                           check_close(y_ref,
+                                       handle.Read<float>(y, output.data.size()),
+                                       "Forward GEMM");
+                       });
+
+    auto dx_ref = input;
+    cpu_convolution_backward_data(
+        2, dx_ref, weights, output, filter.GetConvPads(), filter.GetConvStrides(), {1, 1}, 1);
+    for_each_workspace(in_n,
+                       filter.BackwardDataGetWorkSpaceSizeGEMM(weights.desc, output.desc),
+                       [&](std::size_t size) {
+                           auto workspace = handle.Create(size);
+                           filter.ConvolutionBackwardData(handle,
+                                                          &alpha,
+                                                          output.desc,
+                                                          dy.get(),
+                                                          weights.desc,
+                                                          w.get(),
+                                                          miopenConvolutionBwdDataAlgoGEMM,
+                                                          &beta,
+                                                          input.desc,
+                                                          dx.get(),
+                                                          workspace.get(),
+                                                          size);
+                           check_close(dx_ref,
+                                       handle.Read<float>(dx, input.data.size()),
+                                       "Backward data GEMM");
+                       });
+
+    auto dw_ref = weights;
+    cpu_convolution_backward_weight(
+        2, input, dw_ref, output, filter.GetConvPads(), filter.GetConvStrides(), {1, 1}, 1);
+    for_each_workspace(in_n,
+                       filter.BackwardWeightsGetWorkSpaceSizeGEMM(output.desc, weights.desc),
+                       [&](std::size_t size) {
+                           auto workspace = handle.Create(size);
+                           filter.ConvolutionBackwardWeights(handle,
+                                                             &alpha,
+                                                             output.desc,
+                                                             dy.get(),
+                                                             input.desc,
+                                                             x.get(),
+                                                             miopenConvolutionBwdWeightsAlgoGEMM,
+                                                             &beta,
+                                                             weights.desc,
+                                                             dw.get(),
+                                                             workspace.get(),
+                                                             size);
+                           check_close(dw_ref,
+                                       handle.Read<float>(dw, weights.data.size()),
+                                       "Backward weights GEMM");
+                       });
+}
+#endif
+
+int main()
+{
+#if MIOPEN_USE_GEMM
+    // 5 images: batches of 1, 2+2+1, 3+2 and 5.
+    check_case({{5, 3, 9, 9}, {4, 3, 3, 3}, {1, 1}, {1, 1}});
+    check_case({{5, 3, 9, 9}, {4, 3, 3, 3}, {1, 1}, {2, 2}});
+    check_case({{5, 8, 7, 7}, {6, 8, 1, 1}, {0, 0}, {2, 2}});
+    check_case({{5, 4, 6, 5}, {2, 4, 3, 1}, {1, 0}, {1, 1}});
+#endif
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/convolution.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/tensor.hpp>
+
+#include "get_handle.hpp"
+#include "test.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+struct forward_problem
+{
+    miopen::TensorDescriptor x;
+    miopen::TensorDescriptor w;
+    miopen::ConvolutionDescriptor conv;
+    miopen::TensorDescriptor y;
+
+    forward_problem(const std::vector<int>& in, const std::vector<int>& wei)
+        : x(miopenFloat, in),
+          w(miopenFloat, wei),
+          conv({1, 1}, {1, 1}, {1, 1}),
+          y(conv.GetForwardOutputTensor(x, w))
+    {
+    }
+
+    bool is_precompiled(uint64_t solution_id) const
+    {
+        auto ctx = miopen::ConvolutionContext{
+            miopen::ProblemDescription{x, w, y, conv, miopen::conv::Direction::Forward}};
+        ctx.SetStream(&get_handle());
+        ctx.DetectRocm();
+        ctx.SetupFloats();
+        return bool(get_handle().GetInvoker(ctx.BuildConfKey(), miopen::solver::Id{solution_id}));
+    }
+};
+
+// Runs a precompiled forward problem through the immediate mode and returns the number of
+// solutions run.
+std::size_t run_immediate(forward_problem& p)
+{
+    auto& handle = get_handle();
+    auto count   = std::size_t{0};
+    CHECK(miopenConvolutionForwardGetSolutionCount(&handle, &p.w, &p.x, &p.conv, &p.y, &count) ==
+          miopenStatusSuccess);
+
+    auto solutions = std::vector<miopenConvSolution_t>(count);
+    CHECK(miopenConvolutionForwardGetSolution(
+              &handle, &p.w, &p.x, &p.conv, &p.y, count, &count, solutions.data()) ==
+          miopenStatusSuccess);
+    solutions.resize(count);
+
+    const auto x = handle.Write(std::vector<float>(p.x.GetElementSpace(), 1.0f));
+    const auto w = handle.Write(std::vector<float>(p.w.GetElementSpace(), 1.0f));
+    auto y       = handle.Create<float>(p.y.GetElementSpace());
+
+    auto run = std::size_t{0};
+    for(const auto& solution : solutions)
+    {
+        // Only the solutions of the find-db records with invokers are precompiled.
+        if(!p.is_precompiled(solution.solution_id))
+            continue;
+
+        auto workspace = handle.Create<char>(std::max<std::size_t>(solution.workspace_size, 1));
+        EXPECT(miopenConvolutionForwardCompileSolution(
+                   &handle, &p.w, &p.x, &p.conv, &p.y, solution.solution_id) ==
+               miopenStatusSuccess);
+        EXPECT(miopenConvolutionForwardImmediate(&handle,
+                                                 &p.w,
+                                                 w.get(),
+                                                 &p.x,
+                                                 x.get(),
+                                                 &p.conv,
+                                                 &p.y,
+                                                 y.get(),
+                                                 workspace.get(),
+                                                 solution.workspace_size,
+                                                 solution.solution_id) == miopenStatusSuccess);
+        ++run;
+    }
+    return run;
+}
+
+int main()
+{
+    auto& handle  = get_handle();
+    auto problems = std::vector<forward_problem>{};
+    problems.emplace_back(std::vector<int>{1, 16, 14, 14}, std::vector<int>{32, 16, 3, 3});
+    problems.emplace_back(std::vector<int>{2, 32, 7, 7}, std::vector<int>{32, 32, 1, 1});
+    problems.emplace_back(std::vector<int>{4, 64, 28, 28}, std::vector<int>{64, 64, 3, 3});
+
+    auto xs    = std::vector<miopenTensorDescriptor_t>{};
+    auto ws    = std::vector<miopenTensorDescriptor_t>{};
+    auto ys    = std::vector<miopenTensorDescriptor_t>{};
+    auto convs = std::vector<miopenConvolutionDescriptor_t>{};
+    for(auto& p : problems)
+    {
+        xs.push_back(&p.x);
+        ws.push_back(&p.w);
+        ys.push_back(&p.y);
+        convs.push_back(&p.conv);
+    }
+    const auto dirs =
+        std::vector<miopenConvDirection_t>(problems.size(), miopenConvDirectionForward);
+
+    CHECK(miopenConvolutionPrecompile(&handle,
+                                      problems.size(),
+                                      xs.data(),
+                                      ws.data(),
+                                      convs.data(),
+                                      ys.data(),
+                                      dirs.data()) == miopenStatusSuccess);
+
+    const auto programs = handle.GetProgramCount();
+    auto run            = std::size_t{0};
+    for(auto& p : problems)
+        run += run_immediate(p);
+    handle.Finish();
+
+    if(run == 0)
+        std::cout << "No find-db records with invokers for this device, nothing is precompiled"
+                  << std::endl;
+    EXPECT_EQUAL(handle.GetProgramCount(), programs);
+}
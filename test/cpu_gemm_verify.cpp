@@ -0,0 +1,204 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Host GEMM of the driver's RNN, LSTM, GRU and convolution references.
+#include "../driver/mloConvHost.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// The serial element-by-element product the references used before, as the parity baseline.
+template <typename T>
+void naive_mm(const T* a,
+              size_t a_stride,
+              bool a_trans,
+              const T* b,
+              size_t b_stride,
+              bool b_trans,
+              T* c,
+              size_t c_cols,
+              size_t c_rows,
+              size_t c_stride,
+              size_t inner,
+              T alpha,
+              T beta)
+{
+    for(size_t n = 0; n < c_rows; ++n)
+    {
+        for(size_t k = 0; k < c_cols; ++k)
+        {
+            T mm_e = static_cast<T>(0);
+            for(size_t m = 0; m < inner; ++m)
+            {
+                const T a_e = a_trans ? a[m * a_stride + n] : a[n * a_stride + m];
+                const T b_e = b_trans ? b[k * b_stride + m] : b[m * b_stride + k];
+                if(a_trans && b_trans)
+                    c[n * c_stride + k] += a_e * b_e;
+                else
+                    mm_e += a_e * b_e;
+            }
+            c[n * c_stride + k] = beta * c[n * c_stride + k] + alpha * mm_e;
+        }
+    }
+}
+
+template <typename T>
+std::vector<T> random_vector(std::size_t size, std::mt19937& gen)
+{
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<T> result(size);
+    for(auto& v : result)
+        v = static_cast<T>(dist(gen));
+    return result;
+}
+
+// C is rows x cols, the inner dimension is inner.
+template <typename T>
+std::vector<T> run_mm(const std::vector<T>& a,
+                      bool a_trans,
+                      const std::vector<T>& b,
+                      bool b_trans,
+                      std::vector<T> c,
+                      size_t rows,
+                      size_t cols,
+                      size_t inner,
+                      double beta)
+{
+    const auto a_flags = a_trans ? ADNN_MM_TRANSPOSE : 0;
+    const auto b_flags = b_trans ? ADNN_MM_TRANSPOSE : 0;
+    ADNN_mm_cpu<T>(a.data(),
+                   a_trans ? rows : inner,
+                   a_trans ? inner : rows,
+                   a_trans ? rows : inner,
+                   a_flags,
+                   b.data(),
+                   b_trans ? inner : cols,
+                   b_trans ? cols : inner,
+                   b_trans ? inner : cols,
+                   b_flags,
+                   c.data(),
+                   cols,
+                   rows,
+                   cols,
+                   0,
+                   1.0,
+                   beta);
+    return c;
+}
+
+template <typename T>
+void check_parity(size_t rows, size_t cols, size_t inner)
+{
+    std::mt19937 gen(rows * 7 + cols * 3 + inner);
+    const auto a = random_vector<T>(rows * inner, gen);
+    const auto b = random_vector<T>(inner * cols, gen);
+    const auto c = random_vector<T>(rows * cols, gen);
+
+    const auto threads = ADNN_mm_cpu_threads();
+    for(auto a_trans : {false, true})
+    {
+        for(auto b_trans : {false, true})
+        {
+            auto expected = c;
+            naive_mm(a.data(),
+                     a_trans ? rows : inner,
+                     a_trans,
+                     b.data(),
+                     b_trans ? inner : cols,
+                     b_trans,
+                     expected.data(),
+                     cols,
+                     rows,
+                     cols,
+                     inner,
+                     T(1),
+                     T(0.5));
+
+            for(auto n : {size_t{1}, size_t{3}, threads})
+            {
+                ADNN_mm_cpu_threads() = n;
+                EXPECT(run_mm(a, a_trans, b, b_trans, c, rows, cols, inner, 0.5) == expected);
+            }
+        }
+    }
+    ADNN_mm_cpu_threads() = threads;
+}
+
+// Shapes of a recurrent step, the references issue one such product per layer and timestep.
+void check_speedup()
+{
+    using clock    = std::chrono::steady_clock;
+    using duration = std::chrono::duration<double>;
+
+    const size_t batch  = 64;
+    const size_t hidden = 1024;
+    std::mt19937 gen(0);
+    const auto h = random_vector<double>(batch * hidden, gen);
+    const auto w = random_vector<double>(4 * hidden * hidden, gen);
+    const std::vector<double> c(batch * 4 * hidden);
+
+    const auto threads = ADNN_mm_cpu_threads();
+
+    auto start = clock::now();
+    auto naive = c;
+    naive_mm(h.data(),
+             hidden,
+             false,
+             w.data(),
+             hidden,
+             true,
+             naive.data(),
+             4 * hidden,
+             batch,
+             4 * hidden,
+             hidden,
+             1.0,
+             0.0);
+    const auto naive_time = duration(clock::now() - start).count();
+
+    start                   = clock::now();
+    const auto result       = run_mm(h, false, w, true, c, batch, 4 * hidden, hidden, 0.0);
+    const auto blocked_time = duration(clock::now() - start).count();
+    EXPECT(result == naive);
+
+    std::cout << "Host RNN GEMM " << batch << "x" << 4 * hidden << "x" << hidden
+              << ": serial " << naive_time << " s, " << threads << " threads " << blocked_time
+              << " s (x" << naive_time / blocked_time << ")" << std::endl;
+}
+
+int main()
+{
+    check_parity<float>(1, 1, 1);
+    check_parity<float>(17, 33, 9);
+    check_parity<double>(64, 96, 128);
+    check_parity<double>(5, 300, 257);
+    check_speedup();
+}
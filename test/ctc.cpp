@@ -669,6 +669,46 @@ struct verify_ctcloss
     }
 };
 
+// The packed metadata uploaded by CTCLoss must match the workspace layout of the reference.
+inline void check_ctc_metadata(int class_sz,
+                               int max_time_step,
+                               const std::vector<int>& labels,
+                               const std::vector<int>& labelLengths,
+                               const std::vector<int>& inputLengths)
+{
+    const int batch_size = labelLengths.size();
+    const auto meta      = miopen::GetCTCLossMetadata(class_sz,
+                                                 batch_size,
+                                                 max_time_step,
+                                                 labels.data(),
+                                                 labelLengths.data(),
+                                                 inputLengths.data());
+
+    std::vector<int> expected(inputLengths);
+    expected.insert(expected.end(), labelLengths.begin(), labelLengths.end());
+    int offset = 0;
+    for(int i = 0; i < batch_size; i++)
+    {
+        expected.push_back(offset);
+        offset += labelLengths[i];
+    }
+    offset = 0;
+    for(int i = 0; i < batch_size; i++)
+    {
+        int repeat = 0;
+        for(int j = 1; j < labelLengths[i]; j++)
+            if(labels[offset + j] == labels[offset + j - 1])
+                repeat++;
+        expected.push_back(repeat);
+        offset += labelLengths[i];
+    }
+    expected.insert(expected.end(), labels.begin(), labels.end());
+
+    CHECK(meta.staging == expected);
+    CHECK(meta.total_label_len == offset);
+    CHECK(meta.max_label_len == *std::max_element(labelLengths.begin(), labelLengths.end()));
+}
+
 template <class T>
 struct ctc_driver : test_driver
 {
@@ -762,6 +802,8 @@ struct ctc_driver : test_driver
                 labels[i] = blank_lb - 1 >= 0 ? (blank_lb - 1) : blank_lb + 1;
         }
 
+        check_ctc_metadata(class_sz, max_time_step, labels, labelLengths, inputLengths);
+
         verify(verify_ctcloss<T>{
             ctcLossDesc, probs, labels, labelLengths, inputLengths, losses, grads});
     }
@@ -31,6 +31,7 @@
 #include "tensor_holder.hpp"
 #include "test.hpp"
 #include "verify.hpp"
+#include "verify_cache.hpp"
 
 #include <functional>
 #include <deque>
@@ -111,6 +112,7 @@ auto cpu_async(V& v, Ts&&... xs) -> std::future<decltype(v.cpu(xs...))>
 }
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_VERIFY_CACHE_PATH)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_VERIFY_CACHE_SIZE)
 
 struct test_driver
 {
@@ -122,6 +124,7 @@ struct test_driver
     {
         std::function<void(std::vector<std::string>)> write_value;
         std::function<std::string()> read_value;
+        std::function<void(std::ostream&)> write_content;
         std::vector<std::function<void()>> post_write_actions;
         std::vector<std::function<void(std::function<void()>)>> data_sources;
         std::string type;
@@ -171,7 +174,7 @@ struct test_driver
     std::string program_name;
     std::deque<argument> arguments;
     std::unordered_map<std::string, std::size_t> argument_index;
-    int cache_version      = 1;
+    int cache_version      = 2;
     std::string cache_path = compute_cache_path();
     miopenDataType_t type  = miopenFloat;
     bool full_set          = false;
@@ -232,11 +235,14 @@ struct test_driver
         argument_index.insert(std::make_pair(name, arguments.size()));
         arguments.emplace_back();
 
-        argument& arg   = arguments.back();
-        arg.name        = name;
-        arg.type        = miopen::get_type_name<T>();
-        arg.write_value = [&](std::vector<std::string> params) { args::write_value{}(x, params); };
-        arg.read_value  = [&] { return args::read_value{}(x); };
+        argument& arg     = arguments.back();
+        arg.name          = name;
+        arg.type          = miopen::get_type_name<T>();
+        arg.write_value   = [&](std::vector<std::string> params) {
+            args::write_value{}(x, params);
+        };
+        arg.read_value    = [&] { return args::read_value{}(x); };
+        arg.write_content = [&](std::ostream& os) { write_content(miopen::rank<1>{}, os, x); };
         miopen::each_args(std::bind(per_arg{}, std::ref(x), std::ref(arg), std::placeholders::_1),
                           fs...);
         // assert(get_argument(name).name == name);
@@ -664,33 +670,65 @@ struct test_driver
         return boost::filesystem::exists(p);
     }
 
+    // Tensor arguments are hashed by their content, the others by their value.
+    template <class T>
+    static auto write_content(miopen::rank<1>, std::ostream& os, const T& x)
+        -> decltype(serialize(os, x.desc.GetLengths()), serialize(os, x.data), void())
+    {
+        serialize(os, x.desc.GetLengths());
+        serialize(os, x.data);
+    }
+
+    template <class T>
+    static void write_content(miopen::rank<0>, std::ostream&, const T&)
+    {
+    }
+
+    template <class V>
+    std::string get_cache_key()
+    {
+        std::ostringstream ss;
+        ss << miopen::get_type_name<V>() << '\n' << get_command_args() << '\n';
+        for(auto&& arg : this->arguments)
+            arg.write_content(ss);
+        return miopen::md5(ss.str());
+    }
+
+    verify_cache get_verify_cache() const
+    {
+        const auto size_mb = miopen::Value(MIOPEN_VERIFY_CACHE_SIZE{}, 4096);
+        return {boost::filesystem::path{miopen::ExpandUser(cache_path)} /
+                    std::to_string(cache_version),
+                size_mb * 1024 * 1024};
+    }
+
     template <class V, class... Ts>
     auto run_cpu(bool retry, bool& miss, V& v, Ts&&... xs) -> std::future<decltype(v.cpu(xs...))>
     {
         using result_type = decltype(v.cpu(xs...));
         if(is_cache_disabled() or not is_const_cpu(v, xs...))
             return cpu_async(v, xs...);
-        auto key = miopen::get_type_name<V>() + "-" + miopen::md5(get_command_args());
-        auto p =
-            boost::filesystem::path{miopen::ExpandUser(cache_path)} / std::to_string(cache_version);
-        if(!boost::filesystem::exists(p))
-            boost::filesystem::create_directories(p);
-        auto f = p / key;
-        if(boost::filesystem::exists(f) and not retry)
+        const auto key   = get_cache_key<V>();
+        const auto cache = get_verify_cache();
+        std::string data;
+        if(not retry and cache.load(key, data))
         {
             miss = false;
-            return detach_async([=] {
+            return detach_async([data] {
                 result_type result;
-                load(f.string(), result);
+                std::istringstream is{data};
+                serialize(is, result);
                 return result;
             });
         }
         else
         {
             miss = true;
-            return then(cpu_async(v, xs...), [=](auto data) {
-                save(f.string(), data);
-                return data;
+            return then(cpu_async(v, xs...), [=](auto result) {
+                std::ostringstream os;
+                serialize(os, result);
+                cache.store(key, os.str());
+                return result;
             });
         }
     }
@@ -1271,6 +1309,7 @@ void test_drive_impl(std::string program_name, std::vector<std::string> as)
 #else
     test_drive_impl_1<Driver>(program_name, as);
 #endif
+    get_verify_cache_stats().report(std::cout);
 }
 
 template <class Driver>
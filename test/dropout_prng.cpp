@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Parity of the jump table xorwow seeding with the power-of-two skip-ahead it replaces.
+#include "driver.hpp"
+#include "dropout_util.hpp"
+#include "test.hpp"
+
+#include <limits>
+#include <random>
+#include <vector>
+
+bool same_state(const prngStates& a, const prngStates& b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w && a.v == b.v && a.d == b.d;
+}
+
+// The state of a subsequence as computed before the jump table, one product per set bit.
+prngStates reference_state(unsigned long long seed, unsigned long long subsequence)
+{
+    prngStates state;
+    xorwow_lite_init_emu(&state, seed, 0, 0);
+    xorwow_skipahead_emu(subsequence, &state, precalc_xorwow_skipahead_sequence_matrices);
+    return state;
+}
+
+void check_subsequences(unsigned long long seed)
+{
+    std::mt19937_64 gen(seed);
+    std::vector<unsigned long long> subsequences{0, 1, 15, 16, 255, 4095, 65535, 65536};
+    for(int i = 0; i < 64; i++)
+        subsequences.push_back(gen() >> (i % 64));
+    subsequences.push_back(std::numeric_limits<unsigned long long>::max());
+
+    for(auto subsequence : subsequences)
+    {
+        prngStates state;
+        xorwow_lite_init_emu(&state, seed, subsequence, 0);
+        EXPECT(same_state(state, reference_state(seed, subsequence)));
+    }
+}
+
+void check_init(unsigned long long seed, size_t states_num)
+{
+    miopen::DropoutDescriptor desc;
+    desc.seed             = seed;
+    desc.stateSizeInBytes = states_num * sizeof(prngStates);
+
+    std::vector<prngStates> states(states_num + MAX_PRNG_STATE);
+    InitKernelStateEmulator(states, desc);
+
+    const size_t glb_sz = std::min<size_t>(MAX_PRNG_STATE, (states_num + 255) / 256 * 256);
+    for(size_t gid = 0; gid < (states_num + glb_sz - 1) / glb_sz * glb_sz; gid++)
+        EXPECT(same_state(states[gid], reference_state(seed, gid)));
+}
+
+int main()
+{
+    for(auto seed : {0ULL, 1ULL, 0x123456789abcdefULL})
+        check_subsequences(seed);
+
+    check_init(0, 1);
+    check_init(0, 1000);
+    check_init(0x123456789abcdefULL, MAX_PRNG_STATE);
+    check_init(42, 3 * MAX_PRNG_STATE + 17);
+}
@@ -38,9 +38,11 @@
 
 #include <miopen/dropout.hpp>
 #include <miopen/miopen.h>
+#include <miopen/par_for.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/precalc_xorwow_skipahead_matrices.hpp>
 #include <miopen/precalc_xorwow_skipahead_sequence_matrices.hpp>
+#include <miopen/precalc_xorwow_skipahead_jump_table.hpp>
 
 #define ROCRAND_2POW32_INV (2.3283064e-10f)
 
@@ -182,6 +184,39 @@ inline void xorwow_skipahead_emu(unsigned long long skp,
     std::copy(std::begin(xor_vec), std::end(xor_vec), p);
 }
 
+// Skips ahead by skp subsequences like the kernel does: the low digits of skp take one
+// matrix-vector product each from the jump table, the higher bits continue with the sequence
+// matrices.
+inline void xorwow_skipahead_sequence_emu(unsigned long long skp, prngStates* state)
+{
+    unsigned int xor_vec[XORWOW_DIM];
+    unsigned int* p = &(state->x);
+    std::copy(p, p + XORWOW_DIM, std::begin(xor_vec));
+
+    for(unsigned int digit_idx = 0; bool(skp) && digit_idx < XORWOW_JUMP_TABLE_DIGITS; digit_idx++)
+    {
+        const auto digit = static_cast<unsigned int>(skp & XORWOW_JUMP_TABLE_RADIX_MASK);
+        if(digit != 0)
+        {
+            mat_vec(precalc_xorwow_skipahead_jump_table[digit_idx * XORWOW_JUMP_TABLE_RADIX_MASK +
+                                                        digit - 1],
+                    xor_vec);
+        }
+        skp >>= XORWOW_JUMP_TABLE_RADIX_LOG2;
+    }
+
+    for(unsigned int mat_idx = XORWOW_JUMP_TABLE_BITS / XORWOW_JUMP_LOG2; bool(skp); mat_idx++)
+    {
+        for(unsigned int i = 0; i < static_cast<unsigned int>(skp & XORWOW_JUMP_LOG2_MASK); i++)
+        {
+            mat_vec(precalc_xorwow_skipahead_sequence_matrices[mat_idx], xor_vec);
+        }
+        skp >>= XORWOW_JUMP_LOG2;
+    }
+
+    std::copy(std::begin(xor_vec), std::end(xor_vec), p);
+}
+
 inline void xorwow_lite_init_emu(prngStates* cur_state,
                                  const unsigned long long seed,
                                  const unsigned long long subsequence,
@@ -207,7 +242,7 @@ inline void xorwow_lite_init_emu(prngStates* cur_state,
     cur_state->v += t0;
     cur_state->d += t1 + t0;
 
-    xorwow_skipahead_emu(subsequence, cur_state, precalc_xorwow_skipahead_sequence_matrices);
+    xorwow_skipahead_sequence_emu(subsequence, cur_state);
 
     xorwow_skipahead_emu(offset, cur_state, precalc_xorwow_skipahead_matrices);
     cur_state->d += static_cast<unsigned int>(offset) * 362437;
@@ -216,20 +251,28 @@ inline void xorwow_lite_init_emu(prngStates* cur_state,
 inline void InitKernelStateEmulator(std::vector<prngStates>& states,
                                     const miopen::DropoutDescriptor& dropoutDesc)
 {
-    size_t states_num = dropoutDesc.stateSizeInBytes / sizeof(prngStates);
-    size_t wk_grp_num = std::min(size_t(MAX_PRNG_STATE / 256), (states_num + 255) / 256);
-    size_t glb_sz     = wk_grp_num * 256;
-
-    for(size_t j = 0; j < (states_num + glb_sz - 1) / glb_sz; j++)
-    {
-        for(size_t i = 0; i < glb_sz; i++)
+    const size_t states_num = dropoutDesc.stateSizeInBytes / sizeof(prngStates);
+    const size_t wk_grp_num = std::min(size_t(MAX_PRNG_STATE / 256), (states_num + 255) / 256);
+    if(states_num == 0)
+        return;
+
+    const size_t glb_sz   = wk_grp_num * 256;
+    const size_t init_num = std::min(states.size(), (states_num + glb_sz - 1) / glb_sz * glb_sz);
+    const auto seed       = dropoutDesc.seed;
+
+    // Each block seeds its first state through the jump table. The state of the next
+    // subsequence is the previous one a single subsequence ahead, one matrix-vector product.
+    const size_t block_sz = 256;
+    miopen::par_for((init_num + block_sz - 1) / block_sz, 1, [&](size_t block) {
+        const size_t first = block * block_sz;
+        const size_t last  = std::min(first + block_sz, init_num);
+        xorwow_lite_init_emu(&states[first], seed, first, 0);
+        for(size_t gid = first + 1; gid < last; gid++)
         {
-            size_t gid                = i + j * glb_sz;
-            unsigned long long seq    = gid;
-            unsigned long long offset = 0;
-            xorwow_lite_init_emu(&states[gid], dropoutDesc.seed, seq, offset);
+            states[gid] = states[gid - 1];
+            xorwow_skipahead_sequence_emu(1, &states[gid]);
         }
-    }
+    });
 }
 
 template <typename T>
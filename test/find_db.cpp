@@ -78,6 +78,7 @@ struct FindDbTest : test_driver
         TestForward();
         TestBwdData();
         TestWeights();
+        TestForwardFreshHandle();
     }
 
     private:
@@ -175,6 +176,55 @@ struct FindDbTest : test_driver
         Test(filterCall);
     }
 
+    // A new handle has no invokers, as a new process, so a find-db hit has to rebuild them
+    // instead of running the Find again.
+    void TestForwardFreshHandle()
+    {
+        MIOPEN_LOG_I("Starting forward find-db test with fresh handles.");
+
+        auto call = [&]() {
+            Handle fresh{};
+            const auto x_fresh = fresh.Write(x.data);
+            const auto w_fresh = fresh.Write(w.data);
+            const auto y_fresh = fresh.Write(y.data);
+
+            const auto workspace_size =
+                filter.ForwardGetWorkSpaceSize(fresh, w.desc, x.desc, y.desc);
+            auto workspace     = std::vector<char>(workspace_size);
+            auto workspace_dev = workspace_size != 0 ? fresh.Write(workspace) : nullptr;
+
+            int ret_algo_count;
+            miopenConvAlgoPerf_t perf[1];
+
+            filter.FindConvFwdAlgorithm(fresh,
+                                        x.desc,
+                                        x_fresh.get(),
+                                        w.desc,
+                                        w_fresh.get(),
+                                        y.desc,
+                                        y_fresh.get(),
+                                        1,
+                                        &ret_algo_count,
+                                        perf,
+                                        workspace_dev.get(),
+                                        workspace_size,
+                                        false);
+            EXPECT_OP(ret_algo_count, >, 0);
+        };
+
+        const auto regenerations = testing_find_db_regenerations;
+        testing_find_db_enabled  = false;
+        call();
+        EXPECT_EQUAL(testing_find_db_regenerations, regenerations + 1);
+
+        testing_find_db_enabled = true;
+        call();
+        call();
+#if !MIOPEN_DISABLE_USERDB
+        EXPECT_EQUAL(testing_find_db_regenerations, regenerations + 1);
+#endif
+    }
+
     void Test(const std::function<void()>& func)
     {
         using mSeconds = std::chrono::duration<double, std::ratio<1, 1000>>;
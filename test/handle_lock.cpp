@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/handle_lock.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include "test.hpp"
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Result of try_lock() in another process, which does not share the file locks of this one.
+bool try_lock_in_child(const std::string& path)
+{
+    const auto pid = fork();
+    EXPECT(pid >= 0);
+    if(pid == 0)
+    {
+        miopen::handle_mutex m{path.c_str()};
+        if(m.try_lock())
+        {
+            m.unlock();
+            std::_Exit(0);
+        }
+        // A failed try_lock() shall not keep the mutex of the process locked either.
+        const auto released = m.m.try_lock();
+        std::_Exit(released ? 1 : 2);
+    }
+    auto status = 0;
+    EXPECT(waitpid(pid, &status, 0) == pid);
+    EXPECT(WIFEXITED(status));
+    EXPECT(WEXITSTATUS(status) != 2);
+    return WEXITSTATUS(status) == 0;
+}
+
+int main()
+{
+    const miopen::TmpDir dir{"handle_lock"};
+    const auto path = (dir.path / "test.lock").string();
+    boost::filesystem::ofstream{path};
+
+    EXPECT(try_lock_in_child(path));
+
+    miopen::handle_mutex m{path.c_str()};
+    EXPECT(m.try_lock());
+    EXPECT(!try_lock_in_child(path));
+
+    // Locked by another thread of this process.
+    std::thread([&] { EXPECT(!m.try_lock()); }).join();
+    m.unlock();
+    std::thread([&] {
+        EXPECT(m.try_lock());
+        m.unlock();
+    }).join();
+    EXPECT(try_lock_in_child(path));
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h>
+
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+#include <miopen/kern_db.hpp>
+#include <miopen/kern_db_bundle.hpp>
+#include <miopen/temp_file.hpp>
+#endif
+
+#include "test.hpp"
+
+#include <string>
+
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+static miopen::KernelConfig MakeKernel(const std::string& name, const std::string& blob)
+{
+    return {name, " -DMIOPEN_USE_FP32=1 -mcpu=gfx906", blob};
+}
+
+void check_export_import()
+{
+    const auto blob_a = std::string(4096, 'a');
+    const auto blob_b = std::string(2048, 'b');
+    auto k0           = MakeKernel("k0.o", blob_a);
+    auto k1           = MakeKernel("k1.o", blob_a);
+    auto k2           = MakeKernel("k2.o", blob_b);
+
+    miopen::TempFile src_file("tmp-kerndb");
+    miopen::TempFile bundle_file("tmp-bundle");
+    miopen::TempFile dst_file("tmp-kerndb");
+
+    {
+        miopen::KernDb src(src_file, false, "gfx906", 60);
+        CHECK(src.StoreRecordUnsafe(k0));
+        CHECK(src.StoreRecordUnsafe(k1));
+        CHECK(src.StoreRecordUnsafe(k2));
+    }
+
+    EXPECT(miopen::ListKernDbKeys(src_file).size() == 3);
+
+    // Identical binaries are stored once.
+    auto stats = miopen::ExportKernDbBundle(src_file, bundle_file, "gfx906", 60);
+    EXPECT(stats.kernels == 3);
+    EXPECT(stats.blobs == 2);
+    EXPECT(stats.corrupted == 0);
+
+    stats = miopen::ImportKernDbBundle(bundle_file, dst_file, "gfx906", 60);
+    EXPECT(stats.kernels == 3);
+    EXPECT(stats.skipped == 0);
+
+    {
+        miopen::KernDb dst(dst_file, true, "gfx906", 60);
+        EXPECT(dst.FindRecordUnsafe(k0).value() == blob_a);
+        EXPECT(dst.FindRecordUnsafe(k1).value() == blob_a);
+        EXPECT(dst.FindRecordUnsafe(k2).value() == blob_b);
+    }
+
+    // Merging into a populated db keeps the existing entries.
+    stats = miopen::ImportKernDbBundle(bundle_file, dst_file, "gfx906", 60);
+    EXPECT(stats.kernels == 0);
+    EXPECT(stats.skipped == 3);
+
+    stats = miopen::ImportKernDbBundle(bundle_file, dst_file, "gfx906", 60, true);
+    EXPECT(stats.kernels == 3);
+    EXPECT(miopen::ListKernDbKeys(dst_file).size() == 3);
+
+    // Device is validated.
+    CHECK(throws([&]() { miopen::ImportKernDbBundle(bundle_file, dst_file, "gfx908", 120); }));
+}
+
+void check_filter()
+{
+    auto k0 = MakeKernel("k0.o", std::string(1024, 'a'));
+    auto k1 = MakeKernel("k1.o", std::string(1024, 'b'));
+
+    miopen::TempFile src_file("tmp-kerndb");
+    miopen::TempFile bundle_file("tmp-bundle");
+    miopen::TempFile dst_file("tmp-kerndb");
+
+    {
+        miopen::KernDb src(src_file, false, "gfx906", 60);
+        CHECK(src.StoreRecordUnsafe(k0));
+        CHECK(src.StoreRecordUnsafe(k1));
+    }
+
+    const auto keys = std::vector<miopen::KernDbKey>{{k1.kernel_name, k1.kernel_args}};
+    auto stats      = miopen::ExportKernDbBundle(src_file, bundle_file, "gfx906", 60, keys);
+    EXPECT(stats.kernels == 1);
+    EXPECT(stats.skipped == 1);
+
+    miopen::ImportKernDbBundle(bundle_file, dst_file, "gfx906", 60);
+    miopen::KernDb dst(dst_file, true, "gfx906", 60);
+    EXPECT(!dst.FindRecordUnsafe(k0));
+    EXPECT(dst.FindRecordUnsafe(k1).value() == k1.kernel_blob);
+}
+
+void check_corrupted()
+{
+    auto k0 = MakeKernel("k0.o", std::string(1024, 'a'));
+
+    miopen::TempFile src_file("tmp-kerndb");
+    miopen::TempFile bundle_file("tmp-bundle");
+
+    {
+        miopen::KernDb src(src_file, false, "gfx906", 60);
+        CHECK(src.StoreRecordUnsafe(k0));
+        // Uncompressed entry with a wrong hash.
+        auto stmt = miopen::SQLite::Statement{
+            src.sql,
+            "INSERT INTO kern_db(kernel_name, kernel_args, kernel_blob, kernel_hash, "
+            "uncompressed_size) VALUES(?, ?, ?, ?, 0);",
+            {"k1.o", k0.kernel_args, "garbage", "0123456789abcdef"}};
+        CHECK(stmt.Step(src.sql) == SQLITE_DONE);
+    }
+
+    const auto stats = miopen::ExportKernDbBundle(src_file, bundle_file, "gfx906", 60);
+    EXPECT(stats.kernels == 1);
+    EXPECT(stats.corrupted == 1);
+}
+#endif
+
+int main()
+{
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    check_export_import();
+    check_filter();
+    check_corrupted();
+#endif
+}
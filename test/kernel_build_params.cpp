@@ -51,6 +51,31 @@ struct KBPTestDriver : test_driver
             "-Wa,-defsym,DefineWithValue=0 -TrivialOption -OptionWithValue 0 -Wa,-defsym,Shifted "
             "-Wa,-defsym,DefineDefine "
             "-Wa,-defsym,DefineDefineWithValue=1");
+
+        CheckCanonicalOptions();
+    }
+
+    void CheckCanonicalOptions() const
+    {
+        const auto canonical = CanonicalizeBuildOptions("-cl-std=CL2.0 -DB=2 -DA=1 -mcpu=gfx906");
+        EXPECT_EQUAL(canonical, "-cl-std=CL2.0 -mcpu=gfx906 -DA=1 -DB=2");
+        // Order of defines, whitespace, separated -D and redefinitions do not matter.
+        EXPECT_EQUAL(CanonicalizeBuildOptions("  -DA=1 -cl-std=CL2.0\t-D B=2  -mcpu=gfx906 "),
+                     canonical);
+        EXPECT_EQUAL(CanonicalizeBuildOptions("-DA=0 -DB=2 -cl-std=CL2.0 -mcpu=gfx906 -DA=1"),
+                     canonical);
+        EXPECT_EQUAL(CanonicalizeBuildOptions(canonical), canonical);
+        EXPECT_EQUAL(CanonicalizeBuildOptions("-DA -UA -DB"), "-UA -DB");
+
+        // Order of other options and their separate arguments are kept.
+        EXPECT_EQUAL(CanonicalizeBuildOptions("-O3 -mllvm -DX -O1 -DY"), "-O3 -mllvm -DX -O1 -DY");
+        EXPECT_EQUAL(CanonicalizeBuildOptions("-O1 -O3"), "-O1 -O3");
+        EXPECT(CanonicalizeBuildOptions("-DA=0 -DA=1") != CanonicalizeBuildOptions("-DA=1 -DA=0"));
+        EXPECT_EQUAL(CanonicalizeBuildOptions("-DA=\"1 2\""), "-DA=\"1 2\"");
+
+        const auto generated = KernelBuildParameters{{"B", 2}, {"A", 1}}.GenerateFor(kbp::OpenCL{});
+        EXPECT_EQUAL(CanonicalizeBuildOptions(generated),
+                     CanonicalizeBuildOptions(" -DA=1 -DB=2"));
     }
 };
 } // namespace tests
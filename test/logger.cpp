@@ -0,0 +1,164 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/logger.hpp>
+
+#include "test.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// More messages than the ring of the async sink holds, so the producers have to wait.
+constexpr int thread_count       = 8;
+constexpr int messages_in_thread = 2000;
+constexpr int messages_in_fork   = 100;
+
+std::string Payload(int id) { return std::string(64, static_cast<char>('a' + id % 26)); }
+
+void LogFromThreads()
+{
+    std::vector<std::thread> threads;
+    for(auto t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([t]() {
+            for(auto i = 0; i < messages_in_thread; ++i)
+                MIOPEN_LOG_W("logger-thread " << t << ' ' << i << ' ' << Payload(t));
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+}
+
+// Logs into the pipe with the writer thread running, then forks a child which logs as well.
+[[noreturn]] void RunLoggingProcess(int out)
+{
+    dup2(out, STDERR_FILENO);
+    close(out);
+    setenv("MIOPEN_ENABLE_LOGGING_ASYNC", "1", 1);
+    LogFromThreads();
+
+    const auto pid = fork();
+    if(pid == 0)
+    {
+        for(auto i = 0; i < messages_in_fork; ++i)
+            MIOPEN_LOG_W("logger-fork " << i << ' ' << Payload(thread_count));
+        std::exit(0);
+    }
+    auto status = 0;
+    const auto forked_ok = pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+                           WEXITSTATUS(status) == 0;
+    // The exit handlers write out the queued messages.
+    std::exit(forked_ok ? 0 : 1);
+}
+
+std::string ReadLogOfProcess()
+{
+    int fds[2];
+    CHECK(pipe(fds) == 0);
+    const auto pid = fork();
+    CHECK(pid >= 0);
+    if(pid == 0)
+    {
+        close(fds[0]);
+        RunLoggingProcess(fds[1]);
+    }
+    close(fds[1]);
+
+    // Nothing is read for a while, so the pipe and then the ring fill up.
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::string log;
+    char buffer[4096];
+    while(true)
+    {
+        const auto n = read(fds[0], buffer, sizeof(buffer));
+        CHECK(n >= 0);
+        if(n == 0)
+            break;
+        log.append(buffer, static_cast<std::size_t>(n));
+    }
+    close(fds[0]);
+
+    auto status = 0;
+    EXPECT(waitpid(pid, &status, 0) == pid);
+    EXPECT(WIFEXITED(status));
+    EXPECT(WEXITSTATUS(status) == 0);
+    return log;
+}
+
+// Checks that the rest of the line is "<index> <payload>", and nothing else.
+bool ParseMessage(std::istringstream& line, int& index, int id)
+{
+    std::string payload, rest;
+    line >> index >> payload;
+    return !line.fail() && payload == Payload(id) && !(line >> rest);
+}
+
+int main()
+{
+    const auto log = ReadLogOfProcess();
+
+    std::vector<int> next(thread_count, 0);
+    auto next_forked = 0;
+    std::istringstream lines(log);
+    for(std::string text; std::getline(lines, text);)
+    {
+        const auto thread_pos = text.find("logger-thread ");
+        const auto fork_pos   = text.find("logger-fork ");
+        // Every line is a whole message.
+        EXPECT(thread_pos != std::string::npos || fork_pos != std::string::npos);
+
+        if(thread_pos != std::string::npos)
+        {
+            std::istringstream line(text.substr(thread_pos + 14));
+            auto t     = -1;
+            auto index = -1;
+            line >> t;
+            EXPECT(t >= 0 && t < thread_count);
+            EXPECT(ParseMessage(line, index, t));
+            // In the order of the thread.
+            EXPECT_EQUAL(index, next[t]);
+            ++next[t];
+        }
+        else
+        {
+            std::istringstream line(text.substr(fork_pos + 12));
+            auto index = -1;
+            EXPECT(ParseMessage(line, index, thread_count));
+            EXPECT_EQUAL(index, next_forked);
+            ++next_forked;
+        }
+    }
+
+    for(auto t = 0; t < thread_count; ++t)
+        EXPECT_EQUAL(next[t], messages_in_thread);
+    EXPECT_EQUAL(next_forked, messages_in_fork);
+}
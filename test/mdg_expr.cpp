@@ -0,0 +1,182 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Parity of the compiled fusion graph constraints with the interpreted parse tree.
+#include <miopen/md_graph.hpp>
+#include <miopen/mdg_expr.hpp>
+
+#include "test.hpp"
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using AttrFun = std::function<bool(const std::string&, int&)>;
+
+struct Outcome
+{
+    bool success = false;
+    std::string error;
+    std::unordered_map<std::string, int> syms;
+
+    bool operator==(const Outcome& other) const
+    {
+        return success == other.success && error == other.error && syms == other.syms;
+    }
+};
+
+// The evaluation of an edge before the constraints were compiled: every constraint is parsed
+// and the parse tree visited.
+bool InterpretedCmpOpKey(const miopen::FusionMDGraph_Edge_Map& edge_val,
+                         const AttrFun& attr_fun,
+                         std::unordered_map<std::string, int>& syms)
+{
+    for(auto& kv : edge_val)
+    {
+        miopen::tree_visit v(attr_fun);
+        for(auto& edg_op : kv.second)
+        {
+            std::string::const_iterator f(edg_op.begin()), l(edg_op.end());
+            miopen::MDGExprParser p;
+            boost::spirit::utree e;
+            if(!boost::spirit::qi::phrase_parse(f, l, p, boost::spirit::ascii::space, e))
+                MIOPEN_THROW(miopenStatusInternalError,
+                             "Unable to parse graph constraint expression");
+            miopen::visit_res r = boost::spirit::utree::visit(e, v);
+            v.tabl.insert(r.tabl.begin(), r.tabl.end());
+            syms = v.tabl;
+            if(!r.b_res)
+                return false;
+        }
+    }
+    return true;
+}
+
+template <class F>
+Outcome Run(F f)
+{
+    Outcome o;
+    try
+    {
+        o.success = f(o.syms);
+    }
+    catch(const miopen::Exception& ex)
+    {
+        // Without the source location, which differs between the two.
+        const std::string what = ex.what();
+        o.error                = what.substr(what.find(": ") + 1);
+    }
+    return o;
+}
+
+// Attributes of a made up problem: small values, so that both outcomes of the comparisons
+// occur, and some symbols unknown, so that the assignments and the access errors occur.
+AttrFun MakeAttrs(unsigned env)
+{
+    return [env](const std::string& sym, int& val) {
+        if(sym == "weight" || sym == "algo" || sym == "padded_x" || sym == "padded_y")
+            return false;
+        const auto h = std::hash<std::string>{}(sym) ^ (env * 2654435761u);
+        if(h % 13 == 0)
+            return false;
+        val = static_cast<int>(h % 7);
+        return true;
+    };
+}
+
+void check_expressions()
+{
+    const std::vector<std::string> exprs = {"a + b * 2",
+                                            "(x ~ 3) == padded",
+                                            "1.5 + 2 == 3",
+                                            "c * x * y <= (2^28)",
+                                            "(2 * 3 - 1) / 2 == a",
+                                            "weight === 7",
+                                            "padded_x === (x ~ 3)",
+                                            "(y == 3) & (x == 3)",
+                                            "(y == 3) | (x == 3)",
+                                            "a > b",
+                                            "c < d",
+                                            "a - b <= 1",
+                                            "a != b",
+                                            "a >= b",
+                                            "(a % 2) == 0",
+                                            "unknown + 1",
+                                            "1 + unknown",
+                                            "c === 1"};
+    for(unsigned env = 0; env < 16; ++env)
+    {
+        const auto attrs = MakeAttrs(env);
+        for(const auto& expr : exprs)
+        {
+            miopen::FusionMDGraph_Edge_Map edge;
+            edge["constraints"] = {expr};
+            miopen::FusionMDGraph g;
+            EXPECT(Run([&](auto& syms) { return InterpretedCmpOpKey(edge, attrs, syms); }) ==
+                   Run([&](auto& syms) { return g.CmpOpKey(edge, attrs, syms); }));
+        }
+    }
+}
+
+void check_graphs()
+{
+    std::size_t edges = 0;
+    for(auto op : {miopen::miopenFusionOpConvForward,
+                   miopen::miopenFusionOpBatchNormInference,
+                   miopen::miopenFusionOpBatchNormFwdTrain,
+                   miopen::miopenFusionOpBatchNormBwdTrain})
+    {
+        miopen::FusionMDGraph g;
+        miopen::FusionMDGraph::Init(g, op);
+        for(unsigned env = 0; env < 64; ++env)
+        {
+            const auto attrs = MakeAttrs(env);
+            for(const auto& src : g.edge_list)
+            {
+                for(const auto& dst : src.second)
+                {
+                    for(const auto& edge : dst.second)
+                    {
+                        ++edges;
+                        const auto expected = Run([&](auto& syms) {
+                            return InterpretedCmpOpKey(edge, attrs, syms);
+                        });
+                        EXPECT(expected ==
+                               Run([&](auto& syms) { return g.CmpOpKey(edge, attrs, syms); }));
+                    }
+                }
+            }
+        }
+    }
+    EXPECT(edges > 0);
+}
+
+int main()
+{
+    check_expressions();
+    check_graphs();
+}
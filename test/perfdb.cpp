@@ -28,6 +28,7 @@
 #include "driver.hpp"
 
 #include <miopen/db.hpp>
+#include <miopen/db_cache.hpp>
 #include <miopen/db_record.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/temp_file.hpp>
@@ -1178,6 +1179,226 @@ class DbMultiFileOperationsTest : public DbMultiFileTest
     }
 };
 
+template <bool merge_records>
+class DbMultiFileFindRecordsTest : public DbMultiFileTest
+{
+    public:
+    void Run() const
+    {
+        std::cout << "Running multifile batched read test";
+        if(merge_records)
+            std::cout << " with merge";
+        std::cout << "..." << std::endl;
+
+        ResetDb();
+        PrepareDb();
+
+        const TestData missing_key(100, 200);
+        const auto problems = std::vector<TestData>{key(), missing_key, other_key(), key()};
+
+        MultiFileDb<PlainTextDb, PlainTextDb, merge_records> db(temp_file, user_db_path);
+        const auto records = db.FindRecords(problems);
+
+        EXPECT_EQUAL(records.size(), problems.size());
+        EXPECT(!records[1]);
+
+        for(auto i = std::size_t{0}; i < problems.size(); ++i)
+            EXPECT(SameRecords(records[i], db.FindRecord(problems[i])));
+    }
+
+    protected:
+    static const TestData& other_key()
+    {
+        static const TestData data(9, 10);
+        return data;
+    }
+
+    void PrepareDb() const
+    {
+        DbRecord installed(key());
+        EXPECT(installed.SetValues(id0(), value0()));
+        EXPECT(installed.SetValues(id1(), value1()));
+
+        DbRecord other(other_key());
+        EXPECT(other.SetValues(id0(), value1()));
+
+        DbRecord user(key());
+        EXPECT(user.SetValues(id0(), value2()));
+
+        PlainTextDb installed_db(temp_file);
+        EXPECT(installed_db.StoreRecord(installed));
+        EXPECT(installed_db.StoreRecord(other));
+        EXPECT(PlainTextDb(user_db_path).StoreRecord(user));
+    }
+
+    static bool SameRecords(const boost::optional<DbRecord>& left,
+                            const boost::optional<DbRecord>& right)
+    {
+        if(!left || !right)
+            return !left && !right;
+
+        for(const auto& id : {id0(), id1(), id2()})
+        {
+            TestData left_values(TestData::NoInit{});
+            TestData right_values(TestData::NoInit{});
+            const auto left_found  = left->GetValues(id, left_values);
+            const auto right_found = right->GetValues(id, right_values);
+
+            if(left_found != right_found || !(left_values == right_values))
+                return false;
+        }
+
+        return true;
+    }
+};
+
+class DbCacheTest : public DbMultiFileFindRecordsTest<true>
+{
+    public:
+    void Run() const
+    {
+        std::cout << "Running db cache test..." << std::endl;
+
+        DbRecordCache::Instance().Clear();
+        ResetDb();
+        PrepareDb();
+
+        PrefetchTest();
+        InvalidationTest();
+        BatchTest();
+        LruTest();
+
+        DbRecordCache::Instance().Clear();
+    }
+
+    private:
+    using Db = DbCache<MultiFileDb<PlainTextDb, PlainTextDb, true>>;
+
+    static const TestData& missing_key()
+    {
+        static const TestData data(100, 200);
+        return data;
+    }
+
+    void PrefetchTest() const
+    {
+        const auto& cache = DbRecordCache::Instance();
+        Db(temp_file, user_db_path).Prefetch(std::vector<TestData>{key(), missing_key()});
+        EXPECT_EQUAL(cache.Size(), 2);
+
+        Db db(temp_file, user_db_path);
+        TestData read(TestData::NoInit{});
+
+        EXPECT(db.Load(key(), id0(), read));
+        EXPECT_EQUAL(read, value2());
+        EXPECT(db.Load(key(), id1(), read));
+        EXPECT_EQUAL(read, value1());
+        EXPECT(!db.FindRecord(missing_key()));
+
+        auto stats = cache.GetStats();
+        EXPECT_EQUAL(stats.lookups, 3);
+        EXPECT_EQUAL(stats.hits, 3);
+        EXPECT_EQUAL(stats.negative_hits, 1);
+
+        // Misses of the cache are cached as well.
+        EXPECT(db.FindRecord(other_key()));
+        EXPECT(db.FindRecord(other_key()));
+        stats = cache.GetStats();
+        EXPECT_EQUAL(stats.lookups, 5);
+        EXPECT_EQUAL(stats.hits, 4);
+
+        // Other dbs do not share the records.
+        EXPECT(Db(user_db_path, temp_file).FindRecord(key()));
+        EXPECT_EQUAL(cache.GetStats().hits, 4);
+    }
+
+    void InvalidationTest() const
+    {
+        Db db(temp_file, user_db_path);
+        TestData read(TestData::NoInit{});
+
+        // Writes of this process drop the cached record.
+        EXPECT(db.Update(key(), id2(), value0()));
+        EXPECT(db.Load(key(), id2(), read));
+        EXPECT_EQUAL(read, value0());
+
+        // Writes bypassing the cache are detected by the stamp of the files.
+        EXPECT(!db.FindRecord(missing_key()));
+        DbRecord record(missing_key());
+        EXPECT(record.SetValues(id0(), value0()));
+        EXPECT(PlainTextDb(user_db_path).StoreRecord(record));
+        EXPECT(db.Load(missing_key(), id0(), read));
+        EXPECT_EQUAL(read, value0());
+        EXPECT(DbRecordCache::Instance().GetStats().stale > 0);
+
+        // Even if the file keeps its size and is rewritten within the same second.
+        EXPECT(record.SetValues(id0(), value1()));
+        EXPECT(PlainTextDb(user_db_path).StoreRecord(record));
+        EXPECT(db.Load(missing_key(), id0(), read));
+        EXPECT_EQUAL(read, value1());
+    }
+
+    void BatchTest() const
+    {
+        const auto& cache = DbRecordCache::Instance();
+        Db db(temp_file, user_db_path);
+        TestData read(TestData::NoInit{});
+
+        {
+            auto batch = db.StartWriteBatch();
+            EXPECT(db.Update(key(), id2(), value1()));
+            {
+                auto inner = db.StartWriteBatch();
+                EXPECT(db.Update(other_key(), id2(), value1()));
+                EXPECT(inner.Commit());
+            }
+            // Records read in the batch are cached until it ends.
+            EXPECT(db.Load(key(), id2(), read));
+            EXPECT(db.Load(other_key(), id2(), read));
+            EXPECT_EQUAL(read, value1());
+            const auto size = cache.Size();
+            EXPECT(size >= 2);
+            EXPECT(batch.Commit());
+            EXPECT_EQUAL(cache.Size(), size - 2);
+        }
+
+        EXPECT(db.Load(key(), id2(), read));
+        EXPECT_EQUAL(read, value1());
+    }
+
+    static void LruTest()
+    {
+        DbRecordCache cache(2);
+        auto record = boost::optional<DbRecord>{};
+
+        cache.Insert("db", "0", "", DbRecord(key()), cache.Generation());
+        cache.Insert("db", "1", "", boost::none, cache.Generation());
+        EXPECT(cache.Find("db", "0", "", record));
+        EXPECT(record);
+        cache.Insert("db", "2", "", boost::none, cache.Generation());
+
+        EXPECT_EQUAL(cache.Size(), 2);
+        EXPECT_EQUAL(cache.GetStats().evictions, 1);
+        EXPECT(!cache.Find("db", "1", "", record));
+        EXPECT(cache.Find("db", "2", "", record));
+        EXPECT(!record);
+
+        EXPECT(!cache.Find("db", "0", "changed", record));
+        EXPECT_EQUAL(cache.Size(), 1);
+
+        const auto generation = cache.Generation();
+        cache.Invalidate("2");
+        cache.Insert("db", "2", "", boost::none, generation);
+        EXPECT_EQUAL(cache.Size(), 0);
+
+        DbRecordCache disabled(0);
+        EXPECT(!disabled.IsEnabled());
+        disabled.Insert("db", "0", "", DbRecord(key()), disabled.Generation());
+        EXPECT(!disabled.Find("db", "0", "", record));
+        EXPECT_EQUAL(disabled.GetStats().lookups, 0);
+    }
+};
+
 class DbMultiFileMultiThreadedReadTest : public DbMultiFileTest
 {
     public:
@@ -1309,6 +1530,9 @@ struct PerfDbDriver : test_driver
         DbMultiFileReadTest<false>().Run();
         DbMultiFileWriteTest().Run();
         DbMultiFileOperationsTest().Run();
+        DbMultiFileFindRecordsTest<true>().Run();
+        DbMultiFileFindRecordsTest<false>().Run();
+        DbCacheTest().Run();
         DbMultiFileMultiThreadedReadTest().Run();
         DbMultiFileMultiThreadedTest().Run();
 #endif
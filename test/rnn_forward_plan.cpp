@@ -0,0 +1,224 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/rnn.hpp>
+#include <miopen/tensor.hpp>
+
+#include "get_handle.hpp"
+#include "test.hpp"
+
+#include <cstddef>
+#include <vector>
+
+struct rnn_sequence
+{
+    std::vector<miopen::TensorDescriptor> x;
+    std::vector<miopen::TensorDescriptor> y;
+    std::vector<miopenTensorDescriptor_t> x_ptrs;
+    std::vector<miopenTensorDescriptor_t> y_ptrs;
+
+    rnn_sequence(const std::vector<int>& batches, int in_h, int out_h)
+    {
+        for(auto batch : batches)
+        {
+            x.emplace_back(miopenFloat, std::vector<int>{batch, in_h});
+            y.emplace_back(miopenFloat, std::vector<int>{batch, out_h});
+        }
+        for(std::size_t i = 0; i < batches.size(); i++)
+        {
+            x_ptrs.push_back(&x[i]);
+            y_ptrs.push_back(&y[i]);
+        }
+    }
+
+    int size() const { return static_cast<int>(x.size()); }
+
+    miopen::c_array_view<const miopenTensorDescriptor_t> x_view() const
+    {
+        return {x_ptrs.data(), x_ptrs.size()};
+    }
+
+    miopen::c_array_view<const miopenTensorDescriptor_t> y_view() const
+    {
+        return {y_ptrs.data(), y_ptrs.size()};
+    }
+};
+
+struct rnn_launches
+{
+    std::size_t inference;
+    std::size_t training;
+    std::vector<float> y;
+};
+
+static rnn_launches
+run_forward(const miopen::RNNDescriptor& rnn, const rnn_sequence& seq, int layers, int hsize)
+{
+    auto&& handle = get_handle();
+
+    const int bi = rnn.dirMode == miopenRNNbidirection ? 2 : 1;
+    const miopen::TensorDescriptor hDesc{
+        miopenFloat, std::vector<int>{layers * bi, seq.y.front().GetLengths()[0], hsize}};
+    miopen::TensorDescriptor wDesc;
+    rnn.GetParamsDescriptor(handle, seq.x.front(), wDesc, miopenFloat);
+
+    std::size_t x_size = 0;
+    std::size_t y_size = 0;
+    for(int i = 0; i < seq.size(); i++)
+    {
+        x_size += seq.x[i].GetElementSize();
+        y_size += seq.y[i].GetElementSize();
+    }
+
+    const auto x_dev  = handle.Write(std::vector<float>(x_size, 0.25f));
+    const auto w_dev  = handle.Write(std::vector<float>(wDesc.GetElementSize(), 0.01f));
+    const auto hx_dev = handle.Write(std::vector<float>(hDesc.GetElementSize(), 0.5f));
+    const auto cx_dev = handle.Write(std::vector<float>(hDesc.GetElementSize(), 0.5f));
+    auto y_dev        = handle.Create(y_size * sizeof(float));
+    auto hy_dev       = handle.Create(hDesc.GetElementSize() * sizeof(float));
+    auto cy_dev       = handle.Create(hDesc.GetElementSize() * sizeof(float));
+
+    const auto workspace_size = rnn.GetWorkspaceSize(handle, seq.size(), seq.x_view());
+    const auto reserve_size   = rnn.GetReserveSize(handle, seq.size(), seq.x_view());
+    auto workspace            = handle.Create(workspace_size);
+    auto reserve              = handle.Create(reserve_size);
+
+    rnn_launches result{};
+
+    rnn.RNNForwardInference(handle,
+                            seq.size(),
+                            seq.x_view(),
+                            x_dev.get(),
+                            hDesc,
+                            hx_dev.get(),
+                            hDesc,
+                            cx_dev.get(),
+                            wDesc,
+                            w_dev.get(),
+                            seq.y_view(),
+                            y_dev.get(),
+                            hDesc,
+                            hy_dev.get(),
+                            hDesc,
+                            cy_dev.get(),
+                            workspace.get(),
+                            workspace_size);
+    result.inference = miopen::GetRNNLaunchCount();
+    result.y         = handle.Read<float>(y_dev, y_size);
+
+    rnn.RNNForwardTraining(handle,
+                           seq.size(),
+                           seq.x_view(),
+                           x_dev.get(),
+                           hDesc,
+                           hx_dev.get(),
+                           hDesc,
+                           cx_dev.get(),
+                           wDesc,
+                           w_dev.get(),
+                           seq.y_view(),
+                           y_dev.get(),
+                           hDesc,
+                           hy_dev.get(),
+                           hDesc,
+                           cy_dev.get(),
+                           workspace.get(),
+                           workspace_size,
+                           reserve.get(),
+                           reserve_size);
+    result.training = miopen::GetRNNLaunchCount();
+
+    return result;
+}
+
+static void check_repeated_calls(miopenRNNMode_t mode, miopenRNNDirectionMode_t dir)
+{
+    const int layers = 2;
+    const int in_h   = 8;
+    const int hsize  = 16;
+    const int bi     = dir == miopenRNNbidirection ? 2 : 1;
+
+    const miopen::RNNDescriptor rnn{hsize,
+                                    layers,
+                                    mode,
+                                    miopenRNNlinear,
+                                    dir,
+                                    miopenRNNwithBias,
+                                    miopenRNNdefault,
+                                    miopenFloat};
+
+    const rnn_sequence first{{4, 4, 3, 1}, in_h, hsize * bi};
+    const rnn_sequence second{{5, 2, 2}, in_h, hsize * bi};
+
+    const auto cold = run_forward(rnn, first, layers, hsize);
+    EXPECT(cold.inference > 0);
+    EXPECT(cold.training > 0);
+
+    // Equal shapes from other descriptor objects reuse the plan of the first call.
+    const rnn_sequence same{{4, 4, 3, 1}, in_h, hsize * bi};
+    const miopen::TensorDescriptor hDesc{miopenFloat, std::vector<int>{layers * bi, 4, hsize}};
+    EXPECT(rnn.GetForwardPlan(get_handle(), first.size(), first.x_view(), first.y_view(), hDesc) ==
+           rnn.GetForwardPlan(get_handle(), same.size(), same.x_view(), same.y_view(), hDesc));
+
+    // Plans are told apart by their shapes, not only by the hash of the shapes.
+    const miopen::TensorDescriptor hDesc2{miopenFloat, std::vector<int>{layers * bi, 5, hsize}};
+    const auto plan =
+        rnn.GetForwardPlan(get_handle(), first.size(), first.x_view(), first.y_view(), hDesc);
+    const auto plan2 =
+        rnn.GetForwardPlan(get_handle(), second.size(), second.x_view(), second.y_view(), hDesc2);
+    EXPECT(plan != plan2);
+    EXPECT(plan->shapes != plan2->shapes);
+    EXPECT_EQUAL(plan->shapes.front(), static_cast<std::size_t>(first.size()));
+
+    const auto warm = run_forward(rnn, same, layers, hsize);
+    EXPECT_OP(warm.inference, ==, cold.inference);
+    EXPECT_OP(warm.training, ==, cold.training);
+    EXPECT(warm.y == cold.y);
+
+    const auto other = run_forward(rnn, second, layers, hsize);
+    EXPECT(other.inference > 0);
+    EXPECT(other.training > 0);
+
+    const auto again = run_forward(rnn, first, layers, hsize);
+    EXPECT_OP(again.inference, ==, cold.inference);
+    EXPECT_OP(again.training, ==, cold.training);
+    EXPECT(again.y == cold.y);
+
+    // A cached plan must not hide the validation of the later time steps.
+    const rnn_sequence growing{{4, 4, 5, 1}, in_h, hsize * bi};
+    EXPECT(throws([&] { run_forward(rnn, growing, layers, hsize); }));
+    rnn_sequence mismatched{{4, 4, 3, 1}, in_h, hsize * bi};
+    mismatched.y[2] = miopen::TensorDescriptor{miopenFloat, std::vector<int>{2, hsize * bi}};
+    EXPECT(throws([&] { run_forward(rnn, mismatched, layers, hsize); }));
+}
+
+int main()
+{
+    for(auto mode : {miopenRNNTANH, miopenLSTM, miopenGRU})
+    {
+        check_repeated_calls(mode, miopenRNNunidirection);
+        check_repeated_calls(mode, miopenRNNbidirection);
+    }
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/shared_kernel_cache.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include "test.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::string Binary(std::size_t i, std::size_t size = 4096)
+{
+    return std::string(size, static_cast<char>('a' + i % 26)) + std::to_string(i);
+}
+
+static std::size_t EntriesSize(const boost::filesystem::path& root)
+{
+    std::size_t total = 0;
+    for(boost::filesystem::directory_iterator it{root}, end; it != end; ++it)
+    {
+        if(it->path().extension() != ".lock")
+            total += boost::filesystem::file_size(it->path());
+    }
+    return total;
+}
+
+void check_store_load()
+{
+    const miopen::TmpDir dir{"shared_kernel_cache"};
+    const miopen::SharedKernelCache cache{dir.path, 1024 * 1024};
+
+    EXPECT(!cache.Load("gfx906_60:a.o: -DA=1"));
+    cache.Store("gfx906_60:a.o: -DA=1", Binary(0));
+    cache.Store("gfx906_60:b.o: -DA=1", Binary(1));
+    EXPECT(cache.Load("gfx906_60:a.o: -DA=1").value() == Binary(0));
+    EXPECT(cache.Load("gfx906_60:b.o: -DA=1").value() == Binary(1));
+    EXPECT(!cache.Load("gfx906_60:c.o: -DA=1"));
+
+    // Another process sees the entries.
+    const miopen::SharedKernelCache other{dir.path, 1024 * 1024};
+    EXPECT(other.Load("gfx906_60:a.o: -DA=1").value() == Binary(0));
+
+    // Truncated entries are misses.
+    for(boost::filesystem::directory_iterator it{dir.path}, end; it != end; ++it)
+        boost::filesystem::resize_file(it->path(), 100);
+    EXPECT(!cache.Load("gfx906_60:a.o: -DA=1"));
+}
+
+void check_populate()
+{
+    const miopen::TmpDir dir{"shared_kernel_cache"};
+    const miopen::SharedKernelCache cache{dir.path, 1024 * 1024};
+
+    std::atomic<std::size_t> loads{0};
+    const auto load = [&](std::size_t i) {
+        return [&loads, i]() {
+            ++loads;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            return i == 3 ? std::string{} : Binary(i);
+        };
+    };
+
+    // Workers which miss the same kernels at once read each of them from the db once.
+    std::vector<std::thread> workers;
+    for(std::size_t w = 0; w < 8; ++w)
+    {
+        workers.emplace_back([&]() {
+            for(std::size_t i = 0; i < 3; ++i)
+                EXPECT(cache.LoadOrPopulate("k" + std::to_string(i), load(i)) == Binary(i));
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+    EXPECT(loads == 3);
+
+    // Kernels which are not in the db are not cached.
+    EXPECT(cache.LoadOrPopulate("k3", load(3)).empty());
+    EXPECT(cache.LoadOrPopulate("k3", load(3)).empty());
+    EXPECT(loads == 5);
+}
+
+void check_size_bound()
+{
+    const miopen::TmpDir dir{"shared_kernel_cache"};
+    const std::size_t max_size = 64 * 1024;
+    const miopen::SharedKernelCache cache{dir.path, max_size};
+
+    for(std::size_t i = 0; i < 100; ++i)
+    {
+        cache.Store("k" + std::to_string(i), Binary(i));
+        EXPECT(EntriesSize(dir.path) <= max_size + max_size / 16 + 4096);
+    }
+    EXPECT(cache.Load("k99").value() == Binary(99));
+
+    // Binaries above the bound are not cached.
+    cache.Store("huge", Binary(0, 2 * max_size));
+    EXPECT(!cache.Load("huge"));
+}
+
+int main()
+{
+    check_store_load();
+    check_populate();
+    check_size_bound();
+}
@@ -166,9 +166,61 @@ class SolverTest
 
         // Checking no more searches were done.
         EXPECT_EQUAL(searches, searchable_solver.searches_done());
+
+        ApplicabilityTest();
     }
 
     private:
+    static void ApplicabilityTest()
+    {
+        int calls = 0;
+        std::vector<solver::ApplicabilityCheck> checks;
+        for(std::size_t i = 0; i < 16; ++i)
+            checks.emplace_back([&calls, i](const ConvolutionContext& c) {
+                ++calls;
+                return (c.in_width + i) % 2 == 0;
+            });
+        // Never reached by the queries below, so it must never be evaluated.
+        checks.emplace_back([](const ConvolutionContext&) -> bool {
+            MIOPEN_THROW("Unreachable applicability check evaluated");
+        });
+
+        const auto make_ctx = [](std::size_t width) {
+            auto ctx = ConvolutionContext{TensorDescriptor{miopenFloat, {1, 1, 1, width}},
+                                          TensorDescriptor{miopenFloat, {1, 1, 1, 1}},
+                                          TensorDescriptor{miopenFloat, {1, 1, 1, width}},
+                                          ConvolutionDescriptor{},
+                                          conv::Direction::Forward};
+            ctx.SetStream(&get_handle());
+            return ctx;
+        };
+        const auto query = [&](std::size_t width, std::size_t count) {
+            const auto ctx        = make_ctx(width);
+            const auto applicable = solver::Applicability{"tests.solver.counting", ctx, checks};
+            for(std::size_t i = 0; i < count; ++i)
+                EXPECT_EQUAL(applicable[i], (width + i) % 2 == 0);
+        };
+
+        // Each check of a problem is evaluated on its first query only.
+        query(1, 4);
+        EXPECT_EQUAL(calls, 4);
+        query(1, 4);
+        EXPECT_EQUAL(calls, 4);
+        query(1, 16);
+        EXPECT_EQUAL(calls, 16);
+        query(2, 16);
+        EXPECT_EQUAL(calls, 32);
+        query(1, 16);
+        EXPECT_EQUAL(calls, 32);
+
+        // An exception reaches the caller which asked for the check and is not memoized.
+        const auto ctx        = make_ctx(1);
+        const auto applicable = solver::Applicability{"tests.solver.counting", ctx, checks};
+        EXPECT(throws([&] { return applicable[16]; }));
+        EXPECT(throws([&] { return applicable[16]; }));
+        EXPECT_EQUAL(calls, 32);
+    }
+
     static void ConstructTest(const std::string& db_path,
                               const char* expected_kernel,
                               const std::initializer_list<size_t>& in,
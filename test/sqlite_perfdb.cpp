@@ -40,6 +40,8 @@
 #include <boost/thread.hpp>
 
 #include <array>
+#include <chrono>
+#include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
@@ -932,6 +934,203 @@ class DbMultiProcessReadTest : public DbTest
     static std::string LockFilePath(const std::string& db_path) { return db_path + ".test.lock"; }
 };
 
+class DbWriteBatchTest : public DbTest
+{
+    public:
+    void Run() const
+    {
+        std::cout << "Testing db write batches..." << std::endl;
+        ResetDb();
+        SQLitePerfDb db(temp_file, false, "gfx906", 64);
+
+        {
+            auto batch = db.StartWriteBatch();
+            EXPECT(db.Update(key(), id0(), value0()));
+            EXPECT(db.Update(key(), id1(), value1()));
+            {
+                // Nested batches join the outer one.
+                auto inner = db.StartWriteBatch();
+                EXPECT(db.Update(ProblemData(1), id0(), value2()));
+                EXPECT(inner.Commit());
+            }
+            // Reads in the batch see its writes.
+            const auto in_batch = db.FindRecords(std::vector<ProblemData>{key(), ProblemData(1)});
+            EXPECT(in_batch[0] && in_batch[1]);
+            EXPECT(batch.Commit());
+        }
+        SolverData read(SolverData::NoInit{});
+        EXPECT(SQLitePerfDb(temp_file, false, "gfx906", 64).Load(key(), id1(), read));
+        EXPECT_EQUAL(read, value1());
+
+        {
+            // Not committed, e.g. left by an exception.
+            auto batch = db.StartWriteBatch();
+            EXPECT(db.Update(ProblemData(2), id0(), value0()));
+            EXPECT(db.Remove(key(), id0()));
+        }
+        {
+            auto batch = db.StartWriteBatch();
+            {
+                auto inner = db.StartWriteBatch();
+                EXPECT(db.Update(ProblemData(3), id0(), value0()));
+            }
+            EXPECT(!batch.Commit());
+        }
+
+        auto other        = SQLitePerfDb(temp_file, false, "gfx906", 64);
+        auto rolled_back0 = ProblemData(2);
+        auto rolled_back1 = ProblemData(3);
+        EXPECT(!other.FindRecord(rolled_back0));
+        EXPECT(!other.FindRecord(rolled_back1));
+        EXPECT(other.Load(key(), id0(), read));
+        EXPECT_EQUAL(read, value0());
+    }
+};
+
+class DbKilledWriterTest
+{
+    public:
+    static constexpr const char* killed_writer_arg = "mp-test-child-killed-writer";
+    static constexpr unsigned int records_count    = 16;
+
+    void Run() const
+    {
+        std::cout << "Testing db for a writer killed in a batch..." << std::endl;
+
+        RunWriter();
+        setenv("MIOPEN_DEBUG_PERFDB_SQLITE_WAL", "1", 1);
+        RunWriter();
+        unsetenv("MIOPEN_DEBUG_PERFDB_SQLITE_WAL");
+    }
+
+    static void WorkItem(const std::string& db_path)
+    {
+        auto db    = SQLitePerfDb(db_path, false, "gfx906", 64);
+        auto batch = db.StartWriteBatch();
+        for(auto i = 0u; i < records_count; ++i)
+            EXPECT(db.Update(ProblemData(Key(i)), "killed", Value(i)));
+        std::raise(SIGKILL);
+    }
+
+    private:
+    static int Key(unsigned int i) { return i + 1; }
+    static SolverData Value(unsigned int i) { return {Key(i), 11}; }
+
+    static void RunWriter()
+    {
+        TempFile temp_file("miopen.tests.perfdb.killed");
+        const std::string path = temp_file;
+        (void)SQLitePerfDb(path, false, "gfx906", 64);
+
+        const auto command =
+            exe_path().string() + " --" + killed_writer_arg + " --" + DbMultiProcessTest::path_arg +
+            " " + path + " --" + DbMultiProcessTest::id_arg + " 0";
+        const auto child = popen(command.c_str(), "w");
+        EXPECT(child != nullptr);
+        const auto status = pclose(child);
+        // popen() runs the writer through the shell which reports the signal in the exit code.
+        EXPECT(WIFSIGNALED(status) || WEXITSTATUS(status) == 128 + SIGKILL);
+
+        // None of the records of the batch is left, the db stays writable.
+        auto db = SQLitePerfDb(path, false, "gfx906", 64);
+        for(auto i = 0u; i < records_count; ++i)
+        {
+            auto problem = ProblemData(Key(i));
+            EXPECT(!db.FindRecord(problem));
+        }
+        EXPECT(db.Update(ProblemData(Key(0)), "killed", Value(0)));
+        SolverData read(SolverData::NoInit{});
+        EXPECT(db.Load(ProblemData(Key(0)), "killed", read));
+        EXPECT_EQUAL(read, Value(0));
+
+        boost::filesystem::remove(path + "-wal");
+        boost::filesystem::remove(path + "-shm");
+    }
+};
+
+class DbMultiProcessWalTest
+{
+    public:
+    static constexpr const char* writer_arg = "mp-test-child-wal-writer";
+    static unsigned int records_count;
+
+    void Run() const
+    {
+        std::cout << "Testing db for multiprocess writes with the WAL journal..." << std::endl;
+
+        const auto rollback = RunProcesses("delete");
+        // Only the children read the variable, the journal mode is stored in the db file.
+        setenv("MIOPEN_DEBUG_PERFDB_SQLITE_WAL", "1", 1);
+        const auto wal = RunProcesses("wal");
+        unsetenv("MIOPEN_DEBUG_PERFDB_SQLITE_WAL");
+
+        const auto records = DBMultiThreadedTestWork::threads_count * records_count;
+        std::cout << DBMultiThreadedTestWork::threads_count << " processes, " << records
+                  << " updates. Rollback journal: " << records / rollback
+                  << " updates/s, WAL journal: " << records / wal << " updates/s" << std::endl;
+    }
+
+    static void WorkItem(unsigned int id, const std::string& db_path)
+    {
+        auto db = SQLitePerfDb(db_path, false, "gfx906", 64);
+        for(auto i = 0u; i < records_count; ++i)
+            EXPECT(db.Update(ProblemData(Key(id, i)), "wal", Value(id, i)));
+    }
+
+    private:
+    static int Key(unsigned int id, unsigned int i) { return id * records_count + i + 1; }
+    static SolverData Value(unsigned int id, unsigned int i) { return {Key(id, i), 7}; }
+
+    static double RunProcesses(const std::string& journal_mode)
+    {
+        TempFile temp_file("miopen.tests.perfdb.wal");
+        const std::string path = temp_file;
+        // Creates the tables before the writers start.
+        (void)SQLitePerfDb(path, false, "gfx906", 64);
+
+        std::vector<FILE*> children(DBMultiThreadedTestWork::threads_count);
+        const auto start = std::chrono::steady_clock::now();
+        auto id          = 0;
+        for(auto& child : children)
+        {
+            auto command = exe_path().string() + " --" + writer_arg + " --" +
+                           DbMultiProcessTest::id_arg + " " + std::to_string(id++) + " --" +
+                           DbMultiProcessTest::path_arg + " " + path;
+            child = popen(command.c_str(), "w");
+        }
+
+        for(auto child : children)
+        {
+            auto status = pclose(child);
+            EXPECT_EQUAL(WEXITSTATUS(status), 0);
+        }
+        const auto time =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // No update is lost.
+        auto db = SQLitePerfDb(path, false, "gfx906", 64);
+        // The writers have switched the journal of the file.
+        const auto res = db.sql.Exec("PRAGMA journal_mode;");
+        EXPECT(!res.empty());
+        EXPECT_EQUAL(res.front().begin()->second, journal_mode);
+        for(auto i = 0u; i < DBMultiThreadedTestWork::threads_count; ++i)
+        {
+            for(auto j = 0u; j < records_count; ++j)
+            {
+                SolverData read(SolverData::NoInit{});
+                EXPECT(db.Load(ProblemData(Key(i, j)), "wal", read));
+                EXPECT_EQUAL(read, Value(i, j));
+            }
+        }
+
+        boost::filesystem::remove(path + "-wal");
+        boost::filesystem::remove(path + "-shm");
+        return time;
+    }
+};
+
+unsigned int DbMultiProcessWalTest::records_count = 64;
+
 class DbMultiFileTest : public DbTest
 {
     protected:
@@ -1223,6 +1422,8 @@ struct PerfDbDriver : test_driver
     {
         add(logs_root, DbMultiThreadedTest::logs_path_arg);
         add(test_write, DbMultiProcessTest::write_arg, flag());
+        add(mt_child_wal_writer, DbMultiProcessWalTest::writer_arg, flag());
+        add(mt_child_killed_writer, DbKilledWriterTest::killed_writer_arg, flag());
 
         add(mt_child_id, DbMultiProcessTest::id_arg);
         add(mt_child_db_path, DbMultiProcessTest::path_arg);
@@ -1239,6 +1440,17 @@ struct PerfDbDriver : test_driver
             DBMultiThreadedTestWork::threads_count    = 32;
             DBMultiThreadedTestWork::common_part_size = 128;
             DBMultiThreadedTestWork::unique_part_size = 128;
+            DbMultiProcessWalTest::records_count      = 256;
+        }
+        if(mt_child_id >= 0 && mt_child_killed_writer)
+        {
+            DbKilledWriterTest::WorkItem(mt_child_db_path);
+            return;
+        }
+        if(mt_child_id >= 0 && mt_child_wal_writer)
+        {
+            DbMultiProcessWalTest::WorkItem(mt_child_id, mt_child_db_path);
+            return;
         }
         if(mt_child_id >= 0)
         {
@@ -1252,6 +1464,9 @@ struct PerfDbDriver : test_driver
         DbMultiThreadedReadTest().Run();
         DbMultiProcessReadTest().Run();
         DbMultiProcessTest().Run();
+        DbWriteBatchTest().Run();
+        DbKilledWriterTest().Run();
+        DbMultiProcessWalTest().Run();
 #if !MIOPEN_DISABLE_USERDB
         DbMultiFileReadTest<true>().Run();
         DbMultiFileReadTest<false>().Run();
@@ -1268,6 +1483,8 @@ struct PerfDbDriver : test_driver
 
     int mt_child_id = -1;
     std::string mt_child_db_path;
+    bool mt_child_wal_writer    = false;
+    bool mt_child_killed_writer = false;
 };
 } // namespace tests
 } // namespace miopen
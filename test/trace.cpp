@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/trace.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char* const outer_name = "outer \"span\"";
+
+static void Outer()
+{
+    MIOPEN_TRACE_SPAN(outer_name, "test");
+    for(auto i = 0; i < 4; ++i)
+    {
+        MIOPEN_TRACE_SPAN("inner", "test");
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+static const miopen::trace::SpanStats& Find(const std::vector<miopen::trace::SpanStats>& stats,
+                                            const std::string& name)
+{
+    const auto it = std::find_if(
+        stats.begin(), stats.end(), [&](const auto& span) { return span.name == name; });
+    EXPECT(it != stats.end());
+    return *it;
+}
+
+void check_stats()
+{
+    miopen::trace::Reset();
+    std::vector<std::thread> threads;
+    for(auto i = 0; i < 4; ++i)
+        threads.emplace_back(Outer);
+    for(auto& thread : threads)
+        thread.join();
+
+    const auto stats = miopen::trace::GetStats();
+    const auto& outer = Find(stats, outer_name);
+    const auto& inner = Find(stats, "inner");
+    EXPECT(outer.count == 4);
+    EXPECT(inner.count == 16);
+    EXPECT(inner.category == "test");
+    EXPECT(inner.min_us >= 50);
+    EXPECT(inner.min_us <= inner.max_us);
+    EXPECT(outer.total_us >= inner.total_us / 4);
+    EXPECT(inner.QuantileUs(0.5) <= inner.QuantileUs(0.99));
+    EXPECT(inner.QuantileUs(0.99) >= inner.min_us);
+}
+
+void check_chrome_trace(const std::string& path)
+{
+    miopen::trace::Reset();
+    Outer();
+    EXPECT(miopen::trace::WriteChromeTrace(path));
+
+    std::ifstream file(path);
+    const auto json = std::string(std::istreambuf_iterator<char>(file), {});
+    EXPECT(json.find("{\"traceEvents\":[") == 0);
+    EXPECT(json.find("\"name\":\"outer \\\"span\\\"\"") != std::string::npos);
+
+    auto events = 0;
+    for(auto pos = json.find("\"ph\":\"X\""); pos != std::string::npos;
+        pos      = json.find("\"ph\":\"X\"", pos + 1))
+        ++events;
+    EXPECT(events == 5);
+}
+
+int main()
+{
+    // Outlives the trace written at exit.
+    static const miopen::TmpDir dir{"trace"};
+    const auto path = (dir.path / "trace.json").string();
+    // Read once by the library, so it is set before the first span.
+    setenv("MIOPEN_TRACE_FILE", path.c_str(), 1);
+    EXPECT(miopen::trace::IsEnabled());
+
+    check_stats();
+    check_chrome_trace(path);
+    miopen::trace::Reset();
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/generic_search.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_checkpoint.hpp>
+
+#include "test.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+struct FakeContext
+{
+    int size = 0;
+};
+
+struct FakeConfig
+{
+    int value = -1;
+
+    FakeConfig() = default;
+    FakeConfig(bool) : value(0) {}
+
+    bool SetNextValue() { return ++value < 200; }
+    bool IsValid(const FakeContext& context) const
+    {
+        return value < context.size && value % 5 != 3;
+    }
+    bool operator==(const FakeConfig& other) const { return value == other.value; }
+
+    friend std::ostream& operator<<(std::ostream& os, const FakeConfig& config)
+    {
+        return os << "fake," << config.value;
+    }
+};
+
+struct Preempted
+{
+};
+
+// Deterministic timings with a few close calls and failures, only the first run of a config
+// prepares it.
+struct FakeTimer
+{
+    std::size_t prepared = 0;
+
+    float operator()(const FakeConfig& config, bool first)
+    {
+        if(first)
+            ++prepared;
+        if(config.value % 11 == 7)
+            throw std::runtime_error("fake failure");
+        const auto base = 1.0f + static_cast<float>((config.value * 37) % 97) / 16.0f;
+        return first ? base : base * 1.01f;
+    }
+};
+
+struct Result
+{
+    FakeConfig config;
+    float time;
+    std::size_t prepared;
+};
+
+// Mirrors the loop of GenericSearch, preempted before the config number stop_after.
+Result Search(miopen::solver::TuningCheckpoint& checkpoint,
+              std::size_t stop_after = std::numeric_limits<std::size_t>::max())
+{
+    using namespace miopen::solver;
+    const auto context = FakeContext{160};
+    const ComputedContainer<FakeConfig, FakeContext> configs(context);
+    const auto n_total = std::distance(configs.begin(), configs.end());
+
+    auto timer    = FakeTimer{};
+    auto progress = SearchProgress<FakeConfig>{checkpoint, static_cast<std::size_t>(n_total)};
+    for(const auto& config : configs)
+    {
+        if(timer.prepared == stop_after)
+            throw Preempted{};
+        progress.Evaluate(config, [&](bool first) { return timer(config, first); });
+    }
+    checkpoint.Remove();
+    EXPECT(progress.IsPassed());
+    return {progress.GetBestConfig(), progress.GetBestTime(), timer.prepared};
+}
+
+void SearchPreempted(const std::string& path, std::size_t stop_after)
+{
+    miopen::solver::TuningCheckpoint checkpoint{"fake", path};
+    try
+    {
+        Search(checkpoint, stop_after);
+    }
+    catch(const Preempted&)
+    {
+        return;
+    }
+    MIOPEN_THROW("Search has not been preempted");
+}
+
+void check_resume(const std::string& path)
+{
+    miopen::solver::TuningCheckpoint no_checkpoint{"fake", ""};
+    const auto reference = Search(no_checkpoint);
+
+    SearchPreempted(path, 20);
+    EXPECT(boost::filesystem::exists(path));
+    SearchPreempted(path, 30);
+
+    miopen::solver::TuningCheckpoint checkpoint{"fake", path};
+    EXPECT(checkpoint.GetLoadedCount() == 50);
+    const auto resumed = Search(checkpoint);
+    EXPECT(resumed.config == reference.config);
+    EXPECT(resumed.time == reference.time);
+    EXPECT(resumed.prepared + 50 == reference.prepared);
+    EXPECT(!boost::filesystem::exists(path));
+}
+
+void check_other_search(const std::string& path)
+{
+    boost::filesystem::remove(path);
+    SearchPreempted(path, 20);
+
+    miopen::solver::TuningCheckpoint other{"other", path};
+    EXPECT(other.GetLoadedCount() == 0);
+    miopen::solver::TuningCheckpoint same{"fake", path};
+    EXPECT(same.GetLoadedCount() == 20);
+}
+
+// A line cut by the preemption is ignored, the file is rewritten on the next save.
+void check_torn_line(const std::string& path)
+{
+    boost::filesystem::remove(path);
+    SearchPreempted(path, 20);
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "C 1.5 fake,";
+    }
+
+    miopen::solver::TuningCheckpoint checkpoint{"fake", path};
+    EXPECT(checkpoint.GetLoadedCount() == 20);
+    miopen::solver::TuningCheckpoint no_checkpoint{"fake", ""};
+    EXPECT(Search(checkpoint).config == Search(no_checkpoint).config);
+}
+
+int main()
+{
+    const miopen::TmpDir dir{"tuning_checkpoint"};
+    const auto path = (dir.path / "tuning" / "fake.txt").string();
+    check_resume(path);
+    check_other_search(path);
+    check_torn_line(path);
+}
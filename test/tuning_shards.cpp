@@ -0,0 +1,250 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/generic_search.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_checkpoint.hpp>
+
+#include "test.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct FakeContext
+{
+    int size = 0;
+};
+
+struct FakeConfig
+{
+    int value = -1;
+
+    FakeConfig() = default;
+    FakeConfig(bool) : value(0) {}
+
+    bool SetNextValue() { return ++value < 200; }
+    bool IsValid(const FakeContext& context) const
+    {
+        return value < context.size && value % 5 != 3;
+    }
+    bool operator==(const FakeConfig& other) const { return value == other.value; }
+
+    friend std::ostream& operator<<(std::ostream& os, const FakeConfig& config)
+    {
+        return os << "fake," << config.value;
+    }
+};
+
+// Every config takes the same time in every run, a few of them fail. Measuring takes a while, so
+// that concurrent searches interleave.
+struct FakeTimer
+{
+    std::size_t measured  = 0;
+    std::size_t die_after = std::numeric_limits<std::size_t>::max();
+    bool hang             = false;
+    bool slow             = false;
+
+    float operator()(const FakeConfig& config, bool first)
+    {
+        if(first)
+        {
+            // Stops for a while and then goes on measuring, while its shard is taken over.
+            if(measured == die_after && slow)
+                std::this_thread::sleep_for(std::chrono::seconds(4));
+            else if(measured == die_after)
+            {
+                // Holds the locks for a while, like a process stopped in a debugger.
+                if(hang)
+                    std::this_thread::sleep_for(std::chrono::seconds(10));
+                std::_Exit(0); // Like a killed process: no destructors, no unlocking.
+            }
+            ++measured;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if(config.value % 11 == 7)
+            throw std::runtime_error("fake failure");
+        return 1.0f + static_cast<float>((config.value * 37) % 97) / 16.0f;
+    }
+};
+
+struct Result
+{
+    int best;
+    float time;
+    std::size_t measured;
+};
+
+const std::size_t shard_size = 8;
+
+Result Search(const std::string& directory,
+              std::size_t die_after = std::numeric_limits<std::size_t>::max(),
+              bool hang             = false,
+              bool slow             = false)
+{
+    using namespace miopen::solver;
+    const auto context = FakeContext{160};
+    const ComputedContainer<FakeConfig, FakeContext> configs(context);
+    const auto n_total = static_cast<std::size_t>(std::distance(configs.begin(), configs.end()));
+
+    TuningShards shards{"fake", directory, n_total, shard_size};
+    TuningCheckpoint checkpoint{"fake", ""};
+    SearchProgress<FakeConfig> progress{checkpoint, n_total};
+    auto timer      = FakeTimer{};
+    timer.die_after = die_after;
+    timer.hang      = hang;
+    timer.slow      = slow;
+
+    SearchAll(configs,
+              shards,
+              checkpoint,
+              progress,
+              [&](SearchProgress<FakeConfig>& current, const FakeConfig& config) {
+                  current.Evaluate(config, [&](bool first) { return timer(config, first); });
+              });
+    EXPECT(progress.IsPassed());
+    return {progress.GetBestConfig().value, progress.GetBestTime(), timer.measured};
+}
+
+bool IsEmpty(const boost::filesystem::path& directory)
+{
+    return !boost::filesystem::exists(directory) ||
+           boost::filesystem::directory_iterator(directory) ==
+               boost::filesystem::directory_iterator{};
+}
+
+void check_processes(const std::string& exe, const std::string& directory, const Result& reference)
+{
+    std::vector<FILE*> children;
+    for(auto i = 0; i < 4; ++i)
+        children.push_back(popen((exe + " --child " + directory).c_str(), "r"));
+
+    std::size_t measured = 0;
+    for(auto child : children)
+    {
+        EXPECT(child != nullptr);
+        auto result = Result{};
+        EXPECT(std::fscanf(child, "%d %f %zu", &result.best, &result.time, &result.measured) == 3);
+        EXPECT(pclose(child) == 0);
+        EXPECT(result.best == reference.best);
+        EXPECT(result.time == reference.time);
+        measured += result.measured;
+    }
+    // Each config has been measured by exactly one of the processes.
+    EXPECT(measured == reference.measured);
+    EXPECT(IsEmpty(directory));
+}
+
+void check_abandoned(const std::string& exe, const std::string& directory, const Result& reference)
+{
+    // Dies in the middle of its second shard, having measured 5 of its configs.
+    EXPECT(std::system((exe + " --child " + directory + " 13").c_str()) == 0);
+    EXPECT(!IsEmpty(directory));
+
+    const auto resumed = Search(directory);
+    EXPECT(resumed.best == reference.best);
+    EXPECT(resumed.time == reference.time);
+    EXPECT(resumed.measured + 13 == reference.measured);
+    EXPECT(IsEmpty(directory));
+}
+
+void check_stalled(const std::string& exe, const std::string& directory, const Result& reference)
+{
+    // Hangs in the middle of its second shard, having measured 5 of its configs.
+    const auto stalled = popen((exe + " --child " + directory + " 13 --hang").c_str(), "r");
+    EXPECT(stalled != nullptr);
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    const auto command = "MIOPEN_DEBUG_TUNING_SHARD_TIMEOUT=1 " + exe + " --child " + directory;
+    const auto child = popen(command.c_str(), "r");
+    EXPECT(child != nullptr);
+    auto result = Result{};
+    EXPECT(std::fscanf(child, "%d %f %zu", &result.best, &result.time, &result.measured) == 3);
+    EXPECT(pclose(child) == 0);
+    EXPECT(result.best == reference.best);
+    EXPECT(result.time == reference.time);
+    EXPECT(result.measured + 13 == reference.measured);
+    EXPECT(pclose(stalled) == 0);
+}
+
+void check_slow(const std::string& exe, const std::string& directory, const Result& reference)
+{
+    // Stops in the middle of its second shard and finishes it after it has been taken over, both
+    // processes writing the outcomes of the shard at the same time.
+    // Markers of the stalled search which has been cleaned up before the hanging process exited.
+    boost::filesystem::remove_all(directory);
+    const auto slow = popen((exe + " --child " + directory + " 13 --slow").c_str(), "r");
+    EXPECT(slow != nullptr);
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    const auto command = "MIOPEN_DEBUG_TUNING_SHARD_TIMEOUT=1 " + exe + " --child " + directory;
+    const auto child = popen(command.c_str(), "r");
+    EXPECT(child != nullptr);
+    for(auto process : {child, slow})
+    {
+        auto result = Result{};
+        EXPECT(std::fscanf(process, "%d %f %zu", &result.best, &result.time, &result.measured) ==
+               3);
+        EXPECT(pclose(process) == 0);
+        EXPECT(result.best == reference.best);
+        EXPECT(result.time == reference.time);
+    }
+    EXPECT(IsEmpty(directory));
+}
+
+int main(int argc, const char* argv[])
+{
+    if(argc > 2 && std::string{argv[1]} == "--child")
+    {
+        const auto die_after = argc > 3 ? std::strtoul(argv[3], nullptr, 10)
+                                        : std::numeric_limits<std::size_t>::max();
+        const auto hang   = argc > 4 && std::string{argv[4]} == "--hang";
+        const auto slow   = argc > 4 && std::string{argv[4]} == "--slow";
+        const auto result = Search(argv[2], die_after, hang, slow);
+        std::cout << result.best << ' '
+                  << std::setprecision(std::numeric_limits<float>::max_digits10) << result.time
+                  << ' ' << result.measured << std::endl;
+        return 0;
+    }
+
+    const miopen::TmpDir dir{"tuning_shards"};
+    const auto directory = (dir.path / "tuning").string();
+    const auto reference = Search("");
+    check_processes(argv[0], directory, reference);
+    check_abandoned(argv[0], directory, reference);
+    check_stalled(argv[0], directory, reference);
+    check_slow(argv[0], directory, reference);
+}
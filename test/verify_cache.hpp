@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef MIOPEN_GUARD_TEST_VERIFY_CACHE_HPP
+#define MIOPEN_GUARD_TEST_VERIFY_CACHE_HPP
+
+#include <miopen/config.h>
+#include <miopen/shared_file_store.hpp>
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+#include <miopen/bz2.hpp>
+#endif
+
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+
+struct verify_cache_stats
+{
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> misses{0};
+    std::atomic<std::size_t> stores{0};
+    std::atomic<std::size_t> evictions{0};
+    // Bytes written by this process since the last size check.
+    std::atomic<std::size_t> unchecked_bytes{0};
+
+    void report(std::ostream& os) const
+    {
+        const std::size_t lookups = hits + misses;
+        if(lookups == 0)
+            return;
+        os << "Verification cache: " << hits << " hits, " << misses << " misses ("
+           << 100 * hits / lookups << "% hit rate), " << stores << " stored, " << evictions
+           << " evicted" << std::endl;
+    }
+};
+
+inline verify_cache_stats& get_verify_cache_stats()
+{
+    static verify_cache_stats stats;
+    return stats;
+}
+
+// Store of CPU references shared by concurrent test processes. Entries are named by the
+// hash of their inputs, compressed when bzip2 is available, and kept in a
+// miopen::SharedFileStore.
+class verify_cache
+{
+    public:
+    verify_cache(boost::filesystem::path root_, std::size_t max_size_)
+        : files(std::move(root_), max_size_)
+    {
+    }
+
+    bool load(const std::string& key, std::string& data) const
+    {
+        auto& stats  = get_verify_cache_stats();
+        const auto f = files.Path() / key;
+        if(read(f, data))
+        {
+            ++stats.hits;
+            miopen::SharedFileStore::Touch(f);
+            return true;
+        }
+        ++stats.misses;
+        return false;
+    }
+
+    void store(const std::string& key, const std::string& data) const
+    {
+        auto& stats        = get_verify_cache_stats();
+        const auto f       = files.Path() / key;
+        const auto written = files.Publish(f, [&](std::ostream& os) { write(os, data); });
+        if(written == 0)
+            return;
+        ++stats.stores;
+        stats.evictions += files.Account(stats.unchecked_bytes, written, f);
+    }
+
+    private:
+    miopen::SharedFileStore files;
+
+    static const char* magic() { return "miopen-verify-cache"; }
+
+    static void write(std::ostream& os, const std::string& data)
+    {
+        bool compressed = false;
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+        const auto packed = data.empty() ? data : miopen::compress(data, &compressed);
+#else
+        const auto& packed = data;
+#endif
+        os << magic() << ' ' << compressed << ' ' << data.size() << '\n';
+        os.write(packed.data(), packed.size());
+    }
+
+    static bool read(const boost::filesystem::path& f, std::string& data)
+    {
+        std::ifstream is{f.string(), std::ios::binary};
+        if(!is)
+            return false;
+        std::string header;
+        bool compressed  = false;
+        std::size_t size = 0;
+        if(!(is >> header >> compressed >> size) || header != magic() || is.get() != '\n')
+            return false;
+        std::string packed{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+        if(!compressed)
+        {
+            if(packed.size() != size)
+                return false;
+            data = std::move(packed);
+            return true;
+        }
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+        try
+        {
+            data = miopen::decompress(packed, size);
+        }
+        catch(const std::exception&)
+        {
+            return false;
+        }
+        return data.size() == size;
+#else
+        return false;
+#endif
+    }
+};
+
+#endif